@@ -0,0 +1,413 @@
+// ulp_bench.cpp
+// Microbenchmarks for the ulp hot path: line parsing, validators, domain filters and lists, queues
+// Compiles ulp.cpp into the same translation unit so the static helpers can be timed directly
+//
+// g++ -std=c++17 -O2 -o ulp_bench bench/ulp_bench.cpp
+// ./ulp_bench [name-substring]
+
+#define ULP_NO_MAIN
+#include "../ulp.cpp"
+
+#include "ulp_synth.h"
+
+#include <iomanip>
+
+namespace bench {
+
+// Keeps results observable so the optimizer cannot drop the measured work
+static volatile size_t sink = 0;
+
+using synth::Rng;
+
+static std::string randomWord(Rng &rng, size_t minLen, size_t maxLen) {
+    static const char alphabet[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+    size_t len = rng.between(minLen, maxLen);
+    std::string w;
+    for (size_t i = 0; i < len; ++i) w.push_back(alphabet[rng.below(26 + (i > 0 ? 10 : 0))]);
+    return w;
+}
+
+static std::string randomDomain(Rng &rng) {
+    static const char *const tlds[] = { "com", "net", "org", "de", "co.uk", "com.br", "ru", "fr" };
+    return randomWord(rng, 3, 12) + "." + tlds[rng.below(8)];
+}
+
+// Lines as ulp's producer sees them: synthetic dump lines without the trailing '\n'
+static std::vector<std::string> makeLines(size_t count, const std::string &format, uint64_t seed) {
+    synth::Options opts;
+    opts.format = format;
+    opts.seed = seed;
+    synth::Generator gen(opts);
+    std::vector<std::string> lines;
+    lines.reserve(count);
+    std::string buffer;
+    for (size_t i = 0; i < count; ++i) {
+        buffer.clear();
+        gen.appendLine(buffer);
+        buffer.pop_back();
+        lines.push_back(buffer);
+    }
+    return lines;
+}
+
+struct Result {
+    double nsPerOp;
+    uint64_t iterations;
+};
+
+// Run fn(iterations) with doubling iteration counts until one run takes at least minSeconds
+template<typename Fn>
+static Result measure(Fn &&fn, double minSeconds = 0.3) {
+    uint64_t iterations = 1;
+    while (true) {
+        auto start = std::chrono::steady_clock::now();
+        fn(iterations);
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed >= minSeconds || iterations >= (1ull << 40))
+            return { elapsed * 1e9 / static_cast<double>(iterations), iterations };
+        uint64_t scale = elapsed > 0 ? static_cast<uint64_t>(minSeconds / elapsed * 1.2) + 1 : 16;
+        iterations *= std::min<uint64_t>(std::max<uint64_t>(scale, 2), 16);
+    }
+}
+
+static std::string nameFilter;
+
+static void report(const std::string &name, const Result &r, double bytesPerOp = 0) {
+    std::cout << std::left << std::setw(40) << name << std::right
+              << std::setw(14) << r.iterations
+              << std::setw(14) << std::fixed << std::setprecision(1) << r.nsPerOp << " ns/op"
+              << std::setw(14) << static_cast<uint64_t>(1e9 / r.nsPerOp) << " op/s";
+    if (bytesPerOp > 0)
+        std::cout << std::setw(10) << std::setprecision(1) << bytesPerOp / r.nsPerOp * 1e3 << " MB/s";
+    std::cout << "\n";
+}
+
+// Benchmark fn over a cycling set of inputs; reports per-input cost
+template<typename T, typename Fn>
+static void run(const std::string &name, const std::vector<T> &inputs, Fn &&fn, double bytesPerOp = 0) {
+    if (!nameFilter.empty() && name.find(nameFilter) == std::string::npos) return;
+    Result r = measure([&](uint64_t iterations) {
+        size_t acc = 0, i = 0;
+        for (uint64_t n = 0; n < iterations; ++n) {
+            acc += fn(inputs[i]);
+            if (++i == inputs.size()) i = 0;
+        }
+        sink = sink + acc;
+    });
+    report(name, r, bytesPerOp);
+}
+
+static double averageSize(const std::vector<std::string> &v) {
+    size_t total = 0;
+    for (const auto &s : v) total += s.size();
+    return v.empty() ? 0 : static_cast<double>(total) / static_cast<double>(v.size());
+}
+
+static Config defaultConfig(const std::string &format) {
+    Config config;
+    config.separator = ":";
+    config.format = format;
+    Profile profile;
+    profile.name = "default";
+    profile.convert_format = "email:pass";
+    for (const char *d : { "gmail.com", "yahoo.com", "hotmail.com", "aol.com", "msn.com", "live.com",
+                           "gmx.com", "web.de", "yandex.com", "mail.com", "qq.com", "me.com" })
+        profile.email_remove.insert(d);
+    compileProfile(profile, config.separator);
+    config.profiles.push_back(profile);
+    metrics.initProfiles(config);
+    return config;
+}
+
+// Parse and route one line through the first profile the way the worker does, with the '@' count
+// its structural index supplies; buffers are reused across lines as in the worker loop
+struct LineRouter {
+    explicit LineRouter(const Config &c) : config(c) {}
+
+    const Config &config;
+    std::vector<std::string> tokens;
+    ParsedLine parsed;
+    std::string out;
+    DedupKey key;
+
+    size_t operator()(const std::string &line) {
+        tokens = split(line, config.separator);
+        size_t atCount = static_cast<size_t>(std::count(line.begin(), line.end(), '@'));
+        out.clear();
+        if (!parseLine(line, tokens, atCount, config, parsed) ||
+            !routeLine(parsed, config.profiles[0], 0, config, out, key))
+            return 0;
+        return out.size();
+    }
+};
+
+static void benchProcessLine() {
+    for (const std::string format : { "url:email:pass", "email:pass" }) {
+        auto lines = makeLines(4096, format, 1);
+        Config config = defaultConfig(format);
+        run("processLine/" + format, lines, LineRouter(config), averageSize(lines));
+    }
+}
+
+// normalize_idn: the conversion itself, and its per-line cost on ordinary lines (only the screen
+// runs) and on a dump where every fourth line has an internationalized domain
+static void benchIdn() {
+    const std::vector<std::string> domains = {
+        "b\xC3\xBC" "cher.de", "\xD0\xBF\xD1\x80\xD0\xB8\xD0\xBC\xD0\xB5\xD1\x80.\xD1\x80\xD1\x84",
+        "\xE4\xBE\x8B\xE3\x81\x88.jp", "M\xC3\xBCnchen.DE", "xn--bcher-kva.DE", "caf\xC3\xA9.fr"
+    };
+    std::string ascii;
+    run("idn/toAscii", domains, [&](const std::string &d) {
+        return idn::toAscii(d, ascii) ? ascii.size() : 0;
+    }, averageSize(domains));
+    auto lines = makeLines(4096, "url:email:pass", 1);
+    Config config = defaultConfig("url:email:pass");
+    config.normalize_idn = true;
+    run("processLine/url:email:pass/normalize_idn", lines, LineRouter(config), averageSize(lines));
+    for (size_t i = 0; i < lines.size(); i += 4) {
+        const std::string &d = domains[i / 4 % domains.size()];
+        lines[i] = "https://" + d + "/login:user" + std::to_string(i) + "@" + d + ":secret" + std::to_string(i);
+    }
+    run("processLine/idn-mix/normalize_idn", lines, LineRouter(config), averageSize(lines));
+}
+
+// canonicalize_email: the per-address pass over a provider mix, and its per-line cost
+static void benchCanonicalEmail() {
+    Rng rng(7);
+    const char *const providers[] = { "gmail.com", "GoogleMail.com", "outlook.com", "yahoo.com" };
+    std::vector<std::string> emails;
+    for (size_t i = 0; i < 4096; ++i) {
+        std::string local = randomWord(rng, 3, 8) + (rng.below(2) ? "." : "") + randomWord(rng, 3, 8) +
+                            (rng.below(4) == 0 ? "+" + randomWord(rng, 2, 6) : "");
+        emails.push_back(local + "@" + (rng.below(2) ? std::string(providers[rng.below(4)]) : randomDomain(rng)));
+    }
+    std::string canonical;
+    run("email/canonicalEmail", emails, [&](const std::string &e) {
+        canonicalEmail(e, canonical);
+        return canonical.size();
+    }, averageSize(emails));
+    auto lines = makeLines(4096, "url:email:pass", 1);
+    Config config = defaultConfig("url:email:pass");
+    config.canonicalize_email = true;
+    run("processLine/url:email:pass/canonicalize_email", lines, LineRouter(config), averageSize(lines));
+}
+
+// Dedup: hashing a key from field spans, and the set insert it feeds, against keeping strings
+static void benchDedup() {
+    auto lines = makeLines(4096, "url:email:pass", 8);
+    run("dedup/KeyHasher", lines, [](const std::string &l) {
+        KeyHasher hasher;
+        hasher.add(l);
+        return static_cast<size_t>(hasher.finish().lo);
+    }, averageSize(lines));
+    std::unordered_set<std::string> strings;
+    run("dedup/insert/string", lines, [&](const std::string &l) {
+        if (strings.size() > 65536) strings.clear();
+        return strings.insert(l).second ? 1u : 0u;
+    }, averageSize(lines));
+    std::unordered_set<DedupKey, DedupKeyHash> keys;
+    run("dedup/insert/DedupKey", lines, [&](const std::string &l) {
+        if (keys.size() > 65536) keys.clear();
+        KeyHasher hasher;
+        hasher.add(l);
+        return keys.insert(hasher.finish()).second ? 1u : 0u;
+    }, averageSize(lines));
+}
+
+static void benchStringHelpers() {
+    auto lines = makeLines(4096, "url:email:pass", 2);
+    run("split/url:email:pass", lines,
+        [](const std::string &l) { return split(l, ":").size(); }, averageSize(lines));
+    std::vector<std::string> padded;
+    for (const auto &l : lines) padded.push_back("  " + l.substr(0, 24) + " \r\n");
+    run("trim", padded, [](const std::string &s) { return trim(s).size(); }, averageSize(padded));
+}
+
+static void benchValidators() {
+    Rng rng(3);
+    std::vector<std::string> emails;
+    for (size_t i = 0; i < 4096; ++i) {
+        switch (rng.below(4)) {
+            case 0:  emails.push_back(randomWord(rng, 4, 16)); break;       // no '@'
+            case 1:  emails.push_back(randomWord(rng, 4, 16) + "@" + randomWord(rng, 3, 10)); break;
+            default: emails.push_back(randomWord(rng, 4, 16) + "@" + randomDomain(rng)); break;
+        }
+    }
+    run("isValidEmail", emails, [](const std::string &s) { return isValidEmail(s) ? 1u : 0u; },
+        averageSize(emails));
+
+    std::vector<std::string> urls;
+    for (size_t i = 0; i < 4096; ++i) {
+        std::string url = (rng.below(2) ? "https://" : "") + std::string(rng.below(3) ? "" : "www.") +
+                          randomDomain(rng) + (rng.below(3) ? "" : ":8080") + "/" + randomWord(rng, 0, 40);
+        urls.push_back(url);
+    }
+    run("extractUrlDomain", urls, [](const std::string &s) { return extractUrlDomain(s).size(); },
+        averageSize(urls));
+}
+
+static void benchCheckDomain() {
+    Rng rng(4);
+    std::vector<std::string> domains;
+    for (size_t i = 0; i < 4096; ++i)
+        domains.push_back((rng.below(4) == 0 ? "mail." : "") + randomDomain(rng));
+    std::vector<std::string> upper = domains;
+    for (auto &d : upper) for (auto &c : d) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    run("domain/hashIgnoreCase", domains,
+        [](const std::string &d) { return static_cast<size_t>(simd::hashIgnoreCase(d)); }, averageSize(domains));
+    size_t next = 0;
+    run("domain/equalsIgnoreCase", domains, [&](const std::string &d) {
+        const std::string &other = upper[next];
+        if (++next == upper.size()) next = 0;
+        return simd::equalsIgnoreCase(d, other) ? 1u : 0u;
+    }, averageSize(domains));
+    run("domain/registrableDomain", domains,
+        [](const std::string &d) { return registrableDomain(d).size(); }, averageSize(domains));
+    for (size_t size : { 10ul, 100ul, 1000ul, 10000ul, 100000ul, 1000000ul }) {
+        std::string name = "checkDomain/remove=" + std::to_string(size);
+        if (!nameFilter.empty() && name.find(nameFilter) == std::string::npos) continue;
+        DomainSet removeSet, containSet;
+        // Every eighth probe domain is listed (as far as the size allows) so both outcomes are
+        // exercised at every size; the rest of the list never matches, as in a large blocklist
+        for (size_t i = 0; i < domains.size() && removeSet.size() < (size + 7) / 8; i += 8)
+            removeSet.insert(domains[i]);
+        while (removeSet.size() < size) removeSet.insert(randomDomain(rng));
+        removeSet.freeze();     // as parseConfig leaves it
+        run(name, domains, [&](const std::string &d) {
+            return checkDomain(d, removeSet, containSet) ? 1u : 0u;
+        });
+    }
+
+    // Misses on a list far larger than the cache, with enough distinct probes that lookups run cold
+    const std::string name = "DomainSet/matches/miss/1000000";
+    if (!nameFilter.empty() && name.find(nameFilter) == std::string::npos) return;
+    DomainSet large;
+    while (large.size() < 1000000) large.insert(randomDomain(rng));
+    large.freeze();
+    std::vector<std::string> misses;
+    for (size_t i = 0; i < (1 << 18); ++i) misses.push_back("mail." + randomWord(rng, 4, 16) + ".invalid");
+    run(name, misses, [&](const std::string &d) { return large.matches(d) ? 1u : 0u; });
+}
+
+// Loading a blocklist file (mmap, parallel parse, table build) and opening its prebuilt index
+static void benchDomainListLoad() {
+    Rng rng(7);
+    for (size_t size : { 100000ul, 1000000ul }) {
+        std::string name = "DomainSet/insertFile/" + std::to_string(size);
+        if (!nameFilter.empty() && name.find(nameFilter) == std::string::npos) continue;
+        fs::path path = fs::temp_directory_path() / ("ulp_bench_list_" + std::to_string(size) + ".txt");
+        {
+            std::ofstream out(path, std::ios::binary);
+            for (size_t i = 0; i < size; ++i) out << randomDomain(rng) << "\n";
+        }
+        double bytes = static_cast<double>(fs::file_size(path));
+        Result r = measure([&](uint64_t iterations) {
+            for (uint64_t n = 0; n < iterations; ++n) {
+                DomainSet set;
+                set.insertFile(path.string());
+                sink = sink + set.size();
+            }
+        }, 1.0);
+        report(name, r, bytes);
+
+        // The same list compiled with --build-index: opening it maps the file instead of parsing
+        fs::path index = path;
+        index.replace_extension(".idx");
+        {
+            DomainSet set;
+            set.insertFile(path.string());
+            set.writeIndex(index.string());
+        }
+        report("DomainSet/openIndex/" + std::to_string(size), measure([&](uint64_t iterations) {
+            for (uint64_t n = 0; n < iterations; ++n) {
+                DomainSet set;
+                set.insertFile(index.string());
+                sink = sink + (set.matches("example.com") ? 1 : 0);
+            }
+        }));
+        fs::remove(path);
+        fs::remove(index);
+    }
+}
+
+// Every kernel variant this host supports, so dispatch choices can be compared directly
+static void benchSimdKernels() {
+    auto lines = makeLines(4096, "url:email:pass", 6);
+    std::vector<std::string> block(1);
+    for (const auto &l : lines) block[0] += l + "\n";
+    const simd::Kernels *variants[4];
+    size_t count = simd::availableKernels(variants, 4);
+    for (size_t v = 0; v < count; ++v) {
+        const simd::Kernels &k = *variants[v];
+        std::string prefix = std::string("simd/") + k.name + "/";
+        run(prefix + "findByte('\\n')/block", block, [&](const std::string &b) {
+            size_t n = 0;
+            for (const char *p = b.data(), *end = p + b.size(); (p = k.findByte(p, end, '\n')) != end; ++p) ++n;
+            return n;
+        }, static_cast<double>(block[0].size()));
+        run(prefix + "findByte('@')/line", lines, [&](const std::string &l) {
+            return static_cast<size_t>(k.findByte(l.data(), l.data() + l.size(), '@') - l.data());
+        }, averageSize(lines));
+        simd::StructuralIndex index;
+        const char needles[3] = { '\n', ':', '@' };
+        run(prefix + "StructuralIndex/block", block, [&](const std::string &b) {
+            index.build(b.data(), b.size(), needles, 3, k);
+            return index.positions[0].size() + index.positions[1].size() + index.positions[2].size();
+        }, static_cast<double>(block[0].size()));
+        std::string scratch;
+        run(prefix + "lowerAscii/line", lines, [&](const std::string &l) {
+            scratch = l;
+            k.lowerAscii(&scratch[0], scratch.size());
+            return scratch.size();
+        }, averageSize(lines));
+    }
+}
+
+static void benchQueue() {
+    constexpr size_t ITEMS = 1 << 20;
+    auto lines = makeLines(1024, "url:email:pass", 5);
+    for (unsigned consumers : { 1u, 4u }) {
+        std::string name = "ThreadSafeQueue/1p" + std::to_string(consumers) + "c";
+        if (!nameFilter.empty() && name.find(nameFilter) == std::string::npos) continue;
+        ThreadSafeQueue<std::string> queue;
+        auto start = std::chrono::steady_clock::now();
+        std::atomic<size_t> consumed{0};
+        std::vector<std::thread> threads;
+        for (unsigned c = 0; c < consumers; ++c) {
+            threads.emplace_back([&] {
+                std::vector<std::string> batch;
+                while (true) {
+                    batch.clear();
+                    queue.popBatch(batch, 100);
+                    if (batch.empty()) break;
+                    consumed += batch.size();
+                }
+            });
+        }
+        for (size_t i = 0; i < ITEMS; ++i) queue.push(lines[i % lines.size()]);
+        queue.setDone();
+        for (auto &t : threads) t.join();
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        sink = sink + consumed.load();
+        report(name, { elapsed * 1e9 / ITEMS, ITEMS }, averageSize(lines));
+    }
+}
+
+} // namespace bench
+
+int main(int argc, char *argv[]) {
+    if (argc > 1) bench::nameFilter = argv[1];
+    std::cout << std::left << std::setw(40) << "benchmark" << std::right
+              << std::setw(14) << "iterations" << std::setw(20) << "time" << std::setw(19) << "rate" << "\n";
+    bench::benchProcessLine();
+    bench::benchIdn();
+    bench::benchCanonicalEmail();
+    bench::benchDedup();
+    bench::benchStringHelpers();
+    bench::benchValidators();
+    bench::benchCheckDomain();
+    bench::benchDomainListLoad();
+    bench::benchSimdKernels();
+    bench::benchQueue();
+    return 0;
+}
@@ -0,0 +1,130 @@
+// ulp_datagen.cpp
+// Writes synthetic url:email:pass or email:pass dumps for load testing and benchmarks
+// Output depends only on the options and the seed, so numbers stay comparable between commits
+//
+// g++ -std=c++17 -O2 -o ulp_datagen bench/ulp_datagen.cpp
+// ./ulp_datagen -o dump.txt --size 1G --seed 42
+
+#include "ulp_synth.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+#ifdef _WIN32
+  #include <fcntl.h>
+  #include <io.h>
+#endif
+
+static void usage(const char *argv0) {
+    std::cerr
+        << "Usage: " << argv0 << " [options]\n"
+        << "  -o <file>                 output file (default: stdout)\n"
+        << "  --format <fmt>            url:email:pass (default) or email:pass\n"
+        << "  --lines <n>               number of lines to write\n"
+        << "  --size <bytes>[K|M|G]     approximate output size (default 100M)\n"
+        << "  --seed <n>                generator seed (default 1)\n"
+        << "  --domains <n>             distinct email domains (default 20000)\n"
+        << "  --zipf <s>                domain popularity skew (default 1.1)\n"
+        << "  --dup-rate <p>            duplicate line rate (default 0.05)\n"
+        << "  --malformed-rate <p>      malformed line rate (default 0.03)\n"
+        << "  --long-url-rate <p>       long URL rate (default 0.02)\n"
+        << "  --crlf-rate <p>           CRLF line ending rate (default 0.2)\n"
+        << "  --non-ascii-rate <p>      non-ASCII byte rate (default 0.02)\n"
+        << "  --mixed-sep-rate <p>      ';' '|' ' ' separator rate (default 0.02)\n";
+}
+
+// Parse sizes like 512, 64K, 100M, 2G
+static uint64_t parseSize(const std::string &s) {
+    char *end = nullptr;
+    double v = std::strtod(s.c_str(), &end);
+    switch (*end) {
+        case 'k': case 'K': v *= 1024.0; break;
+        case 'm': case 'M': v *= 1024.0 * 1024; break;
+        case 'g': case 'G': v *= 1024.0 * 1024 * 1024; break;
+        case '\0': break;
+        default:
+            std::cerr << "Invalid size: " << s << "\n";
+            std::exit(1);
+    }
+    return static_cast<uint64_t>(v);
+}
+
+int main(int argc, char *argv[]) {
+    synth::Options opts;
+    std::string outputFile;
+    uint64_t maxLines = 0;
+    uint64_t maxBytes = 100ull * 1024 * 1024;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help") {
+            usage(argv[0]);
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        std::string value = argv[++i];
+        if (arg == "-o")                    outputFile = value;
+        else if (arg == "--format")         opts.format = value;
+        else if (arg == "--lines")          { maxLines = std::strtoull(value.c_str(), nullptr, 10); maxBytes = 0; }
+        else if (arg == "--size")           { maxBytes = parseSize(value); maxLines = 0; }
+        else if (arg == "--seed")           opts.seed = std::strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--domains")        opts.domains = std::max<size_t>(1, std::strtoull(value.c_str(), nullptr, 10));
+        else if (arg == "--zipf")           opts.zipf = std::strtod(value.c_str(), nullptr);
+        else if (arg == "--dup-rate")       opts.duplicateRate = std::strtod(value.c_str(), nullptr);
+        else if (arg == "--malformed-rate") opts.malformedRate = std::strtod(value.c_str(), nullptr);
+        else if (arg == "--long-url-rate")  opts.longUrlRate = std::strtod(value.c_str(), nullptr);
+        else if (arg == "--crlf-rate")      opts.crlfRate = std::strtod(value.c_str(), nullptr);
+        else if (arg == "--non-ascii-rate") opts.nonAsciiRate = std::strtod(value.c_str(), nullptr);
+        else if (arg == "--mixed-sep-rate") opts.mixedSeparatorRate = std::strtod(value.c_str(), nullptr);
+        else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    // Neither limit set would write forever
+    if (maxLines == 0 && maxBytes == 0) {
+        std::cerr << "--lines and --size must be greater than 0\n";
+        return 1;
+    }
+    if (!(opts.zipf >= 0)) {
+        std::cerr << "Invalid zipf skew: " << opts.zipf << "\n";
+        return 1;
+    }
+    if (opts.format != "url:email:pass" && opts.format != "email:pass") {
+        std::cerr << "Unsupported format: " << opts.format << "\n";
+        return 1;
+    }
+
+#ifdef _WIN32
+    if (outputFile.empty()) _setmode(_fileno(stdout), _O_BINARY);
+#endif
+    FILE *out = outputFile.empty() ? stdout : std::fopen(outputFile.c_str(), "wb");
+    if (!out) {
+        std::cerr << "Cannot open output file: " << outputFile << "\n";
+        return 1;
+    }
+
+    synth::Generator gen(opts);
+    std::string buffer;
+    buffer.reserve(1 << 20);
+    uint64_t lines = 0, bytes = 0;
+    while ((maxLines == 0 || lines < maxLines) && (maxBytes == 0 || bytes < maxBytes)) {
+        size_t before = buffer.size();
+        gen.appendLine(buffer);
+        bytes += buffer.size() - before;
+        ++lines;
+        if (buffer.size() >= (1 << 20)) {
+            std::fwrite(buffer.data(), 1, buffer.size(), out);
+            buffer.clear();
+        }
+    }
+    std::fwrite(buffer.data(), 1, buffer.size(), out);
+    if (out != stdout) std::fclose(out);
+    std::cerr << "Wrote " << lines << " lines, " << bytes << " bytes\n";
+    return 0;
+}
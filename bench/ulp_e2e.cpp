@@ -0,0 +1,325 @@
+// ulp_e2e.cpp
+// End-to-end throughput harness: runs the real ulp and filter binaries on generated dumps,
+// records lines/s, MB/s and peak RSS, and compares them against a stored baseline
+// Exits non-zero when any scenario regresses beyond the tolerance
+//
+// ./ulp_e2e --bin-dir build --work-dir build/e2e --baseline bench/e2e_baseline.txt
+// ./ulp_e2e ... --update-baseline     (re-record after an intended change or on a new machine)
+
+#include "ulp_synth.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(__has_include)
+  #if __has_include(<filesystem>)
+    #include <filesystem>
+    namespace fs = std::filesystem;
+  #else
+    #include <experimental/filesystem>
+    namespace fs = std::experimental::filesystem;
+  #endif
+#endif
+
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <sys/resource.h>
+  #include <sys/wait.h>
+  #include <unistd.h>
+#endif
+
+struct Scenario {
+    std::string name;
+    std::string tool;          // "ulp" or "filter"
+    std::string format;        // dataset format
+    std::string config;        // config.ini contents for ulp, filter list for filter
+    std::string stdinText;     // answers to filter's prompts
+};
+
+struct Measurement {
+    double linesPerSec = 0;
+    double mbPerSec = 0;
+    double peakRssMb = 0;
+};
+
+struct Options {
+    std::string binDir = ".";
+    std::string workDir = "e2e";
+    std::string baseline;
+    uint64_t sizeMb = 64;
+    uint64_t seed = 42;
+    int repeat = 3;
+    double tolerance = 0.10;
+    double rssTolerance = 0.25;
+    bool updateBaseline = false;
+    bool trainOnly = false;
+};
+
+static const char *const REMOVE_LIST =
+    "gmail.com,yahoo.com,hotmail.com,aol.com,msn.com,live.com,gmx.de,web.de,yandex.ru,mail.ru,"
+    "qq.com,icloud.com,googlemail.com,orange.fr,free.fr,comcast.net,libero.it,uol.com.br";
+
+static std::vector<Scenario> scenarios() {
+    return {
+        { "ulp/url:email:pass/remove", "ulp", "url:email:pass",
+          std::string("separator=:\nformat=url:email:pass\nconvert_format=email:pass\nemail_remove=") +
+              REMOVE_LIST + "\n", "" },
+        { "ulp/url:email:pass/remove/ordered", "ulp", "url:email:pass",
+          std::string("separator=:\nformat=url:email:pass\nordered_output=1\nconvert_format=email:pass\nemail_remove=") +
+              REMOVE_LIST + "\n", "" },
+        { "ulp/email:pass/contains", "ulp", "email:pass",
+          "separator=:\nformat=email:pass\nconvert_format=email\n"
+          "email_contains=gmail.com,yahoo.com,co.uk,de\n", "" },
+        { "ulp/url:email:pass/url_filter", "ulp", "url:email:pass",
+          "separator=:\nformat=url:email:pass\nconvert_format=email:pass\nurl_remove=com.br,co.jp\n", "" },
+        { "filter/email:pass/remove", "filter", "email:pass",
+          "gmail.com\nyahoo.com\nhotmail.com\nmail.ru\nweb.de\n", "r\nremove.txt\ndataset.txt\n" },
+    };
+}
+
+// Generate (or reuse) the dataset for a format; returns its path
+static fs::path ensureDataset(const Options &opts, const std::string &format) {
+    std::string tag = format == "email:pass" ? "email_pass" : "url_email_pass";
+    fs::path path = fs::path(opts.workDir) / ("dataset_" + tag + "_" + std::to_string(opts.sizeMb) +
+                                              "M_seed" + std::to_string(opts.seed) + ".txt");
+    if (fs::exists(path)) return path;
+    synth::Options so;
+    so.format = format;
+    so.seed = opts.seed;
+    synth::Generator gen(so);
+    std::ofstream out(path, std::ios::binary);
+    std::string buffer;
+    uint64_t written = 0, target = opts.sizeMb * 1024 * 1024;
+    while (written < target) {
+        buffer.clear();
+        while (buffer.size() < (1 << 20)) gen.appendLine(buffer);
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        written += buffer.size();
+    }
+    return path;
+}
+
+static uint64_t countLines(const fs::path &path) {
+    std::ifstream in(path, std::ios::binary);
+    std::vector<char> buf(1 << 20);
+    uint64_t lines = 0;
+    while (in) {
+        in.read(buf.data(), static_cast<std::streamsize>(buf.size()));
+        for (std::streamsize i = 0; i < in.gcount(); ++i) lines += buf[static_cast<size_t>(i)] == '\n';
+    }
+    return lines;
+}
+
+#ifndef _WIN32
+// Run exe with args inside cwd, feeding stdinFile; returns wall seconds and peak RSS in MB
+static bool runProcess(const std::string &exe, const std::vector<std::string> &args, const fs::path &cwd,
+                       const fs::path &stdinFile, double &seconds, double &peakRssMb) {
+    auto start = std::chrono::steady_clock::now();
+    pid_t pid = fork();
+    if (pid < 0) return false;
+    if (pid == 0) {
+        if (chdir(cwd.c_str()) != 0) _exit(127);
+        int in = open(stdinFile.empty() ? "/dev/null" : stdinFile.c_str(), O_RDONLY);
+        int out = open("/dev/null", O_WRONLY);
+        if (in < 0 || out < 0) _exit(127);
+        dup2(in, 0);
+        dup2(out, 1);
+        std::vector<char *> argv;
+        argv.push_back(const_cast<char *>(exe.c_str()));
+        for (const auto &a : args) argv.push_back(const_cast<char *>(a.c_str()));
+        argv.push_back(nullptr);
+        execv(exe.c_str(), argv.data());
+        _exit(127);
+    }
+    int status = 0;
+    rusage usage{};
+    if (wait4(pid, &status, 0, &usage) < 0) return false;
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+#ifdef __APPLE__
+    peakRssMb = static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0);
+#else
+    peakRssMb = static_cast<double>(usage.ru_maxrss) / 1024.0;
+#endif
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+#endif
+
+// Run one scenario opts.repeat times and keep the fastest run
+static bool runScenario(const Options &opts, const Scenario &sc, Measurement &m) {
+#ifdef _WIN32
+    (void)opts; (void)sc; (void)m;
+    std::cerr << "ulp_e2e needs fork/wait4 and is not supported on Windows\n";
+    return false;
+#else
+    fs::path dataset = ensureDataset(opts, sc.format);
+    std::string dirName = "run_" + sc.name;
+    std::replace_if(dirName.begin(), dirName.end(), [](char c) { return c == '/' || c == ':'; }, '_');
+    fs::path dir = fs::path(opts.workDir) / dirName;
+    fs::create_directories(dir);
+    fs::path input = dir / "dataset.txt";
+    std::error_code ec;
+    fs::remove(input, ec);
+    fs::create_symlink(fs::absolute(dataset), input, ec);
+    if (ec) fs::copy_file(dataset, input, fs::copy_options::overwrite_existing);
+
+    fs::path stdinFile;
+    if (sc.tool == "ulp") {
+        std::ofstream(dir / "config.ini") << sc.config;
+    } else {
+        std::ofstream(dir / "remove.txt") << sc.config;
+        stdinFile = dir / "stdin.txt";
+        std::ofstream(stdinFile) << sc.stdinText;
+    }
+
+    std::string exe = fs::absolute(fs::path(opts.binDir) / sc.tool).string();
+    std::vector<std::string> args;
+    if (sc.tool == "ulp") args.push_back("dataset.txt");
+
+    uint64_t lines = countLines(dataset);
+    double bytes = static_cast<double>(fs::file_size(dataset));
+    for (int r = 0; r < opts.repeat; ++r) {
+        fs::remove(dir / "filtered_output.txt", ec);
+        fs::remove(dir / "filtered_emails.txt", ec);
+        double seconds = 0, rss = 0;
+        if (!runProcess(exe, args, dir, stdinFile, seconds, rss)) {
+            std::cerr << sc.name << ": " << exe << " failed\n";
+            return false;
+        }
+        double lps = static_cast<double>(lines) / seconds;
+        if (lps > m.linesPerSec) {
+            m.linesPerSec = lps;
+            m.mbPerSec = bytes / seconds / (1024.0 * 1024.0);
+        }
+        m.peakRssMb = std::max(m.peakRssMb, rss);
+    }
+    return true;
+#endif
+}
+
+static std::map<std::string, Measurement> loadBaseline(const std::string &path) {
+    std::map<std::string, Measurement> baseline;
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream iss(line);
+        std::string name;
+        Measurement m;
+        if (iss >> name >> m.linesPerSec >> m.mbPerSec >> m.peakRssMb) baseline[name] = m;
+    }
+    return baseline;
+}
+
+static void saveBaseline(const std::string &path, const Options &opts,
+                         const std::vector<std::pair<std::string, Measurement>> &results) {
+    std::ofstream out(path);
+    out << "# ulp_e2e baseline: scenario lines_per_sec mb_per_sec peak_rss_mb\n"
+        << "# dataset " << opts.sizeMb << "M seed " << opts.seed << ", best of " << opts.repeat << "\n";
+    for (const auto &r : results)
+        out << r.first << " " << std::fixed << std::setprecision(0) << r.second.linesPerSec << " "
+            << std::setprecision(1) << r.second.mbPerSec << " " << r.second.peakRssMb << "\n";
+}
+
+static void usage(const char *argv0) {
+    std::cerr
+        << "Usage: " << argv0 << " [options]\n"
+        << "  --bin-dir <dir>        directory containing ulp and filter (default .)\n"
+        << "  --work-dir <dir>       scratch directory for datasets and runs (default e2e)\n"
+        << "  --baseline <file>      baseline to compare against or update\n"
+        << "  --update-baseline      write the measured numbers to the baseline file\n"
+        << "  --train                run every scenario once without reporting (PGO training)\n"
+        << "  --size-mb <n>          dataset size per format (default 64)\n"
+        << "  --seed <n>             dataset seed (default 42)\n"
+        << "  --repeat <n>           runs per scenario, best is kept (default 3)\n"
+        << "  --tolerance <f>        allowed throughput drop (default 0.10)\n"
+        << "  --rss-tolerance <f>    allowed peak RSS growth (default 0.25)\n";
+}
+
+int main(int argc, char *argv[]) {
+    Options opts;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                usage(argv[0]);
+                std::exit(1);
+            }
+            return argv[++i];
+        };
+        if (arg == "--bin-dir")              opts.binDir = value();
+        else if (arg == "--work-dir")        opts.workDir = value();
+        else if (arg == "--baseline")        opts.baseline = value();
+        else if (arg == "--update-baseline") opts.updateBaseline = true;
+        else if (arg == "--train")           opts.trainOnly = true;
+        else if (arg == "--size-mb")         opts.sizeMb = std::strtoull(value().c_str(), nullptr, 10);
+        else if (arg == "--seed")            opts.seed = std::strtoull(value().c_str(), nullptr, 10);
+        else if (arg == "--repeat")          opts.repeat = std::max(1, std::atoi(value().c_str()));
+        else if (arg == "--tolerance")       opts.tolerance = std::strtod(value().c_str(), nullptr);
+        else if (arg == "--rss-tolerance")   opts.rssTolerance = std::strtod(value().c_str(), nullptr);
+        else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (opts.trainOnly) opts.repeat = 1;
+    fs::create_directories(opts.workDir);
+    // Children chdir into their run directory, so every path handed to them must be absolute
+    opts.workDir = fs::absolute(opts.workDir).string();
+
+    std::map<std::string, Measurement> baseline;
+    if (!opts.baseline.empty() && !opts.updateBaseline && !opts.trainOnly) baseline = loadBaseline(opts.baseline);
+
+    std::vector<std::pair<std::string, Measurement>> results;
+    bool regressed = false;
+    if (!opts.trainOnly)
+        std::cout << std::left << std::setw(34) << "scenario" << std::right << std::setw(14) << "lines/s"
+                  << std::setw(10) << "MB/s" << std::setw(12) << "peak RSS" << std::setw(12) << "vs base" << "\n";
+    for (const auto &sc : scenarios()) {
+        Measurement m;
+        if (!runScenario(opts, sc, m)) return 2;
+        results.emplace_back(sc.name, m);
+        if (opts.trainOnly) continue;
+        std::cout << std::left << std::setw(34) << sc.name << std::right << std::fixed
+                  << std::setw(14) << std::setprecision(0) << m.linesPerSec
+                  << std::setw(10) << std::setprecision(1) << m.mbPerSec
+                  << std::setw(9) << m.peakRssMb << " MB";
+        auto it = baseline.find(sc.name);
+        if (it != baseline.end()) {
+            double delta = m.linesPerSec / it->second.linesPerSec - 1.0;
+            std::cout << std::setw(11) << std::showpos << delta * 100.0 << std::noshowpos << "%";
+            if (delta < -opts.tolerance) {
+                std::cout << "  REGRESSION: throughput below baseline " << std::setprecision(0)
+                          << it->second.linesPerSec << " lines/s";
+                regressed = true;
+            }
+            if (m.peakRssMb > it->second.peakRssMb * (1.0 + opts.rssTolerance)) {
+                std::cout << "  REGRESSION: peak RSS above baseline " << std::setprecision(1)
+                          << it->second.peakRssMb << " MB";
+                regressed = true;
+            }
+        } else if (!opts.baseline.empty() && !opts.updateBaseline) {
+            std::cout << std::setw(12) << "(new)";
+        }
+        std::cout << "\n";
+    }
+
+    if (opts.updateBaseline && !opts.baseline.empty()) {
+        saveBaseline(opts.baseline, opts, results);
+        std::cout << "Baseline written to " << opts.baseline << "\n";
+    }
+    if (regressed) {
+        std::cerr << "\nPerformance regression detected (tolerance " << opts.tolerance * 100 << "% throughput, "
+                  << opts.rssTolerance * 100 << "% RSS)\n";
+        return 1;
+    }
+    return 0;
+}
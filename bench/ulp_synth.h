@@ -0,0 +1,282 @@
+// ulp_synth.h
+// Deterministic synthetic ULP line generator shared by the dataset tool and the benchmarks
+// Every local part, password and site path is invented; only the webmail provider names are real,
+// so that filter lists like the one in config.ini have something to match.
+// Uses its own PRNG and samplers (not <random> distributions) and integer arithmetic where a libm
+// call would decide the result, so a seed yields the same bytes with every standard library.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace synth {
+
+// xoshiro256** seeded through splitmix64
+class Rng {
+public:
+    explicit Rng(uint64_t seed) {
+        for (auto &s : state_) {
+            seed += 0x9E3779B97F4A7C15ull;
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            s = z ^ (z >> 31);
+        }
+    }
+    uint64_t next() {
+        const uint64_t result = rotl(state_[1] * 5, 7) * 9;
+        const uint64_t t = state_[1] << 17;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotl(state_[3], 45);
+        return result;
+    }
+    // Uniform in [0, n)
+    size_t below(size_t n) { return static_cast<size_t>(next() % n); }
+    // Uniform in [lo, hi]
+    size_t between(size_t lo, size_t hi) { return lo + below(hi - lo + 1); }
+    // Uniform in [0, 1)
+    double unit() { return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0); }
+    bool chance(double p) { return unit() < p; }
+private:
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+    uint64_t state_[4];
+};
+
+// Samples ranks 0..n-1 with probability proportional to 1/(rank+1)^s. The weights are built in
+// 2.30 fixed point rather than with std::pow, whose last bits differ between libm implementations.
+class Zipf {
+public:
+    Zipf(size_t n, double s) : cdf_(n) {
+        // 2^(-2^-j) for j = 1..30, each the square root of the one before
+        uint64_t roots[FRAC_BITS + 1];
+        roots[1] = isqrt(ONE << (FRAC_BITS - 1));
+        for (int j = 2; j <= FRAC_BITS; ++j) roots[j] = isqrt(roots[j - 1] << FRAC_BITS);
+        const uint64_t skew = static_cast<uint64_t>(std::llround(s * 65536));     // s in 16.16
+        uint64_t total = 0;
+        for (size_t i = 0; i < n; ++i) {
+            total += std::max<uint64_t>(1, exp2Neg(log2(i + 1) * skew >> 16, roots));
+            cdf_[i] = total;
+        }
+    }
+    size_t sample(Rng &rng) const {
+        auto it = std::upper_bound(cdf_.begin(), cdf_.end(), rng.next() % cdf_.back());
+        return static_cast<size_t>(it - cdf_.begin());
+    }
+private:
+    static constexpr int FRAC_BITS = 30;
+    static constexpr uint64_t ONE = 1ull << FRAC_BITS;
+
+    static uint64_t isqrt(uint64_t v) {
+        uint64_t root = 0;
+        for (uint64_t bit = 1ull << 62; bit; bit >>= 2) {
+            if (v >= root + bit) {
+                v -= root + bit;
+                root = (root >> 1) + bit;
+            } else {
+                root >>= 1;
+            }
+        }
+        return root;
+    }
+    // log2(x) in fixed point: the integer part from the top bit, then one fraction bit per squaring
+    static uint64_t log2(uint64_t x) {
+        int whole = 0;
+        while (x >> (whole + 1)) ++whole;
+        uint64_t y = whole > FRAC_BITS ? x >> (whole - FRAC_BITS) : x << (FRAC_BITS - whole);
+        uint64_t result = static_cast<uint64_t>(whole) << FRAC_BITS;
+        for (int j = 1; j <= FRAC_BITS; ++j) {
+            y = y * y >> FRAC_BITS;
+            if (y >= 2 * ONE) {
+                y >>= 1;
+                result |= 1ull << (FRAC_BITS - j);
+            }
+        }
+        return result;
+    }
+    // 2^-e in fixed point, e >= 0 in fixed point
+    static uint64_t exp2Neg(uint64_t e, const uint64_t *roots) {
+        uint64_t whole = e >> FRAC_BITS;
+        if (whole > FRAC_BITS) return 0;
+        uint64_t result = ONE;
+        for (int j = 1; j <= FRAC_BITS; ++j)
+            if (e >> (FRAC_BITS - j) & 1) result = result * roots[j] >> FRAC_BITS;
+        return result >> whole;
+    }
+
+    std::vector<uint64_t> cdf_;     // cumulative weights
+};
+
+struct Options {
+    std::string format = "url:email:pass";  // or "email:pass"
+    uint64_t seed = 1;
+    size_t domains = 20000;                 // distinct email domains
+    double zipf = 1.1;                      // skew of email domain popularity, >= 0
+    double duplicateRate = 0.05;            // lines repeating a recent record
+    double malformedRate = 0.03;            // lines ulp must reject
+    double longUrlRate = 0.02;              // URLs with 200..2000 byte paths
+    double crlfRate = 0.2;                  // lines ending in \r\n
+    double nonAsciiRate = 0.02;             // lines carrying UTF-8 or raw high bytes
+    double mixedSeparatorRate = 0.02;       // lines using ';', '|' or a space instead of ':'
+};
+
+class Generator {
+public:
+    explicit Generator(const Options &opts)
+        : opts_(opts), rng_(opts.seed), domainRank_(opts.domains, opts.zipf),
+          siteRank_(opts.domains, 0.9) {
+        Rng names(opts.seed ^ 0xD06A1115ull);
+        static const char *const webmail[] = {
+            "gmail.com", "yahoo.com", "hotmail.com", "outlook.com", "aol.com", "mail.ru",
+            "yandex.ru", "gmx.de", "web.de", "qq.com", "live.com", "icloud.com",
+            "googlemail.com", "orange.fr", "free.fr", "comcast.net", "libero.it", "uol.com.br"
+        };
+        for (const char *w : webmail)
+            if (emailDomains_.size() < opts.domains) emailDomains_.push_back(w);
+        while (emailDomains_.size() < opts.domains) emailDomains_.push_back(domainName(names));
+        while (siteDomains_.size() < opts.domains) siteDomains_.push_back(domainName(names));
+    }
+
+    // Append one line, including its line ending, to out
+    void appendLine(std::string &out) {
+        std::string line;
+        if (!recent_.empty() && rng_.chance(opts_.duplicateRate)) {
+            line = recent_[rng_.below(recent_.size())];
+        } else if (rng_.chance(opts_.malformedRate)) {
+            line = malformed();
+        } else {
+            line = record();
+            if (recent_.size() < RECENT) recent_.push_back(line);
+            else recent_[rng_.below(RECENT)] = line;
+        }
+        out += line;
+        out += rng_.chance(opts_.crlfRate) ? "\r\n" : "\n";
+    }
+
+private:
+    static constexpr size_t RECENT = 4096;
+
+    std::string syllables(Rng &r, size_t minCount, size_t maxCount) {
+        static const char *const parts[] = {
+            "ka", "lo", "mi", "ne", "ra", "to", "vi", "zu", "ber", "dan", "fel", "gor", "han",
+            "jas", "kor", "lin", "mar", "nor", "pet", "ros", "sam", "tin", "val", "wen", "an",
+            "el", "is", "on", "ul", "ex", "qua", "sho", "tri"
+        };
+        std::string s;
+        size_t count = r.between(minCount, maxCount);
+        for (size_t i = 0; i < count; ++i) s += parts[r.below(sizeof(parts) / sizeof(parts[0]))];
+        return s;
+    }
+
+    std::string domainName(Rng &r) {
+        static const char *const tlds[] = {
+            "com", "com", "com", "net", "org", "de", "ru", "fr", "it", "nl", "pl", "co.uk",
+            "com.br", "com.au", "co.jp", "in", "io", "info", "biz", "es"
+        };
+        std::string d = syllables(r, 2, 4);
+        if (r.below(8) == 0) d += "-" + syllables(r, 1, 2);
+        if (r.below(10) == 0) d = "mail." + d;
+        return d + "." + tlds[r.below(sizeof(tlds) / sizeof(tlds[0]))];
+    }
+
+    std::string localPart() {
+        std::string s = syllables(rng_, 1, 3);
+        switch (rng_.below(6)) {
+            case 0: s += "." + syllables(rng_, 1, 3); break;
+            case 1: s += std::to_string(rng_.below(10000)); break;
+            case 2: s += "_" + syllables(rng_, 1, 2) + std::to_string(rng_.below(100)); break;
+            default: break;
+        }
+        if (rng_.below(20) == 0) s += "+" + syllables(rng_, 1, 2);
+        if (rng_.below(15) == 0) s[0] = static_cast<char>(s[0] - 'a' + 'A');
+        return s;
+    }
+
+    std::string password() {
+        static const char chars[] =
+            "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789!#$%&*-_.?";
+        std::string p;
+        size_t len = rng_.between(6, 18);
+        for (size_t i = 0; i < len; ++i) p.push_back(chars[rng_.below(sizeof(chars) - 1)]);
+        return p;
+    }
+
+    std::string email() {
+        std::string domain = emailDomains_[domainRank_.sample(rng_)];
+        if (rng_.below(25) == 0)
+            std::transform(domain.begin(), domain.end(), domain.begin(),
+                           [](char c) { return (c >= 'a' && c <= 'z') ? static_cast<char>(c - 32) : c; });
+        return localPart() + "@" + domain;
+    }
+
+    std::string url() {
+        const std::string &site = siteDomains_[siteRank_.sample(rng_)];
+        std::string u;
+        switch (rng_.below(10)) {
+            case 0:  u = "android://" + password() + password() + "@com." + syllables(rng_, 1, 2) + ".app/"; return u;
+            case 1:  u = site; break;
+            case 2:  u = "http://www." + site; break;
+            default: u = "https://" + site; break;
+        }
+        if (rng_.below(12) == 0) u += ":" + std::to_string(rng_.between(1024, 65535));
+        u += "/" + syllables(rng_, 0, 3);
+        if (rng_.chance(opts_.longUrlRate)) {
+            size_t target = rng_.between(200, 2000);
+            u += "?";
+            while (u.size() < target) u += syllables(rng_, 1, 2) + "=" + password() + "&";
+        }
+        return u;
+    }
+
+    std::string nonAscii() {
+        static const char *const samples[] = {
+            "\xC3\xA9", "\xC3\xBC", "\xC3\xB1", "\xD0\xB4", "\xE4\xB8\xAD", "\xF0\x9F\x94\x91", "\xE9", "\xFF"
+        };
+        return samples[rng_.below(sizeof(samples) / sizeof(samples[0]))];
+    }
+
+    std::string record() {
+        std::string sep = ":";
+        if (rng_.chance(opts_.mixedSeparatorRate)) {
+            static const char *const seps[] = { ";", "|", " " };
+            sep = seps[rng_.below(3)];
+        }
+        std::string login = email(), pass = password();
+        if (rng_.chance(opts_.nonAsciiRate)) {
+            if (rng_.below(2)) pass.insert(rng_.below(pass.size() + 1), nonAscii());
+            else login.insert(rng_.below(login.find('@') + 1), nonAscii());
+        }
+        std::string line;
+        if (opts_.format == "url:email:pass") line = url() + sep;
+        return line + login + sep + pass;
+    }
+
+    std::string malformed() {
+        switch (rng_.below(7)) {
+            case 0:  return "";
+            case 1:  return syllables(rng_, 2, 6);                                      // no separator
+            case 2:  return email();                                                    // missing password
+            case 3:  return "+" + std::to_string(rng_.between(100000000, 999999999)) + ":" + password();
+            case 4:  return localPart() + "@:" + password();                            // no domain
+            case 5:  return url();
+            default: return "UNKNOWN:" + password();
+        }
+    }
+
+    Options opts_;
+    Rng rng_;
+    Zipf domainRank_;
+    Zipf siteRank_;
+    std::vector<std::string> emailDomains_;
+    std::vector<std::string> siteDomains_;
+    std::vector<std::string> recent_;
+};
+
+} // namespace synth
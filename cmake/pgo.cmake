@@ -0,0 +1,66 @@
+# Profile-guided optimization workflow for ulp and filter, run by the `pgo` target:
+#   1. build a plain Release tree (the -O2 reference)
+#   2. build an instrumented tree (ULP_PGO=GENERATE) and train it on the synthetic corpus
+#   3. reconfigure the same tree with ULP_PGO=USE and rebuild with the collected profile
+#   4. benchmark plain vs PGO with ulp_e2e and report the gain
+#
+# cmake -DSOURCE_DIR=... -DWORK_DIR=... -DCXX_COMPILER=... -DGENERATOR=... [-DSIZE_MB=64] -P pgo.cmake
+
+foreach(var SOURCE_DIR WORK_DIR CXX_COMPILER GENERATOR)
+  if(NOT DEFINED ${var})
+    message(FATAL_ERROR "pgo.cmake: ${var} is not set")
+  endif()
+endforeach()
+if(NOT DEFINED SIZE_MB)
+  set(SIZE_MB 64)
+endif()
+
+set(PLAIN_DIR "${WORK_DIR}/plain")
+set(PGO_DIR "${WORK_DIR}/profiled")
+set(PROFILE_DIR "${WORK_DIR}/profiles")
+set(DATA_DIR "${WORK_DIR}/data")
+
+function(run_step description)
+  message(STATUS "pgo: ${description}")
+  execute_process(COMMAND ${ARGN} RESULT_VARIABLE result)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "pgo: ${description} failed (${result})")
+  endif()
+endfunction()
+
+function(configure_and_build dir)
+  run_step("configure ${dir}"
+    "${CMAKE_COMMAND}" -S "${SOURCE_DIR}" -B "${dir}" -G "${GENERATOR}"
+    -DCMAKE_CXX_COMPILER=${CXX_COMPILER} -DCMAKE_BUILD_TYPE=Release ${ARGN})
+  run_step("build ${dir}" "${CMAKE_COMMAND}" --build "${dir}" --target ulp filter ulp_e2e)
+endfunction()
+
+configure_and_build("${PLAIN_DIR}" -DULP_PGO=OFF)
+
+file(REMOVE_RECURSE "${PROFILE_DIR}")
+file(MAKE_DIRECTORY "${PROFILE_DIR}")
+configure_and_build("${PGO_DIR}" -DULP_PGO=GENERATE "-DULP_PGO_DIR=${PROFILE_DIR}")
+run_step("train instrumented binaries"
+  "${PLAIN_DIR}/ulp_e2e" --train --bin-dir "${PGO_DIR}" --work-dir "${DATA_DIR}" --size-mb ${SIZE_MB})
+
+file(GLOB raw_profiles "${PROFILE_DIR}/*.profraw")
+if(raw_profiles)
+  get_filename_component(_cxx_dir "${CXX_COMPILER}" DIRECTORY)
+  find_program(LLVM_PROFDATA NAMES llvm-profdata HINTS "${_cxx_dir}")
+  if(NOT LLVM_PROFDATA)
+    message(FATAL_ERROR "pgo: llvm-profdata is required to merge clang profiles")
+  endif()
+  run_step("merge clang profiles"
+    "${LLVM_PROFDATA}" merge "-output=${PROFILE_DIR}/merged.profdata" ${raw_profiles})
+endif()
+
+configure_and_build("${PGO_DIR}" -DULP_PGO=USE "-DULP_PGO_DIR=${PROFILE_DIR}")
+
+run_step("measure plain -O2 build"
+  "${PLAIN_DIR}/ulp_e2e" --bin-dir "${PLAIN_DIR}" --work-dir "${DATA_DIR}" --size-mb ${SIZE_MB}
+  --baseline "${WORK_DIR}/plain_results.txt" --update-baseline)
+message(STATUS "pgo: PGO build vs plain -O2 (vs base column is the gain)")
+run_step("measure PGO build"
+  "${PLAIN_DIR}/ulp_e2e" --bin-dir "${PGO_DIR}" --work-dir "${DATA_DIR}" --size-mb ${SIZE_MB}
+  --baseline "${WORK_DIR}/plain_results.txt" --tolerance 1 --rss-tolerance 10)
+message(STATUS "pgo: optimized binaries are in ${PGO_DIR}")
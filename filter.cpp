@@ -13,14 +13,13 @@
 #include <regex>
 #include <cctype>
 
+#include "ulp_simd.h"
+
 namespace fs = std::filesystem;
 
 std::string toLower(const std::string &s) {
-    std::string lower;
-    lower.reserve(s.size());
-    for (char c : s) {
-        lower.push_back(static_cast<char>(std::tolower(c)));
-    }
+    std::string lower = s;
+    simd::kernels().lowerAscii(&lower[0], lower.size());
     return lower;
 }
 
@@ -42,12 +41,16 @@ std::unordered_set<std::string> readFilterFile(const std::string &filename) {
     return filters;
 }
 
-std::string extractDomain(const std::string &email) {
-    auto atPos = email.find('@');
-    if (atPos == std::string::npos || atPos + 1 >= email.size()) {
-        return "";
-    }
-    return toLower(email.substr(atPos + 1));
+// Lowercased domain part of email, written into a reused buffer; false if there is none
+bool extractDomain(const std::string &email, std::string &domain) {
+    const char *end = email.data() + email.size();
+    const char *at = simd::kernels().findByte(email.data(), end, '@');
+    if (at == end || at + 1 == end) {
+        return false;
+    }
+    domain.assign(at + 1, end);
+    simd::kernels().lowerAscii(&domain[0], domain.size());
+    return true;
 }
 
 bool containsPattern(const std::string &text, const std::unordered_set<std::string> &patterns) {
@@ -65,11 +68,10 @@ void processEmailFile(const fs::path &filePath, const std::unordered_set<std::st
         std::cerr << "Error: Cannot open email file " << filePath << "\n";
         return;
     }
-    std::string line;
+    std::string line, domain;
     while (std::getline(file, line)) {
         if (line.empty()) continue;
-        std::string domain = extractDomain(line);
-        if (domain.empty()) continue;
+        if (!extractDomain(line, domain)) continue;
         if (mode == 'r') {
             if (containsPattern(domain, filterSet))
                 continue;
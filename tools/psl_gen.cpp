@@ -0,0 +1,192 @@
+// psl_gen.cpp
+// Compiles the Public Suffix List (https://publicsuffix.org/list/public_suffix_list.dat) into
+// ulp_psl.h, the label trie ulp walks to find public suffixes and registrable domains
+// Internationalized rules are emitted twice, as UTF-8 and as their xn-- (punycode) form, so
+// domains match whichever spelling they arrive in
+//
+// g++ -std=c++17 -O2 -o psl_gen tools/psl_gen.cpp
+// ./psl_gen /usr/share/publicsuffix/public_suffix_list.dat ulp_psl.h
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../ulp_idn.h"
+
+// Node flags; must match the enum written into the header
+enum : uint8_t { RULE = 1, EXCEPTION = 2, WILDCARD = 4 };
+
+struct TrieNode {
+    uint8_t flags = 0;
+    std::map<std::string, std::unique_ptr<TrieNode>> children;   // byte order, as ulp searches them
+};
+
+// Add one rule ("a.b", "*.b" or "!a.b") to the trie, labels right to left
+static bool addRule(TrieNode &root, std::string rule) {
+    uint8_t flag = RULE;
+    if (rule[0] == '!') {
+        flag = EXCEPTION;
+        rule.erase(0, 1);
+    } else if (rule.compare(0, 2, "*.") == 0) {
+        flag = WILDCARD;
+        rule.erase(0, 2);
+    }
+    TrieNode *node = &root;
+    size_t end = rule.size();
+    while (true) {
+        size_t dot = rule.rfind('.', end == 0 ? 0 : end - 1);
+        size_t start = dot == std::string::npos || dot >= end ? 0 : dot + 1;
+        std::string label = rule.substr(start, end - start);
+        if (label.empty() || label.size() > 63 || label.find('*') != std::string::npos) return false;
+        for (char &c : label)
+            if (c >= 'A' && c <= 'Z') c = static_cast<char>(c + 32);
+        auto &child = node->children[label];
+        if (!child) child = std::make_unique<TrieNode>();
+        node = child.get();
+        if (start == 0) break;
+        end = start - 1;
+    }
+    node->flags |= flag;
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <public_suffix_list.dat> <ulp_psl.h>\n";
+        return 1;
+    }
+    std::ifstream in(argv[1]);
+    if (!in) {
+        std::cerr << "Cannot open list: " << argv[1] << "\n";
+        return 1;
+    }
+    TrieNode root;
+    std::string line, version, ascii;
+    std::string source = argv[1];
+    source.erase(0, source.find_last_of("/\\") + 1);
+    size_t rules = 0;
+    while (std::getline(in, line)) {
+        if (line.compare(0, 12, "// VERSION: ") == 0) version = line.substr(12);
+        std::istringstream words(line);
+        std::string rule;
+        if (!(words >> rule) || rule.compare(0, 2, "//") == 0) continue;
+        if (!idn::toAscii(rule, ascii) || !addRule(root, rule) || (ascii != rule && !addRule(root, ascii))) {
+            std::cerr << "Unsupported rule: " << rule << "\n";
+            return 1;
+        }
+        ++rules;
+    }
+
+    // Breadth-first numbering keeps every node's children contiguous and sorted
+    struct Flat {
+        const TrieNode *node;
+        std::string label;
+    };
+    std::vector<Flat> order{ { &root, "" } };
+    std::vector<uint32_t> firstChild;
+    for (size_t i = 0; i < order.size(); ++i) {
+        firstChild.push_back(static_cast<uint32_t>(order.size()));
+        for (const auto &child : order[i].node->children) order.push_back({ child.second.get(), child.first });
+    }
+
+    // Where the top-level labels starting with each byte begin among the root's children
+    std::vector<uint32_t> rootIndex(257, firstChild[0] + static_cast<uint32_t>(root.children.size()));
+    for (size_t i = order.size(); i-- > 1;)
+        if (firstChild[0] <= i && i < rootIndex[256]) rootIndex[static_cast<unsigned char>(order[i].label[0])] = static_cast<uint32_t>(i);
+    for (size_t b = 256; b-- > 0;) rootIndex[b] = std::min(rootIndex[b], rootIndex[b + 1]);
+
+    std::ostringstream labels, nodes, prefixes, index;
+    for (size_t b = 0; b < rootIndex.size(); ++b)
+        index << (b % 16 == 0 ? "    " : " ") << rootIndex[b] << "," << (b % 16 == 15 || b == 256 ? "\n" : "");
+    uint32_t offset = 0, column = 0;
+    for (size_t i = 0; i < order.size(); ++i) {
+        const Flat &f = order[i];
+        if (f.node->children.size() > 0xFFFF) {
+            std::cerr << "Too many children under " << f.label << "\n";
+            return 1;
+        }
+        if (column == 0 && !f.label.empty()) labels << "    \"";
+        for (unsigned char c : f.label) {
+            if (c >= 0x80) {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\%03o", c);
+                labels << buf;
+                column += 4;
+            } else {
+                labels << c;
+                ++column;
+            }
+        }
+        if (column >= 96 || (column > 0 && i + 1 == order.size())) {
+            labels << "\"\n";
+            column = 0;
+        }
+        uint64_t prefix = 0;
+        for (size_t k = 0; k < 8; ++k)
+            prefix = prefix << 8 | (k < f.label.size() ? static_cast<unsigned char>(f.label[k]) : 0);
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "0x%016llxull,", static_cast<unsigned long long>(prefix));
+        prefixes << (i % 4 == 0 ? "    " : " ") << buf << (i % 4 == 3 || i + 1 == order.size() ? "\n" : "");
+        nodes << "    { " << offset << ", " << f.label.size() << ", " << unsigned(f.node->flags) << ", "
+              << f.node->children.size() << ", " << firstChild[i] << " },\n";
+        offset += static_cast<uint32_t>(f.label.size());
+    }
+
+    std::ofstream out(argv[2], std::ios::binary);
+    out << "// ulp_psl.h\n"
+        << "// Public Suffix List compiled into a label trie by tools/psl_gen.cpp; do not edit by hand.\n"
+        << "// Regenerate with the update-psl CMake target (or psl_gen <list> ulp_psl.h) when the list changes.\n"
+        << "// Source: " << source << (version.empty() ? "" : " " + version) << ", " << rules << " rules\n"
+        << "// The list data is subject to the Mozilla Public License 2.0 (https://mozilla.org/MPL/2.0/).\n"
+        << "\n"
+        << "#pragma once\n"
+        << "\n"
+        << "#include <cstdint>\n"
+        << "\n"
+        << "namespace psl {\n"
+        << "\n"
+        << "enum : uint8_t {\n"
+        << "    RULE = 1,           // the path from the root to this node is a public suffix\n"
+        << "    EXCEPTION = 2,      // ... is not, although a wildcard above it says so (!rule)\n"
+        << "    WILDCARD = 4        // every label directly below this node is a public suffix (*.rule)\n"
+        << "};\n"
+        << "\n"
+        << "// Trie over labels read right to left; node 0 is the root. A node's children are\n"
+        << "// NODES[first, first + children), sorted by label bytes (shorter first on a tie).\n"
+        << "struct Node {\n"
+        << "    uint32_t label;     // offset of the lowercase label in LABELS\n"
+        << "    uint8_t length;\n"
+        << "    uint8_t flags;\n"
+        << "    uint16_t children;\n"
+        << "    uint32_t first;\n"
+        << "};\n"
+        << "\n"
+        << "static const char LABELS[] =\n"
+        << labels.str() << ";\n"
+        << "\n"
+        << "static const Node NODES[] = {\n"
+        << nodes.str() << "};\n"
+        << "\n"
+        << "// First eight label bytes of each node, big-endian and zero-padded, so a search can order\n"
+        << "// most labels with one integer compare\n"
+        << "static const uint64_t PREFIXES[] = {\n"
+        << prefixes.str() << "};\n"
+        << "\n"
+        << "// Top-level labels whose first byte is b are NODES[ROOT_INDEX[b], ROOT_INDEX[b + 1])\n"
+        << "static const uint32_t ROOT_INDEX[257] = {\n"
+        << index.str() << "};\n"
+        << "\n"
+        << "} // namespace psl\n";
+    if (!out) {
+        std::cerr << "Cannot write " << argv[2] << "\n";
+        return 1;
+    }
+    std::cerr << "Wrote " << order.size() << " nodes for " << rules << " rules to " << argv[2] << "\n";
+    return 0;
+}
@@ -7,17 +7,29 @@
 #include <sstream>
 #include <string>
 #include <unordered_set>
+#include <unordered_map>
+#include <iterator>
+#include <list>
+#include <map>
+#include <set>
+#include <memory>
+#include <string_view>
 #include <vector>
 #include <queue>
 #include <algorithm>
 #include <cctype>
 #include <cstdlib>
+#include <cstring>
 #include <regex>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cerrno>
+#include <csignal>
 
 #if defined(__has_include)
   #if __has_include(<filesystem>)
@@ -38,8 +50,30 @@
   #include <windows.h>
   #include <commdlg.h>
   #pragma comment(lib, "comdlg32.lib")
+#else
+  #include <sys/socket.h>
+  #include <sys/un.h>
+  #include <netinet/in.h>
+  #include <arpa/inet.h>
+  #include <poll.h>
+  #include <unistd.h>
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif
+
+#ifdef __APPLE__
+  #include <mach/mach.h>
+#endif
+
+#ifdef __linux__
+  #include <sys/inotify.h>
 #endif
 
+#include "ulp_simd.h"
+#include "ulp_idn.h"
+#include "ulp_psl.h"
+
 // Trim whitespace from both ends
 static std::string trim(const std::string &s) {
     size_t start = s.find_first_not_of(" \t\r\n");
@@ -49,18 +83,18 @@ static std::string trim(const std::string &s) {
          : s.substr(start, end - start + 1);
 }
 
-// Convert string to lowercase
-static std::string toLower(const std::string &s) {
-    std::string res = s;
-    std::transform(res.begin(), res.end(), res.begin(), ::tolower);
-    return res;
+// trim() as a view, without the copy
+static std::string_view trimView(std::string_view s) {
+    size_t start = s.find_first_not_of(" \t\r\n");
+    if (start == std::string_view::npos) return std::string_view();
+    return s.substr(start, s.find_last_not_of(" \t\r\n") - start + 1);
 }
 
 // Split string by delimiter
 static std::vector<std::string> split(const std::string &s, const std::string &delimiter) {
     std::vector<std::string> tokens;
     size_t start = 0, pos;
-    while ((pos = s.find(delimiter, start)) != std::string::npos) {
+    while ((pos = simd::findSeparator(s, delimiter, start)) != std::string::npos) {
         tokens.push_back(s.substr(start, pos - start));
         start = pos + delimiter.length();
     }
@@ -78,18 +112,730 @@ static std::string join(const std::vector<std::string> &parts, const std::string
     return oss.str();
 }
 
+// Read-only view of a whole file: mapped where the platform has mmap, read into memory otherwise
+class MappedFile {
+public:
+    explicit MappedFile(const std::string &path) {
+#ifdef _WIN32
+        std::ifstream in(path, std::ios::binary);
+        if (!in) fail(path);
+        buffer_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        struct stat st;
+        if (fd < 0 || ::fstat(fd, &st) != 0) fail(path);
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ > 0) {
+            void *p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) fail(path);
+            ::madvise(p, size_, MADV_SEQUENTIAL);
+            data_ = static_cast<const char *>(p);
+            mapped_ = true;
+        }
+        ::close(fd);
+#endif
+    }
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    ~MappedFile() {
+#ifndef _WIN32
+        if (mapped_) ::munmap(const_cast<char *>(data_), size_);
+#endif
+    }
+    const char *data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    [[noreturn]] static void fail(const std::string &path) {
+        std::cerr << "Cannot open list file: " << path << "\n";
+        std::exit(1);
+    }
+    const char *data_ = "";
+    size_t size_ = 0;
+    bool mapped_ = false;
+    std::string buffer_;
+};
+
+// Header of a binary domain index written by ulp --build-index. The file is this header followed by
+// the slot table, the perfect-hash pilots and remap entries, the Bloom prefilter and the key arena,
+// in the layout DomainSet queries in memory, so opening one is a mmap with no parse step. Bump
+// DOMAIN_INDEX_VERSION whenever the layout, the hashing or the perfect hash function changes.
+struct DomainIndexHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t maxKey;
+    uint64_t keys;
+    uint64_t slotCount;
+    uint64_t slotsOffset;
+    uint64_t pilotCount;        // 0: slots form a linear-probing table instead of a perfect hash
+    uint64_t pilotsOffset;
+    uint64_t remapCount;
+    uint64_t remapOffset;
+    uint64_t bloomBlocks;       // 0: no prefilter
+    uint64_t bloomOffset;
+    uint64_t arenaOffset;
+    uint64_t arenaBytes;
+    uint64_t reserved[2];
+};
+static const char DOMAIN_INDEX_MAGIC[8] = { 'U', 'L', 'P', 'D', 'I', 'D', 'X', '\n' };
+static constexpr uint32_t DOMAIN_INDEX_VERSION = 3;
+
+// Case-insensitive set of filter domains, sized for lists of millions of entries. Keys are kept
+// lowercased back to back in one arena. Each key has one 64-bit slot packing a hash tag, the key
+// length and its arena offset. Probes are hashed and compared with ASCII case folding, so lookups
+// use the caller's bytes as-is and never build a lowercased copy.
+//
+// While the set is being filled the slots form a linear-probing table. freeze() then replaces it
+// with a minimal perfect hash (PTHash-style: a 16-bit pilot per small bucket of keys picks each
+// key's slot), so a lookup reads one pilot and exactly one slot; the tag rejects almost every
+// non-member before the arena is touched. Large frozen sets also carry a split-block Bloom filter
+// that answers most misses from one 32-byte block before the perfect hash is consulted. Storage is
+// owned or served straight from a mapped index file; the first insert into a frozen or mapped set
+// turns it back into an owned table.
+class DomainSet {
+public:
+    static constexpr size_t MAX_KEY = 255;      // longest key kept; DNS names stop at 253
+
+    void insert(std::string_view domain) {
+        if (domain.size() > MAX_KEY) return;
+        uint64_t h = simd::hashIgnoreCase(domain);
+        if (find(domain, h)) return;
+        thaw();
+        uint64_t offset = arena_.size();
+        arena_.append(domain.data(), domain.size());
+        simd::kernels().lowerAscii(&arena_[offset], domain.size());
+        reserve(size_ + 1);
+        place(h, offset, domain.size());
+    }
+
+    // Load a list file: one domain per line, optionally several separated by commas; blank lines
+    // and lines starting with '#' are skipped. Lines are parsed and hashed on all cores.
+    // A binary index file is recognised by its magic and mapped as-is when the set is empty.
+    void insertFile(const std::string &path) {
+        auto mapped = std::make_shared<MappedFile>(path);
+        const MappedFile &file = *mapped;
+        if (file.size() >= sizeof(DomainIndexHeader) &&
+            std::memcmp(file.data(), DOMAIN_INDEX_MAGIC, sizeof(DOMAIN_INDEX_MAGIC)) == 0) {
+            DomainSet index;
+            index.attach(mapped, path);
+            if (empty()) {
+                *this = std::move(index);
+            } else {
+                index.forEach([this](std::string_view key) { insert(key); });
+            }
+            return;
+        }
+        thaw();
+        struct Parsed {
+            std::string arena;
+            std::vector<std::pair<uint64_t, uint64_t>> keys;    // hash, offset << 8 | length
+        };
+        size_t threads = std::max(1u, std::thread::hardware_concurrency());
+        threads = std::min(threads, file.size() / (1 << 20) + 1);
+        std::vector<Parsed> parts(threads);
+        std::vector<std::thread> pool;
+        const char *begin = file.data(), *end = begin + file.size();
+        const char *from = begin;
+        for (size_t t = 0; t < threads; ++t) {
+            // Cut after a newline so no line is split between two threads
+            const char *to = t + 1 == threads ? end : begin + file.size() / threads * (t + 1);
+            if (to < from) to = from;
+            to = to == end ? end : simd::kernels().findByte(to, end, '\n');
+            if (to != end) ++to;
+            pool.emplace_back([from, to, &part = parts[t]] { parseList(from, to, part.arena, part.keys); });
+            from = to;
+        }
+        for (auto &t : pool) t.join();
+        size_t total = 0, bytes = 0;
+        for (const auto &part : parts) {
+            total += part.keys.size();
+            bytes += part.arena.size();
+        }
+        reserve(size_ + total);
+        arena_.reserve(arena_.size() + bytes);
+        for (const auto &part : parts) {
+            uint64_t base = arena_.size();
+            arena_ += part.arena;
+            for (const auto &key : part.keys) {
+                uint64_t offset = base + (key.second >> 8);
+                size_t length = static_cast<size_t>(key.second & 0xFF);
+                if (!find(std::string_view(arena_.data() + offset, length), key.first))
+                    place(key.first, offset, length);
+            }
+        }
+    }
+
+    // Replace the probing table with a minimal perfect hash once no more keys will be added.
+    // Keeps the probing table if no pilot set is found (e.g. two keys share a 64-bit hash).
+    void freeze() {
+        if (index_ || !pilots_.empty() || size_ == 0 || size_ > 0xF0000000ull) return;
+        const uint64_t n = size_;
+        const uint64_t tableSize = n + n / 50 + 1;          // load factor 0.98, remapped below n
+        uint64_t log2n = 1;
+        while ((1ull << log2n) < n) ++log2n;
+        const uint64_t bucketCount = std::max<uint64_t>(1, (6 * n + log2n - 1) / log2n);
+
+        // Group the keys by bucket, largest buckets first so they are placed while the table is empty
+        std::vector<uint32_t> bucketSize(bucketCount, 0);
+        for (size_t i = 0; i < slots_.size(); ++i)
+            if (slots_[i] != 0) ++bucketSize[bucketOf(hashes_[i], bucketCount)];
+        uint32_t largest = *std::max_element(bucketSize.begin(), bucketSize.end());
+        std::vector<uint32_t> bySize(largest + 2, 0);
+        for (uint32_t size : bucketSize) ++bySize[largest - size + 1];
+        for (size_t s = 1; s < bySize.size(); ++s) bySize[s] += bySize[s - 1];
+        std::vector<uint32_t> order(bucketCount);
+        for (uint64_t b = 0; b < bucketCount; ++b) order[bySize[largest - bucketSize[b]]++] = static_cast<uint32_t>(b);
+        std::vector<uint64_t> bucketStart(bucketCount + 1, 0);
+        for (uint64_t r = 0; r < bucketCount; ++r) bucketStart[order[r] + 1] = bucketSize[order[r]];
+        // Buckets are laid out in placement order, so the search below walks keys sequentially
+        std::vector<uint64_t> rankStart(bucketCount + 1, 0);
+        for (uint64_t r = 0; r < bucketCount; ++r) rankStart[r + 1] = rankStart[r] + bucketSize[order[r]];
+        std::vector<uint32_t> rankOf(bucketCount);
+        for (uint64_t r = 0; r < bucketCount; ++r) rankOf[order[r]] = static_cast<uint32_t>(r);
+        std::vector<std::pair<uint64_t, uint64_t>> grouped(n);     // hash, slot
+        {
+            std::vector<uint64_t> fill(rankStart.begin(), rankStart.end() - 1);
+            for (size_t i = 0; i < slots_.size(); ++i)
+                if (slots_[i] != 0)
+                    grouped[fill[rankOf[bucketOf(hashes_[i], bucketCount)]]++] = { hashes_[i], slots_[i] };
+        }
+
+        std::vector<uint16_t> pilots(bucketCount, 0);
+        std::vector<bool> taken(tableSize, false);
+        uint64_t positions[64];
+        for (uint64_t r = 0; r < bucketCount; ++r) {
+            const uint64_t first = rankStart[r], last = rankStart[r + 1];
+            if (first == last) break;                       // only empty buckets remain
+            if (last - first > 64) return;
+            for (uint64_t k = first + 1; k < last; ++k)
+                for (uint64_t j = first; j < k; ++j)
+                    if (grouped[k].first == grouped[j].first) return;
+            bool placed = false;
+            for (uint32_t pilot = 0; pilot <= 0xFFFF && !placed; ++pilot) {
+                placed = true;
+                for (uint64_t k = first; k < last && placed; ++k) {
+                    uint64_t pos = positionOf(grouped[k].first, pilot, tableSize);
+                    placed = !taken[pos] && std::find(positions, positions + (k - first), pos) == positions + (k - first);
+                    positions[k - first] = pos;
+                }
+                if (placed) {
+                    pilots[order[r]] = static_cast<uint16_t>(pilot);
+                    for (uint64_t k = 0; k < last - first; ++k) taken[positions[k]] = true;
+                }
+            }
+            if (!placed) return;
+        }
+
+        // Positions past n move into the holes below n, making the hash minimal
+        std::vector<uint32_t> remap(tableSize - n, 0);
+        uint64_t hole = 0;
+        for (uint64_t pos = n; pos < tableSize; ++pos) {
+            if (!taken[pos]) continue;
+            while (taken[hole]) ++hole;
+            remap[pos - n] = static_cast<uint32_t>(hole++);
+        }
+        std::vector<uint64_t> slots(n, 0);
+        for (uint64_t r = 0; r < bucketCount; ++r) {
+            const uint16_t pilot = pilots[order[r]];
+            for (uint64_t k = rankStart[r]; k < rankStart[r + 1]; ++k) {
+                uint64_t pos = positionOf(grouped[k].first, pilot, tableSize);
+                slots[pos < n ? pos : remap[pos - n]] = grouped[k].second;
+            }
+        }
+        std::vector<BloomBlock> bloom;
+        if (n >= BLOOM_MIN_KEYS) {
+            bloom.resize((n * BLOOM_BITS_PER_KEY + 255) / 256);
+            for (const auto &key : grouped) {
+                BloomBlock &block = bloom[bloomBlockOf(key.first, bloom.size())];
+                for (size_t w = 0; w < 8; ++w) block.words[w] |= bloomBit(key.first, w);
+            }
+        }
+        slots_.swap(slots);
+        pilots_.swap(pilots);
+        remap_.swap(remap);
+        bloom_.swap(bloom);
+        std::vector<uint64_t>().swap(hashes_);
+    }
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+    bool mapped() const { return index_ != nullptr; }
+    bool frozen() const { return pilotCount() != 0; }
+
+    // Write the set as a binary index file (temp file, then rename); exits on I/O errors
+    void writeIndex(const std::string &path) const {
+        auto align8 = [](uint64_t x) { return (x + 7) & ~uint64_t(7); };
+        auto align64 = [](uint64_t x) { return (x + 63) & ~uint64_t(63); };
+        DomainIndexHeader header{};
+        std::memcpy(header.magic, DOMAIN_INDEX_MAGIC, sizeof(header.magic));
+        header.version = DOMAIN_INDEX_VERSION;
+        header.maxKey = MAX_KEY;
+        header.keys = size_;
+        header.slotCount = slotCount();
+        header.slotsOffset = sizeof(DomainIndexHeader);
+        header.pilotCount = pilotCount();
+        header.pilotsOffset = header.slotsOffset + header.slotCount * sizeof(uint64_t);
+        header.remapCount = remapCount();
+        header.remapOffset = align8(header.pilotsOffset + header.pilotCount * sizeof(uint16_t));
+        header.bloomBlocks = bloomBlocks();
+        header.bloomOffset = align64(header.remapOffset + header.remapCount * sizeof(uint32_t));
+        header.arenaOffset = align8(header.bloomOffset + header.bloomBlocks * sizeof(BloomBlock));
+        header.arenaBytes = arenaSize();
+        const std::string tmp = path + ".tmp";
+        {
+            std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+            auto section = [&](const void *data, uint64_t bytes, uint64_t offset) {
+                static const char zeros[8] = {};
+                uint64_t at = static_cast<uint64_t>(out.tellp());
+                if (at < offset) out.write(zeros, static_cast<std::streamsize>(offset - at));
+                out.write(static_cast<const char *>(data), static_cast<std::streamsize>(bytes));
+            };
+            section(&header, sizeof(header), 0);
+            section(slotData(), header.slotCount * sizeof(uint64_t), header.slotsOffset);
+            section(pilotData(), header.pilotCount * sizeof(uint16_t), header.pilotsOffset);
+            section(remapData(), header.remapCount * sizeof(uint32_t), header.remapOffset);
+            section(bloomData(), header.bloomBlocks * sizeof(BloomBlock), header.bloomOffset);
+            section(arenaData(), header.arenaBytes, header.arenaOffset);
+            if (!out) {
+                std::cerr << "Cannot write index file: " << tmp << "\n";
+                std::exit(1);
+            }
+        }
+        std::error_code ec;
+        fs::rename(tmp, path, ec);
+        if (ec) {
+            std::cerr << "Cannot replace index file " << path << ": " << ec.message() << "\n";
+            std::exit(1);
+        }
+    }
+
+    // True if domain equals an entry, ignoring case; parent domains are not tried
+    bool contains(std::string_view domain) const {
+        return size_ != 0 && find(domain, simd::hashIgnoreCase(domain));
+    }
+
+    // True if domain equals an entry or is a subdomain of one (one probe per parent suffix).
+    // The domain and its parents are hashed first and their table reads prefetched together,
+    // so the cache misses of one call overlap instead of queueing; suffixes the Bloom filter
+    // rules out never reach the table.
+    bool matches(std::string_view domain) const {
+        if (size_ == 0) return false;
+        constexpr size_t BATCH = 8;
+        std::string_view keys[BATCH];
+        uint64_t hashes[BATCH], homes[BATCH];
+        size_t next = 0;
+        bool more = true;
+        while (more) {
+            size_t count = 0;
+            for (; count < BATCH && more; ++count) {
+                keys[count] = domain.substr(next);
+                hashes[count] = simd::hashIgnoreCase(keys[count]);
+                size_t dot = domain.find('.', next);
+                more = dot != std::string_view::npos;
+                next = dot + 1;
+            }
+            if (const size_t pilots = pilotCount())
+                for (size_t i = 0; i < count; ++i) simd::prefetch(pilotData() + bucketOf(hashes[i], pilots));
+            if (const size_t blocks = bloomBlocks()) {
+                for (size_t i = 0; i < count; ++i) simd::prefetch(bloomData() + bloomBlockOf(hashes[i], blocks));
+                size_t kept = 0;
+                for (size_t i = 0; i < count; ++i) {
+                    if (!bloomMayContain(hashes[i], blocks)) continue;
+                    keys[kept] = keys[i];
+                    hashes[kept++] = hashes[i];
+                }
+                count = kept;
+            }
+            for (size_t i = 0; i < count; ++i) {
+                homes[i] = home(hashes[i]);
+                simd::prefetch(slotData() + (homes[i] < slotCount() ? homes[i] : 0));
+            }
+            for (size_t i = 0; i < count; ++i)
+                if (probe(keys[i], hashes[i], homes[i])) return true;
+        }
+        return false;
+    }
+
+private:
+    // Slot layout: tag (16 bits, never 0) | length (8 bits) | arena offset (40 bits); 0 is empty
+    static uint64_t tagOf(uint64_t h) { return (h >> 48) | 1; }
+
+    // Perfect hash: the low 32 hash bits pick a bucket, with 60% of keys in the first 30% of
+    // buckets (PTHash's skew, which keeps pilots small); the bucket's pilot then picks the slot
+    static uint64_t bucketOf(uint64_t h, uint64_t bucketCount) {
+        const uint64_t dense = std::max<uint64_t>(1, bucketCount * 3 / 10);
+        const uint64_t low = h & 0xFFFFFFFFull;
+        if (((h >> 32) & 0xFFFF) < 39322 || dense == bucketCount) return low * dense >> 32;
+        return dense + (low * (bucketCount - dense) >> 32);
+    }
+    static uint64_t positionOf(uint64_t h, uint64_t pilot, uint64_t tableSize) {
+        uint64_t x = (h ^ (pilot * 0x9E3779B97F4A7C15ull)) * 0xC4CEB9FE1A85EC53ull;
+        return (x >> 32) * tableSize >> 32;
+    }
+
+    // Split-block Bloom filter (as in Parquet): the high hash bits pick a 32-byte block and eight
+    // salted multiplies of the low bits set one bit in each of its words. About 0.5% false positives.
+    // Smaller sets skip it: their tables stay cache-resident, so the extra probe would only cost hits.
+    struct alignas(32) BloomBlock {
+        uint32_t words[8];
+    };
+    static constexpr size_t BLOOM_BITS_PER_KEY = 12;
+    static constexpr size_t BLOOM_MIN_KEYS = size_t(1) << 17;
+    static uint64_t bloomBlockOf(uint64_t h, uint64_t blocks) { return (h >> 32) * blocks >> 32; }
+    static uint32_t bloomBit(uint64_t h, size_t word) {
+        static constexpr uint32_t salt[8] = {
+            0x47B6137Bu, 0x44974D91u, 0x8824AD5Bu, 0xA2B7289Du, 0x705495C7u, 0x2DF1424Bu, 0x9EFC4947u, 0x5C6BFB31u
+        };
+        return 1u << ((static_cast<uint32_t>(h) * salt[word]) >> 27);
+    }
+    bool bloomMayContain(uint64_t h, uint64_t blocks) const {
+        const BloomBlock &block = bloomData()[bloomBlockOf(h, blocks)];
+        uint32_t missing = 0;
+        for (size_t w = 0; w < 8; ++w) missing |= bloomBit(h, w) & ~block.words[w];
+        return missing == 0;
+    }
+
+    const uint64_t *slotData() const { return index_ ? indexSlots_ : slots_.data(); }
+    size_t slotCount() const { return index_ ? indexSlotCount_ : slots_.size(); }
+    const uint16_t *pilotData() const { return index_ ? indexPilots_ : pilots_.data(); }
+    size_t pilotCount() const { return index_ ? indexPilotCount_ : pilots_.size(); }
+    const uint32_t *remapData() const { return index_ ? indexRemap_ : remap_.data(); }
+    size_t remapCount() const { return index_ ? indexRemapCount_ : remap_.size(); }
+    const BloomBlock *bloomData() const { return index_ ? indexBloom_ : bloom_.data(); }
+    size_t bloomBlocks() const { return index_ ? indexBloomBlocks_ : bloom_.size(); }
+    const char *arenaData() const { return index_ ? indexArena_ : arena_.data(); }
+    size_t arenaSize() const { return index_ ? indexArenaBytes_ : arena_.size(); }
+
+    // First slot to read for hash h: the key's only slot once frozen, else the start of its
+    // probe sequence; slotCount() when there is no slot to read
+    uint64_t home(uint64_t h) const {
+        const size_t count = slotCount();
+        if (count == 0) return 0;
+        if (const size_t pilots = pilotCount()) {
+            uint64_t pos = positionOf(h, pilotData()[bucketOf(h, pilots)], count + remapCount());
+            // The bounds checks keep a damaged index file from reading past its arrays
+            return pos < count ? pos : remapData()[pos - count];
+        }
+        return h & (count - 1);
+    }
+    bool probe(std::string_view key, uint64_t h, uint64_t pos) const {
+        const size_t count = slotCount();
+        if (pos >= count || key.size() > MAX_KEY) return false;
+        const uint64_t *slots = slotData();
+        const char *arena = arenaData();
+        const uint64_t arenaBytes = arenaSize();
+        const uint64_t want = tagOf(h) << 48 | static_cast<uint64_t>(key.size()) << 40;
+        auto holds = [&](uint64_t slot) {
+            uint64_t offset = slot & OFFSET_MASK;
+            return (slot & ~OFFSET_MASK) == want && offset + key.size() <= arenaBytes &&
+                   simd::equalsIgnoreCase(key, std::string_view(arena + offset, key.size()));
+        };
+        if (pilotCount() != 0) return holds(slots[pos]);
+        const uint64_t mask = count - 1;
+        for (uint64_t i = pos;; i = (i + 1) & mask) {
+            uint64_t slot = slots[i];
+            if (slot == 0) return false;
+            if (holds(slot)) return true;
+        }
+    }
+    bool find(std::string_view key, uint64_t h) const { return probe(key, h, home(h)); }
+    void place(uint64_t h, uint64_t offset, size_t length) {
+        const uint64_t mask = slots_.size() - 1;
+        uint64_t i = h & mask;
+        while (slots_[i] != 0) i = (i + 1) & mask;
+        slots_[i] = tagOf(h) << 48 | static_cast<uint64_t>(length) << 40 | offset;
+        hashes_[i] = h;
+        ++size_;
+    }
+    // Grow so that count keys stay under 70% load
+    void reserve(size_t count) {
+        if (count * 10 < slots_.size() * 7) return;
+        size_t capacity = 16;
+        while (count * 10 >= capacity * 7) capacity *= 2;
+        std::vector<uint64_t> oldSlots(capacity, 0), oldHashes(capacity, 0);
+        oldSlots.swap(slots_);
+        oldHashes.swap(hashes_);
+        size_ = 0;
+        for (size_t i = 0; i < oldSlots.size(); ++i) {
+            uint64_t slot = oldSlots[i];
+            if (slot != 0) place(oldHashes[i], slot & OFFSET_MASK, static_cast<size_t>((slot >> 40) & 0xFF));
+        }
+    }
+    template<typename Fn>
+    void forEach(Fn &&fn) const {
+        const uint64_t *slots = slotData();
+        for (size_t i = 0, n = slotCount(); i < n; ++i) {
+            uint64_t offset = slots[i] & OFFSET_MASK;
+            size_t length = static_cast<size_t>((slots[i] >> 40) & 0xFF);
+            if (slots[i] != 0 && offset + length <= arenaSize())
+                fn(std::string_view(arenaData() + offset, length));
+        }
+    }
+    // Serve lookups from a mapped index file after checking its header against the file size
+    void attach(const std::shared_ptr<const MappedFile> &file, const std::string &path) {
+        DomainIndexHeader header;
+        std::memcpy(&header, file->data(), sizeof(header));
+        const uint64_t fileSize = file->size();
+        auto fits = [&](uint64_t offset, uint64_t count, uint64_t width) {
+            return offset % 8 == 0 && offset >= sizeof(DomainIndexHeader) && offset <= fileSize &&
+                   count <= (fileSize - offset) / width;
+        };
+        bool valid = header.version == DOMAIN_INDEX_VERSION && header.maxKey == MAX_KEY &&
+                     fits(header.slotsOffset, header.slotCount, sizeof(uint64_t)) &&
+                     fits(header.pilotsOffset, header.pilotCount, sizeof(uint16_t)) &&
+                     fits(header.remapOffset, header.remapCount, sizeof(uint32_t)) &&
+                     fits(header.bloomOffset, header.bloomBlocks, sizeof(BloomBlock)) &&
+                     header.bloomOffset % alignof(BloomBlock) == 0 &&
+                     fits(header.arenaOffset, header.arenaBytes, 1) && header.keys <= header.slotCount &&
+                     (header.pilotCount != 0 || header.slotCount == 0 ||
+                      (header.slotCount >= 16 && (header.slotCount & (header.slotCount - 1)) == 0 &&
+                       header.keys < header.slotCount));
+        if (!valid) {
+            std::cerr << "Unsupported or damaged index file: " << path << " (rebuild it with --build-index)\n";
+            std::exit(1);
+        }
+        index_ = file;
+        indexSlots_ = reinterpret_cast<const uint64_t *>(file->data() + header.slotsOffset);
+        indexSlotCount_ = static_cast<size_t>(header.slotCount);
+        indexPilots_ = reinterpret_cast<const uint16_t *>(file->data() + header.pilotsOffset);
+        indexPilotCount_ = static_cast<size_t>(header.pilotCount);
+        indexRemap_ = reinterpret_cast<const uint32_t *>(file->data() + header.remapOffset);
+        indexRemapCount_ = static_cast<size_t>(header.remapCount);
+        indexBloom_ = reinterpret_cast<const BloomBlock *>(file->data() + header.bloomOffset);
+        indexBloomBlocks_ = static_cast<size_t>(header.bloomBlocks);
+        indexArena_ = file->data() + header.arenaOffset;
+        indexArenaBytes_ = static_cast<size_t>(header.arenaBytes);
+        size_ = static_cast<size_t>(header.keys);
+    }
+    // Turn a frozen or mapped set back into an owned probing table before it is modified
+    void thaw() {
+        if (!index_ && pilots_.empty()) return;
+        std::vector<uint64_t> keys(slotData(), slotData() + slotCount());
+        if (index_) arena_.assign(indexArena_, indexArenaBytes_);
+        index_.reset();
+        pilots_.clear();
+        remap_.clear();
+        bloom_.clear();
+        slots_.clear();
+        hashes_.clear();
+        size_ = 0;
+        reserve(keys.size());
+        for (uint64_t slot : keys) {
+            uint64_t offset = slot & OFFSET_MASK;
+            size_t length = static_cast<size_t>((slot >> 40) & 0xFF);
+            if (slot != 0 && offset + length <= arena_.size())
+                place(simd::hashIgnoreCase(std::string_view(arena_.data() + offset, length)), offset, length);
+        }
+    }
+    // Parse list entries in [p, end) into a private arena plus (hash, offset << 8 | length) pairs
+    static void parseList(const char *p, const char *end, std::string &arena,
+                          std::vector<std::pair<uint64_t, uint64_t>> &keys) {
+        while (p < end) {
+            const char *eol = simd::kernels().findByte(p, end, '\n');
+            const char *q = p;
+            while (q < eol && (*q == ' ' || *q == '\t')) ++q;
+            if (q < eol && *q != '#') {
+                for (;;) {
+                    const char *comma = std::find(q, eol, ',');
+                    const char *b = q, *e = comma;
+                    while (b < e && (*b == ' ' || *b == '\t' || *b == '\r')) ++b;
+                    while (e > b && (e[-1] == ' ' || e[-1] == '\t' || e[-1] == '\r')) --e;
+                    size_t length = static_cast<size_t>(e - b);
+                    if (length > 0 && length <= MAX_KEY) {
+                        uint64_t offset = arena.size();
+                        arena.append(b, length);
+                        simd::kernels().lowerAscii(&arena[offset], length);
+                        keys.emplace_back(simd::hashIgnoreCase(std::string_view(b, length)), offset << 8 | length);
+                    }
+                    if (comma == eol) break;
+                    q = comma + 1;
+                }
+            }
+            p = eol == end ? end : eol + 1;
+        }
+    }
+
+    static constexpr uint64_t OFFSET_MASK = (1ull << 40) - 1;
+    std::string arena_;                 // every key, lowercased, back to back
+    std::vector<uint64_t> slots_;       // probing table (power of two), or one slot per key once frozen
+    std::vector<uint64_t> hashes_;      // full hash of each probing-table slot; dropped once frozen
+    std::vector<uint16_t> pilots_;      // per-bucket pilots once frozen
+    std::vector<uint32_t> remap_;       // frozen positions >= size_, moved into holes below it
+    std::vector<BloomBlock> bloom_;     // prefilter built with the perfect hash
+    size_t size_ = 0;
+    std::shared_ptr<const MappedFile> index_;   // set while serving from a mapped index file
+    const uint64_t *indexSlots_ = nullptr;
+    size_t indexSlotCount_ = 0;
+    const uint16_t *indexPilots_ = nullptr;
+    size_t indexPilotCount_ = 0;
+    const uint32_t *indexRemap_ = nullptr;
+    size_t indexRemapCount_ = 0;
+    const BloomBlock *indexBloom_ = nullptr;
+    size_t indexBloomBlocks_ = 0;
+    const char *indexArena_ = nullptr;
+    size_t indexArenaBytes_ = 0;
+};
+
+// How a profile splits its accepted lines over files (bucket_by=...)
+enum BucketMode {
+    BUCKET_NONE,                // everything goes to the profile's output file
+    BUCKET_EMAIL_DOMAIN,        // <bucket_dir>/<email domain>.txt
+    BUCKET_REGISTRABLE_DOMAIN,  // <bucket_dir>/<registrable part of the email domain>.txt
+    BUCKET_HASH                 // <bucket_dir>/part-NNNNN.txt by a hash of the email address
+};
+
+// Which occurrence of a dedup key a profile keeps (dedup_policy=...)
+enum DedupPolicy {
+    DEDUP_FIRST,                // the first one seen, written as soon as it is routed
+    DEDUP_LAST,                 // the last one in the file, written when the file ends
+    DEDUP_COUNT                 // the first one with its number of occurrences, when the file ends
+};
+
+// Named fields of a dedup_key projection; column numbers are stored 0-based as themselves
+enum : int { DEDUP_URL = -1, DEDUP_EMAIL = -2, DEDUP_PASS = -3 };
+
+// One route for parsed lines: its own filters, column conversion, dedup set and output file.
+// Profiles come from [name] sections of config.ini and start from the top-level settings.
+struct Profile {
+    std::string name;
+    std::string output;
+    std::string bucket_by;
+    std::string bucket_dir;
+    std::string convert_format;
+    std::string dedup_key;
+    std::string dedup_policy;
+    DomainSet email_remove;
+    DomainSet email_contains;
+    DomainSet url_remove;
+    DomainSet url_contains;
+    DomainSet email_suffix_remove;      // public suffixes (co.uk, com, blogspot.com), matched exactly
+    DomainSet email_suffix_contains;
+    DomainSet url_suffix_remove;
+    DomainSet url_suffix_contains;
+    std::string custom_filter;
+
+    // Filled in by compileProfile once the whole config is read
+    bool hasCustomFilter = false;
+    std::regex customRegex;
+    std::vector<int> convertColumns;    // 0-based columns of a numeric convert_format, else empty
+    BucketMode bucketMode = BUCKET_NONE;
+    uint64_t bucketPartitions = 0;      // N of bucket_by=hash:N
+    std::vector<int> dedupFields;       // dedup_key projection; empty keys on the output line
+    DedupPolicy dedupPolicy = DEDUP_FIRST;
+};
+
 struct Config {
     std::string separator;
     std::string format;
-    std::string convert_format;
-    std::unordered_set<std::string> email_remove;
-    std::unordered_set<std::string> email_contains;
-    std::unordered_set<std::string> url_remove;
-    std::unordered_set<std::string> url_contains;
-    std::string custom_filter;
+    std::string metrics_file;
+    unsigned metrics_port = 0;
+    unsigned metrics_interval = 10;
+    unsigned max_open_buckets = 128;
+    bool normalize_idn = false;         // rewrite email and URL domains to lowercase punycode
+    bool canonicalize_email = false;    // match and deduplicate on the canonical email address
+    bool ordered_output = false;        // write lines in input order, reproducibly
+    std::string checkpoint_file;        // where progress is saved for --resume; implies ordered_output
+    unsigned checkpoint_interval = 300; // seconds between checkpoints
+    std::string manifest_file;          // files already processed, skipped or continued by later runs
+    bool skip_duplicate_files = false;  // skip input files whose content repeats an earlier one
+    std::vector<Profile> profiles;
 };
 
-// Parse config file
+// Parse a non-negative integer config value, exiting on malformed input
+static unsigned parseUnsigned(const std::string &key, const std::string &value) {
+    char *end = nullptr;
+    unsigned long v = std::strtoul(value.c_str(), &end, 10);
+    if (value.empty() || *end != '\0' || v > 0xFFFFFFFFul) {
+        std::cerr << "Invalid value for " << key << ": " << value << "\n";
+        std::exit(1);
+    }
+    return static_cast<unsigned>(v);
+}
+
+// Precompute what routing needs per line: the custom_filter regex and numeric convert_format columns
+static void compileProfile(Profile &profile, const std::string &separator) {
+    if (!profile.custom_filter.empty()) {
+        try {
+            profile.customRegex = std::regex(profile.custom_filter, std::regex::icase);
+        } catch (const std::regex_error &e) {
+            std::cerr << "Invalid custom_filter in profile " << profile.name << ": " << e.what() << "\n";
+            std::exit(1);
+        }
+        profile.hasCustomFilter = true;
+    }
+    // Detect numeric convert_format like "1", "2:3", etc.
+    auto idxTokens = split(profile.convert_format, separator);
+    bool isNumericFormat = !idxTokens.empty();
+    for (auto &str : idxTokens) {
+        if (str.empty() || !std::all_of(str.begin(), str.end(), ::isdigit)) {
+            isNumericFormat = false;
+            break;
+        }
+    }
+    profile.convertColumns.clear();
+    if (isNumericFormat) {
+        for (auto &idxStr : idxTokens) {
+            unsigned long idx = std::strtoul(idxStr.c_str(), nullptr, 10);
+            profile.convertColumns.push_back(idx > 0x7FFFFFFFul ? 0x7FFFFFFF : static_cast<int>(idx) - 1);
+        }
+    }
+    profile.dedupFields.clear();
+    if (!profile.dedup_key.empty() && profile.dedup_key != "output") {
+        for (const auto &item : split(profile.dedup_key, separator)) {
+            std::string field = trim(item);
+            unsigned long column = std::strtoul(field.c_str(), nullptr, 10);
+            if (field == "url")        profile.dedupFields.push_back(DEDUP_URL);
+            else if (field == "email") profile.dedupFields.push_back(DEDUP_EMAIL);
+            else if (field == "pass")  profile.dedupFields.push_back(DEDUP_PASS);
+            else if (!field.empty() && std::all_of(field.begin(), field.end(), ::isdigit) &&
+                     column > 0 && column <= 0x7FFFFFFFul)
+                profile.dedupFields.push_back(static_cast<int>(column) - 1);
+            else {
+                std::cerr << "Invalid value for dedup_key in profile " << profile.name << ": " << profile.dedup_key
+                          << " (expected output, or url, email, pass and column numbers)\n";
+                std::exit(1);
+            }
+        }
+    }
+    const std::string &policy = profile.dedup_policy;
+    if (policy.empty() || policy == "first") {
+        profile.dedupPolicy = DEDUP_FIRST;
+    } else if (policy == "last") {
+        profile.dedupPolicy = DEDUP_LAST;
+    } else if (policy == "count") {
+        profile.dedupPolicy = DEDUP_COUNT;
+    } else {
+        std::cerr << "Invalid value for dedup_policy in profile " << profile.name << ": " << policy
+                  << " (expected first, last or count)\n";
+        std::exit(1);
+    }
+    const std::string &by = profile.bucket_by;
+    if (by.empty()) {
+        profile.bucketMode = BUCKET_NONE;
+    } else if (by == "email_domain") {
+        profile.bucketMode = BUCKET_EMAIL_DOMAIN;
+    } else if (by == "registrable_domain") {
+        profile.bucketMode = BUCKET_REGISTRABLE_DOMAIN;
+    } else if (by.rfind("hash:", 0) == 0) {
+        profile.bucketMode = BUCKET_HASH;
+        profile.bucketPartitions = parseUnsigned("bucket_by", by.substr(5));
+        if (profile.bucketPartitions == 0) {
+            std::cerr << "Invalid value for bucket_by: " << by << "\n";
+            std::exit(1);
+        }
+    } else {
+        std::cerr << "Invalid value for bucket_by in profile " << profile.name << ": " << by
+                  << " (expected email_domain, registrable_domain or hash:N)\n";
+        std::exit(1);
+    }
+}
+
+#ifndef ULP_NO_MAIN
+// Parse config file. Keys before the first [name] section configure the default profile;
+// each section defines a further profile that inherits those keys and overrides some of them.
+// With at least one section, only the sections produce output.
 static Config parseConfig(const std::string &filename) {
     Config config;
     std::ifstream file(filename);
@@ -97,31 +843,129 @@ static Config parseConfig(const std::string &filename) {
         std::cerr << "Cannot open config file: " << filename << "\n";
         std::exit(1);
     }
+    Profile base;
+    base.name = "default";
+    base.output = "filtered_output.txt";
+    base.bucket_dir = "buckets";
+    Profile *current = &base;
+    std::unordered_set<std::string> replacedLists;    // list keys the current section has restarted
+    // Lists are final once their section ends; frozen before sections copy them
+    auto freezeLists = [](Profile &profile) {
+        for (DomainSet *set : { &profile.email_remove, &profile.email_contains,
+                                &profile.url_remove, &profile.url_contains,
+                                &profile.email_suffix_remove, &profile.email_suffix_contains,
+                                &profile.url_suffix_remove, &profile.url_suffix_contains })
+            set->freeze();
+    };
     std::string line;
     while (std::getline(file, line)) {
         line = trim(line);
         if (line.empty() || line[0] == '#') continue;
+        if (line.front() == '[' && line.back() == ']') {
+            std::string name = trim(line.substr(1, line.size() - 2));
+            bool validName = !name.empty() && std::all_of(name.begin(), name.end(), [](char c) {
+                return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '-' || c == '.';
+            });
+            if (!validName) {
+                std::cerr << "Invalid profile name in " << filename << ": " << line << "\n";
+                std::exit(1);
+            }
+            for (const auto &p : config.profiles) {
+                if (p.name == name) {
+                    std::cerr << "Duplicate profile [" << name << "] in " << filename << "\n";
+                    std::exit(1);
+                }
+            }
+            freezeLists(*current);
+            config.profiles.push_back(base);
+            current = &config.profiles.back();
+            current->name = name;
+            current->output = "filtered_output_" + name + ".txt";
+            current->bucket_dir = "buckets_" + name;
+            replacedLists.clear();
+            continue;
+        }
         size_t pos = line.find('=');
         if (pos == std::string::npos) continue;
         std::string key   = trim(line.substr(0, pos));
         std::string value = trim(line.substr(pos + 1));
+        bool global = key == "separator" || key == "format" || key.rfind("metrics_", 0) == 0 ||
+                      key == "max_open_buckets" || key == "normalize_idn" ||
+                      key == "canonicalize_email" || key == "ordered_output" || key.rfind("checkpoint_", 0) == 0 ||
+                      key == "manifest_file" || key == "skip_duplicate_files";
+        if (global && current != &base) {
+            std::cerr << key << " applies to every profile; set it before the first [section] in "
+                      << filename << "\n";
+            std::exit(1);
+        }
         if (key == "separator")           config.separator = value;
         else if (key == "format")         config.format = value;
-        else if (key == "convert_format") config.convert_format = value;
-        else if (key == "custom_filter")  config.custom_filter = value;
+        else if (key == "metrics_file")   config.metrics_file = value;
+        else if (key == "metrics_port")   config.metrics_port = parseUnsigned(key, value);
+        else if (key == "metrics_interval") config.metrics_interval = parseUnsigned(key, value);
+        else if (key == "max_open_buckets") config.max_open_buckets = parseUnsigned(key, value);
+        else if (key == "normalize_idn")  config.normalize_idn = parseUnsigned(key, value) != 0;
+        else if (key == "canonicalize_email") config.canonicalize_email = parseUnsigned(key, value) != 0;
+        else if (key == "ordered_output") config.ordered_output = parseUnsigned(key, value) != 0;
+        else if (key == "checkpoint_file") config.checkpoint_file = value;
+        else if (key == "checkpoint_interval") config.checkpoint_interval = parseUnsigned(key, value);
+        else if (key == "manifest_file")  config.manifest_file = value;
+        else if (key == "skip_duplicate_files") config.skip_duplicate_files = parseUnsigned(key, value) != 0;
+        else if (key == "convert_format") current->convert_format = value;
+        else if (key == "custom_filter")  current->custom_filter = value;
+        else if (key == "dedup_key")      current->dedup_key = value;
+        else if (key == "dedup_policy")   current->dedup_policy = value;
+        else if (key == "output")         current->output = value;
+        else if (key == "bucket_by")      current->bucket_by = value;
+        else if (key == "bucket_dir")     current->bucket_dir = value;
         else {
-            auto tokens = split(value, ",");
-            for (auto &t : tokens) {
-                t = toLower(trim(t));
-                if (key == "email_remove")   config.email_remove.insert(t);
-                if (key == "email_contains") config.email_contains.insert(t);
-                if (key == "url_remove")     config.url_remove.insert(t);
-                if (key == "url_contains")   config.url_contains.insert(t);
+            // name=a,b,c lists inline; name_file=path loads one entry per line from a file
+            const bool fromFile = key.size() > 5 && key.compare(key.size() - 5, 5, "_file") == 0;
+            const std::string list = fromFile ? key.substr(0, key.size() - 5) : key;
+            DomainSet *set = list == "email_remove"          ? &current->email_remove
+                           : list == "email_contains"        ? &current->email_contains
+                           : list == "url_remove"            ? &current->url_remove
+                           : list == "url_contains"          ? &current->url_contains
+                           : list == "email_suffix_remove"   ? &current->email_suffix_remove
+                           : list == "email_suffix_contains" ? &current->email_suffix_contains
+                           : list == "url_suffix_remove"     ? &current->url_suffix_remove
+                           : list == "url_suffix_contains"   ? &current->url_suffix_contains
+                           : nullptr;
+            if (!set) continue;
+            // A section's first line for a list replaces the inherited list; later lines extend it
+            if (current != &base && replacedLists.insert(list).second) *set = DomainSet();
+            if (fromFile) {
+                auto start = std::chrono::steady_clock::now();
+                size_t before = set->size();
+                set->insertFile(value);
+                double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                std::cout << "Loaded " << set->size() - before << " domains for " << list << " from "
+                          << value << " in " << seconds << " s" << (set->mapped() ? " (mapped index)" : "")
+                          << std::endl;
+            } else {
+                auto tokens = split(value, ",");
+                for (auto &t : tokens) set->insert(trim(t));
             }
         }
     }
+    freezeLists(*current);
+    if (config.profiles.empty()) config.profiles.push_back(base);
+    if (config.max_open_buckets == 0) config.max_open_buckets = 1;
+    // A checkpoint is only a clean cut when everything before some chunk, and nothing after it,
+    // has been written and deduplicated
+    if (!config.checkpoint_file.empty()) config.ordered_output = true;
+    std::unordered_set<std::string> outputs;
+    for (auto &profile : config.profiles) {
+        compileProfile(profile, config.separator);
+        const std::string &target = profile.bucketMode == BUCKET_NONE ? profile.output : profile.bucket_dir;
+        if (target.empty() || !outputs.insert(target).second) {
+            std::cerr << "Profile " << profile.name << " needs its own output file\n";
+            std::exit(1);
+        }
+    }
     return config;
 }
+#endif // ULP_NO_MAIN
 
 // Advanced regexes for email and URL
 static const std::regex advancedEmailRegex(
@@ -130,51 +974,192 @@ static const std::regex advancedEmailRegex(
 static const std::regex advancedUrlRegex(
     R"((https?://)?((?:[\w-]+\.)+[a-zA-Z]{2,})(:\d+)?(/[^\s\r\n]*)?)"
 );
+// The same with normalize_idn, which also accepts internationalized TLDs (xn--p1ai)
+static const std::regex idnEmailRegex(
+    R"(([\w\.-]+)@([\w\.-]+\.(?:xn--[a-zA-Z0-9-]+|[a-zA-Z]{2,})))"
+);
+static const std::regex idnUrlRegex(
+    R"((https?://)?((?:[\w-]+\.)+(?:xn--[a-zA-Z0-9-]+|[a-zA-Z]{2,}))(:\d+)?(/[^\s\r\n]*)?)"
+);
+// With canonicalize_email the local part may carry a "+tag", which canonicalization strips
+static const std::regex subaddressEmailRegex(
+    R"(([\w\.+-]+)@([\w\.-]+\.[a-zA-Z]{2,}))"
+);
+static const std::regex idnSubaddressEmailRegex(
+    R"(([\w\.+-]+)@([\w\.-]+\.(?:xn--[a-zA-Z0-9-]+|[a-zA-Z]{2,})))"
+);
 
-// Extract domain from email
-static std::string extractEmailDomain(const std::string &email) {
-    size_t pos = email.find('@');
-    return (pos == std::string::npos)
-         ? ""
-         : toLower(email.substr(pos + 1));
+// Extract domain from email, as a view into email in its original case
+static std::string_view extractEmailDomain(const std::string &email) {
+    const char *end = email.data() + email.size();
+    const char *at = simd::kernels().findByte(email.data(), end, '@');
+    return (at == end)
+         ? std::string_view()
+         : std::string_view(at + 1, static_cast<size_t>(end - at - 1));
 }
 
-// Extract domain from URL
-static std::string extractUrlDomain(const std::string &url) {
+// Extract domain from URL, as a view into url in its original case
+static std::string_view extractUrlDomain(const std::string &url, bool idnTld = false) {
     std::smatch match;
-    if (std::regex_search(url, match, advancedUrlRegex) && match.size() >= 3)
-        return toLower(match[2].str());
-    return "";
-}
-
-// Check if domain matches a pattern (exact or subdomain)
-static bool domainMatches(const std::string &domain, const std::string &pattern) {
-    if (domain == pattern) return true;
-    if (domain.size() > pattern.size() &&
-        domain.compare(domain.size() - pattern.size(), pattern.size(), pattern) == 0 &&
-        (domain.size() == pattern.size() ||
-         domain[domain.size() - pattern.size() - 1] == '.'))
-        return true;
-    return false;
-}
-
-// Check domain against remove/contain sets
-static bool checkDomain(const std::string &domain,
-                        const std::unordered_set<std::string> &removeSet,
-                        const std::unordered_set<std::string> &containSet) {
-    for (const auto &r : removeSet)
-        if (domainMatches(domain, r)) return false;
-    if (!containSet.empty()) {
-        for (const auto &c : containSet)
-            if (domainMatches(domain, c)) return true;
-        return false;
+    if (std::regex_search(url, match, idnTld ? idnUrlRegex : advancedUrlRegex) && match.size() >= 3)
+        return std::string_view(url.data() + match.position(2), static_cast<size_t>(match.length(2)));
+    return std::string_view();
+}
+
+// Child of a Public Suffix List trie node with the given label (ASCII case-insensitive), or null.
+// A branchless lower bound over the children's 8-byte prefixes finds the candidates; only labels
+// longer than eight bytes compare the rest. Top-level labels start from their first-byte range.
+static const psl::Node *pslChild(const psl::Node &node, std::string_view label) {
+    if (label.empty() || label.size() > 63) return nullptr;
+    uint64_t prefix = 0;
+    for (size_t i = 0; i < 8; ++i) {
+        unsigned char c = i < label.size() ? static_cast<unsigned char>(label[i]) : 0;
+        prefix = prefix << 8 | (static_cast<unsigned char>(c - 'A') < 26 ? c | 0x20 : c);
+    }
+    uint32_t first = node.first, last = node.first + node.children;
+    if (&node == psl::NODES) {
+        first = psl::ROOT_INDEX[prefix >> 56];
+        last = psl::ROOT_INDEX[(prefix >> 56) + 1];
+    }
+    if (first == last) return nullptr;
+    const uint64_t *base = psl::PREFIXES + first, *end = psl::PREFIXES + last;
+    for (size_t n = last - first; n > 1; n -= n / 2)
+        base = base[n / 2 - 1] < prefix ? base + n / 2 : base;
+    for (base += *base < prefix; base < end && *base == prefix; ++base) {
+        const psl::Node &child = psl::NODES[base - psl::PREFIXES];
+        if (child.length == label.size() &&
+            (label.size() <= 8 || simd::equalsIgnoreCase(label.substr(8),
+                                                         std::string_view(psl::LABELS + child.label + 8,
+                                                                          label.size() - 8))))
+            return &child;
+    }
+    return nullptr;
+}
+
+// Offset in domain where its public suffix starts, per the embedded Public Suffix List: the
+// longest matching rule wins, an exception rule yields its parent, and an unlisted TLD is its own
+// suffix (the implicit "*" rule)
+static size_t publicSuffixOffset(std::string_view domain) {
+    const psl::Node *node = psl::NODES;
+    size_t suffix = std::string_view::npos;
+    size_t end = domain.size();         // one past the current label, walking right to left
+    while (true) {
+        size_t dot = end == 0 ? std::string_view::npos : domain.rfind('.', end - 1);
+        size_t start = dot == std::string_view::npos ? 0 : dot + 1;
+        const psl::Node *child = pslChild(*node, domain.substr(start, end - start));
+        if (child && (child->flags & psl::EXCEPTION)) return end == domain.size() ? start : end + 1;
+        if (suffix == std::string_view::npos || (node->flags & psl::WILDCARD) ||
+            (child && (child->flags & psl::RULE)))
+            suffix = start;
+        if (!child || dot == std::string_view::npos) return suffix;
+        node = child;
+        end = dot;
     }
+}
+
+// Public suffix of a domain, e.g. "mail.example.co.uk" -> "co.uk"
+static std::string_view publicSuffix(std::string_view domain) {
+    return domain.substr(publicSuffixOffset(domain));
+}
+
+// Registrable part of a domain (eTLD+1), e.g. "mail.example.co.uk" -> "example.co.uk"; a domain
+// that is itself a public suffix is returned whole
+static std::string_view registrableDomain(std::string_view domain) {
+    size_t suffix = publicSuffixOffset(domain);
+    if (suffix < 2) return domain;
+    size_t dot = domain.rfind('.', suffix - 2);
+    return dot == std::string_view::npos ? domain : domain.substr(dot + 1);
+}
+
+// Check domain against remove/contain sets (exact or subdomain match, case-insensitive)
+static bool checkDomain(std::string_view domain, const DomainSet &removeSet, const DomainSet &containSet) {
+    if (removeSet.matches(domain)) return false;
+    if (!containSet.empty()) return containSet.matches(domain);
     return true;
 }
 
+// Check the public suffix of domain against remove/contain sets of suffixes (exact match)
+static bool checkSuffix(std::string_view domain, const DomainSet &removeSet, const DomainSet &containSet) {
+    if (removeSet.empty() && containSet.empty()) return true;
+    std::string_view suffix = publicSuffix(domain);
+    if (removeSet.contains(suffix)) return false;
+    return containSet.empty() || containSet.contains(suffix);
+}
+
+// canonicalize_email: how a provider lets several spellings reach one mailbox
+enum : uint8_t {
+    EMAIL_DROP_DOTS = 1,        // dots in the local part are ignored (j.doe == jdoe)
+    EMAIL_PLUS_TAG = 2,         // "+tag" ends the local part (subaddressing)
+    EMAIL_DASH_TAG = 4          // "-tag" ends the local part (Yahoo disposable addresses)
+};
+
+struct EmailProvider {
+    std::string_view domain;
+    std::string_view canonical;         // domain the mailbox is known by, e.g. googlemail.com -> gmail.com
+    uint8_t rules;
+};
+
+static constexpr EmailProvider emailProviders[] = {
+    { "gmail.com", "gmail.com", EMAIL_DROP_DOTS | EMAIL_PLUS_TAG },
+    { "googlemail.com", "gmail.com", EMAIL_DROP_DOTS | EMAIL_PLUS_TAG },
+    { "outlook.com", "outlook.com", EMAIL_PLUS_TAG },
+    { "hotmail.com", "hotmail.com", EMAIL_PLUS_TAG },
+    { "live.com", "live.com", EMAIL_PLUS_TAG },
+    { "msn.com", "msn.com", EMAIL_PLUS_TAG },
+    { "icloud.com", "icloud.com", EMAIL_PLUS_TAG },
+    { "me.com", "icloud.com", EMAIL_PLUS_TAG },
+    { "mac.com", "icloud.com", EMAIL_PLUS_TAG },
+    { "yahoo.com", "yahoo.com", EMAIL_DASH_TAG },
+    { "protonmail.com", "protonmail.com", EMAIL_PLUS_TAG },
+    { "protonmail.ch", "protonmail.com", EMAIL_PLUS_TAG },
+    { "proton.me", "protonmail.com", EMAIL_PLUS_TAG },
+    { "pm.me", "protonmail.com", EMAIL_PLUS_TAG },
+    { "fastmail.com", "fastmail.com", EMAIL_PLUS_TAG },
+    { "yandex.ru", "yandex.ru", EMAIL_PLUS_TAG },
+    { "yandex.com", "yandex.ru", EMAIL_PLUS_TAG },
+    { "ya.ru", "yandex.ru", EMAIL_PLUS_TAG },
+};
+
+// Canonical form of a valid email address into out, in one pass: ASCII-lowercased, with the
+// provider's domain alias and local-part rules applied. out keeps its capacity across calls, so a
+// reused buffer does not allocate. A local part the rules would empty is only lowercased.
+static void canonicalEmail(std::string_view email, std::string &out) {
+    size_t at = email.find('@');
+    std::string_view domain = at == std::string_view::npos ? std::string_view() : email.substr(at + 1);
+    const EmailProvider *provider = nullptr;
+    for (const EmailProvider &p : emailProviders) {
+        if (p.domain.size() == domain.size() && simd::equalsIgnoreCase(domain, p.domain)) {
+            provider = &p;
+            break;
+        }
+    }
+    const uint8_t rules = provider ? provider->rules : 0;
+    out.clear();
+    for (size_t i = 0; i < at && i < email.size(); ++i) {
+        char c = email[i];
+        if (((rules & EMAIL_PLUS_TAG) && c == '+') || ((rules & EMAIL_DASH_TAG) && c == '-')) break;
+        if ((rules & EMAIL_DROP_DOTS) && c == '.') continue;
+        out += static_cast<unsigned char>(c - 'A') < 26 ? static_cast<char>(c | 0x20) : c;
+    }
+    if (out.empty()) {
+        out.assign(email.data(), std::min(at, email.size()));
+        simd::kernels().lowerAscii(&out[0], out.size());
+    }
+    if (at == std::string_view::npos) return;
+    out += '@';
+    size_t domainStart = out.size();
+    if (provider) {
+        out += provider->canonical;
+    } else {
+        out += domain;
+        simd::kernels().lowerAscii(&out[domainStart], domain.size());
+    }
+}
+
 // Validate email
-static bool isValidEmail(const std::string &s) {
-    return std::regex_match(s, advancedEmailRegex);
+static bool isValidEmail(const std::string &s, bool idnTld = false, bool subaddress = false) {
+    return std::regex_match(s, subaddress ? (idnTld ? idnSubaddressEmailRegex : subaddressEmailRegex)
+                                          : (idnTld ? idnEmailRegex : advancedEmailRegex));
 }
 
 // Validate phone number
@@ -192,6 +1177,11 @@ public:
         queue_.push(item);
         cond_.notify_one();
     }
+    void push(T &&item) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push(std::move(item));
+        cond_.notify_one();
+    }
     bool pop(T &item) {
         std::unique_lock<std::mutex> lock(mutex_);
         while (queue_.empty() && !done_) cond_.wait(lock);
@@ -221,186 +1211,1688 @@ public:
         std::swap(queue_, empty);
         done_ = false;
     }
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queue_.size();
+    }
 private:
     std::queue<T> queue_;
-    std::mutex mutex_;
+    mutable std::mutex mutex_;
     std::condition_variable cond_;
     bool done_ = false;
 };
 
-static std::mutex duplicate_mutex;
-static std::unordered_set<std::string> global_duplicates;
-static std::atomic<bool> doneReading{false};
-static std::atomic<unsigned long long> processedCount{0};
-static ThreadSafeQueue<std::string> inputQueue;
-static ThreadSafeQueue<std::string> outputQueue;
+// Files of one bucketed profile: one file per bucket under dir, appended through at most maxOpen
+// handles (least recently used is closed first). Lines are buffered per bucket; a bucket is
+// written once its buffer fills, and every bucket when all buffers together exceed the budget.
+class BucketWriter {
+public:
+    static constexpr size_t BUCKET_FLUSH_BYTES = 256 * 1024;
+    static constexpr size_t BUFFER_BUDGET_BYTES = 64 * 1024 * 1024;
 
-// Convert wildcard pattern to regex
-static std::regex wildcardToRegex(const std::string &pattern) {
-    std::string regexPattern;
-    for (char ch : pattern) {
-        switch (ch) {
-            case '*': regexPattern += ".*";  break;
-            case '?': regexPattern += ".";   break;
-            case '.': regexPattern += "\\."; break;
-            default:  regexPattern.push_back(ch); break;
+    // append keeps what earlier runs wrote to the bucket files instead of starting them over
+    BucketWriter(const std::string &dir, size_t maxOpen, bool append = false)
+        : dir_(dir), maxOpen_(maxOpen), append_(append) {}
+    BucketWriter(const BucketWriter &) = delete;
+    BucketWriter &operator=(const BucketWriter &) = delete;
+    ~BucketWriter() {
+        flushAll();
+        for (Bucket *b : lru_) std::fclose(b->file);
+    }
+
+    void write(const std::string &name, const std::string &line) {
+        auto it = buckets_.find(name);
+        if (it == buckets_.end()) {
+            it = buckets_.emplace(name, Bucket()).first;
+            it->second.path = (fs::path(dir_) / name).string();
+            it->second.created = append_;
         }
+        Bucket &b = it->second;
+        b.buffer += line;
+        b.buffer += '\n';
+        buffered_ += line.size() + 1;
+        if (b.buffer.size() >= BUCKET_FLUSH_BYTES) flush(b);
+        if (buffered_ > BUFFER_BUDGET_BYTES) flushAll();
     }
-    return std::regex(regexPattern, std::regex::icase);
-}
+    void flushAll() {
+        for (auto &entry : buckets_) flush(entry.second);
+    }
+    size_t bucketCount() const { return buckets_.size(); }
+    uint64_t fileOpens() const { return fileOpens_; }
 
-// Recursively find files matching pattern
-static std::vector<std::string> getFiles(const std::string &pattern) {
-    std::vector<std::string> files;
-    std::regex r = wildcardToRegex(pattern);
-    fs::path base = fs::current_path();
-    for (auto &p : fs::recursive_directory_iterator(base)) {
-        if (p.is_regular_file()) {
-            std::string fname = p.path().filename().string();
-            if (std::regex_match(fname, r))
-                files.push_back(p.path().string());
+    // Push everything buffered through to the files
+    void sync() {
+        flushAll();
+        for (Bucket *b : lru_) std::fflush(b->file);
+    }
+    // Checkpoint: flush every bucket and report the size of each file this run has written. When
+    // appending, every file in the directory counts, including those not yet touched.
+    void snapshot(std::vector<std::pair<std::string, uint64_t>> &sizes) {
+        sync();
+        sizes.clear();
+        std::error_code ec;
+        if (append_) {
+            for (fs::directory_iterator it(dir_, ec), end; !ec && it != end; it.increment(ec))
+                if (fs::is_regular_file(it->status()))
+                    sizes.emplace_back(it->path().filename().string(), fs::file_size(it->path(), ec));
+        } else {
+            for (auto &entry : buckets_)
+                if (entry.second.created && !ec) sizes.emplace_back(entry.first, fs::file_size(entry.second.path, ec));
+        }
+        if (ec) {
+            std::cerr << "Cannot stat bucket files in " << dir_ << ": " << ec.message() << "\n";
+            std::exit(1);
+        }
+    }
+    // --resume: cut each checkpointed bucket file back to its recorded size and append from there.
+    // Buckets first written after the checkpoint start over: when opened, or, appending, right away.
+    void restore(const std::vector<std::pair<std::string, uint64_t>> &sizes) {
+        if (append_) {
+            std::unordered_set<std::string> known;
+            for (const auto &entry : sizes) known.insert(entry.first);
+            std::error_code ec;
+            std::vector<fs::path> stale;
+            for (fs::directory_iterator it(dir_, ec), end; !ec && it != end; it.increment(ec))
+                if (fs::is_regular_file(it->status()) && !known.count(it->path().filename().string()))
+                    stale.push_back(it->path());
+            for (const auto &path : stale) fs::remove(path, ec);
+        }
+        for (const auto &entry : sizes) {
+            Bucket &b = buckets_.emplace(entry.first, Bucket()).first->second;
+            b.path = (fs::path(dir_) / entry.first).string();
+            std::error_code ec;
+            fs::resize_file(b.path, entry.second, ec);
+            if (ec) {
+                std::cerr << "Cannot restore output file " << b.path << ": " << ec.message() << "\n";
+                std::exit(1);
+            }
+            b.created = true;
         }
     }
-    return files;
-}
 
-// Process a single line according to config
-static std::string processLine(const std::string &line, const Config &config) {
-    if (line.empty()) return "";
-    auto tokens = split(line, config.separator);
-    std::string url, login, pass;
-    bool valid = false;
+private:
+    struct Bucket {
+        std::string path;
+        std::string buffer;
+        FILE *file = nullptr;
+        bool created = false;                   // truncated by this run already
+        std::list<Bucket *>::iterator lru;
+    };
 
-    // Parse based on input format
-    if (config.format == "url:email:pass") {
-        if (tokens.size() < 3) return "";
-        login = trim(tokens[tokens.size() - 2]);
-        pass  = trim(tokens[tokens.size() - 1]);
-        url   = trim(join(
-                    std::vector<std::string>(tokens.begin(), tokens.end() - 2),
-                    config.separator));
-        if (!isValidEmail(login) || isPhoneNumber(login)) return "";
-        valid = true;
+    void flush(Bucket &b) {
+        if (b.buffer.empty()) return;
+        FILE *file = open(b);
+        if (std::fwrite(b.buffer.data(), 1, b.buffer.size(), file) != b.buffer.size()) {
+            std::cerr << "Cannot write output file: " << b.path << "\n";
+            std::exit(1);
+        }
+        buffered_ -= b.buffer.size();
+        std::string().swap(b.buffer);           // idle buckets must not pin their peak capacity
+    }
+    FILE *open(Bucket &b) {
+        if (b.file) {
+            lru_.splice(lru_.begin(), lru_, b.lru);
+            return b.file;
+        }
+        if (lru_.size() >= maxOpen_) {
+            Bucket *victim = lru_.back();
+            std::fclose(victim->file);
+            victim->file = nullptr;
+            lru_.pop_back();
+        }
+        // Text mode, like the single output file, so Windows builds keep writing CRLF
+        b.file = std::fopen(b.path.c_str(), b.created ? "a" : "w");
+        if (!b.file) {
+            std::cerr << "Cannot open output file: " << b.path << "\n";
+            std::exit(1);
+        }
+        b.created = true;
+        ++fileOpens_;
+        lru_.push_front(&b);
+        b.lru = lru_.begin();
+        return b.file;
+    }
 
-    } else if (config.format == "email:pass") {
-        if (tokens.size() < 2) return "";
-        login = trim(tokens[0]);
-        pass  = trim(tokens[1]);
-        if (!isValidEmail(login) || isPhoneNumber(login)) return "";
-        valid = true;
+    std::string dir_;
+    size_t maxOpen_;
+    bool append_;
+    size_t buffered_ = 0;
+    uint64_t fileOpens_ = 0;
+    std::unordered_map<std::string, Bucket> buckets_;
+    std::list<Bucket *> lru_;                   // buckets with an open file, most recent first
+};
+
+// 128-bit hash of a line's dedup key: a fast non-cryptographic hash whose collision rate on
+// realistic inputs is far below one in any run, and a key costs 16 bytes however long the line is
+struct DedupKey {
+    uint64_t lo = 0, hi = 0;
+    bool operator==(const DedupKey &o) const { return lo == o.lo && hi == o.hi; }
+};
+
+struct DedupKeyHash {
+    size_t operator()(const DedupKey &k) const { return static_cast<size_t>(k.lo); }
+};
+
+// Streaming hash for dedup keys. Bytes may arrive in any number of pieces and the same byte
+// sequence hashes the same however it is split, so keys are hashed straight from field spans.
+class KeyHasher {
+public:
+    void add(std::string_view s) {
+        length_ += s.size();
+        size_t i = 0;
+        for (; pending_ > 0 && pending_ < 8 && i < s.size(); ++i)
+            word_ |= uint64_t(static_cast<unsigned char>(s[i])) << (8 * pending_++);
+        if (pending_ == 8) {
+            mix(word_);
+            word_ = 0;
+            pending_ = 0;
+        }
+        for (; i + 8 <= s.size(); i += 8) mix(simd::load8(s.data() + i, 8));
+        for (; i < s.size(); ++i) word_ |= uint64_t(static_cast<unsigned char>(s[i])) << (8 * pending_++);
     }
-    if (!valid) return "";
 
-    // Domain filtering
-    std::string emailDomain = extractEmailDomain(login);
-    if (!checkDomain(emailDomain, config.email_remove, config.email_contains))
-        return "";
-    if ((!config.url_remove.empty() || !config.url_contains.empty()) && !url.empty()) {
-        std::string urlDomain = extractUrlDomain(url);
-        if (!checkDomain(urlDomain, config.url_remove, config.url_contains))
-            return "";
+    DedupKey finish() {
+        if (pending_ > 0) mix(word_);
+        DedupKey key;
+        key.lo = avalanche(a_ ^ length_);
+        key.hi = avalanche(b_ + length_ * 0x9E3779B97F4A7C15ull);
+        return key;
     }
 
-    // Custom regex filter
-    if (!config.custom_filter.empty()) {
-        std::regex customReg(config.custom_filter, std::regex::icase);
-        if (!std::regex_search(line, customReg))
-            return "";
+private:
+    // Two independent lanes, each a bijection of its state per word
+    void mix(uint64_t w) {
+        a_ = (a_ ^ w) * 0x9E3779B97F4A7C15ull;
+        a_ ^= a_ >> 32;
+        b_ += w;
+        b_ = ((b_ << 31) | (b_ >> 33)) * 0xC2B2AE3D27D4EB4Full;
     }
 
-    // Build output based on convert_format
-    std::string output_line;
-    const std::string &cf = config.convert_format;
-    auto idxTokens = split(cf, config.separator);
+    static uint64_t avalanche(uint64_t h) {
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ull;
+        return h ^ (h >> 33);
+    }
 
-    // Detect numeric convert_format like "1", "2:3", etc.
-    bool isNumericFormat = !idxTokens.empty();
-    for (auto &str : idxTokens) {
-        if (str.empty() || !std::all_of(str.begin(), str.end(), ::isdigit)) {
-            isNumericFormat = false;
-            break;
+    uint64_t a_ = 0x243F6A8885A308D3ull, b_ = 0x13198A2E03707344ull;
+    uint64_t word_ = 0, length_ = 0;
+    unsigned pending_ = 0;
+};
+
+// A block of whole input lines handed from the producer to a worker
+struct Chunk {
+    uint64_t seq = 0;                   // consecutive across all input files of a run
+    uint64_t file = 0;                  // index of the input file
+    uint64_t endOffset = 0;             // file offset just past data
+    std::string data;
+};
+
+// Accepted lines of one chunk, grouped by profile, handed from a worker to the writer. Every chunk
+// yields a batch, empty or not, and each file ends with one more (endOfFile), so the writer sees
+// every sequence number.
+struct OutputBatch {
+    uint64_t seq = 0;
+    uint64_t file = 0;                  // input position the batch completes: file, and offset in it
+    uint64_t endOffset = 0;
+    bool endOfFile = false;
+    std::string path;                   // end-of-file batches: the input file
+    std::vector<std::vector<std::string>> lines;    // indexed like Config::profiles
+    std::vector<std::vector<std::string>> buckets;  // bucket file of each line, bucketed profiles only
+    std::vector<std::vector<DedupKey>> keys;        // ordered_output: keys the writer deduplicates or holds
+};
+
+// A record held back by dedup_policy=last or count until its file ends
+struct HeldRecord {
+    uint64_t position = 0;              // chunk seq << 32 | line in chunk, of the kept occurrence
+    uint64_t count = 0;
+    std::string line, bucket;
+};
+
+static std::mutex duplicate_mutex;
+static std::vector<std::unordered_set<DedupKey, DedupKeyHash>> global_duplicates;  // one set per profile
+static std::vector<std::unordered_map<DedupKey, HeldRecord, DedupKeyHash>> held_records;
+static std::atomic<unsigned long long> processedCount{0};
+
+// Progress of a run as of the last batch the writer finished: the input position everything
+// before has been written for, and the output behind it. checkpoint_file saves it with the dedup
+// state; --resume loads it.
+struct Checkpoint {
+    uint64_t configHash = 0;
+    std::vector<std::string> inputFiles;
+    uint64_t file = 0, offset = 0;      // next input byte: inputFiles[file] at offset
+    uint64_t position = 0;              // ordered_output: input position of the next held record
+    std::vector<uint64_t> outputSizes;  // per profile; bucketed profiles use bucketSizes
+    std::vector<std::vector<std::pair<std::string, uint64_t>>> bucketSizes;
+};
+static Checkpoint runState;
+
+// ordered_output: workers may run at most WINDOW chunks ahead of the next one the writer needs,
+// which bounds the batches the writer holds back to reorder. The worker with the needed chunk
+// never waits.
+class ReorderWindow {
+public:
+    static constexpr uint64_t WINDOW = 64;
+    void waitFor(uint64_t seq) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_.wait(lock, [&] { return seq < next_ + WINDOW; });
+    }
+    void advance(uint64_t next) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        next_ = next;
+        cond_.notify_all();
+    }
+private:
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    uint64_t next_ = 0;
+};
+static ReorderWindow reorderWindow;
+static ThreadSafeQueue<Chunk> inputQueue;
+static ThreadSafeQueue<OutputBatch> outputQueue;
+
+// Reasons a line can be dropped, exported as ulp_rejected_lines_total{reason=...}.
+// Reasons from REJECT_EMAIL_DOMAIN on are decided per profile.
+enum RejectReason {
+    REJECT_EMPTY,
+    REJECT_MALFORMED,
+    REJECT_INVALID_EMAIL,
+    REJECT_PHONE,
+    REJECT_EMAIL_DOMAIN,
+    REJECT_URL_DOMAIN,
+    REJECT_CUSTOM_FILTER,
+    REJECT_DUPLICATE,
+    REJECT_COUNT
+};
+static const char *const rejectReasonNames[REJECT_COUNT] = {
+    "empty", "malformed", "invalid_email", "phone",
+    "email_domain", "url_domain", "custom_filter", "duplicate"
+};
+
+// Pipeline stages timed by the latency histograms
+enum Stage {
+    STAGE_READ,
+    STAGE_PROCESS,
+    STAGE_DEDUP,
+    STAGE_WRITE,
+    STAGE_COUNT
+};
+static const char *const stageNames[STAGE_COUNT] = { "read", "process", "dedup", "write" };
+
+// Lock-free fixed-bucket histogram of batch latencies
+class LatencyHistogram {
+public:
+    static constexpr size_t BUCKETS = 10;
+    static constexpr double bounds[BUCKETS] = {
+        0.00001, 0.00005, 0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05, 0.1, 1.0
+    };
+    void observe(std::chrono::steady_clock::duration d) {
+        double seconds = std::chrono::duration<double>(d).count();
+        size_t i = 0;
+        while (i < BUCKETS && seconds > bounds[i]) ++i;
+        counts_[i].fetch_add(1, std::memory_order_relaxed);
+        sumNanos_.fetch_add(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()),
+            std::memory_order_relaxed);
+    }
+    void render(std::ostringstream &out, const char *name, const char *stage) const {
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i <= BUCKETS; ++i) {
+            cumulative += counts_[i].load(std::memory_order_relaxed);
+            out << name << "_bucket{stage=\"" << stage << "\",le=\"";
+            if (i < BUCKETS) out << bounds[i]; else out << "+Inf";
+            out << "\"} " << cumulative << "\n";
         }
+        out << name << "_sum{stage=\"" << stage << "\"} "
+            << sumNanos_.load(std::memory_order_relaxed) / 1e9 << "\n";
+        out << name << "_count{stage=\"" << stage << "\"} " << cumulative << "\n";
     }
-    if (isNumericFormat) {
-        std::vector<std::string> outParts;
-        for (auto &idxStr : idxTokens) {
-            int idx = std::stoi(idxStr) - 1;
+private:
+    std::atomic<uint64_t> counts_[BUCKETS + 1] = {};
+    std::atomic<uint64_t> sumNanos_{0};
+};
+
+// Routing outcomes of one profile
+struct ProfileMetrics {
+    std::string name;
+    std::atomic<uint64_t> accepted{0};
+    std::atomic<uint64_t> buckets{0};
+    std::atomic<uint64_t> bucketFileOpens{0};
+    std::atomic<uint64_t> rejected[REJECT_COUNT] = {};
+};
+
+// Run-wide counters; unlike processedCount these are never reset between files.
+// Totals add up every profile, so a line routed to three profiles can count three times.
+struct Metrics {
+    std::atomic<uint64_t> filesProcessed{0};
+    std::atomic<uint64_t> duplicateFiles{0};
+    std::atomic<uint64_t> duplicateBytes{0};
+    std::atomic<uint64_t> linesRead{0};
+    std::atomic<uint64_t> bytesRead{0};
+    std::atomic<uint64_t> linesAccepted{0};
+    std::atomic<uint64_t> linesWritten{0};
+    std::atomic<uint64_t> reorderPending{0};
+    std::atomic<uint64_t> rejected[REJECT_COUNT] = {};
+    LatencyHistogram stages[STAGE_COUNT];
+    std::vector<ProfileMetrics> profiles;    // sized by initProfiles before any worker starts
+
+    void initProfiles(const Config &config) {
+        profiles = std::vector<ProfileMetrics>(config.profiles.size());
+        for (size_t i = 0; i < profiles.size(); ++i) profiles[i].name = config.profiles[i].name;
+    }
+    void reject(RejectReason reason) {
+        rejected[reason].fetch_add(1, std::memory_order_relaxed);
+    }
+    void reject(size_t profile, RejectReason reason) {
+        reject(reason);
+        profiles[profile].rejected[reason].fetch_add(1, std::memory_order_relaxed);
+    }
+    void accept(size_t profile, uint64_t lines) {
+        linesAccepted.fetch_add(lines, std::memory_order_relaxed);
+        profiles[profile].accepted.fetch_add(lines, std::memory_order_relaxed);
+    }
+};
+static Metrics metrics;
+
+#ifndef ULP_NO_MAIN    // metrics export and input discovery serve main only
+// Resident set size of this process in bytes, 0 where unsupported
+static uint64_t residentMemoryBytes() {
+#if defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    uint64_t sizePages = 0, residentPages = 0;
+    if (statm >> sizePages >> residentPages)
+        return residentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    return 0;
+#elif defined(__APPLE__)
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+                  reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS)
+        return info.resident_size;
+    return 0;
+#else
+    return 0;
+#endif
+}
+
+// Render all metrics in the Prometheus text exposition format
+static std::string renderMetrics() {
+    std::ostringstream out;
+    auto header = [&](const char *name, const char *type, const char *help) {
+        out << "# HELP " << name << " " << help << "\n"
+            << "# TYPE " << name << " " << type << "\n";
+    };
+    header("ulp_files_processed_total", "counter", "Input files fully processed.");
+    out << "ulp_files_processed_total " << metrics.filesProcessed.load() << "\n";
+    header("ulp_duplicate_files_skipped_total", "counter", "Input files skipped as copies of earlier ones.");
+    out << "ulp_duplicate_files_skipped_total " << metrics.duplicateFiles.load() << "\n";
+    header("ulp_duplicate_bytes_skipped_total", "counter", "Bytes in input files skipped as copies.");
+    out << "ulp_duplicate_bytes_skipped_total " << metrics.duplicateBytes.load() << "\n";
+    header("ulp_lines_read_total", "counter", "Lines read from input files.");
+    out << "ulp_lines_read_total " << metrics.linesRead.load() << "\n";
+    header("ulp_bytes_read_total", "counter", "Bytes read from input files.");
+    out << "ulp_bytes_read_total " << metrics.bytesRead.load() << "\n";
+    header("ulp_lines_accepted_total", "counter", "Lines that passed all filters and dedup.");
+    out << "ulp_lines_accepted_total " << metrics.linesAccepted.load() << "\n";
+    header("ulp_lines_written_total", "counter", "Lines written to the output file.");
+    out << "ulp_lines_written_total " << metrics.linesWritten.load() << "\n";
+    header("ulp_rejected_lines_total", "counter", "Lines dropped, by reason.");
+    for (size_t i = 0; i < REJECT_COUNT; ++i)
+        out << "ulp_rejected_lines_total{reason=\"" << rejectReasonNames[i] << "\"} "
+            << metrics.rejected[i].load() << "\n";
+    header("ulp_profile_lines_accepted_total", "counter", "Lines a profile accepted after its filters and dedup.");
+    for (const auto &p : metrics.profiles)
+        out << "ulp_profile_lines_accepted_total{profile=\"" << p.name << "\"} " << p.accepted.load() << "\n";
+    header("ulp_profile_rejected_lines_total", "counter", "Lines a profile dropped, by reason.");
+    for (const auto &p : metrics.profiles)
+        for (size_t i = REJECT_EMAIL_DOMAIN; i < REJECT_COUNT; ++i)
+            out << "ulp_profile_rejected_lines_total{profile=\"" << p.name << "\",reason=\""
+                << rejectReasonNames[i] << "\"} " << p.rejected[i].load() << "\n";
+    header("ulp_profile_buckets", "gauge", "Bucket files a bucketed profile has written.");
+    for (const auto &p : metrics.profiles)
+        out << "ulp_profile_buckets{profile=\"" << p.name << "\"} " << p.buckets.load() << "\n";
+    header("ulp_profile_bucket_file_opens_total", "counter",
+           "Bucket file opens; far above ulp_profile_buckets means max_open_buckets is too small.");
+    for (const auto &p : metrics.profiles)
+        out << "ulp_profile_bucket_file_opens_total{profile=\"" << p.name << "\"} "
+            << p.bucketFileOpens.load() << "\n";
+    header("ulp_stage_duration_seconds", "histogram", "Latency of one batch in each pipeline stage.");
+    for (size_t i = 0; i < STAGE_COUNT; ++i)
+        metrics.stages[i].render(out, "ulp_stage_duration_seconds", stageNames[i]);
+    header("ulp_queue_depth", "gauge", "Items currently waiting in each queue.");
+    out << "ulp_queue_depth{queue=\"input\"} " << inputQueue.size() << "\n";
+    out << "ulp_queue_depth{queue=\"output\"} " << outputQueue.size() << "\n";
+    out << "ulp_queue_depth{queue=\"reorder\"} " << metrics.reorderPending.load() << "\n";
+    size_t dedupEntries = 0, dedupBuckets = 0;
+    {
+        std::lock_guard<std::mutex> lock(duplicate_mutex);
+        for (const auto &set : global_duplicates) {
+            dedupEntries += set.size();
+            dedupBuckets += set.bucket_count();
+        }
+        for (const auto &held : held_records) {
+            dedupEntries += held.size();
+            dedupBuckets += held.bucket_count();
+        }
+    }
+    header("ulp_dedup_entries", "gauge", "Entries in the global dedup sets for the current file, or the whole run under --watch and --serve.");
+    out << "ulp_dedup_entries " << dedupEntries << "\n";
+    header("ulp_dedup_buckets", "gauge", "Hash buckets allocated by the global dedup sets.");
+    out << "ulp_dedup_buckets " << dedupBuckets << "\n";
+    header("ulp_simd_info", "gauge", "SIMD kernel variant selected at startup.");
+    out << "ulp_simd_info{isa=\"" << simd::kernels().name << "\"} 1\n";
+    header("ulp_resident_memory_bytes", "gauge", "Resident set size of the process.");
+    out << "ulp_resident_memory_bytes " << residentMemoryBytes() << "\n";
+    return out.str();
+}
+
+// Rewrite the textfile-collector file atomically (write temp, then rename)
+static void writeMetricsFile(const std::string &path) {
+    const std::string tmp = path + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::trunc);
+        if (!out) {
+            std::cerr << "\nCannot write metrics file: " << tmp << "\n";
+            return;
+        }
+        out << renderMetrics();
+    }
+    std::error_code ec;
+    fs::rename(tmp, path, ec);
+    if (ec) std::cerr << "\nCannot replace metrics file " << path << ": " << ec.message() << "\n";
+}
+
+#ifndef _WIN32
+// Serve GET /metrics on 127.0.0.1:port until stop is set
+static void metricsServer(unsigned port, std::atomic<bool> &stop) {
+    int listenFd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        std::cerr << "\nCannot create metrics socket\n";
+        return;
+    }
+    int yes = 1;
+    ::setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (::bind(listenFd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0 ||
+        ::listen(listenFd, 16) < 0) {
+        std::cerr << "\nCannot listen on 127.0.0.1:" << port << " for metrics\n";
+        ::close(listenFd);
+        return;
+    }
+    while (!stop.load()) {
+        pollfd pfd{listenFd, POLLIN, 0};
+        if (::poll(&pfd, 1, 200) <= 0) continue;
+        int client = ::accept(listenFd, nullptr, nullptr);
+        if (client < 0) continue;
+        // An idle or slow client must not hold up later scrapes or shutdown
+        timeval timeout{};
+        timeout.tv_sec = 2;
+        ::setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        ::setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        char request[1024];
+        ssize_t n = ::recv(client, request, sizeof(request) - 1, 0);
+        std::string firstLine = n > 0 ? std::string(request, static_cast<size_t>(n)) : "";
+        firstLine = firstLine.substr(0, firstLine.find('\r'));
+        std::string body, status = "200 OK";
+        if (firstLine.rfind("GET /metrics ", 0) == 0 || firstLine.rfind("GET / ", 0) == 0) {
+            body = renderMetrics();
+        } else {
+            status = "404 Not Found";
+            body = "Not found\n";
+        }
+        std::string response = "HTTP/1.1 " + status + "\r\n"
+            "Content-Type: text/plain; version=0.0.4\r\n"
+            "Content-Length: " + std::to_string(body.size()) + "\r\n"
+            "Connection: close\r\n\r\n" + body;
+        const char *p = response.data();
+        size_t left = response.size();
+        while (left > 0) {
+            ssize_t sent = ::send(client, p, left, 0);
+            if (sent <= 0) break;
+            p += sent;
+            left -= static_cast<size_t>(sent);
+        }
+        ::close(client);
+    }
+    ::close(listenFd);
+}
+#endif
+
+// Periodically refresh the metrics textfile until stop is set, then write a final snapshot
+static void metricsFileWriter(const std::string &path, unsigned intervalSeconds, std::atomic<bool> &stop) {
+    auto interval = std::chrono::seconds(intervalSeconds == 0 ? 1 : intervalSeconds);
+    auto next = std::chrono::steady_clock::now();
+    while (!stop.load()) {
+        if (std::chrono::steady_clock::now() >= next) {
+            writeMetricsFile(path);
+            next += interval;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+    writeMetricsFile(path);
+}
+
+// Convert wildcard pattern to regex
+static std::regex wildcardToRegex(const std::string &pattern) {
+    std::string regexPattern;
+    for (char ch : pattern) {
+        switch (ch) {
+            case '*': regexPattern += ".*";  break;
+            case '?': regexPattern += ".";   break;
+            case '.': regexPattern += "\\."; break;
+            default:  regexPattern.push_back(ch); break;
+        }
+    }
+    return std::regex(regexPattern, std::regex::icase);
+}
+
+// Recursively find files matching pattern
+static std::vector<std::string> getFiles(const std::string &pattern) {
+    std::vector<std::string> files;
+    std::regex r = wildcardToRegex(pattern);
+    fs::path base = fs::current_path();
+    for (auto &p : fs::recursive_directory_iterator(base)) {
+        if (p.is_regular_file()) {
+            std::string fname = p.path().filename().string();
+            if (std::regex_match(fname, r))
+                files.push_back(p.path().string());
+        }
+    }
+    return files;
+}
+#endif // ULP_NO_MAIN
+
+// Marks an '@' count the caller did not compute
+static constexpr size_t UNKNOWN_COUNT = static_cast<size_t>(-1);
+
+// Fields of one input line, parsed and validated once and then routed through every profile
+struct ParsedLine {
+    const std::string *line = nullptr;
+    const std::vector<std::string> *tokens = nullptr;
+    std::string url, login, pass;
+    std::string_view emailDomain;       // view into login, or into canonicalLogin when that is set
+    std::string canonicalLogin;         // login under canonicalize_email, else empty
+    std::string_view urlDomain;         // view into url, extracted on first use
+    bool urlDomainParsed = false;
+    std::vector<std::string> idnTokens; // the line and fields with normalize_idn rewrites applied
+    std::string idnLine, idnHost;
+};
+
+// Rewrite field[begin, end) to its canonical ASCII domain form if it is an internationalized
+// domain; true if the field changed
+static bool normalizeHost(std::string &field, size_t begin, size_t end, std::string &scratch) {
+    std::string_view host(field.data() + begin, end - begin);
+    if (!idn::needsAscii(host) || !idn::toAscii(host, scratch) || scratch == host) return false;
+    field.replace(begin, end - begin, scratch);
+    return true;
+}
+
+// normalize_idn: rewrite the email domain and the URL host of a split line to lowercase punycode
+// so Unicode and xn-- spellings of a domain filter and deduplicate alike. Passwords and other
+// fields are left alone. True if anything changed; then parsed.idnTokens/idnLine hold the result.
+static bool normalizeIdnLine(const std::string &line, const std::vector<std::string> &tokens,
+                             const Config &config, ParsedLine &parsed) {
+    const bool withUrl = config.format == "url:email:pass";
+    if (tokens.size() < (withUrl ? 3u : 2u) || !idn::mayContainIdn(line)) return false;
+    const size_t loginIndex = withUrl ? tokens.size() - 2 : 0;
+    bool changed = false;
+    auto &fields = parsed.idnTokens;
+    auto field = [&](size_t i) -> std::string & {
+        if (!changed) fields = tokens;
+        return fields[i];
+    };
+    const std::string &login = tokens[loginIndex];
+    size_t at = login.rfind('@');
+    size_t end = login.find_last_not_of(" \t\r\n");
+    if (at != std::string::npos && end != std::string::npos && end > at &&
+        idn::needsAscii(std::string_view(login).substr(at + 1, end - at))) {
+        std::string copy = login;
+        if (normalizeHost(copy, at + 1, end + 1, parsed.idnHost)) {
+            field(loginIndex) = std::move(copy);
+            changed = true;
+        }
+    }
+    // The URL host follows the first "//" (the separator may have split the scheme off into a
+    // field of its own), or opens the first field when the URL has no scheme
+    if (withUrl) {
+        size_t hostField = 0, begin = std::string::npos;
+        for (size_t i = 0; i < loginIndex && begin == std::string::npos; ++i) {
+            size_t slashes = tokens[i].find("//");
+            if (slashes != std::string::npos) {
+                hostField = i;
+                begin = slashes + 2;
+            }
+        }
+        if (begin == std::string::npos) begin = tokens[0].find_first_not_of(" \t");
+        const std::string &text = tokens[hostField];
+        size_t stop = begin == std::string::npos ? begin : text.find_first_of("/?#: \t\r", begin);
+        if (stop == std::string::npos) stop = text.size();
+        if (begin != std::string::npos && idn::needsAscii(std::string_view(text).substr(begin, stop - begin))) {
+            std::string copy = text;
+            if (normalizeHost(copy, begin, stop, parsed.idnHost)) {
+                field(hostField) = std::move(copy);
+                changed = true;
+            }
+        }
+    }
+    if (changed) parsed.idnLine = join(fields, config.separator);
+    return changed;
+}
+
+// Parse and validate a line already split on config.separator; atCount is the number of '@' in
+// the line when the caller's structural index knows it, letting '@'-less lines skip the email regex
+static bool parseLine(const std::string &rawLine, const std::vector<std::string> &rawTokens,
+                      size_t atCount, const Config &config, ParsedLine &parsed) {
+    if (rawLine.empty()) {
+        metrics.reject(REJECT_EMPTY);
+        return false;
+    }
+    const bool rewritten = config.normalize_idn && normalizeIdnLine(rawLine, rawTokens, config, parsed);
+    const std::string &line = rewritten ? parsed.idnLine : rawLine;
+    const std::vector<std::string> &tokens = rewritten ? parsed.idnTokens : rawTokens;
+    parsed.line = &line;
+    parsed.tokens = &tokens;
+    parsed.url.clear();
+    parsed.urlDomain = std::string_view();
+    parsed.urlDomainParsed = false;
+    bool valid = false;
+
+    // Parse based on input format
+    if (config.format == "url:email:pass") {
+        if (tokens.size() < 3) {
+            metrics.reject(REJECT_MALFORMED);
+            return false;
+        }
+        parsed.login = trim(tokens[tokens.size() - 2]);
+        parsed.pass  = trim(tokens[tokens.size() - 1]);
+        parsed.url   = trim(join(
+                           std::vector<std::string>(tokens.begin(), tokens.end() - 2),
+                           config.separator));
+        valid = true;
+
+    } else if (config.format == "email:pass") {
+        if (tokens.size() < 2) {
+            metrics.reject(REJECT_MALFORMED);
+            return false;
+        }
+        parsed.login = trim(tokens[0]);
+        parsed.pass  = trim(tokens[1]);
+        valid = true;
+    }
+    if (!valid) {
+        metrics.reject(REJECT_MALFORMED);
+        return false;
+    }
+    if (atCount == 0 || !isValidEmail(parsed.login, config.normalize_idn, config.canonicalize_email)) {
+        metrics.reject(REJECT_INVALID_EMAIL);
+        return false;
+    }
+    if (isPhoneNumber(parsed.login)) {
+        metrics.reject(REJECT_PHONE);
+        return false;
+    }
+    if (config.canonicalize_email) {
+        canonicalEmail(parsed.login, parsed.canonicalLogin);
+        parsed.emailDomain = extractEmailDomain(parsed.canonicalLogin);
+    } else {
+        parsed.emailDomain = extractEmailDomain(parsed.login);
+    }
+    return true;
+}
+
+// Hash of a routed line's dedup key, taken straight from the field spans: the profile's dedup_key
+// projection, else the output line, whose login starts at loginAt (npos if it has none). The login
+// enters the key in canonical form under canonicalize_email.
+static DedupKey dedupKey(const ParsedLine &parsed, const Profile &profile, std::string_view output,
+                         size_t loginAt, int loginIndex) {
+    const std::string &login = parsed.canonicalLogin.empty() ? parsed.login : parsed.canonicalLogin;
+    KeyHasher hasher;
+    if (profile.dedupFields.empty()) {
+        if (loginAt == std::string::npos) {
+            hasher.add(output);
+        } else {
+            hasher.add(output.substr(0, loginAt));
+            hasher.add(login);
+            hasher.add(output.substr(loginAt + parsed.login.size()));
+        }
+        return hasher.finish();
+    }
+    const std::vector<std::string> &tokens = *parsed.tokens;
+    for (int field : profile.dedupFields) {
+        if (field == DEDUP_URL)                                hasher.add(parsed.url);
+        else if (field == DEDUP_EMAIL || field == loginIndex)  hasher.add(login);
+        else if (field == DEDUP_PASS)                          hasher.add(parsed.pass);
+        else if (field < static_cast<int>(tokens.size()))      hasher.add(trimView(tokens[field]));
+        hasher.add("\n");             // cannot occur inside a field, so fields never run together
+    }
+    return hasher.finish();
+}
+
+// Apply one profile's filters and convert_format to a parsed line; false if the profile drops it.
+// key receives the hash of the line's dedup key.
+static bool routeLine(ParsedLine &parsed, const Profile &profile, size_t profileIndex,
+                      const Config &config, std::string &output_line, DedupKey &key) {
+    // Domain filtering
+    if (!checkDomain(parsed.emailDomain, profile.email_remove, profile.email_contains) ||
+        !checkSuffix(parsed.emailDomain, profile.email_suffix_remove, profile.email_suffix_contains)) {
+        metrics.reject(profileIndex, REJECT_EMAIL_DOMAIN);
+        return false;
+    }
+    if ((!profile.url_remove.empty() || !profile.url_contains.empty() ||
+         !profile.url_suffix_remove.empty() || !profile.url_suffix_contains.empty()) && !parsed.url.empty()) {
+        if (!parsed.urlDomainParsed) {
+            parsed.urlDomain = extractUrlDomain(parsed.url, config.normalize_idn);
+            parsed.urlDomainParsed = true;
+        }
+        if (!checkDomain(parsed.urlDomain, profile.url_remove, profile.url_contains) ||
+            !checkSuffix(parsed.urlDomain, profile.url_suffix_remove, profile.url_suffix_contains)) {
+            metrics.reject(profileIndex, REJECT_URL_DOMAIN);
+            return false;
+        }
+    }
+
+    // Custom regex filter
+    const std::string &line = *parsed.line;
+    if (profile.hasCustomFilter && !std::regex_search(line, profile.customRegex)) {
+        metrics.reject(profileIndex, REJECT_CUSTOM_FILTER);
+        return false;
+    }
+
+    // Build output based on convert_format
+    const std::vector<std::string> &tokens = *parsed.tokens;
+    const std::string &cf = profile.convert_format;
+    const int loginIndex = config.format == "url:email:pass" ? static_cast<int>(tokens.size()) - 2 : 0;
+    size_t loginAt = std::string::npos;     // where parsed.login starts in output_line
+    auto wholeLine = [&] {
+        output_line = line;
+        loginAt = tokens[loginIndex].find_first_not_of(" \t\r\n");
+        for (int i = 0; i < loginIndex; ++i) loginAt += tokens[i].size() + config.separator.size();
+    };
+    if (!profile.convertColumns.empty()) {
+        output_line.clear();
+        bool first = true;
+        for (int idx : profile.convertColumns) {
             if (idx >= 0 && idx < static_cast<int>(tokens.size())) {
-                outParts.push_back(trim(tokens[idx]));
+                if (!first) output_line += config.separator;
+                if (idx == loginIndex && loginAt == std::string::npos) loginAt = output_line.size();
+                output_line += trim(tokens[idx]);
+                first = false;
             }
         }
-        output_line = join(outParts, config.separator);
 
     // Named convert_format when format="url:email:pass"
     } else if (cf == "email:pass" && config.format == "url:email:pass") {
-        output_line = login + config.separator + pass;
+        loginAt = 0;
+        output_line = parsed.login;
+        output_line += config.separator;
+        output_line += parsed.pass;
 
     // Named convert_format when format="email:pass"
     } else if (config.format == "email:pass") {
         if (cf == "email") {
-            output_line = login;
+            loginAt = 0;
+            output_line = parsed.login;
         } else if (cf == "pass") {
-            output_line = pass;
+            output_line = parsed.pass;
         } else {
-            output_line = line;
+            wholeLine();
         }
 
     } else {
-        output_line = line;
+        wholeLine();
+    }
+
+    key = dedupKey(parsed, profile, output_line, loginAt, loginIndex);
+    return !output_line.empty();
+}
+
+#ifndef ULP_NO_MAIN    // the pipeline and main; benches include this file for the helpers above
+
+static bool resident = false;           // --watch: dedup sets and the manifest carry over from file to file
+static bool following = false;          // --follow: the input file is read as it grows, until stopped
+static uint64_t chunkSeq = 0;           // next chunk sequence number, advanced by producer and flushHeldRecords
+
+// File name of the bucket a routed line belongs to under profile.bucket_by. Domains are lowercased
+// and reduced to [a-z0-9._-] so every bucket is a plain file inside bucket_dir.
+static void bucketName(const ParsedLine &parsed, const Profile &profile, std::string &name) {
+    if (profile.bucketMode == BUCKET_HASH) {
+        char buf[32];
+        const std::string &login = parsed.canonicalLogin.empty() ? parsed.login : parsed.canonicalLogin;
+        unsigned long long part = simd::hashIgnoreCase(login) % profile.bucketPartitions;
+        std::snprintf(buf, sizeof(buf), "part-%05llu.txt", part);
+        name = buf;
+        return;
+    }
+    std::string_view domain = profile.bucketMode == BUCKET_REGISTRABLE_DOMAIN
+                            ? registrableDomain(parsed.emailDomain) : parsed.emailDomain;
+    name.assign(domain.data(), domain.size());
+    simd::kernels().lowerAscii(&name[0], name.size());
+    for (char &c : name)
+        if (!((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '.' || c == '-' || c == '_')) c = '_';
+    if (name.empty() || name[0] == '.') name.insert(name.begin(), '_');
+    name += ".txt";
+}
+
+// dedup_policy=last/count: merge a chunk's routed lines into the profile's held records, keeping
+// the last or the first occurrence of each key by input position. Callers hold duplicate_mutex.
+static void holdRecords(size_t profileIndex, DedupPolicy policy, std::vector<std::string> &lines,
+                        std::vector<std::string> &buckets, const std::vector<DedupKey> &keys,
+                        const std::vector<uint64_t> &positions) {
+    auto &held = held_records[profileIndex];
+    for (size_t i = 0; i < lines.size(); ++i) {
+        auto inserted = held.try_emplace(keys[i]);
+        HeldRecord &record = inserted.first->second;
+        ++record.count;
+        if (!inserted.second) {
+            metrics.reject(profileIndex, REJECT_DUPLICATE);
+            if (policy == DEDUP_LAST ? positions[i] < record.position : positions[i] > record.position) continue;
+        }
+        record.position = positions[i];
+        record.line = std::move(lines[i]);
+        if (!buckets.empty()) record.bucket = std::move(buckets[i]);
+    }
+}
+
+// Move each key's kept record under dedup_policy=last/count into batch, in input order; count
+// appends the number of occurrences as a last field. Callers hold duplicate_mutex.
+static void releaseHeldRecords(const Config &config, OutputBatch &batch) {
+    const size_t profileCount = config.profiles.size();
+    size_t accepted = 0;
+    for (size_t p = 0; p < profileCount; ++p) {
+        auto &held = held_records[p];
+        if (held.empty()) continue;
+        const Profile &profile = config.profiles[p];
+        std::vector<HeldRecord *> order;
+        order.reserve(held.size());
+        for (auto &entry : held) order.push_back(&entry.second);
+        std::sort(order.begin(), order.end(),
+                  [](const HeldRecord *a, const HeldRecord *b) { return a->position < b->position; });
+        for (HeldRecord *record : order) {
+            if (profile.dedupPolicy == DEDUP_COUNT) record->line += config.separator + std::to_string(record->count);
+            batch.lines[p].push_back(std::move(record->line));
+            if (profile.bucketMode != BUCKET_NONE) batch.buckets[p].push_back(std::move(record->bucket));
+        }
+        metrics.accept(p, order.size());
+        accepted += order.size();
+        held.clear();
+    }
+    processedCount += accepted;
+}
+
+// End of input file number file, at path, read up to endOffset: hand the writer the file's
+// end-of-file batch. Unordered it carries the held records; ordered, the writer releases them
+// itself once it has merged the file's last chunk.
+static void flushHeldRecords(const Config &config, uint64_t file, const std::string &path, uint64_t endOffset) {
+    const size_t profileCount = config.profiles.size();
+    OutputBatch batch;
+    batch.seq = chunkSeq++;
+    batch.file = file;
+    batch.endOffset = endOffset;
+    batch.endOfFile = true;
+    batch.path = path;
+    batch.lines.resize(profileCount);
+    batch.buckets.resize(profileCount);
+    batch.keys.resize(profileCount);
+    if (!config.ordered_output) {
+        std::lock_guard<std::mutex> lock(duplicate_mutex);
+        releaseHeldRecords(config, batch);
+    }
+    outputQueue.push(std::move(batch));
+}
+
+static const char CHECKPOINT_MAGIC[8] = { 'U', 'L', 'P', 'C', 'K', 'P', 'T', '\n' };
+static constexpr uint64_t CHECKPOINT_VERSION = 1;
+
+// Checkpoint fields: native-endian 64-bit integers and length-prefixed strings
+static void putU64(std::ostream &out, uint64_t v) {
+    out.write(reinterpret_cast<const char *>(&v), sizeof(v));
+}
+static void putString(std::ostream &out, const std::string &s) {
+    putU64(out, s.size());
+    out.write(s.data(), static_cast<std::streamsize>(s.size()));
+}
+static uint64_t getU64(std::istream &in) {
+    uint64_t v = 0;
+    in.read(reinterpret_cast<char *>(&v), sizeof(v));
+    return v;
+}
+static std::string getString(std::istream &in) {
+    uint64_t n = getU64(in);
+    if (!in || n > (1u << 30)) {
+        in.setstate(std::ios::failbit);
+        return std::string();
+    }
+    std::string s(static_cast<size_t>(n), '\0');
+    in.read(&s[0], static_cast<std::streamsize>(n));
+    return s;
+}
+
+// Fingerprint of config.ini, so --resume refuses a checkpoint taken under other settings
+static uint64_t configFingerprint(const std::string &filename) {
+    std::ifstream in(filename, std::ios::binary);
+    std::ostringstream text;
+    text << in.rdbuf();
+    KeyHasher hasher;
+    hasher.add(text.str());
+    return hasher.finish().lo;
+}
+
+// Save runState with the dedup sets and held records behind it. The file is written beside the
+// checkpoint and renamed over it, so a crash mid-write leaves the previous checkpoint intact.
+// Checkpoints imply ordered_output, under which only the writer thread, the caller, changes the
+// sets and held records, so they are read without duplicate_mutex: workers and metrics scrapes
+// never wait on a checkpoint, though workers stall once the reorder window fills behind it.
+static void writeCheckpoint(const Config &config) {
+    const std::string &path = config.checkpoint_file;
+    const std::string temp = path + ".tmp";
+    std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+    out.write(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    putU64(out, CHECKPOINT_VERSION);
+    putU64(out, runState.configHash);
+    putU64(out, runState.inputFiles.size());
+    for (const auto &file : runState.inputFiles) putString(out, file);
+    putU64(out, runState.file);
+    putU64(out, runState.offset);
+    putU64(out, runState.position);
+    putU64(out, config.profiles.size());
+    for (size_t p = 0; p < config.profiles.size(); ++p) {
+        putU64(out, runState.outputSizes[p]);
+        putU64(out, runState.bucketSizes[p].size());
+        for (const auto &bucket : runState.bucketSizes[p]) {
+            putString(out, bucket.first);
+            putU64(out, bucket.second);
+        }
+        putU64(out, global_duplicates[p].size());
+        for (const DedupKey &key : global_duplicates[p]) {
+            putU64(out, key.lo);
+            putU64(out, key.hi);
+        }
+        putU64(out, held_records[p].size());
+        for (const auto &entry : held_records[p]) {
+            putU64(out, entry.first.lo);
+            putU64(out, entry.first.hi);
+            putU64(out, entry.second.position);
+            putU64(out, entry.second.count);
+            putString(out, entry.second.line);
+            putString(out, entry.second.bucket);
+        }
+    }
+    out.close();
+    std::error_code ec;
+    if (out) {
+        fs::rename(temp, path, ec);
+        if (ec) {   // Windows will not rename over an existing file
+            fs::remove(path, ec);
+            fs::rename(temp, path, ec);
+        }
+    }
+    if (!out || ec) {
+        std::cerr << "Cannot write checkpoint file: " << path << "\n";
+        std::exit(1);
+    }
+}
+
+// --resume: load runState, the dedup sets and the held records from the checkpoint
+static void readCheckpoint(const Config &config) {
+    const std::string &path = config.checkpoint_file;
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::cerr << "Cannot open checkpoint file: " << path << "\n";
+        std::exit(1);
+    }
+    char magic[sizeof(CHECKPOINT_MAGIC)] = {};
+    in.read(magic, sizeof(magic));
+    if (!in || std::memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) != 0 || getU64(in) != CHECKPOINT_VERSION) {
+        std::cerr << "Not a checkpoint of this ulp version: " << path << "\n";
+        std::exit(1);
+    }
+    if (getU64(in) != runState.configHash) {
+        std::cerr << "config.ini changed since checkpoint " << path << " was written; cannot resume\n";
+        std::exit(1);
+    }
+    runState.inputFiles.resize(static_cast<size_t>(std::min<uint64_t>(getU64(in), 1u << 24)));
+    for (auto &file : runState.inputFiles) file = getString(in);
+    runState.file = getU64(in);
+    runState.offset = getU64(in);
+    runState.position = getU64(in);
+    const size_t profileCount = config.profiles.size();
+    bool valid = static_cast<bool>(in) && getU64(in) == profileCount;
+    runState.outputSizes.assign(profileCount, 0);
+    runState.bucketSizes.assign(profileCount, {});
+    for (size_t p = 0; valid && p < profileCount; ++p) {
+        runState.outputSizes[p] = getU64(in);
+        for (uint64_t n = getU64(in); in && n > 0; --n) {
+            std::string name = getString(in);
+            runState.bucketSizes[p].emplace_back(std::move(name), getU64(in));
+        }
+        auto &set = global_duplicates[p];
+        uint64_t keys = getU64(in);
+        if (in) set.reserve(static_cast<size_t>(std::min<uint64_t>(keys, 1u << 28)));
+        for (; in && keys > 0; --keys) {
+            DedupKey key;
+            key.lo = getU64(in);
+            key.hi = getU64(in);
+            set.insert(key);
+        }
+        for (uint64_t n = getU64(in); in && n > 0; --n) {
+            DedupKey key;
+            key.lo = getU64(in);
+            key.hi = getU64(in);
+            HeldRecord &record = held_records[p][key];
+            record.position = getU64(in);
+            record.count = getU64(in);
+            record.line = getString(in);
+            record.bucket = getString(in);
+        }
+        valid = static_cast<bool>(in);
+    }
+    if (!valid || runState.file > runState.inputFiles.size()) {
+        std::cerr << "Corrupt checkpoint file: " << path << "\n";
+        std::exit(1);
+    }
+}
+
+// manifest_file: what an earlier run processed of each input file, keyed by absolute path. The
+// head and tail hashes sample the first and last MANIFEST_SAMPLE bytes of the processed prefix,
+// enough to tell a file that only grew from one that was rewritten.
+struct ManifestEntry {
+    uint64_t size = 0;                  // bytes processed
+    int64_t mtime = 0;
+    uint64_t head = 0, tail = 0;
+    bool newline = true;                // the processed prefix ended in '\n'
+};
+static constexpr uint64_t MANIFEST_SAMPLE = 64 * 1024;
+static std::map<std::string, ManifestEntry> manifest;
+static std::mutex manifest_mutex;       // the writer records files while --watch plans the next
+
+static std::string manifestKey(const std::string &path) {
+    std::error_code ec;
+    fs::path absolute = fs::absolute(path, ec);
+    return ec ? path : absolute.lexically_normal().string();
+}
+
+static int64_t modificationTime(const std::string &path) {
+    std::error_code ec;
+    auto time = fs::last_write_time(path, ec);
+    return ec ? 0 : static_cast<int64_t>(time.time_since_epoch().count());
+}
+
+// Hash the first and the last MANIFEST_SAMPLE bytes of path's first size bytes
+static bool sampleFile(const std::string &path, uint64_t size, uint64_t &head, uint64_t &tail) {
+    std::ifstream in(path, std::ios::binary);
+    std::string sample;
+    auto hashAt = [&](uint64_t offset, uint64_t &out) {
+        sample.resize(static_cast<size_t>(std::min(size - offset, MANIFEST_SAMPLE)));
+        in.seekg(static_cast<std::streamoff>(offset));
+        in.read(&sample[0], static_cast<std::streamsize>(sample.size()));
+        KeyHasher hasher;
+        hasher.add(sample);
+        out = hasher.finish().lo;
+        return static_cast<bool>(in);
+    };
+    return in && hashAt(0, head) && hashAt(size - std::min(size, MANIFEST_SAMPLE), tail);
+}
+
+static void loadManifest(const std::string &filename) {
+    std::ifstream in(filename);
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream fields(line);
+        ManifestEntry entry;
+        std::string path;
+        fields >> entry.size >> entry.mtime >> std::hex >> entry.head >> entry.tail >> std::dec >> entry.newline;
+        if (fields.get() == '\t' && std::getline(fields, path) && !path.empty()) manifest[path] = entry;
+    }
+}
+
+// Rewrite the manifest beside the old one and rename it over, like checkpoints
+static void saveManifest(const std::string &filename) {
+    const std::string temp = filename + ".tmp";
+    std::lock_guard<std::mutex> lock(manifest_mutex);
+    std::ofstream out(temp, std::ios::trunc);
+    out << "# ulp manifest: bytes processed, mtime, head and tail sample hashes, ends in newline, path\n";
+    for (const auto &entry : manifest)
+        out << entry.second.size << "\t" << entry.second.mtime << "\t" << std::hex << entry.second.head << "\t"
+            << entry.second.tail << std::dec << "\t" << entry.second.newline << "\t" << entry.first << "\n";
+    out.close();
+    std::error_code ec;
+    if (out) {
+        fs::rename(temp, filename, ec);
+        if (ec) {
+            fs::remove(filename, ec);
+            fs::rename(temp, filename, ec);
+        }
     }
+    if (!out || ec) {
+        std::cerr << "Cannot write manifest file: " << filename << "\n";
+        std::exit(1);
+    }
+}
+
+// Where processing of path should start given the manifest: 0 for a new or rewritten file, the old
+// end for one that only grew, UNCHANGED for one to skip. A file whose processed part ended without a
+// newline had its last line taken as complete; if it grew, that line may have too, so the file is
+// processed again from the start rather than from the middle of the line.
+static constexpr uint64_t UNCHANGED = static_cast<uint64_t>(-1);
+static uint64_t manifestStart(const std::string &path) {
+    ManifestEntry entry;
+    {
+        std::lock_guard<std::mutex> lock(manifest_mutex);
+        auto it = manifest.find(manifestKey(path));
+        if (it == manifest.end()) return 0;
+        entry = it->second;
+    }
+    std::error_code ec;
+    uint64_t size = fs::file_size(path, ec);
+    if (ec || size < entry.size) return 0;
+    if (size == entry.size && modificationTime(path) == entry.mtime) return UNCHANGED;
+    uint64_t head = 0, tail = 0;
+    if (!sampleFile(path, entry.size, head, tail) || head != entry.head || tail != entry.tail) return 0;
+    return size == entry.size ? UNCHANGED : entry.newline ? entry.size : 0;
+}
+
+// Record that path has been processed up to size
+static void recordManifest(const std::string &path, uint64_t size) {
+    ManifestEntry entry;
+    entry.size = size;
+    entry.mtime = modificationTime(path);
+    if (!sampleFile(path, size, entry.head, entry.tail)) return;
+    if (size > 0) {
+        std::ifstream in(path, std::ios::binary);
+        in.seekg(static_cast<std::streamoff>(size - 1));
+        entry.newline = in.get() == '\n';
+    }
+    std::lock_guard<std::mutex> lock(manifest_mutex);
+    manifest[manifestKey(path)] = entry;
+}
 
-    return output_line;
+// Hash a whole file in blocks
+static bool hashFile(const std::string &path, DedupKey &key) {
+    std::ifstream in(path, std::ios::binary);
+    std::string block(1 << 20, '\0');
+    KeyHasher hasher;
+    while (in) {
+        in.read(&block[0], static_cast<std::streamsize>(block.size()));
+        hasher.add(std::string_view(block.data(), static_cast<size_t>(in.gcount())));
+    }
+    key = hasher.finish();
+    return in.eof();
+}
+
+// skip_duplicate_files: for each input file, the index of an earlier file with the same content,
+// or SIZE_MAX. Files are grouped by size, then by sampled head and tail hashes, and only files
+// still sharing a group are hashed in full.
+static std::vector<size_t> findDuplicateFiles(const std::vector<std::string> &files) {
+    std::vector<size_t> original(files.size(), SIZE_MAX);
+    std::map<uint64_t, std::vector<size_t>> bySize;
+    for (size_t i = 0; i < files.size(); ++i) {
+        std::error_code ec;
+        uint64_t size = fs::file_size(files[i], ec);
+        if (!ec && size > 0) bySize[size].push_back(i);
+    }
+    for (const auto &group : bySize) {
+        if (group.second.size() < 2) continue;
+        std::map<std::pair<uint64_t, uint64_t>, std::vector<size_t>> bySample;
+        for (size_t i : group.second) {
+            uint64_t head = 0, tail = 0;
+            if (sampleFile(files[i], group.first, head, tail)) bySample[{ head, tail }].push_back(i);
+        }
+        for (const auto &candidates : bySample) {
+            if (candidates.second.size() < 2) continue;
+            std::map<std::pair<uint64_t, uint64_t>, size_t> first;
+            for (size_t i : candidates.second) {
+                DedupKey key;
+                if (!hashFile(files[i], key)) continue;
+                auto inserted = first.emplace(std::make_pair(key.lo, key.hi), i);
+                if (!inserted.second) original[i] = inserted.first->second;
+            }
+        }
+    }
+    return original;
 }
 
-// Worker thread: process batches of lines
+// Worker thread: index each chunk once, then tokenize its lines from the precomputed positions
 static void worker(const Config &config) {
-    std::unordered_set<std::string> localDuplicates;
-    std::vector<std::string> batch;
-    constexpr size_t BATCH_SIZE = 100;
-    while (true) {
-        batch.clear();
-        inputQueue.popBatch(batch, BATCH_SIZE);
-        if (batch.empty() && doneReading.load()) break;
-        for (const auto &line : batch) {
-            std::string processed = processLine(line, config);
-            if (!processed.empty()) {
-                if (!localDuplicates.insert(processed).second) continue;
-                {
+    const size_t profileCount = config.profiles.size();
+    std::vector<std::unordered_set<DedupKey, DedupKeyHash>> localDuplicates(profileCount);
+    std::vector<std::vector<std::string>> processed(profileCount), processedBuckets(profileCount);
+    std::vector<std::vector<DedupKey>> processedKeys(profileCount);
+    std::vector<std::vector<uint64_t>> processedPositions(profileCount);   // chunk seq << 32 | line
+    std::vector<std::string> tokens;
+    ParsedLine parsed;
+    DedupKey key;
+    std::string out, bucket;
+    std::vector<std::pair<uint32_t, uint32_t>> spans;
+    simd::StructuralIndex index;
+    const std::string &sep = config.separator;
+    const char needles[3] = { '\n', sep.empty() ? '\n' : sep[0], '@' };
+    Chunk chunk;
+    std::string line;
+    while (inputQueue.pop(chunk)) {
+        auto start = std::chrono::steady_clock::now();
+        const std::string &data = chunk.data;
+        index.build(data.data(), data.size(), needles, 3);
+        const auto &newlines = index.positions[0], &seps = index.positions[1], &ats = index.positions[2];
+        size_t si = 0, ai = 0, lines = 0;
+        uint32_t lineStart = 0;
+        for (size_t ni = 0; ni <= newlines.size(); ++ni) {
+            uint32_t lineEnd = ni < newlines.size() ? newlines[ni] : static_cast<uint32_t>(data.size());
+            if (ni == newlines.size() && lineStart == lineEnd) break;
+            ++lines;
+
+            // Field boundaries come from separator positions; multi-byte separators are verified
+            // and matched leftmost-first without overlap, exactly like split()
+            spans.clear();
+            uint32_t fieldStart = lineStart;
+            for (; si < seps.size() && seps[si] < lineEnd; ++si) {
+                uint32_t pos = seps[si];
+                if (sep.empty() || pos < fieldStart) continue;
+                if (sep.size() > 1 && (pos + sep.size() > lineEnd ||
+                                       std::memcmp(data.data() + pos, sep.data(), sep.size()) != 0))
+                    continue;
+                spans.emplace_back(fieldStart, pos);
+                fieldStart = pos + static_cast<uint32_t>(sep.size());
+            }
+            spans.emplace_back(fieldStart, lineEnd);
+            tokens.resize(spans.size());
+            for (size_t t = 0; t < spans.size(); ++t)
+                tokens[t].assign(data, spans[t].first, spans[t].second - spans[t].first);
+
+            size_t atCount = 0;
+            for (; ai < ats.size() && ats[ai] < lineEnd; ++ai) ++atCount;
+
+            // Parse once, then route the same fields through every profile
+            line.assign(data, lineStart, lineEnd - lineStart);
+            if (parseLine(line, tokens, atCount, config, parsed)) {
+                for (size_t p = 0; p < profileCount; ++p) {
+                    const Profile &profile = config.profiles[p];
+                    if (!routeLine(parsed, profile, p, config, out, key)) continue;
+                    processed[p].push_back(std::move(out));
+                    processedKeys[p].push_back(key);
+                    processedPositions[p].push_back(chunk.seq << 32 | lines);
+                    if (profile.bucketMode != BUCKET_NONE) {
+                        bucketName(parsed, profile, bucket);
+                        processedBuckets[p].push_back(std::move(bucket));
+                    }
+                }
+            }
+            lineStart = lineEnd + 1;
+        }
+        metrics.linesRead.fetch_add(lines, std::memory_order_relaxed);
+        auto mid = std::chrono::steady_clock::now();
+        OutputBatch batch;
+        batch.seq = chunk.seq;
+        batch.file = chunk.file;
+        batch.endOffset = chunk.endOffset;
+        batch.lines.resize(profileCount);
+        batch.buckets.resize(profileCount);
+        batch.keys.resize(profileCount);
+        size_t accepted = 0;
+        for (size_t p = 0; p < profileCount; ++p) {
+            const Profile &profile = config.profiles[p];
+            const bool bucketed = profile.bucketMode != BUCKET_NONE;
+            const bool held = profile.dedupPolicy != DEDUP_FIRST;
+            if (held && !config.ordered_output) {
+                std::lock_guard<std::mutex> lock(duplicate_mutex);
+                holdRecords(p, profile.dedupPolicy, processed[p], processedBuckets[p], processedKeys[p],
+                            processedPositions[p]);
+            }
+            for (size_t i = 0; (!held || config.ordered_output) && i < processed[p].size(); ++i) {
+                std::string &candidate = processed[p][i];
+                // A worker takes chunks in input order, so its local set only ever drops a later
+                // occurrence; under ordered_output the writer settles the rest in input order
+                bool fresh = held || localDuplicates[p].insert(processedKeys[p][i]).second;
+                if (fresh && !config.ordered_output) {
                     std::lock_guard<std::mutex> lock(duplicate_mutex);
-                    if (!global_duplicates.insert(processed).second) continue;
+                    fresh = global_duplicates[p].insert(processedKeys[p][i]).second;
                 }
-                outputQueue.push(processed);
-                ++processedCount;
+                if (!fresh) {
+                    metrics.reject(p, REJECT_DUPLICATE);
+                    continue;
+                }
+                batch.lines[p].push_back(std::move(candidate));
+                if (bucketed) batch.buckets[p].push_back(std::move(processedBuckets[p][i]));
+                if (config.ordered_output) batch.keys[p].push_back(processedKeys[p][i]);
             }
+            processed[p].clear();
+            processedKeys[p].clear();
+            processedPositions[p].clear();
+            processedBuckets[p].clear();
+            if (config.ordered_output) continue;    // counted by the writer
+            metrics.accept(p, batch.lines[p].size());
+            accepted += batch.lines[p].size();
         }
+        processedCount += accepted;
+        if (config.ordered_output) reorderWindow.waitFor(chunk.seq);
+        outputQueue.push(std::move(batch));
+        auto end = std::chrono::steady_clock::now();
+        metrics.stages[STAGE_PROCESS].observe(mid - start);
+        metrics.stages[STAGE_DEDUP].observe(end - mid);
     }
 }
 
-// Producer thread: read input file lines
-static void producer(const std::string &inputFilename) {
+static std::atomic<bool> stopRequested{false};     // SIGINT or SIGTERM under --watch or --follow
+static void requestStop(int) { stopRequested = true; }
+
+// File identity, to notice a followed path that now names another file (rotation)
+static uint64_t fileIdentity(const std::string &path) {
+#ifndef _WIN32
+    struct stat st;
+    if (::stat(path.c_str(), &st) == 0) return static_cast<uint64_t>(st.st_dev) << 48 ^ static_cast<uint64_t>(st.st_ino);
+#else
+    (void)path;
+#endif
+    return 0;
+}
+
+// --follow: blocks the producer at the end of its input until the file grows. Woken by inotify
+// where available, else by polling with a backoff from 10 to 250 ms; either way the file is
+// rechecked at least every 250 ms, which bounds how late new lines are picked up.
+class Follower {
+public:
+    explicit Follower(const std::string &path) : path_(path), identity_(fileIdentity(path)) {
+#ifdef __linux__
+        notify_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (notify_ >= 0 && inotify_add_watch(notify_, path.c_str(), IN_MODIFY | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF) < 0) {
+            close(notify_);
+            notify_ = -1;
+        }
+#endif
+    }
+    Follower(const Follower &) = delete;
+    Follower &operator=(const Follower &) = delete;
+    ~Follower() {
+#ifdef __linux__
+        if (notify_ >= 0) close(notify_);
+#endif
+    }
+
+    // in has hit end of file after readTo bytes. Returns once there is more to read (in cleared),
+    // or with reopened set once the path was truncated or now names a new file whose old one is
+    // read out (in reopened at its start); false when a stop is requested.
+    bool wait(std::ifstream &in, uint64_t readTo, bool &reopened) {
+        reopened = false;
+        auto delay = std::chrono::milliseconds(10);
+        while (!stopRequested) {
+            std::error_code ec;
+            uint64_t size = fs::file_size(path_, ec);
+            bool replaced = !ec && fileIdentity(path_) != identity_;
+            if (replaced && !drained_) {
+                drained_ = true;            // first read whatever the old file gained before the switch
+                in.clear();
+                return true;
+            }
+            if (!ec && (replaced || size < readTo)) {
+                in.close();
+                in.clear();
+                in.open(path_);
+                identity_ = fileIdentity(path_);
+                drained_ = false;
+                reopened = true;
+                return true;
+            }
+            if (!ec && size > readTo) {
+                in.clear();
+                return true;
+            }
+#ifdef __linux__
+            if (notify_ >= 0) {
+                pollfd pfd{ notify_, POLLIN, 0 };
+                if (::poll(&pfd, 1, 250) > 0) {
+                    char buffer[4096];
+                    while (::read(notify_, buffer, sizeof(buffer)) > 0) {}
+                }
+                continue;
+            }
+#endif
+            std::this_thread::sleep_for(delay);
+            delay = std::min(delay * 2, std::chrono::milliseconds(250));
+        }
+        return false;
+    }
+
+private:
+    std::string path_;
+    uint64_t identity_;
+    bool drained_ = false;
+    int notify_ = -1;
+};
+
+// Producer thread: read input file number fileIndex in blocks from startOffset, and hand workers
+// whole lines only; endOffset receives where reading stopped. Chunk offsets count bytes as read,
+// which are file offsets everywhere except under Windows text-mode CRLF folding; checkpointed and
+// manifest runs there need LF input. Following, end of file waits for more, and a partial last
+// line waits for its newline; on stop it is left unread, for a later run to continue from.
+static void producer(const std::string &inputFilename, uint64_t fileIndex, uint64_t startOffset, uint64_t &endOffset) {
     std::ifstream infile(inputFilename);
     if (!infile) {
         std::cerr << "Cannot open input file: " << inputFilename << "\n";
         std::exit(1);
     }
-    std::string line;
-    while (std::getline(infile, line)) {
-        inputQueue.push(line);
+    if (startOffset > 0) infile.seekg(static_cast<std::streamoff>(startOffset));
+    constexpr size_t READ_BLOCK = 1 << 20;
+    std::string carry;
+    uint64_t offset = startOffset;      // file offset of the chunk's first byte
+    std::unique_ptr<Follower> follower(following ? new Follower(inputFilename) : nullptr);
+    bool reopened = false;
+    while (infile || (follower && follower->wait(infile, offset + carry.size(), reopened))) {
+        if (reopened && !carry.empty()) {   // the old file ended without a newline
+            Chunk chunk;
+            chunk.seq = chunkSeq++;
+            chunk.file = fileIndex;
+            chunk.endOffset = offset + carry.size();
+            chunk.data.swap(carry);
+            inputQueue.push(std::move(chunk));
+        }
+        if (reopened) {
+            std::cout << "\nReopened " << inputFilename << " (truncated or replaced)" << std::endl;
+            offset = 0;
+            reopened = false;
+        }
+        auto start = std::chrono::steady_clock::now();
+        Chunk chunk;
+        chunk.data.swap(carry);
+        size_t kept = chunk.data.size();
+        chunk.data.resize(kept + READ_BLOCK);
+        infile.read(&chunk.data[kept], static_cast<std::streamsize>(READ_BLOCK));
+        size_t got = static_cast<size_t>(infile.gcount());
+        chunk.data.resize(kept + got);
+        metrics.bytesRead.fetch_add(got, std::memory_order_relaxed);
+        // The partial last line moves on to the next chunk; a line longer than a block keeps growing
+        size_t cut = chunk.data.rfind('\n');
+        if (cut == std::string::npos) {
+            carry.swap(chunk.data);
+            continue;
+        }
+        carry.assign(chunk.data, cut + 1, std::string::npos);
+        chunk.data.resize(cut + 1);
+        chunk.seq = chunkSeq++;
+        chunk.file = fileIndex;
+        chunk.endOffset = offset += chunk.data.size();
+        inputQueue.push(std::move(chunk));
+        metrics.stages[STAGE_READ].observe(std::chrono::steady_clock::now() - start);
+    }
+    // Like getline, a final line without a trailing newline is still processed
+    if (!carry.empty() && !following) {
+        Chunk chunk;
+        chunk.seq = chunkSeq++;
+        chunk.file = fileIndex;
+        chunk.endOffset = offset += carry.size();
+        chunk.data.swap(carry);
+        inputQueue.push(std::move(chunk));
     }
-    doneReading = true;
+    endOffset = offset;
     inputQueue.setDone();
 }
 
-// Writer thread: append processed lines to output file
-static void writer(const std::string &outputFilename, std::atomic<bool> &writerDone) {
-    std::ofstream outfile(outputFilename, std::ios::app);
-    if (!outfile) {
-        std::cerr << "Cannot open output file: " << outputFilename << "\n";
-        std::exit(1);
+// Writer thread: append each profile's accepted lines to its output file or bucket files; resumed
+// runs first cut them back to the checkpoint
+static void writer(const Config &config, bool resumed, std::atomic<bool> &writerDone) {
+    const size_t profileCount = config.profiles.size();
+    std::vector<std::ofstream> outfiles(profileCount);
+    std::vector<std::unique_ptr<BucketWriter>> bucketWriters(profileCount);
+    for (size_t p = 0; p < profileCount; ++p) {
+        const Profile &profile = config.profiles[p];
+        if (profile.bucketMode != BUCKET_NONE) {
+            std::error_code ec;
+            fs::create_directories(profile.bucket_dir, ec);
+            if (ec) {
+                std::cerr << "Cannot create bucket directory " << profile.bucket_dir << ": " << ec.message() << "\n";
+                std::exit(1);
+            }
+            bucketWriters[p].reset(new BucketWriter(profile.bucket_dir, config.max_open_buckets, !config.manifest_file.empty()));
+            if (resumed) bucketWriters[p]->restore(runState.bucketSizes[p]);
+            continue;
+        }
+        outfiles[p].open(profile.output, std::ios::app);
+        if (!outfiles[p]) {
+            std::cerr << "Cannot open output file: " << profile.output << "\n";
+            std::exit(1);
+        }
     }
-    std::string processed;
-    while (outputQueue.pop(processed)) {
-        outfile << processed << "\n";
+    auto write = [&](const OutputBatch &batch) {
+        size_t written = 0;
+        for (size_t p = 0; p < batch.lines.size(); ++p) {
+            if (BucketWriter *buckets = bucketWriters[p].get()) {
+                for (size_t i = 0; i < batch.lines[p].size(); ++i)
+                    buckets->write(batch.buckets[p][i], batch.lines[p][i]);
+                metrics.profiles[p].buckets.store(buckets->bucketCount(), std::memory_order_relaxed);
+                metrics.profiles[p].bucketFileOpens.store(buckets->fileOpens(), std::memory_order_relaxed);
+            } else {
+                for (const auto &processed : batch.lines[p])
+                    outfiles[p] << processed << "\n";
+            }
+            written += batch.lines[p].size();
+        }
+        return written;
+    };
+    // ordered_output: dedup runs here, on batches in input order, so the same input always keeps
+    // the same lines and a checkpoint between two batches sees consistent sets. They start over
+    // after each file, as they do unordered.
+    std::vector<uint64_t> positions;
+    auto dedupInOrder = [&](OutputBatch &batch) {
+        std::lock_guard<std::mutex> lock(duplicate_mutex);
+        for (size_t p = 0; p < batch.keys.size(); ++p) {
+            auto &lines = batch.lines[p], &buckets = batch.buckets[p];
+            const auto &keys = batch.keys[p];
+            if (keys.empty()) continue;
+            if (config.profiles[p].dedupPolicy != DEDUP_FIRST) {
+                positions.clear();
+                for (size_t i = 0; i < lines.size(); ++i) positions.push_back(runState.position++);
+                holdRecords(p, config.profiles[p].dedupPolicy, lines, buckets, keys, positions);
+                lines.clear();
+                buckets.clear();
+                continue;
+            }
+            size_t kept = 0;
+            for (size_t i = 0; i < lines.size(); ++i) {
+                if (!global_duplicates[p].insert(keys[i]).second) {
+                    metrics.reject(p, REJECT_DUPLICATE);
+                    continue;
+                }
+                if (kept != i) {
+                    lines[kept] = std::move(lines[i]);
+                    if (!buckets.empty()) buckets[kept] = std::move(buckets[i]);
+                }
+                ++kept;
+            }
+            lines.resize(kept);
+            if (!buckets.empty()) buckets.resize(kept);
+            metrics.accept(p, kept);
+            processedCount += kept;
+        }
+        if (batch.endOfFile) {
+            releaseHeldRecords(config, batch);
+            if (!resident)
+                for (auto &set : global_duplicates) set.clear();
+        }
+    };
+    // Record the output behind runState and save it with the dedup state
+    auto checkpoint = [&] {
+        for (size_t p = 0; p < profileCount; ++p) {
+            if (bucketWriters[p]) {
+                bucketWriters[p]->snapshot(runState.bucketSizes[p]);
+                continue;
+            }
+            outfiles[p].flush();
+            std::error_code ec;
+            runState.outputSizes[p] = fs::file_size(config.profiles[p].output, ec);
+            if (!outfiles[p] || ec) {
+                std::cerr << "Cannot write output file: " << config.profiles[p].output << "\n";
+                std::exit(1);
+            }
+        }
+        writeCheckpoint(config);
+    };
+    // Once a file's last batch is written, push the output to disk, then for manifest_file record
+    // how far the file was read
+    auto sync = [&] {
+        for (size_t p = 0; p < profileCount; ++p) {
+            if (bucketWriters[p]) {
+                bucketWriters[p]->sync();
+            } else if (!outfiles[p].flush()) {
+                std::cerr << "Cannot write output file: " << config.profiles[p].output << "\n";
+                std::exit(1);
+            }
+        }
+    };
+    auto finishFile = [&](const OutputBatch &batch) {
+        if (!batch.endOfFile) return;
+        sync();
+        if (config.manifest_file.empty()) return;
+        recordManifest(batch.path, batch.endOffset);
+        saveManifest(config.manifest_file);
+    };
+    auto lastCheckpoint = std::chrono::steady_clock::now();
+    constexpr size_t WRITE_BATCH = 16;
+    std::vector<OutputBatch> batches;
+    std::map<uint64_t, OutputBatch> pending;    // ordered_output: batches that arrived ahead of their turn
+    uint64_t next = 0;                          // sequence number of the batch to write next
+    while (true) {
+        batches.clear();
+        outputQueue.popBatch(batches, WRITE_BATCH);
+        if (batches.empty()) break;
+        auto start = std::chrono::steady_clock::now();
+        size_t written = 0;
+        for (auto &batch : batches) {
+            if (!config.ordered_output) {
+                written += write(batch);
+                finishFile(batch);
+                continue;
+            }
+            pending.emplace(batch.seq, std::move(batch));
+            for (auto it = pending.begin(); it != pending.end() && it->first == next; it = pending.erase(it), ++next) {
+                OutputBatch &ready = it->second;
+                dedupInOrder(ready);
+                written += write(ready);
+                finishFile(ready);
+                runState.file = ready.endOfFile ? ready.file + 1 : ready.file;
+                runState.offset = ready.endOfFile ? 0 : ready.endOffset;
+            }
+        }
+        if (config.ordered_output) {
+            reorderWindow.advance(next);
+            metrics.reorderPending.store(pending.size(), std::memory_order_relaxed);
+        }
+        if (!config.checkpoint_file.empty() &&
+            std::chrono::steady_clock::now() - lastCheckpoint >= std::chrono::seconds(config.checkpoint_interval)) {
+            checkpoint();
+            lastCheckpoint = std::chrono::steady_clock::now();
+        }
+        if (following) sync();                  // followed lines reach disk as they arrive
+        metrics.stages[STAGE_WRITE].observe(std::chrono::steady_clock::now() - start);
+        metrics.linesWritten.fetch_add(written, std::memory_order_relaxed);
+    }
+    for (size_t p = 0; p < profileCount; ++p) {
+        if (!bucketWriters[p]) continue;
+        bucketWriters[p]->flushAll();
+        metrics.profiles[p].bucketFileOpens.store(bucketWriters[p]->fileOpens(), std::memory_order_relaxed);
+        bucketWriters[p].reset();
     }
     writerDone = true;
 }
@@ -414,8 +2906,477 @@ static void progressMonitor(std::atomic<bool> &doneProgress) {
     std::cout << "\rProcessed lines: " << processedCount.load() << std::endl;
 }
 
+// Start the metrics_file and metrics_port threads the config asks for; they run until done is set
+static std::vector<std::thread> startMetrics(const Config &config, std::atomic<bool> &done) {
+    std::vector<std::thread> threads;
+    if (!config.metrics_file.empty())
+        threads.emplace_back(metricsFileWriter, config.metrics_file, config.metrics_interval, std::ref(done));
+    if (config.metrics_port != 0) {
+#ifndef _WIN32
+        threads.emplace_back(metricsServer, config.metrics_port, std::ref(done));
+#else
+        std::cerr << "metrics_port is not supported on Windows; use metrics_file instead.\n";
+#endif
+    }
+    return threads;
+}
+
+// Decide where reading inputFile starts: false to skip it (missing, empty, or unchanged since the
+// manifest recorded it), else startOffset moves to the old end of a file the manifest saw grow.
+// A followed file is never skipped; unchanged, it is read from its end.
+static bool planFile(const Config &config, const std::string &inputFile, uint64_t &startOffset) {
+    if ((!config.manifest_file.empty() || resident) && startOffset == 0 && fs::exists(inputFile)) {
+        startOffset = manifestStart(inputFile);
+        if (startOffset == UNCHANGED && following) {
+            startOffset = fs::file_size(inputFile);
+        } else if (startOffset == UNCHANGED) {
+            std::cout << "\nSkipping unchanged file: " << inputFile << std::endl;
+            return false;
+        }
+        if (startOffset > 0)
+            std::cout << "\nContinuing grown file: " << inputFile << " at byte " << startOffset << std::endl;
+    }
+    std::cout << "\n" << (following ? "Following file: " : "Filtering file: ") << inputFile << std::endl;
+    std::error_code ec;
+    uint64_t size = fs::file_size(inputFile, ec);
+    return !ec && (size > 0 || following);
+}
+
+// Run input file number fileIndex from startOffset through the producer and workers, and queue its
+// end-of-file batch; returns where reading stopped. The writer carries on across files.
+static uint64_t processFile(const Config &config, const std::string &inputFile, uint64_t fileIndex, uint64_t startOffset) {
+    processedCount = 0;
+    if (!config.ordered_output && !resident) {  // ordered, the writer clears them when it reaches the file's end
+        std::lock_guard<std::mutex> lock(duplicate_mutex);
+        for (auto &set : global_duplicates) set.clear();
+    }
+    inputQueue.clear();
+    std::atomic<bool> progressDone{false};
+
+    std::thread progressThread(progressMonitor, std::ref(progressDone));
+    uint64_t endOffset = 0;
+    std::thread prodThread(producer, inputFile, fileIndex, startOffset, std::ref(endOffset));
+
+    unsigned int num_workers = std::thread::hardware_concurrency();
+    if (num_workers == 0) num_workers = 4;
+    std::vector<std::thread> workers;
+    workers.reserve(num_workers);
+    for (unsigned int i = 0; i < num_workers; ++i) {
+        workers.emplace_back(worker, std::cref(config));
+    }
+
+    prodThread.join();
+    for (auto &w : workers) w.join();
+    flushHeldRecords(config, fileIndex, inputFile, endOffset);
+
+    progressDone = true;
+    progressThread.join();
+    metrics.filesProcessed.fetch_add(1, std::memory_order_relaxed);
+    std::cout << "Finished filtering file: " << inputFile << std::endl;
+    return endOffset;
+}
+
+// ulp --watch: process files dropped into dir as soon as they are completely written, until
+// SIGINT or SIGTERM. Written means inotify saw the file closed after writing or moved in; files
+// present at startup, or every file when inotify is unavailable, count once two scans a second
+// apart find the same size and mtime. Hidden, .tmp and .part files and ulp's own outputs are
+// ignored. The manifest skips files already processed and continues grown ones.
+static void watchDirectory(const Config &config, const std::string &dir) {
+    std::unordered_set<std::string> own;
+    for (const auto &profile : config.profiles) own.insert(manifestKey(profile.output));
+    for (const auto &file : { config.manifest_file, config.manifest_file + ".tmp", config.metrics_file })
+        if (!file.empty()) own.insert(manifestKey(file));
+    auto watchable = [&](const fs::path &path) {
+        const std::string name = path.filename().string();
+        const std::string extension = path.extension().string();
+        return !name.empty() && name[0] != '.' && extension != ".tmp" && extension != ".part" &&
+               !own.count(manifestKey(path.string()));
+    };
+    int notify = -1;
+#ifdef __linux__
+    notify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (notify >= 0 && inotify_add_watch(notify, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        close(notify);
+        notify = -1;
+    }
+#endif
+    std::cout << "Watching " << dir << (notify < 0 ? " (polling every second)" : "") << std::endl;
+
+    using Stat = std::pair<uint64_t, int64_t>;      // size and mtime
+    std::map<std::string, Stat> settling;           // as of the last scan
+    std::unordered_map<std::string, Stat> handled;  // as of when last processed or skipped
+    std::set<std::string> ready;
+    bool rescan = true;
+    uint64_t fileIndex = 0;
+    auto stat = [](const std::string &path, Stat &out) {
+        std::error_code ec;
+        out.first = fs::file_size(path, ec);
+        out.second = modificationTime(path);
+        return !ec;
+    };
+    auto lastScan = std::chrono::steady_clock::now() - std::chrono::seconds(1);
+    while (!stopRequested) {
+        if ((notify < 0 || rescan) && std::chrono::steady_clock::now() - lastScan >= std::chrono::seconds(1)) {
+            lastScan = std::chrono::steady_clock::now();
+            std::map<std::string, Stat> seen;
+            std::error_code ec;
+            for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+                Stat current;
+                const std::string path = it->path().string();
+                if (!fs::is_regular_file(it->status()) || !watchable(it->path()) || !stat(path, current)) continue;
+                auto previous = settling.find(path);
+                auto done = handled.find(path);
+                if (done != handled.end() && done->second == current) continue;
+                if (previous != settling.end() && previous->second == current) ready.insert(path);
+                else seen.emplace(path, current);
+            }
+            settling.swap(seen);
+            rescan = !settling.empty();
+        }
+#ifdef __linux__
+        if (notify >= 0) {
+            pollfd pfd{ notify, POLLIN, 0 };
+            if (ready.empty() && ::poll(&pfd, 1, 1000) > 0) {
+                alignas(inotify_event) char buffer[64 * 1024];
+                ssize_t n;
+                while ((n = ::read(notify, buffer, sizeof(buffer))) > 0) {
+                    for (char *p = buffer; p < buffer + n;) {
+                        const inotify_event *event = reinterpret_cast<const inotify_event *>(p);
+                        const fs::path path = fs::path(dir) / (event->len > 0 ? event->name : "");
+                        if (event->mask & IN_Q_OVERFLOW) rescan = true;
+                        else if (event->len > 0 && watchable(path)) ready.insert(path.string());
+                        p += sizeof(inotify_event) + event->len;
+                    }
+                }
+            }
+        }
+#endif
+        if (notify < 0 && ready.empty()) std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        for (auto it = ready.begin(); it != ready.end() && !stopRequested; it = ready.erase(it)) {
+            const std::string &path = *it;
+            Stat current;
+            if (!stat(path, current) || handled[path] == current) continue;
+            handled[path] = current;
+            uint64_t startOffset = 0;
+            if (!planFile(config, path, startOffset)) continue;
+            recordManifest(path, processFile(config, path, fileIndex++, startOffset));
+        }
+    }
+#ifdef __linux__
+    if (notify >= 0) close(notify);
+#endif
+    std::cout << "\nStopping watch of " << dir << std::endl;
+}
+
+#ifndef _WIN32
+// ulp --serve: filter lines for clients of a Unix domain socket, with the config, domain sets and
+// dedup state loaded once. A client writes lines and reads back the accepted, converted ones. An
+// empty line ends a request and is answered with an empty line after its output; closing the
+// write side ends the last request. With several profiles each output line starts with the
+// profile name and a tab; bucket_by is ignored. Dedup keeps the first occurrence across all
+// clients for as long as the server runs, so its sets grow with every distinct line served
+// (ulp_dedup_entries shows how far); restart the server to start them over.
+//
+// One poll loop serves every client. Each round gathers the complete lines all clients have sent
+// into one batch, parses and routes it on up to hardware_concurrency threads, then deduplicates
+// and answers in arrival order.
+class FilterServer {
+public:
+    static constexpr size_t READ_LIMIT = 4 << 20;       // bytes taken from one client per round
+    static constexpr size_t REPLY_LIMIT = 16 << 20;     // unsent reply bytes before a client is paused
+    static constexpr size_t PARALLEL_LINES = 4096;      // lines per thread in a large batch
+
+    explicit FilterServer(const Config &config) : config_(config) {}
+
+    int run(const std::string &path) {
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(addr.sun_path)) {
+            std::cerr << "Socket path too long: " << path << "\n";
+            return 1;
+        }
+        std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+        std::error_code ec;
+        if (fs::is_socket(fs::status(path, ec))) fs::remove(path, ec);     // left by an earlier server
+        int listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listenFd < 0 || ::bind(listenFd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0 ||
+            ::listen(listenFd, 64) < 0) {
+            std::cerr << "Cannot listen on " << path << ": " << std::strerror(errno) << "\n";
+            if (listenFd >= 0) ::close(listenFd);
+            return 1;
+        }
+        configure(listenFd);
+        std::cout << "Serving on " << path << std::endl;
+
+        std::vector<pollfd> pfds;
+        while (!stopRequested) {
+            pfds.assign(1, pollfd{ listenFd, POLLIN, 0 });
+            for (const Client &c : clients_)
+                pfds.push_back(pollfd{ c.fd, static_cast<short>((c.eof || c.out.size() >= REPLY_LIMIT ? 0 : POLLIN) |
+                                                              (c.out.empty() ? 0 : POLLOUT)), 0 });
+            if (::poll(pfds.data(), pfds.size(), 200) <= 0) continue;
+            for (size_t i = 1; i < pfds.size(); ++i) {
+                Client &c = clients_[i - 1];
+                if (pfds[i].revents & (POLLIN | POLLHUP | POLLERR)) receive(c);
+                if (pfds[i].revents & POLLOUT) send(c);
+            }
+            if (pfds[0].revents & POLLIN) accept(listenFd);
+            if (process()) {
+                for (Client &c : clients_) send(c);
+            }
+            clients_.erase(std::remove_if(clients_.begin(), clients_.end(), [](const Client &c) {
+                               if (c.failed || (c.eof && c.in.empty() && c.out.empty())) ::close(c.fd);
+                               return c.failed || (c.eof && c.in.empty() && c.out.empty());
+                           }),
+                           clients_.end());
+        }
+        for (const Client &c : clients_) ::close(c.fd);
+        ::close(listenFd);
+        fs::remove(path, ec);
+        std::cout << "\nStopped serving on " << path << std::endl;
+        return 0;
+    }
+
+private:
+    struct Client {
+        int fd = -1;
+        std::string in, out;            // received bytes not yet processed; reply bytes not yet sent
+        bool open = false;              // lines since the last end of request
+        bool eof = false, failed = false;
+    };
+    // One line of the batch, or the end of a request when line is empty
+    struct Item {
+        size_t client;
+        std::string line;
+    };
+    struct Routed {
+        std::string out;
+        DedupKey key;
+        bool accepted = false;
+    };
+
+    // A client that hangs up mid-reply must fail the send, not raise SIGPIPE: MSG_NOSIGNAL where
+    // there is one, SO_NOSIGPIPE on the socket elsewhere (macOS)
+#ifdef MSG_NOSIGNAL
+    static constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+    static constexpr int SEND_FLAGS = 0;
+#endif
+
+    // Non-blocking, not inherited across exec (set here, as SOCK_CLOEXEC is not portable)
+    static void configure(int fd) {
+        ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+        ::fcntl(fd, F_SETFL, O_NONBLOCK);
+#ifdef SO_NOSIGPIPE
+        int yes = 1;
+        ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &yes, sizeof(yes));
+#endif
+    }
+
+    void accept(int listenFd) {
+        int fd;
+        while ((fd = ::accept(listenFd, nullptr, nullptr)) >= 0) {
+            configure(fd);
+            Client client;
+            client.fd = fd;
+            clients_.push_back(std::move(client));
+        }
+    }
+
+    void receive(Client &c) {
+        char buffer[64 * 1024];
+        while (!c.eof && c.in.size() < READ_LIMIT) {
+            ssize_t n = ::recv(c.fd, buffer, sizeof(buffer), 0);
+            if (n > 0) {
+                c.in.append(buffer, static_cast<size_t>(n));
+            } else if (n == 0) {
+                c.eof = true;
+                if (!c.in.empty() && c.in.back() != '\n') c.in += '\n';  // like getline, the last line needs no newline
+            } else {
+                c.failed = errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR;
+                return;
+            }
+        }
+    }
+
+    void send(Client &c) {
+        while (!c.out.empty() && !c.failed) {
+            ssize_t n = ::send(c.fd, c.out.data(), c.out.size(), SEND_FLAGS);
+            if (n > 0) {
+                c.out.erase(0, static_cast<size_t>(n));
+            } else {
+                c.failed = errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR;
+                return;
+            }
+        }
+    }
+
+    // Move every client's complete lines into one batch, route it and answer; false if idle
+    bool process() {
+        items_.clear();
+        for (size_t i = 0; i < clients_.size(); ++i) {
+            Client &c = clients_[i];
+            size_t start = 0, end;
+            while ((end = c.in.find('\n', start)) != std::string::npos) {
+                size_t length = end - start == 1 && c.in[start] == '\r' ? 0 : end - start;   // CRLF blank line
+                items_.push_back(Item{ i, c.in.substr(start, length) });
+                c.open = length > 0;
+                start = end + 1;
+            }
+            c.in.erase(0, start);
+            if (c.eof && c.open) {
+                items_.push_back(Item{ i, std::string() });
+                c.open = false;
+            }
+        }
+        if (items_.empty()) return false;
+
+        const size_t profileCount = config_.profiles.size();
+        routed_.resize(items_.size() * profileCount);
+        size_t threads = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                                          items_.size() / PARALLEL_LINES + 1);
+        std::vector<std::thread> pool;
+        for (size_t t = 1; t < threads; ++t)
+            pool.emplace_back(&FilterServer::route, this, items_.size() * t / threads, items_.size() * (t + 1) / threads);
+        route(0, items_.size() / threads);
+        for (auto &thread : pool) thread.join();
+
+        std::lock_guard<std::mutex> lock(duplicate_mutex);
+        std::vector<uint64_t> accepted(profileCount, 0);
+        for (size_t i = 0; i < items_.size(); ++i) {
+            Client &c = clients_[items_[i].client];
+            if (items_[i].line.empty()) {
+                c.out += '\n';
+                continue;
+            }
+            for (size_t p = 0; p < profileCount; ++p) {
+                Routed &r = routed_[i * profileCount + p];
+                if (!r.accepted) continue;
+                if (!global_duplicates[p].insert(r.key).second) {
+                    metrics.reject(p, REJECT_DUPLICATE);
+                    continue;
+                }
+                if (profileCount > 1) c.out.append(config_.profiles[p].name).append(1, '\t');
+                c.out.append(r.out).append(1, '\n');
+                ++accepted[p];
+            }
+        }
+        for (size_t p = 0; p < profileCount; ++p) metrics.accept(p, accepted[p]);
+        metrics.linesRead.fetch_add(items_.size(), std::memory_order_relaxed);
+        processedCount += items_.size();
+        return true;
+    }
+
+    // Parse and route items [first, last) through every profile
+    void route(size_t first, size_t last) {
+        const size_t profileCount = config_.profiles.size();
+        ParsedLine parsed;
+        for (size_t i = first; i < last; ++i) {
+            const std::string &line = items_[i].line;
+            if (line.empty()) continue;
+            std::vector<std::string> tokens = split(line, config_.separator);
+            bool valid = parseLine(line, tokens, UNKNOWN_COUNT, config_, parsed);
+            for (size_t p = 0; p < profileCount; ++p) {
+                Routed &r = routed_[i * profileCount + p];
+                r.accepted = valid && routeLine(parsed, config_.profiles[p], p, config_, r.out, r.key);
+            }
+        }
+    }
+
+    const Config &config_;
+    std::vector<Client> clients_;
+    std::vector<Item> items_;
+    std::vector<Routed> routed_;
+};
+#endif
+
+// ulp --build-index: compile text lists into one binary index for *_file= keys
+static int buildIndex(const std::vector<std::string> &lists, const std::string &indexFile) {
+    auto start = std::chrono::steady_clock::now();
+    DomainSet set;
+    for (const auto &list : lists) set.insertFile(list);
+    set.freeze();
+    set.writeIndex(indexFile);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Wrote " << set.size() << " domains to " << indexFile << " ("
+              << fs::file_size(indexFile) << " bytes, " << (set.frozen() ? "perfect hash" : "probing table")
+              << ") in " << seconds << " s\n";
+    return 0;
+}
+
 int main(int argc, char* argv[]) {
+    if (argc >= 2 && std::string(argv[1]) == "--build-index") {
+        if (argc < 4) {
+            std::cerr << "Usage: " << argv[0] << " --build-index <list_file> [more lists...] <index_file>\n";
+            return 1;
+        }
+        return buildIndex(std::vector<std::string>(argv + 2, argv + argc - 1), argv[argc - 1]);
+    }
+
+    const bool resume = argc >= 2 && std::string(argv[1]) == "--resume";
+    const bool watch = argc >= 2 && std::string(argv[1]) == "--watch";
+    following = argc >= 2 && std::string(argv[1]) == "--follow";
+    const bool serve = argc >= 2 && std::string(argv[1]) == "--serve";
     Config config = parseConfig("config.ini");
+    metrics.initProfiles(config);
+    global_duplicates.resize(config.profiles.size());
+    held_records.resize(config.profiles.size());
+    runState.configHash = configFingerprint("config.ini");
+    runState.outputSizes.assign(config.profiles.size(), 0);
+    runState.bucketSizes.assign(config.profiles.size(), {});
+    if (!config.manifest_file.empty()) loadManifest(config.manifest_file);
+    if (resume) {
+        if (argc != 2 || config.checkpoint_file.empty()) {
+            std::cerr << "Usage: " << argv[0] << " --resume (with checkpoint_file set in config.ini)\n";
+            return 1;
+        }
+        readCheckpoint(config);
+    }
+    if (watch) {
+        if (argc != 3 || !fs::is_directory(argv[2])) {
+            std::cerr << "Usage: " << argv[0] << " --watch <directory>\n";
+            return 1;
+        }
+        if (!config.checkpoint_file.empty()) {
+            std::cerr << "checkpoint_file does not apply to --watch; manifest_file records its progress\n";
+            return 1;
+        }
+        resident = true;
+    }
+    if (following && (argc != 3 || !config.checkpoint_file.empty())) {
+        std::cerr << "Usage: " << argv[0] << " --follow <input_file> (without checkpoint_file; manifest_file records progress)\n";
+        return 1;
+    }
+    if (watch || following || serve) {
+        std::signal(SIGINT, requestStop);
+        std::signal(SIGTERM, requestStop);
+    }
+    if (serve || following) {
+        // last and count hold records until their input ends, which never comes here
+        for (const auto &profile : config.profiles)
+            if (profile.dedupPolicy != DEDUP_FIRST) {
+                std::cerr << "dedup_policy=" << profile.dedup_policy << " needs an end of input; "
+                          << argv[1] << " keeps the first occurrence only\n";
+                return 1;
+            }
+    }
+    if (serve) {
+#ifndef _WIN32
+        if (argc != 3 || !config.checkpoint_file.empty()) {
+            std::cerr << "Usage: " << argv[0] << " --serve <socket_path> (without checkpoint_file)\n";
+            return 1;
+        }
+        std::atomic<bool> metricsDone{false};
+        std::vector<std::thread> metricsThreads = startMetrics(config, metricsDone);
+        int status = FilterServer(config).run(argv[2]);
+        metricsDone = true;
+        for (auto &t : metricsThreads) t.join();
+        return status;
+#else
+        std::cerr << "--serve is not supported on Windows\n";
+        return 1;
+#endif
+    }
 
     std::vector<std::string> inputFiles;
 #ifdef _WIN32
@@ -429,10 +3390,15 @@ int main(int argc, char* argv[]) {
     } else {
 #endif
         if (argc < 2) {
-            std::cerr << "Usage: " << argv[0] << " <input_file_or_wildcard> [additional files...]\n";
+            std::cerr << "Usage: " << argv[0] << " <input_file_or_wildcard> [additional files...]\n"
+                      << "       " << argv[0] << " --resume\n"
+                      << "       " << argv[0] << " --watch <directory>\n"
+                      << "       " << argv[0] << " --follow <input_file>\n"
+                      << "       " << argv[0] << " --serve <socket_path>    (dedup state grows until restarted)\n"
+                      << "       " << argv[0] << " --build-index <list_file> [more lists...] <index_file>\n";
             return 1;
         }
-        for (int i = 1; i < argc; ++i) {
+        for (int i = resume || watch ? argc : following ? 2 : 1; i < argc; ++i) {
             std::string arg = argv[i];
             if (arg.find('*') != std::string::npos || arg.find('?') != std::string::npos) {
                 auto found = getFiles(arg);
@@ -444,47 +3410,61 @@ int main(int argc, char* argv[]) {
 #ifdef _WIN32
     }
 #endif
+    if (resume) inputFiles = runState.inputFiles;
 
-    if (inputFiles.empty()) {
+    if (inputFiles.empty() && !watch) {
         std::cerr << "No valid input files found.\n";
         return 1;
     }
+    runState.inputFiles = inputFiles;
+    std::vector<size_t> duplicateOf(inputFiles.size(), SIZE_MAX);
+    if (config.skip_duplicate_files) duplicateOf = findDuplicateFiles(inputFiles);
 
-    const std::string mergedOutputFile = "filtered_output.txt";
-    std::remove(mergedOutputFile.c_str());
+    // A resumed run cuts its outputs back to what the checkpoint covers; a new one starts them over,
+    // or with a manifest appends to them
+    const uint64_t resumeFile = runState.file, resumeOffset = runState.offset;
+    for (size_t p = 0; p < config.profiles.size(); ++p) {
+        const Profile &profile = config.profiles[p];
+        if (profile.bucketMode != BUCKET_NONE) continue;
+        if (!resume) {
+            if (!config.manifest_file.empty()) continue;
+            std::remove(profile.output.c_str());
+            continue;
+        }
+        std::error_code ec;
+        fs::resize_file(profile.output, runState.outputSizes[p], ec);
+        if (ec) {
+            std::cerr << "Cannot restore output file " << profile.output << ": " << ec.message() << "\n";
+            return 1;
+        }
+    }
+    if (resume)
+        std::cout << "Resuming from " << config.checkpoint_file << " at " << inputFiles[std::min<size_t>(resumeFile, inputFiles.size() - 1)]
+                  << (resumeFile < inputFiles.size() ? ", byte " + std::to_string(resumeOffset) : std::string(" (complete)"))
+                  << std::endl;
     std::atomic<bool> writerDone{false};
-    std::thread writerThread(writer, mergedOutputFile, std::ref(writerDone));
+    std::thread writerThread(writer, std::cref(config), resume, std::ref(writerDone));
 
-    for (const auto &inputFile : inputFiles) {
-        std::cout << "\nFiltering file: " << inputFile << std::endl;
-        if (!fs::exists(inputFile) || fs::file_size(inputFile) == 0) continue;
+    std::atomic<bool> metricsDone{false};
+    std::vector<std::thread> metricsThreads = startMetrics(config, metricsDone);
 
-        processedCount = 0;
-        {
-            std::lock_guard<std::mutex> lock(duplicate_mutex);
-            global_duplicates.clear();
+    if (watch) watchDirectory(config, argv[2]);
+    for (size_t fileIndex = resume ? resumeFile : 0; fileIndex < inputFiles.size(); ++fileIndex) {
+        const std::string &inputFile = inputFiles[fileIndex];
+        if (duplicateOf[fileIndex] != SIZE_MAX) {
+            std::cout << "\nSkipping duplicate file: " << inputFile << " (same as " << inputFiles[duplicateOf[fileIndex]]
+                      << ")" << std::endl;
+            metrics.duplicateFiles.fetch_add(1, std::memory_order_relaxed);
+            metrics.duplicateBytes.fetch_add(fs::file_size(inputFile), std::memory_order_relaxed);
+            continue;
         }
-        inputQueue.clear();
-        doneReading = false;
-        std::atomic<bool> progressDone{false};
-
-        std::thread progressThread(progressMonitor, std::ref(progressDone));
-        std::thread prodThread(producer, inputFile);
-
-        unsigned int num_workers = std::thread::hardware_concurrency();
-        if (num_workers == 0) num_workers = 4;
-        std::vector<std::thread> workers;
-        workers.reserve(num_workers);
-        for (unsigned int i = 0; i < num_workers; ++i) {
-            workers.emplace_back(worker, std::cref(config));
+        uint64_t startOffset = resume && fileIndex == resumeFile ? resumeOffset : 0;
+        if (!planFile(config, inputFile, startOffset)) continue;
+        if (startOffset > fs::file_size(inputFile)) {
+            std::cerr << "Input file " << inputFile << " is shorter than its checkpointed offset; cannot resume\n";
+            return 1;
         }
-
-        prodThread.join();
-        for (auto &w : workers) w.join();
-
-        progressDone = true;
-        progressThread.join();
-        std::cout << "Finished filtering file: " << inputFile << std::endl;
+        processFile(config, inputFile, fileIndex, startOffset);
     }
 
     outputQueue.setDone();
@@ -492,7 +3472,28 @@ int main(int argc, char* argv[]) {
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
     }
     writerThread.join();
+    if (!config.checkpoint_file.empty()) {     // the run is complete; nothing is left to resume
+        std::remove(config.checkpoint_file.c_str());
+        std::remove((config.checkpoint_file + ".tmp").c_str());
+    }
+
+    metricsDone = true;
+    for (auto &t : metricsThreads) t.join();
 
-    std::cout << "\nOutput written to: " << mergedOutputFile << "\n";
+    std::cout << "\n";
+    for (const auto &profile : config.profiles) {
+        if (profile.bucketMode == BUCKET_NONE)
+            std::cout << "Output written to: " << profile.output;
+        else
+            std::cout << "Output written to: " << profile.bucket_dir << " ("
+                      << metrics.profiles[&profile - &config.profiles[0]].buckets.load() << " buckets by "
+                      << profile.bucket_by << ")";
+        if (config.profiles.size() > 1) std::cout << " [" << profile.name << "]";
+        std::cout << "\n";
+    }
+    if (metrics.duplicateFiles.load() > 0)
+        std::cout << "Skipped " << metrics.duplicateFiles.load() << " duplicate input files ("
+                  << metrics.duplicateBytes.load() << " bytes)\n";
     return 0;
 }
+#endif // ULP_NO_MAIN
@@ -0,0 +1,159 @@
+// ulp_idn.h
+// Internationalized domain names in one canonical spelling: lowercase ASCII with non-ASCII labels
+// punycode-encoded (RFC 3492, "xn--" prefix), so "Bücher.de" and "xn--bcher-kva.de" compare equal
+// Table-driven: UTF-8 sequence lengths and case/width folding come from small lookup tables.
+// Full Unicode normalization (NFC, the complete UTS #46 mapping) is out of scope.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace idn {
+
+// Length of a UTF-8 sequence by its lead byte >> 3; 0 marks continuation and invalid bytes
+constexpr uint8_t UTF8_LENGTH[32] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 3, 3, 4, 0
+};
+
+// Smallest code point each sequence length may encode (anything lower is an overlong form)
+constexpr uint32_t UTF8_MIN[5] = { 0, 0, 0x80, 0x800, 0x10000 };
+
+// Case and width folding: code points in [first, last] (every other one when step is 2) map to
+// cp + delta. Covers Latin, Greek, Cyrillic and Armenian capitals, fullwidth ASCII and the
+// ideographic full stops IDNA treats as label separators.
+struct Fold {
+    uint32_t first, last;
+    int32_t delta;
+    uint32_t step;
+};
+constexpr Fold FOLDS[] = {
+    { 0x00C0, 0x00D6, 32, 1 },   { 0x00D8, 0x00DE, 32, 1 },   { 0x0100, 0x012F, 1, 2 },
+    { 0x0132, 0x0137, 1, 2 },    { 0x0139, 0x0148, 1, 2 },    { 0x014A, 0x0177, 1, 2 },
+    { 0x0178, 0x0178, -121, 1 }, { 0x0179, 0x017E, 1, 2 },    { 0x0386, 0x0386, 38, 1 },
+    { 0x0388, 0x038A, 37, 1 },   { 0x038C, 0x038C, 64, 1 },   { 0x038E, 0x038F, 63, 1 },
+    { 0x0391, 0x03A1, 32, 1 },   { 0x03A3, 0x03AB, 32, 1 },   { 0x0400, 0x040F, 80, 1 },
+    { 0x0410, 0x042F, 32, 1 },   { 0x0460, 0x0481, 1, 2 },    { 0x048A, 0x04BF, 1, 2 },
+    { 0x04C0, 0x04C0, 15, 1 },   { 0x04C1, 0x04CE, 1, 2 },    { 0x04D0, 0x052F, 1, 2 },
+    { 0x0531, 0x0556, 48, 1 },   { 0x1E00, 0x1E95, 1, 2 },    { 0x1EA0, 0x1EFF, 1, 2 },
+    { 0x3002, 0x3002, 0x2E - 0x3002, 1 },                     { 0xFF0E, 0xFF0E, 0x2E - 0xFF0E, 1 },
+    { 0xFF10, 0xFF19, 0x30 - 0xFF10, 1 },                     { 0xFF21, 0xFF3A, 0x61 - 0xFF21, 1 },
+    { 0xFF41, 0xFF5A, 0x61 - 0xFF41, 1 },                     { 0xFF61, 0xFF61, 0x2E - 0xFF61, 1 },
+};
+
+inline uint32_t fold(uint32_t cp) {
+    if (cp < 0x80) return cp - 'A' < 26 ? cp | 0x20 : cp;
+    for (const Fold &f : FOLDS)
+        if (cp >= f.first && cp <= f.last && (cp - f.first) % f.step == 0)
+            return static_cast<uint32_t>(static_cast<int32_t>(cp) + f.delta);
+    return cp;
+}
+
+// Punycode digit values 0..35 as characters
+constexpr char DIGITS[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+
+// Append the RFC 3492 encoding of n code points (without the xn-- prefix) to out
+inline void punycode(const uint32_t *cp, size_t n, std::string &out) {
+    constexpr uint32_t base = 36, tmin = 1, tmax = 26, skew = 38, damp = 700;
+    auto adapt = [](uint32_t delta, uint32_t points, bool first) {
+        delta = first ? delta / damp : delta / 2;
+        delta += delta / points;
+        uint32_t k = 0;
+        for (; delta > ((base - tmin) * tmax) / 2; k += base) delta /= base - tmin;
+        return k + (base - tmin + 1) * delta / (delta + skew);
+    };
+    uint32_t basic = 0;
+    for (size_t i = 0; i < n; ++i)
+        if (cp[i] < 0x80) {
+            out += static_cast<char>(cp[i]);
+            ++basic;
+        }
+    if (basic > 0) out += '-';
+    uint32_t handled = basic, next = 0x80, delta = 0, bias = 72;
+    while (handled < n) {
+        uint32_t m = UINT32_MAX;
+        for (size_t i = 0; i < n; ++i)
+            if (cp[i] >= next && cp[i] < m) m = cp[i];
+        delta += (m - next) * (handled + 1);
+        next = m;
+        for (size_t i = 0; i < n; ++i) {
+            if (cp[i] < next) ++delta;
+            if (cp[i] != next) continue;
+            uint32_t q = delta;
+            for (uint32_t k = base;; k += base) {
+                uint32_t t = k <= bias ? tmin : k >= bias + tmax ? tmax : k - bias;
+                if (q < t) break;
+                out += DIGITS[t + (q - t) % (base - t)];
+                q = (q - t) / (base - t);
+            }
+            out += DIGITS[q];
+            bias = adapt(delta, handled + 1, handled == basic);
+            delta = 0;
+            ++handled;
+        }
+        ++delta;
+        ++next;
+    }
+}
+
+// Non-ASCII bytes, or "xn--" in any case (at a label start when labelStart is set)
+inline bool hasIdnMarks(std::string_view text, bool labelStart) {
+    for (size_t i = 0; i < text.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(text[i]);
+        if (c >= 0x80) return true;
+        if (c == '-' && i >= 3 && text[i - 1] == '-' && (text[i - 2] | 0x20) == 'n' &&
+            (text[i - 3] | 0x20) == 'x' && (!labelStart || i == 3 || text[i - 4] == '.'))
+            return true;
+    }
+    return false;
+}
+
+// Cheap screen for a whole line: false means no domain in it can need rewriting
+inline bool mayContainIdn(std::string_view line) { return hasIdnMarks(line, false); }
+
+// True if domain is not already canonical ASCII: it has non-ASCII bytes or an xn-- label, whose
+// other labels may still need lowercasing
+inline bool needsAscii(std::string_view domain) { return hasIdnMarks(domain, true); }
+
+// Canonical ASCII form of a domain into out: case and width folded, label separators unified,
+// non-ASCII labels as xn-- punycode. False (out unspecified) on malformed UTF-8 or an oversized
+// domain.
+inline bool toAscii(std::string_view domain, std::string &out) {
+    constexpr size_t MAX_POINTS = 512;
+    uint32_t points[MAX_POINTS];
+    size_t n = 0;
+    for (size_t i = 0; i < domain.size();) {
+        unsigned char lead = static_cast<unsigned char>(domain[i]);
+        size_t len = UTF8_LENGTH[lead >> 3];
+        if (len == 0 || i + len > domain.size() || n == MAX_POINTS) return false;
+        uint32_t cp = len == 1 ? lead : lead & (0x7F >> len);
+        for (size_t k = 1; k < len; ++k) {
+            unsigned char c = static_cast<unsigned char>(domain[i + k]);
+            if ((c & 0xC0) != 0x80) return false;
+            cp = cp << 6 | (c & 0x3F);
+        }
+        if (cp < UTF8_MIN[len] || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) return false;
+        points[n++] = fold(cp);
+        i += len;
+    }
+    out.clear();
+    for (size_t start = 0; start <= n;) {
+        size_t end = start;
+        bool ascii = true;
+        for (; end < n && points[end] != '.'; ++end) ascii = ascii && points[end] < 0x80;
+        if (start > 0) out += '.';
+        if (ascii) {
+            for (size_t i = start; i < end; ++i) out += static_cast<char>(points[i]);
+        } else {
+            out += "xn--";
+            punycode(points + start, end - start, out);
+        }
+        start = end + 1;
+    }
+    return true;
+}
+
+} // namespace idn
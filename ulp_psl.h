@@ -0,0 +1,13499 @@
+// ulp_psl.h
+// Public Suffix List compiled into a label trie by tools/psl_gen.cpp; do not edit by hand.
+// Regenerate with the update-psl CMake target (or psl_gen <list> ulp_psl.h) when the list changes.
+// Source: public_suffix_list.dat, 9506 rules
+// The list data is subject to the Mozilla Public License 2.0 (https://mozilla.org/MPL/2.0/).
+
+#pragma once
+
+#include <cstdint>
+
+namespace psl {
+
+enum : uint8_t {
+    RULE = 1,           // the path from the root to this node is a public suffix
+    EXCEPTION = 2,      // ... is not, although a wildcard above it says so (!rule)
+    WILDCARD = 4        // every label directly below this node is a public suffix (*.rule)
+};
+
+// Trie over labels read right to left; node 0 is the root. A node's children are
+// NODES[first, first + children), sorted by label bytes (shorter first on a tie).
+struct Node {
+    uint32_t label;     // offset of the lowercase label in LABELS
+    uint8_t length;
+    uint8_t flags;
+    uint16_t children;
+    uint32_t first;
+};
+
+static const char LABELS[] =
+    "aaaaarpabarthabbabbottabbvieabcableabogadoabudhabiacacademyaccentureaccountantaccountantsacoactor"
+    "adadsadultaeaegaeroaetnaafaflafricaagagakhanagencyaiaigairbusairforceairtelakdnalalfaromeoalibaba"
+    "alipayallfinanzallstateallyalsacealstomamamazonamericanexpressamericanfamilyamexamfamamicaamsterdam"
+    "analyticsandroidanquananzaoaolapartmentsappappleaqaquarelleararabaramcoarchiarmyarpaartarteasasda"
+    "asiaassociatesatathletaattorneyauauctionaudiaudibleaudioauspostauthorautoautosaviancaawawsaxaxaaz"
+    "azurebababybaidubanamexbananarepublicbandbankbarbarcelonabarclaycardbarclaysbarefootbargainsbaseball"
+    "basketballbauhausbayernbbbbcbbtbbvabcgbcnbdbebeatsbeautybeerbentleyberlinbestbestbuybetbfbgbhbharti"
+    "bibiblebidbikebingbingobiobizbjblackblackfridayblockbusterblogbloombergbluebmbmsbmwbnbnpparibasbo"
+    "boatsboehringerbofabombondboobookbookingboschbostikbostonbotboutiqueboxbrbradescobridgestonebroadway"
+    "brokerbrotherbrusselsbsbtbuildbuildersbusinessbuybuzzbvbwbybzbzhcacabcafecalcallcalvinkleincamcamera"
+    "campcanoncapetowncapitalcapitalonecarcaravancardscarecareercareerscarscasacasecashcasinocatcatering"
+    "catholiccbacbncbrecbscccdcenterceocerncfcfacfdcgchchanelchannelcharitychasechatcheapchintaichristmas"
+    "chromechurchciciprianicircleciscocitadelciticiticcitycityeatsckclclaimscleaningclickclinicclinique"
+    "clothingcloudclubclubmedcmcncocoachcodescoffeecollegecolognecomcomcastcommbankcommunitycompanycompare"
+    "computercomseccondosconstructionconsultingcontactcontractorscookingcookingchannelcoolcoopcorsica"
+    "countrycouponcouponscoursescpacrcreditcreditcardcreditunioncricketcrowncrscruisecruisescucuisinella"
+    "cvcwcxcycymrucyouczdaburdaddancedatadatedatingdatsundaydclkddsdedealdealerdealsdegreedeliverydell"
+    "deloittedeltademocratdentaldentistdesidesigndevdhldiamondsdietdigitaldirectdirectorydiscountdiscover"
+    "dishdiydjdkdmdnpdodocsdoctordogdomainsdotdownloaddrivedtvdubaidunlopdupontdurbandvagdvrdzeartheat"
+    "ececoedekaedueducationeeegemailemerckenergyengineerengineeringenterprisesepsonequipmenterericsson"
+    "erniesesqestateetetisalateueurovisioneuseventsexchangeexpertexposedexpressextraspacefagefailfairwinds"
+    "faithfamilyfanfansfarmfarmersfashionfastfedexfeedbackferrariferrerofifiatfidelityfidofilmfinalfinance"
+    "financialfirefirestonefirmdalefishfishingfitfitnessfjfkflickrflightsflirfloristflowersflyfmfofoo"
+    "foodfoodnetworkfootballfordforexforsaleforumfoundationfoxfrfreefreseniusfrlfrogansfrontdoorfrontier"
+    "ftrfujitsufunfundfurniturefutbolfyigagalgallerygallogallupgamegamesgapgardengaygbgbizgdgdngegeagent"
+    "gentinggeorgegfggggeeghgigiftgiftsgivesgivingglglassgleglobalglobogmgmailgmbhgmogmxgngodaddygold"
+    "goldpointgolfgoogoodyeargooggooglegopgotgovgpgqgrgraingergraphicsgratisgreengripegrocerygroupgsgt"
+    "guguardianguccigugeguideguitarsgurugwgyhairhamburghangouthaushbohdfchdfcbankhealthhealthcarehelp"
+    "helsinkiherehermeshgtvhiphophisamitsuhitachihivhkhkthmhnhockeyholdingsholidayhomedepothomegoodshomes"
+    "homesensehondahorsehospitalhosthostinghothoteleshotelshotmailhousehowhrhsbchthuhugheshyatthyundai"
+    "ibmicbciceicuidieieeeifmikanoilimimamatimdbimmoimmobilieninincindustriesinfinitiinfoinginkinstitute"
+    "insuranceinsureintinternationalintuitinvestmentsioipirangaiqiririshisismailiististanbulititauitv"
+    "jaguarjavajcbjejeepjetztjewelryjiojlljmjmpjnjjojobsjoburgjotjoyjpjpmorganjprsjuegosjuniperkaufen"
+    "kddikekerryhotelskerrylogisticskerrypropertieskfhkgkhkikiakidskimkinderkindlekitchenkiwikmknkoeln"
+    "komatsukosherkpkpmgkpnkrkrdkredkuokgroupkwkykyotokzlalacaixalamborghinilamerlancasterlancialandlandrover"
+    "lanxesslasallelatlatinolatrobelawlawyerlblcldsleaseleclerclefraklegallegolexuslgbtlilidllifelifeinsurance"
+    "lifestylelightinglikelillylimitedlimolincolnlindelinklipsylivelivinglkllcllploanloanslockerlocus"
+    "lollondonlottelottolovelpllplfinanciallrlsltltdltdalulundbeckluxeluxurylvlymamacysmadridmaifmaison"
+    "makeupmanmanagementmangomapmarketmarketingmarketsmarriottmarshallsmaseratimattelmbamcmckinseymdme"
+    "medmediameetmelbournememememorialmenmenumerckmsdmgmhmiamimicrosoftmilminimintmitmitsubishimkmlmlb"
+    "mlsmmmmamnmomobimobilemodamoemoimommonashmoneymonstermormonmortgagemoscowmotomotorcyclesmovmovie"
+    "mpmqmrmsmsdmtmtnmtrmumuseummusicmutualmvmwmxmymznanabnagoyanamenaturanavynbancnenecnetnetbanknetflix"
+    "networkneustarnewnewsnextnextdirectnexusnfnflngngonhkniniconikenikonninjanissannissaynlnonokianorthwesternmutual"
+    "nortonnownowruznowtvnpnrnranrwnttnunycnzobiobserverofficeokinawaolayanolayangroupoldnavyolloomomega"
+    "oneongoniononlonlineoooopenoracleorangeorgorganicoriginsosakaotsukaottovhpapagepanasonicparispars"
+    "partnerspartspartypassagenspaypccwpepetpfpfizerpgphpharmacyphdphilipsphonephotophotographyphotos"
+    "physiopicspictetpicturespidpinpingpinkpioneerpizzapkplplaceplayplaystationplumbingpluspmpnpncpohl"
+    "pokerpolitiepornpostprpramericapraxipressprimeproprodproductionsprofprogressivepromopropertiesproperty"
+    "protectionpruprudentialpsptpubpwpwcpyqaqponquebecquestracingradiorereadrealestaterealtorrealtyrecipes"
+    "redredstoneredumbrellarehabreisereisenreitreliancerenrentrentalsrepairreportrepublicanrestrestaurant"
+    "reviewreviewsrexrothrichrichardliricohrilrioriprorocherrocksrodeorogersroomrsrsvprurugbyruhrrunrw"
+    "rweryukyusasaarlandsafesafetysakurasalesalonsamsclubsamsungsandviksandvikcoromantsanofisapsarlsas"
+    "savesaxosbsbisbsscscascbschaefflerschmidtscholarshipsschoolschuleschwarzsciencescotsdsesearchseat"
+    "securesecurityseekselectsenerservicessevensewsexsexysfrsgshshangrilasharpshawshellshiashikshashoes"
+    "shopshoppingshoujishowshowtimesisilksinasinglessitesjskskiskinskyskypeslslingsmsmartsmilesnsncfso"
+    "soccersocialsoftbanksoftwaresohusolarsolutionssongsonysoyspaspacesportspotsrsrlssststadastaplesstar"
+    "statebankstatefarmstcstcgroupstockholmstoragestorestreamstudiostudystylesusuckssuppliessupplysupport"
+    "surfsurgerysuzukisvswatchswisssxsysydneysystemssztabtaipeitalktaobaotargettatamotorstatartattootax"
+    "taxitctcitdtdkteamtechtechnologyteltemasektennistevatftgththdtheatertheatretiaaticketstiendatiffany"
+    "tipstirestiroltjtjmaxxtjxtktkmaxxtltmtmalltntotodaytokyotoolstoptoraytoshibatotaltourstowntoyota"
+    "toystrtradetradingtrainingtraveltravelchanneltravelerstravelersinsurancetrusttrvtttubetuitunestushu"
+    "tvtvstwtzuaubankubsugukunicomuniversityunouolupsusuyuzvavacationsvanavanguardvcvevegasventuresverisign"
+    "verm\303\266gensberaterverm\303\266gensberatungversicherungvetvgviviajesvideovigvikingvillasvinvip"
+    "virginvisavisionvivavivovlaanderenvnvodkavolkswagenvolvovotevotingvotovoyagevuvueloswaleswalmart"
+    "walterwangwanggouwatchwatchesweatherweatherchannelwebcamweberwebsiteweddingweiboweirwfwhoswhowien"
+    "wikiwilliamhillwinwindowswinewinnerswmewolterskluwerwoodsideworkworksworldwowwswtcwtfxboxxeroxxfinity"
+    "xihuanxinxn--11b4c3dxn--1ck2e1bxn--1qqw23axn--2scrj9cxn--30rr7yxn--3bst00mxn--3ds443gxn--3e0b707e"
+    "xn--3hcrj9cxn--3pxu8kxn--42c2d9axn--45br5cylxn--45brj9cxn--45q11cxn--4dbrk0cexn--4gbrimxn--54b7fta0cc"
+    "xn--55qw42gxn--55qx5dxn--5su34j936bgsgxn--5tzm5gxn--6frz82gxn--6qq986b3xlxn--80adxhksxn--80ao21a"
+    "xn--80aqecdr1axn--80asehdbxn--80aswgxn--8y0a063axn--90a3acxn--90aexn--90aisxn--9dbq2axn--9et52uxn--9krt00a"
+    "xn--b4w605ferdxn--bck1b9a5dre4cxn--c1avgxn--c2br7gxn--cck2b3bxn--cckwcxetdxn--cg4bkixn--clchc0ea0b2g2a9gcd"
+    "xn--czr694bxn--czrs0txn--czru2dxn--d1acj3bxn--d1alfxn--e1a4cxn--eckvdtc9dxn--efvy88hxn--fct429kxn--fhbei"
+    "xn--fiq228c5hsxn--fiq64bxn--fiqs8sxn--fiqz9sxn--fjq720axn--flw351exn--fpcrj9c3dxn--fzc2c9e2cxn--fzys8d69uvgm"
+    "xn--g2xx48cxn--gckr3f0fxn--gecrj9cxn--gk3at1exn--h2breg3evexn--h2brj9cxn--h2brj9c8cxn--hxt814exn--i1b6b1a6a2e"
+    "xn--imr513nxn--io0a7ixn--j1aefxn--j1amhxn--j6w193gxn--jlq480n2rgxn--jvr189mxn--kcrx77d1x4axn--kprw13d"
+    "xn--kpry57dxn--kput3ixn--l1accxn--lgbbat1ad8jxn--mgb2ddesxn--mgb9awbfxn--mgba3a3ejtxn--mgba3a4f16a"
+    "xn--mgba3a4fraxn--mgba7c0bbn0axn--mgbaakc7dvfxn--mgbaam7a8hxn--mgbab2bdxn--mgbah1a3hjkrdxn--mgbai9a5eva00b"
+    "xn--mgbai9azgqp6jxn--mgbayh7gpaxn--mgbbh1axn--mgbbh1a71exn--mgbc0a9azcgxn--mgbca7dzdoxn--mgbcpq6gpa1a"
+    "xn--mgberp4a5d4a87gxn--mgberp4a5d4arxn--mgbgu82axn--mgbi4ecexpxn--mgbpl2fhxn--mgbqly7c0a67fbcxn--mgbqly7cvafr"
+    "xn--mgbt3dhdxn--mgbtf8flxn--mgbtx2bxn--mgbx4cd0abxn--mix082fxn--mix891fxn--mk1bu44cxn--mxtq1mxn--ngbc5azd"
+    "xn--ngbe9e0axn--ngbrxxn--nnx388axn--nodexn--nqv7fxn--nqv7fs00emaxn--nyqy26axn--o3cw4hxn--ogbpf8fl"
+    "xn--otu796dxn--p1acfxn--p1aixn--pgbs0dhxn--pssy2uxn--q7ce6axn--q9jyb4cxn--qcka1pmcxn--qxa6axn--qxam"
+    "xn--rhqv96gxn--rovu88bxn--rvc1e0am3exn--s9brj9cxn--ses554gxn--t60b56axn--tckwexn--tiq49xqyjxn--unup4y"
+    "xn--vermgensberater-ctbxn--vermgensberatung-pwbxn--vhquvxn--vuq861bxn--w4r85el8fhu5dnraxn--w4rs40l"
+    "xn--wgbh1cxn--wgbl6axn--xhq521bxn--xkc2al3hye2axn--xkc2dl3a5ee0hxn--y9a3aqxn--yfro4i67oxn--ygbi2ammx"
+    "xn--zfr164bxxxxyzyachtsyahooyamaxunyandexyeyodobashiyogayokohamayouyoutubeytyunzazapposzarazerozip"
+    "zmzonezuerichzw\316\265\316\273\316\265\317\205\320\261\320\263\320\261\320\265\320\273\320\264\320\265\321\202\320\270"
+    "\320\265\321\216\320\272\320\260\321\202\320\276\320\273\320\270\320\272\320\272\320\276\320\274"
+    "\320\274\320\272\320\264\320\274\320\276\320\275\320\274\320\276\321\201\320\272\320\262\320\260"
+    "\320\276\320\275\320\273\320\260\320\271\320\275\320\276\321\200\320\263\321\200\321\203\321\201"
+    "\321\200\321\204\321\201\320\260\320\271\321\202\321\201\321\200\320\261\321\203\320\272\321\200"
+    "\322\233\320\260\320\267\325\260\325\241\325\265\327\231\327\251\327\250\327\220\327\234\327\247\327\225\327\235"
+    "\330\247\330\250\331\210\330\270\330\250\331\212\330\247\330\252\330\265\330\247\331\204\330\247\330\252"
+    "\330\247\330\261\330\247\331\205\331\203\331\210\330\247\331\204\330\247\330\261\330\257\331\206"
+    "\330\247\331\204\330\250\330\255\330\261\331\212\331\206\330\247\331\204\330\254\330\262\330\247\330\246\330\261"
+    "\330\247\331\204\330\263\330\271\331\210\330\257\331\212\330\251\330\247\331\204\330\263\330\271\331\210\330\257\331\212\331\207"
+    "\330\247\331\204\330\263\330\271\331\210\330\257\333\214\330\251\330\247\331\204\330\263\330\271\331\210\330\257\333\214\333\203"
+    "\330\247\331\204\330\271\331\204\331\212\330\247\331\206\330\247\331\204\331\205\330\272\330\261\330\250"
+    "\330\247\331\204\331\212\331\205\331\206\330\247\331\205\330\247\330\261\330\247\330\252\330\247\331\212\330\261\330\247\331\206"
+    "\330\247\333\214\330\261\330\247\331\206\330\250\330\247\330\261\330\252\330\250\330\247\330\262\330\247\330\261"
+    "\330\250\331\212\330\252\331\203\330\250\332\276\330\247\330\261\330\252\330\252\331\210\331\206\330\263"
+    "\330\263\331\210\330\257\330\247\331\206\330\263\331\210\330\261\331\212\330\247\330\263\331\210\330\261\331\212\330\251"
+    "\330\264\330\250\331\203\330\251\330\271\330\261\330\247\331\202\330\271\330\261\330\250\330\271\331\205\330\247\331\206"
+    "\331\201\331\204\330\263\330\267\331\212\331\206\331\202\330\267\330\261\331\203\330\247\330\253\331\210\331\204\331\212\331\203"
+    "\331\203\331\210\331\205\331\205\330\265\330\261\331\205\331\204\331\212\330\263\331\212\330\247"
+    "\331\205\331\210\330\261\331\212\330\252\330\247\331\206\331\212\330\247\331\205\331\210\331\202\330\271"
+    "\331\207\331\205\330\261\330\247\331\207\331\276\330\247\331\203\330\263\330\252\330\247\331\206"
+    "\331\276\330\247\332\251\330\263\330\252\330\247\331\206\332\200\330\247\330\261\330\252\340\244\225\340\245\211\340\244\256"
+    "\340\244\250\340\245\207\340\244\237\340\244\255\340\244\276\340\244\260\340\244\244\340\244\255\340\244\276\340\244\260\340\244\244\340\244\256\340\245\215"
+    "\340\244\255\340\244\276\340\244\260\340\245\213\340\244\244\340\244\270\340\244\202\340\244\227\340\244\240\340\244\250"
+    "\340\246\254\340\246\276\340\246\202\340\246\262\340\246\276\340\246\255\340\246\276\340\246\260\340\246\244"
+    "\340\246\255\340\246\276\340\247\260\340\246\244\340\250\255\340\250\276\340\250\260\340\250\244"
+    "\340\252\255\340\252\276\340\252\260\340\252\244\340\254\255\340\254\276\340\254\260\340\254\244"
+    "\340\256\207\340\256\250\340\257\215\340\256\244\340\256\277\340\256\257\340\256\276\340\256\207\340\256\262\340\256\231\340\257\215\340\256\225\340\257\210"
+    "\340\256\232\340\256\277\340\256\231\340\257\215\340\256\225\340\256\252\340\257\215\340\256\252\340\257\202\340\256\260\340\257\215"
+    "\340\260\255\340\260\276\340\260\260\340\260\244\340\261\215\340\262\255\340\262\276\340\262\260\340\262\244"
+    "\340\264\255\340\264\276\340\264\260\340\264\244\340\264\202\340\266\275\340\266\202\340\266\232\340\267\217"
+    "\340\270\204\340\270\255\340\270\241\340\271\204\340\270\227\340\270\242\340\272\245\340\272\262\340\272\247"
+    "\341\203\222\341\203\224\343\201\277\343\202\223\343\201\252\343\202\242\343\203\236\343\202\276\343\203\263"
+    "\343\202\257\343\203\251\343\202\246\343\203\211\343\202\260\343\203\274\343\202\260\343\203\253"
+    "\343\202\263\343\203\240\343\202\271\343\203\210\343\202\242\343\202\273\343\203\274\343\203\253"
+    "\343\203\225\343\202\241\343\203\203\343\202\267\343\203\247\343\203\263\343\203\235\343\202\244\343\203\263\343\203\210"
+    "\344\270\226\347\225\214\344\270\255\344\277\241\344\270\255\345\233\275\344\270\255\345\234\213"
+    "\344\270\255\346\226\207\347\275\221\344\272\232\351\251\254\351\200\212\344\274\201\344\270\232"
+    "\344\275\233\345\261\261\344\277\241\346\201\257\345\201\245\345\272\267\345\205\253\345\215\246"
+    "\345\205\254\345\217\270\345\205\254\347\233\212\345\217\260\346\271\276\345\217\260\347\201\243"
+    "\345\225\206\345\237\216\345\225\206\345\272\227\345\225\206\346\240\207\345\230\211\351\207\214"
+    "\345\230\211\351\207\214\345\244\247\351\205\222\345\272\227\345\234\250\347\272\277\345\244\247\346\213\277"
+    "\345\244\251\344\270\273\346\225\231\345\250\261\344\271\220\345\256\266\351\233\273\345\271\277\344\270\234"
+    "\345\276\256\345\215\232\346\205\210\345\226\204\346\210\221\347\210\261\344\275\240\346\211\213\346\234\272"
+    "\346\213\233\350\201\230\346\224\277\345\212\241\346\224\277\345\272\234\346\226\260\345\212\240\345\235\241"
+    "\346\226\260\351\227\273\346\227\266\345\260\232\346\233\270\347\261\215\346\234\272\346\236\204"
+    "\346\267\241\351\251\254\351\224\241\346\270\270\346\210\217\346\276\263\351\226\200\346\276\263\351\227\250"
+    "\347\202\271\347\234\213\347\247\273\345\212\250\347\273\204\347\273\207\346\234\272\346\236\204"
+    "\347\275\221\345\235\200\347\275\221\345\272\227\347\275\221\347\253\231\347\275\221\347\273\234"
+    "\350\201\224\351\200\232\350\207\272\347\201\243\350\260\267\346\255\214\350\264\255\347\211\251"
+    "\351\200\232\350\262\251\351\233\206\345\233\242\351\233\273\350\250\212\347\233\210\347\247\221"
+    "\351\243\236\345\210\251\346\265\246\351\243\237\345\223\201\351\244\220\345\216\205\351\246\231\346\240\274\351\207\214\346\213\211"
+    "\351\246\231\346\270\257\353\213\267\353\204\267\353\213\267\354\273\264\354\202\274\354\204\261"
+    "\355\225\234\352\265\255comdrredugovmilnetorgofficialnomacblogspotcogovmilnetorgschaccident-investigation"
+    "accident-preventionaerobaticaeroclubaerodromeagentsair-surveillanceair-traffic-controlaircraftairline"
+    "airportairtrafficambulanceamusementassociationauthorballooningbrokercaacargocateringcertification"
+    "championshipchartercivilaviationclubconferenceconsultantconsultingcontrolcouncilcrewdesigndgcaeducator"
+    "emergencyengineengineerentertainmentequipmentexchangeexpressfederationflightfuelglidinggovernment"
+    "groundhandlinggrouphangglidinghomebuiltinsurancejournaljournalistleasinglogisticsmagazinemaintenance"
+    "mediamicrolightmodellingnavigationparachutingparaglidingpassenger-associationpilotpressproduction"
+    "recreationrepbodyresresearchrotorcraftsafetyscientistservicesshowskydivingsoftwarestudenttradertrading"
+    "trainerunionworkinggroupworkscomedugovnetorgcocomnetnomorgcomnetofforguwublogspotcomedugovmilnet"
+    "orgblogspotcocomcommunenekonetnyaaorgradiocoedgvitogpbbegetbookonlineclerkclerkstagedetadeveloper"
+    "easypaneledgecomputeencrfirewebframerhasuraloginlinemesserlinetlifynoopnorthflankondigitaloceanonflashdrive"
+    "platform0runsnowflakestreamlittelebittypedreamvercelwebwnextbetcomcoopedugobgovintmilmusicamutual"
+    "netorgsenasature164in-addrip6irisuriurngovcloudns123webseite12hp2ix4limaacbizcofunkfeuerfuturecms"
+    "futurehostingfuturemailinggvinfolima-citymyspreadshoporortsinfoprivactasncomconfedugovidinfonetnsw"
+    "ntorgozqldsatasvicwacombecateseuggmcusxybizcomedugovinfointmilnamenetorgppproblogspotcomedugovmil"
+    "netorgrsausnzbizcocomedugovinfonetorgstoretv123websiteacblogspotinterhostsolutionskuleuvenmyspreadshop"
+    "transurlwebhostinggov0123456789abbarsyblogspotcdefghijklmnopqrstuvwxyzcomedugovnetorgcocomeduororg"
+    "activetrailcloudnsdsclouddyndnsfor-betterfor-morefor-somefor-thejozimmafanmyftpno-iporxselfipwebhop"
+    "africaagroarchitectesassuravocatsblogspotcocomecoeconoeduinfoloisirsmoneynetorgoterestaurantresto"
+    "tourismunivcomedugovnetorgcocomedugovnetorgacademiaagroarteblogboliviacienciacomcooperativademocracia"
+    "deporteecologiaeconomiaeduempresagobindigenaindustriainfointmedicinamilmovimientomusicanaturalnet"
+    "nombrenoticiasorgpatriaplurinacionalpoliticaprofesionalpueblorevistasaludtecnologiatksattransporte"
+    "tvwebwiki9guacuabcadmadvagrajuamananiaparecidaapparqartatobbarueribelembhzbibbioblogbmdboavistabsb"
+    "campinagrandecampinascaxiascimcngcntcomcontagemcoopcozcricuiabacuritibadefdesdetdevecnecoeduempenf"
+    "engespetcetifarfeiraflogfloripafmfndfortalfotfozfstg12geoggfgoianiagovgruimbindinfjabjampajdfjoinville"
+    "jorjusleglelloglondrinamacapamaceiomanausmaringamatmedmilmorenampmusnatalnetniteroinomnotntrodoong"
+    "orgosascopalmaspoappgpropscpsipvhqslradiorecreciferepribeiraorioriobrancoriopretosalvadorsampasantamaria"
+    "santoandresaobernardosaogoncasegsjcslgslzsorocabasrvtaxitctecteothetmptrdturtvudivetvixvlogwikizlg"
+    "comedugovnetorgwecomedugovnetorgcloudsitecocoorgcomgovmediatechmilmycloudofcomedugovgsjnetorgzaab"
+    "awdevbarsybcblogspotcogcmbmyspreadshopnbnfnlno-ipnsntnuonpeqcskyknabucloudnscsxfantasyleagueftpaccess"
+    "game-servermyphotosscrappingspawntwmailgovblogspot123website12hp2ix4limablogspotdnskingfirenetflow"
+    "gotdnslima-citylinkyard-cloudmyspreadshopsquare7acassoa\303\251roportcocomededufingogouvintmdnet"
+    "nlororgpressexn--aroport-byawwwblogspotcogobgovmilaxarnetbanzaidiademelementorencowayjelasticjele"
+    "jenv-arubajotelulukeliwebkuleuvenlinkyardmagentositeon-rancheroxaperspectaprimetelravendbreclaim"
+    "scwsensiositestaticstrafficplextrendhostingurownvaporvoorloperbarsycloudnsjelecocomgovnetacahbjcanva-apps"
+    "comcqedufjgdgovgsgxgzhahbhehihkhlhninstantcloudjljsjxlnmilmonetnmnxorgqhquickconnectscsdshsnsxtj"
+    "twxjxn--55qx5dxn--io0a7ixn--od0algxzynzj\345\205\254\345\217\270\347\266\262\347\265\241\347\275\221\347\273\234"
+    "artscarrdcomcrdedufirewalledreplitfirmgovinfointleadpageslpagesmilmypin4tnetnomorgotaprecreplsupabase"
+    "webowo001www0emm1kapp3utilities4uadobeaemcloudafricaairkitappsairkitapps-auaivencloudalpha-myqnapcloud"
+    "amazonawsamscomputeappchiziapplinziappspacehostedappspaceusercontentappspotarauthgear-stagingauthgearapps"
+    "awsglobalacceleratorawsmpplbalena-devicesbarsycenterbarsyonlinebetainaboxblogdnsblogspotblogsyte"
+    "bloxcmsbounty-fullboutirbplacedbrbuiltwithdarkcafjscanva-appscechirecf-ipfsciscofreakclicketcloud"
+    "cloudcontrolappcloudcontrolledcloudflare-ipfscncocodecodespotcustomer-ocidamnserverdatadetectdattolocal"
+    "dattorelaydattowebddns5ddnsfreeddnsgeekddnskingddnslivededev-myqnapclouddevcdnaccessodigitaloceanspaces"
+    "discordsaysdiscordsezditchyouripdnsaliasdnsdojodnsiskinkydoesntexistdontexistdoomdnsdopaasdrayddns"
+    "dreamhostersdsmynasdyn-o-saurdynaliasdyndns-at-homedyndns-at-workdyndns-blogdyndns-freedyndns-home"
+    "dyndns-ipdyndns-maildyndns-officedyndns-picsdyndns-remotedyndns-serverdyndns-webdyndns-wikidyndns-work"
+    "dynnselasticbeanstalkencoreapiest-a-la-maisonest-a-la-masionest-le-patronest-mon-blogueureuevennode"
+    "familydsfastly-edgefastly-terrariumfastvps-serverfbsbxfirebaseappfirewall-gatewayfldrvforgeblocks"
+    "framercanvasfreebox-osfreeboxosfreemyipfrom-akfrom-alfrom-arfrom-cafrom-ctfrom-dcfrom-defrom-flfrom-ga"
+    "from-hifrom-iafrom-idfrom-ilfrom-infrom-ksfrom-kyfrom-mafrom-mdfrom-mifrom-mnfrom-mofrom-msfrom-mt"
+    "from-ncfrom-ndfrom-nefrom-nhfrom-njfrom-nmfrom-nvfrom-ohfrom-okfrom-orfrom-pafrom-prfrom-rifrom-sc"
+    "from-sdfrom-tnfrom-txfrom-utfrom-vafrom-vtfrom-wafrom-wifrom-wvfrom-wygeekgalaxygentappsgentlentapis"
+    "getmyipgiizegithubusercontentgleezegoogleapisgooglecodegotdnsgotpantheongrhealth-carereformherokuapp"
+    "herokusslhidorahkhobby-sitehomelinuxhomesecuritymachomesecuritypchomeunixhosted-by-previderhostedpi"
+    "hosteurhotelwithflighthuiamallamaik-serverimpertriximpertrixcdnis-a-anarchistis-a-bloggeris-a-bookkeeper"
+    "is-a-bulls-fanis-a-catereris-a-chefis-a-conservativeis-a-cpais-a-cubicle-slaveis-a-democratis-a-designer"
+    "is-a-doctoris-a-financialadvisoris-a-geekis-a-greenis-a-guruis-a-hard-workeris-a-hunteris-a-landscaper"
+    "is-a-lawyeris-a-liberalis-a-libertarianis-a-llamais-a-musicianis-a-nascarfanis-a-nurseis-a-painter"
+    "is-a-personaltraineris-a-photographeris-a-playeris-a-republicanis-a-rockstaris-a-socialistis-a-student"
+    "is-a-teacheris-a-techieis-a-therapistis-an-accountantis-an-actoris-an-actressis-an-anarchistis-an-artist"
+    "is-an-engineeris-an-entertaineris-certifiedis-goneis-into-animeis-into-carsis-into-cartoonsis-into-games"
+    "is-leetis-not-certifiedis-slickis-uberleetis-with-thebandisa-geekisa-hockeynutissmarterthanyouit"
+    "jdevcloudjelasticjoyentjpnkasserverkilatironkozowkrktistorylikes-pielikescandylinodelinodeobjects"
+    "linodeusercontentlmpmlogoiploseyouriplpusercontentmassivegridmazeplaymesswithdnsmeteorappmexminiserver"
+    "myactivedirectorymyasustormydattomydobissmydrobomyiphostmyqnapcloudmysecuritycameramyshopblocksmyshopify"
+    "myspreadshopmytabitmythic-beastsmytuleapmyvncneat-urlnet-freaksnfshostnonospamproxyobservableusercontent"
+    "on-aptibleonfabricaonrenderonthewifiooguyoperauniteorsitesoutsystemscloudownproviderpagefrontapp"
+    "pagespeedmobilizerpagexlpaywhirlpgfogpixolinoplatter-appplaystation-cloudplesknspoint2thispostman-echo"
+    "prgmrpublishproxypythonanywhereqa2qbuserqcqualifioappquicksytesquipelementsrackmazeremotewdrender"
+    "reservdreserve-onlinerhcloudrusasaves-the-whalesscrysecsecuritytacticsselfipsells-for-lesssells-for-u"
+    "servebbsservebeerservecounterstrikeserveexchangeserveftpservegameservehalflifeservehttpservehumour"
+    "serveircservemp3servep2pservepicsservequakeservesarcasmshopitsitesiiitessimple-urlsimplesitesinaapp"
+    "skygearappsmushcdnspace-to-rentstackhero-networkstdlibstreamlitappstufftoreadtb-hostingteaches-yoga"
+    "temp-dnstheworkpcthingdustdatatownnews-stagingtry-snowplowtrycloudflaretuleap-partnerstypeformuk"
+    "unusualpersonusuyvipsinaappvultrobjectswafaicloudwafflecellwiardwebwithgooglewithyoutubewixsitewoltlab-demo"
+    "workisboringwpdevcloudwpenginepoweredwphostedmailwpmucdnwritesthisblogxnbayyolasitezamyforumnogravendb"
+    "deelementoraccoedfigoorsacomedugovinfnetorgblogspotcomeduintnomeorgcomedunetorgathgovinfoacbizcom"
+    "eklogesgovltdmilnetorgpressprotmblogspotcoe4metacentrummunirealm123webseite12hp2ix4limabarsyblogspot"
+    "bplacedcomcommunity-procosidnsdd-dnsddnssdiskussionsbereichdnshomednsupdaterdray-dnsdraydnsdyn-berlin"
+    "dyn-ip24dyn-vpndynamisches-dnsdyndns1dynvpnfirewall-gatewayfruskyfuettertdasnetzgit-reposgoipg\303\274nstigbestellen"
+    "g\303\274nstigliefernhome-webserverhs-heilbronnin-berlinin-brbin-butterin-dslin-vpninternet-dnsiservschule"
+    "isteingeekistmeinkeymachinel-o-g-i-nlcube-serverlebtimnetzleitungsenlima-citylogoipmein-iservmein-vigor"
+    "my-gatewaymy-routermy-vigormy-wanmyhome-servermyspreadshopschulplattformschulserverspdnsspeedpartner"
+    "square7svn-repossyno-dssynology-diskstationsynology-dstaifun-dnstest-iservtraeumtgeradeuberspace"
+    "virtual-uservirtualuserxn--gnstigbestellen-zvbxn--gnstigliefern-wobbssautocodecurvdenodeno-staging"
+    "detaflygatewaygithubpreviewiservlcllclstagelocalcertloginlinemediatechpagesplatter-appr2shiftcrypto"
+    "stgstgstagevercelwebhareworkerscloudapps123hjemmesidebizblogspotcofirmmyspreadshopregstorecomedu"
+    "govnetorgartcomedugobgovmilnetorgsldwebartassocomedugovnetorgpolsoctmdappsbasecomedufingobgovinfo"
+    "k12medmilnetofficialorgproritcoaipcomedufiegovlibmedorgpririikcomedueungovmilnamenetorgsci123miweb"
+    "comedugobmyspreadshopnomorgcomputebizcomedugovinfonamenetorgairkitappsbarsycloudnsdiskstationdogado"
+    "mycdspdnstransurlwellbeingzonepartycokoobinybostorj123kotisivualandblogspotcloudplatformdatacenter"
+    "dyh\303\244kkinenikikapsimyspreadshopxn--hkkinen-5wacoacbizcomgovinfomilnamenetorgprocomedunetorg"
+    "radiouser123sitewebaeroportassoavocatavouesblogspotccichambagrichirurgiens-dentisteschirurgiens-dentistes-en-france"
+    "comdediboxen-rootexperts-comptablesfbx-osfbxosfreebox-osfreeboxosgeometre-expertgoupilegouvgreta"
+    "huissier-justicemedecinmyspreadshopnomnotaireson-webpharmacienportprdtmveterinaireynhedugovcnpycom"
+    "edugovmilnetorgpvtcocyakaasnetorgpanelcomedugovmilorgcomedugovltdmodorgbizcocomedunetorgxxaccomedu"
+    "govnetorgcloudtranslateusercontentappassocomedumobinetorgblogspotcomedugovnetorgsimplesitediscourse"
+    "blogcomdeedugobindmilnetorgtocomedugovguaminfonetorgwebbecocomedugovnetorghrablogspotcomedugovidv"
+    "incltdnetorgsecaasxn--55qx5dxn--ciqpnxn--gmq050ixn--gmqw5axn--io0a7ixn--lcvr32dxn--mk0axixn--mxtq1m"
+    "xn--od0algxn--od0aq3bxn--tn0agxn--uc0atvxn--uc0ay4axn--wcvs22dxn--zf0avx\344\270\252\344\272\272"
+    "\345\200\213\344\272\272\345\205\254\345\217\270\346\224\277\345\272\234\346\225\216\350\202\262"
+    "\346\225\231\350\202\262\347\256\207\344\272\272\347\265\204\347\271\224\347\265\204\347\273\207"
+    "\347\266\262\347\265\241\347\266\262\347\273\234\347\273\204\347\271\224\347\273\204\347\273\207"
+    "\347\275\221\347\265\241\347\275\221\347\273\234cccomedugobmilnetorgcloudaccesseasypanelfastvpsfreesite"
+    "halfjelemircloudmyfastpcloudtempurlwpmudevopencraftblogspotcomfreefromiznameadultartassocomcoopedu"
+    "firmgouvinfomednetorgpersopolprorelshop2000agrarblogspotboltcasinocitycoeroticaerotikafilmforumgames"
+    "hotelinfoingatlanjogaszkonyvelolakasmedianewsorgprivreklamsexshopsportsuliszextmtozsdeutazasvideo"
+    "acbizcodesaflapfortegomilmynetorponpesschwebblogspotgovmyspreadshopaccogovidfk12muninetorgaccocom"
+    "netorgrotttv5g6gacaiambarsybiharbizblogspotbusinesscacloudnscncocomcoopcsdelhidreduerfirmgengovgujarat"
+    "indinfointinternetiomemilnetnicorgpgpostproressupabasetraveltvukupuswebbarrel-of-knowledgebarrell-of-knowledge"
+    "barsycloudnsdnsupdatedvrcamdynamic-dnsdyndnsfor-ourforumzgroks-thegroks-thishere-for-moreilovecollege"
+    "knowsitallmayfirstno-ipnsupdateselfipv-infowebhopeu2038apigeeazurecontainerb-databackplaneappbanzaicloud"
+    "barsybasicserverbeagleboardbeebytebeebyteappbigvbitbucketbluebiteboxfusebrowsersafetymarkcleverapps"
+    "comdappnodededyndefinimadruddyn53editorxedugitfh-muensterforgerockghostgithubgitlabhasura-apphostyhosting"
+    "hzcjelelairloginlinelolipopmo-siemensmoonscalemusicianngroknidnodearton-acornon-k3son-riopantheonsite"
+    "protonetpstmnqcxqotoreadthedocsresindeviceresinstagings5ysandcatsshiftcryptoshifteditshwspacekit"
+    "stolostelebitthingdustticketsunispaceupliutwentevaporcloudvbrplsbxvirtualserverwebthingswedeploy"
+    "comedugovmilnetorgaccogovidnetorgschxn--mgba3a4f16axn--mgba3a4fra\330\247\331\212\330\261\330\247\331\206"
+    "\330\247\333\214\330\261\330\247\331\206blogspotcomcupcakeedugovintnetorg123homepage16-b32-b64-b"
+    "abrabruzzoagagrigentoalalessandriaalto-adigealtoadigeananconaandria-barletta-traniandria-trani-barletta"
+    "andriabarlettatraniandriatranibarlettaaoaostaaosta-valleyaostavalleyaosteapaqaquilaararezzoascoli-piceno"
+    "ascolipicenoastiatavavellinobabalsanbalsan-sudtirolbalsan-suedtirolbalsan-s\303\274dtirolbaribarletta-trani-andria"
+    "barlettatraniandriabasbasilicatabellunobeneventobergamobgbibiellablblogspotbnbobolognabolzanobolzano-altoadige"
+    "bozenbozen-sudtirolbozen-suedtirolbozen-s\303\274dtirolbrbresciabrindisibsbtbulsanbulsan-sudtirol"
+    "bulsan-suedtirolbulsan-s\303\274dtirolbzcacagliaricalcalabriacaltanissettacamcampaniacampidano-medio"
+    "campidanomediocampobassocarbonia-iglesiascarboniaiglesiascarrara-massacarraramassacasertacatania"
+    "catanzarocbcecesena-forlicesena-forl\303\254cesenaforlicesenaforl\303\254chchieticiclcncocomocosenza"
+    "crcremonacrotonecsctcuneoczdell-ogliastradellogliastraeduemilia-romagnaemiliaromagnaemrenennafcfe"
+    "fermoferrarafgfifirenzeflorencefmfoggiaforli-cesenaforlicesenaforl\303\254-cesenaforl\303\254cesena"
+    "frfriuli-v-giuliafriuli-ve-giuliafriuli-vegiuliafriuli-venezia-giuliafriuli-veneziagiuliafriuli-vgiulia"
+    "friuliv-giuliafriulive-giuliafriulivegiuliafriulivenezia-giuliafriuliveneziagiuliafriulivgiuliafrosinone"
+    "fvggegenoagenovagogoriziagovgrgrossetoibxosiglesias-carboniaiglesiascarboniailiadboxosimimperiais"
+    "iserniakrla-spezialaquilalaspezialatinalazlaziolclelecceleccoliligligurialivornololodilomlombardia"
+    "lombardyltlulucanialuccamaceratamantovamarmarchemassa-carraramassacarraramaterambmcmemedio-campidano"
+    "mediocampidanomessinamimilanmilanomnmomodenamolmolisemonzamonza-brianzamonza-e-della-brianzamonzabrianza"
+    "monzaebrianzamonzaedellabrianzamsmtmyspreadshopnanaplesnapolineennonovaranunuoroogogliastraolbia-tempio"
+    "olbiatempioororistanootpapadovapaduapalermoparmapaviapcpdpeperugiapesaro-urbinopesarourbinopescara"
+    "pgpipiacenzapiedmontpiemontepisapistoiapmnpnpopordenonepotenzaprpratoptpupugpugliapvpzraragusaravenna"
+    "rcrereggio-calabriareggio-emiliareggiocalabriareggioemiliargririetiriminirmrnroromaromerovigosasalerno"
+    "sarsardegnasardiniasassarisavonasisicsiciliasicilysienasiracusasosondriospsrsssuedtirolsvsyncloud"
+    "s\303\274dtiroltataatarantotetempio-olbiatempioolbiateramoternitimtntotorinotostoscanatptrtrani-andria-barletta"
+    "trani-barletta-andriatraniandriabarlettatranibarlettaandriatrapanitrentin-sud-tiroltrentin-sudtirol"
+    "trentin-sued-tiroltrentin-suedtiroltrentin-s\303\274d-tiroltrentin-s\303\274dtiroltrentinotrentino-a-adige"
+    "trentino-aadigetrentino-alto-adigetrentino-altoadigetrentino-s-tiroltrentino-stiroltrentino-sud-tirol"
+    "trentino-sudtiroltrentino-sued-tiroltrentino-suedtiroltrentino-s\303\274d-tiroltrentino-s\303\274dtirol"
+    "trentinoa-adigetrentinoaadigetrentinoalto-adigetrentinoaltoadigetrentinos-tiroltrentinostiroltrentinosud-tirol"
+    "trentinosudtiroltrentinosued-tiroltrentinosuedtiroltrentinos\303\274d-tiroltrentinos\303\274dtirol"
+    "trentinsud-tiroltrentinsudtiroltrentinsued-tiroltrentinsuedtiroltrentins\303\274d-tiroltrentins\303\274dtirol"
+    "trentotrevisotriestetsturintuscanytvududineumbumbriaurbino-pesarourbinopesarovaval-d-aostaval-daosta"
+    "vald-aostavaldaostavalle-aostavalle-d-aostavalle-daostavalleaostavalled-aostavalledaostavallee-aoste"
+    "vallee-d-aostevalleeaostevalleedaostevall\303\251e-aostevall\303\251e-d-aostevall\303\251eaostevall\303\251edaoste"
+    "vaovaresevbvcvdavevenvenetoveneziaveniceverbaniavercelliveronavivibo-valentiavibovalentiavicenza"
+    "viterbovrvsvtvvxn--balsan-sdtirol-nsbxn--bozen-sdtirol-2obxn--bulsan-sdtirol-nsbxn--cesena-forl-mcb"
+    "xn--cesenaforl-i8axn--forl-cesena-fcbxn--forlcesena-c8axn--sdtirol-n2axn--trentin-sd-tirol-rzbxn--trentin-sdtirol-7vb"
+    "xn--trentino-sd-tirol-c3bxn--trentino-sdtirol-szbxn--trentinosd-tirol-rzbxn--trentinosdtirol-7vb"
+    "xn--trentinsd-tirol-6vbxn--trentinsdtirol-nsbxn--valle-aoste-ebbxn--valle-d-aoste-ehbxn--valleaoste-e7a"
+    "xn--valledaoste-ebbconetoforgcomedugovmilnamenetorgschacadaichiakitaangryaomoribabybluebabymilkbackdrop"
+    "bambinabitterblogspotblushbooboyboyfriendbutbuyshopcandypopcapoocatfoodcheapchibachicappachillout"
+    "chipschowderchuciaocococottecoolblogcrankycutegirldaadecadecidigickedegoismehimefakefurfashionstore"
+    "femflierfloppyfoolfrenchkissfukuifukuokafukushimagifugirlfriendgirlygloomygogonnagrgreatergunmahacca"
+    "handcraftedheavyherhihohippyhiroshimahokkaidoholyhungryhyogoibarakiicurusishikawaitigoiwatejellybean"
+    "kagawakagoshimakanagawakawaiishopkawasakikikirarakillkilokitakyushukobekochikumamotokuronkyotolg"
+    "littlestarlolipopmclolitapunklomolovepoplovesickmainmiemiyagimiyazakimodsmondmongolianmoonaganonagasaki"
+    "nagoyanamastenaraneniigatanikitanobushinooroitaokayamaokinawaoopsorosakaparallelparasitepecoripeewee"
+    "pennepepperpermapigboatpinokopunyupupupussycatpyaraindropreadymadesadistsagasaitamasapporoschoolbus"
+    "secretsendaishigashimaneshizuokastabastrippersubsunnydaysupersaletheshopthicktochigitokushimatokyo"
+    "tonkotsutottoritoyamaunderupperusercontentvelvetverseversusvivianwakayamawatsonweblikewhitesnowxn--0trq7p7nn"
+    "xn--1ctwoxn--1lqs03nxn--1lqs71dxn--2m4a15exn--32vp30hxn--4it168dxn--4it797kxn--4pvxsxn--5js045dxn--5rtp49c"
+    "xn--5rtq34kxn--6btw5axn--6orx2rxn--7t0a264cxn--8ltr62kxn--8pvr4uxn--c3s14mxn--d5qv7z876cxn--djrs72d6uy"
+    "xn--djty4kxn--efvn9sxn--ehqz56nxn--elqq16hxn--f6qx53axn--k7yn95exn--kbrq7oxn--klt787dxn--kltp7dxn--kltx9a"
+    "xn--klty5xxn--mkru45ixn--nit225kxn--ntso0iqx3axn--ntsq17gxn--pssu33lxn--qqqt11mxn--rht27zxn--rht3d"
+    "xn--rht61exn--rny31hxn--tor131oxn--uist22hxn--uisz3gxn--uuwu58axn--vgu402cxn--zbx025dyamagatayamaguchi"
+    "yamanashiyokohamazombie\344\270\211\351\207\215\344\272\254\351\203\275\344\275\220\350\263\200\345\205\265\345\272\253"
+    "\345\214\227\346\265\267\351\201\223\345\215\203\350\221\211\345\222\214\346\255\214\345\261\261"
+    "\345\237\274\347\216\211\345\244\247\345\210\206\345\244\247\351\230\252\345\245\210\350\211\257"
+    "\345\256\256\345\237\216\345\256\256\345\264\216\345\257\214\345\261\261\345\261\261\345\217\243"
+    "\345\261\261\345\275\242\345\261\261\346\242\250\345\262\220\351\230\234\345\262\241\345\261\261"
+    "\345\262\251\346\211\213\345\263\266\346\240\271\345\272\203\345\263\266\345\276\263\345\263\266"
+    "\346\204\233\345\252\233\346\204\233\347\237\245\346\226\260\346\275\237\346\235\261\344\272\254"
+    "\346\240\203\346\234\250\346\262\226\347\270\204\346\273\213\350\263\200\347\206\212\346\234\254"
+    "\347\237\263\345\267\235\347\245\236\345\245\210\345\267\235\347\246\217\344\272\225\347\246\217\345\262\241"
+    "\347\246\217\345\263\266\347\247\213\347\224\260\347\276\244\351\246\254\350\214\250\345\237\216"
+    "\351\225\267\345\264\216\351\225\267\351\207\216\351\235\222\346\243\256\351\235\231\345\262\241"
+    "\351\246\231\345\267\235\351\253\230\347\237\245\351\263\245\345\217\226\351\271\277\345\205\220\345\263\266"
+    "accogoinfomemobineorscblogcomedugoviojpmilnetorgtvukusbizcomedugovinfonetorgassassocomcoopedugouv"
+    "govmedecinmilnomnotairesorgpharmaciensprdpressetmveterinaireedugovnetorgcomedugovorgreptraacblogspot"
+    "busanchungbukchungnamcodaegudaejeonesgangwongogwangjugyeongbukgyeonggigyeongnamhsincheonjejujeonbuk"
+    "jeonnamkgmilmsneorperescseoululsancoeducomeduembgovindnetorgcomedunetorgcomedugovjcloudkazteleport"
+    "milnetorgbnrccomedugovinfointnetorgperstaticcomedugovnetorgcocomedugovnetorgoyblogspotcaacyondweb"
+    "mypephlxacassncomedugovgrphotelintltdnetngoorgschsocwebomgcomedugovnetorgacbizcodeedugovinfonetorg"
+    "scblogspotgov123websiteblogspotasncomconfedugovidmilnetorgcomedugovidmednetorgplcschaccogovnetorg"
+    "pressrouterassotmatblogspotdejptoacbarsybrasiliac66codaplieddnsdiskstationdnsfordscloudedgestack"
+    "edufilegearfilegear-aufilegear-defilegear-gbfilegear-iefilegear-jpfilegear-sgglitchgovhoptoi234its"
+    "logintolohmusmcdirmcpemydsnetnohostnoiporgprivravendbsoundcastsynologytcp4transipvp4webhopwedeploy"
+    "yomboframerbarsycocomedugovmilnomorgprdtmblogspotcomedugovinfnamenetorgcomedugouvgovnetorgpresse"
+    "edugovnycorgcomedugovnetorgbarsydscloudjublogspotgovcomedugovlabminisitenetorgcomedunetorgaccocom"
+    "govnetororgacademyagricultureairairguardalabamaalaskaamberambulanceamericanamericanaamericanantiques"
+    "americanartamsterdamandannefrankanthroanthropologyantiquesaquariumarboretumarchaeologicalarchaeology"
+    "architectureartartanddesignartcenterartdecoarteducationartgalleryartsartsandcraftsasmatartassassination"
+    "assisiassociationastronomyatlantaaustinaustraliaautomotiveaviationaxisbadajozbaghdadbahnbalebaltimore"
+    "barcelonabaseballbaselbathsbauernbeauxartsbeeldengeluidbellevuebergbauberkeleyberlinbernbiblebilbao"
+    "billbirdartbirthplacebonnbostonbotanicalbotanicalgardenbotanicgardenbotanybrandywinevalleybrasil"
+    "bristolbritishbritishcolumbiabroadcastbrunelbrusselbrusselsbruxellesbuildingburghofbusbusheycadaques"
+    "californiacambridgecancanadacapebretoncarriercartoonartcasadelamonedacastlecastrescelticcenterchattanooga"
+    "cheltenhamchesapeakebaychicagochildrenchildrenschildrensgardenchiropracticchocolatechristiansburg"
+    "cincinnaticinemacircuscivilisationcivilizationcivilwarclintonclockcoalcoastaldefencecodycoldwarcollection"
+    "colonialwilliamsburgcoloradoplateaucolumbiacolumbuscommunicationcommunicationscommunitycomputercomputerhistory"
+    "comunica\303\247\303\265escontemporarycontemporaryartconventcopenhagencorporationcorreios-e-telecomunica\303\247\303\265es"
+    "corvettecostumecountryestatecountycraftscranbrookcreationculturalculturalcenterculturecybercymru"
+    "dalidallasdatabaseddrdecorativeartsdelawaredelmenhorstdenmarkdepotdesigndetroitdinosaurdiscovery"
+    "dollsdonostiadurhameastafricaeastcoasteducationeducationalegyptianeisenbahnelburgelvendrellembroidery"
+    "encyclopedicenglandentomologyenvironmentenvironmentalconservationepilepsyessexestateethnologyexeter"
+    "exhibitionfamilyfarmfarmequipmentfarmersfarmsteadfieldfigueresfilateliafilmfineartfineartsfinland"
+    "flandersfloridaforcefortmissoulafortworthfoundationfrancaisefrankfurtfranziskanerfreemasonryfreiburg"
+    "fribourgfrogfundaciofurnituregallerygardengatewaygeelvinckgemologicalgeologygeorgiagiessenglasglass"
+    "gorgegrandrapidsgrazguernseyhalloffamehamburghandsonharvestcelebrationhawaiihealthheimatunduhren"
+    "hellashelsinkihembygdsforbundheritagehistoirehistoricalhistoricalsocietyhistorichouseshistorisch"
+    "historischeshistoryhistoryofsciencehorologyhousehumanitiesillustrationimageandsoundindianindiana"
+    "indianapolisindianmarketintelligenceinteractiveiraqironisleofmanjamisonjeffersonjerusalemjewelry"
+    "jewishjewishartjfkjournalismjudaicajudygarlandjuedischesjuifkaratekarikaturkidskoebenhavnkoelnkunst"
+    "kunstsammlungkunstunddesignlaborlabourlajollalancashirelandeslanslarssonlewismillerlincolnlinzliving"
+    "livinghistorylocalhistorylondonlosangeleslouvreloyalistlucerneluxembourgluzernl\303\244nsmadmadrid"
+    "mallorcamanchestermansionmansionsmanxmarburgmaritimemaritimomarylandmarylhurstmediamedicalmedizinhistorisches"
+    "meeresmemorialmesaverdemichiganmidatlanticmilitarymillminersminingminnesotamissilemissoulamodern"
+    "momamoneymonmouthmonticellomontrealmoscowmotorcyclemuenchenmuenstermulhousemunciemuseetmuseumcenter"
+    "museumverenigingmusicnationalnationalfirearmsnationalheritagenativeamericannaturalhistorynaturalhistorymuseum"
+    "naturalsciencesnaturenaturhistorischesnatuurwetenschappennaumburgnavalnebraskaneuesnewhampshirenewjersey"
+    "newmexiconewportnewspapernewyorkniepcenorfolknorthnrwnycnynyoceanographicoceanographiqueomahaonline"
+    "ontarioopenairoregonoregontrailotagooxfordpacificpaderbornpalacepaleopalmspringspanamaparispasadena"
+    "pharmacyphiladelphiaphiladelphiaareaphilatelyphoenixphotographypilotspittsburghplanetariumplantation"
+    "plantsplazaportalportlandportlligatposts-and-telecommunicationspreservationpresidiopressprojectpublic"
+    "pubolquebecrailroadrailwayresearchresistanceriodejaneirorochesterrockartromarussiasaintlouissalem"
+    "salvadordalisalzburgsandiegosanfranciscosantabarbarasantacruzsantafesaskatchewansatxsavannahgaschlesisches"
+    "schoenbrunnschokoladenschoolschweizsciencescience-fictionscienceandhistoryscienceandindustrysciencecenter"
+    "sciencecenterssciencehistorysciencessciencesnaturellesscotlandseaportsettlementsettlersshellsherbrooke"
+    "sibeniksilkskiskolesocietysolognesoundandvisionsouthcarolinasouthwestspacespysquarestadtstalbans"
+    "starnbergstatestateofdelawarestationsteamsteiermarkstjohnstockholmstpetersburgstuttgartsuissesurgeonshall"
+    "surreysvizzeraswedensydneytanktcmtechnologytelekommunikationtelevisiontexastextiletheatertimetimekeeping"
+    "topologytorinotouchtowntransporttreetrolleytrusttrusteeuhrenulmunderseauniversityusausantiquesusarts"
+    "uscountryestateuscultureusdecorativeartsusgardenushistoryushuaiauslivinghistoryutahuvicvalleyvantaa"
+    "versaillesvikingvillagevirginiavirtualvirtuelvlaanderenvolkenkundewaleswalloniewarwashingtondcwatch-and-clock"
+    "watchandclockwesternwestfalenwhalingwildlifewilliamsburgwindmillworkshopxn--9dbhblg6dixn--comunicaes-v6a2o"
+    "xn--correios-e-telecomunicaes-ghc29axn--h1aeghxn--lns-qlayorkyorkshireyosemiteyouthzoologicalzoology"
+    "\320\270\320\272\320\276\320\274\327\231\327\250\327\225\327\251\327\234\327\231\327\235aerobizcom"
+    "coopedugovinfointmilmuseumnamenetorgproacbizcocomcoopedugovintmuseumnetorgblogspotcomedugobnetorg"
+    "bizblogspotcomedugovmilnamenetorgacadvcoedugovmilnetorgcacccocomdrininfomobimxnameororgproschool"
+    "tvuswsherhisassonomadobeaemcloudadobeio-staticadobeioruntimeakadnsakamaiakamai-stagingakamaiedge"
+    "akamaiedge-stagingakamaihdakamaihd-stagingakamaioriginakamaiorigin-stagingakamaizedakamaized-staging"
+    "alwaysdataappudoat-band-campatlassian-devazure-mobileazurestaticappsazurewebsitesbar0bar1bar2barsy"
+    "bitbridgeblackbaudcdnblogdnsboomlabouncemebplacedbroke-itbuyshousescasacamcdn-edgescdn77cdn77-ssl"
+    "channelsdvrclickrisingcloudaccesscloudappcloudfrontcloudfunctionscloudjiffycloudyclustercommunity-pro"
+    "cryptonomicdattolocalddnsdebiandefinimadnsaliasdnsdojodnsupdoes-itdontexistdsmynasdynaliasdynathome"
+    "dynudynv6eating-organicedgeappedgekeyedgekey-stagingedgesuiteedgesuite-stagingelastxendofinternet"
+    "familydsfastlyfastlylbfaststacksfeste-ipfirewall-gatewayflynnhostingfrom-azfrom-cofrom-lafrom-ny"
+    "gbgets-itham-radio-ophetemlhicamhomeftphomeiphomelinuxhomeunixhuinin-dslin-the-bandin-vpniobbipifony"
+    "is-a-chefis-a-geekisa-geekjpkicks-asskinghostknx-serverkrellianmassivegridmeinforummemsetmoonscale"
+    "myamazemydattomydissentmyeffectmyfritzmymediapcmypsxmysecuritycameramyspreadshopnhlfanno-ipnow-dns"
+    "office-on-theonavstackovhownippgafanpodzoneprivatizehealthinsurancerackmazeredirectmereserve-online"
+    "rusaveincloudscaleforceschokokeksscrapper-siteseseidatselfipsells-itsenseeringservebbsserveblogserveftp"
+    "serveminecraftshopselectsiteleafsquare7srcfstatic-accesssupabasesytest3l3p0rttailscalethruheretorproject"
+    "tstsukaerutwmailukuni5vpndnsvps-hostwebhopyandexcloudzaalcesarvoazimuthcotlonnoticeableartscomfirm"
+    "infonetotherperrecstorewebcolcomedufirmgengoviltdmilmobinamenetngoorgschacbizcocomedugobininfoint"
+    "milnetnomorgweb123websiteblogspotcistroncodemongovhosting-clusterkhplaymyspreadshoptransurl123hjemmeside"
+    "aaaarborteaejrieafjordagdenesahakershusaknoluoktaakrehamnalalaheadjualesundalgardalstahaugaltaalvdal"
+    "amliamotandasuoloandebuandoyand\303\270yardalaremarkarendalarnaaseralaskeraskimaskoyaskvollask\303\270y"
+    "asnesaudnedalnaukraaureaurlandaurskog-holandaurskog-h\303\270landaustevollaustrheimaveroyaver\303\270y"
+    "badaddjabahcavuotnabahccavuotnabaidarbajddarbalatbalestrandballangenbalsfjordbamblebardubarumbatsfjord"
+    "bearalvahkibearalv\303\241hkibeardubeiarnbergbergenberlevagberlev\303\245gbievatbiev\303\241tbindal"
+    "birkenesbjarkoybjark\303\270ybjerkreimbjugnblogspotbodobod\303\270boknbomlobremangerbronnoybronnoysund"
+    "brumunddalbrynebr\303\270nn\303\270ybr\303\270nn\303\270ysundbubudejjubuskerudbyglandbykleb\303\241hcavuotna"
+    "b\303\241hccavuotnab\303\241id\303\241rb\303\241jddarb\303\241l\303\241tb\303\245d\303\245ddj\303\245"
+    "b\303\245tsfjordb\303\246rumb\303\270mlocahcesuolocodavvenjargadavvenj\303\241rgadavvesiidadeatnu"
+    "depdielddanuorridivtasvuodnadivttasvuotnadonnadovredrammendrangedaldrobakdr\303\270bakdyroydyr\303\270y"
+    "d\303\270nnaegersundeideidfjordeidsbergeidskogeidsvolleigersundelverumenebakkengerdaletneetnedal"
+    "evenassieveneseven\303\241\305\241\305\241ievje-og-hornnesfarsundfauskefedjefetfetsundfhsfinnoyfinn\303\270y"
+    "fitjarfjalerfjellflaflakstadflatangerflekkefjordflesbergflorafloroflor\303\270fl\303\245fmfolkebibl"
+    "folldalfordeforsandfosnesfranafredrikstadfreifrognfrolandfrostafroyafr\303\246nafr\303\270yafuoisku"
+    "fuosskofusafylkesbiblfyresdalf\303\270rdegaivuotnagalsagamvikgangaviikagaulargausdalgiehtavuoatna"
+    "gildeskalgildesk\303\245lgiskegjemnesgjerdrumgjerstadgjesdalgjovikgj\303\270vikgloppengolgrangrane"
+    "granvingratangengrimstadgronggruegulenguovdageaidnug\303\241ivuotnag\303\241ls\303\241g\303\241\305\213gaviika"
+    "hahabmerhadselhagebostadhaldenhalsahamarhamaroyhammarfeastahammerfesthapmirharamhareidharstadhasvik"
+    "hattfjelldalhaugesundhedmarkhemnehemneshemsedalheradhitrahjartdalhjelmelandhlhmhobolhob\303\270l"
+    "hofhokksundholholeholmestrandholtalenholt\303\245lenhonefosshordalandhornindalhortenhoyangerhoylandet"
+    "hurdalhurumhvalerhyllestadh\303\241bmerh\303\241mm\303\241rfeastah\303\241pmirh\303\245h\303\246gebostad"
+    "h\303\270nefossh\303\270yangerh\303\270ylandetibestadidrettinderoyinder\303\270yivelandivgujan-mayen"
+    "jessheimjevnakerjolsterjondaljorpelandj\303\270lsterj\303\270rpelandkafjordkarasjohkakarasjokkarlsoy"
+    "karmoykarm\303\270ykautokeinokirkenesklabukleppkl\303\246bukommunekongsbergkongsvingerkopervikkraanghke"
+    "kragerokrager\303\270kristiansandkristiansundkrodsheradkrokstadelvakr\303\245anghkekr\303\270dsherad"
+    "kvafjordkvalsundkvamkvanangenkvinesdalkvinnheradkviteseidkvitsoykvits\303\270ykv\303\246fjordkv\303\246nangen"
+    "k\303\241r\303\241\305\241johkak\303\245fjordlaakesvuemielahppilangevaglangev\303\245glardallarvik"
+    "lavagislavangenleangaviikalea\305\213gaviikalebesbyleikangerleirfjordleirviklekaleksviklenviklerdal"
+    "lesjalevangerlierliernelillehammerlillesandlindaslindesneslind\303\245sloabatloab\303\241tlodingen"
+    "lomloppalorenskoglotenlundlunnerluroylur\303\270ylusterlyngdallyngenl\303\241hppil\303\246rdall\303\270dingen"
+    "l\303\270renskogl\303\270tenmalatvuopmimalselvmalvikmandalmarkermarnardalmasfjordenmasoymatta-varjjat"
+    "melandmeldalmelhusmeloymel\303\270ymerakermer\303\245kermidsundmidtre-gauldalmilmjondalenmj\303\270ndalen"
+    "mo-i-ranamoarekemodalenmodummoldemore-og-romsdalmosjoenmosj\303\270enmoskenesmossmosvikmo\303\245reke"
+    "mrmuosatmuos\303\241tmuseummyspreadshopm\303\241latvuopmim\303\241tta-v\303\241rjjatm\303\245lselv"
+    "m\303\245s\303\270ym\303\270re-og-romsdalnaamesjevuemienamdalseidnamsosnamsskogannannestadnaroynarviika"
+    "narviknaustdalnavuotnanedre-eikernesnanesoddennesoddtangennessebynessetnissedalnittedalnlnord-aurdal"
+    "nord-fronnord-odalnorddalnordkappnordlandnordre-landnordreisanore-og-uvdalnotoddennotteroyntn\303\241vuotna"
+    "n\303\245\303\245mesjevuemien\303\246r\303\270yn\303\270tter\303\270yoddaofoksnesolomasvuotnaoppdal"
+    "oppegardoppeg\303\245rdorkangerorkdalorlandorskogorstaosenosloosoyroosteroyoster\303\270yostfold"
+    "ostre-totenos\303\270yrooverhallaovre-eikeroyeroygardenoystre-slidreporsangerporsanguporsgrunnpors\303\241\305\213gu"
+    "privraderadoyrad\303\270yrahkkeravjuraholtraisarakkestadralingenranarandabergraumarendalenrennebu"
+    "rennesoyrennes\303\270yrindalringeburingerikeringsakerrisorrissaris\303\270rrlroanrodoyrollagromsa"
+    "romskogrorosrostroykenroyrvikruovatrygger\303\241hkker\303\241vjur\303\241isar\303\245der\303\245holt"
+    "r\303\246lingenr\303\270d\303\270yr\303\270mskogr\303\270rosr\303\270str\303\270ykenr\303\270yrvik"
+    "salangensalatsaltdalsamnangersandefjordsandnessandnessjoensandnessj\303\270ensandoysand\303\270y"
+    "sarpsborgsaudasauheradselselbuseljeseljordsfsiellaksigdalsiljansirdalskanitskanlandskaunskedsmoskedsmokorset"
+    "skiskienskiervaskierv\303\241skiptvetskjakskjervoyskjerv\303\270yskj\303\245kskodjesk\303\241nit"
+    "sk\303\245nlandslattumsmolasm\303\270lasnaasesnasasnillfjordsnoasasn\303\245asesn\303\245sasogndal"
+    "sognesokndalsolasolundsomnasondre-landsongdalensor-aurdalsor-fronsor-odalsor-varangersorfoldsorreisa"
+    "sortlandsorumspjelkavikspydebergststangestatstathellestavangerstavernsteigensteinkjerstjordalstjordalshalsen"
+    "stj\303\270rdalstj\303\270rdalshalsenstokkestor-elvdalstordstordalstorfjordstrandstrandastrynsula"
+    "suldalsundsunndalsurnadalsvalbardsveiosvelviksykkylvens\303\241lats\303\241l\303\241ts\303\270gne"
+    "s\303\270mnas\303\270ndre-lands\303\270r-aurdals\303\270r-frons\303\270r-odals\303\270r-varanger"
+    "s\303\270rfolds\303\270rreisas\303\270rumtanatanangertelemarktimetingvolltinntjeldsundtjometj\303\270me"
+    "tmtokketolgatonsbergtorskentrtranatranbytranoytran\303\270ytroandintrogstadtromsatromsotroms\303\270"
+    "trondheimtrysiltr\303\246natr\303\270gstadtvedestrandtydaltynsettysfjordtysnestysvartysv\303\246r"
+    "t\303\270nsbergullensakerullensvangulvikunjargaunj\303\241rgautsiravavaapstevadsovads\303\270vaga"
+    "vaganvagsoyvaksdalvallevangvanylvenvardovard\303\270varggatvaroyvefsnvegavegarsheiveg\303\245rshei"
+    "venneslaverdalverranvestbyvestfoldvestnesvestre-slidrevestre-totenvestvagoyvestv\303\245g\303\270y"
+    "vevelstadvfvgsvikviknavindafjordvoagatvoldavossvossevangenv\303\241rgg\303\241tv\303\245ganv\303\245gs\303\270y"
+    "v\303\245g\303\245v\303\246r\303\270yxn--andy-iraxn--asky-iraxn--aurskog-hland-jnbxn--avery-yuaxn--bdddj-mrabd"
+    "xn--bearalvhki-y4axn--berlevg-jxaxn--bhcavuotna-s4axn--bhccavuotna-k7axn--bidr-5nacxn--bievt-0qa"
+    "xn--bjarky-fyaxn--bjddar-ptaxn--blt-elabxn--bmlo-graxn--bod-2naxn--brnny-wuacxn--brnnysund-m8acxn--brum-voa"
+    "xn--btsfjord-9zaxn--davvenjrga-y4axn--dnna-graxn--drbak-wuaxn--dyry-iraxn--eveni-0qa01gaxn--finny-yua"
+    "xn--fjord-lraxn--fl-ziaxn--flor-jraxn--frde-graxn--frna-woaxn--frya-hraxn--ggaviika-8ya47hxn--gildeskl-g0a"
+    "xn--givuotna-8yaxn--gjvik-wuaxn--gls-elacxn--h-2faxn--hbmer-xqaxn--hcesuolo-7ya35bxn--hgebostad-g3a"
+    "xn--hmmrfeasta-s4acxn--hnefoss-q1axn--hobl-iraxn--holtlen-hxaxn--hpmir-xqaxn--hyanger-q1axn--hylandet-54a"
+    "xn--indery-fyaxn--jlster-byaxn--jrpeland-54axn--karmy-yuaxn--kfjord-iuaxn--klbu-woaxn--koluokta-7ya57h"
+    "xn--krager-gyaxn--kranghke-b0axn--krdsherad-m8axn--krehamn-dxaxn--krjohka-hwab49jxn--ksnes-uuaxn--kvfjord-nxa"
+    "xn--kvitsy-fyaxn--kvnangen-k0axn--l-1faxn--laheadju-7yaxn--langevg-jxaxn--ldingen-q1axn--leagaviika-52b"
+    "xn--lesund-huaxn--lgrd-poacxn--lhppi-xqaxn--linds-praxn--loabt-0qaxn--lrdal-sraxn--lrenskog-54axn--lt-liac"
+    "xn--lten-graxn--lury-iraxn--mely-iraxn--merker-kuaxn--mjndalen-64axn--mlatvuopmi-s4axn--mli-tlaxn--mlselv-iua"
+    "xn--moreke-juaxn--mosjen-eyaxn--mot-tlaxn--mre-og-romsdal-qqbxn--msy-ula0hxn--mtta-vrjjat-k7afxn--muost-0qa"
+    "xn--nmesjevuemie-tcbaxn--nry-yla5gxn--nttery-byaexn--nvuotna-hwaxn--oppegrd-ixaxn--ostery-fyaxn--osyro-wua"
+    "xn--porsgu-sta26fxn--rady-iraxn--rdal-poaxn--rde-ulaxn--rdy-0nabxn--rennesy-v1axn--rhkkervju-01af"
+    "xn--rholt-mraxn--risa-5naxn--risr-iraxn--rland-uuaxn--rlingen-mxaxn--rmskog-byaxn--rros-graxn--rskog-uua"
+    "xn--rst-0naxn--rsta-fraxn--ryken-vuaxn--ryrvik-byaxn--s-1faxn--sandnessjen-ogbxn--sandy-yuaxn--seral-lra"
+    "xn--sgne-graxn--skierv-utaxn--skjervy-v1axn--skjk-soaxn--sknit-yqaxn--sknland-fxaxn--slat-5naxn--slt-elab"
+    "xn--smla-hraxn--smna-graxn--snase-nraxn--sndre-land-0cbxn--snes-poaxn--snsa-roaxn--sr-aurdal-l8a"
+    "xn--sr-fron-q1axn--sr-odal-q1axn--sr-varanger-ggbxn--srfold-byaxn--srreisa-q1axn--srum-graxn--stfold-9xa"
+    "xn--stjrdal-s1axn--stjrdalshalsen-sqbxn--stre-toten-zcbxn--tjme-hraxn--tnsberg-q1axn--trany-yuaxn--trgstad-r1a"
+    "xn--trna-woaxn--troms-zuaxn--tysvr-vraxn--unjrga-rtaxn--vads-jraxn--vard-jraxn--vegrshei-c0axn--vestvgy-ixa6o"
+    "xn--vg-yiabxn--vgan-qoaxn--vgsy-qoa0jxn--vre-eiker-k8axn--vrggt-xqadxn--vry-yla5gxn--yer-znaxn--ygarden-p1a"
+    "xn--ystre-slidre-ujb\303\241k\305\213oluokta\303\241laheadju\303\241lt\303\241\303\245fjord\303\245krehamn"
+    "\303\245l\303\245lesund\303\245lg\303\245rd\303\245mli\303\245mot\303\245rdal\303\245s\303\245seral"
+    "\303\245snes\303\270ksnes\303\270rland\303\270rskog\303\270rsta\303\270stfold\303\270stre-toten\303\270vre-eiker"
+    "\303\270yer\303\270ygarden\303\270ystre-slidre\304\215\303\241hcesuolobizcomedugovinfonetorgenterprisecloud"
+    "merseinemineshacknetaccocrigeekgengovthealthiwikiwimaorimilm\304\201orinetorgparliamentschoolxn--mori-qsa"
+    "cocomedugovmedmuseumnetorgprohomelinkonredservicebarsyeeroeero-stagetechaccesscamaealtervistaamune"
+    "barsyblogdnsblogsitebmoattachmentsboldlygoingnowherecable-modemcamdvrcdn77cdn77-securecertmgrcloudns"
+    "collegefancouchpotatofriesddnssdiskstationdnsaliasdnsdojodoesntexistdontexistdoomdnsdsmynasduckdns"
+    "dvrdnsdynaliasdyndnsdynservendofinternetendoftheinterneteufamilydsfedorainfracloudfedorapeoplefedoraproject"
+    "freeddnsfreedesktopfrom-megame-hostgotdnshepforgehkhobby-sitehomednshomeftphomelinuxhomeunixhopto"
+    "httpbinin-dslin-vpnis-a-bruinsfanis-a-candidateis-a-celticsfanis-a-chefis-a-geekis-a-knightis-a-linux-user"
+    "is-a-patsfanis-a-soxfanis-foundis-lostis-savedis-very-badis-very-evilis-very-goodis-very-niceis-very-sweet"
+    "isa-geekjskicks-assmayfirstmisconfusedmlbfanmozilla-iotmy-firewallmyfirewallmyftpmysecuritycamera"
+    "mywirenflfanno-ipnow-dnspimientapodzonepoivronpotagerpubtlsread-booksreadmyblogselfipsellsyourhome"
+    "servebbsserveftpservegamesmall-webspdnsstuff-4-salesweetpepperteckidstoolforgetunktuxfamilytwmail"
+    "ufcfanuswebhopwebredirectwmcloudwmflabszazaptonerdpolaboaccomedugobingmednetnomorgsldcodeberghlx"
+    "hlx3magnetpdnspleskprvcyrockytranslatedyboblogspotcomedugobmilnetnomorgcomeduorgcomedugovimilnet"
+    "ngoorgframer1337bizcomedufamgobgokgongopgosgovinfonetorgwebagroaidartatmaugustowautobabia-gorabedzin"
+    "beepbeskidybialowiezabialystokbielawabieszczadybizboleslawiecbydgoszczbytomcieszyncocomczeladzczest"
+    "dlugolekaecommerce-shopeduelblagelkgdagdanskgdyniagliwiceglogowgminagnieznogorlicegovgrajewogsmhomesklep"
+    "ilawainfojaworznojelenia-gorajgorakaliszkarpaczkartuzykaszubykatowicekazimierz-dolnykepnoketrzyn"
+    "klodzkokobierzycekolobrzegkoninkonskowolakrakowkrasnikkutnolapyleborklecznalegnicalezajsklimanowa"
+    "lomzalowiczlubartowlubinlublinlukowmailmalborkmalopolskamazowszemazurymedmediamiastamielecmielno"
+    "milmragowomyspreadshopnaklonetnieruchomoscinomnowarudanysaolawaoleckoolkuszolsztynopocznoopoleorg"
+    "ostrodaostrolekaostrowiecostrowwlkppcpilapiszpodhalepodlasiepolkowicepomorskiepomorzeponiatowapowiat"
+    "poznanprivprochowicepruszkowprzeworskpulawyradomrawa-mazrealestaterelrybnikrzeszowsanoksdscloudsejny"
+    "sexshopshoparenasimplesitesklepskoczowslaskslupsksopotsossosnowiecstalowa-wolastarachowicestargard"
+    "suwalkiswidnicaswidnikswiebodzinswinoujscieszczecinszczytnoszkolatargitarnobrzegtgorytmtourismtravel"
+    "turekturystykatychyunicloudustkawalbrzychwarmiawarszawawawwegrowwielunwloclwloclawekwodzislawwolomin"
+    "wrocwroclawzachpomorzaganzakopanezarowzgorazgorzelecconameowncoedugovnetorgindieacbizcomeduestgov"
+    "infoislanamenetorgproprofaaaacaacctavocatbarbarsycloudnscpadnstraceengjurlawmedrechtcomedugovnet"
+    "orgplosec123paginawebblogspotcomedugovintnetnomeorgpublbarsybelaucloudnscoedgoneorx443comcoopedu"
+    "govmilnetorgblogspotcomedugovmilnamenetorgschassoblogspotcomnomyboclanartsbarsyblogspotcocomfirm"
+    "infonomntorgrecshopstoretmwwwlima-citymyddnswebspaceacblogspotbrendlycoedugovinorgoxua123saitacadygeya"
+    "bashkiriabirblogspotcbgcldmailcomdagestanedueurodirgovgroznyintkalmykiakustanailk3marinemcdirmcpre"
+    "milmircloudmordoviamskmyjinomytisna4unalchiknetnovorgpppyatigorskrasregruhostingspbtestvladikavkaz"
+    "vladimirbuildcodedatabasedevelopmenthsmigrationonporterravendbreplserversaccocoopgovmilnetorgcom"
+    "edugovmednetorgpubschcomedugovnetorgcomedugovnetorgyboedugovcomedugovinfomednetorgtv123minsidaaac"
+    "bbdblogspotbrandccomconfdeffhfhskfhvghiiopsysitcouldbeworkkomforbkommunalforbundkomvuxllanbibmmyspreadshop"
+    "nnaturbruksgymnoorgppabapartipppressrsttmuwxyzloginlineblogspotcomeduenscaledgovnetorgperbipcomgov"
+    "hashbangmilnetnoworgplatformvxlwedeploybarsybasehoplixblogspotgitappgitpagebarsybyenclouderacyon"
+    "fastvpsfnwkfolionetworkjeleleluxloginlineminterenovecoreomniweopensocialplatformshsrhttstblogspot"
+    "comedugovnetorgartblogspotcomedugouvorgpersounivcomedugovmenetorgschdihermyfastuberxs4allbizcomedu"
+    "govmenetorgschcocomconsuladoeduembaixadamilnetnohoorgprincipesaotomestoresellfyshopwarestorebase"
+    "abkhaziaadygeyaaktyubinskarkhangelskarmeniaashgabadazerbaijanbalashovbashkiriabryanskbukharachimkent"
+    "dagestaneast-kazakhstanexnetgeorgiagroznyivanovojambylkalmykiakalugakaracolkaragandakareliakhakassia"
+    "krasnodarkurgankustanailenugmangyshlakmordoviamskmurmansknalchiknavoinorth-kazakhstannovobninskpenza"
+    "pokrovsksochispbtashkenttermeztogliattitroitsktselinogradtulatuvavladikavkazvladimirvologdabarsy"
+    "comedugoborgredgovcomedugovmilnetorgknightpointaccoorgchmeweblogspotdiscoursejelasticcoschaccogo"
+    "inminetonlineorshopacbizcocomedugogovintmilnamenetnicorgtestwebgovcocomedugovmilnetnomorgcomensfin"
+    "govindinfointlmincomnatnetorangecloudorgpersotourism611comedugovmilnetnyanorgoyaquickconnectrdvvpnplus"
+    "prequalifymenow-dnsntdllavbbsbelbizcomdredugengovinfok12kepmilnamencnetorgpolteltsktvwebyboaerobiz"
+    "cocomcoopedugovinfointjobsmobimuseumnamenetorgprotravelbetter-thandyndnson-the-webworse-thanblogspot"
+    "clubcomebizedugamegovidvmilnetorgurlxn--czrw28bxn--uc0atvxn--zf0ao64a\345\225\206\346\245\255\347\265\204\347\271\224"
+    "\347\266\262\350\267\257accogohotelinfomemilmobineorsctvbizcccherkassycherkasychernigovchernihiv"
+    "chernivtsichernovtsyckcncocomcrcrimeacvcxdndnepropetrovskdnipropetrovskdonetskdpedugovifininfivano-frankivsk"
+    "khkharkivkharkovkhersonkhmelnitskiykhmelnytskyikievkirovogradkmkrkrymkskvkyivlgltltdlugansklutsk"
+    "lvlvivmkmykolaivnetnikolaevododesaodessaorgplpoltavapprivnerovnorvsbsebastopolsevastopolsmsumyte"
+    "ternopiluzuzhgorodvvinnicavinnytsiavnvolynyaltazaporizhzhezaporizhzhiazhitomirzhytomyrzpztacblogspot"
+    "cocomgoneororgscacbarsycoconncoprogovhospindependent-commissionindependent-inquestindependent-inquiry"
+    "independent-panelindependent-reviewltdmenetnhsorgplcpolicepublic-inquirypymntroyal-commissionsch"
+    "akalarasazcacloudnscoctdcdednidrudenscaledfedflfreeddnsgagolffangraphoxguhiiaidilinis-byisakidsks"
+    "kylaland-4-salemamdmemimircloudmnmomsmtncndnenhnjnmnoipnsnnvnyohokorpaplatterppointtoprriscsdstuff-4-sale"
+    "tntxutvavivtwawiwvwycomedugubmilnetorgcocomnetorg0ecomedugovgvmilnetorgartsbibcocome12edufirmgob"
+    "govinfointmilnetnomorgrarrecstoretecwebatcocomk12netorgacbizblogspotcomedugovhealthinfointnamenet"
+    "orgproblogcncomdevedumenetorgframerbizschframeradvisorcloud66comdyndnsedugovmypetsnetorgxn--4dbgdty6c"
+    "xn--5dbhl8dxn--8dbq2axn--hebda8bxn--80auxn--90azhxn--c1avgxn--d1atxn--o1acxn--o1achxn--55qx5dxn--gmqw5a"
+    "xn--mxtq1mxn--od0algxn--uc0atvxn--wcvs22dxn--12c1fe0brxn--12cfi8ixb8lxn--12co0c3b4evaxn--h3cuzk1di"
+    "xn--m3ch0j3axn--o3cyx2axn--41axn--80aaa0cvacxn--90a1afxn--90amcxn--c1avgxn--h1ahnxn--h1alizxn--j1adp"
+    "xn--j1aefxn--j1ael8bblogsitecraftinglocalzonetelebitzaptocomedugovmilnetorgorgacagricaltcoedugov"
+    "grondarlawmilnetngonicnisnomorgschooltmwebacbizcocomedugovinfomilnetorgschcloud66hslimatritonacco"
+    "govmilorg\320\261\320\270\320\267\320\272\320\276\320\274\320\272\321\200\321\213\320\274\320\274\320\270\321\200"
+    "\320\274\321\201\320\272\320\276\321\200\320\263\321\201\320\260\320\274\320\260\321\200\320\260"
+    "\321\201\320\276\321\207\320\270\321\201\320\277\320\261\321\217\320\260\320\272\320\276\320\261\321\200"
+    "\320\276\320\264\320\276\321\200\320\263\320\277\321\200\321\203\320\277\321\200\327\220\327\247\327\223\327\236\327\231\327\224"
+    "\327\231\327\251\327\225\327\221\327\236\327\236\327\251\327\234\327\246\327\224\327\234\340\270\227\340\270\253\340\270\262\340\270\243"
+    "\340\270\230\340\270\270\340\270\243\340\270\201\340\270\264\340\270\210\340\270\243\340\270\261\340\270\220\340\270\232\340\270\262\340\270\245"
+    "\340\270\250\340\270\266\340\270\201\340\270\251\340\270\262\340\270\255\340\270\207\340\270\204\340\271\214\340\270\201\340\270\243"
+    "\340\271\200\340\270\231\340\271\207\340\270\225\345\200\213\344\272\272\345\205\254\345\217\270"
+    "\346\224\277\345\272\234\346\225\231\350\202\262\347\265\204\347\271\224\347\266\262\347\265\241"
+    "aprivatelinkblogspotsthblogspotwienexinexkundenblogspotcloudletsmyspreadshopactcatholicnswntqldsa"
+    "tasvicwaqldsatasvicwacloudezproxyblogspotsimplesitevirtualcloudacalamapbacedfesgomamgmsmtpapbpepi"
+    "prrjrnrorrrsscsesptoacalamapbacedfesgomamgmsmtpapbpepiprrjrnrorrrsscsesptoblogspotuiinstancessvc"
+    "aeappenginees-1euviparubait1cstnukukcaukusbaremetalfr-parinstancesk8snl-amspl-wawscalebooksmartlabeling"
+    "chdeamazonawsdirectblogspotididdevaf-south-1ap-east-1ap-northeast-1ap-northeast-2ap-northeast-3ap-south-1"
+    "ap-southeast-1ap-southeast-2ca-central-1computecompute-1elbeu-central-1eu-north-1eu-south-1eu-west-1"
+    "eu-west-2eu-west-3me-south-1s3s3-ap-northeast-1s3-ap-northeast-2s3-ap-south-1s3-ap-southeast-1s3-ap-southeast-2"
+    "s3-ca-central-1s3-eu-central-1s3-eu-west-1s3-eu-west-2s3-eu-west-3s3-external-1s3-fips-us-gov-west-1"
+    "s3-sa-east-1s3-us-east-2s3-us-gov-west-1s3-us-west-1s3-us-west-2s3-website-ap-northeast-1s3-website-ap-southeast-1"
+    "s3-website-ap-southeast-2s3-website-eu-west-1s3-website-sa-east-1s3-website-us-east-1s3-website-us-west-1"
+    "s3-website-us-west-2sa-east-1us-east-1us-east-2us-west-1us-west-2ralphabetabuilderdev-builderstg-builder"
+    "ociocpocsdemoinstanceap-northeast-1ap-northeast-2ap-northeast-3ap-south-1ap-southeast-1ap-southeast-2"
+    "ca-central-1eu-central-1eu-west-1eu-west-2eu-west-3sa-east-1us-east-1us-east-2us-gov-west-1us-west-1"
+    "us-west-2eu-1eu-2eu-3eu-4us-1us-2us-3us-4appspaasrag-cloudrag-cloud-chjcloudjcloud-ver-jpcdemocns"
+    "membersnodebalanceripapppaaseucaracalcustomerfentigerlynxocelotoncillaonzasphinxvsxyalicloudstatic"
+    "xeneuappapisiteprojedlonrydpagesjsu2u2-localblogspotscaleforcecloudcustomclouddyndyndyndnsdynitcustomer"
+    "userlondonbzzgit-pagesblogspotblogspotblogspotjelasticuserfidemopaasdaemonblogspotrssblogspotmytabit"
+    "ravpagetabitorderltdplcappbackyardspaassekd1uk0dyndnsidappsstagemocksysdevicesdevdisrecprodtesting"
+    "cloud-fr1gjcopenaisaiamaanjoasukechiryuchitafusogamagorihandahazuhekinanhigashiuraichinomiyainazawa"
+    "inuyamaisshikiiwakurakaniekariyakasugaikirakiyosukomakikonankotamihamamiyoshinishionisshinobuoguchi"
+    "oharuokazakiowariasahisetoshikatsushinshiroshitarataharatakahamatobishimatoeitogotokaitokonametoyoake"
+    "toyohashitoyokawatoyonetoyotatsushimayatomiakitadaisenfujisatogojomehachirogatahappouhigashinaruse"
+    "honjohonjyoikawakamikoanikamiokakatagamikazunokitaakitakosakakyowamisatomitanemoriyoshinikahonoshiro"
+    "odateogaogatasembokuyokoteyurihonjoaomorigonohehachinohehashikamihiranaihirosakiitayanagikuroishi"
+    "misawamutsunakadomarinohejioiraseowanirokunohesannoheshichinoheshingotakkotowadatsugarutsurutaabiko"
+    "asahichonanchoseichoshichuofunabashifuttsuhanamigawaichiharaichikawaichinomiyainzaiisumikamagaya"
+    "kamogawakashiwakatorikatsuurakimitsukisarazukozakikujukurikyonanmatsudomidorimihamaminamibosomobara"
+    "mutsuzawanagaranagareyamanarashinonaritanodaoamishirasatoomigawaonjukuotakisakaesakurashimofusashirako"
+    "shiroishisuisodegaurasosatakotateyamatoganetohnoshotomisatourayasuyachimatayachiyoyokaichibayokoshibahikari"
+    "yotsukaidoainanhonaiikataimabariiyokamijimakihokukumakogenmasakimatsunomatsuyamanamikataniihamaozu"
+    "saijoseiyoshikokuchuotobetoonuchikouwajimayawatahamaechizeneiheijifukuiikedakatsuyamamihamaminamiechizen"
+    "obamaohionosabaesakaitakahamatsurugawakasaashiyabuzenchikugochikuhochikujochikushinochikuzenchuo"
+    "dazaifufukuchihakatahigashihirokawahisayamaiizukainatsukikahokasugakasuyakawarakeisenkogakuratekurogi"
+    "kurumeminamimiyakomiyamamiyawakamizumakimunakatanakagawanakamanishinogataogoriokagakiokawaokiomuta"
+    "ongaonojootosaigawasasagurishingushinyoshitomishonaisoedasuetachiaraitagawatakatatohotoyotsutsuiki"
+    "ukihaumiusuiyamadayameyanagawayukuhashiaizubangeaizumisatoaizuwakamatsuasakawabandaidatefukushima"
+    "furudonofutabahanawahigashihiratahironoiitateinawashiroishikawaiwakiizumizakikagamiishikaneyamakawamata"
+    "kitakatakitashiobarakoorikoriyamakunimimiharumishimanamienangonishiaizunishigookumaomotegoonootama"
+    "samegawashimogoshirakawashowasomasukagawataishintamakawatanagurateneiyabukiyamatoyamatsuriyanaizu"
+    "yugawaanpachienagifuginangodogujohashimahichisohidahigashishirakawaibigawaikedakakamigaharakanikasahara"
+    "kasamatsukawauekitagataminominokamomitakemizunamimotosunakatsugawaogakisakahogisekisekigaharashirakawa"
+    "tajimitakayamataruitokitomikawanouchiyamagatayaotsuyoroannakachiyodafujiokahigashiagatsumaisesaki"
+    "itakurakannakanrakatashinakawabakiryukusatsumaebashimeiwamidoriminakaminaganoharanakanojonanmoku"
+    "numataoizumioraotashibukawashimonitashintoshowatakasakitakayamatamamuratatebayashitomiokatsukiyono"
+    "tsumagoiuenoyoshiokaasaminamidaiwaetajimafuchufukuyamahatsukaichihigashihiroshimahongojinsekikogen"
+    "kaitakuikumanokuremiharamiyoshinakaonomichiosakikamijimaotakesakaseraseranishishinichishobaratakehara"
+    "abashiriabiraaibetsuakabiraakkeshiasahikawaashibetsuashoroassabuatsumabibaibieibifukabihorobiratori"
+    "chippubetsuchitosedateebetsuembetsueniwaerimoesanesashifukagawafukushimafuranofurubirahaborohakodate"
+    "hamatonbetsuhidakahigashikagurahigashikawahiroohokuryuhokutohonbetsuhorokanaihoronobeikedaimakane"
+    "ishikariiwamizawaiwanaikamifuranokamikawakamishihorokamisunagawakamoenaikayabekembuchikikonaikimobetsu"
+    "kitahiroshimakitamikiyosatokoshimizukunneppukuriyamakuromatsunaikushirokutchankyowamashikematsumae"
+    "mikasaminamifuranomombetsumoseushimukawamurorannaienakagawanakasatsunainakatombetsunanaenanporonayoro"
+    "nemuroniikappunikinishiokoppenoboribetsunumataobihiroobiraoketookoppeotaruotobeotofukeotoineppuoumu"
+    "ozorapippurankoshirebunrikubetsurishiririshirifujisaromasarufutsushakotansharishibechashibetsushikabe"
+    "shikaoishimamakishimizushimokawashinshinotsushintokushiranukashiraoishiriuchisobetsusunagawataiki"
+    "takasutakikawatakinoueteshikagatobetsutohmatomakomaitomaritoyatoyakotoyotomitoyouratsubetsutsukigata"
+    "urakawaurausuuryuutashinaiwakkanaiwassamuyakumoyoichiaioiakashiakoamagasakiaogakiasagoashiyaawaji"
+    "fukusakigoshikiharimahimejiichikawainagawaitamikakogawakamigorikamikawakasaikasugakawanishimikiminamiawaji"
+    "nishinomiyanishiwakionosandasannansasayamasayoshingushinonsenshisosumototaishitakatakarazukatakasago"
+    "takinotambatatsunotoyookayabuyashiroyokayokawaamiasahibandochikuseidaigofujishirohitachihitachinaka"
+    "hitachiomiyahitachiotaibarakiinainashikiitakoiwamajosokamisukasamakashimakasumigaurakogamihomito"
+    "moriyanakanamegataoaraiogawaomitamaryugasakisakaisakuragawashimodateshimotsumashirosatosowasuifu"
+    "takahagitamatsukuritokaitomobetonetoridetsuchiuratsukubauchiharaushikuyachiyoyamagatayawarayukianamizu"
+    "hakuihakusankagakahokukanazawakawakitakomatsunakanotonanaonominonoichinotoshikasuzutsubatatsurugi"
+    "uchinadawajimafudaifujisawahanamakihiraizumihironoichinoheichinosekiiwaizumiiwatejobojikamaishikanegasaki"
+    "karumaikawaikitakamikujikunohekuzumakimiyakomizusawamoriokaninohenodaofunatooshuotsuchirikuzentakata"
+    "shiwashizukuishisumitatanohatatonoyahabayamadaayagawahigashikagawakanonjikotohiramannomarugamemitoyo"
+    "naoshimasanukitadotsutakamatsutonoshouchinomiutazuzentsujiakuneamamihiokiisaisenizumikagoshimakanoya"
+    "kawanabekinkokouyamamakurazakimatsumotominamitanenakatanenishinoomotesatsumasendaisootarumizuyusui"
+    "aikawaatsugiayasechigasakiebinafujisawahadanohakonehiratsukaiseharakaiseikamakurakiyokawamatsuda"
+    "minamiashigaramiuranakaininomiyaodawaraoioisosagamiharasamukawatsukuiyamakitayamatoyokosukayugawara"
+    "zamazushicitycitycityakigeiseihidakahigashitsunoinokagamikamikitagawakochimiharamotoyamamurotonahari"
+    "nakamuranankokunishitosaniyodogawaochiokawaotoyootsukisakawasukumosusakitosatosashimizutoyotsuno"
+    "umajiyasudayusuharaamakusaaraoasochoyogyokutokamiamakusakikuchikumamotomashikimifuneminamataminamioguni"
+    "nagasunishiharaoguniozusumototakamoriukiutoyamagayamatoyatsushiroayabefukuchiyamahigashiyamaideine"
+    "joyokameokakamokitakizukumiyamakyotambakyotanabekyotangomaizuruminamiminamiyamashiromiyazumukonagaokakyo"
+    "nakagyonantanoyamazakisakyoseikatanabeujiujitawarawazukayamashinayawataasahiinabeisekameyamakawagoe"
+    "kihokisosakikiwakomonokumanokuwanamatsusakameiwamihamaminamiisemisugimiyamanabarishimasuzukatado"
+    "taikitakitamakitobatsuudonoureshinowataraiyokkaichifurukawahigashimatsushimaishinomakiiwanumakakuda"
+    "kamikawasakimarumorimatsushimaminamisanrikumisatomuratanatoriogawaraohiraonagawaosakirifusemineshibata"
+    "shichikashukushikamashiogamashiroishitagajotaiwatometomiyawakuyawatariyamamotozaoayaebinogokasehyuga"
+    "kadogawakawaminamikijokitagawakitakatakitaurakobayashikunitomikushimamimatamiyakonojomiyazakimorotsuka"
+    "nichinannishimeranobeokasaitoshiibashintomitakaharutakanabetakazakitsunoachiagematsuananaokiasahi"
+    "azuminochikuhokuchikumachinofujimihakubaharahirayaiidaiijimaiiyamaiizunaikedaikusakainakaruizawa"
+    "kawakamikisokisofukushimakitaaikikomaganekomoromatsukawamatsumotomiasaminamiaikiminamimakiminamiminowa"
+    "minowamiyadamiyotamochizukinaganonagawanagisonakagawanakanonozawaonsenobuseogawaokayaomachiomiookuwa"
+    "ooshikaotakiotarisakaesakakisakusakuhoshimosuwashinanomachishiojirisuwasuzakatakagitakamoritakayama"
+    "tateshinatatsunotogakushitoguratomiuedawadayamagatayamanouchiyasakayasuokachijiwafutsugotohasami"
+    "hiradoikiisahayakawatanakuchinotsumatsuuranagasakiobamaomuraosetosaikaisaseboseihishimabarashinkamigoto"
+    "togitsutsushimaunzencityandogosehegurihigashiyoshinoikarugaikomakamikitayamakanmakikashibakashihara"
+    "katsuragikawaikawakamikawanishikoryokurotakimitsuemiyakenaranosegawaojioudaoyodosakuraisangoshimoichi"
+    "shimokitayamashinjosonitakatoritawaramototenkawatenriudayamatokoriyamayamatotakadayamazoeyoshino"
+    "aseinetgehirnagaaganogosenitoigawaizumozakijoetsukamokariwakashiwazakiminamiuonumamitsukemuikamurakami"
+    "myokonagaokaniigataojiyaomisadosanjoseiroseirousekikawashibatatagamitainaitochiotokamachitsubame"
+    "tsunanuonumayahikoyoitayuzawabeppubungoonobungotakadahasamahijihimeshimahitakamitsuekokonoekujukunisaki"
+    "kusuoitasaikitaketatsukumiusausukiyufuakaiwaasakuchibizenhayashimaibarakagaminokasaokakibichuokumenan"
+    "kurashikimaniwamisakinaginiiminishiawakuraokayamasatoshosetouchishinjoshoosojatakahashitamanotsuyama"
+    "wakeyakageaguniginowanginozagushikamihaebaruhigashihiraraiheyaishigakiishikawaitomanizenakadenakin"
+    "kitadaitokitanakagusukukumejimakunigamiminamidaitomotobunagonahanakagusukunakijinnanjonishiharaogimi"
+    "okinawaonnashimojitaketomitaramatokashikitomigusukutonakiurasoeurumayaeseyomitanyonabaruyonaguni"
+    "zamamiabenochihayaakasakachuodaitofujiiderahabikinohannanhigashiosakahigashisumiyoshihigashiyodogawa"
+    "hirakataibarakiikedaizumiizumiotsuizumisanokadomakaizukakanankashiwarakatanokawachinaganokishiwada"
+    "kitakumatorimatsubaraminatominohmisakimoriguchineyagawanishinoseosakasayamasakaisayamasennansettsu"
+    "shijonawateshimamotosuitatadaokataishitajiritakaishitakatsukitondabayashitoyonakatoyonoyaoariake"
+    "aritafukudomigenkaihamatamahizenimarikamiminekanzakikaratsukashimakitagatakitahatakiyamakouhokukyuragi"
+    "nishiaritaogiomachiouchisagashiroishitakutaratosuyoshinogariarakawaasakachichibufujimifujiminofukaya"
+    "hannohanyuhasudahatogayahatoyamahidakahigashichichibuhigashimatsuyamahonjoinairumaiwatsukikamiizumi"
+    "kamikawakamisatokasukabekawagoekawaguchikawajimakazokitamotokoshigayakounosukukikumagayamatsubushi"
+    "minanomisatomiyashiromiyoshimoroyamanagatoronamegawaniizaoganoogawaogoseokegawaomiyaotakiranzanryokami"
+    "saitamasakadosattesayamashikishiraokasokasugitotodatokigawatokorozawatsurugashimaurawawarabiyashio"
+    "yokozeyonoyoriiyoshidayoshikawayoshimicitycityaishogamohigashiomihikonekokakonankoseikotokusatsu"
+    "maibaramoriyamanagahamanishiazainotogawaomihachimanotsurittoryuohtakashimatakatsukitorahimetoyosato"
+    "yasuakagiamagotsuhamadahigashiizumohikawahikimiizumokakinokimasudamatsuemisatonishinoshimaohdaokinoshima"
+    "okuizumoshimanetamayutsuwanounnanyakumoyasugiyatsukaaraiatamifujifujiedafujikawafujinomiyafukuroi"
+    "gotembahaibarahamamatsuhigashiizuitoiwataizuizunokunikakegawakannamikawanehonkawazukikugawakosai"
+    "makinoharamatsuzakiminamiizumishimamorimachinishiizunumazuomaezakishimadashimizushimodashizuokasusono"
+    "yaizuyoshidaashikagabatohagaichikaiiwafunekaminokawakanumakarasuyamakuroisomashikomibumokamotegi"
+    "nasunasushiobaranikkonishikatanogiohiraohtawaraoyamasakurasanoshimotsukeshioyatakanezawatochigitsuga"
+    "ujiieutsunomiyayaitaaizumiananichibaitanokainankomatsushimamatsushigemimaminamimiyoshimuginakagawa"
+    "narutosanagochishishikuitokushimawajikiadachiakirunoakishimaaogashimaarakawabunkyochiyodachofuchuo"
+    "edogawafuchufussahachijohachiojihamurahigashikurumehigashimurayamahigashiyamatohinohinodehinohara"
+    "inagiitabashikatsushikakitakiyosekodairakoganeikokubunjikomaekotokouzushimakunitachimachidameguro"
+    "minatomitakamizuhomusashimurayamamusashinonakanonerimaogasawaraokutamaomeoshimaotasetagayashibuya"
+    "shinagawashinjukusuginamisumidatachikawataitotamatoshimachizuhinokawaharakogekotouramisasananbunichinan"
+    "sakaiminatotottoriwakasayazuyonagoasahifuchufukumitsufunahashihimiimizuinamijohanakamiichikurobe"
+    "nakaniikawanamerikawanantonyuzenoyabetairatakaokatateyamatogatonamitoyamaunazukiuozuyamadaaridaaridagawa"
+    "gobohashimotohidakahirogawainamiiwadekainankamitondakatsuragikiminokinokawakitayamakoyakozakozagawa"
+    "kudoyamakushimotomihamamisatonachikatsuurashingushirahamataijitanabewakayamayuasayuraasahifunagata"
+    "higashineiidekahokukaminoyamakaneyamakawanishimamurogawamikawamurayamanagainakayamananyonishikawa"
+    "obanazawaoeoguniohkuraoishidasagaesakatasakegawashinjoshiratakashonaitakahatatendotozawatsuruoka"
+    "yamagatayamanobeyonezawayuzaabuhagihikarihofuiwakunikudamatsumitounagatooshimashimonosekishunantabuse"
+    "tokuyamatoyotaubeyuuchuodoshifuefukifujikawafujikawaguchikofujiyoshidahayakawahokutoichikawamisato"
+    "kaikofukoshukosugeminami-alpsminobunakamichinanbunarusawanirasakinishikatsuraoshinootsukishowatabayama"
+    "tsuruuenoharayamanakakoyamanashicityblogspotupaasdevsiteslocalhostsiteblogspotforgotforgotprod12"
+    "centraluseastasiaeastus2westeuropewestus2rufra1-dewest1-usjls-sto1jls-sto2jls-sto3freetlsmapprod"
+    "sslmappaashostingwebpaasjelasticnordeste-idcjsocuserbetapagesjelasticjelasticstoragewebsiteblogspot"
+    "gsgsnesgsnesgsosvalerv\303\245lerxn--vler-qoagsgsosgsheroysandegsher\303\270ysandegsbob\303\270heroy"
+    "her\303\270yxn--b-5gaxn--hery-iragsgsgsgsvalergsgsgsgsbob\303\270xn--b-5gagsgsgssandegssandexn--hery-ira"
+    "xn--vler-qoav\303\245lerblogspotstagingtelecrscorigingohomealassoataubebgcacdchcncyczdedkedueees"
+    "fifrgrhrhuieilinintisitjpkrltlulvmcmemkmtmynetngnlnonzparisplptq-arorusesisktrukuscloudosstgs3ap"
+    "griwiciskmpspkonsulatkppspkwpkwpspmupmwoirmoumpapinbpiwpopsppssepuprzgwsasdnskososrstarostwougugim"
+    "umumigupowuppousuwuzswifwiihwinbwioswitdwiwwsawskrwuozwzmiuwzpbcishophbvpshostinglandingspectrum"
+    "vpsjelasticservicesubcenteuusdirectblogspotgovmymaileradimobarsybarsyonlineblogspotbytemarklayershift"
+    "myspreadshopnh-servno-ipretrosnubwellbeingzoneapicampaignhomeofficeserviceaffinitylotterygluglug"
+    "lugsraffleentryweeklylotterycck12libcck12libcck12libcck12libcck12libcck12libcck12libcck12libcck12"
+    "libcck12libphxcck12libcck12libcck12libcclibcck12libcck12libcck12libcck12libcck12libcck12libcck12"
+    "libcck12libcck12libcck12libann-arborcccogdsteatongenk12libmustecwashtenawcck12libcck12libcck12lib"
+    "cck12libcck12libcclibcck12libcck12libcck12libcck12libcck12libcck12libcck12libcck12libcck12libcck12"
+    "libcck12libcclibcck12libcclibcck12libcck12libcck12libcck12libcck12libcck12libcck12libcck12libcccc"
+    "k12libblogspotdblogspotmelschoolsscalealp1eurfr-par-1fr-par-2nl-ams-1fnck8ss3s3-websitewhmprivpub"
+    "k8ss3s3-websitewhmk8ss3s3-websitecn-north-1computeebelbcloud9cloud9cloud9dualstackcloud9dualstack"
+    "s3s3-websitecloud9cloud9dualstacks3s3-websitecloud9dualstackcloud9dualstackcloud9dualstacks3s3-website"
+    "cloud9dualstacks3s3-websitecloud9cloud9cloud9dualstackcloud9dualstacks3s3-websitecloud9dualstack"
+    "s3s3-websitecloud9cloud9dualstackcloud9dualstackcloud9dualstacks3s3-websitecloud9cloud9jfltusrpages"
+    "custreservdcustreservdcustcustreservdjelasticusercdnaglobalabglobalfr-1lon-1lon-2ny-1ny-2sg-1atl"
+    "njsricsslapposdhvmjcustchtrparochpvtusersit1functionsnodesnodesnodess3cn-north-1cn-northwest-1vfs"
+    "webview-assetsvfswebview-assetsvfswebview-assetss3vfswebview-assetss3vfswebview-assetsvfswebview-assets"
+    "s3vfswebview-assetss3vfswebview-assetss3vfswebview-assetss3vfswebview-assetss3vfswebview-assetsvfs"
+    "webview-assetsvfswebview-assetss3vfswebview-assetss3vfswebview-assetss3vfswebview-assetsvfswebview-assets"
+    "s3vfswebview-assetss3vfswebview-assetss3vfswebview-assetsvfswebview-assetscloudapp"
+;
+
+static const Node NODES[] = {
+    { 0, 0, 0, 1651, 1 },
+    { 0, 3, 1, 0, 1652 },
+    { 3, 4, 1, 0, 1652 },
+    { 7, 6, 1, 0, 1652 },
+    { 13, 3, 1, 0, 1652 },
+    { 16, 6, 1, 0, 1652 },
+    { 22, 6, 1, 0, 1652 },
+    { 28, 3, 1, 0, 1652 },
+    { 31, 4, 1, 0, 1652 },
+    { 35, 7, 1, 0, 1652 },
+    { 42, 8, 1, 0, 1652 },
+    { 50, 2, 1, 7, 1652 },
+    { 52, 7, 1, 1, 1659 },
+    { 59, 9, 1, 0, 1660 },
+    { 68, 10, 1, 0, 1660 },
+    { 78, 11, 1, 0, 1660 },
+    { 89, 3, 1, 0, 1660 },
+    { 92, 5, 1, 0, 1660 },
+    { 97, 2, 1, 1, 1660 },
+    { 99, 3, 1, 0, 1661 },
+    { 102, 5, 1, 0, 1661 },
+    { 107, 2, 1, 8, 1661 },
+    { 109, 3, 1, 0, 1669 },
+    { 112, 4, 1, 86, 1669 },
+    { 116, 5, 1, 0, 1755 },
+    { 121, 2, 1, 5, 1755 },
+    { 123, 3, 1, 0, 1760 },
+    { 126, 6, 1, 0, 1760 },
+    { 132, 2, 1, 5, 1760 },
+    { 134, 7, 1, 0, 1765 },
+    { 141, 6, 1, 0, 1765 },
+    { 147, 2, 1, 5, 1765 },
+    { 149, 3, 1, 0, 1770 },
+    { 152, 6, 1, 0, 1770 },
+    { 158, 8, 1, 0, 1770 },
+    { 166, 6, 1, 0, 1770 },
+    { 172, 4, 1, 0, 1770 },
+    { 176, 2, 1, 7, 1770 },
+    { 178, 9, 1, 0, 1777 },
+    { 187, 7, 1, 0, 1777 },
+    { 194, 6, 1, 0, 1777 },
+    { 200, 9, 1, 0, 1777 },
+    { 209, 8, 1, 0, 1777 },
+    { 217, 4, 1, 0, 1777 },
+    { 221, 6, 1, 0, 1777 },
+    { 227, 6, 1, 0, 1777 },
+    { 233, 2, 1, 9, 1777 },
+    { 235, 6, 1, 0, 1786 },
+    { 241, 15, 1, 0, 1786 },
+    { 256, 14, 1, 0, 1786 },
+    { 270, 4, 1, 0, 1786 },
+    { 274, 5, 1, 0, 1786 },
+    { 279, 5, 1, 0, 1786 },
+    { 284, 9, 1, 0, 1786 },
+    { 293, 9, 1, 0, 1786 },
+    { 302, 7, 1, 0, 1786 },
+    { 309, 6, 1, 0, 1786 },
+    { 315, 3, 1, 0, 1786 },
+    { 318, 2, 1, 6, 1786 },
+    { 320, 3, 1, 0, 1792 },
+    { 323, 10, 1, 0, 1792 },
+    { 333, 3, 1, 28, 1792 },
+    { 336, 5, 1, 0, 1820 },
+    { 341, 2, 1, 0, 1820 },
+    { 343, 9, 1, 0, 1820 },
+    { 352, 2, 1, 14, 1820 },
+    { 354, 4, 1, 0, 1834 },
+    { 358, 6, 1, 0, 1834 },
+    { 364, 5, 1, 0, 1834 },
+    { 369, 4, 1, 0, 1834 },
+    { 373, 4, 1, 6, 1834 },
+    { 377, 3, 1, 0, 1840 },
+    { 380, 4, 1, 0, 1840 },
+    { 384, 2, 1, 1, 1840 },
+    { 386, 4, 1, 0, 1841 },
+    { 390, 4, 1, 1, 1841 },
+    { 394, 10, 1, 0, 1842 },
+    { 404, 2, 1, 18, 1842 },
+    { 406, 7, 1, 0, 1860 },
+    { 413, 8, 1, 0, 1860 },
+    { 421, 2, 1, 18, 1860 },
+    { 423, 7, 1, 0, 1878 },
+    { 430, 4, 1, 0, 1878 },
+    { 434, 7, 1, 0, 1878 },
+    { 441, 5, 1, 0, 1878 },
+    { 446, 7, 1, 0, 1878 },
+    { 453, 6, 1, 0, 1878 },
+    { 459, 4, 1, 0, 1878 },
+    { 463, 5, 1, 0, 1878 },
+    { 468, 7, 1, 0, 1878 },
+    { 475, 2, 1, 1, 1878 },
+    { 477, 3, 1, 0, 1879 },
+    { 480, 2, 1, 8, 1879 },
+    { 482, 3, 1, 0, 1887 },
+    { 485, 2, 1, 12, 1887 },
+    { 487, 5, 1, 0, 1899 },
+    { 492, 2, 1, 8, 1899 },
+    { 494, 4, 1, 0, 1907 },
+    { 498, 5, 1, 0, 1907 },
+    { 503, 7, 1, 0, 1907 },
+    { 510, 14, 1, 0, 1907 },
+    { 524, 4, 1, 0, 1907 },
+    { 528, 4, 1, 0, 1907 },
+    { 532, 3, 1, 0, 1907 },
+    { 535, 9, 1, 0, 1907 },
+    { 544, 11, 1, 0, 1907 },
+    { 555, 8, 1, 0, 1907 },
+    { 563, 8, 1, 0, 1907 },
+    { 571, 8, 1, 0, 1907 },
+    { 579, 8, 1, 0, 1907 },
+    { 587, 10, 1, 2, 1907 },
+    { 597, 7, 1, 0, 1909 },
+    { 604, 6, 1, 0, 1909 },
+    { 610, 2, 1, 10, 1909 },
+    { 612, 3, 1, 0, 1919 },
+    { 615, 3, 1, 0, 1919 },
+    { 618, 4, 1, 0, 1919 },
+    { 622, 3, 1, 0, 1919 },
+    { 625, 3, 1, 0, 1919 },
+    { 628, 2, 4, 0, 1919 },
+    { 630, 2, 1, 8, 1919 },
+    { 632, 5, 1, 0, 1927 },
+    { 637, 6, 1, 0, 1927 },
+    { 643, 4, 1, 0, 1927 },
+    { 647, 7, 1, 0, 1927 },
+    { 654, 6, 1, 0, 1927 },
+    { 660, 4, 1, 0, 1927 },
+    { 664, 7, 1, 0, 1927 },
+    { 671, 3, 1, 0, 1927 },
+    { 674, 2, 1, 1, 1927 },
+    { 676, 2, 1, 38, 1928 },
+    { 678, 2, 1, 5, 1966 },
+    { 680, 6, 1, 0, 1971 },
+    { 686, 2, 1, 5, 1971 },
+    { 688, 5, 1, 0, 1976 },
+    { 693, 3, 1, 0, 1976 },
+    { 696, 4, 1, 0, 1976 },
+    { 700, 4, 1, 0, 1976 },
+    { 704, 5, 1, 0, 1976 },
+    { 709, 3, 1, 0, 1976 },
+    { 712, 3, 1, 15, 1976 },
+    { 715, 2, 1, 21, 1991 },
+    { 717, 5, 1, 0, 2012 },
+    { 722, 11, 1, 0, 2012 },
+    { 733, 11, 1, 0, 2012 },
+    { 744, 4, 1, 0, 2012 },
+    { 748, 9, 1, 0, 2012 },
+    { 757, 4, 1, 0, 2012 },
+    { 761, 2, 1, 5, 2012 },
+    { 763, 3, 1, 0, 2017 },
+    { 766, 3, 1, 0, 2017 },
+    { 769, 2, 1, 6, 2017 },
+    { 771, 10, 1, 0, 2023 },
+    { 781, 2, 1, 41, 2023 },
+    { 783, 5, 1, 0, 2064 },
+    { 788, 10, 1, 0, 2064 },
+    { 798, 4, 1, 0, 2064 },
+    { 802, 3, 1, 0, 2064 },
+    { 805, 4, 1, 0, 2064 },
+    { 809, 3, 1, 0, 2064 },
+    { 812, 4, 1, 0, 2064 },
+    { 816, 7, 1, 0, 2064 },
+    { 823, 5, 1, 0, 2064 },
+    { 828, 6, 1, 0, 2064 },
+    { 834, 6, 1, 0, 2064 },
+    { 840, 3, 1, 0, 2064 },
+    { 843, 8, 1, 0, 2064 },
+    { 851, 3, 1, 0, 2064 },
+    { 854, 2, 1, 141, 2064 },
+    { 856, 8, 1, 0, 2205 },
+    { 864, 11, 1, 0, 2205 },
+    { 875, 8, 1, 0, 2205 },
+    { 883, 6, 1, 0, 2205 },
+    { 889, 7, 1, 0, 2205 },
+    { 896, 8, 1, 0, 2205 },
+    { 904, 2, 1, 6, 2205 },
+    { 906, 2, 1, 5, 2211 },
+    { 908, 5, 1, 0, 2216 },
+    { 913, 8, 1, 1, 2216 },
+    { 921, 8, 1, 1, 2217 },
+    { 929, 3, 1, 0, 2218 },
+    { 932, 4, 1, 0, 2218 },
+    { 936, 2, 1, 0, 2218 },
+    { 938, 2, 1, 2, 2218 },
+    { 940, 2, 1, 6, 2220 },
+    { 942, 2, 1, 7, 2226 },
+    { 944, 3, 1, 0, 2233 },
+    { 947, 2, 1, 21, 2233 },
+    { 949, 3, 1, 0, 2254 },
+    { 952, 4, 1, 0, 2254 },
+    { 956, 3, 1, 0, 2254 },
+    { 959, 4, 1, 0, 2254 },
+    { 963, 11, 1, 0, 2254 },
+    { 974, 3, 1, 0, 2254 },
+    { 977, 6, 1, 0, 2254 },
+    { 983, 4, 1, 0, 2254 },
+    { 987, 5, 1, 0, 2254 },
+    { 992, 8, 1, 0, 2254 },
+    { 1000, 7, 1, 0, 2254 },
+    { 1007, 10, 1, 0, 2254 },
+    { 1017, 3, 1, 0, 2254 },
+    { 1020, 7, 1, 0, 2254 },
+    { 1027, 5, 1, 0, 2254 },
+    { 1032, 4, 1, 0, 2254 },
+    { 1036, 6, 1, 0, 2254 },
+    { 1042, 7, 1, 0, 2254 },
+    { 1049, 4, 1, 0, 2254 },
+    { 1053, 4, 1, 1, 2254 },
+    { 1057, 4, 1, 0, 2255 },
+    { 1061, 4, 1, 0, 2255 },
+    { 1065, 6, 1, 0, 2255 },
+    { 1071, 3, 1, 0, 2255 },
+    { 1074, 8, 1, 0, 2255 },
+    { 1082, 8, 1, 0, 2255 },
+    { 1090, 3, 1, 0, 2255 },
+    { 1093, 3, 1, 0, 2255 },
+    { 1096, 4, 1, 0, 2255 },
+    { 1100, 3, 1, 0, 2255 },
+    { 1103, 2, 1, 9, 2255 },
+    { 1105, 2, 1, 1, 2264 },
+    { 1107, 6, 1, 0, 2265 },
+    { 1113, 3, 1, 0, 2265 },
+    { 1116, 4, 1, 0, 2265 },
+    { 1120, 2, 1, 1, 2265 },
+    { 1122, 3, 1, 0, 2266 },
+    { 1125, 3, 1, 0, 2266 },
+    { 1128, 2, 1, 0, 2266 },
+    { 1130, 2, 1, 13, 2266 },
+    { 1132, 6, 1, 0, 2279 },
+    { 1138, 7, 1, 0, 2279 },
+    { 1145, 7, 1, 0, 2279 },
+    { 1152, 5, 1, 0, 2279 },
+    { 1157, 4, 1, 0, 2279 },
+    { 1161, 5, 1, 0, 2279 },
+    { 1166, 7, 1, 0, 2279 },
+    { 1173, 9, 1, 0, 2279 },
+    { 1182, 6, 1, 0, 2279 },
+    { 1188, 6, 1, 0, 2279 },
+    { 1194, 2, 1, 18, 2279 },
+    { 1196, 8, 1, 0, 2297 },
+    { 1204, 6, 1, 0, 2297 },
+    { 1210, 5, 1, 0, 2297 },
+    { 1215, 7, 1, 0, 2297 },
+    { 1222, 4, 1, 0, 2297 },
+    { 1226, 5, 1, 0, 2297 },
+    { 1231, 4, 1, 0, 2297 },
+    { 1235, 8, 1, 0, 2297 },
+    { 1243, 2, 4, 1, 2297 },
+    { 1245, 2, 1, 5, 2298 },
+    { 1247, 6, 1, 0, 2303 },
+    { 1253, 8, 1, 0, 2303 },
+    { 1261, 5, 1, 0, 2303 },
+    { 1266, 6, 1, 0, 2303 },
+    { 1272, 8, 1, 0, 2303 },
+    { 1280, 8, 1, 0, 2303 },
+    { 1288, 5, 1, 27, 2303 },
+    { 1293, 4, 1, 3, 2330 },
+    { 1297, 7, 1, 0, 2333 },
+    { 1304, 2, 1, 4, 2333 },
+    { 1306, 2, 1, 50, 2337 },
+    { 1308, 2, 1, 23, 2387 },
+    { 1310, 5, 1, 0, 2410 },
+    { 1315, 5, 1, 1, 2410 },
+    { 1320, 6, 1, 0, 2411 },
+    { 1326, 7, 1, 0, 2411 },
+    { 1333, 7, 1, 0, 2411 },
+    { 1340, 3, 1, 399, 2411 },
+    { 1343, 7, 1, 0, 2810 },
+    { 1350, 8, 1, 0, 2810 },
+    { 1358, 9, 1, 3, 2810 },
+    { 1367, 7, 1, 0, 2813 },
+    { 1374, 7, 1, 0, 2813 },
+    { 1381, 8, 1, 0, 2813 },
+    { 1389, 6, 1, 0, 2813 },
+    { 1395, 6, 1, 0, 2813 },
+    { 1401, 12, 1, 0, 2813 },
+    { 1413, 10, 1, 0, 2813 },
+    { 1423, 7, 1, 0, 2813 },
+    { 1430, 11, 1, 0, 2813 },
+    { 1441, 7, 1, 0, 2813 },
+    { 1448, 14, 1, 0, 2813 },
+    { 1462, 4, 1, 2, 2813 },
+    { 1466, 4, 1, 0, 2815 },
+    { 1470, 7, 1, 0, 2815 },
+    { 1477, 7, 1, 0, 2815 },
+    { 1484, 6, 1, 0, 2815 },
+    { 1490, 7, 1, 0, 2815 },
+    { 1497, 7, 1, 0, 2815 },
+    { 1504, 3, 1, 0, 2815 },
+    { 1507, 2, 1, 7, 2815 },
+    { 1509, 6, 1, 0, 2822 },
+    { 1515, 10, 1, 0, 2822 },
+    { 1525, 11, 1, 0, 2822 },
+    { 1536, 7, 1, 0, 2822 },
+    { 1543, 5, 1, 0, 2822 },
+    { 1548, 3, 1, 0, 2822 },
+    { 1551, 6, 1, 0, 2822 },
+    { 1557, 7, 1, 0, 2822 },
+    { 1564, 2, 1, 6, 2822 },
+    { 1566, 10, 1, 0, 2828 },
+    { 1576, 2, 1, 6, 2828 },
+    { 1578, 2, 1, 4, 2834 },
+    { 1580, 2, 1, 3, 2838 },
+    { 1582, 2, 1, 12, 2841 },
+    { 1584, 5, 1, 0, 2853 },
+    { 1589, 4, 1, 0, 2853 },
+    { 1593, 2, 1, 6, 2853 },
+    { 1595, 5, 1, 0, 2859 },
+    { 1600, 3, 1, 0, 2859 },
+    { 1603, 5, 1, 0, 2859 },
+    { 1608, 4, 1, 0, 2859 },
+    { 1612, 4, 1, 0, 2859 },
+    { 1616, 6, 1, 0, 2859 },
+    { 1622, 6, 1, 0, 2859 },
+    { 1628, 3, 1, 0, 2859 },
+    { 1631, 4, 1, 0, 2859 },
+    { 1635, 3, 1, 0, 2859 },
+    { 1638, 2, 1, 73, 2859 },
+    { 1640, 4, 1, 0, 2932 },
+    { 1644, 6, 1, 0, 2932 },
+    { 1650, 5, 1, 0, 2932 },
+    { 1655, 6, 1, 0, 2932 },
+    { 1661, 8, 1, 0, 2932 },
+    { 1669, 4, 1, 0, 2932 },
+    { 1673, 8, 1, 0, 2932 },
+    { 1681, 5, 1, 0, 2932 },
+    { 1686, 8, 1, 0, 2932 },
+    { 1694, 6, 1, 0, 2932 },
+    { 1700, 7, 1, 0, 2932 },
+    { 1707, 4, 1, 0, 2932 },
+    { 1711, 6, 1, 1, 2932 },
+    { 1717, 3, 1, 23, 2933 },
+    { 1720, 3, 1, 0, 2956 },
+    { 1723, 8, 1, 0, 2956 },
+    { 1731, 4, 1, 0, 2956 },
+    { 1735, 7, 1, 1, 2956 },
+    { 1742, 6, 1, 0, 2957 },
+    { 1748, 9, 1, 0, 2957 },
+    { 1757, 8, 1, 0, 2957 },
+    { 1765, 8, 1, 0, 2957 },
+    { 1773, 4, 1, 0, 2957 },
+    { 1777, 3, 1, 0, 2957 },
+    { 1780, 2, 1, 0, 2957 },
+    { 1782, 2, 1, 8, 2957 },
+    { 1784, 2, 1, 5, 2965 },
+    { 1786, 3, 1, 0, 2970 },
+    { 1789, 2, 1, 10, 2970 },
+    { 1791, 4, 1, 0, 2980 },
+    { 1795, 6, 1, 0, 2980 },
+    { 1801, 3, 1, 0, 2980 },
+    { 1804, 7, 1, 0, 2980 },
+    { 1811, 3, 1, 0, 2980 },
+    { 1814, 8, 1, 0, 2980 },
+    { 1822, 5, 1, 0, 2980 },
+    { 1827, 3, 1, 0, 2980 },
+    { 1830, 5, 1, 0, 2980 },
+    { 1835, 6, 1, 0, 2980 },
+    { 1841, 6, 1, 0, 2980 },
+    { 1847, 6, 1, 0, 2980 },
+    { 1853, 4, 1, 0, 2980 },
+    { 1857, 3, 1, 0, 2980 },
+    { 1860, 2, 1, 10, 2980 },
+    { 1862, 5, 1, 1, 2990 },
+    { 1867, 3, 1, 0, 2991 },
+    { 1870, 2, 1, 14, 2991 },
+    { 1872, 3, 1, 0, 3005 },
+    { 1875, 5, 1, 0, 3005 },
+    { 1880, 3, 1, 1, 3005 },
+    { 1883, 9, 1, 1, 3006 },
+    { 1892, 2, 1, 10, 3007 },
+    { 1894, 2, 1, 9, 3017 },
+    { 1896, 5, 1, 0, 3026 },
+    { 1901, 6, 1, 0, 3026 },
+    { 1907, 6, 1, 0, 3026 },
+    { 1913, 8, 1, 0, 3026 },
+    { 1921, 11, 1, 0, 3026 },
+    { 1932, 11, 1, 0, 3026 },
+    { 1943, 5, 1, 0, 3026 },
+    { 1948, 9, 1, 0, 3026 },
+    { 1957, 2, 4, 0, 3026 },
+    { 1959, 8, 1, 0, 3026 },
+    { 1967, 4, 1, 0, 3026 },
+    { 1971, 2, 1, 7, 3026 },
+    { 1973, 3, 1, 0, 3033 },
+    { 1976, 6, 1, 1, 3033 },
+    { 1982, 2, 1, 8, 3034 },
+    { 1984, 8, 1, 0, 3042 },
+    { 1992, 2, 1, 9, 3042 },
+    { 1994, 10, 1, 0, 3051 },
+    { 2004, 3, 1, 1, 3051 },
+    { 2007, 6, 1, 2, 3052 },
+    { 2013, 8, 1, 0, 3054 },
+    { 2021, 6, 1, 0, 3054 },
+    { 2027, 7, 1, 0, 3054 },
+    { 2034, 7, 1, 0, 3054 },
+    { 2041, 10, 1, 0, 3054 },
+    { 2051, 4, 1, 0, 3054 },
+    { 2055, 4, 1, 0, 3054 },
+    { 2059, 9, 1, 0, 3054 },
+    { 2068, 5, 1, 1, 3054 },
+    { 2073, 6, 1, 0, 3055 },
+    { 2079, 3, 1, 0, 3055 },
+    { 2082, 4, 1, 0, 3055 },
+    { 2086, 4, 1, 1, 3055 },
+    { 2090, 7, 1, 0, 3056 },
+    { 2097, 7, 1, 0, 3056 },
+    { 2104, 4, 1, 0, 3056 },
+    { 2108, 5, 1, 0, 3056 },
+    { 2113, 8, 1, 0, 3056 },
+    { 2121, 7, 1, 0, 3056 },
+    { 2128, 7, 1, 0, 3056 },
+    { 2135, 2, 1, 11, 3056 },
+    { 2137, 4, 1, 0, 3067 },
+    { 2141, 8, 1, 0, 3067 },
+    { 2149, 4, 1, 0, 3067 },
+    { 2153, 4, 1, 0, 3067 },
+    { 2157, 5, 1, 0, 3067 },
+    { 2162, 7, 1, 0, 3067 },
+    { 2169, 9, 1, 1, 3067 },
+    { 2178, 4, 1, 0, 3068 },
+    { 2182, 9, 1, 0, 3068 },
+    { 2191, 8, 1, 0, 3068 },
+    { 2199, 4, 1, 0, 3068 },
+    { 2203, 7, 1, 0, 3068 },
+    { 2210, 3, 1, 0, 3068 },
+    { 2213, 7, 1, 0, 3068 },
+    { 2220, 2, 1, 10, 3068 },
+    { 2222, 2, 4, 0, 3078 },
+    { 2224, 6, 1, 0, 3078 },
+    { 2230, 7, 1, 0, 3078 },
+    { 2237, 4, 1, 0, 3078 },
+    { 2241, 7, 1, 0, 3078 },
+    { 2248, 7, 1, 0, 3078 },
+    { 2255, 3, 1, 0, 3078 },
+    { 2258, 2, 1, 6, 3078 },
+    { 2260, 2, 1, 0, 3084 },
+    { 2262, 3, 1, 0, 3084 },
+    { 2265, 4, 1, 0, 3084 },
+    { 2269, 11, 1, 0, 3084 },
+    { 2280, 8, 1, 0, 3084 },
+    { 2288, 4, 1, 0, 3084 },
+    { 2292, 5, 1, 0, 3084 },
+    { 2297, 7, 1, 0, 3084 },
+    { 2304, 5, 1, 0, 3084 },
+    { 2309, 10, 1, 0, 3084 },
+    { 2319, 3, 1, 0, 3084 },
+    { 2322, 2, 1, 34, 3084 },
+    { 2324, 4, 1, 0, 3118 },
+    { 2328, 9, 1, 0, 3118 },
+    { 2337, 3, 1, 0, 3118 },
+    { 2340, 7, 1, 0, 3118 },
+    { 2347, 9, 1, 0, 3118 },
+    { 2356, 8, 1, 0, 3118 },
+    { 2364, 3, 1, 0, 3118 },
+    { 2367, 7, 1, 0, 3118 },
+    { 2374, 3, 1, 0, 3118 },
+    { 2377, 4, 1, 0, 3118 },
+    { 2381, 9, 1, 0, 3118 },
+    { 2390, 6, 1, 0, 3118 },
+    { 2396, 3, 1, 0, 3118 },
+    { 2399, 2, 1, 0, 3118 },
+    { 2401, 3, 1, 0, 3118 },
+    { 2404, 7, 1, 0, 3118 },
+    { 2411, 5, 1, 0, 3118 },
+    { 2416, 6, 1, 0, 3118 },
+    { 2422, 4, 1, 0, 3118 },
+    { 2426, 5, 1, 0, 3118 },
+    { 2431, 3, 1, 0, 3118 },
+    { 2434, 6, 1, 0, 3118 },
+    { 2440, 3, 1, 0, 3118 },
+    { 2443, 2, 1, 0, 3118 },
+    { 2445, 4, 1, 0, 3118 },
+    { 2449, 2, 1, 2, 3118 },
+    { 2451, 3, 1, 1, 3120 },
+    { 2454, 2, 1, 7, 3121 },
+    { 2456, 3, 1, 0, 3128 },
+    { 2459, 4, 1, 0, 3128 },
+    { 2463, 7, 1, 0, 3128 },
+    { 2470, 6, 1, 0, 3128 },
+    { 2476, 2, 1, 0, 3128 },
+    { 2478, 2, 1, 6, 3128 },
+    { 2480, 4, 1, 0, 3134 },
+    { 2484, 2, 1, 5, 3134 },
+    { 2486, 2, 1, 6, 3139 },
+    { 2488, 4, 1, 0, 3145 },
+    { 2492, 5, 1, 0, 3145 },
+    { 2497, 5, 1, 0, 3145 },
+    { 2502, 6, 1, 0, 3145 },
+    { 2508, 2, 1, 7, 3145 },
+    { 2510, 5, 1, 0, 3152 },
+    { 2515, 3, 1, 0, 3152 },
+    { 2518, 6, 1, 0, 3152 },
+    { 2524, 5, 1, 0, 3152 },
+    { 2529, 2, 1, 0, 3152 },
+    { 2531, 5, 1, 0, 3152 },
+    { 2536, 4, 1, 0, 3152 },
+    { 2540, 3, 1, 0, 3152 },
+    { 2543, 3, 1, 0, 3152 },
+    { 2546, 2, 1, 6, 3152 },
+    { 2548, 7, 1, 0, 3158 },
+    { 2555, 4, 1, 0, 3158 },
+    { 2559, 9, 1, 0, 3158 },
+    { 2568, 4, 1, 0, 3158 },
+    { 2572, 3, 1, 0, 3158 },
+    { 2575, 8, 1, 0, 3158 },
+    { 2583, 4, 1, 3, 3158 },
+    { 2587, 6, 1, 0, 3161 },
+    { 2593, 3, 1, 0, 3161 },
+    { 2596, 3, 1, 0, 3161 },
+    { 2599, 3, 1, 0, 3161 },
+    { 2602, 2, 1, 7, 3161 },
+    { 2604, 2, 1, 0, 3168 },
+    { 2606, 2, 1, 7, 3168 },
+    { 2608, 8, 1, 0, 3175 },
+    { 2616, 8, 1, 0, 3175 },
+    { 2624, 6, 1, 0, 3175 },
+    { 2630, 5, 1, 0, 3175 },
+    { 2635, 5, 1, 0, 3175 },
+    { 2640, 7, 1, 0, 3175 },
+    { 2647, 5, 1, 1, 3175 },
+    { 2652, 2, 1, 0, 3176 },
+    { 2654, 2, 1, 10, 3176 },
+    { 2656, 2, 1, 8, 3186 },
+    { 2658, 8, 1, 0, 3194 },
+    { 2666, 5, 1, 0, 3194 },
+    { 2671, 4, 1, 0, 3194 },
+    { 2675, 5, 1, 0, 3194 },
+    { 2680, 7, 1, 0, 3194 },
+    { 2687, 4, 1, 0, 3194 },
+    { 2691, 2, 1, 0, 3194 },
+    { 2693, 2, 1, 7, 3194 },
+    { 2695, 4, 1, 0, 3201 },
+    { 2699, 7, 1, 0, 3201 },
+    { 2706, 7, 1, 0, 3201 },
+    { 2713, 4, 1, 0, 3201 },
+    { 2717, 3, 1, 0, 3201 },
+    { 2720, 4, 1, 0, 3201 },
+    { 2724, 8, 1, 0, 3201 },
+    { 2732, 6, 1, 1, 3201 },
+    { 2738, 10, 1, 0, 3202 },
+    { 2748, 4, 1, 0, 3202 },
+    { 2752, 8, 1, 0, 3202 },
+    { 2760, 4, 1, 0, 3202 },
+    { 2764, 6, 1, 0, 3202 },
+    { 2770, 4, 1, 0, 3202 },
+    { 2774, 6, 1, 0, 3202 },
+    { 2780, 9, 1, 0, 3202 },
+    { 2789, 7, 1, 0, 3202 },
+    { 2796, 3, 1, 0, 3202 },
+    { 2799, 2, 1, 40, 3202 },
+    { 2801, 3, 1, 0, 3242 },
+    { 2804, 2, 1, 0, 3242 },
+    { 2806, 2, 1, 7, 3242 },
+    { 2808, 6, 1, 0, 3249 },
+    { 2814, 8, 1, 0, 3249 },
+    { 2822, 7, 1, 0, 3249 },
+    { 2829, 9, 1, 0, 3249 },
+    { 2838, 9, 1, 0, 3249 },
+    { 2847, 5, 1, 0, 3249 },
+    { 2852, 9, 1, 0, 3249 },
+    { 2861, 5, 1, 0, 3249 },
+    { 2866, 5, 1, 0, 3249 },
+    { 2871, 8, 1, 0, 3249 },
+    { 2879, 4, 1, 11, 3249 },
+    { 2883, 7, 1, 1, 3260 },
+    { 2890, 3, 1, 0, 3261 },
+    { 2893, 7, 1, 0, 3261 },
+    { 2900, 6, 1, 0, 3261 },
+    { 2906, 7, 1, 0, 3261 },
+    { 2913, 5, 1, 0, 3261 },
+    { 2918, 3, 1, 0, 3261 },
+    { 2921, 2, 1, 6, 3261 },
+    { 2923, 4, 1, 0, 3267 },
+    { 2927, 2, 1, 17, 3267 },
+    { 2929, 2, 1, 32, 3284 },
+    { 2931, 6, 1, 0, 3316 },
+    { 2937, 5, 1, 0, 3316 },
+    { 2942, 7, 1, 0, 3316 },
+    { 2949, 3, 1, 0, 3316 },
+    { 2952, 4, 1, 0, 3316 },
+    { 2956, 3, 1, 0, 3316 },
+    { 2959, 3, 1, 0, 3316 },
+    { 2962, 2, 1, 14, 3316 },
+    { 2964, 2, 1, 3, 3330 },
+    { 2966, 4, 1, 0, 3333 },
+    { 2970, 3, 1, 0, 3333 },
+    { 2973, 5, 1, 0, 3333 },
+    { 2978, 2, 1, 8, 3333 },
+    { 2980, 2, 1, 8, 3341 },
+    { 2982, 6, 1, 0, 3349 },
+    { 2988, 4, 1, 0, 3349 },
+    { 2992, 4, 1, 0, 3349 },
+    { 2996, 10, 1, 0, 3349 },
+    { 3006, 2, 1, 46, 3349 },
+    { 3008, 3, 1, 0, 3395 },
+    { 3011, 10, 1, 0, 3395 },
+    { 3021, 8, 1, 0, 3395 },
+    { 3029, 4, 1, 21, 3395 },
+    { 3033, 3, 1, 0, 3416 },
+    { 3036, 3, 1, 0, 3416 },
+    { 3039, 9, 1, 0, 3416 },
+    { 3048, 9, 1, 0, 3416 },
+    { 3057, 6, 1, 0, 3416 },
+    { 3063, 3, 1, 1, 3416 },
+    { 3066, 13, 1, 0, 3417 },
+    { 3079, 6, 1, 0, 3417 },
+    { 3085, 11, 1, 0, 3417 },
+    { 3096, 2, 1, 72, 3417 },
+    { 3098, 8, 1, 0, 3489 },
+    { 3106, 2, 1, 6, 3489 },
+    { 3108, 2, 1, 11, 3495 },
+    { 3110, 5, 1, 0, 3506 },
+    { 3115, 2, 1, 8, 3506 },
+    { 3117, 7, 1, 0, 3514 },
+    { 3124, 3, 1, 0, 3514 },
+    { 3127, 8, 1, 0, 3514 },
+    { 3135, 2, 1, 437, 3514 },
+    { 3137, 4, 1, 0, 3951 },
+    { 3141, 3, 1, 0, 3951 },
+    { 3144, 6, 1, 0, 3951 },
+    { 3150, 4, 1, 0, 3951 },
+    { 3154, 3, 1, 0, 3951 },
+    { 3157, 2, 1, 4, 3951 },
+    { 3159, 4, 1, 0, 3955 },
+    { 3163, 5, 1, 0, 3955 },
+    { 3168, 7, 1, 0, 3955 },
+    { 3175, 3, 1, 0, 3955 },
+    { 3178, 3, 1, 0, 3955 },
+    { 3181, 2, 4, 0, 3955 },
+    { 3183, 3, 1, 0, 3955 },
+    { 3186, 3, 1, 0, 3955 },
+    { 3189, 2, 1, 8, 3955 },
+    { 3191, 4, 1, 0, 3963 },
+    { 3195, 6, 1, 0, 3963 },
+    { 3201, 3, 1, 0, 3963 },
+    { 3204, 3, 1, 0, 3963 },
+    { 3207, 2, 1, 270, 3963 },
+    { 3209, 8, 1, 0, 4233 },
+    { 3217, 4, 1, 0, 4233 },
+    { 3221, 6, 1, 0, 4233 },
+    { 3227, 7, 1, 0, 4233 },
+    { 3234, 6, 1, 0, 4233 },
+    { 3240, 4, 1, 0, 4233 },
+    { 3244, 2, 1, 9, 4233 },
+    { 3246, 11, 1, 0, 4242 },
+    { 3257, 14, 1, 0, 4242 },
+    { 3271, 15, 1, 0, 4242 },
+    { 3286, 3, 1, 0, 4242 },
+    { 3289, 2, 1, 12, 4242 },
+    { 3291, 2, 4, 0, 4254 },
+    { 3293, 2, 1, 7, 4254 },
+    { 3295, 3, 1, 0, 4261 },
+    { 3298, 4, 1, 0, 4261 },
+    { 3302, 3, 1, 0, 4261 },
+    { 3305, 6, 1, 0, 4261 },
+    { 3311, 6, 1, 0, 4261 },
+    { 3317, 7, 1, 0, 4261 },
+    { 3324, 4, 1, 0, 4261 },
+    { 3328, 2, 1, 17, 4261 },
+    { 3330, 2, 1, 4, 4278 },
+    { 3332, 5, 1, 0, 4282 },
+    { 3337, 7, 1, 0, 4282 },
+    { 3344, 6, 1, 0, 4282 },
+    { 3350, 2, 1, 6, 4282 },
+    { 3352, 4, 1, 0, 4288 },
+    { 3356, 3, 1, 0, 4288 },
+    { 3359, 2, 1, 30, 4288 },
+    { 3361, 3, 1, 2, 4318 },
+    { 3364, 4, 1, 0, 4320 },
+    { 3368, 9, 1, 0, 4320 },
+    { 3377, 2, 1, 7, 4320 },
+    { 3379, 2, 1, 4, 4327 },
+    { 3381, 5, 1, 0, 4331 },
+    { 3386, 2, 1, 8, 4331 },
+    { 3388, 2, 1, 10, 4339 },
+    { 3390, 7, 1, 0, 4349 },
+    { 3397, 11, 1, 0, 4349 },
+    { 3408, 5, 1, 0, 4349 },
+    { 3413, 9, 1, 0, 4349 },
+    { 3422, 6, 1, 0, 4349 },
+    { 3428, 4, 1, 1, 4349 },
+    { 3432, 9, 1, 0, 4350 },
+    { 3441, 7, 1, 0, 4350 },
+    { 3448, 7, 1, 0, 4350 },
+    { 3455, 3, 1, 0, 4350 },
+    { 3458, 6, 1, 0, 4350 },
+    { 3464, 7, 1, 0, 4350 },
+    { 3471, 3, 1, 0, 4350 },
+    { 3474, 6, 1, 0, 4350 },
+    { 3480, 2, 1, 5, 4350 },
+    { 3482, 2, 1, 7, 4355 },
+    { 3484, 3, 1, 0, 4362 },
+    { 3487, 5, 1, 0, 4362 },
+    { 3492, 7, 1, 0, 4362 },
+    { 3499, 6, 1, 0, 4362 },
+    { 3505, 5, 1, 0, 4362 },
+    { 3510, 4, 1, 0, 4362 },
+    { 3514, 5, 1, 0, 4362 },
+    { 3519, 4, 1, 0, 4362 },
+    { 3523, 2, 1, 2, 4362 },
+    { 3525, 4, 1, 0, 4364 },
+    { 3529, 4, 1, 0, 4364 },
+    { 3533, 13, 1, 0, 4364 },
+    { 3546, 9, 1, 0, 4364 },
+    { 3555, 8, 1, 0, 4364 },
+    { 3563, 4, 1, 0, 4364 },
+    { 3567, 5, 1, 0, 4364 },
+    { 3572, 7, 1, 0, 4364 },
+    { 3579, 4, 1, 0, 4364 },
+    { 3583, 7, 1, 0, 4364 },
+    { 3590, 5, 1, 0, 4364 },
+    { 3595, 4, 1, 3, 4364 },
+    { 3599, 5, 1, 0, 4367 },
+    { 3604, 4, 1, 1, 4367 },
+    { 3608, 6, 1, 0, 4368 },
+    { 3614, 2, 1, 15, 4368 },
+    { 3616, 3, 1, 0, 4383 },
+    { 3619, 3, 1, 0, 4383 },
+    { 3622, 4, 1, 0, 4383 },
+    { 3626, 5, 1, 0, 4383 },
+    { 3631, 6, 1, 0, 4383 },
+    { 3637, 5, 1, 0, 4383 },
+    { 3642, 3, 1, 1, 4383 },
+    { 3645, 6, 1, 0, 4384 },
+    { 3651, 5, 1, 0, 4384 },
+    { 3656, 5, 1, 0, 4384 },
+    { 3661, 4, 1, 0, 4384 },
+    { 3665, 3, 1, 0, 4384 },
+    { 3668, 12, 1, 0, 4384 },
+    { 3680, 2, 1, 5, 4384 },
+    { 3682, 2, 1, 10, 4389 },
+    { 3684, 2, 1, 2, 4399 },
+    { 3686, 3, 1, 0, 4401 },
+    { 3689, 4, 1, 0, 4401 },
+    { 3693, 2, 1, 2, 4401 },
+    { 3695, 8, 1, 0, 4403 },
+    { 3703, 4, 1, 0, 4403 },
+    { 3707, 6, 1, 0, 4403 },
+    { 3713, 2, 1, 9, 4403 },
+    { 3715, 2, 1, 9, 4412 },
+    { 3717, 2, 1, 6, 4421 },
+    { 3719, 5, 1, 0, 4427 },
+    { 3724, 6, 1, 0, 4427 },
+    { 3730, 4, 1, 0, 4427 },
+    { 3734, 6, 1, 0, 4427 },
+    { 3740, 6, 1, 0, 4427 },
+    { 3746, 3, 1, 0, 4427 },
+    { 3749, 10, 1, 1, 4427 },
+    { 3759, 5, 1, 0, 4428 },
+    { 3764, 3, 1, 0, 4428 },
+    { 3767, 6, 1, 0, 4428 },
+    { 3773, 9, 1, 0, 4428 },
+    { 3782, 7, 1, 0, 4428 },
+    { 3789, 8, 1, 0, 4428 },
+    { 3797, 9, 1, 0, 4428 },
+    { 3806, 8, 1, 0, 4428 },
+    { 3814, 6, 1, 0, 4428 },
+    { 3820, 3, 1, 0, 4428 },
+    { 3823, 2, 1, 2, 4428 },
+    { 3825, 8, 1, 0, 4430 },
+    { 3833, 2, 1, 5, 4430 },
+    { 3835, 2, 1, 43, 4435 },
+    { 3837, 3, 1, 0, 4478 },
+    { 3840, 5, 1, 1, 4478 },
+    { 3845, 4, 1, 0, 4479 },
+    { 3849, 9, 1, 0, 4479 },
+    { 3858, 4, 1, 0, 4479 },
+    { 3862, 8, 1, 0, 4479 },
+    { 3870, 3, 1, 0, 4479 },
+    { 3873, 4, 1, 1, 4479 },
+    { 3877, 8, 1, 0, 4480 },
+    { 3885, 2, 1, 9, 4480 },
+    { 3887, 2, 1, 0, 4489 },
+    { 3889, 5, 1, 0, 4489 },
+    { 3894, 9, 1, 0, 4489 },
+    { 3903, 3, 1, 0, 4489 },
+    { 3906, 4, 1, 0, 4489 },
+    { 3910, 4, 1, 0, 4489 },
+    { 3914, 3, 1, 0, 4489 },
+    { 3917, 10, 1, 0, 4489 },
+    { 3927, 2, 1, 8, 4489 },
+    { 3929, 2, 1, 7, 4497 },
+    { 3931, 3, 1, 0, 4504 },
+    { 3934, 3, 1, 0, 4504 },
+    { 3937, 2, 4, 0, 4504 },
+    { 3939, 3, 1, 0, 4504 },
+    { 3942, 2, 1, 4, 4504 },
+    { 3944, 2, 1, 5, 4508 },
+    { 3946, 4, 1, 2, 4513 },
+    { 3950, 6, 1, 0, 4515 },
+    { 3956, 4, 1, 0, 4515 },
+    { 3960, 3, 1, 0, 4515 },
+    { 3963, 3, 1, 0, 4515 },
+    { 3966, 3, 1, 0, 4515 },
+    { 3969, 6, 1, 0, 4515 },
+    { 3975, 5, 1, 0, 4515 },
+    { 3980, 7, 1, 0, 4515 },
+    { 3987, 6, 1, 0, 4515 },
+    { 3993, 8, 1, 0, 4515 },
+    { 4001, 6, 1, 0, 4515 },
+    { 4007, 4, 1, 0, 4515 },
+    { 4011, 11, 1, 0, 4515 },
+    { 4022, 3, 1, 0, 4515 },
+    { 4025, 5, 1, 0, 4515 },
+    { 4030, 2, 1, 1, 4515 },
+    { 4032, 2, 1, 0, 4516 },
+    { 4034, 2, 1, 2, 4516 },
+    { 4036, 2, 1, 7, 4518 },
+    { 4038, 3, 1, 0, 4525 },
+    { 4041, 2, 1, 4, 4525 },
+    { 4043, 3, 1, 0, 4529 },
+    { 4046, 3, 1, 0, 4529 },
+    { 4049, 2, 1, 7, 4529 },
+    { 4051, 6, 1, 551, 4536 },
+    { 4057, 5, 1, 0, 5087 },
+    { 4062, 6, 1, 0, 5087 },
+    { 4068, 2, 1, 14, 5087 },
+    { 4070, 2, 1, 11, 5101 },
+    { 4072, 2, 1, 6, 5112 },
+    { 4074, 2, 1, 9, 5118 },
+    { 4076, 2, 1, 8, 5127 },
+    { 4078, 2, 1, 17, 5135 },
+    { 4080, 3, 1, 0, 5152 },
+    { 4083, 6, 1, 0, 5152 },
+    { 4089, 4, 1, 2, 5152 },
+    { 4093, 6, 1, 0, 5154 },
+    { 4099, 4, 1, 0, 5154 },
+    { 4103, 3, 1, 0, 5154 },
+    { 4106, 2, 1, 2, 5154 },
+    { 4108, 2, 1, 0, 5156 },
+    { 4110, 3, 1, 0, 5156 },
+    { 4113, 3, 1, 165, 5156 },
+    { 4116, 7, 1, 0, 5321 },
+    { 4123, 7, 1, 0, 5321 },
+    { 4130, 7, 1, 5, 5321 },
+    { 4137, 7, 1, 0, 5326 },
+    { 4144, 3, 1, 0, 5326 },
+    { 4147, 4, 1, 1, 5326 },
+    { 4151, 4, 1, 0, 5327 },
+    { 4155, 10, 1, 0, 5327 },
+    { 4165, 5, 1, 0, 5327 },
+    { 4170, 2, 1, 10, 5327 },
+    { 4172, 3, 1, 0, 5337 },
+    { 4175, 2, 1, 15, 5337 },
+    { 4177, 3, 1, 0, 5352 },
+    { 4180, 3, 1, 0, 5352 },
+    { 4183, 2, 1, 14, 5352 },
+    { 4185, 4, 1, 0, 5366 },
+    { 4189, 4, 1, 0, 5366 },
+    { 4193, 5, 1, 0, 5366 },
+    { 4198, 5, 1, 0, 5366 },
+    { 4203, 6, 1, 0, 5366 },
+    { 4209, 6, 1, 0, 5366 },
+    { 4215, 2, 1, 10, 5366 },
+    { 4217, 2, 1, 896, 5376 },
+    { 4219, 5, 1, 0, 6272 },
+    { 4224, 18, 1, 0, 6272 },
+    { 4242, 6, 1, 0, 6272 },
+    { 4248, 3, 1, 0, 6272 },
+    { 4251, 6, 1, 0, 6272 },
+    { 4257, 5, 1, 0, 6272 },
+    { 4262, 2, 4, 0, 6272 },
+    { 4264, 2, 1, 7, 6272 },
+    { 4266, 3, 1, 0, 6279 },
+    { 4269, 3, 1, 0, 6279 },
+    { 4272, 3, 1, 0, 6279 },
+    { 4275, 2, 1, 4, 6279 },
+    { 4277, 3, 1, 0, 6283 },
+    { 4280, 2, 1, 17, 6283 },
+    { 4282, 3, 1, 0, 6300 },
+    { 4285, 8, 1, 0, 6300 },
+    { 4293, 6, 1, 0, 6300 },
+    { 4299, 7, 1, 0, 6300 },
+    { 4306, 6, 1, 0, 6300 },
+    { 4312, 11, 1, 0, 6300 },
+    { 4323, 7, 1, 0, 6300 },
+    { 4330, 4, 1, 0, 6300 },
+    { 4334, 2, 1, 9, 6300 },
+    { 4336, 5, 1, 0, 6309 },
+    { 4341, 3, 1, 3, 6309 },
+    { 4344, 3, 1, 0, 6312 },
+    { 4347, 5, 1, 0, 6312 },
+    { 4352, 3, 1, 0, 6312 },
+    { 4355, 6, 1, 3, 6312 },
+    { 4361, 3, 1, 0, 6315 },
+    { 4364, 4, 1, 0, 6315 },
+    { 4368, 6, 1, 0, 6315 },
+    { 4374, 6, 1, 1, 6315 },
+    { 4380, 3, 1, 114, 6316 },
+    { 4383, 7, 1, 0, 6430 },
+    { 4390, 7, 1, 0, 6430 },
+    { 4397, 5, 1, 0, 6430 },
+    { 4402, 6, 1, 0, 6430 },
+    { 4408, 3, 1, 0, 6430 },
+    { 4411, 3, 1, 1, 6430 },
+    { 4414, 2, 1, 11, 6431 },
+    { 4416, 4, 1, 9, 6442 },
+    { 4420, 9, 1, 0, 6451 },
+    { 4429, 5, 1, 0, 6451 },
+    { 4434, 4, 1, 0, 6451 },
+    { 4438, 8, 1, 0, 6451 },
+    { 4446, 5, 1, 0, 6451 },
+    { 4451, 5, 1, 1, 6451 },
+    { 4456, 9, 1, 0, 6452 },
+    { 4465, 3, 1, 0, 6452 },
+    { 4468, 4, 1, 0, 6452 },
+    { 4472, 2, 1, 8, 6452 },
+    { 4474, 3, 1, 0, 6460 },
+    { 4477, 2, 1, 3, 6460 },
+    { 4479, 6, 1, 0, 6463 },
+    { 4485, 2, 4, 0, 6463 },
+    { 4487, 2, 1, 8, 6463 },
+    { 4489, 8, 1, 0, 6471 },
+    { 4497, 3, 1, 0, 6471 },
+    { 4500, 7, 1, 0, 6471 },
+    { 4507, 5, 1, 0, 6471 },
+    { 4512, 5, 1, 0, 6471 },
+    { 4517, 11, 1, 0, 6471 },
+    { 4528, 6, 1, 1, 6471 },
+    { 4534, 6, 1, 0, 6472 },
+    { 4540, 4, 1, 0, 6472 },
+    { 4544, 6, 1, 0, 6472 },
+    { 4550, 8, 1, 1, 6472 },
+    { 4558, 3, 1, 0, 6473 },
+    { 4561, 3, 1, 0, 6473 },
+    { 4564, 4, 1, 0, 6473 },
+    { 4568, 4, 1, 0, 6473 },
+    { 4572, 7, 1, 0, 6473 },
+    { 4579, 5, 1, 0, 6473 },
+    { 4584, 2, 1, 14, 6473 },
+    { 4586, 2, 1, 179, 6487 },
+    { 4588, 5, 1, 1, 6666 },
+    { 4593, 4, 1, 0, 6667 },
+    { 4597, 11, 1, 0, 6667 },
+    { 4608, 8, 1, 0, 6667 },
+    { 4616, 4, 1, 0, 6667 },
+    { 4620, 2, 1, 2, 6667 },
+    { 4622, 2, 1, 5, 6669 },
+    { 4624, 3, 1, 0, 6674 },
+    { 4627, 4, 1, 0, 6674 },
+    { 4631, 5, 1, 0, 6674 },
+    { 4636, 7, 1, 0, 6674 },
+    { 4643, 4, 1, 1, 6674 },
+    { 4647, 4, 1, 0, 6675 },
+    { 4651, 2, 1, 13, 6675 },
+    { 4653, 9, 1, 0, 6688 },
+    { 4662, 5, 1, 0, 6688 },
+    { 4667, 5, 1, 0, 6688 },
+    { 4672, 5, 1, 0, 6688 },
+    { 4677, 3, 1, 14, 6688 },
+    { 4680, 4, 1, 0, 6702 },
+    { 4684, 11, 1, 0, 6702 },
+    { 4695, 4, 1, 0, 6702 },
+    { 4699, 11, 1, 0, 6702 },
+    { 4710, 5, 1, 0, 6702 },
+    { 4715, 10, 1, 0, 6702 },
+    { 4725, 8, 1, 0, 6702 },
+    { 4733, 10, 1, 0, 6702 },
+    { 4743, 3, 1, 0, 6702 },
+    { 4746, 10, 1, 0, 6702 },
+    { 4756, 2, 1, 7, 6702 },
+    { 4758, 2, 1, 10, 6709 },
+    { 4760, 3, 1, 1, 6719 },
+    { 4763, 2, 1, 8, 6720 },
+    { 4765, 3, 1, 0, 6728 },
+    { 4768, 2, 1, 7, 6728 },
+    { 4770, 2, 1, 9, 6735 },
+    { 4772, 4, 1, 0, 6744 },
+    { 4776, 6, 1, 0, 6744 },
+    { 4782, 5, 1, 0, 6744 },
+    { 4787, 6, 1, 0, 6744 },
+    { 4793, 5, 1, 0, 6744 },
+    { 4798, 2, 1, 4, 6744 },
+    { 4800, 4, 1, 0, 6748 },
+    { 4804, 10, 1, 0, 6748 },
+    { 4814, 7, 1, 0, 6748 },
+    { 4821, 6, 1, 0, 6748 },
+    { 4827, 7, 1, 0, 6748 },
+    { 4834, 3, 1, 0, 6748 },
+    { 4837, 8, 1, 0, 6748 },
+    { 4845, 11, 1, 0, 6748 },
+    { 4856, 5, 1, 0, 6748 },
+    { 4861, 5, 1, 0, 6748 },
+    { 4866, 6, 1, 0, 6748 },
+    { 4872, 4, 1, 0, 6748 },
+    { 4876, 8, 1, 0, 6748 },
+    { 4884, 3, 1, 0, 6748 },
+    { 4887, 4, 1, 0, 6748 },
+    { 4891, 7, 1, 0, 6748 },
+    { 4898, 6, 1, 0, 6748 },
+    { 4904, 6, 1, 0, 6748 },
+    { 4910, 10, 1, 0, 6748 },
+    { 4920, 4, 1, 0, 6748 },
+    { 4924, 10, 1, 0, 6748 },
+    { 4934, 6, 1, 1, 6748 },
+    { 4940, 7, 1, 0, 6749 },
+    { 4947, 7, 1, 0, 6749 },
+    { 4954, 4, 1, 0, 6749 },
+    { 4958, 9, 1, 0, 6749 },
+    { 4967, 5, 1, 0, 6749 },
+    { 4972, 3, 1, 0, 6749 },
+    { 4975, 3, 1, 0, 6749 },
+    { 4978, 3, 1, 1, 6749 },
+    { 4981, 2, 1, 15, 6750 },
+    { 4983, 6, 1, 0, 6765 },
+    { 4989, 5, 1, 3, 6765 },
+    { 4994, 5, 1, 0, 6768 },
+    { 4999, 6, 1, 0, 6768 },
+    { 5005, 4, 1, 0, 6768 },
+    { 5009, 2, 1, 10, 6768 },
+    { 5011, 4, 1, 0, 6778 },
+    { 5015, 2, 1, 40, 6778 },
+    { 5017, 5, 1, 0, 6818 },
+    { 5022, 4, 1, 0, 6818 },
+    { 5026, 3, 1, 10, 6818 },
+    { 5029, 2, 1, 7, 6828 },
+    { 5031, 3, 1, 0, 6835 },
+    { 5034, 6, 1, 0, 6835 },
+    { 5040, 2, 1, 8, 6835 },
+    { 5042, 8, 1, 0, 6843 },
+    { 5050, 4, 1, 0, 6843 },
+    { 5054, 6, 1, 0, 6843 },
+    { 5060, 6, 1, 0, 6843 },
+    { 5066, 4, 1, 0, 6843 },
+    { 5070, 5, 1, 0, 6843 },
+    { 5075, 8, 1, 0, 6843 },
+    { 5083, 7, 1, 0, 6843 },
+    { 5090, 7, 1, 0, 6843 },
+    { 5097, 15, 1, 0, 6843 },
+    { 5112, 6, 1, 0, 6843 },
+    { 5118, 3, 1, 0, 6843 },
+    { 5121, 4, 1, 0, 6843 },
+    { 5125, 3, 1, 0, 6843 },
+    { 5128, 4, 1, 0, 6843 },
+    { 5132, 4, 1, 0, 6843 },
+    { 5136, 2, 1, 5, 6843 },
+    { 5138, 3, 1, 0, 6848 },
+    { 5141, 3, 1, 0, 6848 },
+    { 5144, 2, 1, 5, 6848 },
+    { 5146, 3, 1, 0, 6853 },
+    { 5149, 3, 1, 0, 6853 },
+    { 5152, 10, 1, 0, 6853 },
+    { 5162, 7, 1, 0, 6853 },
+    { 5169, 12, 1, 0, 6853 },
+    { 5181, 6, 1, 0, 6853 },
+    { 5187, 6, 1, 0, 6853 },
+    { 5193, 7, 1, 0, 6853 },
+    { 5200, 7, 1, 1, 6853 },
+    { 5207, 4, 1, 2, 6854 },
+    { 5211, 2, 1, 8, 6856 },
+    { 5213, 2, 1, 47, 6864 },
+    { 5215, 6, 1, 0, 6911 },
+    { 5221, 4, 1, 0, 6911 },
+    { 5225, 6, 1, 0, 6911 },
+    { 5231, 8, 1, 0, 6911 },
+    { 5239, 4, 1, 0, 6911 },
+    { 5243, 6, 1, 0, 6911 },
+    { 5249, 5, 1, 0, 6911 },
+    { 5254, 8, 1, 1, 6911 },
+    { 5262, 5, 1, 0, 6912 },
+    { 5267, 3, 1, 0, 6912 },
+    { 5270, 3, 1, 0, 6912 },
+    { 5273, 4, 1, 0, 6912 },
+    { 5277, 3, 1, 0, 6912 },
+    { 5280, 2, 1, 8, 6912 },
+    { 5282, 2, 1, 11, 6920 },
+    { 5284, 9, 1, 0, 6931 },
+    { 5293, 5, 1, 0, 6931 },
+    { 5298, 4, 1, 0, 6931 },
+    { 5302, 5, 1, 0, 6931 },
+    { 5307, 4, 1, 0, 6931 },
+    { 5311, 7, 1, 0, 6931 },
+    { 5318, 5, 1, 0, 6931 },
+    { 5323, 4, 1, 3, 6931 },
+    { 5327, 8, 1, 0, 6934 },
+    { 5335, 6, 1, 0, 6934 },
+    { 5341, 4, 1, 0, 6934 },
+    { 5345, 8, 1, 0, 6934 },
+    { 5353, 2, 1, 3, 6934 },
+    { 5355, 4, 1, 0, 6937 },
+    { 5359, 4, 1, 0, 6937 },
+    { 5363, 7, 1, 0, 6937 },
+    { 5370, 4, 1, 17, 6937 },
+    { 5374, 2, 1, 0, 6954 },
+    { 5376, 2, 1, 1, 6954 },
+    { 5378, 3, 1, 0, 6955 },
+    { 5381, 4, 1, 0, 6955 },
+    { 5385, 3, 1, 0, 6955 },
+    { 5388, 5, 1, 0, 6955 },
+    { 5393, 2, 1, 5, 6955 },
+    { 5395, 5, 1, 0, 6960 },
+    { 5400, 2, 1, 0, 6960 },
+    { 5402, 5, 1, 0, 6960 },
+    { 5407, 5, 1, 0, 6960 },
+    { 5412, 2, 1, 8, 6960 },
+    { 5414, 4, 1, 0, 6968 },
+    { 5418, 2, 1, 7, 6968 },
+    { 5420, 6, 1, 0, 6975 },
+    { 5426, 6, 1, 0, 6975 },
+    { 5432, 8, 1, 0, 6975 },
+    { 5440, 8, 1, 0, 6975 },
+    { 5448, 4, 1, 0, 6975 },
+    { 5452, 5, 1, 0, 6975 },
+    { 5457, 9, 1, 1, 6975 },
+    { 5466, 4, 1, 0, 6976 },
+    { 5470, 4, 1, 0, 6976 },
+    { 5474, 3, 1, 0, 6976 },
+    { 5477, 3, 1, 0, 6976 },
+    { 5480, 5, 1, 3, 6976 },
+    { 5485, 5, 1, 0, 6979 },
+    { 5490, 4, 1, 0, 6979 },
+    { 5494, 2, 1, 0, 6979 },
+    { 5496, 3, 1, 0, 6979 },
+    { 5499, 2, 1, 8, 6979 },
+    { 5501, 2, 1, 12, 6987 },
+    { 5503, 5, 1, 0, 6999 },
+    { 5508, 7, 1, 0, 6999 },
+    { 5515, 4, 1, 0, 6999 },
+    { 5519, 9, 1, 0, 6999 },
+    { 5528, 9, 1, 0, 6999 },
+    { 5537, 3, 1, 0, 6999 },
+    { 5540, 8, 1, 0, 6999 },
+    { 5548, 9, 1, 0, 6999 },
+    { 5557, 7, 1, 0, 6999 },
+    { 5564, 5, 1, 3, 6999 },
+    { 5569, 6, 1, 0, 7002 },
+    { 5575, 6, 1, 0, 7002 },
+    { 5581, 5, 1, 0, 7002 },
+    { 5586, 5, 1, 0, 7002 },
+    { 5591, 2, 1, 52, 7002 },
+    { 5593, 5, 1, 0, 7054 },
+    { 5598, 8, 1, 0, 7054 },
+    { 5606, 6, 1, 0, 7054 },
+    { 5612, 7, 1, 1, 7054 },
+    { 5619, 4, 1, 0, 7055 },
+    { 5623, 7, 1, 0, 7055 },
+    { 5630, 6, 1, 0, 7055 },
+    { 5636, 2, 1, 5, 7055 },
+    { 5638, 6, 1, 0, 7060 },
+    { 5644, 5, 1, 0, 7060 },
+    { 5649, 2, 1, 1, 7060 },
+    { 5651, 2, 1, 6, 7061 },
+    { 5653, 6, 1, 0, 7067 },
+    { 5659, 7, 1, 1, 7067 },
+    { 5666, 2, 1, 3, 7068 },
+    { 5668, 3, 1, 0, 7071 },
+    { 5671, 6, 1, 0, 7071 },
+    { 5677, 4, 1, 0, 7071 },
+    { 5681, 6, 1, 0, 7071 },
+    { 5687, 6, 1, 0, 7071 },
+    { 5693, 10, 1, 0, 7071 },
+    { 5703, 5, 1, 0, 7071 },
+    { 5708, 6, 1, 0, 7071 },
+    { 5714, 3, 1, 0, 7071 },
+    { 5717, 4, 1, 0, 7071 },
+    { 5721, 2, 1, 3, 7071 },
+    { 5723, 3, 1, 0, 7074 },
+    { 5726, 2, 1, 1, 7074 },
+    { 5728, 3, 1, 0, 7075 },
+    { 5731, 4, 1, 2, 7075 },
+    { 5735, 4, 1, 0, 7077 },
+    { 5739, 10, 1, 1, 7077 },
+    { 5749, 3, 1, 0, 7078 },
+    { 5752, 7, 1, 0, 7078 },
+    { 5759, 6, 1, 0, 7078 },
+    { 5765, 4, 1, 0, 7078 },
+    { 5769, 2, 1, 1, 7078 },
+    { 5771, 2, 1, 0, 7079 },
+    { 5773, 2, 1, 9, 7079 },
+    { 5775, 3, 1, 0, 7088 },
+    { 5778, 7, 1, 0, 7088 },
+    { 5785, 7, 1, 0, 7088 },
+    { 5792, 4, 1, 0, 7088 },
+    { 5796, 7, 1, 0, 7088 },
+    { 5803, 6, 1, 0, 7088 },
+    { 5809, 7, 1, 0, 7088 },
+    { 5816, 4, 1, 0, 7088 },
+    { 5820, 5, 1, 0, 7088 },
+    { 5825, 5, 1, 0, 7088 },
+    { 5830, 2, 1, 15, 7088 },
+    { 5832, 6, 1, 0, 7103 },
+    { 5838, 3, 1, 0, 7103 },
+    { 5841, 2, 1, 0, 7103 },
+    { 5843, 6, 1, 0, 7103 },
+    { 5849, 2, 1, 1, 7103 },
+    { 5851, 2, 1, 8, 7104 },
+    { 5853, 5, 1, 0, 7112 },
+    { 5858, 2, 1, 14, 7112 },
+    { 5860, 2, 1, 12, 7126 },
+    { 5862, 5, 1, 1, 7138 },
+    { 5867, 5, 1, 0, 7139 },
+    { 5872, 5, 1, 0, 7139 },
+    { 5877, 3, 1, 2, 7139 },
+    { 5880, 5, 1, 0, 7141 },
+    { 5885, 7, 1, 0, 7141 },
+    { 5892, 5, 1, 0, 7141 },
+    { 5897, 5, 1, 0, 7141 },
+    { 5902, 4, 1, 0, 7141 },
+    { 5906, 6, 1, 0, 7141 },
+    { 5912, 4, 1, 0, 7141 },
+    { 5916, 2, 1, 22, 7141 },
+    { 5918, 5, 1, 1, 7163 },
+    { 5923, 7, 1, 0, 7164 },
+    { 5930, 8, 1, 0, 7164 },
+    { 5938, 6, 1, 0, 7164 },
+    { 5944, 13, 1, 0, 7164 },
+    { 5957, 9, 1, 0, 7164 },
+    { 5966, 18, 1, 0, 7164 },
+    { 5984, 5, 1, 0, 7164 },
+    { 5989, 3, 1, 0, 7164 },
+    { 5992, 2, 1, 17, 7164 },
+    { 5994, 4, 1, 0, 7181 },
+    { 5998, 3, 1, 0, 7181 },
+    { 6001, 5, 1, 0, 7181 },
+    { 6006, 5, 1, 0, 7181 },
+    { 6011, 2, 1, 4, 7181 },
+    { 6013, 3, 1, 0, 7185 },
+    { 6016, 2, 1, 18, 7185 },
+    { 6018, 2, 1, 12, 7203 },
+    { 6020, 2, 1, 83, 7215 },
+    { 6022, 5, 1, 0, 7298 },
+    { 6027, 3, 1, 0, 7298 },
+    { 6030, 2, 1, 9, 7298 },
+    { 6032, 2, 1, 23, 7307 },
+    { 6034, 6, 1, 0, 7330 },
+    { 6040, 10, 1, 0, 7330 },
+    { 6050, 3, 1, 0, 7330 },
+    { 6053, 3, 1, 0, 7330 },
+    { 6056, 3, 1, 0, 7330 },
+    { 6059, 2, 1, 73, 7330 },
+    { 6061, 2, 1, 6, 7403 },
+    { 6063, 2, 1, 4, 7409 },
+    { 6065, 2, 1, 0, 7413 },
+    { 6067, 9, 1, 0, 7413 },
+    { 6076, 4, 1, 0, 7413 },
+    { 6080, 8, 1, 0, 7413 },
+    { 6088, 2, 1, 8, 7413 },
+    { 6090, 2, 1, 20, 7421 },
+    { 6092, 5, 1, 0, 7441 },
+    { 6097, 8, 1, 0, 7441 },
+    { 6105, 8, 1, 0, 7441 },
+    { 6113, 17, 1, 0, 7441 },
+    { 6130, 18, 1, 0, 7441 },
+    { 6148, 12, 1, 0, 7441 },
+    { 6160, 3, 1, 0, 7441 },
+    { 6163, 2, 1, 1, 7441 },
+    { 6165, 2, 1, 5, 7442 },
+    { 6167, 6, 1, 0, 7447 },
+    { 6173, 5, 1, 0, 7447 },
+    { 6178, 3, 1, 0, 7447 },
+    { 6181, 6, 1, 0, 7447 },
+    { 6187, 6, 1, 0, 7447 },
+    { 6193, 3, 1, 0, 7447 },
+    { 6196, 3, 1, 0, 7447 },
+    { 6199, 6, 1, 0, 7447 },
+    { 6205, 4, 1, 0, 7447 },
+    { 6209, 6, 1, 0, 7447 },
+    { 6215, 4, 1, 0, 7447 },
+    { 6219, 4, 1, 0, 7447 },
+    { 6223, 10, 1, 0, 7447 },
+    { 6233, 2, 1, 13, 7447 },
+    { 6235, 5, 1, 0, 7460 },
+    { 6240, 10, 1, 0, 7460 },
+    { 6250, 5, 1, 0, 7460 },
+    { 6255, 4, 1, 0, 7460 },
+    { 6259, 6, 1, 0, 7460 },
+    { 6265, 4, 1, 0, 7460 },
+    { 6269, 6, 1, 0, 7460 },
+    { 6275, 2, 1, 8, 7460 },
+    { 6277, 6, 1, 0, 7468 },
+    { 6283, 5, 1, 0, 7468 },
+    { 6288, 7, 1, 0, 7468 },
+    { 6295, 6, 1, 0, 7468 },
+    { 6301, 4, 1, 0, 7468 },
+    { 6305, 7, 1, 0, 7468 },
+    { 6312, 5, 1, 0, 7468 },
+    { 6317, 7, 1, 0, 7468 },
+    { 6324, 7, 1, 0, 7468 },
+    { 6331, 14, 1, 0, 7468 },
+    { 6345, 6, 1, 0, 7468 },
+    { 6351, 5, 1, 0, 7468 },
+    { 6356, 7, 1, 1, 7468 },
+    { 6363, 7, 1, 0, 7469 },
+    { 6370, 5, 1, 0, 7469 },
+    { 6375, 4, 1, 0, 7469 },
+    { 6379, 2, 1, 2, 7469 },
+    { 6381, 7, 1, 0, 7471 },
+    { 6388, 4, 1, 0, 7471 },
+    { 6392, 4, 1, 1, 7471 },
+    { 6396, 11, 1, 0, 7472 },
+    { 6407, 3, 1, 0, 7472 },
+    { 6410, 7, 1, 0, 7472 },
+    { 6417, 4, 1, 0, 7472 },
+    { 6421, 7, 1, 0, 7472 },
+    { 6428, 3, 1, 0, 7472 },
+    { 6431, 13, 1, 0, 7472 },
+    { 6444, 8, 1, 0, 7472 },
+    { 6452, 4, 1, 0, 7472 },
+    { 6456, 5, 1, 0, 7472 },
+    { 6461, 5, 1, 0, 7472 },
+    { 6466, 3, 1, 0, 7472 },
+    { 6469, 2, 1, 9, 7472 },
+    { 6471, 3, 1, 0, 7481 },
+    { 6474, 3, 1, 0, 7481 },
+    { 6477, 4, 1, 0, 7481 },
+    { 6481, 5, 1, 0, 7481 },
+    { 6486, 7, 1, 0, 7481 },
+    { 6493, 6, 1, 0, 7481 },
+    { 6499, 3, 1, 0, 7481 },
+    { 6502, 11, 1, 0, 7481 },
+    { 6513, 11, 1, 0, 7481 },
+    { 6524, 11, 1, 0, 7481 },
+    { 6535, 11, 1, 0, 7481 },
+    { 6546, 10, 1, 0, 7481 },
+    { 6556, 11, 1, 0, 7481 },
+    { 6567, 11, 1, 0, 7481 },
+    { 6578, 12, 1, 0, 7481 },
+    { 6590, 11, 1, 0, 7481 },
+    { 6601, 10, 1, 0, 7481 },
+    { 6611, 11, 1, 0, 7481 },
+    { 6622, 12, 1, 0, 7481 },
+    { 6634, 11, 1, 0, 7481 },
+    { 6645, 10, 1, 0, 7481 },
+    { 6655, 12, 1, 4, 7481 },
+    { 6667, 10, 1, 0, 7485 },
+    { 6677, 14, 1, 0, 7485 },
+    { 6691, 11, 1, 0, 7485 },
+    { 6702, 10, 1, 0, 7485 },
+    { 6712, 17, 1, 0, 7485 },
+    { 6729, 10, 1, 0, 7485 },
+    { 6739, 11, 1, 0, 7485 },
+    { 6750, 14, 1, 0, 7485 },
+    { 6764, 12, 1, 0, 7485 },
+    { 6776, 11, 1, 0, 7485 },
+    { 6787, 14, 1, 0, 7485 },
+    { 6801, 12, 1, 0, 7485 },
+    { 6813, 10, 1, 0, 7485 },
+    { 6823, 12, 1, 0, 7485 },
+    { 6835, 10, 1, 6, 7485 },
+    { 6845, 8, 1, 0, 7491 },
+    { 6853, 9, 1, 0, 7491 },
+    { 6862, 10, 1, 0, 7491 },
+    { 6872, 10, 1, 0, 7491 },
+    { 6882, 11, 1, 0, 7491 },
+    { 6893, 14, 1, 0, 7491 },
+    { 6907, 17, 1, 0, 7491 },
+    { 6924, 9, 1, 0, 7491 },
+    { 6933, 10, 1, 0, 7491 },
+    { 6943, 11, 1, 0, 7491 },
+    { 6954, 13, 1, 0, 7491 },
+    { 6967, 10, 1, 0, 7491 },
+    { 6977, 22, 1, 0, 7491 },
+    { 6999, 11, 1, 0, 7491 },
+    { 7010, 10, 1, 0, 7491 },
+    { 7020, 10, 1, 0, 7491 },
+    { 7030, 11, 1, 0, 7491 },
+    { 7041, 9, 1, 0, 7491 },
+    { 7050, 9, 1, 0, 7491 },
+    { 7059, 13, 1, 0, 7491 },
+    { 7072, 11, 1, 0, 7491 },
+    { 7083, 11, 1, 0, 7491 },
+    { 7094, 9, 1, 0, 7491 },
+    { 7103, 14, 1, 0, 7491 },
+    { 7117, 10, 1, 0, 7491 },
+    { 7127, 10, 1, 0, 7491 },
+    { 7137, 10, 1, 0, 7491 },
+    { 7147, 11, 1, 0, 7491 },
+    { 7158, 11, 1, 0, 7491 },
+    { 7169, 13, 1, 0, 7491 },
+    { 7182, 13, 1, 0, 7491 },
+    { 7195, 16, 1, 0, 7491 },
+    { 7211, 11, 1, 0, 7491 },
+    { 7222, 12, 1, 0, 7491 },
+    { 7234, 11, 1, 0, 7491 },
+    { 7245, 11, 1, 0, 7491 },
+    { 7256, 14, 1, 0, 7491 },
+    { 7270, 11, 1, 0, 7491 },
+    { 7281, 13, 1, 0, 7491 },
+    { 7294, 11, 1, 0, 7491 },
+    { 7305, 15, 1, 0, 7491 },
+    { 7320, 11, 1, 0, 7491 },
+    { 7331, 10, 1, 0, 7491 },
+    { 7341, 9, 1, 0, 7491 },
+    { 7350, 9, 1, 0, 7491 },
+    { 7359, 11, 1, 6, 7491 },
+    { 7370, 14, 1, 0, 7497 },
+    { 7384, 11, 1, 0, 7497 },
+    { 7395, 15, 1, 0, 7497 },
+    { 7410, 11, 1, 0, 7497 },
+    { 7421, 11, 1, 0, 7497 },
+    { 7432, 10, 1, 0, 7497 },
+    { 7442, 9, 1, 0, 7497 },
+    { 7451, 15, 1, 0, 7497 },
+    { 7466, 12, 1, 0, 7497 },
+    { 7478, 12, 1, 0, 7497 },
+    { 7490, 14, 1, 0, 7497 },
+    { 7504, 15, 1, 0, 7497 },
+    { 7519, 14, 1, 0, 7497 },
+    { 7533, 16, 1, 0, 7497 },
+    { 7549, 15, 1, 0, 7497 },
+    { 7564, 14, 1, 0, 7497 },
+    { 7578, 12, 1, 0, 7497 },
+    { 7590, 17, 1, 0, 7497 },
+    { 7607, 18, 1, 0, 7497 },
+    { 7625, 17, 1, 0, 7497 },
+    { 7642, 14, 1, 0, 7497 },
+    { 7656, 11, 1, 0, 7497 },
+    { 7667, 14, 1, 0, 7497 },
+    { 7681, 15, 1, 0, 7497 },
+    { 7696, 14, 1, 0, 7497 },
+    { 7710, 16, 1, 0, 7497 },
+    { 7726, 19, 1, 0, 7497 },
+    { 7745, 17, 1, 0, 7497 },
+    { 7762, 12, 1, 0, 7497 },
+    { 7774, 14, 1, 0, 7497 },
+    { 7788, 12, 1, 0, 7497 },
+    { 7800, 19, 1, 0, 7497 },
+    { 7819, 16, 1, 0, 7497 },
+    { 7835, 12, 1, 0, 7497 },
+    { 7847, 12, 1, 0, 7497 },
+    { 7859, 11, 1, 0, 7497 },
+    { 7870, 14, 1, 0, 7497 },
+    { 7884, 11, 1, 0, 7497 },
+    { 7895, 11, 1, 0, 7497 },
+    { 7906, 12, 1, 0, 7497 },
+    { 7918, 10, 1, 0, 7497 },
+    { 7928, 12, 1, 0, 7497 },
+    { 7940, 12, 1, 0, 7497 },
+    { 7952, 9, 1, 0, 7497 },
+    { 7961, 11, 1, 0, 7497 },
+    { 7972, 8, 1, 0, 7497 },
+    { 7980, 9, 1, 0, 7497 },
+    { 7989, 15, 1, 0, 7497 },
+    { 8004, 11, 1, 0, 7497 },
+    { 8015, 10, 1, 6, 7497 },
+    { 8025, 12, 1, 0, 7503 },
+    { 8037, 11, 1, 0, 7503 },
+    { 8048, 9, 1, 10, 7503 },
+    { 8057, 8, 1, 0, 7513 },
+    { 8065, 11, 1, 0, 7513 },
+    { 8076, 10, 1, 0, 7513 },
+    { 8086, 10, 1, 0, 7513 },
+    { 8096, 11, 1, 0, 7513 },
+    { 8107, 12, 1, 0, 7513 },
+    { 8119, 9, 1, 0, 7513 },
+    { 8128, 8, 1, 0, 7513 },
+    { 8136, 11, 1, 0, 7513 },
+    { 8147, 11, 1, 0, 7513 },
+    { 8158, 14, 1, 0, 7513 },
+    { 8172, 11, 1, 0, 7513 },
+    { 8183, 11, 1, 0, 7513 },
+    { 8194, 11, 1, 0, 7513 },
+    { 8205, 9, 1, 0, 7513 },
+    { 8214, 13, 1, 0, 7513 },
+    { 8227, 10, 1, 0, 7513 },
+    { 8237, 23, 1, 0, 7513 },
+    { 8260, 24, 1, 0, 7513 },
+    { 8284, 9, 1, 0, 7513 },
+    { 8293, 11, 1, 0, 7513 },
+    { 8304, 20, 1, 0, 7513 },
+    { 8324, 11, 1, 0, 7513 },
+    { 8335, 10, 1, 0, 7513 },
+    { 8345, 10, 1, 0, 7513 },
+    { 8355, 11, 1, 0, 7513 },
+    { 8366, 16, 1, 0, 7513 },
+    { 8382, 17, 1, 0, 7513 },
+    { 8399, 10, 1, 0, 7513 },
+    { 8409, 13, 1, 0, 7513 },
+    { 8422, 13, 1, 0, 7513 },
+    { 8435, 11, 1, 0, 7513 },
+    { 8446, 3, 1, 0, 7513 },
+    { 8449, 3, 1, 5, 7513 },
+    { 8452, 6, 1, 0, 7518 },
+    { 8458, 5, 1, 0, 7518 },
+    { 8463, 7, 1, 0, 7518 },
+    { 8470, 6, 1, 0, 7518 },
+    { 8476, 2, 1, 6, 7518 },
+    { 8478, 9, 1, 0, 7524 },
+    { 8487, 4, 1, 0, 7524 },
+    { 8491, 8, 1, 0, 7524 },
+    { 8499, 3, 1, 0, 7524 },
+    { 8502, 7, 1, 0, 7524 },
+    { 8509, 2, 1, 1, 7524 },
+    { 8511, 3, 1, 0, 7525 },
+    { 8514, 2, 0, 18, 7525 },
+    { 8516, 6, 1, 0, 7543 },
+    { 8522, 4, 1, 0, 7543 },
+    { 8526, 4, 1, 0, 7543 },
+    { 8530, 3, 1, 0, 7543 },
+    { 8533, 2, 1, 11, 7543 },
+    { 8535, 4, 1, 4, 7554 },
+    { 8539, 7, 1, 0, 7558 },
+    { 8546, 2, 1, 5, 7558 },
+    { 8548, 4, 1, 0, 7563 },
+    { 8552, 4, 1, 0, 7563 },
+    { 8556, 4, 1, 0, 7563 },
+    { 8560, 6, 1, 0, 7563 },
+    { 8566, 8, 1, 0, 7563 },
+    { 8574, 4, 1, 0, 7563 },
+    { 8578, 14, 1, 0, 7563 },
+    { 8592, 6, 1, 0, 7563 },
+    { 8598, 6, 1, 0, 7563 },
+    { 8604, 6, 1, 0, 7563 },
+    { 8610, 12, 1, 0, 7563 },
+    { 8622, 12, 1, 0, 7563 },
+    { 8634, 6, 1, 0, 7563 },
+    { 8640, 6, 1, 10, 7563 },
+    { 8646, 4, 1, 0, 7573 },
+    { 8650, 8, 1, 0, 7573 },
+    { 8658, 6, 1, 6, 7573 },
+    { 8664, 6, 1, 0, 7579 },
+    { 8670, 6, 1, 0, 7579 },
+    { 8676, 6, 1, 0, 7579 },
+    { 8682, 10, 1, 4, 7579 },
+    { 8692, 6, 1, 0, 7583 },
+    { 8698, 12, 1, 0, 7583 },
+    { 8710, 14, 1, 0, 7583 },
+    { 8724, 12, 1, 0, 7583 },
+    { 8736, 12, 1, 0, 7583 },
+    { 8748, 14, 1, 0, 7583 },
+    { 8762, 14, 1, 0, 7583 },
+    { 8776, 16, 1, 0, 7583 },
+    { 8792, 16, 1, 0, 7583 },
+    { 8808, 16, 1, 0, 7583 },
+    { 8824, 16, 1, 0, 7583 },
+    { 8840, 14, 1, 0, 7583 },
+    { 8854, 12, 1, 0, 7583 },
+    { 8866, 10, 1, 0, 7583 },
+    { 8876, 12, 1, 0, 7583 },
+    { 8888, 10, 1, 0, 7583 },
+    { 8898, 10, 1, 0, 7583 },
+    { 8908, 8, 1, 0, 7583 },
+    { 8916, 10, 1, 0, 7583 },
+    { 8926, 8, 1, 0, 7583 },
+    { 8934, 10, 1, 0, 7583 },
+    { 8944, 8, 1, 0, 7583 },
+    { 8952, 10, 1, 0, 7583 },
+    { 8962, 10, 1, 0, 7583 },
+    { 8972, 10, 1, 0, 7583 },
+    { 8982, 8, 1, 0, 7583 },
+    { 8990, 8, 1, 0, 7583 },
+    { 8998, 6, 1, 0, 7583 },
+    { 9004, 8, 1, 0, 7583 },
+    { 9012, 12, 1, 0, 7583 },
+    { 9024, 6, 1, 0, 7583 },
+    { 9030, 14, 1, 0, 7583 },
+    { 9044, 6, 1, 0, 7583 },
+    { 9050, 6, 1, 0, 7583 },
+    { 9056, 12, 1, 0, 7583 },
+    { 9068, 18, 1, 0, 7583 },
+    { 9086, 8, 1, 0, 7583 },
+    { 9094, 10, 1, 0, 7583 },
+    { 9104, 14, 1, 0, 7583 },
+    { 9118, 14, 1, 0, 7583 },
+    { 9132, 8, 1, 0, 7583 },
+    { 9140, 9, 1, 0, 7583 },
+    { 9149, 9, 1, 0, 7583 },
+    { 9158, 12, 1, 0, 7583 },
+    { 9170, 18, 1, 0, 7583 },
+    { 9188, 15, 1, 0, 7583 },
+    { 9203, 15, 1, 0, 7583 },
+    { 9218, 15, 1, 0, 7583 },
+    { 9233, 12, 1, 0, 7583 },
+    { 9245, 12, 1, 0, 7583 },
+    { 9257, 12, 1, 0, 7583 },
+    { 9269, 12, 1, 0, 7583 },
+    { 9281, 12, 1, 0, 7583 },
+    { 9293, 21, 1, 0, 7583 },
+    { 9314, 18, 1, 0, 7583 },
+    { 9332, 33, 1, 0, 7583 },
+    { 9365, 15, 1, 0, 7583 },
+    { 9380, 12, 1, 0, 7583 },
+    { 9392, 15, 1, 0, 7583 },
+    { 9407, 12, 1, 0, 7583 },
+    { 9419, 9, 1, 0, 7583 },
+    { 9428, 9, 1, 6, 7583 },
+    { 9437, 9, 1, 0, 7589 },
+    { 9446, 6, 1, 0, 7589 },
+    { 9452, 9, 1, 0, 7589 },
+    { 9461, 12, 1, 0, 7589 },
+    { 9473, 12, 1, 0, 7589 },
+    { 9485, 12, 1, 0, 7589 },
+    { 9497, 6, 1, 0, 7589 },
+    { 9503, 9, 1, 0, 7589 },
+    { 9512, 9, 1, 0, 7589 },
+    { 9521, 18, 1, 0, 7589 },
+    { 9539, 12, 1, 0, 7589 },
+    { 9551, 6, 1, 0, 7589 },
+    { 9557, 6, 1, 0, 7589 },
+    { 9563, 6, 1, 0, 7589 },
+    { 9569, 6, 1, 0, 7589 },
+    { 9575, 9, 1, 0, 7589 },
+    { 9584, 9, 1, 0, 7589 },
+    { 9593, 6, 1, 0, 7589 },
+    { 9599, 6, 1, 0, 7589 },
+    { 9605, 6, 1, 0, 7589 },
+    { 9611, 6, 1, 0, 7589 },
+    { 9617, 6, 1, 0, 7589 },
+    { 9623, 6, 1, 0, 7589 },
+    { 9629, 6, 1, 0, 7589 },
+    { 9635, 6, 1, 0, 7589 },
+    { 9641, 6, 1, 0, 7589 },
+    { 9647, 6, 1, 0, 7589 },
+    { 9653, 6, 1, 0, 7589 },
+    { 9659, 6, 1, 0, 7589 },
+    { 9665, 6, 1, 0, 7589 },
+    { 9671, 15, 1, 0, 7589 },
+    { 9686, 6, 1, 0, 7589 },
+    { 9692, 6, 1, 0, 7589 },
+    { 9698, 9, 1, 0, 7589 },
+    { 9707, 6, 1, 0, 7589 },
+    { 9713, 6, 1, 0, 7589 },
+    { 9719, 6, 1, 0, 7589 },
+    { 9725, 6, 1, 0, 7589 },
+    { 9731, 6, 1, 0, 7589 },
+    { 9737, 9, 1, 0, 7589 },
+    { 9746, 6, 1, 0, 7589 },
+    { 9752, 6, 1, 0, 7589 },
+    { 9758, 6, 1, 0, 7589 },
+    { 9764, 6, 1, 0, 7589 },
+    { 9770, 9, 1, 0, 7589 },
+    { 9779, 6, 1, 0, 7589 },
+    { 9785, 6, 1, 0, 7589 },
+    { 9791, 6, 1, 0, 7589 },
+    { 9797, 6, 1, 0, 7589 },
+    { 9803, 9, 1, 0, 7589 },
+    { 9812, 6, 1, 0, 7589 },
+    { 9818, 6, 1, 0, 7589 },
+    { 9824, 6, 1, 0, 7589 },
+    { 9830, 6, 1, 0, 7589 },
+    { 9836, 6, 1, 0, 7589 },
+    { 9842, 12, 1, 0, 7589 },
+    { 9854, 6, 1, 0, 7589 },
+    { 9860, 6, 1, 0, 7589 },
+    { 9866, 6, 1, 0, 7589 },
+    { 9872, 6, 1, 0, 7589 },
+    { 9878, 6, 1, 0, 7589 },
+    { 9884, 6, 1, 0, 7589 },
+    { 9890, 6, 1, 0, 7589 },
+    { 9896, 6, 1, 0, 7589 },
+    { 9902, 6, 1, 0, 7589 },
+    { 9908, 6, 1, 0, 7589 },
+    { 9914, 12, 1, 0, 7589 },
+    { 9926, 9, 1, 0, 7589 },
+    { 9935, 6, 1, 0, 7589 },
+    { 9941, 6, 1, 0, 7589 },
+    { 9947, 12, 1, 0, 7589 },
+    { 9959, 6, 1, 6, 7589 },
+    { 9965, 6, 1, 0, 7595 },
+    { 9971, 6, 1, 0, 7595 },
+    { 9977, 6, 1, 0, 7595 },
+    { 9983, 6, 1, 0, 7595 },
+    { 9989, 3, 1, 0, 7595 },
+    { 9992, 3, 1, 0, 7595 },
+    { 9995, 3, 1, 0, 7595 },
+    { 9998, 3, 1, 0, 7595 },
+    { 10001, 3, 1, 0, 7595 },
+    { 10004, 3, 1, 0, 7595 },
+    { 10007, 3, 1, 0, 7595 },
+    { 10010, 8, 1, 0, 7595 },
+    { 10018, 3, 1, 0, 7595 },
+    { 10021, 2, 1, 0, 7595 },
+    { 10023, 8, 1, 0, 7595 },
+    { 10031, 2, 1, 0, 7595 },
+    { 10033, 3, 1, 0, 7595 },
+    { 10036, 3, 1, 0, 7595 },
+    { 10039, 3, 1, 0, 7595 },
+    { 10042, 3, 1, 0, 7595 },
+    { 10045, 3, 1, 0, 7595 },
+    { 10048, 22, 1, 0, 7595 },
+    { 10070, 19, 1, 0, 7595 },
+    { 10089, 9, 1, 0, 7595 },
+    { 10098, 8, 1, 0, 7595 },
+    { 10106, 9, 1, 0, 7595 },
+    { 10115, 6, 1, 0, 7595 },
+    { 10121, 16, 1, 0, 7595 },
+    { 10137, 19, 1, 0, 7595 },
+    { 10156, 8, 1, 0, 7595 },
+    { 10164, 7, 1, 0, 7595 },
+    { 10171, 7, 1, 0, 7595 },
+    { 10178, 10, 1, 0, 7595 },
+    { 10188, 9, 1, 0, 7595 },
+    { 10197, 9, 1, 0, 7595 },
+    { 10206, 11, 1, 0, 7595 },
+    { 10217, 6, 1, 0, 7595 },
+    { 10223, 10, 1, 0, 7595 },
+    { 10233, 6, 1, 0, 7595 },
+    { 10239, 3, 1, 0, 7595 },
+    { 10242, 5, 1, 0, 7595 },
+    { 10247, 8, 1, 0, 7595 },
+    { 10255, 13, 1, 0, 7595 },
+    { 10268, 12, 1, 0, 7595 },
+    { 10280, 7, 1, 0, 7595 },
+    { 10287, 13, 1, 0, 7595 },
+    { 10300, 4, 1, 0, 7595 },
+    { 10304, 10, 1, 0, 7595 },
+    { 10314, 10, 1, 0, 7595 },
+    { 10324, 10, 1, 0, 7595 },
+    { 10334, 7, 1, 0, 7595 },
+    { 10341, 7, 1, 0, 7595 },
+    { 10348, 4, 1, 0, 7595 },
+    { 10352, 6, 1, 0, 7595 },
+    { 10358, 4, 1, 0, 7595 },
+    { 10362, 8, 1, 0, 7595 },
+    { 10370, 9, 1, 0, 7595 },
+    { 10379, 6, 1, 0, 7595 },
+    { 10385, 8, 1, 0, 7595 },
+    { 10393, 13, 1, 0, 7595 },
+    { 10406, 9, 1, 0, 7595 },
+    { 10415, 8, 1, 0, 7595 },
+    { 10423, 7, 1, 0, 7595 },
+    { 10430, 10, 1, 0, 7595 },
+    { 10440, 6, 1, 0, 7595 },
+    { 10446, 4, 1, 0, 7595 },
+    { 10450, 7, 1, 0, 7595 },
+    { 10457, 10, 1, 0, 7595 },
+    { 10467, 14, 1, 0, 7595 },
+    { 10481, 5, 1, 0, 7595 },
+    { 10486, 11, 1, 0, 7595 },
+    { 10497, 9, 1, 0, 7595 },
+    { 10506, 9, 1, 0, 7595 },
+    { 10515, 7, 1, 0, 7595 },
+    { 10522, 10, 1, 0, 7595 },
+    { 10532, 7, 1, 0, 7595 },
+    { 10539, 9, 1, 0, 7595 },
+    { 10548, 8, 1, 0, 7595 },
+    { 10556, 11, 1, 0, 7595 },
+    { 10567, 5, 1, 0, 7595 },
+    { 10572, 10, 1, 0, 7595 },
+    { 10582, 9, 1, 0, 7595 },
+    { 10591, 10, 1, 0, 7595 },
+    { 10601, 11, 1, 0, 7595 },
+    { 10612, 11, 1, 0, 7595 },
+    { 10623, 21, 1, 0, 7595 },
+    { 10644, 5, 1, 0, 7595 },
+    { 10649, 5, 1, 0, 7595 },
+    { 10654, 10, 1, 0, 7595 },
+    { 10664, 10, 1, 0, 7595 },
+    { 10674, 7, 1, 0, 7595 },
+    { 10681, 3, 1, 0, 7595 },
+    { 10684, 8, 1, 0, 7595 },
+    { 10692, 10, 1, 0, 7595 },
+    { 10702, 6, 1, 0, 7595 },
+    { 10708, 9, 1, 0, 7595 },
+    { 10717, 8, 1, 0, 7595 },
+    { 10725, 4, 1, 0, 7595 },
+    { 10729, 9, 1, 0, 7595 },
+    { 10738, 8, 1, 0, 7595 },
+    { 10746, 7, 1, 0, 7595 },
+    { 10753, 6, 1, 0, 7595 },
+    { 10759, 7, 1, 0, 7595 },
+    { 10766, 7, 1, 0, 7595 },
+    { 10773, 5, 1, 0, 7595 },
+    { 10778, 12, 1, 0, 7595 },
+    { 10790, 5, 1, 0, 7595 },
+    { 10795, 3, 1, 0, 7595 },
+    { 10798, 3, 1, 0, 7595 },
+    { 10801, 3, 1, 0, 7595 },
+    { 10804, 3, 1, 0, 7595 },
+    { 10807, 3, 1, 0, 7595 },
+    { 10810, 2, 1, 0, 7595 },
+    { 10812, 3, 1, 0, 7595 },
+    { 10815, 3, 1, 0, 7595 },
+    { 10818, 3, 1, 0, 7595 },
+    { 10821, 3, 1, 0, 7595 },
+    { 10824, 3, 1, 0, 7595 },
+    { 10827, 3, 1, 0, 7595 },
+    { 10830, 3, 1, 0, 7595 },
+    { 10833, 3, 1, 0, 7595 },
+    { 10836, 3, 1, 0, 7595 },
+    { 10839, 8, 1, 0, 7595 },
+    { 10847, 3, 1, 0, 7595 },
+    { 10850, 3, 1, 0, 7595 },
+    { 10853, 3, 1, 0, 7595 },
+    { 10856, 3, 1, 0, 7595 },
+    { 10859, 3, 1, 0, 7595 },
+    { 10862, 3, 1, 0, 7595 },
+    { 10865, 8, 1, 0, 7595 },
+    { 10873, 2, 1, 0, 7595 },
+    { 10875, 3, 1, 0, 7595 },
+    { 10878, 7, 1, 0, 7595 },
+    { 10885, 4, 1, 0, 7595 },
+    { 10889, 3, 1, 0, 7595 },
+    { 10892, 4, 1, 0, 7595 },
+    { 10896, 3, 1, 0, 7595 },
+    { 10899, 5, 1, 0, 7595 },
+    { 10904, 2, 1, 0, 7595 },
+    { 10906, 2, 1, 0, 7595 },
+    { 10908, 2, 1, 0, 7595 },
+    { 10910, 2, 1, 0, 7595 },
+    { 10912, 2, 1, 0, 7595 },
+    { 10914, 2, 1, 0, 7595 },
+    { 10916, 5, 4, 0, 7595 },
+    { 10921, 10, 1, 0, 7595 },
+    { 10931, 5, 1, 0, 7595 },
+    { 10936, 10, 1, 0, 7595 },
+    { 10946, 4, 1, 0, 7595 },
+    { 10950, 9, 4, 0, 7595 },
+    { 10959, 9, 1, 0, 7595 },
+    { 10968, 11, 1, 0, 7595 },
+    { 10979, 4, 1, 0, 7595 },
+    { 10983, 7, 1, 0, 7595 },
+    { 10990, 6, 1, 0, 7595 },
+    { 10996, 6, 1, 0, 7595 },
+    { 11002, 9, 1, 0, 7595 },
+    { 11011, 8, 1, 0, 7595 },
+    { 11019, 7, 1, 0, 7595 },
+    { 11026, 4, 1, 0, 7595 },
+    { 11030, 10, 4, 0, 7595 },
+    { 11040, 14, 1, 0, 7595 },
+    { 11054, 12, 1, 0, 7595 },
+    { 11066, 9, 1, 0, 7595 },
+    { 11075, 3, 1, 1, 7595 },
+    { 11078, 9, 1, 1, 7596 },
+    { 11087, 9, 1, 0, 7597 },
+    { 11096, 7, 1, 0, 7597 },
+    { 11103, 9, 1, 0, 7597 },
+    { 11112, 6, 1, 0, 7597 },
+    { 11118, 3, 1, 0, 7597 },
+    { 11121, 5, 1, 0, 7597 },
+    { 11126, 3, 1, 0, 7597 },
+    { 11129, 3, 1, 1, 7597 },
+    { 11132, 4, 1, 0, 7598 },
+    { 11136, 3, 1, 0, 7598 },
+    { 11139, 3, 1, 0, 7598 },
+    { 11142, 3, 1, 0, 7598 },
+    { 11145, 3, 1, 0, 7598 },
+    { 11148, 3, 1, 0, 7598 },
+    { 11151, 6, 1, 0, 7598 },
+    { 11157, 6, 1, 0, 7598 },
+    { 11163, 3, 1, 0, 7598 },
+    { 11166, 3, 1, 0, 7598 },
+    { 11169, 6, 1, 0, 7598 },
+    { 11175, 3, 1, 0, 7598 },
+    { 11178, 4, 1, 0, 7598 },
+    { 11182, 7, 1, 0, 7598 },
+    { 11189, 3, 1, 0, 7598 },
+    { 11192, 4, 1, 0, 7598 },
+    { 11196, 3, 1, 0, 7598 },
+    { 11199, 3, 1, 0, 7598 },
+    { 11202, 3, 1, 0, 7598 },
+    { 11205, 7, 1, 0, 7598 },
+    { 11212, 11, 1, 0, 7598 },
+    { 11223, 4, 1, 0, 7598 },
+    { 11227, 3, 1, 0, 7598 },
+    { 11230, 5, 1, 0, 7598 },
+    { 11235, 2, 1, 1, 7598 },
+    { 11237, 3, 1, 0, 7599 },
+    { 11240, 2, 1, 1, 7599 },
+    { 11242, 9, 0, 1, 7600 },
+    { 11251, 9, 4, 2, 7601 },
+    { 11260, 13, 1, 0, 7603 },
+    { 11273, 13, 1, 0, 7603 },
+    { 11286, 2, 1, 0, 7603 },
+    { 11288, 4, 1, 0, 7603 },
+    { 11292, 9, 1, 0, 7603 },
+    { 11301, 12, 1, 0, 7603 },
+    { 11313, 2, 1, 0, 7603 },
+    { 11315, 8, 0, 2, 7603 },
+    { 11323, 4, 1, 0, 7605 },
+    { 11327, 3, 1, 0, 7605 },
+    { 11330, 3, 1, 0, 7605 },
+    { 11333, 3, 1, 3, 7605 },
+    { 11336, 4, 1, 0, 7608 },
+    { 11340, 3, 1, 9, 7608 },
+    { 11343, 3, 1, 5, 7617 },
+    { 11346, 2, 1, 0, 7622 },
+    { 11348, 4, 1, 0, 7622 },
+    { 11352, 3, 1, 0, 7622 },
+    { 11355, 3, 1, 0, 7622 },
+    { 11358, 2, 1, 0, 7622 },
+    { 11360, 3, 1, 0, 7622 },
+    { 11363, 2, 1, 0, 7622 },
+    { 11365, 3, 1, 0, 7622 },
+    { 11368, 2, 1, 0, 7622 },
+    { 11370, 3, 1, 0, 7622 },
+    { 11373, 3, 1, 0, 7622 },
+    { 11376, 2, 1, 0, 7622 },
+    { 11378, 3, 1, 0, 7622 },
+    { 11381, 2, 1, 0, 7622 },
+    { 11383, 3, 1, 0, 7622 },
+    { 11386, 2, 1, 0, 7622 },
+    { 11388, 2, 1, 0, 7622 },
+    { 11390, 2, 1, 0, 7622 },
+    { 11392, 2, 1, 0, 7622 },
+    { 11394, 2, 1, 0, 7622 },
+    { 11396, 2, 1, 0, 7622 },
+    { 11398, 3, 1, 0, 7622 },
+    { 11401, 3, 1, 0, 7622 },
+    { 11404, 3, 1, 0, 7622 },
+    { 11407, 3, 1, 0, 7622 },
+    { 11410, 4, 1, 0, 7622 },
+    { 11414, 3, 1, 0, 7622 },
+    { 11417, 3, 1, 0, 7622 },
+    { 11420, 4, 1, 0, 7622 },
+    { 11424, 3, 1, 0, 7622 },
+    { 11427, 3, 1, 0, 7622 },
+    { 11430, 2, 1, 0, 7622 },
+    { 11432, 3, 1, 0, 7622 },
+    { 11435, 8, 1, 0, 7622 },
+    { 11443, 3, 1, 0, 7622 },
+    { 11446, 3, 1, 0, 7622 },
+    { 11449, 3, 1, 0, 7622 },
+    { 11452, 3, 1, 0, 7622 },
+    { 11455, 3, 1, 0, 7622 },
+    { 11458, 3, 1, 0, 7622 },
+    { 11461, 2, 1, 0, 7622 },
+    { 11463, 3, 1, 0, 7622 },
+    { 11466, 2, 1, 0, 7622 },
+    { 11468, 3, 1, 0, 7622 },
+    { 11471, 2, 1, 0, 7622 },
+    { 11473, 3, 1, 0, 7622 },
+    { 11476, 3, 1, 0, 7622 },
+    { 11479, 3, 1, 0, 7622 },
+    { 11482, 4, 1, 0, 7622 },
+    { 11486, 3, 1, 0, 7622 },
+    { 11489, 3, 1, 0, 7622 },
+    { 11492, 5, 1, 0, 7622 },
+    { 11497, 2, 1, 0, 7622 },
+    { 11499, 10, 1, 0, 7622 },
+    { 11509, 2, 1, 0, 7622 },
+    { 11511, 8, 1, 0, 7622 },
+    { 11519, 18, 0, 1, 7622 },
+    { 11537, 8, 0, 1, 7623 },
+    { 11545, 12, 1, 0, 7624 },
+    { 11557, 8, 4, 0, 7624 },
+    { 11565, 10, 1, 0, 7624 },
+    { 11575, 3, 1, 0, 7624 },
+    { 11578, 1, 1, 0, 7624 },
+    { 11579, 1, 1, 0, 7624 },
+    { 11580, 1, 1, 0, 7624 },
+    { 11581, 1, 1, 0, 7624 },
+    { 11582, 1, 1, 0, 7624 },
+    { 11583, 1, 1, 0, 7624 },
+    { 11584, 1, 1, 0, 7624 },
+    { 11585, 1, 1, 0, 7624 },
+    { 11586, 1, 1, 0, 7624 },
+    { 11587, 1, 1, 0, 7624 },
+    { 11588, 1, 1, 0, 7624 },
+    { 11589, 1, 1, 0, 7624 },
+    { 11590, 5, 1, 0, 7624 },
+    { 11595, 8, 1, 0, 7624 },
+    { 11603, 1, 1, 0, 7624 },
+    { 11604, 1, 1, 0, 7624 },
+    { 11605, 1, 1, 0, 7624 },
+    { 11606, 1, 1, 0, 7624 },
+    { 11607, 1, 1, 0, 7624 },
+    { 11608, 1, 1, 0, 7624 },
+    { 11609, 1, 1, 0, 7624 },
+    { 11610, 1, 1, 0, 7624 },
+    { 11611, 1, 1, 0, 7624 },
+    { 11612, 1, 1, 0, 7624 },
+    { 11613, 1, 1, 0, 7624 },
+    { 11614, 1, 1, 0, 7624 },
+    { 11615, 1, 1, 0, 7624 },
+    { 11616, 1, 1, 0, 7624 },
+    { 11617, 1, 1, 0, 7624 },
+    { 11618, 1, 1, 0, 7624 },
+    { 11619, 1, 1, 0, 7624 },
+    { 11620, 1, 1, 0, 7624 },
+    { 11621, 1, 1, 0, 7624 },
+    { 11622, 1, 1, 0, 7624 },
+    { 11623, 1, 1, 0, 7624 },
+    { 11624, 1, 1, 0, 7624 },
+    { 11625, 1, 1, 0, 7624 },
+    { 11626, 1, 1, 0, 7624 },
+    { 11627, 3, 1, 0, 7624 },
+    { 11630, 3, 1, 0, 7624 },
+    { 11633, 3, 1, 0, 7624 },
+    { 11636, 3, 1, 0, 7624 },
+    { 11639, 3, 1, 0, 7624 },
+    { 11642, 2, 1, 0, 7624 },
+    { 11644, 3, 1, 0, 7624 },
+    { 11647, 3, 1, 0, 7624 },
+    { 11650, 2, 1, 0, 7624 },
+    { 11652, 3, 1, 0, 7624 },
+    { 11655, 11, 1, 0, 7624 },
+    { 11666, 7, 1, 0, 7624 },
+    { 11673, 7, 1, 0, 7624 },
+    { 11680, 6, 1, 0, 7624 },
+    { 11686, 10, 1, 0, 7624 },
+    { 11696, 8, 1, 0, 7624 },
+    { 11704, 8, 1, 0, 7624 },
+    { 11712, 7, 1, 0, 7624 },
+    { 11719, 4, 1, 0, 7624 },
+    { 11723, 6, 1, 0, 7624 },
+    { 11729, 5, 1, 0, 7624 },
+    { 11734, 5, 1, 0, 7624 },
+    { 11739, 3, 1, 0, 7624 },
+    { 11742, 6, 1, 0, 7624 },
+    { 11748, 6, 1, 0, 7624 },
+    { 11754, 6, 1, 0, 7624 },
+    { 11760, 4, 1, 0, 7624 },
+    { 11764, 11, 1, 0, 7624 },
+    { 11775, 5, 1, 0, 7624 },
+    { 11780, 7, 1, 0, 7624 },
+    { 11787, 8, 1, 0, 7624 },
+    { 11795, 2, 1, 0, 7624 },
+    { 11797, 3, 1, 0, 7624 },
+    { 11800, 3, 1, 0, 7624 },
+    { 11803, 5, 1, 0, 7624 },
+    { 11808, 3, 1, 0, 7624 },
+    { 11811, 4, 1, 0, 7624 },
+    { 11815, 7, 1, 0, 7624 },
+    { 11822, 5, 1, 0, 7624 },
+    { 11827, 3, 1, 0, 7624 },
+    { 11830, 3, 1, 0, 7624 },
+    { 11833, 3, 1, 0, 7624 },
+    { 11836, 10, 1, 0, 7624 },
+    { 11846, 5, 1, 0, 7624 },
+    { 11851, 7, 1, 0, 7624 },
+    { 11858, 4, 1, 0, 7624 },
+    { 11862, 3, 1, 0, 7624 },
+    { 11865, 3, 1, 0, 7624 },
+    { 11868, 3, 1, 0, 7624 },
+    { 11871, 3, 1, 0, 7624 },
+    { 11874, 3, 1, 0, 7624 },
+    { 11877, 2, 1, 0, 7624 },
+    { 11879, 3, 1, 0, 7624 },
+    { 11882, 3, 1, 0, 7624 },
+    { 11885, 3, 1, 0, 7624 },
+    { 11888, 3, 1, 0, 7624 },
+    { 11891, 3, 1, 0, 7624 },
+    { 11894, 8, 1, 0, 7624 },
+    { 11902, 4, 1, 0, 7624 },
+    { 11906, 4, 1, 0, 7624 },
+    { 11910, 4, 1, 0, 7624 },
+    { 11914, 7, 1, 0, 7624 },
+    { 11921, 7, 1, 0, 7624 },
+    { 11928, 3, 1, 0, 7624 },
+    { 11931, 11, 1, 0, 7624 },
+    { 11942, 10, 1, 0, 7624 },
+    { 11952, 7, 1, 0, 7624 },
+    { 11959, 8, 1, 0, 7624 },
+    { 11967, 8, 1, 0, 7624 },
+    { 11975, 3, 1, 0, 7624 },
+    { 11978, 7, 1, 0, 7624 },
+    { 11985, 3, 1, 0, 7624 },
+    { 11988, 8, 1, 0, 7624 },
+    { 11996, 9, 1, 0, 7624 },
+    { 12005, 4, 1, 0, 7624 },
+    { 12009, 3, 1, 0, 7624 },
+    { 12012, 8, 1, 0, 7624 },
+    { 12020, 3, 1, 0, 7624 },
+    { 12023, 10, 1, 0, 7624 },
+    { 12033, 6, 1, 0, 7624 },
+    { 12039, 7, 1, 0, 7624 },
+    { 12046, 3, 1, 0, 7624 },
+    { 12049, 6, 1, 0, 7624 },
+    { 12055, 8, 1, 0, 7624 },
+    { 12063, 3, 1, 0, 7624 },
+    { 12066, 6, 1, 0, 7624 },
+    { 12072, 13, 1, 0, 7624 },
+    { 12085, 8, 1, 0, 7624 },
+    { 12093, 11, 1, 0, 7624 },
+    { 12104, 6, 1, 0, 7624 },
+    { 12110, 7, 1, 0, 7624 },
+    { 12117, 5, 1, 0, 7624 },
+    { 12122, 10, 1, 0, 7624 },
+    { 12132, 5, 1, 0, 7624 },
+    { 12137, 10, 1, 0, 7624 },
+    { 12147, 2, 1, 0, 7624 },
+    { 12149, 3, 1, 0, 7624 },
+    { 12152, 4, 1, 0, 7624 },
+    { 12156, 6, 1, 0, 7624 },
+    { 12162, 3, 1, 0, 7624 },
+    { 12165, 3, 1, 0, 7624 },
+    { 12168, 3, 1, 0, 7624 },
+    { 12171, 3, 1, 0, 7624 },
+    { 12174, 3, 1, 0, 7624 },
+    { 12177, 2, 1, 0, 7624 },
+    { 12179, 5, 1, 0, 7624 },
+    { 12184, 9, 1, 0, 7624 },
+    { 12193, 3, 1, 0, 7624 },
+    { 12196, 3, 1, 0, 7624 },
+    { 12199, 3, 1, 0, 7624 },
+    { 12202, 3, 1, 0, 7624 },
+    { 12205, 1, 1, 0, 7624 },
+    { 12206, 7, 1, 0, 7624 },
+    { 12213, 5, 1, 0, 7624 },
+    { 12218, 3, 1, 0, 7624 },
+    { 12221, 3, 1, 0, 7624 },
+    { 12224, 3, 1, 0, 7624 },
+    { 12227, 4, 1, 0, 7624 },
+    { 12231, 3, 1, 0, 7624 },
+    { 12234, 8, 1, 0, 7624 },
+    { 12242, 3, 1, 0, 7624 },
+    { 12245, 13, 1, 0, 7624 },
+    { 12258, 8, 1, 0, 7624 },
+    { 12266, 6, 1, 0, 7624 },
+    { 12272, 3, 1, 0, 7624 },
+    { 12275, 3, 1, 0, 7624 },
+    { 12278, 3, 1, 0, 7624 },
+    { 12281, 3, 1, 3, 7624 },
+    { 12284, 8, 1, 0, 7627 },
+    { 12292, 4, 1, 0, 7627 },
+    { 12296, 3, 1, 0, 7627 },
+    { 12299, 3, 1, 0, 7627 },
+    { 12302, 6, 1, 0, 7627 },
+    { 12308, 8, 1, 0, 7627 },
+    { 12316, 3, 1, 0, 7627 },
+    { 12319, 3, 1, 0, 7627 },
+    { 12322, 3, 1, 0, 7627 },
+    { 12325, 3, 1, 0, 7627 },
+    { 12328, 3, 1, 0, 7627 },
+    { 12331, 3, 1, 0, 7627 },
+    { 12334, 3, 1, 0, 7627 },
+    { 12337, 3, 1, 0, 7627 },
+    { 12340, 3, 1, 0, 7627 },
+    { 12343, 3, 1, 0, 7627 },
+    { 12346, 3, 1, 0, 7627 },
+    { 12349, 3, 1, 0, 7627 },
+    { 12352, 3, 1, 0, 7627 },
+    { 12355, 3, 1, 0, 7627 },
+    { 12358, 5, 1, 0, 7627 },
+    { 12363, 4, 1, 0, 7627 },
+    { 12367, 7, 1, 0, 7627 },
+    { 12374, 2, 1, 0, 7627 },
+    { 12376, 3, 1, 0, 7627 },
+    { 12379, 6, 1, 0, 7627 },
+    { 12385, 3, 1, 0, 7627 },
+    { 12388, 3, 1, 0, 7627 },
+    { 12391, 3, 1, 0, 7627 },
+    { 12394, 3, 1, 0, 7627 },
+    { 12397, 3, 1, 0, 7627 },
+    { 12400, 3, 1, 0, 7627 },
+    { 12403, 7, 1, 0, 7627 },
+    { 12410, 3, 1, 27, 7627 },
+    { 12413, 3, 1, 0, 7654 },
+    { 12416, 3, 1, 0, 7654 },
+    { 12419, 3, 1, 0, 7654 },
+    { 12422, 3, 1, 0, 7654 },
+    { 12425, 3, 1, 0, 7654 },
+    { 12428, 5, 1, 0, 7654 },
+    { 12433, 3, 1, 0, 7654 },
+    { 12436, 9, 1, 0, 7654 },
+    { 12445, 3, 1, 0, 7654 },
+    { 12448, 3, 1, 0, 7654 },
+    { 12451, 3, 1, 27, 7654 },
+    { 12454, 3, 1, 0, 7681 },
+    { 12457, 3, 1, 0, 7681 },
+    { 12460, 8, 1, 0, 7681 },
+    { 12468, 6, 1, 0, 7681 },
+    { 12474, 6, 1, 0, 7681 },
+    { 12480, 6, 1, 0, 7681 },
+    { 12486, 7, 1, 0, 7681 },
+    { 12493, 3, 1, 0, 7681 },
+    { 12496, 3, 1, 0, 7681 },
+    { 12499, 3, 1, 0, 7681 },
+    { 12502, 6, 1, 0, 7681 },
+    { 12508, 2, 1, 0, 7681 },
+    { 12510, 3, 1, 0, 7681 },
+    { 12513, 5, 1, 0, 7681 },
+    { 12518, 3, 1, 0, 7681 },
+    { 12521, 7, 1, 0, 7681 },
+    { 12528, 3, 4, 0, 7681 },
+    { 12531, 3, 1, 0, 7681 },
+    { 12534, 3, 1, 0, 7681 },
+    { 12537, 3, 1, 0, 7681 },
+    { 12540, 3, 1, 0, 7681 },
+    { 12543, 3, 1, 0, 7681 },
+    { 12546, 6, 1, 0, 7681 },
+    { 12552, 6, 1, 0, 7681 },
+    { 12558, 3, 1, 0, 7681 },
+    { 12561, 3, 1, 0, 7681 },
+    { 12564, 3, 1, 0, 7681 },
+    { 12567, 3, 1, 0, 7681 },
+    { 12570, 3, 1, 0, 7681 },
+    { 12573, 3, 1, 0, 7681 },
+    { 12576, 3, 1, 0, 7681 },
+    { 12579, 5, 1, 0, 7681 },
+    { 12584, 3, 1, 0, 7681 },
+    { 12587, 6, 1, 0, 7681 },
+    { 12593, 3, 1, 0, 7681 },
+    { 12596, 8, 1, 0, 7681 },
+    { 12604, 3, 1, 0, 7681 },
+    { 12607, 9, 1, 0, 7681 },
+    { 12616, 8, 1, 0, 7681 },
+    { 12624, 8, 1, 0, 7681 },
+    { 12632, 5, 1, 0, 7681 },
+    { 12637, 10, 1, 0, 7681 },
+    { 12647, 10, 1, 0, 7681 },
+    { 12657, 11, 1, 0, 7681 },
+    { 12668, 8, 1, 0, 7681 },
+    { 12676, 3, 1, 0, 7681 },
+    { 12679, 3, 1, 0, 7681 },
+    { 12682, 3, 1, 0, 7681 },
+    { 12685, 3, 1, 0, 7681 },
+    { 12688, 8, 1, 0, 7681 },
+    { 12696, 3, 1, 0, 7681 },
+    { 12699, 4, 1, 0, 7681 },
+    { 12703, 2, 1, 0, 7681 },
+    { 12705, 3, 1, 0, 7681 },
+    { 12708, 3, 1, 0, 7681 },
+    { 12711, 3, 1, 0, 7681 },
+    { 12714, 3, 1, 0, 7681 },
+    { 12717, 3, 1, 0, 7681 },
+    { 12720, 3, 1, 0, 7681 },
+    { 12723, 2, 1, 0, 7681 },
+    { 12725, 3, 1, 0, 7681 },
+    { 12728, 3, 1, 0, 7681 },
+    { 12731, 3, 1, 0, 7681 },
+    { 12734, 4, 1, 0, 7681 },
+    { 12738, 4, 1, 0, 7681 },
+    { 12742, 3, 1, 0, 7681 },
+    { 12745, 3, 1, 0, 7681 },
+    { 12748, 3, 1, 0, 7681 },
+    { 12751, 3, 1, 0, 7681 },
+    { 12754, 3, 1, 0, 7681 },
+    { 12757, 3, 1, 0, 7681 },
+    { 12760, 2, 1, 0, 7681 },
+    { 12762, 3, 1, 0, 7681 },
+    { 12765, 3, 1, 0, 7681 },
+    { 12768, 3, 1, 0, 7681 },
+    { 12771, 3, 1, 0, 7681 },
+    { 12774, 3, 1, 0, 7681 },
+    { 12777, 9, 1, 0, 7681 },
+    { 12786, 2, 1, 0, 7681 },
+    { 12788, 2, 1, 0, 7681 },
+    { 12790, 3, 1, 0, 7681 },
+    { 12793, 3, 1, 1, 7681 },
+    { 12796, 3, 1, 0, 7682 },
+    { 12799, 9, 1, 0, 7682 },
+    { 12808, 3, 1, 0, 7682 },
+    { 12811, 7, 1, 0, 7682 },
+    { 12818, 2, 1, 0, 7682 },
+    { 12820, 3, 1, 0, 7682 },
+    { 12823, 3, 1, 0, 7682 },
+    { 12826, 3, 1, 0, 7682 },
+    { 12829, 3, 1, 0, 7682 },
+    { 12832, 3, 1, 0, 7682 },
+    { 12835, 3, 1, 0, 7682 },
+    { 12838, 2, 1, 0, 7682 },
+    { 12840, 2, 1, 0, 7682 },
+    { 12842, 5, 4, 0, 7682 },
+    { 12847, 5, 1, 0, 7682 },
+    { 12852, 2, 1, 0, 7682 },
+    { 12854, 8, 1, 0, 7682 },
+    { 12862, 2, 1, 0, 7682 },
+    { 12864, 2, 1, 0, 7682 },
+    { 12866, 2, 1, 0, 7682 },
+    { 12868, 12, 1, 0, 7682 },
+    { 12880, 2, 1, 0, 7682 },
+    { 12882, 2, 1, 0, 7682 },
+    { 12884, 2, 1, 0, 7682 },
+    { 12886, 5, 1, 0, 7682 },
+    { 12891, 2, 1, 0, 7682 },
+    { 12893, 2, 1, 0, 7682 },
+    { 12895, 2, 1, 0, 7682 },
+    { 12897, 2, 1, 0, 7682 },
+    { 12899, 2, 1, 0, 7682 },
+    { 12901, 2, 1, 0, 7682 },
+    { 12903, 2, 1, 0, 7682 },
+    { 12905, 2, 1, 0, 7682 },
+    { 12907, 4, 0, 1, 7682 },
+    { 12911, 7, 1, 0, 7683 },
+    { 12918, 3, 1, 0, 7683 },
+    { 12921, 13, 1, 0, 7683 },
+    { 12934, 9, 1, 0, 7683 },
+    { 12943, 11, 1, 0, 7683 },
+    { 12954, 8, 1, 0, 7683 },
+    { 12962, 9, 1, 0, 7683 },
+    { 12971, 5, 0, 1, 7683 },
+    { 12976, 6, 1, 0, 7684 },
+    { 12982, 3, 1, 0, 7684 },
+    { 12985, 8, 1, 0, 7684 },
+    { 12993, 10, 1, 0, 7684 },
+    { 13003, 4, 1, 0, 7684 },
+    { 13007, 3, 1, 0, 7684 },
+    { 13010, 5, 1, 0, 7684 },
+    { 13015, 8, 1, 0, 7684 },
+    { 13023, 7, 1, 0, 7684 },
+    { 13030, 7, 4, 1, 7684 },
+    { 13037, 4, 0, 2, 7685 },
+    { 13041, 6, 1, 0, 7687 },
+    { 13047, 9, 1, 0, 7687 },
+    { 13056, 14, 1, 0, 7687 },
+    { 13070, 12, 1, 0, 7687 },
+    { 13082, 7, 1, 0, 7687 },
+    { 13089, 2, 1, 0, 7687 },
+    { 13091, 4, 1, 0, 7687 },
+    { 13095, 9, 1, 0, 7687 },
+    { 13104, 2, 1, 0, 7687 },
+    { 13106, 3, 1, 0, 7687 },
+    { 13109, 2, 1, 0, 7687 },
+    { 13111, 3, 1, 0, 7687 },
+    { 13114, 3, 1, 0, 7687 },
+    { 13117, 2, 1, 0, 7687 },
+    { 13119, 4, 1, 0, 7687 },
+    { 13123, 3, 1, 0, 7687 },
+    { 13126, 2, 1, 0, 7687 },
+    { 13128, 3, 1, 0, 7687 },
+    { 13131, 2, 1, 0, 7687 },
+    { 13133, 2, 1, 0, 7687 },
+    { 13135, 3, 1, 0, 7687 },
+    { 13138, 6, 1, 0, 7687 },
+    { 13144, 15, 1, 0, 7687 },
+    { 13159, 3, 2, 0, 7687 },
+    { 13162, 8, 1, 0, 7687 },
+    { 13170, 2, 1, 0, 7687 },
+    { 13172, 3, 1, 0, 7687 },
+    { 13175, 3, 1, 0, 7687 },
+    { 13178, 3, 1, 0, 7687 },
+    { 13181, 7, 0, 1, 7687 },
+    { 13188, 6, 4, 0, 7688 },
+    { 13194, 6, 1, 0, 7688 },
+    { 13200, 9, 1, 0, 7688 },
+    { 13209, 7, 0, 1, 7688 },
+    { 13216, 8, 0, 1, 7689 },
+    { 13224, 4, 1, 0, 7690 },
+    { 13228, 10, 0, 2, 7690 },
+    { 13238, 8, 1, 0, 7692 },
+    { 13246, 7, 1, 1, 7692 },
+    { 13253, 8, 1, 0, 7693 },
+    { 13261, 8, 1, 0, 7693 },
+    { 13269, 11, 4, 0, 7693 },
+    { 13280, 10, 4, 0, 7693 },
+    { 13290, 3, 1, 2, 7693 },
+    { 13293, 9, 1, 0, 7695 },
+    { 13302, 8, 1, 1, 7695 },
+    { 13310, 7, 1, 0, 7696 },
+    { 13317, 7, 0, 3, 7696 },
+    { 13324, 3, 0, 8, 7699 },
+    { 13327, 10, 4, 0, 7707 },
+    { 13337, 7, 4, 0, 7707 },
+    { 13344, 11, 1, 0, 7707 },
+    { 13355, 12, 0, 2, 7707 },
+    { 13367, 5, 1, 0, 7709 },
+    { 13372, 5, 1, 0, 7709 },
+    { 13377, 9, 1, 0, 7709 },
+    { 13386, 5, 1, 0, 7709 },
+    { 13391, 7, 1, 0, 7709 },
+    { 13398, 4, 1, 0, 7709 },
+    { 13402, 2, 1, 0, 7709 },
+    { 13404, 3, 1, 0, 7709 },
+    { 13407, 3, 1, 0, 7709 },
+    { 13410, 3, 1, 0, 7709 },
+    { 13413, 2, 1, 0, 7709 },
+    { 13415, 2, 1, 0, 7709 },
+    { 13417, 2, 1, 0, 7709 },
+    { 13419, 10, 1, 0, 7709 },
+    { 13429, 3, 1, 1, 7709 },
+    { 13432, 2, 1, 0, 7710 },
+    { 13434, 3, 1, 0, 7710 },
+    { 13437, 2, 1, 0, 7710 },
+    { 13439, 2, 1, 0, 7710 },
+    { 13441, 3, 1, 0, 7710 },
+    { 13444, 2, 1, 0, 7710 },
+    { 13446, 2, 1, 0, 7710 },
+    { 13448, 2, 1, 0, 7710 },
+    { 13450, 2, 1, 0, 7710 },
+    { 13452, 2, 1, 0, 7710 },
+    { 13454, 2, 1, 0, 7710 },
+    { 13456, 2, 1, 0, 7710 },
+    { 13458, 2, 1, 0, 7710 },
+    { 13460, 2, 1, 0, 7710 },
+    { 13462, 2, 1, 0, 7710 },
+    { 13464, 12, 1, 0, 7710 },
+    { 13476, 2, 1, 0, 7710 },
+    { 13478, 2, 1, 0, 7710 },
+    { 13480, 2, 1, 0, 7710 },
+    { 13482, 2, 1, 0, 7710 },
+    { 13484, 3, 1, 0, 7710 },
+    { 13487, 2, 1, 0, 7710 },
+    { 13489, 3, 1, 0, 7710 },
+    { 13492, 2, 1, 0, 7710 },
+    { 13494, 2, 1, 0, 7710 },
+    { 13496, 3, 1, 0, 7710 },
+    { 13499, 2, 1, 0, 7710 },
+    { 13501, 12, 0, 1, 7710 },
+    { 13513, 2, 1, 0, 7711 },
+    { 13515, 2, 1, 0, 7711 },
+    { 13517, 2, 1, 0, 7711 },
+    { 13519, 2, 1, 0, 7711 },
+    { 13521, 2, 1, 0, 7711 },
+    { 13523, 2, 1, 0, 7711 },
+    { 13525, 2, 1, 0, 7711 },
+    { 13527, 2, 1, 0, 7711 },
+    { 13529, 10, 1, 0, 7711 },
+    { 13539, 10, 1, 0, 7711 },
+    { 13549, 10, 1, 0, 7711 },
+    { 13559, 2, 1, 0, 7711 },
+    { 13561, 2, 1, 0, 7711 },
+    { 13563, 2, 1, 0, 7711 },
+    { 13565, 6, 1, 0, 7711 },
+    { 13571, 6, 1, 0, 7711 },
+    { 13577, 6, 1, 0, 7711 },
+    { 13583, 4, 1, 0, 7711 },
+    { 13587, 5, 1, 0, 7711 },
+    { 13592, 3, 1, 1, 7711 },
+    { 13595, 3, 1, 0, 7712 },
+    { 13598, 3, 1, 0, 7712 },
+    { 13601, 16, 1, 1, 7712 },
+    { 13617, 4, 1, 0, 7713 },
+    { 13621, 3, 1, 0, 7713 },
+    { 13624, 4, 1, 0, 7713 },
+    { 13628, 3, 1, 0, 7713 },
+    { 13631, 9, 1, 0, 7713 },
+    { 13640, 6, 1, 0, 7713 },
+    { 13646, 3, 1, 0, 7713 },
+    { 13649, 4, 1, 0, 7713 },
+    { 13653, 3, 1, 0, 7713 },
+    { 13656, 3, 1, 0, 7713 },
+    { 13659, 3, 1, 0, 7713 },
+    { 13662, 3, 1, 0, 7713 },
+    { 13665, 4, 4, 0, 7713 },
+    { 13669, 3, 1, 0, 7713 },
+    { 13672, 4, 1, 1, 7713 },
+    { 13676, 8, 1, 0, 7714 },
+    { 13684, 3, 1, 0, 7714 },
+    { 13687, 3, 4, 0, 7714 },
+    { 13690, 6, 1, 0, 7714 },
+    { 13696, 4, 4, 0, 7714 },
+    { 13700, 5, 1, 0, 7714 },
+    { 13705, 10, 1, 0, 7714 },
+    { 13715, 2, 1, 0, 7714 },
+    { 13717, 13, 1, 1, 7714 },
+    { 13730, 6, 1, 0, 7715 },
+    { 13736, 10, 1, 0, 7715 },
+    { 13746, 13, 1, 0, 7715 },
+    { 13759, 10, 1, 0, 7715 },
+    { 13769, 17, 1, 0, 7715 },
+    { 13786, 9, 0, 50, 7715 },
+    { 13795, 10, 1, 0, 7765 },
+    { 13805, 8, 1, 0, 7765 },
+    { 13813, 8, 1, 0, 7765 },
+    { 13821, 14, 1, 0, 7765 },
+    { 13835, 19, 1, 0, 7765 },
+    { 13854, 7, 1, 1, 7765 },
+    { 13861, 2, 1, 0, 7766 },
+    { 13863, 16, 1, 0, 7766 },
+    { 13879, 12, 1, 0, 7766 },
+    { 13891, 20, 1, 0, 7766 },
+    { 13911, 7, 1, 0, 7766 },
+    { 13918, 14, 1, 0, 7766 },
+    { 13932, 11, 1, 0, 7766 },
+    { 13943, 11, 1, 0, 7766 },
+    { 13954, 10, 1, 0, 7766 },
+    { 13964, 7, 1, 0, 7766 },
+    { 13971, 8, 1, 0, 7766 },
+    { 13979, 8, 1, 0, 7766 },
+    { 13987, 7, 1, 0, 7766 },
+    { 13994, 11, 1, 2, 7766 },
+    { 14005, 6, 1, 0, 7768 },
+    { 14011, 7, 1, 0, 7768 },
+    { 14018, 2, 1, 0, 7768 },
+    { 14020, 13, 1, 0, 7768 },
+    { 14033, 5, 1, 0, 7768 },
+    { 14038, 10, 1, 0, 7768 },
+    { 14048, 7, 1, 0, 7768 },
+    { 14055, 7, 1, 0, 7768 },
+    { 14062, 10, 1, 0, 7768 },
+    { 14072, 12, 1, 0, 7768 },
+    { 14084, 15, 1, 0, 7768 },
+    { 14099, 15, 1, 0, 7768 },
+    { 14114, 15, 1, 0, 7768 },
+    { 14129, 2, 1, 0, 7768 },
+    { 14131, 2, 1, 0, 7768 },
+    { 14133, 4, 0, 3, 7768 },
+    { 14137, 8, 1, 0, 7771 },
+    { 14145, 12, 4, 3, 7771 },
+    { 14157, 10, 1, 0, 7774 },
+    { 14167, 10, 0, 2, 7774 },
+    { 14177, 10, 1, 0, 7776 },
+    { 14187, 10, 1, 0, 7776 },
+    { 14197, 8, 1, 0, 7776 },
+    { 14205, 5, 1, 0, 7776 },
+    { 14210, 8, 1, 0, 7776 },
+    { 14218, 8, 1, 0, 7776 },
+    { 14226, 8, 1, 0, 7776 },
+    { 14234, 8, 1, 0, 7776 },
+    { 14242, 2, 1, 0, 7776 },
+    { 14244, 15, 1, 0, 7776 },
+    { 14259, 13, 4, 0, 7776 },
+    { 14272, 18, 4, 0, 7776 },
+    { 14290, 11, 1, 0, 7776 },
+    { 14301, 10, 1, 0, 7776 },
+    { 14311, 11, 1, 0, 7776 },
+    { 14322, 8, 1, 0, 7776 },
+    { 14330, 7, 1, 0, 7776 },
+    { 14337, 10, 1, 0, 7776 },
+    { 14347, 11, 1, 0, 7776 },
+    { 14358, 9, 1, 0, 7776 },
+    { 14367, 7, 1, 0, 7776 },
+    { 14374, 6, 1, 0, 7776 },
+    { 14380, 8, 1, 0, 7776 },
+    { 14388, 12, 1, 0, 7776 },
+    { 14400, 7, 1, 0, 7776 },
+    { 14407, 10, 1, 0, 7776 },
+    { 14417, 8, 1, 0, 7776 },
+    { 14425, 14, 1, 0, 7776 },
+    { 14439, 14, 1, 0, 7776 },
+    { 14453, 11, 1, 0, 7776 },
+    { 14464, 11, 1, 0, 7776 },
+    { 14475, 11, 1, 0, 7776 },
+    { 14486, 9, 1, 0, 7776 },
+    { 14495, 11, 1, 0, 7776 },
+    { 14506, 13, 1, 0, 7776 },
+    { 14519, 11, 1, 0, 7776 },
+    { 14530, 13, 1, 0, 7776 },
+    { 14543, 13, 1, 0, 7776 },
+    { 14556, 10, 1, 0, 7776 },
+    { 14566, 11, 1, 0, 7776 },
+    { 14577, 11, 1, 0, 7776 },
+    { 14588, 5, 1, 0, 7776 },
+    { 14593, 16, 1, 17, 7776 },
+    { 14609, 9, 1, 0, 7793 },
+    { 14618, 15, 1, 0, 7793 },
+    { 14633, 15, 1, 0, 7793 },
+    { 14648, 13, 1, 0, 7793 },
+    { 14661, 16, 1, 0, 7793 },
+    { 14677, 2, 1, 0, 7793 },
+    { 14679, 8, 0, 8, 7793 },
+    { 14687, 8, 1, 0, 7801 },
+    { 14695, 11, 1, 0, 7801 },
+    { 14706, 16, 1, 0, 7801 },
+    { 14722, 14, 1, 0, 7801 },
+    { 14736, 5, 0, 1, 7801 },
+    { 14741, 11, 1, 0, 7802 },
+    { 14752, 16, 1, 0, 7802 },
+    { 14768, 5, 1, 0, 7802 },
+    { 14773, 11, 1, 0, 7802 },
+    { 14784, 12, 1, 0, 7802 },
+    { 14796, 10, 1, 0, 7802 },
+    { 14806, 9, 1, 0, 7802 },
+    { 14815, 8, 1, 0, 7802 },
+    { 14823, 7, 1, 0, 7802 },
+    { 14830, 7, 1, 0, 7802 },
+    { 14837, 7, 1, 0, 7802 },
+    { 14844, 7, 1, 0, 7802 },
+    { 14851, 7, 1, 0, 7802 },
+    { 14858, 7, 1, 0, 7802 },
+    { 14865, 7, 1, 0, 7802 },
+    { 14872, 7, 1, 0, 7802 },
+    { 14879, 7, 1, 0, 7802 },
+    { 14886, 7, 1, 0, 7802 },
+    { 14893, 7, 1, 0, 7802 },
+    { 14900, 7, 1, 0, 7802 },
+    { 14907, 7, 1, 0, 7802 },
+    { 14914, 7, 1, 0, 7802 },
+    { 14921, 7, 1, 0, 7802 },
+    { 14928, 7, 1, 0, 7802 },
+    { 14935, 7, 1, 0, 7802 },
+    { 14942, 7, 1, 0, 7802 },
+    { 14949, 7, 1, 0, 7802 },
+    { 14956, 7, 1, 0, 7802 },
+    { 14963, 7, 1, 0, 7802 },
+    { 14970, 7, 1, 0, 7802 },
+    { 14977, 7, 1, 0, 7802 },
+    { 14984, 7, 1, 0, 7802 },
+    { 14991, 7, 1, 0, 7802 },
+    { 14998, 7, 1, 0, 7802 },
+    { 15005, 7, 1, 0, 7802 },
+    { 15012, 7, 1, 0, 7802 },
+    { 15019, 7, 1, 0, 7802 },
+    { 15026, 7, 1, 0, 7802 },
+    { 15033, 7, 1, 0, 7802 },
+    { 15040, 7, 1, 0, 7802 },
+    { 15047, 7, 1, 0, 7802 },
+    { 15054, 7, 1, 0, 7802 },
+    { 15061, 7, 1, 0, 7802 },
+    { 15068, 7, 1, 0, 7802 },
+    { 15075, 7, 1, 0, 7802 },
+    { 15082, 7, 1, 0, 7802 },
+    { 15089, 7, 1, 0, 7802 },
+    { 15096, 7, 1, 0, 7802 },
+    { 15103, 7, 1, 0, 7802 },
+    { 15110, 7, 1, 0, 7802 },
+    { 15117, 7, 1, 0, 7802 },
+    { 15124, 7, 1, 0, 7802 },
+    { 15131, 7, 1, 0, 7802 },
+    { 15138, 7, 1, 0, 7802 },
+    { 15145, 7, 1, 0, 7802 },
+    { 15152, 10, 1, 0, 7802 },
+    { 15162, 8, 1, 0, 7802 },
+    { 15170, 12, 1, 0, 7802 },
+    { 15182, 7, 1, 0, 7802 },
+    { 15189, 5, 1, 0, 7802 },
+    { 15194, 17, 1, 0, 7802 },
+    { 15211, 6, 1, 0, 7802 },
+    { 15217, 10, 1, 0, 7802 },
+    { 15227, 10, 1, 0, 7802 },
+    { 15237, 6, 1, 0, 7802 },
+    { 15243, 11, 1, 0, 7802 },
+    { 15254, 2, 1, 0, 7802 },
+    { 15256, 17, 1, 0, 7802 },
+    { 15273, 9, 1, 0, 7802 },
+    { 15282, 9, 1, 0, 7802 },
+    { 15291, 6, 1, 0, 7802 },
+    { 15297, 2, 1, 0, 7802 },
+    { 15299, 10, 1, 0, 7802 },
+    { 15309, 9, 1, 0, 7802 },
+    { 15318, 15, 1, 0, 7802 },
+    { 15333, 14, 1, 0, 7802 },
+    { 15347, 8, 1, 0, 7802 },
+    { 15355, 18, 0, 1, 7802 },
+    { 15373, 8, 1, 0, 7803 },
+    { 15381, 7, 0, 2, 7803 },
+    { 15388, 15, 1, 0, 7805 },
+    { 15403, 2, 1, 0, 7805 },
+    { 15405, 9, 1, 0, 7805 },
+    { 15414, 9, 0, 2, 7805 },
+    { 15423, 9, 1, 0, 7807 },
+    { 15432, 12, 1, 0, 7807 },
+    { 15444, 14, 1, 0, 7807 },
+    { 15458, 12, 1, 0, 7807 },
+    { 15470, 15, 1, 0, 7807 },
+    { 15485, 14, 1, 0, 7807 },
+    { 15499, 12, 1, 0, 7807 },
+    { 15511, 9, 1, 0, 7807 },
+    { 15520, 17, 1, 0, 7807 },
+    { 15537, 8, 1, 0, 7807 },
+    { 15545, 18, 1, 0, 7807 },
+    { 15563, 13, 1, 0, 7807 },
+    { 15576, 13, 1, 0, 7807 },
+    { 15589, 11, 1, 0, 7807 },
+    { 15600, 21, 1, 0, 7807 },
+    { 15621, 9, 1, 0, 7807 },
+    { 15630, 10, 1, 0, 7807 },
+    { 15640, 9, 1, 0, 7807 },
+    { 15649, 16, 1, 0, 7807 },
+    { 15665, 11, 1, 0, 7807 },
+    { 15676, 15, 1, 0, 7807 },
+    { 15691, 11, 1, 0, 7807 },
+    { 15702, 12, 1, 0, 7807 },
+    { 15714, 16, 1, 0, 7807 },
+    { 15730, 10, 1, 0, 7807 },
+    { 15740, 13, 1, 0, 7807 },
+    { 15753, 14, 1, 0, 7807 },
+    { 15767, 10, 1, 0, 7807 },
+    { 15777, 12, 1, 0, 7807 },
+    { 15789, 20, 1, 0, 7807 },
+    { 15809, 17, 1, 0, 7807 },
+    { 15826, 11, 1, 0, 7807 },
+    { 15837, 15, 1, 0, 7807 },
+    { 15852, 13, 1, 0, 7807 },
+    { 15865, 14, 1, 0, 7807 },
+    { 15879, 12, 1, 0, 7807 },
+    { 15891, 12, 1, 0, 7807 },
+    { 15903, 11, 1, 0, 7807 },
+    { 15914, 14, 1, 0, 7807 },
+    { 15928, 16, 1, 0, 7807 },
+    { 15944, 11, 1, 0, 7807 },
+    { 15955, 13, 1, 0, 7807 },
+    { 15968, 15, 1, 0, 7807 },
+    { 15983, 12, 1, 0, 7807 },
+    { 15995, 14, 1, 0, 7807 },
+    { 16009, 17, 1, 0, 7807 },
+    { 16026, 12, 1, 0, 7807 },
+    { 16038, 7, 1, 0, 7807 },
+    { 16045, 13, 1, 0, 7807 },
+    { 16058, 12, 1, 0, 7807 },
+    { 16070, 16, 1, 0, 7807 },
+    { 16086, 13, 1, 0, 7807 },
+    { 16099, 7, 1, 0, 7807 },
+    { 16106, 16, 1, 0, 7807 },
+    { 16122, 8, 1, 0, 7807 },
+    { 16130, 11, 1, 0, 7807 },
+    { 16141, 15, 1, 0, 7807 },
+    { 16156, 8, 1, 0, 7807 },
+    { 16164, 13, 1, 0, 7807 },
+    { 16177, 16, 1, 0, 7807 },
+    { 16193, 2, 1, 0, 7807 },
+    { 16195, 9, 1, 0, 7807 },
+    { 16204, 8, 0, 1, 7807 },
+    { 16212, 6, 0, 1, 7808 },
+    { 16218, 3, 1, 0, 7809 },
+    { 16221, 9, 1, 0, 7809 },
+    { 16230, 9, 1, 0, 7809 },
+    { 16239, 5, 1, 0, 7809 },
+    { 16244, 2, 1, 0, 7809 },
+    { 16246, 8, 1, 0, 7809 },
+    { 16254, 9, 1, 0, 7809 },
+    { 16263, 10, 1, 0, 7809 },
+    { 16273, 6, 0, 2, 7809 },
+    { 16279, 13, 4, 0, 7811 },
+    { 16292, 17, 0, 1, 7811 },
+    { 16309, 4, 0, 1, 7812 },
+    { 16313, 6, 1, 0, 7813 },
+    { 16319, 10, 1, 0, 7813 },
+    { 16329, 13, 1, 0, 7813 },
+    { 16342, 11, 0, 1, 7813 },
+    { 16353, 8, 1, 0, 7814 },
+    { 16361, 11, 1, 0, 7814 },
+    { 16372, 9, 1, 1, 7814 },
+    { 16381, 3, 1, 0, 7815 },
+    { 16384, 10, 1, 0, 7815 },
+    { 16394, 17, 1, 0, 7815 },
+    { 16411, 9, 1, 0, 7815 },
+    { 16420, 7, 1, 0, 7815 },
+    { 16427, 8, 1, 0, 7815 },
+    { 16435, 7, 1, 0, 7815 },
+    { 16442, 8, 1, 0, 7815 },
+    { 16450, 11, 1, 0, 7815 },
+    { 16461, 16, 1, 0, 7815 },
+    { 16477, 12, 1, 0, 7815 },
+    { 16489, 9, 1, 0, 7815 },
+    { 16498, 12, 1, 0, 7815 },
+    { 16510, 7, 1, 0, 7815 },
+    { 16517, 13, 0, 11, 7815 },
+    { 16530, 8, 1, 0, 7826 },
+    { 16538, 5, 1, 0, 7826 },
+    { 16543, 8, 1, 0, 7826 },
+    { 16551, 10, 1, 0, 7826 },
+    { 16561, 7, 1, 0, 7826 },
+    { 16568, 2, 1, 0, 7826 },
+    { 16570, 11, 0, 1, 7826 },
+    { 16581, 21, 0, 1, 7827 },
+    { 16602, 10, 1, 0, 7828 },
+    { 16612, 9, 1, 0, 7828 },
+    { 16621, 8, 1, 0, 7828 },
+    { 16629, 9, 1, 0, 7828 },
+    { 16638, 5, 1, 0, 7828 },
+    { 16643, 10, 1, 0, 7828 },
+    { 16653, 7, 1, 0, 7828 },
+    { 16660, 15, 1, 0, 7828 },
+    { 16675, 11, 1, 0, 7828 },
+    { 16686, 12, 1, 0, 7828 },
+    { 16698, 18, 1, 0, 7828 },
+    { 16716, 6, 1, 0, 7828 },
+    { 16722, 8, 4, 0, 7828 },
+    { 16730, 5, 1, 0, 7828 },
+    { 16735, 8, 1, 0, 7828 },
+    { 16743, 11, 1, 0, 7828 },
+    { 16754, 17, 1, 0, 7828 },
+    { 16771, 7, 1, 0, 7828 },
+    { 16778, 10, 1, 0, 7828 },
+    { 16788, 12, 1, 0, 7828 },
+    { 16800, 5, 0, 1, 7828 },
+    { 16805, 12, 1, 0, 7829 },
+    { 16817, 14, 1, 1, 7829 },
+    { 16831, 3, 1, 0, 7830 },
+    { 16834, 6, 1, 0, 7830 },
+    { 16840, 2, 1, 0, 7830 },
+    { 16842, 11, 1, 0, 7830 },
+    { 16853, 10, 1, 0, 7830 },
+    { 16863, 12, 4, 0, 7830 },
+    { 16875, 8, 1, 0, 7830 },
+    { 16883, 8, 1, 0, 7830 },
+    { 16891, 6, 0, 1, 7830 },
+    { 16897, 7, 1, 0, 7831 },
+    { 16904, 14, 1, 0, 7831 },
+    { 16918, 7, 1, 0, 7831 },
+    { 16925, 2, 1, 0, 7831 },
+    { 16927, 2, 1, 0, 7831 },
+    { 16929, 16, 1, 0, 7831 },
+    { 16945, 7, 1, 0, 7831 },
+    { 16952, 15, 1, 0, 7831 },
+    { 16967, 6, 1, 0, 7831 },
+    { 16973, 14, 1, 0, 7831 },
+    { 16987, 11, 1, 0, 7831 },
+    { 16998, 8, 1, 0, 7831 },
+    { 17006, 9, 1, 0, 7831 },
+    { 17015, 18, 1, 0, 7831 },
+    { 17033, 13, 1, 0, 7831 },
+    { 17046, 8, 1, 0, 7831 },
+    { 17054, 9, 1, 0, 7831 },
+    { 17063, 13, 1, 0, 7831 },
+    { 17076, 9, 1, 0, 7831 },
+    { 17085, 11, 1, 0, 7831 },
+    { 17096, 8, 1, 0, 7831 },
+    { 17104, 8, 1, 0, 7831 },
+    { 17112, 8, 1, 0, 7831 },
+    { 17120, 9, 1, 0, 7831 },
+    { 17129, 10, 1, 0, 7831 },
+    { 17139, 12, 1, 0, 7831 },
+    { 17151, 10, 1, 0, 7831 },
+    { 17161, 7, 1, 0, 7831 },
+    { 17168, 10, 1, 0, 7831 },
+    { 17178, 10, 1, 0, 7831 },
+    { 17188, 7, 1, 0, 7831 },
+    { 17195, 10, 1, 0, 7831 },
+    { 17205, 8, 1, 0, 7831 },
+    { 17213, 13, 1, 0, 7831 },
+    { 17226, 17, 1, 0, 7831 },
+    { 17243, 6, 0, 1, 7831 },
+    { 17249, 12, 1, 0, 7832 },
+    { 17261, 11, 1, 0, 7832 },
+    { 17272, 10, 0, 1, 7832 },
+    { 17282, 12, 1, 0, 7833 },
+    { 17294, 8, 1, 0, 7833 },
+    { 17302, 9, 1, 0, 7833 },
+    { 17311, 13, 1, 0, 7833 },
+    { 17324, 16, 1, 0, 7833 },
+    { 17340, 12, 1, 0, 7833 },
+    { 17352, 13, 1, 0, 7833 },
+    { 17365, 15, 1, 0, 7833 },
+    { 17380, 8, 0, 1, 7833 },
+    { 17388, 2, 1, 0, 7834 },
+    { 17390, 13, 1, 0, 7834 },
+    { 17403, 2, 1, 0, 7834 },
+    { 17405, 2, 1, 0, 7834 },
+    { 17407, 10, 1, 0, 7834 },
+    { 17417, 12, 4, 0, 7834 },
+    { 17429, 10, 0, 3, 7834 },
+    { 17439, 10, 1, 0, 7837 },
+    { 17449, 8, 0, 1, 7837 },
+    { 17457, 10, 1, 0, 7838 },
+    { 17467, 11, 1, 0, 7838 },
+    { 17478, 7, 1, 0, 7838 },
+    { 17485, 12, 1, 0, 7838 },
+    { 17497, 12, 1, 0, 7838 },
+    { 17509, 10, 1, 0, 7838 },
+    { 17519, 15, 1, 1, 7838 },
+    { 17534, 12, 1, 0, 7839 },
+    { 17546, 7, 1, 0, 7839 },
+    { 17553, 14, 1, 0, 7839 },
+    { 17567, 5, 1, 2, 7839 },
+    { 17572, 8, 1, 0, 7841 },
+    { 17580, 2, 1, 0, 7841 },
+    { 17582, 7, 1, 0, 7841 },
+    { 17589, 3, 1, 0, 7841 },
+    { 17592, 7, 1, 0, 7841 },
+    { 17599, 2, 1, 0, 7841 },
+    { 17601, 9, 1, 0, 7841 },
+    { 17610, 2, 1, 0, 7841 },
+    { 17612, 2, 1, 0, 7841 },
+    { 17614, 2, 1, 0, 7841 },
+    { 17616, 2, 1, 0, 7841 },
+    { 17618, 2, 1, 0, 7841 },
+    { 17620, 2, 1, 0, 7841 },
+    { 17622, 2, 1, 0, 7841 },
+    { 17624, 3, 1, 0, 7841 },
+    { 17627, 3, 1, 0, 7841 },
+    { 17630, 3, 1, 0, 7841 },
+    { 17633, 3, 1, 0, 7841 },
+    { 17636, 3, 1, 0, 7841 },
+    { 17639, 3, 1, 0, 7841 },
+    { 17642, 8, 1, 0, 7841 },
+    { 17650, 3, 1, 0, 7841 },
+    { 17653, 3, 1, 0, 7841 },
+    { 17656, 3, 1, 0, 7841 },
+    { 17659, 4, 1, 0, 7841 },
+    { 17663, 3, 1, 0, 7841 },
+    { 17666, 3, 1, 0, 7841 },
+    { 17669, 3, 1, 0, 7841 },
+    { 17672, 3, 1, 0, 7841 },
+    { 17675, 3, 1, 0, 7841 },
+    { 17678, 3, 1, 0, 7841 },
+    { 17681, 3, 1, 0, 7841 },
+    { 17684, 4, 1, 0, 7841 },
+    { 17688, 2, 1, 0, 7841 },
+    { 17690, 3, 1, 0, 7841 },
+    { 17693, 3, 1, 2, 7841 },
+    { 17696, 7, 1, 0, 7843 },
+    { 17703, 3, 1, 0, 7843 },
+    { 17706, 3, 1, 0, 7843 },
+    { 17709, 3, 1, 0, 7843 },
+    { 17712, 3, 1, 0, 7843 },
+    { 17715, 3, 1, 0, 7843 },
+    { 17718, 5, 1, 0, 7843 },
+    { 17723, 3, 1, 0, 7843 },
+    { 17726, 2, 1, 0, 7843 },
+    { 17728, 8, 1, 0, 7843 },
+    { 17736, 2, 1, 0, 7843 },
+    { 17738, 2, 1, 0, 7843 },
+    { 17740, 11, 0, 2, 7843 },
+    { 17751, 4, 0, 1, 7845 },
+    { 17755, 5, 1, 0, 7846 },
+    { 17760, 11, 1, 0, 7846 },
+    { 17771, 4, 1, 0, 7846 },
+    { 17775, 3, 1, 0, 7846 },
+    { 17778, 5, 1, 0, 7846 },
+    { 17783, 5, 1, 0, 7846 },
+    { 17788, 8, 1, 0, 7846 },
+    { 17796, 7, 1, 0, 7846 },
+    { 17803, 3, 1, 0, 7846 },
+    { 17806, 13, 1, 0, 7846 },
+    { 17819, 7, 0, 1, 7846 },
+    { 17826, 6, 1, 0, 7847 },
+    { 17832, 5, 1, 2, 7847 },
+    { 17837, 18, 1, 0, 7849 },
+    { 17855, 7, 1, 0, 7849 },
+    { 17862, 10, 1, 0, 7849 },
+    { 17872, 8, 1, 0, 7849 },
+    { 17880, 7, 1, 0, 7849 },
+    { 17887, 10, 1, 0, 7849 },
+    { 17897, 8, 1, 0, 7849 },
+    { 17905, 7, 1, 0, 7849 },
+    { 17912, 15, 1, 0, 7849 },
+    { 17927, 7, 1, 0, 7849 },
+    { 17934, 6, 1, 0, 7849 },
+    { 17940, 16, 1, 0, 7849 },
+    { 17956, 6, 4, 0, 7849 },
+    { 17962, 15, 1, 0, 7849 },
+    { 17977, 9, 1, 0, 7849 },
+    { 17986, 4, 1, 0, 7849 },
+    { 17990, 17, 1, 0, 7849 },
+    { 18007, 15, 1, 0, 7849 },
+    { 18022, 14, 1, 1, 7849 },
+    { 18036, 12, 0, 1, 7850 },
+    { 18048, 9, 1, 0, 7851 },
+    { 18057, 6, 1, 0, 7851 },
+    { 18063, 9, 1, 0, 7851 },
+    { 18072, 6, 1, 0, 7851 },
+    { 18078, 6, 1, 0, 7851 },
+    { 18084, 12, 1, 0, 7851 },
+    { 18096, 11, 1, 0, 7851 },
+    { 18107, 10, 1, 0, 7851 },
+    { 18117, 7, 1, 0, 7851 },
+    { 18124, 10, 1, 0, 7851 },
+    { 18134, 9, 1, 0, 7851 },
+    { 18143, 12, 1, 0, 7851 },
+    { 18155, 10, 1, 0, 7851 },
+    { 18165, 10, 1, 0, 7851 },
+    { 18175, 9, 1, 0, 7851 },
+    { 18184, 6, 1, 0, 7851 },
+    { 18190, 10, 1, 0, 7851 },
+    { 18200, 10, 1, 0, 7851 },
+    { 18210, 10, 1, 0, 7851 },
+    { 18220, 9, 1, 0, 7851 },
+    { 18229, 8, 1, 0, 7851 },
+    { 18237, 6, 1, 0, 7851 },
+    { 18243, 13, 1, 0, 7851 },
+    { 18256, 12, 1, 0, 7851 },
+    { 18268, 14, 1, 0, 7851 },
+    { 18282, 11, 1, 0, 7851 },
+    { 18293, 5, 1, 0, 7851 },
+    { 18298, 12, 0, 1, 7851 },
+    { 18310, 7, 1, 0, 7852 },
+    { 18317, 9, 1, 0, 7852 },
+    { 18326, 7, 1, 0, 7852 },
+    { 18333, 20, 1, 0, 7852 },
+    { 18353, 11, 1, 0, 7852 },
+    { 18364, 10, 1, 0, 7852 },
+    { 18374, 10, 1, 0, 7852 },
+    { 18384, 13, 1, 0, 7852 },
+    { 18397, 9, 4, 0, 7852 },
+    { 18406, 12, 1, 0, 7852 },
+    { 18418, 11, 1, 0, 7852 },
+    { 18429, 23, 1, 0, 7852 },
+    { 18452, 21, 1, 0, 7852 },
+    { 18473, 3, 1, 0, 7852 },
+    { 18476, 8, 1, 0, 7852 },
+    { 18484, 4, 1, 0, 7852 },
+    { 18488, 4, 1, 0, 7852 },
+    { 18492, 12, 1, 0, 7852 },
+    { 18504, 4, 1, 0, 7852 },
+    { 18508, 3, 1, 0, 7852 },
+    { 18511, 7, 4, 0, 7852 },
+    { 18518, 13, 1, 0, 7852 },
+    { 18531, 5, 1, 0, 7852 },
+    { 18536, 3, 4, 0, 7852 },
+    { 18539, 8, 4, 0, 7852 },
+    { 18547, 9, 0, 1, 7852 },
+    { 18556, 9, 1, 0, 7853 },
+    { 18565, 9, 1, 0, 7853 },
+    { 18574, 5, 1, 0, 7853 },
+    { 18579, 11, 1, 0, 7853 },
+    { 18590, 2, 1, 0, 7853 },
+    { 18592, 11, 1, 0, 7853 },
+    { 18603, 3, 4, 0, 7853 },
+    { 18606, 8, 4, 0, 7853 },
+    { 18614, 6, 1, 0, 7853 },
+    { 18620, 7, 4, 0, 7853 },
+    { 18627, 7, 1, 0, 7853 },
+    { 18634, 9, 1, 1, 7853 },
+    { 18643, 13, 1, 0, 7854 },
+    { 18656, 3, 1, 0, 7854 },
+    { 18659, 8, 1, 0, 7854 },
+    { 18667, 2, 1, 0, 7854 },
+    { 18669, 4, 1, 0, 7854 },
+    { 18673, 12, 1, 0, 7854 },
+    { 18685, 3, 1, 0, 7854 },
+    { 18688, 5, 1, 0, 7854 },
+    { 18693, 3, 1, 0, 7854 },
+    { 18696, 3, 1, 0, 7854 },
+    { 18699, 3, 1, 0, 7854 },
+    { 18702, 3, 1, 0, 7854 },
+    { 18705, 3, 1, 0, 7854 },
+    { 18708, 3, 1, 0, 7854 },
+    { 18711, 3, 1, 0, 7854 },
+    { 18714, 3, 1, 0, 7854 },
+    { 18717, 3, 1, 0, 7854 },
+    { 18720, 3, 1, 0, 7854 },
+    { 18723, 3, 1, 0, 7854 },
+    { 18726, 3, 1, 0, 7854 },
+    { 18729, 3, 1, 0, 7854 },
+    { 18732, 3, 1, 0, 7854 },
+    { 18735, 3, 1, 0, 7854 },
+    { 18738, 3, 1, 0, 7854 },
+    { 18741, 4, 1, 0, 7854 },
+    { 18745, 3, 1, 0, 7854 },
+    { 18748, 3, 1, 0, 7854 },
+    { 18751, 3, 1, 0, 7854 },
+    { 18754, 3, 1, 0, 7854 },
+    { 18757, 3, 1, 0, 7854 },
+    { 18760, 3, 1, 0, 7854 },
+    { 18763, 3, 1, 0, 7854 },
+    { 18766, 2, 1, 0, 7854 },
+    { 18768, 5, 4, 1, 7854 },
+    { 18773, 4, 1, 0, 7855 },
+    { 18777, 3, 1, 0, 7855 },
+    { 18780, 3, 1, 0, 7855 },
+    { 18783, 3, 1, 0, 7855 },
+    { 18786, 3, 1, 0, 7855 },
+    { 18789, 3, 1, 0, 7855 },
+    { 18792, 4, 1, 0, 7855 },
+    { 18796, 3, 1, 0, 7855 },
+    { 18799, 3, 1, 0, 7855 },
+    { 18802, 3, 1, 0, 7855 },
+    { 18805, 3, 1, 0, 7855 },
+    { 18808, 8, 1, 0, 7855 },
+    { 18816, 3, 1, 0, 7855 },
+    { 18819, 3, 1, 0, 7855 },
+    { 18822, 3, 0, 1, 7855 },
+    { 18825, 2, 1, 0, 7856 },
+    { 18827, 3, 1, 0, 7856 },
+    { 18830, 3, 1, 1, 7856 },
+    { 18833, 3, 1, 0, 7857 },
+    { 18836, 3, 1, 0, 7857 },
+    { 18839, 3, 1, 0, 7857 },
+    { 18842, 3, 1, 0, 7857 },
+    { 18845, 3, 1, 0, 7857 },
+    { 18848, 3, 1, 0, 7857 },
+    { 18851, 3, 1, 0, 7857 },
+    { 18854, 4, 1, 0, 7857 },
+    { 18858, 3, 1, 1, 7857 },
+    { 18861, 3, 1, 0, 7858 },
+    { 18864, 3, 1, 0, 7858 },
+    { 18867, 3, 1, 0, 7858 },
+    { 18870, 3, 1, 0, 7858 },
+    { 18873, 4, 1, 0, 7858 },
+    { 18877, 3, 1, 0, 7858 },
+    { 18880, 3, 1, 0, 7858 },
+    { 18883, 3, 1, 0, 7858 },
+    { 18886, 8, 1, 0, 7858 },
+    { 18894, 3, 1, 1, 7858 },
+    { 18897, 3, 1, 0, 7859 },
+    { 18900, 3, 1, 0, 7859 },
+    { 18903, 12, 1, 0, 7859 },
+    { 18915, 3, 1, 0, 7859 },
+    { 18918, 3, 1, 0, 7859 },
+    { 18921, 7, 4, 0, 7859 },
+    { 18928, 3, 1, 0, 7859 },
+    { 18931, 3, 1, 0, 7859 },
+    { 18934, 3, 1, 0, 7859 },
+    { 18937, 3, 1, 0, 7859 },
+    { 18940, 4, 1, 0, 7859 },
+    { 18944, 4, 1, 0, 7859 },
+    { 18948, 3, 1, 0, 7859 },
+    { 18951, 3, 1, 0, 7859 },
+    { 18954, 10, 1, 0, 7859 },
+    { 18964, 5, 1, 0, 7859 },
+    { 18969, 7, 1, 0, 7859 },
+    { 18976, 11, 1, 0, 7859 },
+    { 18987, 6, 0, 1, 7859 },
+    { 18993, 4, 1, 0, 7860 },
+    { 18997, 5, 1, 0, 7860 },
+    { 19002, 8, 4, 0, 7860 },
+    { 19010, 13, 1, 0, 7860 },
+    { 19023, 5, 0, 1, 7860 },
+    { 19028, 2, 1, 0, 7861 },
+    { 19030, 6, 1, 0, 7861 },
+    { 19036, 3, 1, 0, 7861 },
+    { 19039, 5, 1, 0, 7861 },
+    { 19044, 11, 1, 0, 7861 },
+    { 19055, 5, 1, 0, 7861 },
+    { 19060, 8, 1, 0, 7861 },
+    { 19068, 13, 0, 1, 7861 },
+    { 19081, 10, 0, 2, 7862 },
+    { 19091, 2, 1, 0, 7864 },
+    { 19093, 9, 1, 0, 7864 },
+    { 19102, 3, 1, 0, 7864 },
+    { 19105, 5, 1, 0, 7864 },
+    { 19110, 12, 1, 0, 7864 },
+    { 19122, 15, 1, 0, 7864 },
+    { 19137, 2, 1, 0, 7864 },
+    { 19139, 2, 1, 0, 7864 },
+    { 19141, 3, 1, 0, 7864 },
+    { 19144, 3, 1, 0, 7864 },
+    { 19147, 3, 1, 0, 7864 },
+    { 19150, 4, 1, 0, 7864 },
+    { 19154, 3, 1, 0, 7864 },
+    { 19157, 4, 1, 0, 7864 },
+    { 19161, 3, 1, 0, 7864 },
+    { 19164, 3, 1, 0, 7864 },
+    { 19167, 3, 1, 0, 7864 },
+    { 19170, 3, 1, 0, 7864 },
+    { 19173, 3, 1, 0, 7864 },
+    { 19176, 3, 1, 0, 7864 },
+    { 19179, 3, 1, 0, 7864 },
+    { 19182, 5, 1, 0, 7864 },
+    { 19187, 4, 4, 0, 7864 },
+    { 19191, 10, 1, 0, 7864 },
+    { 19201, 8, 1, 0, 7864 },
+    { 19209, 4, 1, 0, 7864 },
+    { 19213, 6, 1, 0, 7864 },
+    { 19219, 6, 1, 0, 7864 },
+    { 19225, 8, 1, 0, 7864 },
+    { 19233, 3, 1, 0, 7864 },
+    { 19236, 9, 1, 0, 7864 },
+    { 19245, 21, 1, 0, 7864 },
+    { 19266, 31, 1, 0, 7864 },
+    { 19297, 3, 1, 0, 7864 },
+    { 19300, 7, 1, 0, 7864 },
+    { 19307, 7, 1, 0, 7864 },
+    { 19314, 18, 1, 0, 7864 },
+    { 19332, 6, 1, 0, 7864 },
+    { 19338, 5, 1, 0, 7864 },
+    { 19343, 10, 1, 0, 7864 },
+    { 19353, 9, 1, 0, 7864 },
+    { 19362, 15, 1, 0, 7864 },
+    { 19377, 7, 1, 0, 7864 },
+    { 19384, 4, 1, 0, 7864 },
+    { 19388, 5, 1, 0, 7864 },
+    { 19393, 16, 1, 0, 7864 },
+    { 19409, 7, 1, 0, 7864 },
+    { 19416, 12, 1, 0, 7864 },
+    { 19428, 3, 1, 0, 7864 },
+    { 19431, 8, 1, 0, 7864 },
+    { 19439, 6, 1, 0, 7864 },
+    { 19445, 10, 1, 0, 7864 },
+    { 19455, 4, 1, 0, 7864 },
+    { 19459, 3, 1, 0, 7864 },
+    { 19462, 2, 1, 0, 7864 },
+    { 19464, 11, 1, 0, 7864 },
+    { 19475, 3, 1, 0, 7864 },
+    { 19478, 3, 1, 0, 7864 },
+    { 19481, 3, 1, 0, 7864 },
+    { 19484, 4, 1, 0, 7864 },
+    { 19488, 3, 1, 0, 7864 },
+    { 19491, 3, 1, 0, 7864 },
+    { 19494, 3, 1, 0, 7864 },
+    { 19497, 3, 1, 0, 7864 },
+    { 19500, 3, 1, 0, 7864 },
+    { 19503, 3, 1, 0, 7864 },
+    { 19506, 3, 1, 0, 7864 },
+    { 19509, 2, 1, 0, 7864 },
+    { 19511, 3, 1, 0, 7864 },
+    { 19514, 4, 1, 0, 7864 },
+    { 19518, 3, 1, 0, 7864 },
+    { 19521, 3, 1, 0, 7864 },
+    { 19524, 5, 1, 1, 7864 },
+    { 19529, 3, 1, 0, 7865 },
+    { 19532, 3, 1, 0, 7865 },
+    { 19535, 3, 1, 0, 7865 },
+    { 19538, 3, 1, 0, 7865 },
+    { 19541, 3, 1, 0, 7865 },
+    { 19544, 3, 1, 0, 7865 },
+    { 19547, 3, 1, 0, 7865 },
+    { 19550, 3, 1, 0, 7865 },
+    { 19553, 3, 1, 0, 7865 },
+    { 19556, 3, 1, 0, 7865 },
+    { 19559, 3, 1, 0, 7865 },
+    { 19562, 3, 1, 0, 7865 },
+    { 19565, 2, 1, 0, 7865 },
+    { 19567, 3, 1, 0, 7865 },
+    { 19570, 3, 1, 0, 7865 },
+    { 19573, 3, 1, 0, 7865 },
+    { 19576, 3, 1, 0, 7865 },
+    { 19579, 2, 1, 0, 7865 },
+    { 19581, 2, 1, 0, 7865 },
+    { 19583, 3, 1, 0, 7865 },
+    { 19586, 3, 1, 0, 7865 },
+    { 19589, 3, 1, 0, 7865 },
+    { 19592, 3, 1, 0, 7865 },
+    { 19595, 3, 1, 0, 7865 },
+    { 19598, 5, 1, 0, 7865 },
+    { 19603, 9, 1, 0, 7865 },
+    { 19612, 11, 4, 0, 7865 },
+    { 19623, 3, 1, 0, 7865 },
+    { 19626, 4, 1, 0, 7865 },
+    { 19630, 3, 1, 0, 7865 },
+    { 19633, 3, 1, 0, 7865 },
+    { 19636, 4, 1, 0, 7865 },
+    { 19640, 3, 1, 0, 7865 },
+    { 19643, 3, 1, 0, 7865 },
+    { 19646, 8, 1, 0, 7865 },
+    { 19654, 3, 1, 0, 7865 },
+    { 19657, 3, 1, 0, 7865 },
+    { 19660, 3, 1, 0, 7865 },
+    { 19663, 3, 1, 0, 7865 },
+    { 19666, 3, 1, 0, 7865 },
+    { 19669, 10, 1, 0, 7865 },
+    { 19679, 9, 1, 0, 7865 },
+    { 19688, 4, 1, 0, 7865 },
+    { 19692, 3, 1, 0, 7865 },
+    { 19695, 2, 1, 0, 7865 },
+    { 19697, 3, 1, 0, 7865 },
+    { 19700, 3, 1, 0, 7865 },
+    { 19703, 3, 1, 0, 7865 },
+    { 19706, 3, 1, 0, 7865 },
+    { 19709, 3, 1, 0, 7865 },
+    { 19712, 3, 1, 0, 7865 },
+    { 19715, 2, 1, 0, 7865 },
+    { 19717, 3, 1, 0, 7865 },
+    { 19720, 3, 1, 0, 7865 },
+    { 19723, 3, 1, 0, 7865 },
+    { 19726, 4, 1, 0, 7865 },
+    { 19730, 4, 1, 0, 7865 },
+    { 19734, 3, 1, 0, 7865 },
+    { 19737, 3, 1, 0, 7865 },
+    { 19740, 3, 1, 0, 7865 },
+    { 19743, 2, 1, 0, 7865 },
+    { 19745, 2, 1, 0, 7865 },
+    { 19747, 3, 1, 0, 7865 },
+    { 19750, 3, 1, 0, 7865 },
+    { 19753, 3, 1, 0, 7865 },
+    { 19756, 3, 1, 0, 7865 },
+    { 19759, 3, 1, 0, 7865 },
+    { 19762, 3, 1, 0, 7865 },
+    { 19765, 8, 1, 0, 7865 },
+    { 19773, 3, 1, 0, 7865 },
+    { 19776, 3, 1, 0, 7865 },
+    { 19779, 3, 1, 0, 7865 },
+    { 19782, 3, 1, 0, 7865 },
+    { 19785, 3, 1, 0, 7865 },
+    { 19788, 3, 1, 0, 7865 },
+    { 19791, 3, 1, 0, 7865 },
+    { 19794, 3, 1, 0, 7865 },
+    { 19797, 6, 1, 0, 7865 },
+    { 19803, 10, 1, 0, 7865 },
+    { 19813, 9, 1, 0, 7865 },
+    { 19822, 11, 1, 0, 7865 },
+    { 19833, 10, 1, 0, 7865 },
+    { 19843, 10, 1, 0, 7865 },
+    { 19853, 11, 1, 0, 7865 },
+    { 19864, 10, 1, 0, 7865 },
+    { 19874, 10, 1, 0, 7865 },
+    { 19884, 10, 1, 0, 7865 },
+    { 19894, 11, 1, 0, 7865 },
+    { 19905, 9, 1, 0, 7865 },
+    { 19914, 10, 1, 0, 7865 },
+    { 19924, 11, 1, 0, 7865 },
+    { 19935, 11, 1, 0, 7865 },
+    { 19946, 10, 1, 0, 7865 },
+    { 19956, 6, 1, 0, 7865 },
+    { 19962, 6, 1, 0, 7865 },
+    { 19968, 6, 1, 0, 7865 },
+    { 19974, 6, 1, 0, 7865 },
+    { 19980, 6, 1, 0, 7865 },
+    { 19986, 6, 1, 0, 7865 },
+    { 19992, 6, 1, 0, 7865 },
+    { 19998, 6, 1, 0, 7865 },
+    { 20004, 6, 1, 0, 7865 },
+    { 20010, 6, 1, 0, 7865 },
+    { 20016, 6, 1, 0, 7865 },
+    { 20022, 6, 1, 0, 7865 },
+    { 20028, 6, 1, 0, 7865 },
+    { 20034, 6, 1, 0, 7865 },
+    { 20040, 6, 1, 0, 7865 },
+    { 20046, 2, 1, 0, 7865 },
+    { 20048, 3, 1, 0, 7865 },
+    { 20051, 3, 1, 0, 7865 },
+    { 20054, 3, 1, 0, 7865 },
+    { 20057, 3, 1, 0, 7865 },
+    { 20060, 3, 1, 0, 7865 },
+    { 20063, 3, 1, 0, 7865 },
+    { 20066, 11, 1, 0, 7865 },
+    { 20077, 9, 1, 0, 7865 },
+    { 20086, 7, 1, 0, 7865 },
+    { 20093, 8, 1, 0, 7865 },
+    { 20101, 4, 1, 0, 7865 },
+    { 20105, 4, 1, 0, 7865 },
+    { 20109, 8, 1, 0, 7865 },
+    { 20117, 6, 1, 0, 7865 },
+    { 20123, 6, 1, 0, 7865 },
+    { 20129, 7, 1, 0, 7865 },
+    { 20136, 7, 1, 0, 7865 },
+    { 20143, 9, 1, 0, 7865 },
+    { 20152, 8, 1, 0, 7865 },
+    { 20160, 3, 1, 0, 7865 },
+    { 20163, 4, 1, 0, 7865 },
+    { 20167, 4, 1, 0, 7865 },
+    { 20171, 2, 1, 0, 7865 },
+    { 20173, 4, 1, 0, 7865 },
+    { 20177, 5, 1, 0, 7865 },
+    { 20182, 3, 1, 0, 7865 },
+    { 20185, 4, 1, 0, 7865 },
+    { 20189, 3, 1, 0, 7865 },
+    { 20192, 4, 1, 0, 7865 },
+    { 20196, 3, 1, 0, 7865 },
+    { 20199, 4, 1, 0, 7865 },
+    { 20203, 4, 1, 0, 7865 },
+    { 20207, 4, 1, 0, 7865 },
+    { 20211, 3, 1, 0, 7865 },
+    { 20214, 3, 1, 0, 7865 },
+    { 20217, 3, 1, 0, 7865 },
+    { 20220, 5, 1, 0, 7865 },
+    { 20225, 3, 1, 0, 7865 },
+    { 20228, 3, 1, 0, 7865 },
+    { 20231, 3, 1, 0, 7865 },
+    { 20234, 4, 1, 0, 7865 },
+    { 20238, 4, 1, 0, 7865 },
+    { 20242, 5, 1, 0, 7865 },
+    { 20247, 8, 1, 0, 7865 },
+    { 20255, 4, 1, 0, 7865 },
+    { 20259, 6, 1, 0, 7865 },
+    { 20265, 4, 1, 0, 7865 },
+    { 20269, 2, 1, 0, 7865 },
+    { 20271, 7, 1, 0, 7865 },
+    { 20278, 7, 1, 0, 7865 },
+    { 20285, 4, 1, 0, 7865 },
+    { 20289, 5, 1, 0, 7865 },
+    { 20294, 5, 1, 0, 7865 },
+    { 20299, 5, 1, 0, 7865 },
+    { 20304, 4, 1, 0, 7865 },
+    { 20308, 8, 1, 0, 7865 },
+    { 20316, 6, 1, 0, 7865 },
+    { 20322, 8, 1, 0, 7865 },
+    { 20330, 5, 1, 0, 7865 },
+    { 20335, 5, 1, 0, 7865 },
+    { 20340, 4, 1, 0, 7865 },
+    { 20344, 3, 1, 0, 7865 },
+    { 20347, 4, 1, 0, 7865 },
+    { 20351, 6, 1, 0, 7865 },
+    { 20357, 3, 1, 0, 7865 },
+    { 20360, 4, 1, 0, 7865 },
+    { 20364, 5, 1, 0, 7865 },
+    { 20369, 4, 1, 0, 7865 },
+    { 20373, 4, 1, 0, 7865 },
+    { 20377, 2, 1, 0, 7865 },
+    { 20379, 6, 1, 0, 7865 },
+    { 20385, 6, 1, 0, 7865 },
+    { 20391, 5, 1, 0, 7865 },
+    { 20396, 2, 1, 0, 7865 },
+    { 20398, 3, 1, 0, 7865 },
+    { 20401, 2, 1, 1, 7865 },
+    { 20403, 4, 1, 0, 7866 },
+    { 20407, 4, 1, 0, 7866 },
+    { 20411, 5, 1, 0, 7866 },
+    { 20416, 2, 1, 0, 7866 },
+    { 20418, 3, 1, 0, 7866 },
+    { 20421, 2, 1, 1, 7866 },
+    { 20423, 3, 1, 0, 7867 },
+    { 20426, 2, 1, 0, 7867 },
+    { 20428, 6, 1, 0, 7867 },
+    { 20434, 3, 1, 0, 7867 },
+    { 20437, 3, 1, 0, 7867 },
+    { 20440, 8, 1, 0, 7867 },
+    { 20448, 3, 1, 0, 7867 },
+    { 20451, 12, 1, 0, 7867 },
+    { 20463, 2, 1, 0, 7867 },
+    { 20465, 2, 1, 4, 7867 },
+    { 20467, 3, 1, 0, 7871 },
+    { 20470, 3, 1, 0, 7871 },
+    { 20473, 3, 1, 0, 7871 },
+    { 20476, 4, 1, 0, 7871 },
+    { 20480, 3, 1, 0, 7871 },
+    { 20483, 3, 1, 0, 7871 },
+    { 20486, 2, 1, 0, 7871 },
+    { 20488, 2, 1, 2, 7871 },
+    { 20490, 3, 1, 0, 7873 },
+    { 20493, 3, 1, 0, 7873 },
+    { 20496, 3, 1, 0, 7873 },
+    { 20499, 2, 1, 0, 7873 },
+    { 20501, 2, 1, 0, 7873 },
+    { 20503, 2, 1, 0, 7873 },
+    { 20505, 2, 1, 0, 7873 },
+    { 20507, 2, 1, 0, 7873 },
+    { 20509, 2, 1, 0, 7873 },
+    { 20511, 2, 1, 0, 7873 },
+    { 20513, 2, 1, 0, 7873 },
+    { 20515, 5, 1, 0, 7873 },
+    { 20520, 5, 1, 0, 7873 },
+    { 20525, 3, 1, 0, 7873 },
+    { 20528, 8, 1, 0, 7873 },
+    { 20536, 8, 1, 0, 7873 },
+    { 20544, 2, 1, 0, 7873 },
+    { 20546, 7, 1, 0, 7873 },
+    { 20553, 2, 1, 0, 7873 },
+    { 20555, 2, 1, 0, 7873 },
+    { 20557, 3, 1, 0, 7873 },
+    { 20560, 4, 1, 0, 7873 },
+    { 20564, 2, 1, 0, 7873 },
+    { 20566, 5, 1, 0, 7873 },
+    { 20571, 2, 1, 0, 7873 },
+    { 20573, 3, 1, 0, 7873 },
+    { 20576, 2, 1, 0, 7873 },
+    { 20578, 4, 1, 0, 7873 },
+    { 20582, 3, 1, 0, 7873 },
+    { 20585, 3, 1, 0, 7873 },
+    { 20588, 7, 1, 0, 7873 },
+    { 20595, 3, 1, 0, 7873 },
+    { 20598, 4, 1, 0, 7873 },
+    { 20602, 3, 1, 0, 7873 },
+    { 20605, 8, 1, 0, 7873 },
+    { 20613, 2, 1, 0, 7873 },
+    { 20615, 2, 1, 0, 7873 },
+    { 20617, 3, 1, 0, 7873 },
+    { 20620, 3, 1, 0, 7873 },
+    { 20623, 3, 1, 0, 7873 },
+    { 20626, 3, 1, 0, 7873 },
+    { 20629, 2, 1, 0, 7873 },
+    { 20631, 4, 1, 0, 7873 },
+    { 20635, 3, 1, 0, 7873 },
+    { 20638, 3, 1, 0, 7873 },
+    { 20641, 8, 1, 0, 7873 },
+    { 20649, 6, 1, 0, 7873 },
+    { 20655, 2, 1, 0, 7873 },
+    { 20657, 2, 1, 0, 7873 },
+    { 20659, 2, 1, 0, 7873 },
+    { 20661, 2, 1, 0, 7873 },
+    { 20663, 3, 1, 0, 7873 },
+    { 20666, 19, 1, 0, 7873 },
+    { 20685, 20, 1, 0, 7873 },
+    { 20705, 5, 1, 0, 7873 },
+    { 20710, 7, 1, 0, 7873 },
+    { 20717, 9, 1, 0, 7873 },
+    { 20726, 6, 1, 0, 7873 },
+    { 20732, 11, 1, 0, 7873 },
+    { 20743, 6, 1, 0, 7873 },
+    { 20749, 7, 1, 0, 7873 },
+    { 20756, 6, 1, 0, 7873 },
+    { 20762, 9, 1, 0, 7873 },
+    { 20771, 10, 1, 0, 7873 },
+    { 20781, 13, 1, 0, 7873 },
+    { 20794, 12, 1, 0, 7873 },
+    { 20806, 10, 1, 0, 7873 },
+    { 20816, 8, 1, 0, 7873 },
+    { 20824, 5, 1, 0, 7873 },
+    { 20829, 8, 1, 0, 7873 },
+    { 20837, 6, 1, 0, 7873 },
+    { 20843, 6, 1, 0, 7873 },
+    { 20849, 6, 1, 0, 7873 },
+    { 20855, 2, 1, 0, 7873 },
+    { 20857, 4, 1, 0, 7873 },
+    { 20861, 6, 1, 0, 7873 },
+    { 20867, 14, 4, 0, 7873 },
+    { 20881, 6, 1, 0, 7873 },
+    { 20887, 12, 1, 0, 7873 },
+    { 20899, 11, 0, 2, 7873 },
+    { 20910, 5, 1, 0, 7875 },
+    { 20915, 11, 1, 0, 7875 },
+    { 20926, 11, 1, 0, 7875 },
+    { 20937, 7, 0, 1, 7875 },
+    { 20944, 10, 0, 1, 7876 },
+    { 20954, 4, 0, 1, 7877 },
+    { 20958, 9, 1, 0, 7878 },
+    { 20967, 8, 1, 0, 7878 },
+    { 20975, 7, 1, 0, 7878 },
+    { 20982, 17, 1, 0, 7878 },
+    { 20999, 10, 1, 0, 7878 },
+    { 21009, 3, 1, 0, 7878 },
+    { 21012, 8, 0, 1, 7878 },
+    { 21020, 5, 1, 0, 7879 },
+    { 21025, 8, 1, 0, 7879 },
+    { 21033, 4, 1, 0, 7879 },
+    { 21037, 5, 1, 0, 7879 },
+    { 21042, 7, 1, 0, 7879 },
+    { 21049, 6, 1, 0, 7879 },
+    { 21055, 11, 1, 0, 7879 },
+    { 21066, 9, 0, 1, 7879 },
+    { 21075, 5, 1, 0, 7880 },
+    { 21080, 6, 1, 0, 7880 },
+    { 21086, 6, 1, 0, 7880 },
+    { 21092, 10, 1, 0, 7880 },
+    { 21102, 12, 1, 0, 7880 },
+    { 21114, 3, 1, 0, 7880 },
+    { 21117, 4, 1, 0, 7880 },
+    { 21121, 4, 0, 1, 7880 },
+    { 21125, 9, 1, 0, 7881 },
+    { 21134, 7, 1, 0, 7881 },
+    { 21141, 10, 1, 0, 7881 },
+    { 21151, 9, 4, 0, 7881 },
+    { 21160, 8, 1, 0, 7881 },
+    { 21168, 5, 1, 0, 7881 },
+    { 21173, 3, 1, 0, 7881 },
+    { 21176, 7, 0, 1, 7881 },
+    { 21183, 8, 4, 0, 7882 },
+    { 21191, 6, 4, 0, 7882 },
+    { 21197, 6, 4, 0, 7882 },
+    { 21203, 12, 1, 0, 7882 },
+    { 21215, 8, 1, 0, 7882 },
+    { 21223, 5, 1, 1, 7882 },
+    { 21228, 3, 1, 1, 7883 },
+    { 21231, 4, 1, 0, 7884 },
+    { 21235, 11, 1, 0, 7884 },
+    { 21246, 11, 1, 0, 7884 },
+    { 21257, 12, 0, 1, 7884 },
+    { 21269, 3, 4, 0, 7885 },
+    { 21272, 8, 1, 0, 7885 },
+    { 21280, 11, 1, 0, 7885 },
+    { 21291, 9, 1, 0, 7885 },
+    { 21300, 3, 1, 0, 7885 },
+    { 21303, 8, 1, 0, 7885 },
+    { 21311, 6, 4, 0, 7885 },
+    { 21317, 7, 1, 0, 7885 },
+    { 21324, 9, 0, 4, 7885 },
+    { 21333, 7, 1, 0, 7889 },
+    { 21340, 8, 0, 1, 7889 },
+    { 21348, 4, 1, 0, 7890 },
+    { 21352, 7, 1, 0, 7890 },
+    { 21359, 10, 1, 0, 7890 },
+    { 21369, 8, 0, 1, 7890 },
+    { 21377, 13, 1, 0, 7891 },
+    { 21390, 9, 1, 0, 7891 },
+    { 21399, 8, 1, 0, 7891 },
+    { 21407, 3, 1, 0, 7891 },
+    { 21410, 3, 1, 0, 7891 },
+    { 21413, 3, 1, 0, 7891 },
+    { 21416, 3, 1, 0, 7891 },
+    { 21419, 3, 1, 0, 7891 },
+    { 21422, 3, 1, 0, 7891 },
+    { 21425, 2, 1, 0, 7891 },
+    { 21427, 2, 1, 0, 7891 },
+    { 21429, 3, 1, 0, 7891 },
+    { 21432, 2, 1, 0, 7891 },
+    { 21434, 3, 1, 0, 7891 },
+    { 21437, 3, 1, 0, 7891 },
+    { 21440, 3, 1, 0, 7891 },
+    { 21443, 15, 1, 0, 7891 },
+    { 21458, 14, 1, 0, 7891 },
+    { 21472, 10, 1, 0, 7891 },
+    { 21482, 10, 1, 0, 7891 },
+    { 21492, 8, 1, 0, 7891 },
+    { 21500, 3, 1, 0, 7891 },
+    { 21503, 7, 1, 0, 7891 },
+    { 21510, 3, 1, 0, 7891 },
+    { 21513, 3, 1, 0, 7891 },
+    { 21516, 3, 1, 0, 7891 },
+    { 21519, 3, 1, 0, 7891 },
+    { 21522, 3, 1, 0, 7891 },
+    { 21525, 11, 1, 0, 7891 },
+    { 21536, 4, 1, 0, 7891 },
+    { 21540, 4, 1, 0, 7891 },
+    { 21544, 4, 1, 0, 7891 },
+    { 21548, 3, 1, 0, 7891 },
+    { 21551, 7, 1, 0, 7891 },
+    { 21558, 2, 1, 0, 7891 },
+    { 21560, 9, 1, 0, 7891 },
+    { 21569, 2, 1, 0, 7891 },
+    { 21571, 11, 1, 0, 7891 },
+    { 21582, 10, 1, 0, 7891 },
+    { 21592, 9, 1, 0, 7891 },
+    { 21601, 2, 1, 0, 7891 },
+    { 21603, 6, 1, 0, 7891 },
+    { 21609, 21, 1, 0, 7891 },
+    { 21630, 21, 1, 0, 7891 },
+    { 21651, 19, 1, 0, 7891 },
+    { 21670, 19, 1, 0, 7891 },
+    { 21689, 2, 1, 0, 7891 },
+    { 21691, 5, 1, 0, 7891 },
+    { 21696, 12, 1, 0, 7891 },
+    { 21708, 11, 1, 0, 7891 },
+    { 21719, 5, 1, 0, 7891 },
+    { 21724, 2, 1, 0, 7891 },
+    { 21726, 2, 1, 0, 7891 },
+    { 21728, 6, 1, 0, 7891 },
+    { 21734, 2, 1, 0, 7891 },
+    { 21736, 6, 1, 0, 7891 },
+    { 21742, 13, 1, 0, 7891 },
+    { 21755, 12, 1, 0, 7891 },
+    { 21767, 4, 1, 0, 7891 },
+    { 21771, 2, 1, 0, 7891 },
+    { 21773, 2, 1, 0, 7891 },
+    { 21775, 8, 1, 0, 7891 },
+    { 21783, 2, 1, 0, 7891 },
+    { 21785, 6, 1, 0, 7891 },
+    { 21791, 15, 1, 0, 7891 },
+    { 21806, 16, 1, 0, 7891 },
+    { 21822, 16, 1, 0, 7891 },
+    { 21838, 4, 1, 0, 7891 },
+    { 21842, 21, 1, 0, 7891 },
+    { 21863, 19, 1, 0, 7891 },
+    { 21882, 3, 1, 0, 7891 },
+    { 21885, 10, 1, 0, 7891 },
+    { 21895, 7, 1, 0, 7891 },
+    { 21902, 9, 1, 0, 7891 },
+    { 21911, 7, 1, 0, 7891 },
+    { 21918, 2, 1, 0, 7891 },
+    { 21920, 2, 1, 0, 7891 },
+    { 21922, 6, 1, 0, 7891 },
+    { 21928, 2, 1, 0, 7891 },
+    { 21930, 8, 1, 0, 7891 },
+    { 21938, 2, 1, 0, 7891 },
+    { 21940, 2, 1, 0, 7891 },
+    { 21942, 7, 1, 0, 7891 },
+    { 21949, 7, 1, 0, 7891 },
+    { 21956, 17, 1, 0, 7891 },
+    { 21973, 5, 1, 0, 7891 },
+    { 21978, 14, 1, 0, 7891 },
+    { 21992, 15, 1, 0, 7891 },
+    { 22007, 15, 1, 0, 7891 },
+    { 22022, 2, 1, 0, 7891 },
+    { 22024, 7, 1, 0, 7891 },
+    { 22031, 8, 1, 0, 7891 },
+    { 22039, 2, 1, 0, 7891 },
+    { 22041, 2, 1, 0, 7891 },
+    { 22043, 6, 1, 0, 7891 },
+    { 22049, 15, 1, 0, 7891 },
+    { 22064, 16, 1, 0, 7891 },
+    { 22080, 16, 1, 0, 7891 },
+    { 22096, 2, 1, 0, 7891 },
+    { 22098, 2, 1, 0, 7891 },
+    { 22100, 8, 1, 0, 7891 },
+    { 22108, 3, 1, 0, 7891 },
+    { 22111, 8, 1, 0, 7891 },
+    { 22119, 13, 1, 0, 7891 },
+    { 22132, 3, 1, 0, 7891 },
+    { 22135, 8, 1, 0, 7891 },
+    { 22143, 15, 1, 0, 7891 },
+    { 22158, 14, 1, 0, 7891 },
+    { 22172, 10, 1, 0, 7891 },
+    { 22182, 17, 1, 0, 7891 },
+    { 22199, 16, 1, 0, 7891 },
+    { 22215, 13, 1, 0, 7891 },
+    { 22228, 12, 1, 0, 7891 },
+    { 22240, 7, 1, 0, 7891 },
+    { 22247, 7, 1, 0, 7891 },
+    { 22254, 9, 1, 0, 7891 },
+    { 22263, 2, 1, 0, 7891 },
+    { 22265, 2, 1, 0, 7891 },
+    { 22267, 12, 1, 0, 7891 },
+    { 22279, 13, 1, 0, 7891 },
+    { 22292, 11, 1, 0, 7891 },
+    { 22303, 12, 1, 0, 7891 },
+    { 22315, 2, 1, 0, 7891 },
+    { 22317, 6, 1, 0, 7891 },
+    { 22323, 2, 1, 0, 7891 },
+    { 22325, 2, 1, 0, 7891 },
+    { 22327, 2, 1, 0, 7891 },
+    { 22329, 2, 1, 0, 7891 },
+    { 22331, 4, 1, 0, 7891 },
+    { 22335, 7, 1, 0, 7891 },
+    { 22342, 2, 1, 0, 7891 },
+    { 22344, 7, 1, 0, 7891 },
+    { 22351, 7, 1, 0, 7891 },
+    { 22358, 2, 1, 0, 7891 },
+    { 22360, 2, 1, 0, 7891 },
+    { 22362, 5, 1, 0, 7891 },
+    { 22367, 2, 1, 0, 7891 },
+    { 22369, 14, 1, 0, 7891 },
+    { 22383, 13, 1, 0, 7891 },
+    { 22396, 3, 1, 0, 7891 },
+    { 22399, 14, 1, 0, 7891 },
+    { 22413, 13, 1, 0, 7891 },
+    { 22426, 3, 1, 0, 7891 },
+    { 22429, 2, 1, 0, 7891 },
+    { 22431, 4, 1, 0, 7891 },
+    { 22435, 2, 1, 0, 7891 },
+    { 22437, 2, 1, 0, 7891 },
+    { 22439, 5, 1, 0, 7891 },
+    { 22444, 7, 1, 0, 7891 },
+    { 22451, 2, 1, 0, 7891 },
+    { 22453, 2, 1, 0, 7891 },
+    { 22455, 7, 1, 0, 7891 },
+    { 22462, 8, 1, 0, 7891 },
+    { 22470, 2, 1, 0, 7891 },
+    { 22472, 6, 1, 0, 7891 },
+    { 22478, 12, 1, 0, 7891 },
+    { 22490, 11, 1, 0, 7891 },
+    { 22501, 13, 1, 0, 7891 },
+    { 22514, 12, 1, 0, 7891 },
+    { 22526, 2, 1, 0, 7891 },
+    { 22528, 15, 1, 0, 7891 },
+    { 22543, 16, 1, 0, 7891 },
+    { 22559, 15, 1, 0, 7891 },
+    { 22574, 21, 1, 0, 7891 },
+    { 22595, 20, 1, 0, 7891 },
+    { 22615, 14, 1, 0, 7891 },
+    { 22629, 14, 1, 0, 7891 },
+    { 22643, 15, 1, 0, 7891 },
+    { 22658, 14, 1, 0, 7891 },
+    { 22672, 20, 1, 0, 7891 },
+    { 22692, 19, 1, 0, 7891 },
+    { 22711, 13, 1, 0, 7891 },
+    { 22724, 9, 1, 0, 7891 },
+    { 22733, 3, 1, 0, 7891 },
+    { 22736, 2, 1, 0, 7891 },
+    { 22738, 5, 1, 0, 7891 },
+    { 22743, 6, 1, 0, 7891 },
+    { 22749, 2, 1, 0, 7891 },
+    { 22751, 7, 1, 0, 7891 },
+    { 22758, 3, 1, 0, 7891 },
+    { 22761, 2, 1, 0, 7891 },
+    { 22763, 8, 1, 0, 7891 },
+    { 22771, 5, 1, 0, 7891 },
+    { 22776, 17, 1, 0, 7891 },
+    { 22793, 16, 1, 0, 7891 },
+    { 22809, 10, 1, 0, 7891 },
+    { 22819, 2, 1, 0, 7891 },
+    { 22821, 7, 1, 0, 7891 },
+    { 22828, 2, 1, 0, 7891 },
+    { 22830, 7, 1, 0, 7891 },
+    { 22837, 2, 1, 0, 7891 },
+    { 22839, 9, 1, 0, 7891 },
+    { 22848, 7, 1, 0, 7891 },
+    { 22855, 8, 1, 0, 7891 },
+    { 22863, 6, 1, 0, 7891 },
+    { 22869, 3, 1, 0, 7891 },
+    { 22872, 5, 1, 0, 7891 },
+    { 22877, 2, 1, 0, 7891 },
+    { 22879, 2, 1, 0, 7891 },
+    { 22881, 5, 1, 0, 7891 },
+    { 22886, 5, 1, 0, 7891 },
+    { 22891, 2, 1, 0, 7891 },
+    { 22893, 3, 1, 0, 7891 },
+    { 22896, 7, 1, 0, 7891 },
+    { 22903, 7, 1, 0, 7891 },
+    { 22910, 2, 1, 0, 7891 },
+    { 22912, 4, 1, 0, 7891 },
+    { 22916, 3, 1, 0, 7891 },
+    { 22919, 9, 1, 0, 7891 },
+    { 22928, 8, 1, 0, 7891 },
+    { 22936, 2, 1, 0, 7891 },
+    { 22938, 2, 1, 0, 7891 },
+    { 22940, 7, 1, 0, 7891 },
+    { 22947, 5, 1, 0, 7891 },
+    { 22952, 8, 1, 0, 7891 },
+    { 22960, 7, 1, 0, 7891 },
+    { 22967, 3, 1, 0, 7891 },
+    { 22970, 6, 1, 0, 7891 },
+    { 22976, 13, 1, 0, 7891 },
+    { 22989, 12, 1, 0, 7891 },
+    { 23001, 6, 1, 0, 7891 },
+    { 23007, 2, 1, 0, 7891 },
+    { 23009, 2, 1, 0, 7891 },
+    { 23011, 2, 1, 0, 7891 },
+    { 23013, 15, 1, 0, 7891 },
+    { 23028, 14, 1, 0, 7891 },
+    { 23042, 7, 1, 0, 7891 },
+    { 23049, 2, 1, 0, 7891 },
+    { 23051, 5, 1, 0, 7891 },
+    { 23056, 6, 1, 0, 7891 },
+    { 23062, 2, 1, 0, 7891 },
+    { 23064, 2, 1, 0, 7891 },
+    { 23066, 6, 1, 0, 7891 },
+    { 23072, 3, 1, 0, 7891 },
+    { 23075, 6, 1, 0, 7891 },
+    { 23081, 5, 1, 0, 7891 },
+    { 23086, 13, 1, 0, 7891 },
+    { 23099, 21, 1, 0, 7891 },
+    { 23120, 12, 1, 0, 7891 },
+    { 23132, 13, 1, 0, 7891 },
+    { 23145, 18, 1, 0, 7891 },
+    { 23163, 2, 1, 0, 7891 },
+    { 23165, 2, 1, 0, 7891 },
+    { 23167, 12, 1, 0, 7891 },
+    { 23179, 2, 1, 0, 7891 },
+    { 23181, 6, 1, 0, 7891 },
+    { 23187, 6, 1, 0, 7891 },
+    { 23193, 4, 0, 1, 7891 },
+    { 23197, 2, 1, 0, 7892 },
+    { 23199, 6, 1, 0, 7892 },
+    { 23205, 2, 1, 0, 7892 },
+    { 23207, 5, 1, 0, 7892 },
+    { 23212, 2, 1, 0, 7892 },
+    { 23214, 9, 1, 0, 7892 },
+    { 23223, 12, 1, 0, 7892 },
+    { 23235, 11, 1, 0, 7892 },
+    { 23246, 2, 1, 0, 7892 },
+    { 23248, 8, 1, 0, 7892 },
+    { 23256, 2, 1, 0, 7892 },
+    { 23258, 2, 1, 0, 7892 },
+    { 23260, 6, 1, 0, 7892 },
+    { 23266, 5, 1, 0, 7892 },
+    { 23271, 7, 1, 0, 7892 },
+    { 23278, 5, 1, 0, 7892 },
+    { 23283, 5, 1, 0, 7892 },
+    { 23288, 2, 1, 0, 7892 },
+    { 23290, 2, 1, 0, 7892 },
+    { 23292, 2, 1, 0, 7892 },
+    { 23294, 7, 1, 0, 7892 },
+    { 23301, 13, 1, 0, 7892 },
+    { 23314, 12, 1, 0, 7892 },
+    { 23326, 7, 1, 0, 7892 },
+    { 23333, 2, 1, 0, 7892 },
+    { 23335, 2, 1, 0, 7892 },
+    { 23337, 8, 1, 0, 7892 },
+    { 23345, 8, 1, 0, 7892 },
+    { 23353, 8, 1, 0, 7892 },
+    { 23361, 4, 1, 0, 7892 },
+    { 23365, 7, 1, 0, 7892 },
+    { 23372, 3, 1, 0, 7892 },
+    { 23375, 2, 1, 0, 7892 },
+    { 23377, 2, 1, 0, 7892 },
+    { 23379, 9, 1, 0, 7892 },
+    { 23388, 7, 1, 0, 7892 },
+    { 23395, 2, 1, 0, 7892 },
+    { 23397, 5, 1, 0, 7892 },
+    { 23402, 2, 1, 0, 7892 },
+    { 23404, 2, 1, 0, 7892 },
+    { 23406, 3, 1, 0, 7892 },
+    { 23409, 6, 1, 0, 7892 },
+    { 23415, 2, 1, 0, 7892 },
+    { 23417, 2, 1, 0, 7892 },
+    { 23419, 2, 1, 0, 7892 },
+    { 23421, 6, 1, 0, 7892 },
+    { 23427, 7, 1, 0, 7892 },
+    { 23434, 2, 1, 0, 7892 },
+    { 23436, 2, 1, 0, 7892 },
+    { 23438, 15, 1, 0, 7892 },
+    { 23453, 13, 1, 0, 7892 },
+    { 23466, 14, 1, 0, 7892 },
+    { 23480, 12, 1, 0, 7892 },
+    { 23492, 2, 1, 0, 7892 },
+    { 23494, 2, 1, 0, 7892 },
+    { 23496, 5, 1, 0, 7892 },
+    { 23501, 6, 1, 0, 7892 },
+    { 23507, 2, 1, 0, 7892 },
+    { 23509, 2, 1, 0, 7892 },
+    { 23511, 2, 1, 0, 7892 },
+    { 23513, 4, 1, 0, 7892 },
+    { 23517, 4, 1, 0, 7892 },
+    { 23521, 6, 1, 0, 7892 },
+    { 23527, 2, 1, 0, 7892 },
+    { 23529, 7, 1, 0, 7892 },
+    { 23536, 3, 1, 0, 7892 },
+    { 23539, 8, 1, 0, 7892 },
+    { 23547, 8, 1, 0, 7892 },
+    { 23555, 7, 1, 0, 7892 },
+    { 23562, 6, 1, 0, 7892 },
+    { 23568, 2, 1, 0, 7892 },
+    { 23570, 3, 1, 0, 7892 },
+    { 23573, 7, 1, 0, 7892 },
+    { 23580, 6, 1, 0, 7892 },
+    { 23586, 5, 1, 0, 7892 },
+    { 23591, 8, 1, 0, 7892 },
+    { 23599, 2, 1, 0, 7892 },
+    { 23601, 7, 1, 0, 7892 },
+    { 23608, 2, 1, 0, 7892 },
+    { 23610, 2, 1, 0, 7892 },
+    { 23612, 2, 1, 0, 7892 },
+    { 23614, 9, 1, 0, 7892 },
+    { 23623, 2, 1, 0, 7892 },
+    { 23625, 8, 1, 0, 7892 },
+    { 23633, 9, 1, 0, 7892 },
+    { 23642, 2, 1, 0, 7892 },
+    { 23644, 3, 1, 0, 7892 },
+    { 23647, 7, 1, 0, 7892 },
+    { 23654, 2, 1, 0, 7892 },
+    { 23656, 12, 1, 0, 7892 },
+    { 23668, 11, 1, 0, 7892 },
+    { 23679, 6, 1, 0, 7892 },
+    { 23685, 5, 1, 0, 7892 },
+    { 23690, 3, 0, 1, 7892 },
+    { 23693, 2, 1, 0, 7893 },
+    { 23695, 2, 1, 0, 7893 },
+    { 23697, 6, 1, 0, 7893 },
+    { 23703, 3, 1, 0, 7893 },
+    { 23706, 7, 1, 0, 7893 },
+    { 23713, 2, 1, 0, 7893 },
+    { 23715, 2, 1, 0, 7893 },
+    { 23717, 21, 1, 0, 7893 },
+    { 23738, 21, 1, 0, 7893 },
+    { 23759, 19, 1, 0, 7893 },
+    { 23778, 19, 1, 0, 7893 },
+    { 23797, 7, 1, 0, 7893 },
+    { 23804, 17, 1, 0, 7893 },
+    { 23821, 16, 1, 0, 7893 },
+    { 23837, 18, 1, 0, 7893 },
+    { 23855, 17, 1, 0, 7893 },
+    { 23872, 18, 1, 0, 7893 },
+    { 23890, 17, 1, 0, 7893 },
+    { 23907, 8, 1, 0, 7893 },
+    { 23915, 16, 1, 0, 7893 },
+    { 23931, 15, 1, 0, 7893 },
+    { 23946, 19, 1, 0, 7893 },
+    { 23965, 18, 1, 0, 7893 },
+    { 23983, 16, 1, 0, 7893 },
+    { 23999, 15, 1, 0, 7893 },
+    { 24014, 18, 1, 0, 7893 },
+    { 24032, 17, 1, 0, 7893 },
+    { 24049, 19, 1, 0, 7893 },
+    { 24068, 18, 1, 0, 7893 },
+    { 24086, 19, 1, 0, 7893 },
+    { 24105, 18, 1, 0, 7893 },
+    { 24123, 15, 1, 0, 7893 },
+    { 24138, 14, 1, 0, 7893 },
+    { 24152, 18, 1, 0, 7893 },
+    { 24170, 17, 1, 0, 7893 },
+    { 24187, 15, 1, 0, 7893 },
+    { 24202, 14, 1, 0, 7893 },
+    { 24216, 17, 1, 0, 7893 },
+    { 24233, 16, 1, 0, 7893 },
+    { 24249, 18, 1, 0, 7893 },
+    { 24267, 17, 1, 0, 7893 },
+    { 24284, 18, 1, 0, 7893 },
+    { 24302, 17, 1, 0, 7893 },
+    { 24319, 16, 1, 0, 7893 },
+    { 24335, 15, 1, 0, 7893 },
+    { 24350, 17, 1, 0, 7893 },
+    { 24367, 16, 1, 0, 7893 },
+    { 24383, 17, 1, 0, 7893 },
+    { 24400, 16, 1, 0, 7893 },
+    { 24416, 6, 1, 0, 7893 },
+    { 24422, 7, 1, 0, 7893 },
+    { 24429, 7, 1, 0, 7893 },
+    { 24436, 2, 1, 0, 7893 },
+    { 24438, 5, 1, 0, 7893 },
+    { 24443, 7, 1, 0, 7893 },
+    { 24450, 2, 1, 0, 7893 },
+    { 24452, 2, 1, 0, 7893 },
+    { 24454, 5, 1, 0, 7893 },
+    { 24459, 3, 1, 0, 7893 },
+    { 24462, 6, 1, 0, 7893 },
+    { 24468, 13, 1, 0, 7893 },
+    { 24481, 12, 1, 0, 7893 },
+    { 24493, 2, 1, 0, 7893 },
+    { 24495, 11, 1, 0, 7893 },
+    { 24506, 10, 1, 0, 7893 },
+    { 24516, 10, 1, 0, 7893 },
+    { 24526, 9, 1, 0, 7893 },
+    { 24535, 11, 1, 0, 7893 },
+    { 24546, 13, 1, 0, 7893 },
+    { 24559, 12, 1, 0, 7893 },
+    { 24571, 10, 1, 0, 7893 },
+    { 24581, 12, 1, 0, 7893 },
+    { 24593, 11, 1, 0, 7893 },
+    { 24604, 12, 1, 0, 7893 },
+    { 24616, 14, 1, 0, 7893 },
+    { 24630, 11, 1, 0, 7893 },
+    { 24641, 12, 1, 0, 7893 },
+    { 24653, 13, 1, 0, 7893 },
+    { 24666, 15, 1, 0, 7893 },
+    { 24681, 12, 1, 0, 7893 },
+    { 24693, 13, 1, 0, 7893 },
+    { 24706, 3, 1, 0, 7893 },
+    { 24709, 6, 1, 0, 7893 },
+    { 24715, 2, 1, 0, 7893 },
+    { 24717, 2, 1, 0, 7893 },
+    { 24719, 3, 1, 0, 7893 },
+    { 24722, 2, 1, 0, 7893 },
+    { 24724, 3, 1, 0, 7893 },
+    { 24727, 6, 1, 0, 7893 },
+    { 24733, 7, 1, 0, 7893 },
+    { 24740, 6, 1, 0, 7893 },
+    { 24746, 8, 1, 0, 7893 },
+    { 24754, 8, 1, 0, 7893 },
+    { 24762, 6, 1, 0, 7893 },
+    { 24768, 2, 1, 0, 7893 },
+    { 24770, 13, 1, 0, 7893 },
+    { 24783, 12, 1, 0, 7893 },
+    { 24795, 7, 1, 0, 7893 },
+    { 24802, 7, 1, 0, 7893 },
+    { 24809, 2, 1, 0, 7893 },
+    { 24811, 2, 1, 0, 7893 },
+    { 24813, 2, 1, 0, 7893 },
+    { 24815, 2, 1, 0, 7893 },
+    { 24817, 22, 1, 0, 7893 },
+    { 24839, 21, 1, 0, 7893 },
+    { 24860, 22, 1, 0, 7893 },
+    { 24882, 19, 1, 0, 7893 },
+    { 24901, 18, 1, 0, 7893 },
+    { 24919, 19, 1, 0, 7893 },
+    { 24938, 18, 1, 0, 7893 },
+    { 24956, 15, 1, 0, 7893 },
+    { 24971, 24, 1, 0, 7893 },
+    { 24995, 23, 1, 0, 7893 },
+    { 25018, 25, 1, 0, 7893 },
+    { 25043, 24, 1, 0, 7893 },
+    { 25067, 24, 1, 0, 7893 },
+    { 25091, 23, 1, 0, 7893 },
+    { 25114, 23, 1, 0, 7893 },
+    { 25137, 22, 1, 0, 7893 },
+    { 25159, 19, 1, 0, 7893 },
+    { 25178, 21, 1, 0, 7893 },
+    { 25199, 18, 1, 0, 7893 },
+    { 25217, 19, 1, 0, 7893 },
+    { 25236, 2, 1, 0, 7893 },
+    { 25238, 3, 1, 0, 7893 },
+    { 25241, 2, 1, 0, 7893 },
+    { 25243, 3, 1, 0, 7893 },
+    { 25246, 3, 1, 0, 7893 },
+    { 25249, 3, 1, 0, 7893 },
+    { 25252, 3, 1, 0, 7893 },
+    { 25255, 3, 1, 0, 7893 },
+    { 25258, 4, 1, 0, 7893 },
+    { 25262, 3, 1, 0, 7893 },
+    { 25265, 3, 1, 0, 7893 },
+    { 25268, 3, 1, 0, 7893 },
+    { 25271, 2, 1, 0, 7893 },
+    { 25273, 2, 1, 0, 7893 },
+    { 25275, 5, 1, 52, 7893 },
+    { 25280, 5, 1, 28, 7945 },
+    { 25285, 5, 1, 0, 7973 },
+    { 25290, 6, 1, 22, 7973 },
+    { 25296, 8, 1, 0, 7995 },
+    { 25304, 8, 1, 0, 7995 },
+    { 25312, 8, 1, 0, 7995 },
+    { 25320, 7, 1, 0, 7995 },
+    { 25327, 6, 1, 0, 7995 },
+    { 25333, 8, 1, 0, 7995 },
+    { 25341, 5, 1, 0, 7995 },
+    { 25346, 3, 1, 0, 7995 },
+    { 25349, 3, 1, 0, 7995 },
+    { 25352, 9, 1, 0, 7995 },
+    { 25361, 3, 1, 0, 7995 },
+    { 25364, 7, 1, 0, 7995 },
+    { 25371, 8, 1, 0, 7995 },
+    { 25379, 5, 1, 0, 7995 },
+    { 25384, 7, 1, 0, 7995 },
+    { 25391, 5, 1, 0, 7995 },
+    { 25396, 5, 1, 58, 7995 },
+    { 25401, 8, 1, 0, 8053 },
+    { 25409, 8, 1, 0, 8053 },
+    { 25417, 5, 1, 0, 8053 },
+    { 25422, 7, 1, 0, 8053 },
+    { 25429, 3, 1, 0, 8053 },
+    { 25432, 4, 1, 0, 8053 },
+    { 25436, 2, 1, 0, 8053 },
+    { 25438, 7, 1, 0, 8053 },
+    { 25445, 8, 1, 0, 8053 },
+    { 25453, 6, 1, 0, 8053 },
+    { 25459, 8, 1, 0, 8053 },
+    { 25467, 3, 1, 0, 8053 },
+    { 25470, 4, 1, 0, 8053 },
+    { 25474, 4, 1, 0, 8053 },
+    { 25478, 6, 1, 0, 8053 },
+    { 25484, 2, 1, 0, 8053 },
+    { 25486, 6, 1, 0, 8053 },
+    { 25492, 5, 1, 22, 8053 },
+    { 25497, 7, 1, 0, 8075 },
+    { 25504, 12, 1, 0, 8075 },
+    { 25516, 3, 1, 0, 8075 },
+    { 25519, 5, 1, 0, 8075 },
+    { 25524, 6, 1, 0, 8075 },
+    { 25530, 4, 1, 0, 8075 },
+    { 25534, 10, 1, 0, 8075 },
+    { 25544, 5, 1, 15, 8075 },
+    { 25549, 7, 1, 63, 8090 },
+    { 25556, 9, 1, 51, 8153 },
+    { 25565, 4, 1, 38, 8204 },
+    { 25569, 10, 1, 0, 8242 },
+    { 25579, 5, 1, 0, 8242 },
+    { 25584, 6, 1, 0, 8242 },
+    { 25590, 2, 1, 0, 8242 },
+    { 25592, 5, 1, 0, 8242 },
+    { 25597, 2, 1, 0, 8242 },
+    { 25599, 7, 1, 0, 8242 },
+    { 25606, 5, 1, 36, 8242 },
+    { 25611, 5, 1, 0, 8278 },
+    { 25616, 11, 1, 0, 8278 },
+    { 25627, 5, 1, 0, 8278 },
+    { 25632, 3, 1, 0, 8278 },
+    { 25635, 4, 1, 0, 8278 },
+    { 25639, 5, 1, 0, 8278 },
+    { 25644, 9, 1, 25, 8278 },
+    { 25653, 8, 1, 142, 8303 },
+    { 25661, 4, 1, 0, 8445 },
+    { 25665, 6, 1, 0, 8445 },
+    { 25671, 5, 1, 46, 8445 },
+    { 25676, 7, 1, 51, 8491 },
+    { 25683, 6, 1, 0, 8542 },
+    { 25689, 8, 1, 19, 8542 },
+    { 25697, 5, 1, 0, 8561 },
+    { 25702, 5, 1, 34, 8561 },
+    { 25707, 9, 1, 0, 8595 },
+    { 25716, 6, 1, 15, 8595 },
+    { 25722, 9, 1, 20, 8610 },
+    { 25731, 8, 1, 30, 8630 },
+    { 25739, 10, 1, 0, 8660 },
+    { 25749, 8, 4, 1, 8660 },
+    { 25757, 8, 1, 0, 8661 },
+    { 25765, 4, 1, 0, 8661 },
+    { 25769, 4, 1, 0, 8661 },
+    { 25773, 10, 4, 1, 8661 },
+    { 25783, 4, 4, 1, 8662 },
+    { 25787, 5, 1, 31, 8663 },
+    { 25792, 8, 1, 23, 8694 },
+    { 25800, 5, 1, 0, 8717 },
+    { 25805, 5, 1, 31, 8717 },
+    { 25810, 2, 1, 0, 8748 },
+    { 25812, 10, 1, 0, 8748 },
+    { 25822, 9, 1, 0, 8748 },
+    { 25831, 10, 1, 0, 8748 },
+    { 25841, 4, 1, 0, 8748 },
+    { 25845, 7, 1, 0, 8748 },
+    { 25852, 8, 1, 0, 8748 },
+    { 25860, 4, 1, 0, 8748 },
+    { 25864, 3, 1, 30, 8748 },
+    { 25867, 6, 1, 32, 8778 },
+    { 25873, 8, 1, 27, 8810 },
+    { 25881, 4, 1, 0, 8837 },
+    { 25885, 4, 1, 0, 8837 },
+    { 25889, 9, 1, 0, 8837 },
+    { 25898, 3, 1, 0, 8837 },
+    { 25901, 6, 1, 75, 8837 },
+    { 25907, 8, 1, 22, 8912 },
+    { 25915, 6, 4, 1, 8934 },
+    { 25921, 7, 1, 0, 8935 },
+    { 25928, 4, 1, 38, 8935 },
+    { 25932, 2, 1, 2, 8973 },
+    { 25934, 7, 1, 34, 8975 },
+    { 25941, 6, 1, 0, 9009 },
+    { 25947, 7, 1, 0, 9009 },
+    { 25954, 4, 1, 0, 9009 },
+    { 25958, 4, 1, 19, 9009 },
+    { 25962, 7, 1, 26, 9028 },
+    { 25969, 7, 1, 42, 9054 },
+    { 25976, 4, 1, 0, 9096 },
+    { 25980, 2, 1, 0, 9096 },
+    { 25982, 5, 1, 50, 9096 },
+    { 25987, 8, 1, 0, 9146 },
+    { 25995, 8, 1, 0, 9146 },
+    { 26003, 6, 1, 0, 9146 },
+    { 26009, 6, 1, 0, 9146 },
+    { 26015, 5, 1, 0, 9146 },
+    { 26020, 6, 1, 0, 9146 },
+    { 26026, 5, 1, 0, 9146 },
+    { 26031, 7, 1, 0, 9146 },
+    { 26038, 6, 1, 0, 9146 },
+    { 26044, 5, 1, 0, 9146 },
+    { 26049, 4, 1, 0, 9146 },
+    { 26053, 8, 1, 0, 9146 },
+    { 26061, 3, 1, 0, 9146 },
+    { 26064, 8, 1, 0, 9146 },
+    { 26072, 9, 1, 0, 9146 },
+    { 26081, 6, 1, 0, 9146 },
+    { 26087, 4, 1, 26, 9146 },
+    { 26091, 7, 1, 69, 9172 },
+    { 26098, 7, 4, 1, 9241 },
+    { 26105, 9, 1, 0, 9242 },
+    { 26114, 6, 1, 0, 9242 },
+    { 26120, 6, 4, 1, 9242 },
+    { 26126, 5, 1, 23, 9243 },
+    { 26131, 7, 1, 23, 9266 },
+    { 26138, 8, 1, 36, 9289 },
+    { 26146, 5, 1, 0, 9325 },
+    { 26151, 8, 1, 0, 9325 },
+    { 26159, 3, 1, 0, 9325 },
+    { 26162, 8, 1, 0, 9325 },
+    { 26170, 9, 1, 0, 9325 },
+    { 26179, 7, 1, 0, 9325 },
+    { 26186, 5, 1, 0, 9325 },
+    { 26191, 7, 1, 31, 9325 },
+    { 26198, 9, 1, 17, 9356 },
+    { 26207, 5, 1, 57, 9373 },
+    { 26212, 8, 1, 0, 9430 },
+    { 26220, 7, 1, 13, 9430 },
+    { 26227, 6, 1, 24, 9443 },
+    { 26233, 5, 1, 0, 9467 },
+    { 26238, 5, 1, 0, 9467 },
+    { 26243, 11, 1, 0, 9467 },
+    { 26254, 6, 1, 0, 9467 },
+    { 26260, 5, 1, 0, 9467 },
+    { 26265, 6, 1, 0, 9467 },
+    { 26271, 6, 1, 0, 9467 },
+    { 26277, 8, 1, 29, 9467 },
+    { 26285, 6, 1, 0, 9496 },
+    { 26291, 7, 1, 0, 9496 },
+    { 26298, 9, 1, 0, 9496 },
+    { 26307, 13, 1, 0, 9496 },
+    { 26320, 9, 1, 0, 9496 },
+    { 26329, 11, 1, 0, 9496 },
+    { 26340, 11, 1, 0, 9496 },
+    { 26351, 11, 1, 0, 9496 },
+    { 26362, 11, 1, 0, 9496 },
+    { 26373, 11, 1, 0, 9496 },
+    { 26384, 11, 1, 0, 9496 },
+    { 26395, 9, 1, 0, 9496 },
+    { 26404, 11, 1, 0, 9496 },
+    { 26415, 11, 1, 0, 9496 },
+    { 26426, 11, 1, 0, 9496 },
+    { 26437, 10, 1, 0, 9496 },
+    { 26447, 10, 1, 0, 9496 },
+    { 26457, 12, 1, 0, 9496 },
+    { 26469, 11, 1, 0, 9496 },
+    { 26480, 10, 1, 0, 9496 },
+    { 26490, 10, 1, 0, 9496 },
+    { 26500, 14, 1, 0, 9496 },
+    { 26514, 14, 1, 0, 9496 },
+    { 26528, 10, 1, 0, 9496 },
+    { 26538, 10, 1, 0, 9496 },
+    { 26548, 11, 1, 0, 9496 },
+    { 26559, 11, 1, 0, 9496 },
+    { 26570, 11, 1, 0, 9496 },
+    { 26581, 11, 1, 0, 9496 },
+    { 26592, 10, 1, 0, 9496 },
+    { 26602, 11, 1, 0, 9496 },
+    { 26613, 10, 1, 0, 9496 },
+    { 26623, 10, 1, 0, 9496 },
+    { 26633, 10, 1, 0, 9496 },
+    { 26643, 11, 1, 0, 9496 },
+    { 26654, 11, 1, 0, 9496 },
+    { 26665, 14, 1, 0, 9496 },
+    { 26679, 11, 1, 0, 9496 },
+    { 26690, 11, 1, 0, 9496 },
+    { 26701, 11, 1, 0, 9496 },
+    { 26712, 10, 1, 0, 9496 },
+    { 26722, 9, 1, 0, 9496 },
+    { 26731, 10, 1, 0, 9496 },
+    { 26741, 10, 1, 0, 9496 },
+    { 26751, 11, 1, 0, 9496 },
+    { 26762, 11, 1, 0, 9496 },
+    { 26773, 10, 1, 0, 9496 },
+    { 26783, 11, 1, 0, 9496 },
+    { 26794, 11, 1, 0, 9496 },
+    { 26805, 11, 1, 0, 9496 },
+    { 26816, 8, 1, 34, 9496 },
+    { 26824, 9, 1, 16, 9530 },
+    { 26833, 9, 1, 28, 9546 },
+    { 26842, 8, 4, 1, 9574 },
+    { 26850, 6, 1, 0, 9575 },
+    { 26856, 6, 1, 0, 9575 },
+    { 26862, 6, 1, 0, 9575 },
+    { 26868, 6, 1, 0, 9575 },
+    { 26874, 6, 1, 0, 9575 },
+    { 26880, 9, 1, 0, 9575 },
+    { 26889, 6, 1, 0, 9575 },
+    { 26895, 9, 1, 0, 9575 },
+    { 26904, 6, 1, 0, 9575 },
+    { 26910, 6, 1, 0, 9575 },
+    { 26916, 6, 1, 0, 9575 },
+    { 26922, 6, 1, 0, 9575 },
+    { 26928, 6, 1, 0, 9575 },
+    { 26934, 6, 1, 0, 9575 },
+    { 26940, 6, 1, 0, 9575 },
+    { 26946, 6, 1, 0, 9575 },
+    { 26952, 6, 1, 0, 9575 },
+    { 26958, 6, 1, 0, 9575 },
+    { 26964, 6, 1, 0, 9575 },
+    { 26970, 6, 1, 0, 9575 },
+    { 26976, 6, 1, 0, 9575 },
+    { 26982, 6, 1, 0, 9575 },
+    { 26988, 6, 1, 0, 9575 },
+    { 26994, 6, 1, 0, 9575 },
+    { 27000, 6, 1, 0, 9575 },
+    { 27006, 6, 1, 0, 9575 },
+    { 27012, 6, 1, 0, 9575 },
+    { 27018, 6, 1, 0, 9575 },
+    { 27024, 6, 1, 0, 9575 },
+    { 27030, 6, 1, 0, 9575 },
+    { 27036, 6, 1, 0, 9575 },
+    { 27042, 6, 1, 0, 9575 },
+    { 27048, 6, 1, 0, 9575 },
+    { 27054, 9, 1, 0, 9575 },
+    { 27063, 6, 1, 0, 9575 },
+    { 27069, 6, 1, 0, 9575 },
+    { 27075, 6, 1, 0, 9575 },
+    { 27081, 6, 1, 0, 9575 },
+    { 27087, 6, 1, 0, 9575 },
+    { 27093, 6, 1, 0, 9575 },
+    { 27099, 6, 1, 0, 9575 },
+    { 27105, 6, 1, 0, 9575 },
+    { 27111, 6, 1, 0, 9575 },
+    { 27117, 6, 1, 0, 9575 },
+    { 27123, 6, 1, 0, 9575 },
+    { 27129, 6, 1, 0, 9575 },
+    { 27135, 6, 1, 0, 9575 },
+    { 27141, 9, 1, 0, 9575 },
+    { 27150, 2, 1, 0, 9575 },
+    { 27152, 2, 1, 1, 9575 },
+    { 27154, 2, 1, 0, 9576 },
+    { 27156, 4, 1, 0, 9576 },
+    { 27160, 2, 1, 0, 9576 },
+    { 27162, 4, 1, 0, 9576 },
+    { 27166, 2, 1, 0, 9576 },
+    { 27168, 2, 1, 0, 9576 },
+    { 27170, 2, 1, 0, 9576 },
+    { 27172, 4, 1, 0, 9576 },
+    { 27176, 3, 1, 0, 9576 },
+    { 27179, 3, 1, 0, 9576 },
+    { 27182, 3, 1, 0, 9576 },
+    { 27185, 2, 1, 0, 9576 },
+    { 27187, 2, 1, 0, 9576 },
+    { 27189, 3, 1, 0, 9576 },
+    { 27192, 3, 1, 0, 9576 },
+    { 27195, 3, 1, 0, 9576 },
+    { 27198, 2, 1, 0, 9576 },
+    { 27200, 2, 1, 0, 9576 },
+    { 27202, 2, 1, 0, 9576 },
+    { 27204, 3, 1, 0, 9576 },
+    { 27207, 3, 1, 0, 9576 },
+    { 27210, 3, 1, 0, 9576 },
+    { 27213, 3, 1, 0, 9576 },
+    { 27216, 4, 1, 0, 9576 },
+    { 27220, 3, 1, 0, 9576 },
+    { 27223, 3, 1, 0, 9576 },
+    { 27226, 3, 1, 0, 9576 },
+    { 27229, 4, 1, 0, 9576 },
+    { 27233, 3, 1, 0, 9576 },
+    { 27236, 4, 1, 0, 9576 },
+    { 27240, 3, 1, 0, 9576 },
+    { 27243, 4, 1, 0, 9576 },
+    { 27247, 3, 1, 0, 9576 },
+    { 27250, 7, 1, 0, 9576 },
+    { 27257, 3, 1, 0, 9576 },
+    { 27260, 3, 1, 0, 9576 },
+    { 27263, 8, 1, 0, 9576 },
+    { 27271, 3, 1, 0, 9576 },
+    { 27274, 11, 1, 0, 9576 },
+    { 27285, 3, 1, 0, 9576 },
+    { 27288, 6, 1, 0, 9576 },
+    { 27294, 2, 1, 0, 9576 },
+    { 27296, 11, 1, 0, 9576 },
+    { 27307, 3, 1, 0, 9576 },
+    { 27310, 3, 1, 0, 9576 },
+    { 27313, 3, 1, 0, 9576 },
+    { 27316, 3, 1, 0, 9576 },
+    { 27319, 3, 1, 0, 9576 },
+    { 27322, 3, 1, 0, 9576 },
+    { 27325, 3, 1, 0, 9576 },
+    { 27328, 3, 1, 0, 9576 },
+    { 27331, 3, 1, 0, 9576 },
+    { 27334, 3, 1, 0, 9576 },
+    { 27337, 2, 1, 0, 9576 },
+    { 27339, 8, 1, 0, 9576 },
+    { 27347, 5, 1, 0, 9576 },
+    { 27352, 8, 1, 0, 9576 },
+    { 27360, 8, 1, 0, 9576 },
+    { 27368, 2, 1, 0, 9576 },
+    { 27370, 5, 1, 0, 9576 },
+    { 27375, 7, 1, 0, 9576 },
+    { 27382, 2, 1, 0, 9576 },
+    { 27384, 7, 1, 0, 9576 },
+    { 27391, 2, 1, 0, 9576 },
+    { 27393, 7, 1, 0, 9576 },
+    { 27400, 9, 1, 0, 9576 },
+    { 27409, 8, 1, 0, 9576 },
+    { 27417, 9, 1, 0, 9576 },
+    { 27426, 2, 1, 0, 9576 },
+    { 27428, 7, 1, 0, 9576 },
+    { 27435, 4, 1, 0, 9576 },
+    { 27439, 7, 1, 0, 9576 },
+    { 27446, 7, 1, 0, 9576 },
+    { 27453, 2, 1, 0, 9576 },
+    { 27455, 3, 1, 0, 9576 },
+    { 27458, 2, 1, 0, 9576 },
+    { 27460, 2, 1, 0, 9576 },
+    { 27462, 2, 1, 0, 9576 },
+    { 27464, 2, 1, 0, 9576 },
+    { 27466, 2, 1, 0, 9576 },
+    { 27468, 2, 1, 0, 9576 },
+    { 27470, 5, 1, 0, 9576 },
+    { 27475, 5, 1, 0, 9576 },
+    { 27480, 2, 1, 0, 9576 },
+    { 27482, 3, 1, 0, 9576 },
+    { 27485, 3, 1, 0, 9576 },
+    { 27488, 3, 1, 0, 9576 },
+    { 27491, 3, 1, 0, 9576 },
+    { 27494, 3, 1, 0, 9576 },
+    { 27497, 3, 1, 0, 9576 },
+    { 27500, 3, 1, 0, 9576 },
+    { 27503, 3, 1, 0, 9576 },
+    { 27506, 3, 1, 0, 9576 },
+    { 27509, 3, 1, 0, 9576 },
+    { 27512, 3, 1, 0, 9576 },
+    { 27515, 3, 1, 0, 9576 },
+    { 27518, 3, 1, 0, 9576 },
+    { 27521, 3, 1, 0, 9576 },
+    { 27524, 3, 1, 0, 9576 },
+    { 27527, 6, 1, 0, 9576 },
+    { 27533, 11, 0, 1, 9576 },
+    { 27544, 3, 1, 0, 9577 },
+    { 27547, 3, 1, 0, 9577 },
+    { 27550, 3, 1, 0, 9577 },
+    { 27553, 3, 1, 0, 9577 },
+    { 27556, 1, 1, 0, 9577 },
+    { 27557, 3, 1, 0, 9577 },
+    { 27560, 3, 1, 0, 9577 },
+    { 27563, 3, 1, 0, 9577 },
+    { 27566, 4, 1, 0, 9577 },
+    { 27570, 3, 1, 0, 9577 },
+    { 27573, 3, 1, 0, 9577 },
+    { 27576, 3, 1, 0, 9577 },
+    { 27579, 3, 1, 0, 9577 },
+    { 27582, 6, 1, 2, 9577 },
+    { 27588, 3, 1, 0, 9579 },
+    { 27591, 3, 1, 0, 9579 },
+    { 27594, 3, 1, 0, 9579 },
+    { 27597, 3, 1, 0, 9579 },
+    { 27600, 3, 1, 0, 9579 },
+    { 27603, 2, 1, 0, 9579 },
+    { 27605, 3, 1, 0, 9579 },
+    { 27608, 3, 1, 0, 9579 },
+    { 27611, 3, 1, 0, 9579 },
+    { 27614, 3, 1, 0, 9579 },
+    { 27617, 3, 1, 0, 9579 },
+    { 27620, 2, 1, 0, 9579 },
+    { 27622, 8, 1, 0, 9579 },
+    { 27630, 3, 1, 0, 9579 },
+    { 27633, 4, 1, 0, 9579 },
+    { 27637, 4, 4, 0, 9579 },
+    { 27641, 5, 1, 0, 9579 },
+    { 27646, 3, 1, 0, 9579 },
+    { 27649, 2, 1, 0, 9579 },
+    { 27651, 4, 1, 0, 9579 },
+    { 27655, 3, 1, 0, 9579 },
+    { 27658, 3, 1, 0, 9579 },
+    { 27661, 3, 1, 0, 9579 },
+    { 27664, 3, 1, 0, 9579 },
+    { 27667, 5, 1, 0, 9579 },
+    { 27672, 3, 1, 0, 9579 },
+    { 27675, 3, 1, 0, 9579 },
+    { 27678, 3, 1, 0, 9579 },
+    { 27681, 3, 1, 0, 9579 },
+    { 27684, 3, 1, 0, 9579 },
+    { 27687, 3, 1, 0, 9579 },
+    { 27690, 3, 1, 0, 9579 },
+    { 27693, 3, 1, 0, 9579 },
+    { 27696, 3, 1, 0, 9579 },
+    { 27699, 3, 1, 0, 9579 },
+    { 27702, 3, 1, 0, 9579 },
+    { 27705, 3, 1, 0, 9579 },
+    { 27708, 3, 1, 0, 9579 },
+    { 27711, 3, 1, 0, 9579 },
+    { 27714, 2, 1, 0, 9579 },
+    { 27716, 3, 1, 0, 9579 },
+    { 27719, 2, 1, 0, 9579 },
+    { 27721, 2, 1, 0, 9579 },
+    { 27723, 3, 1, 0, 9579 },
+    { 27726, 3, 1, 0, 9579 },
+    { 27729, 4, 1, 0, 9579 },
+    { 27733, 3, 1, 0, 9579 },
+    { 27736, 3, 1, 0, 9579 },
+    { 27739, 2, 1, 0, 9579 },
+    { 27741, 8, 1, 0, 9579 },
+    { 27749, 3, 1, 0, 9579 },
+    { 27752, 10, 1, 0, 9579 },
+    { 27762, 8, 1, 0, 9579 },
+    { 27770, 3, 1, 0, 9579 },
+    { 27773, 3, 1, 0, 9579 },
+    { 27776, 4, 1, 0, 9579 },
+    { 27780, 3, 1, 0, 9579 },
+    { 27783, 3, 1, 0, 9579 },
+    { 27786, 2, 1, 0, 9579 },
+    { 27788, 3, 1, 0, 9579 },
+    { 27791, 3, 1, 0, 9579 },
+    { 27794, 3, 1, 0, 9579 },
+    { 27797, 3, 1, 0, 9579 },
+    { 27800, 3, 1, 0, 9579 },
+    { 27803, 3, 1, 0, 9579 },
+    { 27806, 2, 1, 0, 9579 },
+    { 27808, 3, 1, 0, 9579 },
+    { 27811, 3, 1, 0, 9579 },
+    { 27814, 3, 1, 0, 9579 },
+    { 27817, 3, 1, 0, 9579 },
+    { 27820, 3, 1, 0, 9579 },
+    { 27823, 2, 1, 0, 9579 },
+    { 27825, 2, 1, 0, 9579 },
+    { 27827, 3, 1, 0, 9579 },
+    { 27830, 3, 1, 0, 9579 },
+    { 27833, 3, 1, 0, 9579 },
+    { 27836, 5, 1, 0, 9579 },
+    { 27841, 6, 1, 0, 9579 },
+    { 27847, 4, 1, 0, 9579 },
+    { 27851, 2, 1, 0, 9579 },
+    { 27853, 2, 1, 0, 9579 },
+    { 27855, 8, 1, 0, 9579 },
+    { 27863, 2, 1, 0, 9579 },
+    { 27865, 2, 1, 0, 9579 },
+    { 27867, 2, 1, 0, 9579 },
+    { 27869, 2, 1, 0, 9579 },
+    { 27871, 5, 1, 0, 9579 },
+    { 27876, 8, 1, 0, 9579 },
+    { 27884, 3, 1, 0, 9579 },
+    { 27887, 2, 1, 0, 9579 },
+    { 27889, 6, 1, 1, 9579 },
+    { 27895, 4, 1, 0, 9580 },
+    { 27899, 11, 1, 0, 9580 },
+    { 27910, 6, 1, 0, 9580 },
+    { 27916, 7, 1, 0, 9580 },
+    { 27923, 9, 1, 0, 9580 },
+    { 27932, 3, 1, 0, 9580 },
+    { 27935, 8, 1, 0, 9580 },
+    { 27943, 11, 1, 0, 9580 },
+    { 27954, 11, 1, 0, 9580 },
+    { 27965, 11, 1, 0, 9580 },
+    { 27976, 11, 1, 0, 9580 },
+    { 27987, 11, 1, 0, 9580 },
+    { 27998, 11, 1, 0, 9580 },
+    { 28009, 6, 1, 0, 9580 },
+    { 28015, 3, 1, 0, 9580 },
+    { 28018, 5, 1, 0, 9580 },
+    { 28023, 4, 1, 0, 9580 },
+    { 28027, 3, 1, 0, 9580 },
+    { 28030, 7, 1, 0, 9580 },
+    { 28037, 6, 1, 0, 9580 },
+    { 28043, 5, 1, 0, 9580 },
+    { 28048, 4, 1, 0, 9580 },
+    { 28052, 4, 1, 0, 9580 },
+    { 28056, 3, 1, 0, 9580 },
+    { 28059, 6, 1, 0, 9580 },
+    { 28065, 4, 1, 0, 9580 },
+    { 28069, 3, 1, 0, 9580 },
+    { 28072, 4, 1, 0, 9580 },
+    { 28076, 7, 1, 0, 9580 },
+    { 28083, 9, 1, 0, 9580 },
+    { 28092, 8, 1, 0, 9580 },
+    { 28100, 4, 1, 0, 9580 },
+    { 28104, 7, 0, 1, 9580 },
+    { 28111, 3, 1, 0, 9581 },
+    { 28114, 6, 1, 0, 9581 },
+    { 28120, 8, 1, 0, 9581 },
+    { 28128, 5, 1, 0, 9581 },
+    { 28133, 6, 1, 0, 9581 },
+    { 28139, 5, 1, 0, 9581 },
+    { 28144, 2, 1, 0, 9581 },
+    { 28146, 3, 1, 0, 9581 },
+    { 28149, 3, 1, 0, 9581 },
+    { 28152, 3, 1, 0, 9581 },
+    { 28155, 3, 1, 0, 9581 },
+    { 28158, 3, 1, 0, 9581 },
+    { 28161, 3, 1, 0, 9581 },
+    { 28164, 3, 1, 0, 9581 },
+    { 28167, 2, 1, 0, 9581 },
+    { 28169, 8, 1, 0, 9581 },
+    { 28177, 3, 1, 0, 9581 },
+    { 28180, 3, 1, 0, 9581 },
+    { 28183, 3, 1, 0, 9581 },
+    { 28186, 3, 1, 0, 9581 },
+    { 28189, 4, 1, 0, 9581 },
+    { 28193, 3, 1, 0, 9581 },
+    { 28196, 3, 1, 0, 9581 },
+    { 28199, 3, 1, 0, 9581 },
+    { 28202, 3, 1, 0, 9581 },
+    { 28205, 4, 1, 0, 9581 },
+    { 28209, 3, 1, 0, 9581 },
+    { 28212, 3, 1, 0, 9581 },
+    { 28215, 3, 1, 0, 9581 },
+    { 28218, 6, 1, 0, 9581 },
+    { 28224, 3, 1, 0, 9581 },
+    { 28227, 3, 1, 0, 9581 },
+    { 28230, 3, 1, 0, 9581 },
+    { 28233, 3, 1, 0, 9581 },
+    { 28236, 3, 1, 0, 9581 },
+    { 28239, 3, 1, 0, 9581 },
+    { 28242, 3, 1, 0, 9581 },
+    { 28245, 3, 1, 0, 9581 },
+    { 28248, 3, 1, 0, 9581 },
+    { 28251, 5, 1, 0, 9581 },
+    { 28256, 7, 1, 0, 9581 },
+    { 28263, 2, 1, 0, 9581 },
+    { 28265, 8, 1, 0, 9581 },
+    { 28273, 3, 1, 0, 9581 },
+    { 28276, 3, 1, 0, 9581 },
+    { 28279, 3, 1, 0, 9581 },
+    { 28282, 3, 1, 0, 9581 },
+    { 28285, 3, 1, 0, 9581 },
+    { 28288, 8, 1, 0, 9581 },
+    { 28296, 3, 1, 0, 9581 },
+    { 28299, 3, 1, 0, 9581 },
+    { 28302, 3, 1, 1, 9581 },
+    { 28305, 3, 1, 0, 9582 },
+    { 28308, 3, 1, 0, 9582 },
+    { 28311, 3, 1, 0, 9582 },
+    { 28314, 2, 1, 0, 9582 },
+    { 28316, 2, 1, 0, 9582 },
+    { 28318, 3, 1, 0, 9582 },
+    { 28321, 3, 1, 0, 9582 },
+    { 28324, 3, 1, 0, 9582 },
+    { 28327, 2, 1, 0, 9582 },
+    { 28329, 3, 1, 0, 9582 },
+    { 28332, 7, 1, 0, 9582 },
+    { 28339, 11, 1, 0, 9582 },
+    { 28350, 3, 1, 0, 9582 },
+    { 28353, 8, 1, 0, 9582 },
+    { 28361, 7, 1, 0, 9582 },
+    { 28368, 6, 1, 0, 9582 },
+    { 28374, 5, 1, 0, 9582 },
+    { 28379, 9, 1, 0, 9582 },
+    { 28388, 8, 1, 0, 9582 },
+    { 28396, 9, 1, 0, 9582 },
+    { 28405, 16, 1, 0, 9582 },
+    { 28421, 11, 1, 0, 9582 },
+    { 28432, 9, 1, 0, 9582 },
+    { 28441, 3, 1, 0, 9582 },
+    { 28444, 9, 1, 0, 9582 },
+    { 28453, 6, 1, 0, 9582 },
+    { 28459, 12, 1, 0, 9582 },
+    { 28471, 8, 1, 0, 9582 },
+    { 28479, 8, 1, 0, 9582 },
+    { 28487, 9, 1, 0, 9582 },
+    { 28496, 14, 1, 0, 9582 },
+    { 28510, 11, 1, 0, 9582 },
+    { 28521, 12, 1, 0, 9582 },
+    { 28533, 3, 1, 0, 9582 },
+    { 28536, 12, 1, 0, 9582 },
+    { 28548, 9, 1, 0, 9582 },
+    { 28557, 7, 1, 0, 9582 },
+    { 28564, 12, 1, 0, 9582 },
+    { 28576, 10, 1, 0, 9582 },
+    { 28586, 4, 1, 0, 9582 },
+    { 28590, 13, 1, 0, 9582 },
+    { 28603, 8, 1, 0, 9582 },
+    { 28611, 13, 1, 0, 9582 },
+    { 28624, 6, 1, 0, 9582 },
+    { 28630, 11, 1, 0, 9582 },
+    { 28641, 9, 1, 0, 9582 },
+    { 28650, 7, 1, 0, 9582 },
+    { 28657, 6, 1, 0, 9582 },
+    { 28663, 9, 1, 0, 9582 },
+    { 28672, 10, 1, 0, 9582 },
+    { 28682, 8, 1, 0, 9582 },
+    { 28690, 4, 1, 0, 9582 },
+    { 28694, 7, 1, 0, 9582 },
+    { 28701, 7, 1, 0, 9582 },
+    { 28708, 4, 1, 0, 9582 },
+    { 28712, 4, 1, 0, 9582 },
+    { 28716, 9, 1, 0, 9582 },
+    { 28725, 9, 1, 0, 9582 },
+    { 28734, 8, 1, 0, 9582 },
+    { 28742, 5, 1, 0, 9582 },
+    { 28747, 5, 1, 0, 9582 },
+    { 28752, 6, 1, 0, 9582 },
+    { 28758, 9, 1, 0, 9582 },
+    { 28767, 13, 1, 0, 9582 },
+    { 28780, 8, 1, 0, 9582 },
+    { 28788, 7, 1, 0, 9582 },
+    { 28795, 8, 1, 0, 9582 },
+    { 28803, 6, 1, 0, 9582 },
+    { 28809, 4, 1, 0, 9582 },
+    { 28813, 5, 1, 0, 9582 },
+    { 28818, 6, 1, 0, 9582 },
+    { 28824, 4, 1, 0, 9582 },
+    { 28828, 7, 1, 0, 9582 },
+    { 28835, 10, 1, 0, 9582 },
+    { 28845, 4, 1, 0, 9582 },
+    { 28849, 6, 1, 0, 9582 },
+    { 28855, 9, 1, 0, 9582 },
+    { 28864, 15, 1, 0, 9582 },
+    { 28879, 13, 1, 0, 9582 },
+    { 28892, 6, 1, 0, 9582 },
+    { 28898, 16, 1, 0, 9582 },
+    { 28914, 6, 1, 0, 9582 },
+    { 28920, 7, 1, 0, 9582 },
+    { 28927, 7, 1, 0, 9582 },
+    { 28934, 15, 1, 0, 9582 },
+    { 28949, 9, 1, 0, 9582 },
+    { 28958, 6, 1, 0, 9582 },
+    { 28964, 7, 1, 0, 9582 },
+    { 28971, 8, 1, 0, 9582 },
+    { 28979, 9, 1, 0, 9582 },
+    { 28988, 8, 1, 0, 9582 },
+    { 28996, 7, 1, 0, 9582 },
+    { 29003, 3, 1, 0, 9582 },
+    { 29006, 6, 1, 0, 9582 },
+    { 29012, 8, 1, 0, 9582 },
+    { 29020, 10, 1, 0, 9582 },
+    { 29030, 9, 1, 0, 9582 },
+    { 29039, 3, 1, 0, 9582 },
+    { 29042, 6, 1, 0, 9582 },
+    { 29048, 10, 1, 0, 9582 },
+    { 29058, 7, 1, 0, 9582 },
+    { 29065, 10, 1, 0, 9582 },
+    { 29075, 14, 1, 0, 9582 },
+    { 29089, 6, 1, 0, 9582 },
+    { 29095, 7, 1, 0, 9582 },
+    { 29102, 6, 1, 0, 9582 },
+    { 29108, 6, 1, 0, 9582 },
+    { 29114, 11, 1, 0, 9582 },
+    { 29125, 10, 1, 0, 9582 },
+    { 29135, 13, 1, 0, 9582 },
+    { 29148, 7, 1, 0, 9582 },
+    { 29155, 8, 1, 0, 9582 },
+    { 29163, 9, 1, 0, 9582 },
+    { 29172, 15, 1, 0, 9582 },
+    { 29187, 12, 1, 0, 9582 },
+    { 29199, 9, 1, 0, 9582 },
+    { 29208, 14, 1, 0, 9582 },
+    { 29222, 10, 1, 0, 9582 },
+    { 29232, 6, 1, 0, 9582 },
+    { 29238, 6, 1, 0, 9582 },
+    { 29244, 12, 1, 0, 9582 },
+    { 29256, 12, 1, 0, 9582 },
+    { 29268, 8, 1, 0, 9582 },
+    { 29276, 7, 1, 0, 9582 },
+    { 29283, 5, 1, 0, 9582 },
+    { 29288, 4, 1, 0, 9582 },
+    { 29292, 14, 1, 0, 9582 },
+    { 29306, 4, 1, 0, 9582 },
+    { 29310, 7, 1, 0, 9582 },
+    { 29317, 10, 1, 0, 9582 },
+    { 29327, 20, 1, 0, 9582 },
+    { 29347, 15, 1, 0, 9582 },
+    { 29362, 8, 1, 0, 9582 },
+    { 29370, 8, 1, 0, 9582 },
+    { 29378, 13, 1, 0, 9582 },
+    { 29391, 14, 1, 0, 9582 },
+    { 29405, 9, 1, 0, 9582 },
+    { 29414, 8, 1, 0, 9582 },
+    { 29422, 15, 1, 0, 9582 },
+    { 29437, 14, 1, 0, 9582 },
+    { 29451, 12, 1, 0, 9582 },
+    { 29463, 15, 1, 0, 9582 },
+    { 29478, 7, 1, 0, 9582 },
+    { 29485, 10, 1, 0, 9582 },
+    { 29495, 11, 1, 0, 9582 },
+    { 29506, 29, 1, 0, 9582 },
+    { 29535, 8, 1, 0, 9582 },
+    { 29543, 7, 1, 0, 9582 },
+    { 29550, 13, 1, 0, 9582 },
+    { 29563, 6, 1, 0, 9582 },
+    { 29569, 6, 1, 0, 9582 },
+    { 29575, 9, 1, 0, 9582 },
+    { 29584, 8, 1, 0, 9582 },
+    { 29592, 8, 1, 0, 9582 },
+    { 29600, 14, 1, 0, 9582 },
+    { 29614, 7, 1, 0, 9582 },
+    { 29621, 5, 1, 0, 9582 },
+    { 29626, 5, 1, 0, 9582 },
+    { 29631, 4, 1, 0, 9582 },
+    { 29635, 6, 1, 0, 9582 },
+    { 29641, 8, 1, 0, 9582 },
+    { 29649, 3, 1, 0, 9582 },
+    { 29652, 14, 1, 0, 9582 },
+    { 29666, 8, 1, 0, 9582 },
+    { 29674, 11, 1, 0, 9582 },
+    { 29685, 7, 1, 0, 9582 },
+    { 29692, 5, 1, 0, 9582 },
+    { 29697, 6, 1, 0, 9582 },
+    { 29703, 7, 1, 0, 9582 },
+    { 29710, 8, 1, 0, 9582 },
+    { 29718, 9, 1, 0, 9582 },
+    { 29727, 5, 1, 0, 9582 },
+    { 29732, 8, 1, 0, 9582 },
+    { 29740, 6, 1, 0, 9582 },
+    { 29746, 10, 1, 0, 9582 },
+    { 29756, 9, 1, 0, 9582 },
+    { 29765, 9, 1, 0, 9582 },
+    { 29774, 11, 1, 0, 9582 },
+    { 29785, 8, 1, 0, 9582 },
+    { 29793, 9, 1, 0, 9582 },
+    { 29802, 6, 1, 0, 9582 },
+    { 29808, 10, 1, 0, 9582 },
+    { 29818, 10, 1, 0, 9582 },
+    { 29828, 12, 1, 0, 9582 },
+    { 29840, 7, 1, 0, 9582 },
+    { 29847, 10, 1, 0, 9582 },
+    { 29857, 11, 1, 0, 9582 },
+    { 29868, 25, 1, 0, 9582 },
+    { 29893, 8, 1, 0, 9582 },
+    { 29901, 5, 1, 0, 9582 },
+    { 29906, 6, 1, 0, 9582 },
+    { 29912, 9, 1, 0, 9582 },
+    { 29921, 6, 1, 0, 9582 },
+    { 29927, 10, 1, 0, 9582 },
+    { 29937, 6, 1, 0, 9582 },
+    { 29943, 4, 1, 0, 9582 },
+    { 29947, 13, 1, 0, 9582 },
+    { 29960, 7, 1, 0, 9582 },
+    { 29967, 9, 1, 0, 9582 },
+    { 29976, 5, 1, 0, 9582 },
+    { 29981, 8, 1, 0, 9582 },
+    { 29989, 9, 1, 0, 9582 },
+    { 29998, 4, 1, 0, 9582 },
+    { 30002, 7, 1, 0, 9582 },
+    { 30009, 8, 1, 0, 9582 },
+    { 30017, 7, 1, 0, 9582 },
+    { 30024, 8, 1, 0, 9582 },
+    { 30032, 7, 1, 0, 9582 },
+    { 30039, 5, 1, 0, 9582 },
+    { 30044, 12, 1, 0, 9582 },
+    { 30056, 9, 1, 0, 9582 },
+    { 30065, 10, 1, 0, 9582 },
+    { 30075, 9, 1, 0, 9582 },
+    { 30084, 9, 1, 0, 9582 },
+    { 30093, 12, 1, 0, 9582 },
+    { 30105, 11, 1, 0, 9582 },
+    { 30116, 8, 1, 0, 9582 },
+    { 30124, 8, 1, 0, 9582 },
+    { 30132, 4, 1, 0, 9582 },
+    { 30136, 8, 1, 0, 9582 },
+    { 30144, 9, 1, 0, 9582 },
+    { 30153, 7, 1, 0, 9582 },
+    { 30160, 6, 1, 0, 9582 },
+    { 30166, 7, 1, 0, 9582 },
+    { 30173, 9, 1, 0, 9582 },
+    { 30182, 11, 1, 0, 9582 },
+    { 30193, 7, 1, 0, 9582 },
+    { 30200, 7, 1, 0, 9582 },
+    { 30207, 7, 1, 0, 9582 },
+    { 30214, 4, 1, 0, 9582 },
+    { 30218, 5, 1, 0, 9582 },
+    { 30223, 5, 1, 0, 9582 },
+    { 30228, 11, 1, 0, 9582 },
+    { 30239, 4, 1, 0, 9582 },
+    { 30243, 8, 1, 0, 9582 },
+    { 30251, 10, 1, 0, 9582 },
+    { 30261, 7, 1, 0, 9582 },
+    { 30268, 7, 1, 0, 9582 },
+    { 30275, 18, 1, 0, 9582 },
+    { 30293, 6, 1, 0, 9582 },
+    { 30299, 6, 1, 0, 9582 },
+    { 30305, 14, 1, 0, 9582 },
+    { 30319, 6, 1, 0, 9582 },
+    { 30325, 8, 1, 0, 9582 },
+    { 30333, 15, 1, 0, 9582 },
+    { 30348, 8, 1, 0, 9582 },
+    { 30356, 8, 1, 0, 9582 },
+    { 30364, 10, 1, 0, 9582 },
+    { 30374, 17, 1, 0, 9582 },
+    { 30391, 14, 1, 0, 9582 },
+    { 30405, 10, 1, 0, 9582 },
+    { 30415, 12, 1, 0, 9582 },
+    { 30427, 7, 1, 0, 9582 },
+    { 30434, 16, 1, 0, 9582 },
+    { 30450, 8, 1, 0, 9582 },
+    { 30458, 5, 1, 0, 9582 },
+    { 30463, 10, 1, 0, 9582 },
+    { 30473, 12, 1, 0, 9582 },
+    { 30485, 13, 1, 0, 9582 },
+    { 30498, 6, 1, 0, 9582 },
+    { 30504, 7, 1, 0, 9582 },
+    { 30511, 12, 1, 0, 9582 },
+    { 30523, 12, 1, 0, 9582 },
+    { 30535, 12, 1, 0, 9582 },
+    { 30547, 11, 1, 0, 9582 },
+    { 30558, 4, 1, 0, 9582 },
+    { 30562, 4, 1, 0, 9582 },
+    { 30566, 9, 1, 0, 9582 },
+    { 30575, 7, 1, 0, 9582 },
+    { 30582, 9, 1, 0, 9582 },
+    { 30591, 9, 1, 0, 9582 },
+    { 30600, 7, 1, 0, 9582 },
+    { 30607, 6, 1, 0, 9582 },
+    { 30613, 9, 1, 0, 9582 },
+    { 30622, 3, 1, 0, 9582 },
+    { 30625, 10, 1, 0, 9582 },
+    { 30635, 7, 1, 0, 9582 },
+    { 30642, 11, 1, 0, 9582 },
+    { 30653, 10, 1, 0, 9582 },
+    { 30663, 4, 1, 0, 9582 },
+    { 30667, 6, 1, 0, 9582 },
+    { 30673, 9, 1, 0, 9582 },
+    { 30682, 4, 1, 0, 9582 },
+    { 30686, 10, 1, 0, 9582 },
+    { 30696, 5, 1, 0, 9582 },
+    { 30701, 5, 1, 0, 9582 },
+    { 30706, 13, 1, 0, 9582 },
+    { 30719, 14, 1, 0, 9582 },
+    { 30733, 5, 1, 0, 9582 },
+    { 30738, 6, 1, 0, 9582 },
+    { 30744, 7, 1, 0, 9582 },
+    { 30751, 10, 1, 0, 9582 },
+    { 30761, 6, 1, 0, 9582 },
+    { 30767, 4, 1, 0, 9582 },
+    { 30771, 7, 1, 0, 9582 },
+    { 30778, 11, 1, 0, 9582 },
+    { 30789, 7, 1, 0, 9582 },
+    { 30796, 4, 1, 0, 9582 },
+    { 30800, 6, 1, 0, 9582 },
+    { 30806, 13, 1, 0, 9582 },
+    { 30819, 12, 1, 0, 9582 },
+    { 30831, 6, 1, 0, 9582 },
+    { 30837, 10, 1, 0, 9582 },
+    { 30847, 6, 1, 0, 9582 },
+    { 30853, 8, 1, 0, 9582 },
+    { 30861, 7, 1, 0, 9582 },
+    { 30868, 10, 1, 0, 9582 },
+    { 30878, 6, 1, 0, 9582 },
+    { 30884, 5, 1, 0, 9582 },
+    { 30889, 3, 1, 0, 9582 },
+    { 30892, 6, 1, 0, 9582 },
+    { 30898, 8, 1, 0, 9582 },
+    { 30906, 10, 1, 0, 9582 },
+    { 30916, 7, 1, 0, 9582 },
+    { 30923, 8, 1, 0, 9582 },
+    { 30931, 4, 1, 0, 9582 },
+    { 30935, 7, 1, 0, 9582 },
+    { 30942, 8, 1, 0, 9582 },
+    { 30950, 8, 1, 0, 9582 },
+    { 30958, 8, 1, 0, 9582 },
+    { 30966, 10, 1, 0, 9582 },
+    { 30976, 5, 1, 0, 9582 },
+    { 30981, 7, 1, 0, 9582 },
+    { 30988, 19, 1, 0, 9582 },
+    { 31007, 6, 1, 0, 9582 },
+    { 31013, 8, 1, 0, 9582 },
+    { 31021, 9, 1, 0, 9582 },
+    { 31030, 8, 1, 0, 9582 },
+    { 31038, 11, 1, 0, 9582 },
+    { 31049, 8, 1, 0, 9582 },
+    { 31057, 4, 1, 0, 9582 },
+    { 31061, 6, 1, 0, 9582 },
+    { 31067, 6, 1, 0, 9582 },
+    { 31073, 9, 1, 0, 9582 },
+    { 31082, 7, 1, 0, 9582 },
+    { 31089, 8, 1, 0, 9582 },
+    { 31097, 6, 1, 0, 9582 },
+    { 31103, 4, 1, 0, 9582 },
+    { 31107, 5, 1, 0, 9582 },
+    { 31112, 8, 1, 0, 9582 },
+    { 31120, 10, 1, 0, 9582 },
+    { 31130, 8, 1, 0, 9582 },
+    { 31138, 6, 1, 0, 9582 },
+    { 31144, 10, 1, 0, 9582 },
+    { 31154, 8, 1, 0, 9582 },
+    { 31162, 8, 1, 0, 9582 },
+    { 31170, 8, 1, 0, 9582 },
+    { 31178, 6, 1, 0, 9582 },
+    { 31184, 6, 1, 0, 9582 },
+    { 31190, 12, 1, 0, 9582 },
+    { 31202, 16, 1, 0, 9582 },
+    { 31218, 5, 1, 0, 9582 },
+    { 31223, 8, 1, 0, 9582 },
+    { 31231, 16, 1, 0, 9582 },
+    { 31247, 16, 1, 0, 9582 },
+    { 31263, 14, 1, 0, 9582 },
+    { 31277, 14, 1, 0, 9582 },
+    { 31291, 20, 1, 0, 9582 },
+    { 31311, 15, 1, 0, 9582 },
+    { 31326, 6, 1, 0, 9582 },
+    { 31332, 17, 1, 0, 9582 },
+    { 31349, 19, 1, 0, 9582 },
+    { 31368, 8, 1, 0, 9582 },
+    { 31376, 5, 1, 0, 9582 },
+    { 31381, 8, 1, 0, 9582 },
+    { 31389, 5, 1, 0, 9582 },
+    { 31394, 12, 1, 0, 9582 },
+    { 31406, 9, 1, 0, 9582 },
+    { 31415, 9, 1, 0, 9582 },
+    { 31424, 7, 1, 0, 9582 },
+    { 31431, 9, 1, 0, 9582 },
+    { 31440, 7, 1, 0, 9582 },
+    { 31447, 6, 1, 0, 9582 },
+    { 31453, 7, 1, 0, 9582 },
+    { 31460, 5, 1, 0, 9582 },
+    { 31465, 3, 1, 0, 9582 },
+    { 31468, 3, 1, 0, 9582 },
+    { 31471, 4, 1, 0, 9582 },
+    { 31475, 13, 1, 0, 9582 },
+    { 31488, 15, 1, 0, 9582 },
+    { 31503, 5, 1, 0, 9582 },
+    { 31508, 6, 1, 0, 9582 },
+    { 31514, 7, 1, 0, 9582 },
+    { 31521, 7, 1, 0, 9582 },
+    { 31528, 6, 1, 0, 9582 },
+    { 31534, 11, 1, 0, 9582 },
+    { 31545, 5, 1, 0, 9582 },
+    { 31550, 6, 1, 0, 9582 },
+    { 31556, 7, 1, 0, 9582 },
+    { 31563, 9, 1, 0, 9582 },
+    { 31572, 6, 1, 0, 9582 },
+    { 31578, 5, 1, 0, 9582 },
+    { 31583, 11, 1, 0, 9582 },
+    { 31594, 6, 1, 0, 9582 },
+    { 31600, 5, 1, 0, 9582 },
+    { 31605, 8, 1, 0, 9582 },
+    { 31613, 8, 1, 0, 9582 },
+    { 31621, 12, 1, 0, 9582 },
+    { 31633, 16, 1, 0, 9582 },
+    { 31649, 9, 1, 0, 9582 },
+    { 31658, 7, 1, 0, 9582 },
+    { 31665, 11, 1, 0, 9582 },
+    { 31676, 6, 1, 0, 9582 },
+    { 31682, 10, 1, 0, 9582 },
+    { 31692, 11, 1, 0, 9582 },
+    { 31703, 10, 1, 0, 9582 },
+    { 31713, 6, 1, 0, 9582 },
+    { 31719, 5, 1, 0, 9582 },
+    { 31724, 6, 1, 0, 9582 },
+    { 31730, 8, 1, 0, 9582 },
+    { 31738, 10, 1, 0, 9582 },
+    { 31748, 28, 1, 0, 9582 },
+    { 31776, 12, 1, 0, 9582 },
+    { 31788, 8, 1, 0, 9582 },
+    { 31796, 5, 1, 0, 9582 },
+    { 31801, 7, 1, 0, 9582 },
+    { 31808, 6, 1, 0, 9582 },
+    { 31814, 5, 1, 0, 9582 },
+    { 31819, 6, 1, 0, 9582 },
+    { 31825, 8, 1, 0, 9582 },
+    { 31833, 7, 1, 0, 9582 },
+    { 31840, 8, 1, 0, 9582 },
+    { 31848, 10, 1, 0, 9582 },
+    { 31858, 12, 1, 0, 9582 },
+    { 31870, 9, 1, 0, 9582 },
+    { 31879, 7, 1, 0, 9582 },
+    { 31886, 4, 1, 0, 9582 },
+    { 31890, 6, 1, 0, 9582 },
+    { 31896, 10, 1, 0, 9582 },
+    { 31906, 5, 1, 0, 9582 },
+    { 31911, 12, 1, 0, 9582 },
+    { 31923, 8, 1, 0, 9582 },
+    { 31931, 8, 1, 0, 9582 },
+    { 31939, 12, 1, 0, 9582 },
+    { 31951, 12, 1, 0, 9582 },
+    { 31963, 9, 1, 0, 9582 },
+    { 31972, 7, 1, 0, 9582 },
+    { 31979, 12, 1, 0, 9582 },
+    { 31991, 4, 1, 0, 9582 },
+    { 31995, 10, 1, 0, 9582 },
+    { 32005, 12, 1, 0, 9582 },
+    { 32017, 11, 1, 0, 9582 },
+    { 32028, 11, 1, 0, 9582 },
+    { 32039, 6, 1, 0, 9582 },
+    { 32045, 7, 1, 0, 9582 },
+    { 32052, 7, 1, 0, 9582 },
+    { 32059, 15, 1, 0, 9582 },
+    { 32074, 17, 1, 0, 9582 },
+    { 32091, 18, 1, 0, 9582 },
+    { 32109, 13, 1, 0, 9582 },
+    { 32122, 14, 1, 0, 9582 },
+    { 32136, 14, 1, 0, 9582 },
+    { 32150, 8, 1, 0, 9582 },
+    { 32158, 18, 1, 0, 9582 },
+    { 32176, 8, 1, 0, 9582 },
+    { 32184, 7, 1, 0, 9582 },
+    { 32191, 10, 1, 0, 9582 },
+    { 32201, 8, 1, 0, 9582 },
+    { 32209, 5, 1, 0, 9582 },
+    { 32214, 10, 1, 0, 9582 },
+    { 32224, 7, 1, 0, 9582 },
+    { 32231, 4, 1, 0, 9582 },
+    { 32235, 3, 1, 0, 9582 },
+    { 32238, 5, 1, 0, 9582 },
+    { 32243, 7, 1, 0, 9582 },
+    { 32250, 7, 1, 0, 9582 },
+    { 32257, 14, 1, 0, 9582 },
+    { 32271, 13, 1, 0, 9582 },
+    { 32284, 9, 1, 0, 9582 },
+    { 32293, 5, 1, 0, 9582 },
+    { 32298, 3, 1, 0, 9582 },
+    { 32301, 6, 1, 0, 9582 },
+    { 32307, 5, 1, 0, 9582 },
+    { 32312, 8, 1, 0, 9582 },
+    { 32320, 9, 1, 0, 9582 },
+    { 32329, 5, 1, 0, 9582 },
+    { 32334, 15, 1, 0, 9582 },
+    { 32349, 7, 1, 0, 9582 },
+    { 32356, 5, 1, 0, 9582 },
+    { 32361, 10, 1, 0, 9582 },
+    { 32371, 6, 1, 0, 9582 },
+    { 32377, 9, 1, 0, 9582 },
+    { 32386, 12, 1, 0, 9582 },
+    { 32398, 9, 1, 0, 9582 },
+    { 32407, 6, 1, 0, 9582 },
+    { 32413, 12, 1, 0, 9582 },
+    { 32425, 6, 1, 0, 9582 },
+    { 32431, 8, 1, 0, 9582 },
+    { 32439, 6, 1, 0, 9582 },
+    { 32445, 6, 1, 0, 9582 },
+    { 32451, 4, 1, 0, 9582 },
+    { 32455, 3, 1, 0, 9582 },
+    { 32458, 10, 1, 0, 9582 },
+    { 32468, 17, 1, 0, 9582 },
+    { 32485, 10, 1, 0, 9582 },
+    { 32495, 5, 1, 0, 9582 },
+    { 32500, 7, 1, 0, 9582 },
+    { 32507, 7, 1, 0, 9582 },
+    { 32514, 4, 1, 0, 9582 },
+    { 32518, 11, 1, 0, 9582 },
+    { 32529, 8, 1, 0, 9582 },
+    { 32537, 6, 1, 0, 9582 },
+    { 32543, 5, 1, 0, 9582 },
+    { 32548, 4, 1, 0, 9582 },
+    { 32552, 9, 1, 0, 9582 },
+    { 32561, 4, 1, 0, 9582 },
+    { 32565, 7, 1, 0, 9582 },
+    { 32572, 5, 1, 0, 9582 },
+    { 32577, 7, 1, 0, 9582 },
+    { 32584, 5, 1, 0, 9582 },
+    { 32589, 3, 1, 0, 9582 },
+    { 32592, 8, 1, 0, 9582 },
+    { 32600, 10, 1, 0, 9582 },
+    { 32610, 3, 1, 0, 9582 },
+    { 32613, 10, 1, 0, 9582 },
+    { 32623, 6, 1, 0, 9582 },
+    { 32629, 15, 1, 0, 9582 },
+    { 32644, 9, 1, 0, 9582 },
+    { 32653, 16, 1, 0, 9582 },
+    { 32669, 8, 1, 0, 9582 },
+    { 32677, 9, 1, 0, 9582 },
+    { 32686, 7, 1, 0, 9582 },
+    { 32693, 15, 1, 0, 9582 },
+    { 32708, 4, 1, 0, 9582 },
+    { 32712, 4, 1, 0, 9582 },
+    { 32716, 6, 1, 0, 9582 },
+    { 32722, 6, 1, 0, 9582 },
+    { 32728, 10, 1, 0, 9582 },
+    { 32738, 6, 1, 0, 9582 },
+    { 32744, 7, 1, 0, 9582 },
+    { 32751, 8, 1, 0, 9582 },
+    { 32759, 7, 1, 0, 9582 },
+    { 32766, 7, 1, 0, 9582 },
+    { 32773, 10, 1, 0, 9582 },
+    { 32783, 11, 1, 0, 9582 },
+    { 32794, 5, 1, 0, 9582 },
+    { 32799, 8, 1, 0, 9582 },
+    { 32807, 3, 1, 0, 9582 },
+    { 32810, 12, 1, 0, 9582 },
+    { 32822, 15, 1, 0, 9582 },
+    { 32837, 13, 1, 0, 9582 },
+    { 32850, 7, 1, 0, 9582 },
+    { 32857, 9, 1, 0, 9582 },
+    { 32866, 7, 1, 0, 9582 },
+    { 32873, 8, 1, 0, 9582 },
+    { 32881, 12, 1, 0, 9582 },
+    { 32893, 8, 1, 0, 9582 },
+    { 32901, 8, 1, 0, 9582 },
+    { 32909, 14, 1, 0, 9582 },
+    { 32923, 20, 1, 0, 9582 },
+    { 32943, 36, 1, 0, 9582 },
+    { 32979, 10, 1, 0, 9582 },
+    { 32989, 11, 1, 0, 9582 },
+    { 33000, 4, 1, 0, 9582 },
+    { 33004, 9, 1, 0, 9582 },
+    { 33013, 8, 1, 0, 9582 },
+    { 33021, 5, 1, 0, 9582 },
+    { 33026, 10, 1, 0, 9582 },
+    { 33036, 7, 1, 0, 9582 },
+    { 33043, 8, 1, 0, 9582 },
+    { 33051, 14, 1, 0, 9582 },
+    { 33065, 4, 1, 0, 9582 },
+    { 33069, 3, 1, 0, 9582 },
+    { 33072, 3, 1, 0, 9582 },
+    { 33075, 4, 1, 0, 9582 },
+    { 33079, 3, 1, 0, 9582 },
+    { 33082, 3, 1, 0, 9582 },
+    { 33085, 4, 1, 0, 9582 },
+    { 33089, 3, 1, 0, 9582 },
+    { 33092, 3, 1, 0, 9582 },
+    { 33095, 6, 1, 0, 9582 },
+    { 33101, 4, 1, 0, 9582 },
+    { 33105, 3, 1, 0, 9582 },
+    { 33108, 3, 1, 0, 9582 },
+    { 33111, 3, 1, 0, 9582 },
+    { 33114, 2, 1, 0, 9582 },
+    { 33116, 3, 1, 0, 9582 },
+    { 33119, 2, 1, 0, 9582 },
+    { 33121, 3, 1, 0, 9582 },
+    { 33124, 4, 1, 0, 9582 },
+    { 33128, 3, 1, 0, 9582 },
+    { 33131, 3, 1, 0, 9582 },
+    { 33134, 3, 1, 0, 9582 },
+    { 33137, 6, 1, 0, 9582 },
+    { 33143, 3, 1, 0, 9582 },
+    { 33146, 3, 1, 0, 9582 },
+    { 33149, 8, 1, 0, 9582 },
+    { 33157, 3, 1, 0, 9582 },
+    { 33160, 3, 1, 0, 9582 },
+    { 33163, 3, 1, 0, 9582 },
+    { 33166, 3, 1, 0, 9582 },
+    { 33169, 3, 1, 0, 9582 },
+    { 33172, 3, 1, 0, 9582 },
+    { 33175, 8, 1, 0, 9582 },
+    { 33183, 3, 1, 0, 9582 },
+    { 33186, 3, 1, 0, 9582 },
+    { 33189, 3, 1, 0, 9582 },
+    { 33192, 3, 1, 0, 9582 },
+    { 33195, 4, 1, 0, 9582 },
+    { 33199, 3, 1, 0, 9582 },
+    { 33202, 3, 1, 0, 9582 },
+    { 33205, 2, 1, 0, 9582 },
+    { 33207, 3, 1, 0, 9582 },
+    { 33210, 2, 1, 0, 9582 },
+    { 33212, 3, 1, 0, 9582 },
+    { 33215, 3, 1, 0, 9582 },
+    { 33218, 3, 1, 0, 9582 },
+    { 33221, 3, 1, 0, 9582 },
+    { 33224, 3, 1, 0, 9582 },
+    { 33227, 2, 1, 0, 9582 },
+    { 33229, 2, 1, 0, 9582 },
+    { 33231, 2, 1, 0, 9582 },
+    { 33233, 3, 1, 0, 9582 },
+    { 33236, 2, 1, 0, 9582 },
+    { 33238, 2, 1, 0, 9582 },
+    { 33240, 4, 1, 0, 9582 },
+    { 33244, 4, 1, 0, 9582 },
+    { 33248, 2, 1, 0, 9582 },
+    { 33250, 4, 1, 0, 9582 },
+    { 33254, 2, 1, 0, 9582 },
+    { 33256, 3, 1, 0, 9582 },
+    { 33259, 3, 1, 0, 9582 },
+    { 33262, 6, 1, 0, 9582 },
+    { 33268, 2, 1, 0, 9582 },
+    { 33270, 2, 1, 0, 9582 },
+    { 33272, 2, 1, 0, 9582 },
+    { 33274, 3, 0, 1, 9582 },
+    { 33277, 3, 0, 1, 9583 },
+    { 33280, 4, 1, 0, 9584 },
+    { 33284, 3, 1, 0, 9584 },
+    { 33287, 13, 1, 0, 9584 },
+    { 33300, 14, 1, 0, 9584 },
+    { 33314, 14, 1, 0, 9584 },
+    { 33328, 6, 1, 0, 9584 },
+    { 33334, 6, 1, 0, 9584 },
+    { 33340, 14, 1, 0, 9584 },
+    { 33354, 10, 1, 0, 9584 },
+    { 33364, 18, 1, 0, 9584 },
+    { 33382, 8, 1, 0, 9584 },
+    { 33390, 16, 1, 0, 9584 },
+    { 33406, 12, 1, 0, 9584 },
+    { 33418, 20, 1, 0, 9584 },
+    { 33438, 9, 1, 0, 9584 },
+    { 33447, 17, 1, 0, 9584 },
+    { 33464, 10, 1, 0, 9584 },
+    { 33474, 6, 1, 0, 9584 },
+    { 33480, 12, 1, 0, 9584 },
+    { 33492, 13, 0, 1, 9584 },
+    { 33505, 12, 1, 0, 9585 },
+    { 33517, 15, 1, 7, 9585 },
+    { 33532, 13, 1, 0, 9592 },
+    { 33545, 4, 1, 0, 9592 },
+    { 33549, 4, 1, 0, 9592 },
+    { 33553, 4, 1, 0, 9592 },
+    { 33557, 5, 1, 0, 9592 },
+    { 33562, 9, 1, 0, 9592 },
+    { 33571, 12, 1, 0, 9592 },
+    { 33583, 7, 1, 0, 9592 },
+    { 33590, 6, 1, 0, 9592 },
+    { 33596, 8, 1, 0, 9592 },
+    { 33604, 7, 1, 0, 9592 },
+    { 33611, 8, 1, 0, 9592 },
+    { 33619, 10, 1, 0, 9592 },
+    { 33629, 7, 1, 0, 9592 },
+    { 33636, 9, 1, 0, 9592 },
+    { 33645, 5, 0, 1, 9592 },
+    { 33650, 9, 1, 0, 9593 },
+    { 33659, 11, 1, 1, 9593 },
+    { 33670, 11, 1, 0, 9594 },
+    { 33681, 11, 1, 0, 9594 },
+    { 33692, 8, 1, 0, 9594 },
+    { 33700, 10, 1, 0, 9594 },
+    { 33710, 14, 1, 0, 9594 },
+    { 33724, 10, 1, 2, 9594 },
+    { 33734, 13, 1, 0, 9596 },
+    { 33747, 13, 1, 0, 9596 },
+    { 33760, 11, 4, 0, 9596 },
+    { 33771, 10, 1, 0, 9596 },
+    { 33781, 4, 1, 0, 9596 },
+    { 33785, 6, 1, 0, 9596 },
+    { 33791, 8, 1, 0, 9596 },
+    { 33799, 8, 1, 0, 9596 },
+    { 33807, 7, 1, 0, 9596 },
+    { 33814, 5, 1, 0, 9596 },
+    { 33819, 7, 1, 0, 9596 },
+    { 33826, 9, 1, 0, 9596 },
+    { 33835, 7, 1, 0, 9596 },
+    { 33842, 8, 1, 0, 9596 },
+    { 33850, 9, 1, 0, 9596 },
+    { 33859, 4, 1, 0, 9596 },
+    { 33863, 5, 1, 0, 9596 },
+    { 33868, 14, 1, 0, 9596 },
+    { 33882, 7, 1, 0, 9596 },
+    { 33889, 7, 1, 0, 9596 },
+    { 33896, 15, 1, 0, 9596 },
+    { 33911, 9, 1, 0, 9596 },
+    { 33920, 17, 1, 0, 9596 },
+    { 33937, 6, 0, 3, 9596 },
+    { 33943, 13, 1, 0, 9599 },
+    { 33956, 8, 1, 0, 9599 },
+    { 33964, 6, 0, 4, 9599 },
+    { 33970, 8, 1, 1, 9603 },
+    { 33978, 10, 1, 0, 9604 },
+    { 33988, 8, 1, 0, 9604 },
+    { 33996, 16, 1, 0, 9604 },
+    { 34012, 12, 1, 0, 9604 },
+    { 34024, 7, 1, 0, 9604 },
+    { 34031, 7, 1, 0, 9604 },
+    { 34038, 7, 1, 0, 9604 },
+    { 34045, 7, 1, 0, 9604 },
+    { 34052, 2, 1, 0, 9604 },
+    { 34054, 7, 1, 0, 9604 },
+    { 34061, 12, 1, 0, 9604 },
+    { 34073, 6, 1, 0, 9604 },
+    { 34079, 5, 1, 0, 9604 },
+    { 34084, 7, 1, 0, 9604 },
+    { 34091, 6, 1, 0, 9604 },
+    { 34097, 9, 1, 0, 9604 },
+    { 34106, 8, 1, 0, 9604 },
+    { 34114, 2, 1, 0, 9604 },
+    { 34116, 2, 1, 0, 9604 },
+    { 34118, 6, 1, 0, 9604 },
+    { 34124, 11, 1, 0, 9604 },
+    { 34135, 6, 1, 0, 9604 },
+    { 34141, 4, 1, 0, 9604 },
+    { 34145, 7, 1, 0, 9604 },
+    { 34152, 9, 1, 0, 9604 },
+    { 34161, 9, 1, 0, 9604 },
+    { 34170, 8, 1, 0, 9604 },
+    { 34178, 2, 1, 0, 9604 },
+    { 34180, 9, 1, 0, 9604 },
+    { 34189, 8, 1, 0, 9604 },
+    { 34197, 10, 1, 0, 9604 },
+    { 34207, 8, 1, 0, 9604 },
+    { 34215, 11, 0, 1, 9604 },
+    { 34226, 9, 1, 0, 9605 },
+    { 34235, 6, 1, 0, 9605 },
+    { 34241, 9, 1, 0, 9605 },
+    { 34250, 7, 1, 0, 9605 },
+    { 34257, 7, 1, 0, 9605 },
+    { 34264, 9, 1, 0, 9605 },
+    { 34273, 8, 1, 0, 9605 },
+    { 34281, 7, 1, 0, 9605 },
+    { 34288, 9, 1, 0, 9605 },
+    { 34297, 5, 1, 0, 9605 },
+    { 34302, 16, 1, 0, 9605 },
+    { 34318, 12, 1, 0, 9605 },
+    { 34330, 6, 1, 0, 9605 },
+    { 34336, 5, 1, 0, 9605 },
+    { 34341, 7, 1, 0, 9605 },
+    { 34348, 13, 1, 0, 9605 },
+    { 34361, 9, 1, 0, 9605 },
+    { 34370, 3, 0, 2, 9605 },
+    { 34373, 5, 1, 0, 9607 },
+    { 34378, 6, 1, 0, 9607 },
+    { 34384, 7, 1, 0, 9607 },
+    { 34391, 24, 1, 0, 9607 },
+    { 34415, 8, 1, 0, 9607 },
+    { 34423, 10, 1, 0, 9607 },
+    { 34433, 14, 1, 0, 9607 },
+    { 34447, 2, 1, 0, 9607 },
+    { 34449, 11, 0, 2, 9607 },
+    { 34460, 10, 0, 1, 9609 },
+    { 34470, 10, 1, 0, 9610 },
+    { 34480, 13, 1, 0, 9610 },
+    { 34493, 2, 1, 0, 9610 },
+    { 34495, 6, 1, 0, 9610 },
+    { 34501, 6, 1, 0, 9610 },
+    { 34507, 8, 1, 0, 9610 },
+    { 34515, 10, 1, 0, 9610 },
+    { 34525, 8, 1, 0, 9610 },
+    { 34533, 9, 1, 0, 9610 },
+    { 34542, 8, 1, 0, 9610 },
+    { 34550, 14, 1, 0, 9610 },
+    { 34564, 10, 1, 0, 9610 },
+    { 34574, 8, 1, 0, 9610 },
+    { 34582, 7, 1, 0, 9610 },
+    { 34589, 4, 0, 2, 9610 },
+    { 34593, 13, 1, 0, 9612 },
+    { 34606, 8, 1, 0, 9612 },
+    { 34614, 5, 1, 0, 9612 },
+    { 34619, 8, 1, 0, 9612 },
+    { 34627, 9, 0, 1, 9612 },
+    { 34636, 8, 1, 0, 9613 },
+    { 34644, 10, 1, 1, 9613 },
+    { 34654, 2, 1, 0, 9614 },
+    { 34656, 8, 0, 1, 9614 },
+    { 34664, 6, 1, 0, 9615 },
+    { 34670, 2, 1, 0, 9615 },
+    { 34672, 4, 1, 0, 9615 },
+    { 34676, 6, 1, 0, 9615 },
+    { 34682, 8, 1, 1, 9615 },
+    { 34690, 6, 1, 0, 9616 },
+    { 34696, 11, 1, 2, 9616 },
+    { 34707, 2, 1, 0, 9618 },
+    { 34709, 5, 4, 0, 9618 },
+    { 34714, 4, 1, 0, 9618 },
+    { 34718, 7, 1, 0, 9618 },
+    { 34725, 2, 1, 0, 9618 },
+    { 34727, 4, 1, 0, 9618 },
+    { 34731, 10, 1, 0, 9618 },
+    { 34741, 4, 1, 0, 9618 },
+    { 34745, 3, 1, 0, 9618 },
+    { 34748, 4, 1, 0, 9618 },
+    { 34752, 4, 1, 0, 9618 },
+    { 34756, 3, 1, 0, 9618 },
+    { 34759, 5, 1, 0, 9618 },
+    { 34764, 3, 1, 0, 9618 },
+    { 34767, 3, 1, 0, 9618 },
+    { 34770, 5, 1, 0, 9618 },
+    { 34775, 3, 1, 0, 9618 },
+    { 34778, 3, 1, 0, 9618 },
+    { 34781, 3, 1, 1, 9618 },
+    { 34784, 3, 1, 0, 9619 },
+    { 34787, 4, 1, 0, 9619 },
+    { 34791, 3, 1, 0, 9619 },
+    { 34794, 3, 1, 0, 9619 },
+    { 34797, 1, 1, 0, 9619 },
+    { 34798, 3, 1, 0, 9619 },
+    { 34801, 3, 1, 0, 9619 },
+    { 34804, 4, 1, 0, 9619 },
+    { 34808, 4, 1, 0, 9619 },
+    { 34812, 3, 1, 0, 9619 },
+    { 34815, 3, 1, 0, 9619 },
+    { 34818, 3, 1, 0, 9619 },
+    { 34821, 3, 1, 0, 9619 },
+    { 34824, 2, 1, 0, 9619 },
+    { 34826, 3, 1, 0, 9619 },
+    { 34829, 2, 1, 0, 9619 },
+    { 34831, 3, 1, 0, 9619 },
+    { 34834, 3, 1, 0, 9619 },
+    { 34837, 3, 1, 0, 9619 },
+    { 34840, 2, 1, 0, 9619 },
+    { 34842, 4, 1, 0, 9619 },
+    { 34846, 3, 1, 0, 9619 },
+    { 34849, 3, 1, 0, 9619 },
+    { 34852, 3, 1, 0, 9619 },
+    { 34855, 3, 1, 0, 9619 },
+    { 34858, 3, 1, 0, 9619 },
+    { 34861, 3, 1, 0, 9619 },
+    { 34864, 10, 1, 0, 9619 },
+    { 34874, 8, 1, 0, 9619 },
+    { 34882, 7, 1, 0, 9619 },
+    { 34889, 2, 1, 0, 9619 },
+    { 34891, 5, 1, 0, 9619 },
+    { 34896, 3, 1, 0, 9619 },
+    { 34899, 15, 1, 0, 9619 },
+    { 34914, 6, 1, 0, 9619 },
+    { 34920, 12, 1, 0, 9619 },
+    { 34932, 8, 4, 0, 9619 },
+    { 34940, 13, 1, 0, 9619 },
+    { 34953, 2, 1, 1, 9619 },
+    { 34955, 8, 1, 0, 9620 },
+    { 34963, 6, 1, 0, 9620 },
+    { 34969, 6, 1, 0, 9620 },
+    { 34975, 7, 1, 0, 9620 },
+    { 34982, 2, 1, 1, 9620 },
+    { 34984, 8, 0, 1, 9621 },
+    { 34992, 10, 1, 0, 9622 },
+    { 35002, 8, 1, 0, 9622 },
+    { 35010, 2, 1, 0, 9622 },
+    { 35012, 9, 1, 0, 9622 },
+    { 35021, 7, 1, 0, 9622 },
+    { 35028, 6, 1, 0, 9622 },
+    { 35034, 9, 1, 0, 9622 },
+    { 35043, 4, 1, 0, 9622 },
+    { 35047, 6, 1, 0, 9622 },
+    { 35053, 4, 1, 0, 9622 },
+    { 35057, 4, 1, 0, 9622 },
+    { 35061, 9, 1, 0, 9622 },
+    { 35070, 6, 1, 0, 9622 },
+    { 35076, 5, 1, 0, 9622 },
+    { 35081, 6, 1, 0, 9622 },
+    { 35087, 5, 1, 0, 9622 },
+    { 35092, 7, 1, 0, 9622 },
+    { 35099, 7, 1, 0, 9622 },
+    { 35106, 4, 1, 0, 9622 },
+    { 35110, 6, 1, 0, 9622 },
+    { 35116, 5, 1, 0, 9622 },
+    { 35121, 5, 1, 0, 9622 },
+    { 35126, 5, 1, 0, 9622 },
+    { 35131, 7, 1, 0, 9622 },
+    { 35138, 6, 1, 0, 9622 },
+    { 35144, 5, 1, 0, 9622 },
+    { 35149, 9, 1, 0, 9622 },
+    { 35158, 5, 1, 0, 9622 },
+    { 35163, 4, 1, 0, 9622 },
+    { 35167, 7, 1, 0, 9622 },
+    { 35174, 14, 1, 0, 9622 },
+    { 35188, 15, 1, 0, 9622 },
+    { 35203, 9, 1, 0, 9622 },
+    { 35212, 9, 1, 0, 9622 },
+    { 35221, 6, 1, 0, 9622 },
+    { 35227, 7, 1, 0, 9622 },
+    { 35234, 8, 1, 0, 9622 },
+    { 35242, 11, 1, 0, 9622 },
+    { 35253, 12, 1, 0, 9622 },
+    { 35265, 6, 1, 0, 9622 },
+    { 35271, 7, 1, 0, 9622 },
+    { 35278, 5, 1, 0, 9622 },
+    { 35283, 10, 1, 0, 9622 },
+    { 35293, 9, 1, 0, 9622 },
+    { 35302, 9, 1, 0, 9622 },
+    { 35311, 6, 1, 0, 9622 },
+    { 35317, 5, 1, 0, 9622 },
+    { 35322, 5, 1, 0, 9622 },
+    { 35327, 9, 1, 0, 9622 },
+    { 35336, 11, 1, 0, 9622 },
+    { 35347, 12, 1, 0, 9622 },
+    { 35359, 6, 1, 0, 9622 },
+    { 35365, 6, 1, 0, 9622 },
+    { 35371, 4, 1, 0, 9622 },
+    { 35375, 6, 1, 0, 9622 },
+    { 35381, 8, 1, 0, 9622 },
+    { 35389, 9, 1, 0, 9622 },
+    { 35398, 6, 1, 0, 9622 },
+    { 35404, 7, 1, 0, 9622 },
+    { 35411, 6, 1, 0, 9622 },
+    { 35417, 8, 1, 0, 9622 },
+    { 35425, 7, 1, 0, 9622 },
+    { 35432, 8, 1, 0, 9622 },
+    { 35440, 9, 1, 0, 9622 },
+    { 35449, 5, 1, 0, 9622 },
+    { 35454, 8, 1, 0, 9622 },
+    { 35462, 4, 1, 0, 9622 },
+    { 35466, 5, 1, 0, 9622 },
+    { 35471, 4, 1, 0, 9622 },
+    { 35475, 5, 1, 0, 9622 },
+    { 35480, 9, 1, 0, 9622 },
+    { 35489, 7, 1, 0, 9622 },
+    { 35496, 11, 1, 0, 9622 },
+    { 35507, 10, 1, 0, 9622 },
+    { 35517, 5, 1, 0, 9622 },
+    { 35522, 9, 1, 0, 9622 },
+    { 35531, 13, 1, 0, 9622 },
+    { 35544, 2, 1, 1, 9622 },
+    { 35546, 7, 1, 0, 9623 },
+    { 35553, 8, 0, 1, 9623 },
+    { 35561, 7, 1, 0, 9624 },
+    { 35568, 5, 1, 0, 9624 },
+    { 35573, 12, 1, 0, 9624 },
+    { 35585, 13, 1, 0, 9624 },
+    { 35598, 8, 1, 0, 9624 },
+    { 35606, 8, 1, 0, 9624 },
+    { 35614, 7, 1, 0, 9624 },
+    { 35621, 11, 1, 0, 9624 },
+    { 35632, 10, 1, 0, 9624 },
+    { 35642, 6, 1, 0, 9624 },
+    { 35648, 6, 1, 0, 9624 },
+    { 35654, 10, 1, 0, 9624 },
+    { 35664, 2, 1, 0, 9624 },
+    { 35666, 11, 1, 0, 9624 },
+    { 35677, 12, 1, 0, 9624 },
+    { 35689, 10, 1, 0, 9624 },
+    { 35699, 6, 1, 0, 9624 },
+    { 35705, 3, 1, 0, 9624 },
+    { 35708, 13, 1, 0, 9624 },
+    { 35721, 12, 1, 0, 9624 },
+    { 35733, 13, 1, 0, 9624 },
+    { 35746, 5, 1, 0, 9624 },
+    { 35751, 5, 1, 0, 9624 },
+    { 35756, 7, 1, 0, 9624 },
+    { 35763, 9, 1, 0, 9624 },
+    { 35772, 6, 1, 0, 9624 },
+    { 35778, 7, 1, 0, 9624 },
+    { 35785, 5, 1, 0, 9624 },
+    { 35790, 6, 1, 0, 9624 },
+    { 35796, 6, 1, 0, 9624 },
+    { 35802, 8, 1, 0, 9624 },
+    { 35810, 3, 1, 0, 9624 },
+    { 35813, 8, 1, 0, 9624 },
+    { 35821, 8, 1, 0, 9624 },
+    { 35829, 7, 1, 0, 9624 },
+    { 35836, 8, 1, 0, 9624 },
+    { 35844, 9, 1, 0, 9624 },
+    { 35853, 7, 1, 0, 9624 },
+    { 35860, 7, 1, 0, 9624 },
+    { 35867, 8, 1, 0, 9624 },
+    { 35875, 4, 1, 0, 9624 },
+    { 35879, 7, 1, 0, 9624 },
+    { 35886, 8, 1, 0, 9624 },
+    { 35894, 6, 1, 0, 9624 },
+    { 35900, 11, 1, 0, 9624 },
+    { 35911, 15, 1, 0, 9624 },
+    { 35926, 7, 1, 0, 9624 },
+    { 35933, 6, 1, 0, 9624 },
+    { 35939, 5, 1, 0, 9624 },
+    { 35944, 3, 1, 0, 9624 },
+    { 35947, 7, 1, 0, 9624 },
+    { 35954, 3, 1, 0, 9624 },
+    { 35957, 6, 1, 0, 9624 },
+    { 35963, 7, 1, 0, 9624 },
+    { 35970, 6, 1, 0, 9624 },
+    { 35976, 6, 1, 0, 9624 },
+    { 35982, 5, 1, 0, 9624 },
+    { 35987, 3, 1, 0, 9624 },
+    { 35990, 8, 1, 0, 9624 },
+    { 35998, 9, 1, 0, 9624 },
+    { 36007, 11, 1, 0, 9624 },
+    { 36018, 8, 1, 0, 9624 },
+    { 36026, 5, 1, 0, 9624 },
+    { 36031, 5, 1, 0, 9624 },
+    { 36036, 6, 1, 0, 9624 },
+    { 36042, 4, 1, 0, 9624 },
+    { 36046, 2, 1, 1, 9624 },
+    { 36048, 9, 1, 0, 9625 },
+    { 36057, 7, 1, 0, 9625 },
+    { 36064, 5, 1, 0, 9625 },
+    { 36069, 7, 1, 0, 9625 },
+    { 36076, 6, 1, 0, 9625 },
+    { 36082, 5, 1, 0, 9625 },
+    { 36087, 11, 1, 0, 9625 },
+    { 36098, 4, 1, 0, 9625 },
+    { 36102, 5, 1, 0, 9625 },
+    { 36107, 7, 1, 0, 9625 },
+    { 36114, 6, 1, 0, 9625 },
+    { 36120, 5, 1, 0, 9625 },
+    { 36125, 6, 1, 0, 9625 },
+    { 36131, 6, 1, 0, 9625 },
+    { 36137, 7, 1, 0, 9625 },
+    { 36144, 7, 1, 0, 9625 },
+    { 36151, 4, 1, 0, 9625 },
+    { 36155, 10, 1, 0, 9625 },
+    { 36165, 8, 1, 0, 9625 },
+    { 36173, 6, 1, 0, 9625 },
+    { 36179, 9, 1, 0, 9625 },
+    { 36188, 5, 1, 0, 9625 },
+    { 36193, 6, 1, 0, 9625 },
+    { 36199, 10, 1, 0, 9625 },
+    { 36209, 6, 1, 0, 9625 },
+    { 36215, 7, 1, 0, 9625 },
+    { 36222, 13, 1, 0, 9625 },
+    { 36235, 9, 1, 0, 9625 },
+    { 36244, 10, 1, 0, 9625 },
+    { 36254, 5, 1, 0, 9625 },
+    { 36259, 7, 1, 0, 9625 },
+    { 36266, 8, 1, 0, 9625 },
+    { 36274, 8, 1, 0, 9625 },
+    { 36282, 7, 1, 0, 9625 },
+    { 36289, 6, 1, 0, 9625 },
+    { 36295, 7, 1, 0, 9625 },
+    { 36302, 7, 1, 0, 9625 },
+    { 36309, 3, 1, 0, 9625 },
+    { 36312, 4, 1, 0, 9625 },
+    { 36316, 5, 1, 0, 9625 },
+    { 36321, 7, 1, 0, 9625 },
+    { 36328, 9, 1, 0, 9625 },
+    { 36337, 8, 1, 0, 9625 },
+    { 36345, 5, 1, 0, 9625 },
+    { 36350, 4, 1, 0, 9625 },
+    { 36354, 5, 1, 0, 9625 },
+    { 36359, 13, 1, 0, 9625 },
+    { 36372, 10, 1, 0, 9625 },
+    { 36382, 7, 1, 0, 9625 },
+    { 36389, 12, 1, 0, 9625 },
+    { 36401, 2, 1, 0, 9625 },
+    { 36403, 6, 1, 0, 9625 },
+    { 36409, 6, 1, 0, 9625 },
+    { 36415, 10, 1, 0, 9625 },
+    { 36425, 6, 1, 0, 9625 },
+    { 36431, 5, 1, 0, 9625 },
+    { 36436, 5, 1, 0, 9625 },
+    { 36441, 7, 1, 0, 9625 },
+    { 36448, 12, 1, 0, 9625 },
+    { 36460, 10, 1, 0, 9625 },
+    { 36470, 6, 1, 0, 9625 },
+    { 36476, 5, 1, 0, 9625 },
+    { 36481, 6, 1, 0, 9625 },
+    { 36487, 7, 1, 0, 9625 },
+    { 36494, 6, 1, 0, 9625 },
+    { 36500, 12, 1, 0, 9625 },
+    { 36512, 9, 1, 0, 9625 },
+    { 36521, 7, 0, 4, 9625 },
+    { 36528, 5, 1, 0, 9629 },
+    { 36533, 6, 1, 0, 9629 },
+    { 36539, 8, 1, 0, 9629 },
+    { 36547, 5, 1, 0, 9629 },
+    { 36552, 5, 1, 0, 9629 },
+    { 36557, 8, 1, 0, 9629 },
+    { 36565, 10, 1, 0, 9629 },
+    { 36575, 2, 1, 1, 9629 },
+    { 36577, 2, 1, 1, 9630 },
+    { 36579, 5, 1, 0, 9631 },
+    { 36584, 6, 1, 0, 9631 },
+    { 36590, 3, 1, 0, 9631 },
+    { 36593, 8, 1, 0, 9631 },
+    { 36601, 3, 1, 0, 9631 },
+    { 36604, 4, 1, 0, 9631 },
+    { 36608, 11, 1, 0, 9631 },
+    { 36619, 8, 1, 0, 9631 },
+    { 36627, 9, 1, 0, 9631 },
+    { 36636, 8, 1, 0, 9631 },
+    { 36644, 9, 0, 1, 9631 },
+    { 36653, 9, 1, 0, 9632 },
+    { 36662, 6, 1, 0, 9632 },
+    { 36668, 8, 1, 0, 9632 },
+    { 36676, 9, 1, 0, 9632 },
+    { 36685, 6, 1, 0, 9632 },
+    { 36691, 5, 1, 0, 9632 },
+    { 36696, 6, 1, 0, 9632 },
+    { 36702, 9, 1, 0, 9632 },
+    { 36711, 7, 1, 0, 9632 },
+    { 36718, 14, 1, 0, 9632 },
+    { 36732, 7, 1, 0, 9632 },
+    { 36739, 3, 1, 0, 9632 },
+    { 36742, 11, 1, 0, 9632 },
+    { 36753, 9, 1, 0, 9632 },
+    { 36762, 9, 1, 0, 9632 },
+    { 36771, 10, 1, 0, 9632 },
+    { 36781, 7, 1, 0, 9632 },
+    { 36788, 6, 1, 0, 9632 },
+    { 36794, 7, 1, 0, 9632 },
+    { 36801, 8, 1, 0, 9632 },
+    { 36809, 7, 1, 0, 9632 },
+    { 36816, 4, 1, 0, 9632 },
+    { 36820, 9, 1, 1, 9632 },
+    { 36829, 8, 1, 0, 9633 },
+    { 36837, 8, 1, 0, 9633 },
+    { 36845, 7, 1, 0, 9633 },
+    { 36852, 6, 1, 0, 9633 },
+    { 36858, 9, 1, 0, 9633 },
+    { 36867, 8, 1, 0, 9633 },
+    { 36875, 10, 1, 0, 9633 },
+    { 36885, 7, 1, 0, 9633 },
+    { 36892, 10, 1, 0, 9633 },
+    { 36902, 8, 1, 0, 9633 },
+    { 36910, 7, 1, 0, 9633 },
+    { 36917, 6, 1, 0, 9633 },
+    { 36923, 7, 1, 0, 9633 },
+    { 36930, 10, 1, 0, 9633 },
+    { 36940, 8, 1, 0, 9633 },
+    { 36948, 5, 1, 0, 9633 },
+    { 36953, 5, 1, 0, 9633 },
+    { 36958, 6, 1, 0, 9633 },
+    { 36964, 7, 1, 0, 9633 },
+    { 36971, 9, 1, 0, 9633 },
+    { 36980, 11, 1, 0, 9633 },
+    { 36991, 8, 1, 0, 9633 },
+    { 36999, 9, 1, 0, 9633 },
+    { 37008, 7, 1, 0, 9633 },
+    { 37015, 8, 1, 0, 9633 },
+    { 37023, 12, 1, 0, 9633 },
+    { 37035, 12, 1, 0, 9633 },
+    { 37047, 10, 1, 0, 9633 },
+    { 37057, 12, 1, 0, 9633 },
+    { 37069, 10, 1, 0, 9633 },
+    { 37079, 11, 1, 0, 9633 },
+    { 37090, 8, 1, 0, 9633 },
+    { 37098, 8, 1, 0, 9633 },
+    { 37106, 4, 1, 0, 9633 },
+    { 37110, 9, 1, 0, 9633 },
+    { 37119, 9, 1, 0, 9633 },
+    { 37128, 10, 1, 0, 9633 },
+    { 37138, 9, 1, 0, 9633 },
+    { 37147, 7, 1, 0, 9633 },
+    { 37154, 8, 1, 0, 9633 },
+    { 37162, 9, 1, 0, 9633 },
+    { 37171, 10, 1, 0, 9633 },
+    { 37181, 13, 1, 0, 9633 },
+    { 37194, 8, 1, 0, 9633 },
+    { 37202, 12, 1, 0, 9633 },
+    { 37214, 6, 1, 0, 9633 },
+    { 37220, 8, 1, 0, 9633 },
+    { 37228, 9, 1, 0, 9633 },
+    { 37237, 6, 1, 0, 9633 },
+    { 37243, 6, 1, 0, 9633 },
+    { 37249, 7, 1, 0, 9633 },
+    { 37256, 8, 1, 0, 9633 },
+    { 37264, 11, 1, 0, 9633 },
+    { 37275, 12, 1, 0, 9633 },
+    { 37287, 7, 1, 0, 9633 },
+    { 37294, 9, 1, 0, 9633 },
+    { 37303, 9, 1, 0, 9633 },
+    { 37312, 7, 1, 0, 9633 },
+    { 37319, 4, 1, 0, 9633 },
+    { 37323, 7, 1, 0, 9633 },
+    { 37330, 6, 1, 0, 9633 },
+    { 37336, 6, 1, 0, 9633 },
+    { 37342, 5, 1, 0, 9633 },
+    { 37347, 8, 1, 0, 9633 },
+    { 37355, 4, 1, 0, 9633 },
+    { 37359, 6, 1, 0, 9633 },
+    { 37365, 11, 1, 0, 9633 },
+    { 37376, 9, 1, 0, 9633 },
+    { 37385, 6, 1, 0, 9633 },
+    { 37391, 9, 1, 0, 9633 },
+    { 37400, 7, 1, 0, 9633 },
+    { 37407, 6, 1, 0, 9633 },
+    { 37413, 7, 1, 0, 9633 },
+    { 37420, 8, 1, 0, 9633 },
+    { 37428, 3, 1, 0, 9633 },
+    { 37431, 5, 1, 0, 9633 },
+    { 37436, 9, 1, 0, 9633 },
+    { 37445, 5, 1, 0, 9633 },
+    { 37450, 4, 1, 0, 9633 },
+    { 37454, 6, 1, 0, 9633 },
+    { 37460, 5, 1, 0, 9633 },
+    { 37465, 6, 1, 0, 9633 },
+    { 37471, 6, 1, 0, 9633 },
+    { 37477, 7, 1, 0, 9633 },
+    { 37484, 6, 1, 0, 9633 },
+    { 37490, 7, 1, 0, 9633 },
+    { 37497, 7, 1, 0, 9633 },
+    { 37504, 9, 1, 0, 9633 },
+    { 37513, 10, 1, 0, 9633 },
+    { 37523, 6, 1, 0, 9633 },
+    { 37529, 11, 1, 0, 9633 },
+    { 37540, 7, 1, 0, 9633 },
+    { 37547, 6, 1, 0, 9633 },
+    { 37553, 6, 1, 0, 9633 },
+    { 37559, 6, 1, 0, 9633 },
+    { 37565, 9, 1, 0, 9633 },
+    { 37574, 10, 1, 0, 9633 },
+    { 37584, 5, 1, 0, 9633 },
+    { 37589, 13, 1, 0, 9633 },
+    { 37602, 6, 1, 0, 9633 },
+    { 37608, 6, 1, 0, 9633 },
+    { 37614, 6, 1, 0, 9633 },
+    { 37620, 5, 1, 0, 9633 },
+    { 37625, 6, 1, 0, 9633 },
+    { 37631, 7, 1, 0, 9633 },
+    { 37638, 8, 1, 0, 9633 },
+    { 37646, 7, 1, 0, 9633 },
+    { 37653, 14, 1, 0, 9633 },
+    { 37667, 3, 1, 0, 9633 },
+    { 37670, 9, 1, 0, 9633 },
+    { 37679, 10, 1, 0, 9633 },
+    { 37689, 9, 1, 0, 9633 },
+    { 37698, 7, 1, 0, 9633 },
+    { 37705, 7, 1, 0, 9633 },
+    { 37712, 5, 1, 0, 9633 },
+    { 37717, 5, 1, 0, 9633 },
+    { 37722, 15, 0, 2, 9633 },
+    { 37737, 7, 1, 0, 9635 },
+    { 37744, 8, 1, 0, 9635 },
+    { 37752, 8, 1, 0, 9635 },
+    { 37760, 4, 1, 0, 9635 },
+    { 37764, 6, 1, 0, 9635 },
+    { 37770, 8, 1, 0, 9635 },
+    { 37778, 2, 1, 1, 9635 },
+    { 37780, 6, 1, 0, 9636 },
+    { 37786, 7, 1, 0, 9636 },
+    { 37793, 6, 1, 0, 9636 },
+    { 37799, 12, 1, 0, 9636 },
+    { 37811, 12, 1, 0, 9636 },
+    { 37823, 15, 1, 0, 9636 },
+    { 37838, 8, 1, 0, 9636 },
+    { 37846, 7, 1, 0, 9636 },
+    { 37853, 16, 0, 2, 9636 },
+    { 37869, 14, 1, 0, 9638 },
+    { 37883, 10, 1, 0, 9638 },
+    { 37893, 6, 1, 0, 9638 },
+    { 37899, 10, 1, 0, 9638 },
+    { 37909, 9, 1, 0, 9638 },
+    { 37918, 5, 1, 0, 9638 },
+    { 37923, 8, 1, 0, 9638 },
+    { 37931, 6, 1, 0, 9638 },
+    { 37937, 8, 1, 0, 9638 },
+    { 37945, 8, 1, 0, 9638 },
+    { 37953, 11, 1, 0, 9638 },
+    { 37964, 5, 1, 0, 9638 },
+    { 37969, 8, 1, 0, 9638 },
+    { 37977, 12, 1, 0, 9638 },
+    { 37989, 7, 1, 0, 9638 },
+    { 37996, 6, 1, 0, 9638 },
+    { 38002, 8, 1, 0, 9638 },
+    { 38010, 8, 1, 0, 9638 },
+    { 38018, 2, 1, 1, 9638 },
+    { 38020, 11, 1, 0, 9639 },
+    { 38031, 9, 1, 0, 9639 },
+    { 38040, 9, 1, 0, 9639 },
+    { 38049, 7, 1, 0, 9639 },
+    { 38056, 8, 1, 0, 9639 },
+    { 38064, 8, 0, 6, 9639 },
+    { 38072, 11, 1, 0, 9645 },
+    { 38083, 9, 1, 0, 9645 },
+    { 38092, 13, 1, 0, 9645 },
+    { 38105, 8, 1, 0, 9645 },
+    { 38113, 8, 1, 0, 9645 },
+    { 38121, 2, 1, 1, 9645 },
+    { 38123, 9, 1, 0, 9646 },
+    { 38132, 16, 1, 0, 9646 },
+    { 38148, 7, 1, 0, 9646 },
+    { 38155, 10, 1, 0, 9646 },
+    { 38165, 4, 1, 0, 9646 },
+    { 38169, 2, 1, 1, 9646 },
+    { 38171, 6, 1, 0, 9647 },
+    { 38177, 2, 1, 1, 9647 },
+    { 38179, 10, 1, 0, 9648 },
+    { 38189, 6, 1, 0, 9648 },
+    { 38195, 8, 1, 0, 9648 },
+    { 38203, 9, 1, 0, 9648 },
+    { 38212, 8, 1, 0, 9648 },
+    { 38220, 6, 1, 0, 9648 },
+    { 38226, 6, 1, 0, 9648 },
+    { 38232, 6, 1, 0, 9648 },
+    { 38238, 5, 1, 0, 9648 },
+    { 38243, 4, 1, 0, 9648 },
+    { 38247, 4, 1, 1, 9648 },
+    { 38251, 6, 1, 0, 9649 },
+    { 38257, 7, 1, 0, 9649 },
+    { 38264, 8, 1, 0, 9649 },
+    { 38272, 7, 0, 1, 9649 },
+    { 38279, 11, 1, 0, 9650 },
+    { 38290, 7, 1, 0, 9650 },
+    { 38297, 9, 1, 0, 9650 },
+    { 38306, 10, 1, 0, 9650 },
+    { 38316, 4, 1, 0, 9650 },
+    { 38320, 8, 1, 0, 9650 },
+    { 38328, 13, 1, 0, 9650 },
+    { 38341, 9, 1, 0, 9650 },
+    { 38350, 8, 1, 0, 9650 },
+    { 38358, 9, 1, 0, 9650 },
+    { 38367, 10, 1, 0, 9650 },
+    { 38377, 4, 1, 0, 9650 },
+    { 38381, 4, 1, 0, 9650 },
+    { 38385, 5, 1, 0, 9650 },
+    { 38390, 6, 1, 0, 9650 },
+    { 38396, 11, 1, 0, 9650 },
+    { 38407, 6, 1, 0, 9650 },
+    { 38413, 5, 1, 0, 9650 },
+    { 38418, 9, 1, 0, 9650 },
+    { 38427, 8, 1, 0, 9650 },
+    { 38435, 4, 1, 0, 9650 },
+    { 38439, 9, 1, 0, 9650 },
+    { 38448, 5, 1, 0, 9650 },
+    { 38453, 8, 1, 0, 9650 },
+    { 38461, 7, 1, 0, 9650 },
+    { 38468, 8, 1, 0, 9650 },
+    { 38476, 9, 1, 0, 9650 },
+    { 38485, 6, 1, 0, 9650 },
+    { 38491, 7, 1, 0, 9650 },
+    { 38498, 9, 1, 0, 9650 },
+    { 38507, 9, 1, 0, 9650 },
+    { 38516, 5, 1, 0, 9650 },
+    { 38521, 5, 1, 0, 9650 },
+    { 38526, 6, 1, 0, 9650 },
+    { 38532, 2, 1, 1, 9650 },
+    { 38534, 4, 1, 0, 9651 },
+    { 38538, 5, 1, 0, 9651 },
+    { 38543, 6, 1, 0, 9651 },
+    { 38549, 5, 1, 0, 9651 },
+    { 38554, 7, 1, 0, 9651 },
+    { 38561, 5, 1, 0, 9651 },
+    { 38566, 4, 1, 0, 9651 },
+    { 38570, 6, 1, 0, 9651 },
+    { 38576, 7, 1, 0, 9651 },
+    { 38583, 6, 1, 0, 9651 },
+    { 38589, 5, 1, 0, 9651 },
+    { 38594, 13, 1, 0, 9651 },
+    { 38607, 6, 1, 0, 9651 },
+    { 38613, 5, 1, 0, 9651 },
+    { 38618, 7, 1, 0, 9651 },
+    { 38625, 9, 1, 0, 9651 },
+    { 38634, 7, 1, 0, 9651 },
+    { 38641, 8, 1, 0, 9651 },
+    { 38649, 6, 1, 0, 9651 },
+    { 38655, 5, 1, 0, 9651 },
+    { 38660, 7, 1, 0, 9651 },
+    { 38667, 8, 1, 0, 9651 },
+    { 38675, 8, 1, 0, 9651 },
+    { 38683, 5, 1, 0, 9651 },
+    { 38688, 7, 1, 0, 9651 },
+    { 38695, 9, 1, 0, 9651 },
+    { 38704, 10, 1, 0, 9651 },
+    { 38714, 7, 1, 0, 9651 },
+    { 38721, 12, 1, 0, 9651 },
+    { 38733, 13, 1, 0, 9651 },
+    { 38746, 6, 1, 0, 9651 },
+    { 38752, 7, 1, 0, 9651 },
+    { 38759, 9, 1, 0, 9651 },
+    { 38768, 5, 1, 0, 9651 },
+    { 38773, 8, 1, 0, 9651 },
+    { 38781, 3, 1, 0, 9651 },
+    { 38784, 5, 1, 0, 9651 },
+    { 38789, 5, 1, 0, 9651 },
+    { 38794, 7, 1, 0, 9651 },
+    { 38801, 2, 1, 1, 9651 },
+    { 38803, 7, 1, 0, 9652 },
+    { 38810, 6, 1, 0, 9652 },
+    { 38816, 6, 1, 0, 9652 },
+    { 38822, 6, 1, 0, 9652 },
+    { 38828, 6, 1, 0, 9652 },
+    { 38834, 8, 1, 0, 9652 },
+    { 38842, 5, 1, 0, 9652 },
+    { 38847, 7, 1, 0, 9652 },
+    { 38854, 13, 1, 0, 9652 },
+    { 38867, 3, 1, 0, 9652 },
+    { 38870, 5, 1, 0, 9652 },
+    { 38875, 7, 1, 0, 9652 },
+    { 38882, 8, 1, 0, 9652 },
+    { 38890, 8, 1, 0, 9652 },
+    { 38898, 5, 1, 0, 9652 },
+    { 38903, 8, 1, 0, 9652 },
+    { 38911, 9, 1, 0, 9652 },
+    { 38920, 6, 1, 0, 9652 },
+    { 38926, 6, 1, 0, 9652 },
+    { 38932, 7, 1, 0, 9652 },
+    { 38939, 9, 1, 0, 9652 },
+    { 38948, 7, 1, 0, 9652 },
+    { 38955, 5, 1, 0, 9652 },
+    { 38960, 6, 1, 0, 9652 },
+    { 38966, 6, 1, 0, 9652 },
+    { 38972, 5, 1, 0, 9652 },
+    { 38977, 10, 1, 0, 9652 },
+    { 38987, 6, 1, 0, 9652 },
+    { 38993, 7, 1, 0, 9652 },
+    { 39000, 6, 1, 0, 9652 },
+    { 39006, 7, 1, 0, 9652 },
+    { 39013, 5, 1, 0, 9652 },
+    { 39018, 7, 1, 0, 9652 },
+    { 39025, 4, 1, 0, 9652 },
+    { 39029, 6, 1, 0, 9652 },
+    { 39035, 5, 1, 0, 9652 },
+    { 39040, 11, 1, 0, 9652 },
+    { 39051, 9, 1, 0, 9652 },
+    { 39060, 10, 1, 0, 9652 },
+    { 39070, 8, 1, 0, 9652 },
+    { 39078, 8, 1, 0, 9652 },
+    { 39086, 12, 1, 0, 9652 },
+    { 39098, 7, 1, 0, 9652 },
+    { 39105, 8, 1, 0, 9652 },
+    { 39113, 8, 1, 0, 9652 },
+    { 39121, 5, 1, 0, 9652 },
+    { 39126, 10, 1, 0, 9652 },
+    { 39136, 9, 1, 0, 9652 },
+    { 39145, 2, 1, 1, 9652 },
+    { 39147, 6, 1, 0, 9653 },
+    { 39153, 4, 1, 0, 9653 },
+    { 39157, 9, 1, 0, 9653 },
+    { 39166, 9, 1, 0, 9653 },
+    { 39175, 7, 1, 0, 9653 },
+    { 39182, 7, 1, 0, 9653 },
+    { 39189, 9, 1, 0, 9653 },
+    { 39198, 8, 1, 0, 9653 },
+    { 39206, 15, 1, 0, 9653 },
+    { 39221, 9, 1, 0, 9653 },
+    { 39230, 16, 1, 0, 9653 },
+    { 39246, 6, 1, 0, 9653 },
+    { 39252, 11, 1, 0, 9653 },
+    { 39263, 5, 1, 0, 9653 },
+    { 39268, 7, 1, 0, 9653 },
+    { 39275, 9, 1, 0, 9653 },
+    { 39284, 6, 1, 0, 9653 },
+    { 39290, 7, 1, 0, 9653 },
+    { 39297, 5, 1, 0, 9653 },
+    { 39302, 4, 1, 0, 9653 },
+    { 39306, 6, 1, 0, 9653 },
+    { 39312, 4, 1, 0, 9653 },
+    { 39316, 7, 1, 0, 9653 },
+    { 39323, 8, 1, 0, 9653 },
+    { 39331, 8, 1, 1, 9653 },
+    { 39339, 5, 1, 0, 9654 },
+    { 39344, 7, 1, 0, 9654 },
+    { 39351, 9, 1, 0, 9654 },
+    { 39360, 6, 1, 0, 9654 },
+    { 39366, 7, 1, 0, 9654 },
+    { 39373, 6, 1, 0, 9654 },
+    { 39379, 6, 1, 0, 9654 },
+    { 39385, 12, 1, 0, 9654 },
+    { 39397, 11, 1, 0, 9654 },
+    { 39408, 9, 1, 0, 9654 },
+    { 39417, 9, 1, 0, 9654 },
+    { 39426, 13, 1, 0, 9654 },
+    { 39439, 8, 1, 0, 9654 },
+    { 39447, 9, 1, 0, 9654 },
+    { 39456, 6, 1, 0, 9654 },
+    { 39462, 4, 1, 0, 9654 },
+    { 39466, 8, 1, 0, 9654 },
+    { 39474, 8, 0, 3, 9654 },
+    { 39482, 4, 1, 0, 9657 },
+    { 39486, 8, 1, 0, 9657 },
+    { 39494, 4, 1, 0, 9657 },
+    { 39498, 9, 1, 0, 9657 },
+    { 39507, 5, 1, 0, 9657 },
+    { 39512, 6, 1, 0, 9657 },
+    { 39518, 2, 1, 1, 9657 },
+    { 39520, 5, 1, 0, 9658 },
+    { 39525, 5, 1, 0, 9658 },
+    { 39530, 8, 1, 0, 9658 },
+    { 39538, 7, 1, 0, 9658 },
+    { 39545, 2, 1, 1, 9658 },
+    { 39547, 5, 1, 0, 9659 },
+    { 39552, 6, 1, 0, 9659 },
+    { 39558, 6, 1, 0, 9659 },
+    { 39564, 7, 1, 0, 9659 },
+    { 39571, 8, 1, 0, 9659 },
+    { 39579, 8, 1, 0, 9659 },
+    { 39587, 6, 1, 0, 9659 },
+    { 39593, 6, 1, 0, 9659 },
+    { 39599, 7, 1, 0, 9659 },
+    { 39606, 9, 1, 0, 9659 },
+    { 39615, 6, 1, 0, 9659 },
+    { 39621, 6, 1, 0, 9659 },
+    { 39627, 9, 1, 0, 9659 },
+    { 39636, 11, 1, 0, 9659 },
+    { 39647, 5, 1, 0, 9659 },
+    { 39652, 6, 1, 0, 9659 },
+    { 39658, 8, 1, 0, 9659 },
+    { 39666, 6, 1, 0, 9659 },
+    { 39672, 6, 1, 0, 9659 },
+    { 39678, 7, 1, 0, 9659 },
+    { 39685, 9, 1, 0, 9659 },
+    { 39694, 10, 1, 0, 9659 },
+    { 39704, 10, 1, 0, 9659 },
+    { 39714, 5, 1, 0, 9659 },
+    { 39719, 7, 1, 0, 9659 },
+    { 39726, 8, 1, 0, 9659 },
+    { 39734, 6, 1, 0, 9659 },
+    { 39740, 2, 1, 1, 9659 },
+    { 39742, 7, 1, 0, 9660 },
+    { 39749, 5, 1, 0, 9660 },
+    { 39754, 6, 1, 0, 9660 },
+    { 39760, 4, 1, 0, 9660 },
+    { 39764, 5, 1, 0, 9660 },
+    { 39769, 6, 1, 0, 9660 },
+    { 39775, 7, 1, 0, 9660 },
+    { 39782, 5, 1, 0, 9660 },
+    { 39787, 4, 1, 0, 9660 },
+    { 39791, 8, 1, 0, 9660 },
+    { 39799, 5, 1, 0, 9660 },
+    { 39804, 6, 1, 0, 9660 },
+    { 39810, 7, 1, 0, 9660 },
+    { 39817, 5, 1, 0, 9660 },
+    { 39822, 5, 1, 0, 9660 },
+    { 39827, 4, 1, 0, 9660 },
+    { 39831, 9, 1, 0, 9660 },
+    { 39840, 10, 1, 0, 9660 },
+    { 39850, 8, 1, 0, 9660 },
+    { 39858, 6, 1, 0, 9660 },
+    { 39864, 6, 1, 0, 9660 },
+    { 39870, 6, 1, 0, 9660 },
+    { 39876, 8, 0, 1, 9660 },
+    { 39884, 7, 1, 0, 9661 },
+    { 39891, 13, 1, 0, 9661 },
+    { 39904, 12, 1, 0, 9661 },
+    { 39916, 9, 1, 0, 9661 },
+    { 39925, 11, 1, 0, 9661 },
+    { 39936, 9, 1, 0, 9661 },
+    { 39945, 2, 1, 1, 9661 },
+    { 39947, 3, 1, 0, 9662 },
+    { 39950, 3, 1, 0, 9662 },
+    { 39953, 5, 1, 0, 9662 },
+    { 39958, 10, 1, 0, 9662 },
+    { 39968, 6, 1, 0, 9662 },
+    { 39974, 5, 1, 0, 9662 },
+    { 39979, 4, 1, 0, 9662 },
+    { 39983, 11, 1, 0, 9662 },
+    { 39994, 9, 1, 0, 9662 },
+    { 40003, 6, 1, 0, 9662 },
+    { 40009, 8, 1, 0, 9662 },
+    { 40017, 6, 1, 0, 9662 },
+    { 40023, 7, 1, 0, 9662 },
+    { 40030, 12, 1, 0, 9662 },
+    { 40042, 12, 1, 0, 9662 },
+    { 40054, 21, 1, 0, 9662 },
+    { 40075, 13, 1, 0, 9662 },
+    { 40088, 15, 1, 0, 9662 },
+    { 40103, 18, 1, 0, 9662 },
+    { 40121, 15, 1, 0, 9662 },
+    { 40136, 18, 1, 0, 9662 },
+    { 40154, 19, 1, 0, 9662 },
+    { 40173, 13, 1, 0, 9662 },
+    { 40186, 13, 1, 0, 9662 },
+    { 40199, 14, 1, 0, 9662 },
+    { 40213, 14, 1, 0, 9662 },
+    { 40227, 12, 1, 0, 9662 },
+    { 40239, 12, 1, 0, 9662 },
+    { 40251, 11, 1, 0, 9662 },
+    { 40262, 14, 1, 0, 9662 },
+    { 40276, 18, 1, 0, 9662 },
+    { 40294, 12, 1, 0, 9662 },
+    { 40306, 16, 1, 0, 9662 },
+    { 40322, 18, 1, 0, 9662 },
+    { 40340, 12, 1, 0, 9662 },
+    { 40352, 13, 1, 0, 9662 },
+    { 40365, 12, 1, 0, 9662 },
+    { 40377, 17, 1, 0, 9662 },
+    { 40394, 13, 1, 0, 9662 },
+    { 40407, 13, 1, 0, 9662 },
+    { 40420, 10, 1, 0, 9662 },
+    { 40430, 12, 1, 0, 9662 },
+    { 40442, 12, 1, 0, 9662 },
+    { 40454, 12, 1, 0, 9662 },
+    { 40466, 12, 1, 0, 9662 },
+    { 40478, 19, 1, 0, 9662 },
+    { 40497, 16, 1, 0, 9662 },
+    { 40513, 16, 1, 0, 9662 },
+    { 40529, 13, 1, 0, 9662 },
+    { 40542, 12, 1, 0, 9662 },
+    { 40554, 9, 1, 0, 9662 },
+    { 40563, 13, 1, 0, 9662 },
+    { 40576, 19, 1, 0, 9662 },
+    { 40595, 17, 1, 0, 9662 },
+    { 40612, 19, 1, 0, 9662 },
+    { 40631, 15, 1, 0, 9662 },
+    { 40646, 12, 1, 0, 9662 },
+    { 40658, 15, 1, 0, 9662 },
+    { 40673, 13, 1, 0, 9662 },
+    { 40686, 15, 1, 0, 9662 },
+    { 40701, 16, 1, 0, 9662 },
+    { 40717, 14, 1, 0, 9662 },
+    { 40731, 14, 1, 0, 9662 },
+    { 40745, 16, 1, 0, 9662 },
+    { 40761, 13, 1, 0, 9662 },
+    { 40774, 14, 1, 0, 9662 },
+    { 40788, 12, 1, 0, 9662 },
+    { 40800, 19, 1, 0, 9662 },
+    { 40819, 14, 1, 0, 9662 },
+    { 40833, 16, 1, 0, 9662 },
+    { 40849, 17, 1, 0, 9662 },
+    { 40866, 15, 1, 0, 9662 },
+    { 40881, 19, 1, 0, 9662 },
+    { 40900, 13, 1, 0, 9662 },
+    { 40913, 15, 1, 0, 9662 },
+    { 40928, 14, 1, 0, 9662 },
+    { 40942, 16, 1, 0, 9662 },
+    { 40958, 9, 1, 0, 9662 },
+    { 40967, 16, 1, 0, 9662 },
+    { 40983, 15, 1, 0, 9662 },
+    { 40998, 15, 1, 0, 9662 },
+    { 41013, 18, 1, 0, 9662 },
+    { 41031, 14, 1, 0, 9662 },
+    { 41045, 13, 1, 0, 9662 },
+    { 41058, 13, 1, 0, 9662 },
+    { 41071, 13, 1, 0, 9662 },
+    { 41084, 13, 1, 0, 9662 },
+    { 41097, 13, 1, 0, 9662 },
+    { 41110, 16, 1, 0, 9662 },
+    { 41126, 11, 1, 0, 9662 },
+    { 41137, 12, 1, 0, 9662 },
+    { 41149, 12, 1, 0, 9662 },
+    { 41161, 12, 1, 0, 9662 },
+    { 41173, 14, 1, 0, 9662 },
+    { 41187, 16, 1, 0, 9662 },
+    { 41203, 18, 1, 0, 9662 },
+    { 41221, 11, 1, 0, 9662 },
+    { 41232, 14, 1, 0, 9662 },
+    { 41246, 14, 1, 0, 9662 },
+    { 41260, 14, 1, 0, 9662 },
+    { 41274, 11, 1, 0, 9662 },
+    { 41285, 22, 0, 2, 9662 },
+    { 41307, 13, 1, 0, 9664 },
+    { 41320, 20, 1, 0, 9664 },
+    { 41340, 13, 1, 0, 9664 },
+    { 41353, 21, 1, 0, 9664 },
+    { 41374, 13, 1, 0, 9664 },
+    { 41387, 15, 1, 0, 9664 },
+    { 41402, 15, 1, 0, 9664 },
+    { 41417, 15, 1, 0, 9664 },
+    { 41432, 14, 1, 0, 9664 },
+    { 41446, 13, 1, 0, 9664 },
+    { 41459, 17, 1, 0, 9664 },
+    { 41476, 12, 1, 0, 9664 },
+    { 41488, 12, 1, 0, 9664 },
+    { 41500, 11, 1, 0, 9664 },
+    { 41511, 12, 1, 0, 9664 },
+    { 41523, 15, 1, 0, 9664 },
+    { 41538, 18, 1, 0, 9664 },
+    { 41556, 13, 1, 0, 9664 },
+    { 41569, 12, 1, 0, 9664 },
+    { 41581, 12, 1, 0, 9664 },
+    { 41593, 13, 1, 0, 9664 },
+    { 41606, 15, 1, 0, 9664 },
+    { 41621, 14, 1, 0, 9664 },
+    { 41635, 12, 1, 0, 9664 },
+    { 41647, 13, 1, 0, 9664 },
+    { 41660, 11, 1, 0, 9664 },
+    { 41671, 12, 1, 0, 9664 },
+    { 41683, 13, 1, 0, 9664 },
+    { 41696, 14, 1, 0, 9664 },
+    { 41710, 9, 1, 0, 9664 },
+    { 41719, 19, 1, 0, 9664 },
+    { 41738, 13, 1, 0, 9664 },
+    { 41751, 13, 1, 0, 9664 },
+    { 41764, 12, 1, 0, 9664 },
+    { 41776, 14, 1, 0, 9664 },
+    { 41790, 15, 1, 0, 9664 },
+    { 41805, 12, 1, 0, 9664 },
+    { 41817, 13, 1, 0, 9664 },
+    { 41830, 15, 1, 0, 9664 },
+    { 41845, 12, 1, 0, 9664 },
+    { 41857, 12, 1, 0, 9664 },
+    { 41869, 12, 1, 0, 9664 },
+    { 41881, 12, 1, 0, 9664 },
+    { 41893, 13, 1, 0, 9664 },
+    { 41906, 18, 1, 0, 9664 },
+    { 41924, 12, 1, 0, 9664 },
+    { 41936, 12, 1, 0, 9664 },
+    { 41948, 17, 1, 0, 9664 },
+    { 41965, 15, 1, 0, 9664 },
+    { 41980, 15, 1, 0, 9664 },
+    { 41995, 19, 1, 0, 9664 },
+    { 42014, 14, 1, 0, 9664 },
+    { 42028, 15, 1, 0, 9664 },
+    { 42043, 12, 1, 0, 9664 },
+    { 42055, 14, 0, 1, 9664 },
+    { 42069, 15, 1, 0, 9665 },
+    { 42084, 22, 1, 0, 9665 },
+    { 42106, 18, 1, 0, 9665 },
+    { 42124, 12, 1, 0, 9665 },
+    { 42136, 15, 1, 0, 9665 },
+    { 42151, 13, 1, 0, 9665 },
+    { 42164, 15, 1, 0, 9665 },
+    { 42179, 12, 1, 0, 9665 },
+    { 42191, 13, 1, 0, 9665 },
+    { 42204, 13, 1, 0, 9665 },
+    { 42217, 14, 1, 0, 9665 },
+    { 42231, 12, 1, 0, 9665 },
+    { 42243, 12, 1, 0, 9665 },
+    { 42255, 16, 1, 0, 9665 },
+    { 42271, 17, 1, 0, 9665 },
+    { 42288, 11, 1, 0, 9665 },
+    { 42299, 12, 1, 0, 9665 },
+    { 42311, 14, 1, 0, 9665 },
+    { 42325, 17, 1, 0, 9665 },
+    { 42342, 14, 1, 0, 9665 },
+    { 42356, 13, 1, 0, 9665 },
+    { 42369, 11, 1, 0, 9665 },
+    { 42380, 15, 1, 0, 9665 },
+    { 42395, 20, 1, 0, 9665 },
+    { 42415, 12, 1, 0, 9665 },
+    { 42427, 10, 1, 0, 9665 },
+    { 42437, 6, 1, 0, 9665 },
+    { 42443, 7, 1, 0, 9665 },
+    { 42450, 9, 1, 0, 9665 },
+    { 42459, 3, 1, 0, 9665 },
+    { 42462, 8, 1, 0, 9665 },
+    { 42470, 8, 1, 0, 9665 },
+    { 42478, 5, 1, 0, 9665 },
+    { 42483, 5, 1, 0, 9665 },
+    { 42488, 6, 1, 0, 9665 },
+    { 42494, 3, 1, 0, 9665 },
+    { 42497, 7, 1, 0, 9665 },
+    { 42504, 6, 1, 0, 9665 },
+    { 42510, 7, 1, 0, 9665 },
+    { 42517, 7, 1, 0, 9665 },
+    { 42524, 7, 1, 0, 9665 },
+    { 42531, 6, 1, 0, 9665 },
+    { 42537, 8, 0, 1, 9665 },
+    { 42545, 12, 1, 0, 9666 },
+    { 42557, 11, 1, 0, 9666 },
+    { 42568, 5, 1, 0, 9666 },
+    { 42573, 9, 1, 0, 9666 },
+    { 42582, 14, 1, 0, 9666 },
+    { 42596, 12, 1, 0, 9666 },
+    { 42608, 3, 1, 0, 9666 },
+    { 42611, 3, 1, 0, 9666 },
+    { 42614, 3, 1, 0, 9666 },
+    { 42617, 3, 1, 0, 9666 },
+    { 42620, 4, 1, 0, 9666 },
+    { 42624, 3, 1, 0, 9666 },
+    { 42627, 3, 1, 0, 9666 },
+    { 42630, 15, 1, 0, 9666 },
+    { 42645, 8, 1, 0, 9666 },
+    { 42653, 4, 1, 0, 9666 },
+    { 42657, 8, 1, 0, 9666 },
+    { 42665, 2, 1, 0, 9666 },
+    { 42667, 2, 1, 1, 9666 },
+    { 42669, 3, 1, 0, 9667 },
+    { 42672, 4, 1, 0, 9667 },
+    { 42676, 3, 1, 0, 9667 },
+    { 42679, 4, 1, 0, 9667 },
+    { 42683, 6, 1, 0, 9667 },
+    { 42689, 3, 1, 0, 9667 },
+    { 42692, 4, 1, 0, 9667 },
+    { 42696, 5, 1, 0, 9667 },
+    { 42701, 3, 1, 0, 9667 },
+    { 42704, 6, 1, 0, 9667 },
+    { 42710, 3, 1, 0, 9667 },
+    { 42713, 3, 1, 0, 9667 },
+    { 42716, 10, 1, 0, 9667 },
+    { 42726, 6, 1, 0, 9667 },
+    { 42732, 12, 1, 0, 9667 },
+    { 42744, 2, 1, 0, 9667 },
+    { 42746, 3, 1, 0, 9667 },
+    { 42749, 3, 1, 0, 9667 },
+    { 42752, 3, 1, 0, 9667 },
+    { 42755, 3, 1, 0, 9667 },
+    { 42758, 6, 1, 0, 9667 },
+    { 42764, 3, 1, 0, 9667 },
+    { 42767, 3, 1, 0, 9667 },
+    { 42770, 3, 1, 0, 9667 },
+    { 42773, 8, 1, 0, 9667 },
+    { 42781, 5, 1, 1, 9667 },
+    { 42786, 7, 1, 0, 9668 },
+    { 42793, 5, 1, 0, 9668 },
+    { 42798, 4, 1, 0, 9668 },
+    { 42802, 10, 1, 0, 9668 },
+    { 42812, 4, 1, 0, 9668 },
+    { 42816, 9, 1, 0, 9668 },
+    { 42825, 2, 1, 0, 9668 },
+    { 42827, 10, 1, 0, 9668 },
+    { 42837, 5, 0, 1, 9668 },
+    { 42842, 5, 1, 0, 9669 },
+    { 42847, 7, 1, 0, 9669 },
+    { 42854, 8, 1, 0, 9669 },
+    { 42862, 14, 1, 0, 9669 },
+    { 42876, 18, 1, 0, 9669 },
+    { 42894, 11, 1, 0, 9669 },
+    { 42905, 6, 1, 0, 9669 },
+    { 42911, 5, 0, 2, 9669 },
+    { 42916, 12, 0, 1, 9671 },
+    { 42928, 7, 1, 0, 9672 },
+    { 42935, 7, 1, 0, 9672 },
+    { 42942, 10, 1, 0, 9672 },
+    { 42952, 16, 1, 0, 9672 },
+    { 42968, 5, 1, 0, 9672 },
+    { 42973, 11, 1, 0, 9672 },
+    { 42984, 8, 1, 0, 9672 },
+    { 42992, 7, 1, 0, 9672 },
+    { 42999, 11, 1, 0, 9672 },
+    { 43010, 9, 1, 0, 9672 },
+    { 43019, 7, 1, 0, 9672 },
+    { 43026, 7, 1, 0, 9672 },
+    { 43033, 7, 1, 0, 9672 },
+    { 43040, 6, 1, 0, 9672 },
+    { 43046, 8, 1, 0, 9672 },
+    { 43054, 6, 1, 2, 9672 },
+    { 43060, 7, 1, 0, 9674 },
+    { 43067, 13, 1, 0, 9674 },
+    { 43080, 16, 1, 0, 9674 },
+    { 43096, 2, 1, 55, 9674 },
+    { 43098, 8, 1, 0, 9729 },
+    { 43106, 16, 1, 0, 9729 },
+    { 43122, 12, 1, 0, 9729 },
+    { 43134, 13, 0, 3, 9729 },
+    { 43147, 8, 1, 0, 9732 },
+    { 43155, 11, 1, 0, 9732 },
+    { 43166, 7, 1, 0, 9732 },
+    { 43173, 9, 1, 0, 9732 },
+    { 43182, 6, 1, 0, 9732 },
+    { 43188, 8, 1, 0, 9732 },
+    { 43196, 2, 1, 0, 9732 },
+    { 43198, 10, 1, 0, 9732 },
+    { 43208, 7, 1, 0, 9732 },
+    { 43215, 7, 1, 0, 9732 },
+    { 43222, 9, 1, 0, 9732 },
+    { 43231, 8, 1, 0, 9732 },
+    { 43239, 5, 1, 0, 9732 },
+    { 43244, 7, 1, 0, 9732 },
+    { 43251, 6, 1, 0, 9732 },
+    { 43257, 6, 1, 0, 9732 },
+    { 43263, 14, 1, 0, 9732 },
+    { 43277, 14, 1, 0, 9732 },
+    { 43291, 15, 1, 0, 9732 },
+    { 43306, 9, 1, 0, 9732 },
+    { 43315, 9, 1, 0, 9732 },
+    { 43324, 11, 1, 0, 9732 },
+    { 43335, 15, 1, 0, 9732 },
+    { 43350, 12, 1, 0, 9732 },
+    { 43362, 11, 1, 0, 9732 },
+    { 43373, 8, 1, 0, 9732 },
+    { 43381, 7, 1, 0, 9732 },
+    { 43388, 8, 1, 0, 9732 },
+    { 43396, 11, 1, 0, 9732 },
+    { 43407, 12, 1, 0, 9732 },
+    { 43419, 12, 1, 0, 9732 },
+    { 43431, 12, 1, 0, 9732 },
+    { 43443, 13, 1, 0, 9732 },
+    { 43456, 8, 1, 0, 9732 },
+    { 43464, 2, 1, 0, 9732 },
+    { 43466, 9, 1, 0, 9732 },
+    { 43475, 8, 1, 0, 9732 },
+    { 43483, 11, 1, 0, 9732 },
+    { 43494, 6, 1, 0, 9732 },
+    { 43500, 11, 1, 0, 9732 },
+    { 43511, 11, 1, 0, 9732 },
+    { 43522, 10, 1, 0, 9732 },
+    { 43532, 5, 1, 0, 9732 },
+    { 43537, 16, 1, 0, 9732 },
+    { 43553, 6, 1, 0, 9732 },
+    { 43559, 6, 1, 0, 9732 },
+    { 43565, 5, 1, 0, 9732 },
+    { 43570, 7, 1, 0, 9732 },
+    { 43577, 8, 1, 0, 9732 },
+    { 43585, 7, 1, 0, 9732 },
+    { 43592, 7, 1, 0, 9732 },
+    { 43599, 7, 1, 0, 9732 },
+    { 43606, 6, 1, 0, 9732 },
+    { 43612, 10, 1, 0, 9732 },
+    { 43622, 10, 1, 0, 9732 },
+    { 43632, 6, 1, 0, 9732 },
+    { 43638, 13, 1, 0, 9732 },
+    { 43651, 8, 1, 0, 9732 },
+    { 43659, 8, 1, 0, 9732 },
+    { 43667, 9, 1, 0, 9732 },
+    { 43676, 9, 1, 0, 9732 },
+    { 43685, 5, 1, 0, 9732 },
+    { 43690, 12, 1, 0, 9732 },
+    { 43702, 11, 1, 0, 9732 },
+    { 43713, 7, 0, 1, 9732 },
+    { 43720, 9, 1, 0, 9733 },
+    { 43729, 4, 1, 0, 9733 },
+    { 43733, 9, 1, 0, 9733 },
+    { 43742, 6, 1, 0, 9733 },
+    { 43748, 6, 1, 0, 9733 },
+    { 43754, 2, 1, 0, 9733 },
+    { 43756, 6, 1, 0, 9733 },
+    { 43762, 11, 1, 0, 9733 },
+    { 43773, 7, 1, 0, 9733 },
+    { 43780, 7, 1, 0, 9733 },
+    { 43787, 2, 1, 0, 9733 },
+    { 43789, 5, 1, 0, 9733 },
+    { 43794, 7, 1, 0, 9733 },
+    { 43801, 3, 1, 0, 9733 },
+    { 43804, 2, 1, 0, 9733 },
+    { 43806, 3, 1, 0, 9733 },
+    { 43809, 3, 1, 0, 9733 },
+    { 43812, 3, 1, 0, 9733 },
+    { 43815, 3, 1, 0, 9733 },
+    { 43818, 3, 1, 0, 9733 },
+    { 43821, 3, 1, 0, 9733 },
+    { 43824, 3, 1, 0, 9733 },
+    { 43827, 3, 1, 0, 9733 },
+    { 43830, 3, 1, 0, 9733 },
+    { 43833, 8, 1, 0, 9733 },
+    { 43841, 3, 1, 0, 9733 },
+    { 43844, 4, 1, 0, 9733 },
+    { 43848, 6, 1, 0, 9733 },
+    { 43854, 4, 1, 0, 9733 },
+    { 43858, 5, 1, 0, 9733 },
+    { 43863, 5, 1, 0, 9733 },
+    { 43868, 5, 1, 0, 9733 },
+    { 43873, 10, 1, 0, 9733 },
+    { 43883, 3, 1, 0, 9733 },
+    { 43886, 8, 1, 0, 9733 },
+    { 43894, 3, 1, 0, 9733 },
+    { 43897, 3, 1, 0, 9733 },
+    { 43900, 3, 1, 0, 9733 },
+    { 43903, 3, 1, 0, 9733 },
+    { 43906, 3, 1, 0, 9733 },
+    { 43909, 3, 1, 0, 9733 },
+    { 43912, 3, 1, 0, 9733 },
+    { 43915, 3, 1, 0, 9733 },
+    { 43918, 3, 1, 0, 9733 },
+    { 43921, 3, 1, 0, 9733 },
+    { 43924, 3, 1, 0, 9733 },
+    { 43927, 3, 1, 0, 9733 },
+    { 43930, 3, 1, 0, 9733 },
+    { 43933, 1, 1, 0, 9733 },
+    { 43934, 3, 1, 0, 9733 },
+    { 43937, 3, 1, 0, 9733 },
+    { 43940, 3, 1, 0, 9733 },
+    { 43943, 3, 1, 0, 9733 },
+    { 43946, 6, 1, 0, 9733 },
+    { 43952, 4, 1, 0, 9733 },
+    { 43956, 3, 1, 0, 9733 },
+    { 43959, 3, 1, 0, 9733 },
+    { 43962, 3, 1, 0, 9733 },
+    { 43965, 3, 1, 0, 9733 },
+    { 43968, 3, 1, 0, 9733 },
+    { 43971, 3, 1, 0, 9733 },
+    { 43974, 3, 1, 0, 9733 },
+    { 43977, 3, 1, 0, 9733 },
+    { 43980, 3, 1, 0, 9733 },
+    { 43983, 3, 1, 0, 9733 },
+    { 43986, 4, 1, 0, 9733 },
+    { 43990, 3, 1, 0, 9733 },
+    { 43993, 3, 1, 0, 9733 },
+    { 43996, 3, 1, 0, 9733 },
+    { 43999, 4, 1, 0, 9733 },
+    { 44003, 3, 1, 0, 9733 },
+    { 44006, 3, 1, 0, 9733 },
+    { 44009, 3, 1, 0, 9733 },
+    { 44012, 8, 1, 0, 9733 },
+    { 44020, 4, 1, 0, 9733 },
+    { 44024, 10, 1, 0, 9733 },
+    { 44034, 6, 1, 0, 9733 },
+    { 44040, 4, 1, 0, 9733 },
+    { 44044, 7, 1, 0, 9733 },
+    { 44051, 10, 1, 0, 9733 },
+    { 44061, 9, 1, 0, 9733 },
+    { 44070, 7, 1, 0, 9733 },
+    { 44077, 10, 1, 0, 9733 },
+    { 44087, 3, 1, 0, 9733 },
+    { 44090, 11, 1, 0, 9733 },
+    { 44101, 9, 1, 0, 9733 },
+    { 44110, 5, 1, 0, 9733 },
+    { 44115, 7, 1, 0, 9733 },
+    { 44122, 2, 1, 0, 9733 },
+    { 44124, 3, 1, 0, 9733 },
+    { 44127, 7, 1, 0, 9733 },
+    { 44134, 5, 1, 0, 9733 },
+    { 44139, 9, 1, 0, 9733 },
+    { 44148, 14, 1, 0, 9733 },
+    { 44162, 3, 1, 0, 9733 },
+    { 44165, 6, 1, 0, 9733 },
+    { 44171, 3, 1, 0, 9733 },
+    { 44174, 3, 1, 0, 9733 },
+    { 44177, 6, 1, 0, 9733 },
+    { 44183, 6, 1, 0, 9733 },
+    { 44189, 7, 1, 0, 9733 },
+    { 44196, 6, 1, 0, 9733 },
+    { 44202, 5, 1, 0, 9733 },
+    { 44207, 7, 1, 0, 9733 },
+    { 44214, 7, 1, 0, 9733 },
+    { 44221, 3, 1, 47, 9733 },
+    { 44224, 7, 1, 0, 9780 },
+    { 44231, 3, 1, 0, 9780 },
+    { 44234, 9, 1, 0, 9780 },
+    { 44243, 5, 1, 0, 9780 },
+    { 44248, 4, 1, 0, 9780 },
+    { 44252, 8, 1, 0, 9780 },
+    { 44260, 12, 1, 0, 9780 },
+    { 44272, 5, 1, 0, 9780 },
+    { 44277, 6, 1, 0, 9780 },
+    { 44283, 7, 1, 0, 9780 },
+    { 44290, 7, 1, 0, 9780 },
+    { 44297, 7, 1, 0, 9780 },
+    { 44304, 8, 1, 0, 9780 },
+    { 44312, 15, 1, 0, 9780 },
+    { 44327, 5, 1, 0, 9780 },
+    { 44332, 7, 1, 0, 9780 },
+    { 44339, 7, 1, 0, 9780 },
+    { 44346, 10, 1, 0, 9780 },
+    { 44356, 9, 1, 0, 9780 },
+    { 44365, 5, 1, 0, 9780 },
+    { 44370, 10, 1, 0, 9780 },
+    { 44380, 6, 1, 0, 9780 },
+    { 44386, 7, 1, 0, 9780 },
+    { 44393, 5, 1, 0, 9780 },
+    { 44398, 4, 1, 0, 9780 },
+    { 44402, 6, 1, 0, 9780 },
+    { 44408, 6, 1, 0, 9780 },
+    { 44414, 7, 1, 0, 9780 },
+    { 44421, 7, 1, 0, 9780 },
+    { 44428, 8, 1, 0, 9780 },
+    { 44436, 5, 1, 0, 9780 },
+    { 44441, 6, 1, 0, 9780 },
+    { 44447, 8, 1, 0, 9780 },
+    { 44455, 5, 1, 0, 9780 },
+    { 44460, 6, 1, 0, 9780 },
+    { 44466, 5, 1, 0, 9780 },
+    { 44471, 4, 1, 0, 9780 },
+    { 44475, 7, 1, 0, 9780 },
+    { 44482, 10, 1, 0, 9780 },
+    { 44492, 8, 1, 0, 9780 },
+    { 44500, 6, 1, 0, 9780 },
+    { 44506, 3, 1, 0, 9780 },
+    { 44509, 5, 1, 0, 9780 },
+    { 44514, 6, 1, 0, 9780 },
+    { 44520, 6, 1, 0, 9780 },
+    { 44526, 6, 1, 0, 9780 },
+    { 44532, 3, 1, 0, 9780 },
+    { 44535, 7, 1, 0, 9780 },
+    { 44542, 12, 1, 0, 9780 },
+    { 44554, 5, 1, 0, 9780 },
+    { 44559, 3, 1, 0, 9780 },
+    { 44562, 13, 1, 0, 9780 },
+    { 44575, 3, 1, 0, 9780 },
+    { 44578, 8, 1, 0, 9780 },
+    { 44586, 4, 1, 0, 9780 },
+    { 44590, 5, 1, 0, 9780 },
+    { 44595, 6, 1, 0, 9780 },
+    { 44601, 6, 1, 0, 9780 },
+    { 44607, 7, 1, 0, 9780 },
+    { 44614, 7, 1, 0, 9780 },
+    { 44621, 5, 1, 0, 9780 },
+    { 44626, 3, 1, 0, 9780 },
+    { 44629, 7, 1, 0, 9780 },
+    { 44636, 9, 1, 0, 9780 },
+    { 44645, 9, 1, 0, 9780 },
+    { 44654, 10, 1, 0, 9780 },
+    { 44664, 2, 1, 0, 9780 },
+    { 44666, 4, 1, 0, 9780 },
+    { 44670, 4, 1, 0, 9780 },
+    { 44674, 7, 1, 0, 9780 },
+    { 44681, 8, 1, 0, 9780 },
+    { 44689, 9, 1, 0, 9780 },
+    { 44698, 9, 1, 0, 9780 },
+    { 44707, 7, 1, 0, 9780 },
+    { 44714, 9, 1, 0, 9780 },
+    { 44723, 6, 1, 0, 9780 },
+    { 44729, 6, 1, 0, 9780 },
+    { 44735, 4, 1, 0, 9780 },
+    { 44739, 10, 1, 0, 9780 },
+    { 44749, 8, 1, 0, 9780 },
+    { 44757, 9, 1, 0, 9780 },
+    { 44766, 6, 1, 0, 9780 },
+    { 44772, 5, 1, 0, 9780 },
+    { 44777, 8, 1, 0, 9780 },
+    { 44785, 10, 1, 0, 9780 },
+    { 44795, 3, 1, 0, 9780 },
+    { 44798, 6, 1, 0, 9780 },
+    { 44804, 7, 1, 0, 9780 },
+    { 44811, 5, 1, 0, 9780 },
+    { 44816, 8, 1, 0, 9780 },
+    { 44824, 5, 1, 0, 9780 },
+    { 44829, 3, 1, 0, 9780 },
+    { 44832, 4, 1, 0, 9780 },
+    { 44836, 9, 1, 0, 9780 },
+    { 44845, 10, 1, 0, 9780 },
+    { 44855, 5, 1, 0, 9780 },
+    { 44860, 7, 1, 0, 9780 },
+    { 44867, 5, 1, 0, 9780 },
+    { 44872, 6, 1, 0, 9780 },
+    { 44878, 5, 1, 0, 9780 },
+    { 44883, 3, 1, 0, 9780 },
+    { 44886, 9, 1, 0, 9780 },
+    { 44895, 12, 1, 0, 9780 },
+    { 44907, 12, 1, 0, 9780 },
+    { 44919, 8, 1, 0, 9780 },
+    { 44927, 7, 1, 0, 9780 },
+    { 44934, 8, 1, 0, 9780 },
+    { 44942, 7, 1, 0, 9780 },
+    { 44949, 10, 1, 0, 9780 },
+    { 44959, 11, 1, 0, 9780 },
+    { 44970, 8, 1, 0, 9780 },
+    { 44978, 8, 1, 0, 9780 },
+    { 44986, 6, 1, 0, 9780 },
+    { 44992, 5, 1, 0, 9780 },
+    { 44997, 10, 1, 0, 9780 },
+    { 45007, 5, 1, 0, 9780 },
+    { 45012, 2, 1, 0, 9780 },
+    { 45014, 7, 1, 0, 9780 },
+    { 45021, 6, 1, 0, 9780 },
+    { 45027, 5, 1, 0, 9780 },
+    { 45032, 9, 1, 0, 9780 },
+    { 45041, 5, 1, 0, 9780 },
+    { 45046, 8, 1, 0, 9780 },
+    { 45054, 5, 1, 0, 9780 },
+    { 45059, 9, 1, 0, 9780 },
+    { 45068, 6, 1, 0, 9780 },
+    { 45074, 8, 1, 0, 9780 },
+    { 45082, 3, 1, 0, 9780 },
+    { 45085, 6, 1, 0, 9780 },
+    { 45091, 6, 1, 0, 9780 },
+    { 45097, 5, 1, 0, 9780 },
+    { 45102, 9, 1, 0, 9780 },
+    { 45111, 9, 1, 0, 9780 },
+    { 45120, 7, 1, 0, 9780 },
+    { 45127, 4, 1, 0, 9780 },
+    { 45131, 7, 1, 0, 9780 },
+    { 45138, 9, 1, 0, 9780 },
+    { 45147, 5, 1, 0, 9780 },
+    { 45152, 8, 1, 0, 9780 },
+    { 45160, 5, 1, 0, 9780 },
+    { 45165, 5, 1, 0, 9780 },
+    { 45170, 9, 1, 0, 9780 },
+    { 45179, 2, 1, 0, 9780 },
+    { 45181, 4, 1, 0, 9780 },
+    { 45185, 3, 1, 0, 9780 },
+    { 45188, 2, 1, 0, 9780 },
+    { 45190, 3, 1, 0, 9780 },
+    { 45193, 3, 1, 0, 9780 },
+    { 45196, 3, 1, 0, 9780 },
+    { 45199, 3, 1, 0, 9780 },
+    { 45202, 5, 1, 0, 9780 },
+    { 45207, 2, 1, 0, 9780 },
+    { 45209, 3, 1, 0, 9780 },
+    { 45212, 3, 1, 0, 9780 },
+    { 45215, 3, 1, 0, 9780 },
+    { 45218, 3, 1, 0, 9780 },
+    { 45221, 3, 1, 0, 9780 },
+    { 45224, 4, 1, 0, 9780 },
+    { 45228, 4, 1, 0, 9780 },
+    { 45232, 4, 1, 0, 9780 },
+    { 45236, 3, 1, 0, 9780 },
+    { 45239, 3, 1, 0, 9780 },
+    { 45242, 3, 1, 0, 9780 },
+    { 45245, 4, 1, 0, 9780 },
+    { 45249, 3, 1, 0, 9780 },
+    { 45252, 3, 1, 0, 9780 },
+    { 45255, 4, 1, 0, 9780 },
+    { 45259, 6, 1, 0, 9780 },
+    { 45265, 3, 1, 0, 9780 },
+    { 45268, 5, 1, 0, 9780 },
+    { 45273, 7, 1, 0, 9780 },
+    { 45280, 3, 1, 0, 9780 },
+    { 45283, 8, 0, 1, 9780 },
+    { 45291, 3, 1, 0, 9781 },
+    { 45294, 3, 1, 0, 9781 },
+    { 45297, 3, 1, 0, 9781 },
+    { 45300, 3, 1, 0, 9781 },
+    { 45303, 5, 1, 0, 9781 },
+    { 45308, 3, 1, 0, 9781 },
+    { 45311, 3, 1, 0, 9781 },
+    { 45314, 3, 1, 0, 9781 },
+    { 45317, 3, 1, 0, 9781 },
+    { 45320, 3, 1, 0, 9781 },
+    { 45323, 3, 1, 0, 9781 },
+    { 45326, 3, 1, 0, 9781 },
+    { 45329, 12, 1, 0, 9781 },
+    { 45341, 8, 1, 0, 9781 },
+    { 45349, 3, 1, 0, 9781 },
+    { 45352, 3, 1, 0, 9781 },
+    { 45355, 3, 1, 0, 9781 },
+    { 45358, 3, 1, 0, 9781 },
+    { 45361, 3, 1, 0, 9781 },
+    { 45364, 4, 1, 0, 9781 },
+    { 45368, 3, 1, 0, 9781 },
+    { 45371, 4, 1, 0, 9781 },
+    { 45375, 5, 1, 0, 9781 },
+    { 45380, 5, 1, 0, 9781 },
+    { 45385, 7, 1, 0, 9781 },
+    { 45392, 2, 1, 0, 9781 },
+    { 45394, 2, 1, 0, 9781 },
+    { 45396, 2, 1, 0, 9781 },
+    { 45398, 2, 1, 0, 9781 },
+    { 45400, 2, 1, 0, 9781 },
+    { 45402, 4, 1, 0, 9781 },
+    { 45406, 3, 1, 0, 9781 },
+    { 45409, 4, 1, 0, 9781 },
+    { 45413, 3, 1, 0, 9781 },
+    { 45416, 3, 1, 0, 9781 },
+    { 45419, 3, 1, 0, 9781 },
+    { 45422, 3, 1, 0, 9781 },
+    { 45425, 3, 1, 0, 9781 },
+    { 45428, 8, 1, 0, 9781 },
+    { 45436, 3, 1, 0, 9781 },
+    { 45439, 3, 1, 0, 9781 },
+    { 45442, 3, 1, 0, 9781 },
+    { 45445, 3, 1, 0, 9781 },
+    { 45448, 4, 1, 0, 9781 },
+    { 45452, 3, 1, 0, 9781 },
+    { 45455, 3, 1, 0, 9781 },
+    { 45458, 3, 1, 0, 9781 },
+    { 45461, 4, 1, 0, 9781 },
+    { 45465, 8, 1, 0, 9781 },
+    { 45473, 3, 1, 0, 9781 },
+    { 45476, 3, 1, 0, 9781 },
+    { 45479, 3, 1, 0, 9781 },
+    { 45482, 4, 1, 0, 9781 },
+    { 45486, 4, 1, 0, 9781 },
+    { 45490, 5, 1, 0, 9781 },
+    { 45495, 8, 1, 0, 9781 },
+    { 45503, 2, 1, 0, 9781 },
+    { 45505, 3, 1, 0, 9781 },
+    { 45508, 4, 1, 0, 9781 },
+    { 45512, 4, 1, 0, 9781 },
+    { 45516, 3, 1, 0, 9781 },
+    { 45519, 2, 1, 0, 9781 },
+    { 45521, 3, 1, 0, 9781 },
+    { 45524, 3, 1, 0, 9781 },
+    { 45527, 4, 1, 0, 9781 },
+    { 45531, 5, 1, 0, 9781 },
+    { 45536, 2, 1, 0, 9781 },
+    { 45538, 3, 1, 0, 9781 },
+    { 45541, 9, 1, 0, 9781 },
+    { 45550, 6, 1, 0, 9781 },
+    { 45556, 8, 1, 0, 9781 },
+    { 45564, 2, 1, 0, 9781 },
+    { 45566, 8, 1, 0, 9781 },
+    { 45574, 7, 0, 1, 9781 },
+    { 45581, 2, 1, 0, 9782 },
+    { 45583, 3, 1, 0, 9782 },
+    { 45586, 3, 1, 0, 9782 },
+    { 45589, 2, 1, 0, 9782 },
+    { 45591, 3, 1, 0, 9782 },
+    { 45594, 2, 1, 0, 9782 },
+    { 45596, 2, 1, 0, 9782 },
+    { 45598, 7, 1, 0, 9782 },
+    { 45605, 2, 1, 0, 9782 },
+    { 45607, 7, 1, 0, 9782 },
+    { 45614, 9, 1, 0, 9782 },
+    { 45623, 3, 1, 0, 9782 },
+    { 45626, 8, 1, 0, 9782 },
+    { 45634, 3, 1, 0, 9782 },
+    { 45637, 7, 0, 1, 9782 },
+    { 45644, 3, 1, 0, 9783 },
+    { 45647, 8, 1, 0, 9783 },
+    { 45655, 3, 1, 0, 9783 },
+    { 45658, 7, 1, 0, 9783 },
+    { 45665, 3, 1, 0, 9783 },
+    { 45668, 6, 1, 0, 9783 },
+    { 45674, 3, 1, 0, 9783 },
+    { 45677, 8, 1, 0, 9783 },
+    { 45685, 8, 1, 0, 9783 },
+    { 45693, 3, 1, 0, 9783 },
+    { 45696, 6, 1, 0, 9783 },
+    { 45702, 5, 1, 1, 9783 },
+    { 45707, 5, 1, 0, 9784 },
+    { 45712, 3, 1, 0, 9784 },
+    { 45715, 8, 1, 0, 9784 },
+    { 45723, 8, 1, 0, 9784 },
+    { 45731, 3, 1, 0, 9784 },
+    { 45734, 6, 1, 4, 9784 },
+    { 45740, 5, 1, 0, 9788 },
+    { 45745, 4, 1, 0, 9788 },
+    { 45749, 7, 1, 0, 9788 },
+    { 45756, 3, 1, 0, 9788 },
+    { 45759, 3, 1, 0, 9788 },
+    { 45762, 3, 1, 0, 9788 },
+    { 45765, 2, 1, 0, 9788 },
+    { 45767, 10, 1, 0, 9788 },
+    { 45777, 3, 1, 0, 9788 },
+    { 45780, 12, 0, 1, 9788 },
+    { 45792, 3, 1, 0, 9789 },
+    { 45795, 4, 1, 0, 9789 },
+    { 45799, 11, 1, 0, 9789 },
+    { 45810, 8, 1, 0, 9789 },
+    { 45818, 5, 4, 0, 9789 },
+    { 45823, 4, 4, 0, 9789 },
+    { 45827, 8, 4, 0, 9789 },
+    { 45835, 11, 1, 0, 9789 },
+    { 45846, 2, 1, 0, 9789 },
+    { 45848, 9, 4, 0, 9789 },
+    { 45857, 8, 1, 0, 9789 },
+    { 45865, 7, 1, 0, 9789 },
+    { 45872, 4, 1, 0, 9789 },
+    { 45876, 7, 1, 0, 9789 },
+    { 45883, 2, 1, 0, 9789 },
+    { 45885, 2, 1, 0, 9789 },
+    { 45887, 4, 1, 0, 9789 },
+    { 45891, 3, 1, 0, 9789 },
+    { 45894, 3, 1, 0, 9789 },
+    { 45897, 3, 1, 0, 9789 },
+    { 45900, 3, 1, 0, 9789 },
+    { 45903, 3, 1, 0, 9789 },
+    { 45906, 3, 1, 0, 9789 },
+    { 45909, 3, 1, 0, 9789 },
+    { 45912, 3, 1, 0, 9789 },
+    { 45915, 3, 1, 0, 9789 },
+    { 45918, 3, 1, 0, 9789 },
+    { 45921, 3, 1, 0, 9789 },
+    { 45924, 3, 1, 0, 9789 },
+    { 45927, 3, 1, 0, 9789 },
+    { 45930, 3, 1, 0, 9789 },
+    { 45933, 3, 1, 0, 9789 },
+    { 45936, 3, 1, 0, 9789 },
+    { 45939, 3, 1, 0, 9789 },
+    { 45942, 3, 1, 0, 9789 },
+    { 45945, 3, 1, 0, 9789 },
+    { 45948, 3, 1, 0, 9789 },
+    { 45951, 3, 1, 0, 9789 },
+    { 45954, 3, 1, 0, 9789 },
+    { 45957, 3, 1, 0, 9789 },
+    { 45960, 3, 1, 0, 9789 },
+    { 45963, 3, 1, 1, 9789 },
+    { 45966, 3, 1, 0, 9790 },
+    { 45969, 3, 1, 0, 9790 },
+    { 45972, 3, 1, 0, 9790 },
+    { 45975, 4, 1, 0, 9790 },
+    { 45979, 3, 1, 0, 9790 },
+    { 45982, 3, 1, 0, 9790 },
+    { 45985, 3, 1, 0, 9790 },
+    { 45988, 2, 1, 0, 9790 },
+    { 45990, 10, 1, 0, 9790 },
+    { 46000, 1, 1, 0, 9790 },
+    { 46001, 2, 1, 0, 9790 },
+    { 46003, 1, 1, 0, 9790 },
+    { 46004, 2, 1, 0, 9790 },
+    { 46006, 8, 1, 0, 9790 },
+    { 46014, 5, 1, 0, 9790 },
+    { 46019, 1, 1, 0, 9790 },
+    { 46020, 3, 1, 0, 9790 },
+    { 46023, 4, 1, 0, 9790 },
+    { 46027, 1, 1, 0, 9790 },
+    { 46028, 1, 1, 0, 9790 },
+    { 46029, 1, 1, 0, 9790 },
+    { 46030, 2, 1, 0, 9790 },
+    { 46032, 4, 1, 0, 9790 },
+    { 46036, 3, 1, 0, 9790 },
+    { 46039, 1, 1, 0, 9790 },
+    { 46040, 1, 1, 0, 9790 },
+    { 46041, 1, 1, 0, 9790 },
+    { 46042, 6, 1, 0, 9790 },
+    { 46048, 12, 1, 0, 9790 },
+    { 46060, 1, 1, 0, 9790 },
+    { 46061, 7, 1, 0, 9790 },
+    { 46068, 15, 1, 0, 9790 },
+    { 46083, 6, 1, 0, 9790 },
+    { 46089, 1, 1, 0, 9790 },
+    { 46090, 6, 1, 0, 9790 },
+    { 46096, 1, 1, 0, 9790 },
+    { 46097, 12, 1, 0, 9790 },
+    { 46109, 1, 1, 0, 9790 },
+    { 46110, 14, 1, 0, 9790 },
+    { 46124, 1, 1, 0, 9790 },
+    { 46125, 3, 1, 0, 9790 },
+    { 46128, 1, 1, 0, 9790 },
+    { 46129, 4, 0, 1, 9790 },
+    { 46133, 5, 1, 0, 9791 },
+    { 46138, 2, 1, 0, 9791 },
+    { 46140, 5, 1, 0, 9791 },
+    { 46145, 1, 1, 0, 9791 },
+    { 46146, 1, 1, 0, 9791 },
+    { 46147, 1, 1, 0, 9791 },
+    { 46148, 2, 1, 0, 9791 },
+    { 46150, 1, 1, 0, 9791 },
+    { 46151, 1, 1, 0, 9791 },
+    { 46152, 1, 1, 0, 9791 },
+    { 46153, 1, 1, 0, 9791 },
+    { 46154, 1, 1, 0, 9791 },
+    { 46155, 9, 1, 0, 9791 },
+    { 46164, 8, 1, 0, 9791 },
+    { 46172, 3, 1, 0, 9791 },
+    { 46175, 3, 1, 0, 9791 },
+    { 46178, 8, 1, 0, 9791 },
+    { 46186, 3, 1, 0, 9791 },
+    { 46189, 3, 1, 0, 9791 },
+    { 46192, 3, 1, 0, 9791 },
+    { 46195, 3, 1, 0, 9791 },
+    { 46198, 3, 1, 0, 9791 },
+    { 46201, 3, 1, 0, 9791 },
+    { 46204, 3, 1, 0, 9791 },
+    { 46207, 8, 1, 0, 9791 },
+    { 46215, 3, 1, 0, 9791 },
+    { 46218, 3, 1, 0, 9791 },
+    { 46221, 3, 1, 0, 9791 },
+    { 46224, 3, 1, 0, 9791 },
+    { 46227, 8, 0, 4, 9791 },
+    { 46235, 3, 1, 0, 9795 },
+    { 46238, 8, 1, 0, 9795 },
+    { 46246, 5, 1, 0, 9795 },
+    { 46251, 4, 1, 0, 9795 },
+    { 46255, 6, 1, 0, 9795 },
+    { 46261, 8, 1, 0, 9795 },
+    { 46269, 6, 1, 0, 9795 },
+    { 46275, 7, 1, 0, 9795 },
+    { 46282, 5, 1, 0, 9795 },
+    { 46287, 4, 1, 0, 9795 },
+    { 46291, 8, 4, 0, 9795 },
+    { 46299, 4, 1, 0, 9795 },
+    { 46303, 7, 1, 0, 9795 },
+    { 46310, 4, 1, 0, 9795 },
+    { 46314, 12, 1, 0, 9795 },
+    { 46326, 4, 1, 0, 9795 },
+    { 46330, 5, 1, 0, 9795 },
+    { 46335, 9, 1, 0, 9795 },
+    { 46344, 7, 1, 0, 9795 },
+    { 46351, 8, 1, 0, 9795 },
+    { 46359, 6, 1, 0, 9795 },
+    { 46365, 10, 1, 0, 9795 },
+    { 46375, 10, 4, 0, 9795 },
+    { 46385, 4, 1, 0, 9795 },
+    { 46389, 3, 4, 0, 9795 },
+    { 46392, 8, 1, 0, 9795 },
+    { 46400, 3, 1, 0, 9795 },
+    { 46403, 3, 1, 0, 9795 },
+    { 46406, 3, 1, 0, 9795 },
+    { 46409, 3, 1, 0, 9795 },
+    { 46412, 3, 1, 0, 9795 },
+    { 46415, 3, 1, 0, 9795 },
+    { 46418, 8, 1, 0, 9795 },
+    { 46426, 3, 1, 0, 9795 },
+    { 46429, 3, 1, 0, 9795 },
+    { 46432, 4, 1, 0, 9795 },
+    { 46436, 3, 1, 0, 9795 },
+    { 46439, 5, 1, 0, 9795 },
+    { 46444, 4, 1, 0, 9795 },
+    { 46448, 3, 1, 0, 9795 },
+    { 46451, 3, 1, 0, 9795 },
+    { 46454, 3, 1, 0, 9795 },
+    { 46457, 2, 1, 0, 9795 },
+    { 46459, 3, 1, 0, 9795 },
+    { 46462, 3, 1, 0, 9795 },
+    { 46465, 3, 1, 0, 9795 },
+    { 46468, 5, 4, 0, 9795 },
+    { 46473, 6, 1, 0, 9795 },
+    { 46479, 4, 1, 0, 9795 },
+    { 46483, 6, 1, 0, 9795 },
+    { 46489, 3, 1, 0, 9795 },
+    { 46492, 3, 1, 0, 9795 },
+    { 46495, 3, 1, 0, 9795 },
+    { 46498, 3, 1, 0, 9795 },
+    { 46501, 2, 1, 0, 9795 },
+    { 46503, 3, 1, 0, 9795 },
+    { 46506, 3, 1, 0, 9795 },
+    { 46509, 3, 1, 0, 9795 },
+    { 46512, 2, 1, 0, 9795 },
+    { 46514, 3, 1, 0, 9795 },
+    { 46517, 9, 1, 0, 9795 },
+    { 46526, 3, 1, 0, 9795 },
+    { 46529, 9, 1, 0, 9795 },
+    { 46538, 3, 1, 0, 9795 },
+    { 46541, 3, 1, 0, 9795 },
+    { 46544, 4, 1, 0, 9795 },
+    { 46548, 3, 1, 0, 9795 },
+    { 46551, 8, 1, 0, 9795 },
+    { 46559, 7, 1, 0, 9795 },
+    { 46566, 5, 1, 0, 9795 },
+    { 46571, 6, 1, 0, 9795 },
+    { 46577, 8, 1, 0, 9795 },
+    { 46585, 9, 1, 0, 9795 },
+    { 46594, 8, 1, 0, 9795 },
+    { 46602, 7, 1, 0, 9795 },
+    { 46609, 10, 1, 0, 9795 },
+    { 46619, 11, 1, 0, 9795 },
+    { 46630, 7, 1, 0, 9795 },
+    { 46637, 8, 1, 0, 9795 },
+    { 46645, 10, 1, 0, 9795 },
+    { 46655, 8, 1, 0, 9795 },
+    { 46663, 9, 1, 0, 9795 },
+    { 46672, 7, 1, 0, 9795 },
+    { 46679, 7, 1, 0, 9795 },
+    { 46686, 8, 1, 0, 9795 },
+    { 46694, 8, 1, 0, 9795 },
+    { 46702, 15, 1, 0, 9795 },
+    { 46717, 5, 1, 0, 9795 },
+    { 46722, 7, 1, 0, 9795 },
+    { 46729, 6, 1, 0, 9795 },
+    { 46735, 7, 1, 0, 9795 },
+    { 46742, 6, 1, 0, 9795 },
+    { 46748, 8, 1, 0, 9795 },
+    { 46756, 6, 1, 0, 9795 },
+    { 46762, 7, 1, 0, 9795 },
+    { 46769, 9, 1, 0, 9795 },
+    { 46778, 7, 1, 0, 9795 },
+    { 46785, 9, 1, 0, 9795 },
+    { 46794, 9, 1, 0, 9795 },
+    { 46803, 6, 1, 0, 9795 },
+    { 46809, 8, 1, 0, 9795 },
+    { 46817, 5, 1, 0, 9795 },
+    { 46822, 10, 1, 0, 9795 },
+    { 46832, 8, 1, 0, 9795 },
+    { 46840, 3, 1, 0, 9795 },
+    { 46843, 8, 1, 0, 9795 },
+    { 46851, 7, 1, 0, 9795 },
+    { 46858, 5, 1, 0, 9795 },
+    { 46863, 16, 1, 0, 9795 },
+    { 46879, 3, 1, 0, 9795 },
+    { 46882, 7, 1, 0, 9795 },
+    { 46889, 5, 1, 0, 9795 },
+    { 46894, 8, 1, 0, 9795 },
+    { 46902, 5, 1, 0, 9795 },
+    { 46907, 3, 1, 0, 9795 },
+    { 46910, 8, 1, 0, 9795 },
+    { 46918, 6, 1, 0, 9795 },
+    { 46924, 9, 1, 0, 9795 },
+    { 46933, 7, 1, 0, 9795 },
+    { 46940, 11, 1, 0, 9795 },
+    { 46951, 4, 1, 0, 9795 },
+    { 46955, 4, 1, 0, 9795 },
+    { 46959, 11, 1, 0, 9795 },
+    { 46970, 8, 1, 0, 9795 },
+    { 46978, 7, 1, 0, 9795 },
+    { 46985, 5, 1, 0, 9795 },
+    { 46990, 3, 1, 0, 9795 },
+    { 46993, 3, 1, 0, 9795 },
+    { 46996, 3, 1, 0, 9795 },
+    { 46999, 3, 1, 0, 9795 },
+    { 47002, 3, 1, 0, 9795 },
+    { 47005, 3, 1, 0, 9795 },
+    { 47008, 3, 1, 0, 9795 },
+    { 47011, 3, 1, 0, 9795 },
+    { 47014, 3, 1, 0, 9795 },
+    { 47017, 3, 1, 0, 9795 },
+    { 47020, 3, 1, 0, 9795 },
+    { 47023, 3, 1, 0, 9795 },
+    { 47026, 11, 1, 0, 9795 },
+    { 47037, 2, 1, 0, 9795 },
+    { 47039, 2, 1, 0, 9795 },
+    { 47041, 3, 1, 0, 9795 },
+    { 47044, 2, 1, 0, 9795 },
+    { 47046, 2, 1, 0, 9795 },
+    { 47048, 2, 1, 0, 9795 },
+    { 47050, 8, 1, 0, 9795 },
+    { 47058, 9, 1, 0, 9795 },
+    { 47067, 8, 1, 0, 9795 },
+    { 47075, 2, 1, 0, 9795 },
+    { 47077, 3, 1, 0, 9795 },
+    { 47080, 2, 1, 0, 9795 },
+    { 47082, 2, 1, 0, 9795 },
+    { 47084, 2, 1, 0, 9795 },
+    { 47086, 2, 1, 0, 9795 },
+    { 47088, 2, 1, 0, 9795 },
+    { 47090, 3, 1, 0, 9795 },
+    { 47093, 6, 1, 0, 9795 },
+    { 47099, 2, 1, 0, 9795 },
+    { 47101, 4, 1, 0, 9795 },
+    { 47105, 2, 1, 0, 9795 },
+    { 47107, 3, 1, 0, 9795 },
+    { 47110, 2, 1, 0, 9795 },
+    { 47112, 3, 1, 0, 9795 },
+    { 47115, 3, 1, 0, 9795 },
+    { 47118, 2, 1, 0, 9795 },
+    { 47120, 3, 1, 0, 9795 },
+    { 47123, 3, 1, 0, 9795 },
+    { 47126, 3, 1, 0, 9795 },
+    { 47129, 4, 1, 0, 9795 },
+    { 47133, 3, 1, 0, 9795 },
+    { 47136, 3, 1, 0, 9795 },
+    { 47139, 3, 1, 0, 9795 },
+    { 47142, 4, 1, 0, 9795 },
+    { 47146, 3, 1, 0, 9795 },
+    { 47149, 3, 1, 0, 9795 },
+    { 47152, 2, 1, 0, 9795 },
+    { 47154, 3, 1, 0, 9795 },
+    { 47157, 3, 1, 0, 9795 },
+    { 47160, 3, 1, 0, 9795 },
+    { 47163, 3, 1, 0, 9795 },
+    { 47166, 3, 1, 0, 9795 },
+    { 47169, 3, 1, 0, 9795 },
+    { 47172, 3, 1, 0, 9795 },
+    { 47175, 3, 1, 0, 9795 },
+    { 47178, 3, 1, 0, 9795 },
+    { 47181, 3, 1, 0, 9795 },
+    { 47184, 3, 1, 0, 9795 },
+    { 47187, 3, 1, 0, 9795 },
+    { 47190, 4, 1, 0, 9795 },
+    { 47194, 4, 1, 0, 9795 },
+    { 47198, 6, 1, 0, 9795 },
+    { 47204, 3, 1, 0, 9795 },
+    { 47207, 3, 1, 0, 9795 },
+    { 47210, 11, 1, 0, 9795 },
+    { 47221, 3, 1, 0, 9795 },
+    { 47224, 5, 1, 0, 9795 },
+    { 47229, 7, 1, 0, 9795 },
+    { 47236, 3, 1, 0, 9795 },
+    { 47239, 3, 1, 0, 9795 },
+    { 47242, 3, 1, 0, 9795 },
+    { 47245, 3, 1, 0, 9795 },
+    { 47248, 3, 1, 0, 9795 },
+    { 47251, 3, 1, 0, 9795 },
+    { 47254, 4, 1, 0, 9795 },
+    { 47258, 3, 1, 0, 9795 },
+    { 47261, 3, 1, 0, 9795 },
+    { 47264, 12, 0, 1, 9795 },
+    { 47276, 3, 1, 0, 9796 },
+    { 47279, 7, 1, 0, 9796 },
+    { 47286, 12, 1, 0, 9796 },
+    { 47298, 7, 1, 0, 9796 },
+    { 47305, 5, 1, 0, 9796 },
+    { 47310, 2, 1, 0, 9796 },
+    { 47312, 3, 1, 0, 9796 },
+    { 47315, 3, 1, 0, 9796 },
+    { 47318, 3, 1, 0, 9796 },
+    { 47321, 3, 1, 1, 9796 },
+    { 47324, 2, 1, 0, 9797 },
+    { 47326, 3, 1, 0, 9797 },
+    { 47329, 3, 1, 0, 9797 },
+    { 47332, 3, 1, 0, 9797 },
+    { 47335, 4, 1, 0, 9797 },
+    { 47339, 3, 1, 0, 9797 },
+    { 47342, 3, 1, 0, 9797 },
+    { 47345, 3, 1, 0, 9797 },
+    { 47348, 4, 1, 0, 9797 },
+    { 47352, 2, 1, 1, 9797 },
+    { 47354, 3, 1, 0, 9798 },
+    { 47357, 3, 1, 0, 9798 },
+    { 47360, 3, 1, 0, 9798 },
+    { 47363, 3, 1, 0, 9798 },
+    { 47366, 3, 1, 0, 9798 },
+    { 47369, 2, 1, 0, 9798 },
+    { 47371, 3, 1, 0, 9798 },
+    { 47374, 3, 1, 0, 9798 },
+    { 47377, 4, 1, 0, 9798 },
+    { 47381, 3, 1, 0, 9798 },
+    { 47384, 2, 1, 0, 9798 },
+    { 47386, 3, 1, 0, 9798 },
+    { 47389, 4, 1, 0, 9798 },
+    { 47393, 3, 1, 0, 9798 },
+    { 47396, 3, 1, 0, 9798 },
+    { 47399, 4, 1, 0, 9798 },
+    { 47403, 3, 1, 0, 9798 },
+    { 47406, 4, 1, 0, 9798 },
+    { 47410, 4, 1, 0, 9798 },
+    { 47414, 6, 1, 0, 9798 },
+    { 47420, 4, 1, 0, 9798 },
+    { 47424, 3, 1, 0, 9798 },
+    { 47427, 3, 1, 0, 9798 },
+    { 47430, 3, 1, 0, 9798 },
+    { 47433, 6, 1, 0, 9798 },
+    { 47439, 11, 1, 0, 9798 },
+    { 47450, 6, 1, 0, 9798 },
+    { 47456, 10, 1, 0, 9798 },
+    { 47466, 10, 1, 0, 9798 },
+    { 47476, 8, 1, 0, 9798 },
+    { 47484, 4, 1, 0, 9798 },
+    { 47488, 3, 1, 1, 9798 },
+    { 47491, 4, 1, 0, 9799 },
+    { 47495, 3, 1, 0, 9799 },
+    { 47498, 4, 1, 0, 9799 },
+    { 47502, 3, 1, 0, 9799 },
+    { 47505, 3, 1, 0, 9799 },
+    { 47508, 3, 1, 0, 9799 },
+    { 47511, 3, 1, 0, 9799 },
+    { 47514, 3, 1, 0, 9799 },
+    { 47517, 3, 1, 0, 9799 },
+    { 47520, 11, 1, 0, 9799 },
+    { 47531, 10, 1, 0, 9799 },
+    { 47541, 12, 1, 0, 9799 },
+    { 47553, 6, 1, 0, 9799 },
+    { 47559, 6, 1, 0, 9799 },
+    { 47565, 6, 1, 0, 9799 },
+    { 47571, 2, 1, 0, 9799 },
+    { 47573, 2, 1, 0, 9799 },
+    { 47575, 2, 1, 0, 9799 },
+    { 47577, 5, 1, 0, 9799 },
+    { 47582, 4, 1, 0, 9799 },
+    { 47586, 2, 1, 0, 9799 },
+    { 47588, 3, 1, 0, 9799 },
+    { 47591, 4, 1, 0, 9799 },
+    { 47595, 2, 1, 0, 9799 },
+    { 47597, 2, 1, 0, 9799 },
+    { 47599, 2, 1, 0, 9799 },
+    { 47601, 2, 1, 0, 9799 },
+    { 47603, 3, 1, 0, 9799 },
+    { 47606, 2, 1, 0, 9799 },
+    { 47608, 9, 1, 0, 9799 },
+    { 47617, 8, 1, 0, 9799 },
+    { 47625, 9, 1, 0, 9799 },
+    { 47634, 9, 1, 0, 9799 },
+    { 47643, 10, 1, 0, 9799 },
+    { 47653, 10, 1, 0, 9799 },
+    { 47663, 2, 1, 0, 9799 },
+    { 47665, 2, 1, 0, 9799 },
+    { 47667, 2, 1, 0, 9799 },
+    { 47669, 3, 1, 0, 9799 },
+    { 47672, 2, 1, 0, 9799 },
+    { 47674, 6, 1, 0, 9799 },
+    { 47680, 2, 1, 0, 9799 },
+    { 47682, 2, 1, 0, 9799 },
+    { 47684, 2, 1, 0, 9799 },
+    { 47686, 14, 1, 0, 9799 },
+    { 47700, 14, 1, 0, 9799 },
+    { 47714, 7, 1, 0, 9799 },
+    { 47721, 2, 1, 0, 9799 },
+    { 47723, 3, 1, 0, 9799 },
+    { 47726, 3, 1, 0, 9799 },
+    { 47729, 2, 1, 0, 9799 },
+    { 47731, 2, 1, 0, 9799 },
+    { 47733, 3, 1, 0, 9799 },
+    { 47736, 15, 1, 0, 9799 },
+    { 47751, 2, 1, 0, 9799 },
+    { 47753, 7, 1, 0, 9799 },
+    { 47760, 7, 1, 0, 9799 },
+    { 47767, 7, 1, 0, 9799 },
+    { 47774, 12, 1, 0, 9799 },
+    { 47786, 12, 1, 0, 9799 },
+    { 47798, 4, 1, 0, 9799 },
+    { 47802, 10, 1, 0, 9799 },
+    { 47812, 2, 1, 0, 9799 },
+    { 47814, 2, 1, 0, 9799 },
+    { 47816, 4, 1, 0, 9799 },
+    { 47820, 2, 1, 0, 9799 },
+    { 47822, 2, 1, 0, 9799 },
+    { 47824, 4, 1, 0, 9799 },
+    { 47828, 2, 1, 0, 9799 },
+    { 47830, 2, 1, 0, 9799 },
+    { 47832, 3, 1, 0, 9799 },
+    { 47835, 7, 1, 0, 9799 },
+    { 47842, 5, 1, 0, 9799 },
+    { 47847, 2, 1, 0, 9799 },
+    { 47849, 4, 1, 0, 9799 },
+    { 47853, 2, 1, 0, 9799 },
+    { 47855, 8, 1, 0, 9799 },
+    { 47863, 3, 1, 0, 9799 },
+    { 47866, 8, 1, 0, 9799 },
+    { 47874, 2, 1, 0, 9799 },
+    { 47876, 5, 1, 0, 9799 },
+    { 47881, 6, 1, 0, 9799 },
+    { 47887, 3, 1, 0, 9799 },
+    { 47890, 2, 1, 0, 9799 },
+    { 47892, 7, 1, 0, 9799 },
+    { 47899, 2, 1, 0, 9799 },
+    { 47901, 5, 1, 0, 9799 },
+    { 47906, 5, 1, 0, 9799 },
+    { 47911, 2, 1, 0, 9799 },
+    { 47913, 2, 1, 0, 9799 },
+    { 47915, 10, 1, 0, 9799 },
+    { 47925, 10, 1, 0, 9799 },
+    { 47935, 2, 1, 0, 9799 },
+    { 47937, 4, 1, 0, 9799 },
+    { 47941, 2, 1, 0, 9799 },
+    { 47943, 8, 1, 0, 9799 },
+    { 47951, 2, 1, 0, 9799 },
+    { 47953, 8, 1, 0, 9799 },
+    { 47961, 1, 1, 0, 9799 },
+    { 47962, 7, 1, 0, 9799 },
+    { 47969, 9, 1, 0, 9799 },
+    { 47978, 2, 1, 0, 9799 },
+    { 47980, 5, 1, 0, 9799 },
+    { 47985, 5, 1, 0, 9799 },
+    { 47990, 11, 1, 0, 9799 },
+    { 48001, 12, 1, 0, 9799 },
+    { 48013, 8, 1, 0, 9799 },
+    { 48021, 8, 1, 0, 9799 },
+    { 48029, 2, 1, 0, 9799 },
+    { 48031, 2, 1, 0, 9799 },
+    { 48033, 2, 1, 0, 9799 },
+    { 48035, 8, 1, 0, 9799 },
+    { 48043, 2, 1, 0, 9799 },
+    { 48045, 3, 1, 0, 9799 },
+    { 48048, 2, 1, 0, 9799 },
+    { 48050, 2, 1, 0, 9799 },
+    { 48052, 2, 1, 0, 9799 },
+    { 48054, 3, 1, 0, 9799 },
+    { 48057, 2, 1, 0, 9799 },
+    { 48059, 2, 1, 0, 9799 },
+    { 48061, 5, 1, 0, 9799 },
+    { 48066, 2, 1, 11, 9799 },
+    { 48068, 4, 1, 0, 9810 },
+    { 48072, 5, 1, 0, 9810 },
+    { 48077, 3, 1, 4, 9810 },
+    { 48080, 4, 1, 0, 9814 },
+    { 48084, 22, 1, 0, 9814 },
+    { 48106, 19, 1, 0, 9814 },
+    { 48125, 19, 1, 0, 9814 },
+    { 48144, 17, 1, 0, 9814 },
+    { 48161, 18, 1, 0, 9814 },
+    { 48179, 3, 1, 0, 9814 },
+    { 48182, 2, 1, 0, 9814 },
+    { 48184, 3, 1, 0, 9814 },
+    { 48187, 3, 1, 0, 9814 },
+    { 48190, 3, 1, 6, 9814 },
+    { 48193, 3, 1, 0, 9820 },
+    { 48196, 6, 1, 0, 9820 },
+    { 48202, 14, 1, 0, 9820 },
+    { 48216, 5, 1, 0, 9820 },
+    { 48221, 16, 1, 0, 9820 },
+    { 48237, 3, 4, 0, 9820 },
+    { 48240, 2, 1, 3, 9820 },
+    { 48242, 2, 1, 3, 9823 },
+    { 48244, 2, 1, 3, 9826 },
+    { 48246, 2, 1, 3, 9829 },
+    { 48248, 2, 1, 3, 9832 },
+    { 48250, 2, 1, 3, 9835 },
+    { 48252, 7, 1, 0, 9838 },
+    { 48259, 2, 1, 3, 9838 },
+    { 48261, 2, 1, 3, 9841 },
+    { 48263, 2, 1, 3, 9844 },
+    { 48265, 2, 1, 3, 9847 },
+    { 48267, 3, 1, 0, 9850 },
+    { 48270, 4, 1, 0, 9850 },
+    { 48274, 8, 0, 1, 9850 },
+    { 48282, 3, 1, 0, 9851 },
+    { 48285, 2, 1, 3, 9851 },
+    { 48287, 8, 1, 0, 9854 },
+    { 48295, 2, 1, 3, 9854 },
+    { 48297, 7, 1, 0, 9857 },
+    { 48304, 7, 1, 0, 9857 },
+    { 48311, 2, 1, 3, 9857 },
+    { 48313, 2, 1, 2, 9860 },
+    { 48315, 2, 1, 3, 9862 },
+    { 48317, 2, 1, 3, 9865 },
+    { 48319, 2, 1, 3, 9868 },
+    { 48321, 2, 1, 3, 9871 },
+    { 48323, 5, 1, 0, 9874 },
+    { 48328, 3, 1, 0, 9874 },
+    { 48331, 4, 1, 0, 9874 },
+    { 48335, 2, 1, 3, 9874 },
+    { 48337, 2, 1, 3, 9877 },
+    { 48339, 2, 1, 3, 9880 },
+    { 48341, 11, 1, 0, 9883 },
+    { 48352, 2, 1, 3, 9883 },
+    { 48354, 2, 1, 3, 9886 },
+    { 48356, 2, 1, 3, 9889 },
+    { 48358, 2, 1, 11, 9892 },
+    { 48360, 8, 1, 0, 9903 },
+    { 48368, 2, 1, 3, 9903 },
+    { 48370, 2, 1, 3, 9906 },
+    { 48372, 2, 1, 3, 9909 },
+    { 48374, 2, 1, 3, 9912 },
+    { 48376, 2, 1, 3, 9915 },
+    { 48378, 2, 1, 2, 9918 },
+    { 48380, 2, 1, 3, 9920 },
+    { 48382, 2, 1, 3, 9923 },
+    { 48384, 2, 1, 3, 9926 },
+    { 48386, 2, 1, 3, 9929 },
+    { 48388, 4, 1, 0, 9932 },
+    { 48392, 3, 1, 0, 9932 },
+    { 48395, 2, 1, 3, 9932 },
+    { 48397, 2, 1, 3, 9935 },
+    { 48399, 2, 1, 3, 9938 },
+    { 48401, 2, 1, 3, 9941 },
+    { 48403, 2, 1, 3, 9944 },
+    { 48405, 2, 1, 3, 9947 },
+    { 48407, 8, 1, 0, 9950 },
+    { 48415, 7, 1, 0, 9950 },
+    { 48422, 2, 1, 3, 9950 },
+    { 48424, 2, 1, 2, 9953 },
+    { 48426, 2, 1, 3, 9955 },
+    { 48428, 2, 1, 2, 9958 },
+    { 48430, 12, 1, 0, 9960 },
+    { 48442, 2, 1, 3, 9960 },
+    { 48444, 2, 1, 3, 9963 },
+    { 48446, 2, 1, 3, 9966 },
+    { 48448, 2, 1, 3, 9969 },
+    { 48450, 2, 1, 3, 9972 },
+    { 48452, 2, 1, 3, 9975 },
+    { 48454, 2, 1, 3, 9978 },
+    { 48456, 2, 1, 3, 9981 },
+    { 48458, 2, 1, 1, 9984 },
+    { 48460, 2, 1, 3, 9985 },
+    { 48462, 3, 1, 1, 9988 },
+    { 48465, 3, 1, 0, 9989 },
+    { 48468, 3, 1, 0, 9989 },
+    { 48471, 3, 1, 0, 9989 },
+    { 48474, 3, 1, 0, 9989 },
+    { 48477, 3, 1, 0, 9989 },
+    { 48480, 2, 1, 0, 9989 },
+    { 48482, 3, 1, 0, 9989 },
+    { 48485, 3, 1, 0, 9989 },
+    { 48488, 3, 1, 0, 9989 },
+    { 48491, 2, 1, 0, 9989 },
+    { 48493, 3, 1, 0, 9989 },
+    { 48496, 3, 1, 0, 9989 },
+    { 48499, 3, 1, 0, 9989 },
+    { 48502, 2, 1, 1, 9989 },
+    { 48504, 3, 1, 0, 9990 },
+    { 48507, 3, 1, 0, 9990 },
+    { 48510, 3, 1, 0, 9990 },
+    { 48513, 4, 1, 0, 9990 },
+    { 48517, 3, 1, 0, 9990 },
+    { 48520, 2, 1, 0, 9990 },
+    { 48522, 3, 1, 0, 9990 },
+    { 48525, 3, 1, 0, 9990 },
+    { 48528, 3, 1, 0, 9990 },
+    { 48531, 4, 1, 0, 9990 },
+    { 48535, 3, 1, 0, 9990 },
+    { 48538, 3, 1, 0, 9990 },
+    { 48541, 4, 1, 0, 9990 },
+    { 48545, 3, 1, 0, 9990 },
+    { 48548, 3, 1, 0, 9990 },
+    { 48551, 3, 1, 0, 9990 },
+    { 48554, 3, 1, 0, 9990 },
+    { 48557, 3, 1, 0, 9990 },
+    { 48560, 3, 1, 0, 9990 },
+    { 48563, 3, 1, 0, 9990 },
+    { 48566, 5, 1, 0, 9990 },
+    { 48571, 3, 1, 0, 9990 },
+    { 48574, 3, 1, 0, 9990 },
+    { 48577, 2, 1, 0, 9990 },
+    { 48579, 2, 1, 0, 9990 },
+    { 48581, 3, 1, 0, 9990 },
+    { 48584, 3, 1, 0, 9990 },
+    { 48587, 3, 1, 0, 9990 },
+    { 48590, 3, 1, 0, 9990 },
+    { 48593, 2, 1, 0, 9990 },
+    { 48595, 3, 1, 0, 9990 },
+    { 48598, 8, 1, 0, 9990 },
+    { 48606, 3, 1, 0, 9990 },
+    { 48609, 3, 1, 0, 9990 },
+    { 48612, 3, 1, 0, 9990 },
+    { 48615, 6, 1, 0, 9990 },
+    { 48621, 4, 1, 0, 9990 },
+    { 48625, 3, 1, 0, 9990 },
+    { 48628, 4, 1, 0, 9990 },
+    { 48632, 3, 1, 0, 9990 },
+    { 48635, 3, 1, 0, 9990 },
+    { 48638, 3, 1, 0, 9990 },
+    { 48641, 4, 1, 0, 9990 },
+    { 48645, 2, 1, 0, 9990 },
+    { 48647, 3, 1, 0, 9990 },
+    { 48650, 3, 1, 0, 9990 },
+    { 48653, 3, 1, 0, 9990 },
+    { 48656, 2, 1, 0, 9990 },
+    { 48658, 3, 1, 0, 9990 },
+    { 48661, 3, 1, 0, 9990 },
+    { 48664, 6, 1, 0, 9990 },
+    { 48670, 3, 1, 0, 9990 },
+    { 48673, 3, 1, 0, 9990 },
+    { 48676, 6, 1, 0, 9990 },
+    { 48682, 7, 4, 0, 9990 },
+    { 48689, 7, 1, 0, 9990 },
+    { 48696, 3, 1, 0, 9990 },
+    { 48699, 6, 1, 0, 9990 },
+    { 48705, 3, 1, 0, 9990 },
+    { 48708, 3, 1, 0, 9990 },
+    { 48711, 6, 1, 0, 9990 },
+    { 48717, 3, 1, 0, 9990 },
+    { 48720, 3, 1, 0, 9990 },
+    { 48723, 13, 1, 0, 9990 },
+    { 48736, 11, 1, 0, 9990 },
+    { 48747, 10, 1, 0, 9990 },
+    { 48757, 11, 1, 0, 9990 },
+    { 48768, 8, 1, 0, 9990 },
+    { 48776, 9, 1, 0, 9990 },
+    { 48785, 9, 1, 0, 9990 },
+    { 48794, 8, 1, 0, 9990 },
+    { 48802, 8, 1, 0, 9990 },
+    { 48810, 9, 1, 0, 9990 },
+    { 48819, 10, 1, 0, 9990 },
+    { 48829, 10, 1, 0, 9990 },
+    { 48839, 10, 1, 0, 9990 },
+    { 48849, 10, 1, 0, 9990 },
+    { 48859, 10, 1, 0, 9990 },
+    { 48869, 11, 1, 0, 9990 },
+    { 48880, 13, 1, 0, 9990 },
+    { 48893, 15, 1, 0, 9990 },
+    { 48908, 16, 1, 0, 9990 },
+    { 48924, 13, 1, 0, 9990 },
+    { 48937, 12, 1, 0, 9990 },
+    { 48949, 11, 1, 0, 9990 },
+    { 48960, 7, 1, 0, 9990 },
+    { 48967, 14, 1, 0, 9990 },
+    { 48981, 10, 1, 0, 9990 },
+    { 48991, 9, 1, 0, 9990 },
+    { 49000, 9, 1, 0, 9990 },
+    { 49009, 9, 1, 0, 9990 },
+    { 49018, 10, 1, 0, 9990 },
+    { 49028, 9, 1, 0, 9990 },
+    { 49037, 9, 1, 0, 9990 },
+    { 49046, 11, 1, 0, 9990 },
+    { 49057, 8, 1, 0, 9990 },
+    { 49065, 8, 1, 0, 9990 },
+    { 49073, 9, 1, 0, 9990 },
+    { 49082, 7, 4, 0, 9990 },
+    { 49089, 5, 1, 0, 9990 },
+    { 49094, 3, 1, 0, 9990 },
+    { 49097, 3, 1, 0, 9990 },
+    { 49100, 3, 1, 0, 9990 },
+    { 49103, 3, 1, 0, 9990 },
+    { 49106, 3, 1, 0, 9990 },
+    { 49109, 3, 1, 0, 9990 },
+    { 49112, 3, 1, 0, 9990 },
+    { 49115, 2, 1, 0, 9990 },
+    { 49117, 5, 1, 0, 9990 },
+    { 49122, 3, 1, 0, 9990 },
+    { 49125, 2, 1, 1, 9990 },
+    { 49127, 3, 1, 0, 9991 },
+    { 49130, 3, 1, 0, 9991 },
+    { 49133, 7, 1, 0, 9991 },
+    { 49140, 3, 1, 0, 9991 },
+    { 49143, 3, 1, 0, 9991 },
+    { 49146, 3, 1, 0, 9991 },
+    { 49149, 3, 1, 0, 9991 },
+    { 49152, 3, 1, 0, 9991 },
+    { 49155, 3, 1, 0, 9991 },
+    { 49158, 3, 1, 0, 9991 },
+    { 49161, 3, 1, 0, 9991 },
+    { 49164, 6, 1, 0, 9991 },
+    { 49170, 2, 1, 0, 9991 },
+    { 49172, 3, 1, 0, 9991 },
+    { 49175, 2, 1, 0, 9991 },
+    { 49177, 3, 1, 0, 9991 },
+    { 49180, 2, 1, 0, 9991 },
+    { 49182, 3, 1, 0, 9991 },
+    { 49185, 3, 1, 0, 9991 },
+    { 49188, 3, 1, 0, 9991 },
+    { 49191, 4, 1, 0, 9991 },
+    { 49195, 3, 1, 0, 9991 },
+    { 49198, 3, 1, 0, 9991 },
+    { 49201, 3, 1, 0, 9991 },
+    { 49204, 3, 1, 0, 9991 },
+    { 49207, 7, 1, 0, 9991 },
+    { 49214, 2, 1, 0, 9991 },
+    { 49216, 4, 1, 0, 9991 },
+    { 49220, 6, 4, 0, 9991 },
+    { 49226, 2, 1, 0, 9991 },
+    { 49228, 2, 1, 0, 9991 },
+    { 49230, 3, 1, 0, 9991 },
+    { 49233, 3, 1, 0, 9991 },
+    { 49236, 3, 1, 0, 9991 },
+    { 49239, 6, 1, 0, 9991 },
+    { 49245, 6, 1, 0, 9991 },
+    { 49251, 8, 1, 0, 9991 },
+    { 49259, 6, 1, 0, 9991 },
+    { 49265, 6, 1, 0, 9991 },
+    { 49271, 6, 1, 0, 9991 },
+    { 49277, 12, 1, 0, 9991 },
+    { 49289, 8, 1, 0, 9991 },
+    { 49297, 6, 1, 0, 9991 },
+    { 49303, 2, 1, 0, 9991 },
+    { 49305, 4, 1, 0, 9991 },
+    { 49309, 6, 1, 0, 9991 },
+    { 49315, 4, 1, 0, 9991 },
+    { 49319, 6, 1, 0, 9991 },
+    { 49325, 4, 1, 0, 9991 },
+    { 49329, 6, 1, 0, 9991 },
+    { 49335, 12, 1, 0, 9991 },
+    { 49347, 8, 1, 0, 9991 },
+    { 49355, 8, 1, 0, 9991 },
+    { 49363, 6, 1, 0, 9991 },
+    { 49369, 12, 1, 0, 9991 },
+    { 49381, 18, 1, 0, 9991 },
+    { 49399, 18, 1, 0, 9991 },
+    { 49417, 15, 1, 0, 9991 },
+    { 49432, 18, 1, 0, 9991 },
+    { 49450, 12, 1, 0, 9991 },
+    { 49462, 6, 1, 0, 9991 },
+    { 49468, 6, 1, 0, 9991 },
+    { 49474, 6, 1, 0, 9991 },
+    { 49480, 6, 1, 0, 9991 },
+    { 49486, 6, 1, 0, 9991 },
+    { 49492, 6, 1, 0, 9991 },
+    { 49498, 1, 1, 0, 9991 },
+    { 49499, 11, 1, 0, 9991 },
+    { 49510, 8, 1, 0, 9991 },
+    { 49518, 3, 1, 0, 9991 },
+    { 49521, 8, 1, 0, 9991 },
+    { 49529, 4, 1, 0, 9991 },
+    { 49533, 2, 4, 0, 9991 },
+    { 49535, 2, 4, 0, 9991 },
+    { 49537, 2, 4, 0, 9991 },
+    { 49539, 6, 4, 0, 9991 },
+    { 49545, 8, 1, 0, 9991 },
+    { 49553, 9, 0, 1, 9991 },
+    { 49562, 12, 1, 0, 9992 },
+    { 49574, 3, 1, 0, 9992 },
+    { 49577, 8, 1, 0, 9992 },
+    { 49585, 3, 1, 1, 9992 },
+    { 49588, 2, 1, 0, 9993 },
+    { 49590, 3, 1, 0, 9993 },
+    { 49593, 2, 1, 0, 9993 },
+    { 49595, 3, 1, 0, 9993 },
+    { 49598, 3, 1, 0, 9993 },
+    { 49601, 2, 1, 0, 9993 },
+    { 49603, 3, 1, 0, 9993 },
+    { 49606, 2, 1, 0, 9993 },
+    { 49608, 3, 1, 0, 9993 },
+    { 49611, 3, 1, 0, 9993 },
+    { 49614, 2, 1, 0, 9993 },
+    { 49616, 5, 1, 0, 9993 },
+    { 49621, 7, 1, 0, 9993 },
+    { 49628, 8, 1, 0, 9993 },
+    { 49636, 10, 1, 0, 9993 },
+    { 49646, 12, 0, 1, 9993 },
+    { 49658, 2, 1, 0, 9994 },
+    { 49660, 2, 1, 0, 9994 },
+    { 49662, 2, 1, 0, 9994 },
+    { 49664, 2, 1, 0, 9994 },
+    { 49666, 2, 1, 0, 9994 },
+    { 49668, 2, 1, 0, 9994 },
+    { 49670, 2, 1, 0, 9994 },
+    { 49672, 2, 1, 0, 9994 },
+    { 49674, 2, 1, 0, 9994 },
+    { 49676, 2, 1, 0, 9994 },
+    { 49678, 2, 1, 0, 9994 },
+    { 49680, 2, 1, 0, 9994 },
+    { 49682, 2, 1, 0, 9994 },
+    { 49684, 2, 1, 0, 9994 },
+    { 49686, 2, 1, 0, 9994 },
+    { 49688, 2, 1, 0, 9994 },
+    { 49690, 2, 1, 0, 9994 },
+    { 49692, 2, 1, 0, 9994 },
+    { 49694, 2, 1, 0, 9994 },
+    { 49696, 2, 1, 0, 9994 },
+    { 49698, 2, 1, 0, 9994 },
+    { 49700, 2, 1, 0, 9994 },
+    { 49702, 2, 1, 0, 9994 },
+    { 49704, 2, 1, 0, 9994 },
+    { 49706, 2, 1, 0, 9994 },
+    { 49708, 2, 1, 0, 9994 },
+    { 49710, 2, 1, 0, 9994 },
+    { 49712, 2, 1, 0, 9994 },
+    { 49714, 2, 1, 0, 9994 },
+    { 49716, 2, 1, 0, 9994 },
+    { 49718, 2, 1, 0, 9994 },
+    { 49720, 2, 1, 0, 9994 },
+    { 49722, 2, 1, 0, 9994 },
+    { 49724, 2, 1, 0, 9994 },
+    { 49726, 2, 1, 0, 9994 },
+    { 49728, 2, 1, 0, 9994 },
+    { 49730, 2, 1, 0, 9994 },
+    { 49732, 2, 1, 0, 9994 },
+    { 49734, 2, 1, 0, 9994 },
+    { 49736, 2, 1, 0, 9994 },
+    { 49738, 2, 1, 0, 9994 },
+    { 49740, 2, 1, 0, 9994 },
+    { 49742, 2, 1, 0, 9994 },
+    { 49744, 2, 1, 0, 9994 },
+    { 49746, 2, 1, 0, 9994 },
+    { 49748, 2, 1, 0, 9994 },
+    { 49750, 2, 1, 0, 9994 },
+    { 49752, 2, 1, 0, 9994 },
+    { 49754, 2, 1, 0, 9994 },
+    { 49756, 2, 1, 0, 9994 },
+    { 49758, 2, 1, 0, 9994 },
+    { 49760, 2, 1, 0, 9994 },
+    { 49762, 2, 1, 0, 9994 },
+    { 49764, 2, 1, 0, 9994 },
+    { 49766, 8, 1, 0, 9994 },
+    { 49774, 2, 1, 0, 9994 },
+    { 49776, 9, 1, 0, 9994 },
+    { 49785, 3, 4, 0, 9994 },
+    { 49788, 2, 0, 1, 9994 },
+    { 49790, 9, 1, 0, 9995 },
+    { 49799, 4, 1, 0, 9995 },
+    { 49803, 2, 1, 0, 9995 },
+    { 49805, 3, 1, 0, 9995 },
+    { 49808, 5, 0, 1, 9995 },
+    { 49813, 3, 1, 0, 9996 },
+    { 49816, 2, 1, 0, 9996 },
+    { 49818, 2, 1, 0, 9996 },
+    { 49820, 2, 1, 0, 9996 },
+    { 49822, 2, 1, 0, 9996 },
+    { 49824, 2, 1, 0, 9996 },
+    { 49826, 2, 1, 0, 9996 },
+    { 49828, 2, 1, 0, 9996 },
+    { 49830, 9, 0, 3, 9996 },
+    { 49839, 6, 0, 5, 9999 },
+    { 49845, 9, 0, 2, 10004 },
+    { 49854, 3, 1, 0, 10006 },
+    { 49857, 6, 0, 4, 10006 },
+    { 49863, 6, 0, 3, 10010 },
+    { 49869, 9, 1, 0, 10013 },
+    { 49878, 13, 1, 0, 10013 },
+    { 49891, 2, 1, 0, 10013 },
+    { 49893, 2, 1, 0, 10013 },
+    { 49895, 9, 0, 4, 10013 },
+    { 49904, 6, 1, 0, 10017 },
+    { 49910, 8, 1, 0, 10017 },
+    { 49918, 2, 1, 0, 10017 },
+    { 49920, 2, 1, 0, 10017 },
+    { 49922, 3, 4, 0, 10017 },
+    { 49925, 10, 0, 1, 10017 },
+    { 49935, 9, 0, 1, 10018 },
+    { 49944, 14, 0, 2, 10019 },
+    { 49958, 14, 0, 4, 10021 },
+    { 49972, 14, 0, 1, 10025 },
+    { 49986, 10, 0, 4, 10026 },
+    { 49996, 14, 0, 2, 10030 },
+    { 50010, 14, 0, 2, 10032 },
+    { 50024, 12, 0, 4, 10034 },
+    { 50036, 7, 4, 0, 10038 },
+    { 50043, 9, 4, 0, 10038 },
+    { 50052, 3, 4, 0, 10038 },
+    { 50055, 12, 0, 4, 10038 },
+    { 50067, 10, 0, 1, 10042 },
+    { 50077, 10, 0, 1, 10043 },
+    { 50087, 9, 0, 2, 10044 },
+    { 50096, 9, 0, 4, 10046 },
+    { 50105, 9, 0, 4, 10050 },
+    { 50114, 10, 0, 1, 10054 },
+    { 50124, 2, 1, 0, 10055 },
+    { 50126, 17, 1, 0, 10055 },
+    { 50143, 17, 1, 0, 10055 },
+    { 50160, 13, 1, 0, 10055 },
+    { 50173, 17, 1, 0, 10055 },
+    { 50190, 17, 1, 0, 10055 },
+    { 50207, 15, 1, 0, 10055 },
+    { 50222, 15, 1, 0, 10055 },
+    { 50237, 12, 1, 0, 10055 },
+    { 50249, 12, 1, 0, 10055 },
+    { 50261, 12, 1, 0, 10055 },
+    { 50273, 13, 1, 0, 10055 },
+    { 50286, 21, 1, 0, 10055 },
+    { 50307, 12, 1, 0, 10055 },
+    { 50319, 12, 1, 0, 10055 },
+    { 50331, 16, 1, 0, 10055 },
+    { 50347, 12, 1, 0, 10055 },
+    { 50359, 12, 1, 0, 10055 },
+    { 50371, 25, 1, 0, 10055 },
+    { 50396, 25, 1, 0, 10055 },
+    { 50421, 25, 1, 0, 10055 },
+    { 50446, 20, 1, 0, 10055 },
+    { 50466, 20, 1, 0, 10055 },
+    { 50486, 20, 1, 0, 10055 },
+    { 50506, 20, 1, 0, 10055 },
+    { 50526, 20, 1, 0, 10055 },
+    { 50546, 9, 0, 2, 10055 },
+    { 50555, 9, 1, 2, 10057 },
+    { 50564, 9, 0, 4, 10059 },
+    { 50573, 9, 0, 1, 10063 },
+    { 50582, 9, 0, 1, 10064 },
+    { 50591, 1, 4, 0, 10065 },
+    { 50592, 5, 1, 0, 10065 },
+    { 50597, 4, 1, 0, 10065 },
+    { 50601, 7, 4, 0, 10065 },
+    { 50608, 11, 4, 0, 10065 },
+    { 50619, 11, 4, 0, 10065 },
+    { 50630, 3, 4, 0, 10065 },
+    { 50633, 3, 4, 0, 10065 },
+    { 50636, 3, 4, 0, 10065 },
+    { 50639, 4, 1, 0, 10065 },
+    { 50643, 8, 1, 0, 10065 },
+    { 50651, 14, 1, 0, 10065 },
+    { 50665, 14, 1, 0, 10065 },
+    { 50679, 14, 1, 0, 10065 },
+    { 50693, 10, 1, 0, 10065 },
+    { 50703, 14, 1, 0, 10065 },
+    { 50717, 14, 1, 0, 10065 },
+    { 50731, 12, 1, 0, 10065 },
+    { 50743, 12, 1, 0, 10065 },
+    { 50755, 9, 1, 0, 10065 },
+    { 50764, 9, 1, 0, 10065 },
+    { 50773, 9, 1, 0, 10065 },
+    { 50782, 9, 1, 0, 10065 },
+    { 50791, 9, 1, 0, 10065 },
+    { 50800, 9, 1, 0, 10065 },
+    { 50809, 13, 1, 0, 10065 },
+    { 50822, 9, 1, 0, 10065 },
+    { 50831, 9, 1, 0, 10065 },
+    { 50840, 4, 1, 0, 10065 },
+    { 50844, 4, 1, 0, 10065 },
+    { 50848, 4, 1, 0, 10065 },
+    { 50852, 4, 1, 0, 10065 },
+    { 50856, 4, 1, 0, 10065 },
+    { 50860, 4, 1, 0, 10065 },
+    { 50864, 4, 1, 0, 10065 },
+    { 50868, 4, 1, 0, 10065 },
+    { 50872, 4, 1, 0, 10065 },
+    { 50876, 4, 1, 0, 10065 },
+    { 50880, 9, 1, 0, 10065 },
+    { 50889, 12, 1, 0, 10065 },
+    { 50901, 6, 1, 0, 10065 },
+    { 50907, 14, 1, 0, 10065 },
+    { 50921, 4, 1, 0, 10065 },
+    { 50925, 3, 4, 0, 10065 },
+    { 50928, 7, 1, 0, 10065 },
+    { 50935, 12, 4, 0, 10065 },
+    { 50947, 2, 1, 0, 10065 },
+    { 50949, 3, 1, 0, 10065 },
+    { 50952, 4, 1, 0, 10065 },
+    { 50956, 2, 1, 0, 10065 },
+    { 50958, 7, 1, 0, 10065 },
+    { 50965, 8, 1, 0, 10065 },
+    { 50973, 8, 1, 0, 10065 },
+    { 50981, 4, 1, 0, 10065 },
+    { 50985, 6, 1, 0, 10065 },
+    { 50991, 7, 1, 0, 10065 },
+    { 50998, 4, 1, 0, 10065 },
+    { 51002, 6, 1, 0, 10065 },
+    { 51008, 2, 1, 0, 10065 },
+    { 51010, 1, 1, 0, 10065 },
+    { 51011, 4, 1, 0, 10065 },
+    { 51015, 5, 1, 0, 10065 },
+    { 51020, 6, 1, 0, 10065 },
+    { 51026, 3, 1, 0, 10065 },
+    { 51029, 2, 1, 0, 10065 },
+    { 51031, 3, 1, 0, 10065 },
+    { 51034, 3, 1, 0, 10065 },
+    { 51037, 4, 1, 0, 10065 },
+    { 51041, 3, 1, 0, 10065 },
+    { 51044, 3, 1, 0, 10065 },
+    { 51047, 3, 1, 0, 10065 },
+    { 51050, 3, 1, 0, 10065 },
+    { 51053, 5, 1, 0, 10065 },
+    { 51058, 2, 1, 0, 10065 },
+    { 51060, 2, 1, 0, 10065 },
+    { 51062, 8, 1, 0, 10065 },
+    { 51070, 8, 1, 0, 10065 },
+    { 51078, 10, 0, 1, 10065 },
+    { 51088, 5, 4, 0, 10066 },
+    { 51093, 6, 1, 0, 10066 },
+    { 51099, 5, 0, 2, 10066 },
+    { 51104, 3, 1, 0, 10068 },
+    { 51107, 3, 1, 0, 10068 },
+    { 51110, 6, 1, 0, 10068 },
+    { 51116, 3, 1, 0, 10068 },
+    { 51119, 2, 0, 1, 10068 },
+    { 51121, 8, 1, 0, 10069 },
+    { 51129, 4, 4, 0, 10069 },
+    { 51133, 6, 1, 0, 10069 },
+    { 51139, 3, 4, 0, 10069 },
+    { 51142, 9, 1, 0, 10069 },
+    { 51151, 8, 1, 0, 10069 },
+    { 51159, 8, 1, 0, 10069 },
+    { 51167, 8, 1, 0, 10069 },
+    { 51175, 8, 1, 0, 10069 },
+    { 51183, 4, 1, 0, 10069 },
+    { 51187, 2, 1, 0, 10069 },
+    { 51189, 4, 1, 0, 10069 },
+    { 51193, 4, 1, 0, 10069 },
+    { 51197, 6, 1, 0, 10069 },
+    { 51203, 8, 1, 0, 10069 },
+    { 51211, 3, 4, 0, 10069 },
+    { 51214, 8, 1, 0, 10069 },
+    { 51222, 7, 1, 0, 10069 },
+    { 51229, 7, 1, 0, 10069 },
+    { 51236, 10, 1, 0, 10069 },
+    { 51246, 3, 1, 0, 10069 },
+    { 51249, 3, 1, 0, 10069 },
+    { 51252, 3, 1, 0, 10069 },
+    { 51255, 9, 4, 0, 10069 },
+    { 51264, 4, 1, 0, 10069 },
+    { 51268, 5, 1, 0, 10069 },
+    { 51273, 3, 1, 0, 10069 },
+    { 51276, 6, 1, 0, 10069 },
+    { 51282, 2, 1, 0, 10069 },
+    { 51284, 4, 1, 0, 10069 },
+    { 51288, 5, 1, 0, 10069 },
+    { 51293, 4, 1, 0, 10069 },
+    { 51297, 3, 4, 0, 10069 },
+    { 51300, 7, 1, 0, 10069 },
+    { 51307, 3, 0, 2, 10069 },
+    { 51310, 6, 0, 2, 10071 },
+    { 51316, 4, 0, 1, 10073 },
+    { 51320, 7, 0, 2, 10074 },
+    { 51327, 9, 1, 0, 10076 },
+    { 51336, 1, 1, 0, 10076 },
+    { 51337, 2, 1, 0, 10076 },
+    { 51339, 4, 0, 1, 10076 },
+    { 51343, 5, 1, 0, 10077 },
+    { 51348, 3, 1, 0, 10077 },
+    { 51351, 4, 1, 0, 10077 },
+    { 51355, 5, 1, 0, 10077 },
+    { 51360, 6, 1, 0, 10077 },
+    { 51366, 5, 1, 0, 10077 },
+    { 51371, 4, 1, 0, 10077 },
+    { 51375, 8, 1, 0, 10077 },
+    { 51383, 5, 1, 0, 10077 },
+    { 51388, 4, 1, 0, 10077 },
+    { 51392, 7, 1, 0, 10077 },
+    { 51399, 10, 1, 0, 10077 },
+    { 51409, 10, 1, 0, 10077 },
+    { 51419, 7, 1, 0, 10077 },
+    { 51426, 7, 1, 0, 10077 },
+    { 51433, 7, 1, 0, 10077 },
+    { 51440, 7, 1, 0, 10077 },
+    { 51447, 5, 1, 0, 10077 },
+    { 51452, 6, 1, 0, 10077 },
+    { 51458, 7, 1, 0, 10077 },
+    { 51465, 4, 1, 0, 10077 },
+    { 51469, 6, 1, 0, 10077 },
+    { 51475, 6, 1, 0, 10077 },
+    { 51481, 5, 1, 0, 10077 },
+    { 51486, 4, 1, 0, 10077 },
+    { 51490, 6, 1, 0, 10077 },
+    { 51496, 7, 1, 0, 10077 },
+    { 51503, 6, 1, 0, 10077 },
+    { 51509, 7, 1, 0, 10077 },
+    { 51516, 3, 1, 0, 10077 },
+    { 51519, 6, 1, 0, 10077 },
+    { 51525, 5, 1, 0, 10077 },
+    { 51530, 7, 1, 0, 10077 },
+    { 51537, 10, 1, 0, 10077 },
+    { 51547, 4, 1, 0, 10077 },
+    { 51551, 8, 1, 0, 10077 },
+    { 51559, 9, 1, 0, 10077 },
+    { 51568, 7, 1, 0, 10077 },
+    { 51575, 6, 1, 0, 10077 },
+    { 51581, 8, 1, 0, 10077 },
+    { 51589, 9, 1, 0, 10077 },
+    { 51598, 4, 1, 0, 10077 },
+    { 51602, 4, 1, 0, 10077 },
+    { 51606, 5, 1, 0, 10077 },
+    { 51611, 8, 1, 0, 10077 },
+    { 51619, 7, 1, 0, 10077 },
+    { 51626, 9, 1, 0, 10077 },
+    { 51635, 8, 1, 0, 10077 },
+    { 51643, 6, 1, 0, 10077 },
+    { 51649, 6, 1, 0, 10077 },
+    { 51655, 8, 1, 0, 10077 },
+    { 51663, 6, 1, 0, 10077 },
+    { 51669, 5, 1, 0, 10077 },
+    { 51674, 6, 1, 0, 10077 },
+    { 51680, 8, 1, 0, 10077 },
+    { 51688, 6, 1, 0, 10077 },
+    { 51694, 11, 1, 0, 10077 },
+    { 51705, 6, 1, 0, 10077 },
+    { 51711, 13, 1, 0, 10077 },
+    { 51724, 5, 1, 0, 10077 },
+    { 51729, 6, 1, 0, 10077 },
+    { 51735, 5, 1, 0, 10077 },
+    { 51740, 9, 1, 0, 10077 },
+    { 51749, 7, 1, 0, 10077 },
+    { 51756, 8, 1, 0, 10077 },
+    { 51764, 6, 1, 0, 10077 },
+    { 51770, 9, 1, 0, 10077 },
+    { 51779, 6, 1, 0, 10077 },
+    { 51785, 5, 1, 0, 10077 },
+    { 51790, 6, 1, 0, 10077 },
+    { 51796, 6, 1, 0, 10077 },
+    { 51802, 9, 1, 0, 10077 },
+    { 51811, 6, 1, 0, 10077 },
+    { 51817, 7, 1, 0, 10077 },
+    { 51824, 5, 1, 0, 10077 },
+    { 51829, 3, 1, 0, 10077 },
+    { 51832, 5, 1, 0, 10077 },
+    { 51837, 7, 1, 0, 10077 },
+    { 51844, 6, 1, 0, 10077 },
+    { 51850, 9, 1, 0, 10077 },
+    { 51859, 6, 1, 0, 10077 },
+    { 51865, 6, 1, 0, 10077 },
+    { 51871, 9, 1, 0, 10077 },
+    { 51880, 9, 1, 0, 10077 },
+    { 51889, 7, 1, 0, 10077 },
+    { 51896, 8, 1, 0, 10077 },
+    { 51904, 9, 1, 0, 10077 },
+    { 51913, 8, 1, 0, 10077 },
+    { 51921, 6, 1, 0, 10077 },
+    { 51927, 5, 1, 0, 10077 },
+    { 51932, 10, 1, 0, 10077 },
+    { 51942, 6, 1, 0, 10077 },
+    { 51948, 6, 1, 0, 10077 },
+    { 51954, 5, 1, 0, 10077 },
+    { 51959, 8, 1, 0, 10077 },
+    { 51967, 7, 1, 0, 10077 },
+    { 51974, 10, 1, 0, 10077 },
+    { 51984, 6, 1, 0, 10077 },
+    { 51990, 5, 1, 0, 10077 },
+    { 51995, 6, 1, 0, 10077 },
+    { 52001, 7, 1, 0, 10077 },
+    { 52008, 7, 1, 0, 10077 },
+    { 52015, 5, 1, 0, 10077 },
+    { 52020, 5, 1, 0, 10077 },
+    { 52025, 6, 1, 0, 10077 },
+    { 52031, 6, 1, 0, 10077 },
+    { 52037, 6, 1, 0, 10077 },
+    { 52043, 4, 1, 0, 10077 },
+    { 52047, 9, 1, 0, 10077 },
+    { 52056, 6, 1, 0, 10077 },
+    { 52062, 10, 1, 0, 10077 },
+    { 52072, 8, 1, 0, 10077 },
+    { 52080, 8, 1, 0, 10077 },
+    { 52088, 10, 1, 0, 10077 },
+    { 52098, 5, 1, 0, 10077 },
+    { 52103, 5, 1, 0, 10077 },
+    { 52108, 8, 1, 0, 10077 },
+    { 52116, 8, 1, 0, 10077 },
+    { 52124, 7, 1, 0, 10077 },
+    { 52131, 6, 1, 0, 10077 },
+    { 52137, 8, 1, 0, 10077 },
+    { 52145, 7, 1, 0, 10077 },
+    { 52152, 8, 1, 0, 10077 },
+    { 52160, 6, 1, 0, 10077 },
+    { 52166, 8, 1, 0, 10077 },
+    { 52174, 6, 1, 0, 10077 },
+    { 52180, 7, 1, 0, 10077 },
+    { 52187, 6, 1, 0, 10077 },
+    { 52193, 6, 1, 0, 10077 },
+    { 52199, 10, 1, 0, 10077 },
+    { 52209, 6, 1, 0, 10077 },
+    { 52215, 9, 1, 0, 10077 },
+    { 52224, 6, 1, 0, 10077 },
+    { 52230, 10, 1, 0, 10077 },
+    { 52240, 9, 1, 0, 10077 },
+    { 52249, 6, 1, 0, 10077 },
+    { 52255, 4, 1, 0, 10077 },
+    { 52259, 13, 1, 0, 10077 },
+    { 52272, 7, 1, 0, 10077 },
+    { 52279, 6, 1, 0, 10077 },
+    { 52285, 5, 1, 0, 10077 },
+    { 52290, 5, 1, 0, 10077 },
+    { 52295, 6, 1, 0, 10077 },
+    { 52301, 9, 1, 0, 10077 },
+    { 52310, 7, 1, 0, 10077 },
+    { 52317, 6, 1, 0, 10077 },
+    { 52323, 6, 1, 0, 10077 },
+    { 52329, 9, 1, 0, 10077 },
+    { 52338, 4, 1, 0, 10077 },
+    { 52342, 4, 1, 0, 10077 },
+    { 52346, 8, 1, 0, 10077 },
+    { 52354, 6, 1, 0, 10077 },
+    { 52360, 8, 1, 0, 10077 },
+    { 52368, 8, 1, 0, 10077 },
+    { 52376, 7, 1, 0, 10077 },
+    { 52383, 9, 1, 0, 10077 },
+    { 52392, 7, 1, 0, 10077 },
+    { 52399, 10, 1, 0, 10077 },
+    { 52409, 15, 1, 0, 10077 },
+    { 52424, 10, 1, 0, 10077 },
+    { 52434, 5, 1, 0, 10077 },
+    { 52439, 5, 1, 0, 10077 },
+    { 52444, 5, 1, 0, 10077 },
+    { 52449, 7, 1, 0, 10077 },
+    { 52456, 3, 1, 0, 10077 },
+    { 52459, 8, 1, 0, 10077 },
+    { 52467, 6, 1, 0, 10077 },
+    { 52473, 9, 1, 0, 10077 },
+    { 52482, 6, 1, 0, 10077 },
+    { 52488, 7, 1, 0, 10077 },
+    { 52495, 9, 1, 0, 10077 },
+    { 52504, 8, 1, 0, 10077 },
+    { 52512, 7, 1, 0, 10077 },
+    { 52519, 3, 1, 0, 10077 },
+    { 52522, 5, 1, 0, 10077 },
+    { 52527, 5, 1, 0, 10077 },
+    { 52532, 11, 1, 0, 10077 },
+    { 52543, 4, 1, 0, 10077 },
+    { 52547, 4, 1, 0, 10077 },
+    { 52551, 6, 1, 0, 10077 },
+    { 52557, 7, 1, 0, 10077 },
+    { 52564, 10, 1, 0, 10077 },
+    { 52574, 7, 1, 0, 10077 },
+    { 52581, 7, 1, 0, 10077 },
+    { 52588, 5, 1, 0, 10077 },
+    { 52593, 5, 1, 0, 10077 },
+    { 52598, 9, 1, 0, 10077 },
+    { 52607, 6, 1, 0, 10077 },
+    { 52613, 13, 1, 0, 10077 },
+    { 52626, 5, 1, 0, 10077 },
+    { 52631, 3, 1, 0, 10077 },
+    { 52634, 3, 1, 0, 10077 },
+    { 52637, 5, 1, 0, 10077 },
+    { 52642, 5, 1, 0, 10077 },
+    { 52647, 8, 1, 0, 10077 },
+    { 52655, 7, 1, 0, 10077 },
+    { 52662, 6, 1, 0, 10077 },
+    { 52668, 6, 1, 0, 10077 },
+    { 52674, 5, 1, 0, 10077 },
+    { 52679, 7, 1, 0, 10077 },
+    { 52686, 7, 1, 0, 10077 },
+    { 52693, 7, 1, 0, 10077 },
+    { 52700, 10, 1, 0, 10077 },
+    { 52710, 8, 1, 0, 10077 },
+    { 52718, 4, 1, 0, 10077 },
+    { 52722, 7, 1, 0, 10077 },
+    { 52729, 7, 1, 0, 10077 },
+    { 52736, 6, 1, 0, 10077 },
+    { 52742, 7, 1, 0, 10077 },
+    { 52749, 8, 1, 0, 10077 },
+    { 52757, 8, 1, 0, 10077 },
+    { 52765, 6, 1, 0, 10077 },
+    { 52771, 8, 1, 0, 10077 },
+    { 52779, 4, 1, 0, 10077 },
+    { 52783, 6, 1, 0, 10077 },
+    { 52789, 6, 1, 0, 10077 },
+    { 52795, 6, 1, 0, 10077 },
+    { 52801, 6, 1, 0, 10077 },
+    { 52807, 4, 1, 0, 10077 },
+    { 52811, 6, 1, 0, 10077 },
+    { 52817, 6, 1, 0, 10077 },
+    { 52823, 6, 1, 0, 10077 },
+    { 52829, 6, 1, 0, 10077 },
+    { 52835, 6, 1, 0, 10077 },
+    { 52841, 6, 1, 0, 10077 },
+    { 52847, 8, 1, 0, 10077 },
+    { 52855, 8, 1, 0, 10077 },
+    { 52863, 8, 1, 0, 10077 },
+    { 52871, 8, 1, 0, 10077 },
+    { 52879, 6, 1, 0, 10077 },
+    { 52885, 5, 1, 0, 10077 },
+    { 52890, 6, 1, 0, 10077 },
+    { 52896, 5, 1, 0, 10077 },
+    { 52901, 7, 1, 0, 10077 },
+    { 52908, 5, 1, 0, 10077 },
+    { 52913, 3, 1, 0, 10077 },
+    { 52916, 5, 1, 0, 10077 },
+    { 52921, 4, 1, 0, 10077 },
+    { 52925, 5, 1, 0, 10077 },
+    { 52930, 3, 1, 0, 10077 },
+    { 52933, 7, 1, 0, 10077 },
+    { 52940, 8, 1, 0, 10077 },
+    { 52948, 6, 1, 0, 10077 },
+    { 52954, 13, 1, 0, 10077 },
+    { 52967, 6, 1, 0, 10077 },
+    { 52973, 5, 1, 0, 10077 },
+    { 52978, 3, 1, 0, 10077 },
+    { 52981, 9, 1, 0, 10077 },
+    { 52990, 6, 1, 0, 10077 },
+    { 52996, 6, 1, 0, 10077 },
+    { 53002, 4, 1, 0, 10077 },
+    { 53006, 7, 1, 0, 10077 },
+    { 53013, 6, 1, 0, 10077 },
+    { 53019, 5, 1, 0, 10077 },
+    { 53024, 3, 1, 0, 10077 },
+    { 53027, 4, 1, 0, 10077 },
+    { 53031, 6, 1, 0, 10077 },
+    { 53037, 4, 1, 0, 10077 },
+    { 53041, 8, 1, 0, 10077 },
+    { 53049, 9, 1, 0, 10077 },
+    { 53058, 9, 1, 0, 10077 },
+    { 53067, 10, 1, 0, 10077 },
+    { 53077, 13, 1, 0, 10077 },
+    { 53090, 7, 1, 0, 10077 },
+    { 53097, 6, 1, 0, 10077 },
+    { 53103, 4, 1, 0, 10077 },
+    { 53107, 9, 1, 0, 10077 },
+    { 53116, 8, 1, 0, 10077 },
+    { 53124, 6, 1, 0, 10077 },
+    { 53130, 6, 1, 0, 10077 },
+    { 53136, 7, 1, 0, 10077 },
+    { 53143, 6, 1, 0, 10077 },
+    { 53149, 6, 1, 0, 10077 },
+    { 53155, 6, 1, 0, 10077 },
+    { 53161, 10, 1, 0, 10077 },
+    { 53171, 8, 1, 0, 10077 },
+    { 53179, 5, 1, 0, 10077 },
+    { 53184, 9, 1, 0, 10077 },
+    { 53193, 10, 1, 0, 10077 },
+    { 53203, 8, 1, 0, 10077 },
+    { 53211, 8, 1, 0, 10077 },
+    { 53219, 8, 1, 0, 10077 },
+    { 53227, 12, 1, 0, 10077 },
+    { 53239, 5, 1, 0, 10077 },
+    { 53244, 8, 1, 0, 10077 },
+    { 53252, 6, 1, 0, 10077 },
+    { 53258, 6, 1, 0, 10077 },
+    { 53264, 7, 1, 0, 10077 },
+    { 53271, 5, 1, 0, 10077 },
+    { 53276, 5, 1, 0, 10077 },
+    { 53281, 9, 1, 0, 10077 },
+    { 53290, 7, 1, 0, 10077 },
+    { 53297, 5, 1, 0, 10077 },
+    { 53302, 7, 1, 0, 10077 },
+    { 53309, 3, 1, 0, 10077 },
+    { 53312, 5, 1, 0, 10077 },
+    { 53317, 8, 1, 0, 10077 },
+    { 53325, 7, 1, 0, 10077 },
+    { 53332, 9, 1, 0, 10077 },
+    { 53341, 5, 1, 0, 10077 },
+    { 53346, 4, 1, 0, 10077 },
+    { 53350, 8, 1, 0, 10077 },
+    { 53358, 7, 1, 0, 10077 },
+    { 53365, 8, 1, 0, 10077 },
+    { 53373, 8, 1, 0, 10077 },
+    { 53381, 5, 1, 0, 10077 },
+    { 53386, 6, 1, 0, 10077 },
+    { 53392, 6, 1, 0, 10077 },
+    { 53398, 9, 1, 0, 10077 },
+    { 53407, 7, 1, 0, 10077 },
+    { 53414, 6, 1, 0, 10077 },
+    { 53420, 7, 1, 0, 10077 },
+    { 53427, 3, 1, 0, 10077 },
+    { 53430, 4, 1, 0, 10077 },
+    { 53434, 5, 1, 0, 10077 },
+    { 53439, 4, 1, 0, 10077 },
+    { 53443, 4, 1, 0, 10077 },
+    { 53447, 7, 1, 0, 10077 },
+    { 53454, 7, 1, 0, 10077 },
+    { 53461, 4, 1, 0, 10077 },
+    { 53465, 16, 1, 0, 10077 },
+    { 53481, 7, 1, 0, 10077 },
+    { 53488, 5, 1, 0, 10077 },
+    { 53493, 12, 1, 0, 10077 },
+    { 53505, 4, 1, 0, 10077 },
+    { 53509, 8, 1, 0, 10077 },
+    { 53517, 9, 1, 0, 10077 },
+    { 53526, 6, 1, 0, 10077 },
+    { 53532, 8, 1, 0, 10077 },
+    { 53540, 4, 1, 0, 10077 },
+    { 53544, 8, 1, 0, 10077 },
+    { 53552, 6, 1, 0, 10077 },
+    { 53558, 8, 1, 0, 10077 },
+    { 53566, 6, 1, 0, 10077 },
+    { 53572, 11, 1, 0, 10077 },
+    { 53583, 5, 1, 0, 10077 },
+    { 53588, 8, 1, 0, 10077 },
+    { 53596, 4, 1, 0, 10077 },
+    { 53600, 10, 1, 0, 10077 },
+    { 53610, 9, 1, 0, 10077 },
+    { 53619, 6, 1, 0, 10077 },
+    { 53625, 8, 1, 0, 10077 },
+    { 53633, 5, 1, 0, 10077 },
+    { 53638, 4, 1, 0, 10077 },
+    { 53642, 6, 1, 0, 10077 },
+    { 53648, 8, 1, 0, 10077 },
+    { 53656, 8, 1, 0, 10077 },
+    { 53664, 6, 1, 0, 10077 },
+    { 53670, 4, 1, 0, 10077 },
+    { 53674, 6, 1, 0, 10077 },
+    { 53680, 7, 1, 0, 10077 },
+    { 53687, 7, 1, 0, 10077 },
+    { 53694, 15, 1, 0, 10077 },
+    { 53709, 7, 1, 0, 10077 },
+    { 53716, 7, 1, 0, 10077 },
+    { 53723, 5, 1, 0, 10077 },
+    { 53728, 5, 1, 0, 10077 },
+    { 53733, 9, 1, 0, 10077 },
+    { 53742, 6, 1, 0, 10077 },
+    { 53748, 5, 1, 0, 10077 },
+    { 53753, 7, 1, 0, 10077 },
+    { 53760, 8, 1, 0, 10077 },
+    { 53768, 5, 1, 0, 10077 },
+    { 53773, 6, 1, 0, 10077 },
+    { 53779, 8, 1, 0, 10077 },
+    { 53787, 10, 1, 0, 10077 },
+    { 53797, 8, 1, 0, 10077 },
+    { 53805, 7, 1, 0, 10077 },
+    { 53812, 6, 1, 0, 10077 },
+    { 53818, 6, 1, 0, 10077 },
+    { 53824, 3, 1, 0, 10077 },
+    { 53827, 3, 1, 0, 10077 },
+    { 53830, 9, 1, 0, 10077 },
+    { 53839, 9, 1, 0, 10077 },
+    { 53848, 6, 1, 0, 10077 },
+    { 53854, 5, 1, 0, 10077 },
+    { 53859, 8, 1, 0, 10077 },
+    { 53867, 8, 1, 0, 10077 },
+    { 53875, 8, 1, 0, 10077 },
+    { 53883, 11, 1, 0, 10077 },
+    { 53894, 7, 1, 0, 10077 },
+    { 53901, 9, 1, 0, 10077 },
+    { 53910, 8, 1, 0, 10077 },
+    { 53918, 4, 1, 0, 10077 },
+    { 53922, 8, 1, 0, 10077 },
+    { 53930, 9, 1, 0, 10077 },
+    { 53939, 5, 1, 0, 10077 },
+    { 53944, 7, 1, 0, 10077 },
+    { 53951, 5, 1, 0, 10077 },
+    { 53956, 8, 1, 0, 10077 },
+    { 53964, 11, 1, 0, 10077 },
+    { 53975, 16, 1, 0, 10077 },
+    { 53991, 5, 1, 0, 10077 },
+    { 53996, 12, 1, 0, 10077 },
+    { 54008, 5, 1, 0, 10077 },
+    { 54013, 3, 1, 0, 10077 },
+    { 54016, 6, 1, 0, 10077 },
+    { 54022, 4, 1, 0, 10077 },
+    { 54026, 6, 1, 0, 10077 },
+    { 54032, 7, 1, 0, 10077 },
+    { 54039, 4, 1, 0, 10077 },
+    { 54043, 8, 1, 0, 10077 },
+    { 54051, 13, 1, 0, 10077 },
+    { 54064, 5, 1, 0, 10077 },
+    { 54069, 4, 1, 0, 10077 },
+    { 54073, 4, 1, 0, 10077 },
+    { 54077, 9, 1, 0, 10077 },
+    { 54086, 8, 1, 0, 10077 },
+    { 54094, 7, 1, 0, 10077 },
+    { 54101, 8, 1, 0, 10077 },
+    { 54109, 8, 1, 0, 10077 },
+    { 54117, 5, 1, 0, 10077 },
+    { 54122, 7, 1, 0, 10077 },
+    { 54129, 7, 1, 0, 10077 },
+    { 54136, 7, 1, 0, 10077 },
+    { 54143, 9, 1, 0, 10077 },
+    { 54152, 9, 1, 0, 10077 },
+    { 54161, 6, 1, 0, 10077 },
+    { 54167, 6, 1, 0, 10077 },
+    { 54173, 6, 1, 0, 10077 },
+    { 54179, 5, 1, 0, 10077 },
+    { 54184, 4, 1, 0, 10077 },
+    { 54188, 6, 1, 0, 10077 },
+    { 54194, 6, 1, 0, 10077 },
+    { 54200, 8, 1, 0, 10077 },
+    { 54208, 11, 1, 0, 10077 },
+    { 54219, 7, 1, 0, 10077 },
+    { 54226, 4, 1, 0, 10077 },
+    { 54230, 6, 1, 0, 10077 },
+    { 54236, 7, 1, 0, 10077 },
+    { 54243, 5, 1, 0, 10077 },
+    { 54248, 5, 1, 0, 10077 },
+    { 54253, 4, 1, 0, 10077 },
+    { 54257, 6, 1, 0, 10077 },
+    { 54263, 8, 1, 0, 10077 },
+    { 54271, 9, 1, 0, 10077 },
+    { 54280, 6, 1, 0, 10077 },
+    { 54286, 8, 1, 0, 10077 },
+    { 54294, 6, 1, 0, 10077 },
+    { 54300, 8, 1, 0, 10077 },
+    { 54308, 12, 1, 0, 10077 },
+    { 54320, 6, 1, 0, 10077 },
+    { 54326, 13, 1, 0, 10077 },
+    { 54339, 11, 1, 0, 10077 },
+    { 54350, 5, 1, 0, 10077 },
+    { 54355, 7, 1, 0, 10077 },
+    { 54362, 6, 1, 0, 10077 },
+    { 54368, 8, 1, 0, 10077 },
+    { 54376, 9, 1, 0, 10077 },
+    { 54385, 8, 1, 0, 10077 },
+    { 54393, 5, 1, 0, 10077 },
+    { 54398, 7, 1, 0, 10077 },
+    { 54405, 8, 1, 0, 10077 },
+    { 54413, 9, 1, 0, 10077 },
+    { 54422, 6, 1, 0, 10077 },
+    { 54428, 10, 1, 0, 10077 },
+    { 54438, 8, 1, 0, 10077 },
+    { 54446, 11, 1, 0, 10077 },
+    { 54457, 12, 1, 0, 10077 },
+    { 54469, 8, 1, 0, 10077 },
+    { 54477, 6, 1, 0, 10077 },
+    { 54483, 8, 1, 0, 10077 },
+    { 54491, 7, 1, 0, 10077 },
+    { 54498, 9, 1, 0, 10077 },
+    { 54507, 13, 1, 0, 10077 },
+    { 54520, 6, 1, 0, 10077 },
+    { 54526, 8, 1, 0, 10077 },
+    { 54534, 9, 1, 0, 10077 },
+    { 54543, 8, 1, 0, 10077 },
+    { 54551, 8, 1, 0, 10077 },
+    { 54559, 12, 1, 0, 10077 },
+    { 54571, 7, 1, 0, 10077 },
+    { 54578, 7, 1, 0, 10077 },
+    { 54585, 5, 1, 0, 10077 },
+    { 54590, 7, 1, 0, 10077 },
+    { 54597, 8, 1, 0, 10077 },
+    { 54605, 6, 1, 0, 10077 },
+    { 54611, 12, 1, 0, 10077 },
+    { 54623, 8, 1, 0, 10077 },
+    { 54631, 8, 1, 0, 10077 },
+    { 54639, 6, 1, 0, 10077 },
+    { 54645, 7, 1, 0, 10077 },
+    { 54652, 4, 1, 0, 10077 },
+    { 54656, 8, 1, 0, 10077 },
+    { 54664, 12, 1, 0, 10077 },
+    { 54676, 12, 1, 0, 10077 },
+    { 54688, 5, 1, 0, 10077 },
+    { 54693, 7, 1, 0, 10077 },
+    { 54700, 6, 1, 0, 10077 },
+    { 54706, 6, 1, 0, 10077 },
+    { 54712, 8, 1, 0, 10077 },
+    { 54720, 4, 1, 0, 10077 },
+    { 54724, 11, 1, 0, 10077 },
+    { 54735, 11, 1, 0, 10077 },
+    { 54746, 6, 1, 0, 10077 },
+    { 54752, 7, 1, 0, 10077 },
+    { 54759, 5, 1, 0, 10077 },
+    { 54764, 5, 1, 0, 10077 },
+    { 54769, 6, 1, 0, 10077 },
+    { 54775, 5, 1, 0, 10077 },
+    { 54780, 5, 1, 0, 10077 },
+    { 54785, 7, 1, 0, 10077 },
+    { 54792, 9, 1, 0, 10077 },
+    { 54801, 4, 1, 0, 10077 },
+    { 54805, 5, 1, 0, 10077 },
+    { 54810, 5, 1, 0, 10077 },
+    { 54815, 8, 1, 0, 10077 },
+    { 54823, 5, 1, 0, 10077 },
+    { 54828, 9, 1, 0, 10077 },
+    { 54837, 7, 1, 0, 10077 },
+    { 54844, 11, 1, 0, 10077 },
+    { 54855, 6, 1, 0, 10077 },
+    { 54861, 9, 1, 0, 10077 },
+    { 54870, 8, 1, 0, 10077 },
+    { 54878, 5, 1, 0, 10077 },
+    { 54883, 8, 1, 0, 10077 },
+    { 54891, 8, 1, 0, 10077 },
+    { 54899, 7, 1, 0, 10077 },
+    { 54906, 7, 1, 0, 10077 },
+    { 54913, 9, 1, 0, 10077 },
+    { 54922, 7, 1, 0, 10077 },
+    { 54929, 9, 1, 0, 10077 },
+    { 54938, 12, 1, 0, 10077 },
+    { 54950, 8, 1, 0, 10077 },
+    { 54958, 9, 1, 0, 10077 },
+    { 54967, 7, 1, 0, 10077 },
+    { 54974, 9, 1, 0, 10077 },
+    { 54983, 7, 1, 0, 10077 },
+    { 54990, 8, 1, 0, 10077 },
+    { 54998, 5, 1, 0, 10077 },
+    { 55003, 6, 1, 0, 10077 },
+    { 55009, 8, 1, 0, 10077 },
+    { 55017, 8, 1, 0, 10077 },
+    { 55025, 9, 1, 0, 10077 },
+    { 55034, 7, 1, 0, 10077 },
+    { 55041, 5, 1, 0, 10077 },
+    { 55046, 9, 1, 0, 10077 },
+    { 55055, 6, 1, 0, 10077 },
+    { 55061, 4, 1, 0, 10077 },
+    { 55065, 6, 1, 0, 10077 },
+    { 55071, 8, 1, 0, 10077 },
+    { 55079, 7, 1, 0, 10077 },
+    { 55086, 8, 1, 0, 10077 },
+    { 55094, 9, 1, 0, 10077 },
+    { 55103, 7, 1, 0, 10077 },
+    { 55110, 6, 1, 0, 10077 },
+    { 55116, 4, 1, 0, 10077 },
+    { 55120, 9, 1, 0, 10077 },
+    { 55129, 8, 1, 0, 10077 },
+    { 55137, 7, 1, 0, 10077 },
+    { 55144, 6, 1, 0, 10077 },
+    { 55150, 6, 1, 0, 10077 },
+    { 55156, 4, 1, 0, 10077 },
+    { 55160, 6, 1, 0, 10077 },
+    { 55166, 3, 1, 0, 10077 },
+    { 55169, 9, 1, 0, 10077 },
+    { 55178, 6, 1, 0, 10077 },
+    { 55184, 5, 1, 0, 10077 },
+    { 55189, 6, 1, 0, 10077 },
+    { 55195, 5, 1, 0, 10077 },
+    { 55200, 8, 1, 0, 10077 },
+    { 55208, 7, 1, 0, 10077 },
+    { 55215, 6, 1, 0, 10077 },
+    { 55221, 6, 1, 0, 10077 },
+    { 55227, 8, 1, 0, 10077 },
+    { 55235, 7, 1, 0, 10077 },
+    { 55242, 5, 1, 0, 10077 },
+    { 55247, 8, 1, 0, 10077 },
+    { 55255, 8, 1, 0, 10077 },
+    { 55263, 8, 1, 0, 10077 },
+    { 55271, 5, 1, 0, 10077 },
+    { 55276, 6, 1, 0, 10077 },
+    { 55282, 9, 1, 0, 10077 },
+    { 55291, 4, 1, 0, 10077 },
+    { 55295, 11, 1, 0, 10077 },
+    { 55306, 11, 1, 0, 10077 },
+    { 55317, 9, 1, 0, 10077 },
+    { 55326, 3, 1, 0, 10077 },
+    { 55329, 5, 1, 0, 10077 },
+    { 55334, 6, 1, 0, 10077 },
+    { 55340, 8, 1, 0, 10077 },
+    { 55348, 4, 1, 0, 10077 },
+    { 55352, 6, 1, 0, 10077 },
+    { 55358, 9, 1, 0, 10077 },
+    { 55367, 5, 1, 0, 10077 },
+    { 55372, 6, 1, 0, 10077 },
+    { 55378, 6, 1, 0, 10077 },
+    { 55384, 4, 1, 0, 10077 },
+    { 55388, 10, 1, 0, 10077 },
+    { 55398, 8, 1, 0, 10077 },
+    { 55406, 6, 1, 0, 10077 },
+    { 55412, 5, 1, 0, 10077 },
+    { 55417, 7, 1, 0, 10077 },
+    { 55424, 7, 1, 0, 10077 },
+    { 55431, 4, 1, 0, 10077 },
+    { 55435, 7, 1, 0, 10077 },
+    { 55442, 4, 1, 0, 10077 },
+    { 55446, 6, 1, 0, 10077 },
+    { 55452, 3, 1, 0, 10077 },
+    { 55455, 5, 1, 0, 10077 },
+    { 55460, 5, 1, 0, 10077 },
+    { 55465, 8, 1, 0, 10077 },
+    { 55473, 5, 1, 0, 10077 },
+    { 55478, 9, 1, 0, 10077 },
+    { 55487, 7, 1, 0, 10077 },
+    { 55494, 11, 1, 0, 10077 },
+    { 55505, 12, 1, 0, 10077 },
+    { 55517, 10, 1, 0, 10077 },
+    { 55527, 7, 1, 0, 10077 },
+    { 55534, 3, 1, 0, 10077 },
+    { 55537, 8, 1, 0, 10077 },
+    { 55545, 5, 1, 0, 10077 },
+    { 55550, 5, 1, 0, 10077 },
+    { 55555, 4, 1, 0, 10077 },
+    { 55559, 6, 1, 0, 10077 },
+    { 55565, 6, 1, 0, 10077 },
+    { 55571, 7, 1, 0, 10077 },
+    { 55578, 11, 1, 0, 10077 },
+    { 55589, 4, 1, 0, 10077 },
+    { 55593, 4, 1, 0, 10077 },
+    { 55597, 4, 1, 0, 10077 },
+    { 55601, 6, 1, 0, 10077 },
+    { 55607, 4, 1, 0, 10077 },
+    { 55611, 8, 1, 0, 10077 },
+    { 55619, 5, 1, 0, 10077 },
+    { 55624, 5, 1, 0, 10077 },
+    { 55629, 7, 1, 0, 10077 },
+    { 55636, 9, 1, 0, 10077 },
+    { 55645, 5, 1, 0, 10077 },
+    { 55650, 10, 1, 0, 10077 },
+    { 55660, 9, 1, 0, 10077 },
+    { 55669, 10, 1, 0, 10077 },
+    { 55679, 9, 1, 0, 10077 },
+    { 55688, 4, 1, 0, 10077 },
+    { 55692, 5, 1, 0, 10077 },
+    { 55697, 8, 1, 0, 10077 },
+    { 55705, 11, 1, 0, 10077 },
+    { 55716, 5, 1, 0, 10077 },
+    { 55721, 6, 1, 0, 10077 },
+    { 55727, 4, 1, 0, 10077 },
+    { 55731, 6, 1, 0, 10077 },
+    { 55737, 9, 1, 0, 10077 },
+    { 55746, 7, 1, 0, 10077 },
+    { 55753, 8, 1, 0, 10077 },
+    { 55761, 6, 1, 0, 10077 },
+    { 55767, 7, 1, 0, 10077 },
+    { 55774, 8, 1, 0, 10077 },
+    { 55782, 6, 1, 0, 10077 },
+    { 55788, 4, 1, 0, 10077 },
+    { 55792, 7, 1, 0, 10077 },
+    { 55799, 5, 1, 0, 10077 },
+    { 55804, 7, 1, 0, 10077 },
+    { 55811, 4, 1, 0, 10077 },
+    { 55815, 6, 1, 0, 10077 },
+    { 55821, 8, 1, 0, 10077 },
+    { 55829, 8, 1, 0, 10077 },
+    { 55837, 7, 1, 0, 10077 },
+    { 55844, 8, 1, 0, 10077 },
+    { 55852, 5, 1, 0, 10077 },
+    { 55857, 4, 1, 0, 10077 },
+    { 55861, 8, 1, 0, 10077 },
+    { 55869, 4, 1, 0, 10077 },
+    { 55873, 5, 1, 0, 10077 },
+    { 55878, 4, 1, 0, 10077 },
+    { 55882, 7, 1, 0, 10077 },
+    { 55889, 7, 1, 0, 10077 },
+    { 55896, 8, 1, 0, 10077 },
+    { 55904, 6, 1, 0, 10077 },
+    { 55910, 5, 1, 0, 10077 },
+    { 55915, 8, 1, 0, 10077 },
+    { 55923, 8, 1, 0, 10077 },
+    { 55931, 9, 1, 0, 10077 },
+    { 55940, 6, 1, 0, 10077 },
+    { 55946, 8, 1, 0, 10077 },
+    { 55954, 10, 1, 0, 10077 },
+    { 55964, 8, 1, 0, 10077 },
+    { 55972, 5, 1, 0, 10077 },
+    { 55977, 6, 1, 0, 10077 },
+    { 55983, 8, 1, 0, 10077 },
+    { 55991, 10, 1, 0, 10077 },
+    { 56001, 7, 1, 0, 10077 },
+    { 56008, 5, 1, 0, 10077 },
+    { 56013, 8, 1, 0, 10077 },
+    { 56021, 4, 1, 0, 10077 },
+    { 56025, 6, 1, 0, 10077 },
+    { 56031, 8, 1, 0, 10077 },
+    { 56039, 6, 1, 0, 10077 },
+    { 56045, 8, 1, 0, 10077 },
+    { 56053, 7, 1, 0, 10077 },
+    { 56060, 6, 1, 0, 10077 },
+    { 56066, 4, 1, 0, 10077 },
+    { 56070, 7, 1, 0, 10077 },
+    { 56077, 4, 1, 0, 10077 },
+    { 56081, 7, 1, 0, 10077 },
+    { 56088, 13, 1, 0, 10077 },
+    { 56101, 5, 1, 0, 10077 },
+    { 56106, 11, 1, 0, 10077 },
+    { 56117, 6, 1, 0, 10077 },
+    { 56123, 8, 1, 0, 10077 },
+    { 56131, 4, 1, 0, 10077 },
+    { 56135, 6, 1, 0, 10077 },
+    { 56141, 6, 1, 0, 10077 },
+    { 56147, 7, 1, 0, 10077 },
+    { 56154, 13, 1, 0, 10077 },
+    { 56167, 7, 1, 0, 10077 },
+    { 56174, 8, 1, 0, 10077 },
+    { 56182, 5, 1, 0, 10077 },
+    { 56187, 8, 1, 0, 10077 },
+    { 56195, 6, 1, 0, 10077 },
+    { 56201, 8, 1, 0, 10077 },
+    { 56209, 6, 1, 0, 10077 },
+    { 56215, 7, 1, 0, 10077 },
+    { 56222, 9, 1, 0, 10077 },
+    { 56231, 7, 1, 0, 10077 },
+    { 56238, 8, 1, 0, 10077 },
+    { 56246, 5, 1, 0, 10077 },
+    { 56251, 8, 1, 0, 10077 },
+    { 56259, 5, 1, 0, 10077 },
+    { 56264, 5, 1, 0, 10077 },
+    { 56269, 5, 1, 0, 10077 },
+    { 56274, 3, 1, 0, 10077 },
+    { 56277, 4, 1, 0, 10077 },
+    { 56281, 5, 1, 0, 10077 },
+    { 56286, 9, 1, 0, 10077 },
+    { 56295, 6, 1, 0, 10077 },
+    { 56301, 8, 1, 0, 10077 },
+    { 56309, 5, 1, 0, 10077 },
+    { 56314, 7, 1, 0, 10077 },
+    { 56321, 10, 1, 0, 10077 },
+    { 56331, 9, 1, 0, 10077 },
+    { 56340, 10, 1, 0, 10077 },
+    { 56350, 8, 1, 0, 10077 },
+    { 56358, 12, 1, 0, 10077 },
+    { 56370, 13, 1, 0, 10077 },
+    { 56383, 3, 1, 0, 10077 },
+    { 56386, 8, 1, 0, 10077 },
+    { 56394, 5, 1, 0, 10077 },
+    { 56399, 6, 1, 0, 10077 },
+    { 56405, 6, 1, 0, 10077 },
+    { 56411, 5, 1, 0, 10077 },
+    { 56416, 9, 1, 0, 10077 },
+    { 56425, 5, 1, 0, 10077 },
+    { 56430, 8, 1, 0, 10077 },
+    { 56438, 6, 1, 0, 10077 },
+    { 56444, 6, 1, 0, 10077 },
+    { 56450, 9, 1, 0, 10077 },
+    { 56459, 7, 1, 0, 10077 },
+    { 56466, 6, 1, 0, 10077 },
+    { 56472, 8, 1, 0, 10077 },
+    { 56480, 8, 1, 0, 10077 },
+    { 56488, 7, 1, 0, 10077 },
+    { 56495, 14, 1, 0, 10077 },
+    { 56509, 5, 1, 0, 10077 },
+    { 56514, 5, 1, 0, 10077 },
+    { 56519, 8, 1, 0, 10077 },
+    { 56527, 7, 1, 0, 10077 },
+    { 56534, 2, 1, 0, 10077 },
+    { 56536, 4, 1, 0, 10077 },
+    { 56540, 10, 1, 0, 10077 },
+    { 56550, 8, 1, 0, 10077 },
+    { 56558, 6, 1, 0, 10077 },
+    { 56564, 8, 1, 0, 10077 },
+    { 56572, 6, 1, 0, 10077 },
+    { 56578, 8, 1, 0, 10077 },
+    { 56586, 8, 1, 0, 10077 },
+    { 56594, 4, 1, 0, 10077 },
+    { 56598, 5, 1, 0, 10077 },
+    { 56603, 4, 2, 0, 10077 },
+    { 56607, 4, 2, 0, 10077 },
+    { 56611, 4, 2, 0, 10077 },
+    { 56615, 3, 1, 0, 10077 },
+    { 56618, 6, 1, 0, 10077 },
+    { 56624, 6, 1, 0, 10077 },
+    { 56630, 12, 1, 0, 10077 },
+    { 56642, 3, 1, 0, 10077 },
+    { 56645, 6, 1, 0, 10077 },
+    { 56651, 4, 1, 0, 10077 },
+    { 56655, 8, 1, 0, 10077 },
+    { 56663, 5, 1, 0, 10077 },
+    { 56668, 6, 1, 0, 10077 },
+    { 56674, 8, 1, 0, 10077 },
+    { 56682, 6, 1, 0, 10077 },
+    { 56688, 6, 1, 0, 10077 },
+    { 56694, 8, 1, 0, 10077 },
+    { 56702, 7, 1, 0, 10077 },
+    { 56709, 9, 1, 0, 10077 },
+    { 56718, 10, 1, 0, 10077 },
+    { 56728, 4, 1, 0, 10077 },
+    { 56732, 5, 1, 0, 10077 },
+    { 56737, 5, 1, 0, 10077 },
+    { 56742, 6, 1, 0, 10077 },
+    { 56748, 6, 1, 0, 10077 },
+    { 56754, 6, 1, 0, 10077 },
+    { 56760, 6, 1, 0, 10077 },
+    { 56766, 4, 1, 0, 10077 },
+    { 56770, 11, 1, 0, 10077 },
+    { 56781, 4, 1, 0, 10077 },
+    { 56785, 5, 1, 0, 10077 },
+    { 56790, 5, 1, 0, 10077 },
+    { 56795, 6, 1, 0, 10077 },
+    { 56801, 8, 1, 0, 10077 },
+    { 56809, 7, 1, 0, 10077 },
+    { 56816, 4, 1, 0, 10077 },
+    { 56820, 3, 1, 0, 10077 },
+    { 56823, 5, 1, 0, 10077 },
+    { 56828, 7, 1, 0, 10077 },
+    { 56835, 11, 1, 0, 10077 },
+    { 56846, 7, 1, 0, 10077 },
+    { 56853, 8, 1, 0, 10077 },
+    { 56861, 7, 1, 0, 10077 },
+    { 56868, 6, 1, 0, 10077 },
+    { 56874, 8, 1, 0, 10077 },
+    { 56882, 11, 1, 0, 10077 },
+    { 56893, 6, 1, 0, 10077 },
+    { 56899, 9, 1, 0, 10077 },
+    { 56908, 5, 1, 0, 10077 },
+    { 56913, 3, 1, 0, 10077 },
+    { 56916, 6, 1, 0, 10077 },
+    { 56922, 8, 1, 0, 10077 },
+    { 56930, 3, 1, 0, 10077 },
+    { 56933, 3, 1, 0, 10077 },
+    { 56936, 6, 1, 0, 10077 },
+    { 56942, 6, 1, 0, 10077 },
+    { 56948, 10, 1, 0, 10077 },
+    { 56958, 5, 1, 0, 10077 },
+    { 56963, 11, 1, 0, 10077 },
+    { 56974, 11, 1, 0, 10077 },
+    { 56985, 3, 1, 0, 10077 },
+    { 56988, 3, 1, 0, 10077 },
+    { 56991, 4, 1, 0, 10077 },
+    { 56995, 7, 1, 0, 10077 },
+    { 57002, 4, 1, 0, 10077 },
+    { 57006, 4, 1, 0, 10077 },
+    { 57010, 4, 1, 0, 10077 },
+    { 57014, 8, 1, 0, 10077 },
+    { 57022, 8, 1, 0, 10077 },
+    { 57030, 9, 1, 0, 10077 },
+    { 57039, 8, 1, 0, 10077 },
+    { 57047, 7, 1, 0, 10077 },
+    { 57054, 6, 1, 0, 10077 },
+    { 57060, 15, 1, 0, 10077 },
+    { 57075, 6, 1, 0, 10077 },
+    { 57081, 4, 1, 0, 10077 },
+    { 57085, 10, 1, 0, 10077 },
+    { 57095, 7, 1, 0, 10077 },
+    { 57102, 6, 1, 0, 10077 },
+    { 57108, 9, 1, 0, 10077 },
+    { 57117, 5, 1, 0, 10077 },
+    { 57122, 5, 1, 0, 10077 },
+    { 57127, 6, 1, 0, 10077 },
+    { 57133, 3, 1, 0, 10077 },
+    { 57136, 9, 1, 0, 10077 },
+    { 57145, 6, 1, 0, 10077 },
+    { 57151, 9, 1, 0, 10077 },
+    { 57160, 6, 1, 0, 10077 },
+    { 57166, 5, 1, 0, 10077 },
+    { 57171, 5, 1, 0, 10077 },
+    { 57176, 3, 1, 0, 10077 },
+    { 57179, 8, 1, 0, 10077 },
+    { 57187, 7, 1, 0, 10077 },
+    { 57194, 4, 1, 0, 10077 },
+    { 57198, 8, 1, 0, 10077 },
+    { 57206, 4, 1, 0, 10077 },
+    { 57210, 6, 1, 0, 10077 },
+    { 57216, 6, 1, 0, 10077 },
+    { 57222, 6, 1, 0, 10077 },
+    { 57228, 9, 1, 0, 10077 },
+    { 57237, 5, 1, 0, 10077 },
+    { 57242, 6, 1, 0, 10077 },
+    { 57248, 9, 1, 0, 10077 },
+    { 57257, 6, 1, 0, 10077 },
+    { 57263, 6, 1, 0, 10077 },
+    { 57269, 6, 1, 0, 10077 },
+    { 57275, 5, 1, 0, 10077 },
+    { 57280, 6, 1, 0, 10077 },
+    { 57286, 4, 1, 0, 10077 },
+    { 57290, 5, 1, 0, 10077 },
+    { 57295, 4, 1, 0, 10077 },
+    { 57299, 6, 1, 0, 10077 },
+    { 57305, 4, 1, 0, 10077 },
+    { 57309, 3, 1, 0, 10077 },
+    { 57312, 5, 1, 0, 10077 },
+    { 57317, 8, 1, 0, 10077 },
+    { 57325, 7, 1, 0, 10077 },
+    { 57332, 9, 1, 0, 10077 },
+    { 57341, 8, 1, 0, 10077 },
+    { 57349, 17, 1, 0, 10077 },
+    { 57366, 10, 1, 0, 10077 },
+    { 57376, 7, 1, 0, 10077 },
+    { 57383, 6, 1, 0, 10077 },
+    { 57389, 4, 1, 0, 10077 },
+    { 57393, 8, 1, 0, 10077 },
+    { 57401, 8, 1, 0, 10077 },
+    { 57409, 10, 1, 0, 10077 },
+    { 57419, 13, 1, 0, 10077 },
+    { 57432, 6, 1, 0, 10077 },
+    { 57438, 6, 1, 0, 10077 },
+    { 57444, 6, 1, 0, 10077 },
+    { 57450, 7, 1, 0, 10077 },
+    { 57457, 5, 1, 0, 10077 },
+    { 57462, 7, 1, 0, 10077 },
+    { 57469, 5, 1, 0, 10077 },
+    { 57474, 4, 1, 0, 10077 },
+    { 57478, 6, 1, 0, 10077 },
+    { 57484, 7, 1, 0, 10077 },
+    { 57491, 13, 1, 0, 10077 },
+    { 57504, 7, 1, 0, 10077 },
+    { 57511, 8, 1, 0, 10077 },
+    { 57519, 9, 1, 0, 10077 },
+    { 57528, 6, 1, 0, 10077 },
+    { 57534, 5, 1, 0, 10077 },
+    { 57539, 4, 1, 0, 10077 },
+    { 57543, 6, 1, 0, 10077 },
+    { 57549, 6, 1, 0, 10077 },
+    { 57555, 6, 1, 0, 10077 },
+    { 57561, 8, 1, 0, 10077 },
+    { 57569, 3, 1, 0, 10077 },
+    { 57572, 3, 1, 0, 10077 },
+    { 57575, 5, 1, 0, 10077 },
+    { 57580, 6, 1, 0, 10077 },
+    { 57586, 5, 1, 0, 10077 },
+    { 57591, 8, 1, 0, 10077 },
+    { 57599, 10, 1, 0, 10077 },
+    { 57609, 4, 1, 0, 10077 },
+    { 57613, 8, 1, 0, 10077 },
+    { 57621, 8, 1, 0, 10077 },
+    { 57629, 7, 1, 0, 10077 },
+    { 57636, 9, 1, 0, 10077 },
+    { 57645, 8, 1, 0, 10077 },
+    { 57653, 7, 1, 0, 10077 },
+    { 57660, 6, 1, 0, 10077 },
+    { 57666, 10, 1, 0, 10077 },
+    { 57676, 8, 1, 0, 10077 },
+    { 57684, 9, 1, 0, 10077 },
+    { 57693, 8, 1, 0, 10077 },
+    { 57701, 9, 1, 0, 10077 },
+    { 57710, 7, 1, 0, 10077 },
+    { 57717, 5, 1, 0, 10077 },
+    { 57722, 6, 1, 0, 10077 },
+    { 57728, 8, 1, 0, 10077 },
+    { 57736, 8, 1, 0, 10077 },
+    { 57744, 8, 1, 0, 10077 },
+    { 57752, 8, 1, 0, 10077 },
+    { 57760, 5, 1, 0, 10077 },
+    { 57765, 4, 1, 0, 10077 },
+    { 57769, 8, 1, 0, 10077 },
+    { 57777, 4, 1, 0, 10077 },
+    { 57781, 4, 1, 0, 10077 },
+    { 57785, 5, 1, 0, 10077 },
+    { 57790, 7, 1, 0, 10077 },
+    { 57797, 9, 1, 0, 10077 },
+    { 57806, 7, 1, 0, 10077 },
+    { 57813, 5, 1, 0, 10077 },
+    { 57818, 6, 1, 0, 10077 },
+    { 57824, 6, 1, 0, 10077 },
+    { 57830, 4, 1, 0, 10077 },
+    { 57834, 6, 1, 0, 10077 },
+    { 57840, 4, 1, 0, 10077 },
+    { 57844, 6, 1, 0, 10077 },
+    { 57850, 6, 1, 0, 10077 },
+    { 57856, 6, 1, 0, 10077 },
+    { 57862, 5, 1, 0, 10077 },
+    { 57867, 7, 1, 0, 10077 },
+    { 57874, 3, 1, 0, 10077 },
+    { 57877, 9, 1, 0, 10077 },
+    { 57886, 8, 1, 0, 10077 },
+    { 57894, 4, 1, 0, 10077 },
+    { 57898, 13, 1, 0, 10077 },
+    { 57911, 8, 1, 0, 10077 },
+    { 57919, 8, 1, 0, 10077 },
+    { 57927, 6, 1, 0, 10077 },
+    { 57933, 9, 1, 0, 10077 },
+    { 57942, 9, 1, 0, 10077 },
+    { 57951, 5, 1, 0, 10077 },
+    { 57956, 10, 1, 0, 10077 },
+    { 57966, 10, 1, 0, 10077 },
+    { 57976, 12, 1, 0, 10077 },
+    { 57988, 6, 1, 0, 10077 },
+    { 57994, 6, 1, 0, 10077 },
+    { 58000, 6, 1, 0, 10077 },
+    { 58006, 9, 1, 0, 10077 },
+    { 58015, 6, 1, 0, 10077 },
+    { 58021, 6, 1, 0, 10077 },
+    { 58027, 6, 1, 0, 10077 },
+    { 58033, 8, 1, 0, 10077 },
+    { 58041, 6, 1, 0, 10077 },
+    { 58047, 11, 1, 0, 10077 },
+    { 58058, 5, 1, 0, 10077 },
+    { 58063, 5, 1, 0, 10077 },
+    { 58068, 5, 1, 0, 10077 },
+    { 58073, 6, 1, 0, 10077 },
+    { 58079, 3, 1, 0, 10077 },
+    { 58082, 6, 1, 0, 10077 },
+    { 58088, 7, 1, 0, 10077 },
+    { 58095, 5, 1, 0, 10077 },
+    { 58100, 5, 1, 0, 10077 },
+    { 58105, 5, 1, 0, 10077 },
+    { 58110, 6, 1, 0, 10077 },
+    { 58116, 4, 1, 0, 10077 },
+    { 58120, 6, 1, 0, 10077 },
+    { 58126, 9, 1, 0, 10077 },
+    { 58135, 12, 1, 0, 10077 },
+    { 58147, 8, 1, 0, 10077 },
+    { 58155, 4, 1, 0, 10077 },
+    { 58159, 6, 1, 0, 10077 },
+    { 58165, 6, 1, 0, 10077 },
+    { 58171, 8, 1, 0, 10077 },
+    { 58179, 8, 1, 0, 10077 },
+    { 58187, 9, 1, 0, 10077 },
+    { 58196, 7, 1, 0, 10077 },
+    { 58203, 9, 1, 0, 10077 },
+    { 58212, 6, 1, 0, 10077 },
+    { 58218, 4, 1, 0, 10077 },
+    { 58222, 4, 1, 0, 10077 },
+    { 58226, 4, 1, 0, 10077 },
+    { 58230, 8, 1, 0, 10077 },
+    { 58238, 10, 1, 0, 10077 },
+    { 58248, 6, 1, 0, 10077 },
+    { 58254, 7, 1, 0, 10077 },
+    { 58261, 7, 1, 0, 10077 },
+    { 58268, 5, 1, 0, 10077 },
+    { 58273, 4, 1, 0, 10077 },
+    { 58277, 6, 1, 0, 10077 },
+    { 58283, 6, 1, 0, 10077 },
+    { 58289, 3, 1, 0, 10077 },
+    { 58292, 7, 1, 0, 10077 },
+    { 58299, 8, 1, 0, 10077 },
+    { 58307, 10, 1, 0, 10077 },
+    { 58317, 8, 1, 0, 10077 },
+    { 58325, 8, 1, 0, 10077 },
+    { 58333, 5, 1, 0, 10077 },
+    { 58338, 5, 1, 0, 10077 },
+    { 58343, 5, 1, 0, 10077 },
+    { 58348, 6, 1, 0, 10077 },
+    { 58354, 6, 1, 0, 10077 },
+    { 58360, 5, 1, 0, 10077 },
+    { 58365, 9, 1, 0, 10077 },
+    { 58374, 12, 1, 0, 10077 },
+    { 58386, 7, 1, 0, 10077 },
+    { 58393, 8, 1, 0, 10077 },
+    { 58401, 5, 1, 0, 10077 },
+    { 58406, 4, 2, 0, 10077 },
+    { 58410, 4, 1, 0, 10077 },
+    { 58414, 4, 1, 0, 10077 },
+    { 58418, 6, 1, 0, 10077 },
+    { 58424, 14, 1, 0, 10077 },
+    { 58438, 7, 1, 0, 10077 },
+    { 58445, 5, 1, 0, 10077 },
+    { 58450, 12, 1, 0, 10077 },
+    { 58462, 7, 1, 0, 10077 },
+    { 58469, 7, 1, 0, 10077 },
+    { 58476, 9, 1, 0, 10077 },
+    { 58485, 9, 1, 0, 10077 },
+    { 58494, 5, 1, 0, 10077 },
+    { 58499, 8, 1, 0, 10077 },
+    { 58507, 9, 1, 0, 10077 },
+    { 58516, 5, 1, 0, 10077 },
+    { 58521, 8, 1, 0, 10077 },
+    { 58529, 6, 1, 0, 10077 },
+    { 58535, 6, 1, 0, 10077 },
+    { 58541, 4, 1, 0, 10077 },
+    { 58545, 8, 1, 0, 10077 },
+    { 58553, 3, 1, 0, 10077 },
+    { 58556, 4, 1, 0, 10077 },
+    { 58560, 5, 1, 0, 10077 },
+    { 58565, 7, 1, 0, 10077 },
+    { 58572, 5, 1, 0, 10077 },
+    { 58577, 9, 1, 0, 10077 },
+    { 58586, 13, 1, 0, 10077 },
+    { 58599, 6, 1, 0, 10077 },
+    { 58605, 4, 1, 0, 10077 },
+    { 58609, 8, 1, 0, 10077 },
+    { 58617, 10, 1, 0, 10077 },
+    { 58627, 7, 1, 0, 10077 },
+    { 58634, 5, 1, 0, 10077 },
+    { 58639, 3, 1, 0, 10077 },
+    { 58642, 14, 1, 0, 10077 },
+    { 58656, 12, 1, 0, 10077 },
+    { 58668, 7, 1, 0, 10077 },
+    { 58675, 7, 1, 0, 10077 },
+    { 58682, 7, 0, 1, 10077 },
+    { 58689, 6, 1, 0, 10078 },
+    { 58695, 3, 1, 0, 10078 },
+    { 58698, 5, 1, 0, 10078 },
+    { 58703, 5, 1, 0, 10078 },
+    { 58708, 8, 1, 0, 10078 },
+    { 58716, 9, 1, 0, 10078 },
+    { 58725, 6, 1, 0, 10078 },
+    { 58731, 4, 1, 0, 10078 },
+    { 58735, 6, 1, 0, 10078 },
+    { 58741, 11, 1, 0, 10078 },
+    { 58752, 12, 1, 0, 10078 },
+    { 58764, 7, 1, 0, 10078 },
+    { 58771, 5, 1, 0, 10078 },
+    { 58776, 8, 1, 0, 10078 },
+    { 58784, 5, 1, 0, 10078 },
+    { 58789, 7, 1, 0, 10078 },
+    { 58796, 7, 1, 0, 10078 },
+    { 58803, 5, 1, 0, 10078 },
+    { 58808, 3, 1, 0, 10078 },
+    { 58811, 4, 1, 0, 10078 },
+    { 58815, 5, 1, 0, 10078 },
+    { 58820, 5, 1, 0, 10078 },
+    { 58825, 6, 1, 0, 10078 },
+    { 58831, 8, 1, 0, 10078 },
+    { 58839, 7, 1, 0, 10078 },
+    { 58846, 6, 1, 0, 10078 },
+    { 58852, 6, 1, 0, 10078 },
+    { 58858, 6, 1, 0, 10078 },
+    { 58864, 9, 1, 0, 10078 },
+    { 58873, 7, 1, 0, 10078 },
+    { 58880, 6, 1, 0, 10078 },
+    { 58886, 6, 1, 0, 10078 },
+    { 58892, 6, 1, 0, 10078 },
+    { 58898, 5, 1, 0, 10078 },
+    { 58903, 6, 1, 0, 10078 },
+    { 58909, 5, 1, 0, 10078 },
+    { 58914, 8, 1, 0, 10078 },
+    { 58922, 11, 1, 0, 10078 },
+    { 58933, 6, 1, 0, 10078 },
+    { 58939, 4, 1, 0, 10078 },
+    { 58943, 9, 1, 0, 10078 },
+    { 58952, 4, 1, 0, 10078 },
+    { 58956, 8, 1, 0, 10078 },
+    { 58964, 7, 1, 0, 10078 },
+    { 58971, 4, 1, 0, 10078 },
+    { 58975, 8, 1, 0, 10078 },
+    { 58983, 4, 1, 0, 10078 },
+    { 58987, 4, 1, 0, 10078 },
+    { 58991, 5, 1, 0, 10078 },
+    { 58996, 6, 1, 0, 10078 },
+    { 59002, 7, 1, 0, 10078 },
+    { 59009, 3, 1, 0, 10078 },
+    { 59012, 5, 1, 0, 10078 },
+    { 59017, 4, 1, 0, 10078 },
+    { 59021, 6, 1, 0, 10078 },
+    { 59027, 8, 1, 0, 10078 },
+    { 59035, 5, 1, 0, 10078 },
+    { 59040, 9, 1, 0, 10078 },
+    { 59049, 5, 1, 0, 10078 },
+    { 59054, 8, 1, 0, 10078 },
+    { 59062, 7, 1, 0, 10078 },
+    { 59069, 8, 1, 0, 10078 },
+    { 59077, 7, 1, 0, 10078 },
+    { 59084, 9, 1, 0, 10078 },
+    { 59093, 6, 1, 0, 10078 },
+    { 59099, 6, 1, 0, 10078 },
+    { 59105, 4, 1, 0, 10078 },
+    { 59109, 5, 1, 0, 10078 },
+    { 59114, 12, 1, 0, 10078 },
+    { 59126, 7, 1, 0, 10078 },
+    { 59133, 7, 1, 0, 10078 },
+    { 59140, 8, 1, 0, 10078 },
+    { 59148, 6, 1, 0, 10078 },
+    { 59154, 4, 1, 0, 10078 },
+    { 59158, 4, 1, 0, 10078 },
+    { 59162, 9, 1, 0, 10078 },
+    { 59171, 6, 1, 0, 10078 },
+    { 59177, 7, 1, 0, 10078 },
+    { 59184, 4, 1, 0, 10078 },
+    { 59188, 6, 1, 0, 10078 },
+    { 59194, 5, 1, 0, 10078 },
+    { 59199, 7, 1, 0, 10078 },
+    { 59206, 6, 1, 0, 10078 },
+    { 59212, 9, 1, 0, 10078 },
+    { 59221, 7, 1, 0, 10078 },
+    { 59228, 7, 1, 0, 10078 },
+    { 59235, 6, 1, 0, 10078 },
+    { 59241, 5, 1, 0, 10078 },
+    { 59246, 8, 1, 0, 10078 },
+    { 59254, 8, 1, 0, 10078 },
+    { 59262, 6, 1, 0, 10078 },
+    { 59268, 5, 1, 0, 10078 },
+    { 59273, 6, 1, 0, 10078 },
+    { 59279, 3, 1, 0, 10078 },
+    { 59282, 9, 1, 0, 10078 },
+    { 59291, 14, 1, 0, 10078 },
+    { 59305, 8, 1, 0, 10078 },
+    { 59313, 8, 1, 0, 10078 },
+    { 59321, 11, 1, 0, 10078 },
+    { 59332, 6, 1, 0, 10078 },
+    { 59338, 4, 1, 0, 10078 },
+    { 59342, 4, 1, 0, 10078 },
+    { 59346, 10, 1, 0, 10078 },
+    { 59356, 7, 1, 0, 10078 },
+    { 59363, 5, 1, 0, 10078 },
+    { 59368, 9, 1, 0, 10078 },
+    { 59377, 5, 1, 0, 10078 },
+    { 59382, 7, 1, 0, 10078 },
+    { 59389, 4, 1, 0, 10078 },
+    { 59393, 7, 1, 0, 10078 },
+    { 59400, 8, 1, 0, 10078 },
+    { 59408, 6, 1, 0, 10078 },
+    { 59414, 9, 1, 0, 10078 },
+    { 59423, 10, 1, 0, 10078 },
+    { 59433, 6, 1, 0, 10078 },
+    { 59439, 6, 1, 0, 10078 },
+    { 59445, 5, 1, 0, 10078 },
+    { 59450, 5, 1, 0, 10078 },
+    { 59455, 7, 1, 0, 10078 },
+    { 59462, 8, 1, 0, 10078 },
+    { 59470, 8, 1, 0, 10078 },
+    { 59478, 6, 1, 0, 10078 },
+    { 59484, 5, 1, 0, 10078 },
+    { 59489, 14, 1, 0, 10078 },
+    { 59503, 4, 1, 0, 10078 },
+    { 59507, 5, 1, 0, 10078 },
+    { 59512, 9, 1, 0, 10078 },
+    { 59521, 8, 1, 0, 10078 },
+    { 59529, 6, 1, 0, 10078 },
+    { 59535, 12, 1, 0, 10078 },
+    { 59547, 16, 1, 0, 10078 },
+    { 59563, 15, 1, 0, 10078 },
+    { 59578, 8, 1, 0, 10078 },
+    { 59586, 7, 1, 0, 10078 },
+    { 59593, 5, 1, 0, 10078 },
+    { 59598, 5, 1, 0, 10078 },
+    { 59603, 9, 1, 0, 10078 },
+    { 59612, 9, 1, 0, 10078 },
+    { 59621, 6, 1, 0, 10078 },
+    { 59627, 7, 1, 0, 10078 },
+    { 59634, 5, 1, 0, 10078 },
+    { 59639, 9, 1, 0, 10078 },
+    { 59648, 6, 1, 0, 10078 },
+    { 59654, 13, 1, 0, 10078 },
+    { 59667, 9, 1, 0, 10078 },
+    { 59676, 4, 1, 0, 10078 },
+    { 59680, 8, 1, 0, 10078 },
+    { 59688, 9, 1, 0, 10078 },
+    { 59697, 6, 1, 0, 10078 },
+    { 59703, 5, 1, 0, 10078 },
+    { 59708, 6, 1, 0, 10078 },
+    { 59714, 9, 1, 0, 10078 },
+    { 59723, 8, 1, 0, 10078 },
+    { 59731, 5, 1, 0, 10078 },
+    { 59736, 4, 1, 0, 10078 },
+    { 59740, 11, 1, 0, 10078 },
+    { 59751, 5, 1, 0, 10078 },
+    { 59756, 6, 1, 0, 10078 },
+    { 59762, 6, 1, 0, 10078 },
+    { 59768, 6, 1, 0, 10078 },
+    { 59774, 11, 1, 0, 10078 },
+    { 59785, 9, 1, 0, 10078 },
+    { 59794, 5, 1, 0, 10078 },
+    { 59799, 7, 1, 0, 10078 },
+    { 59806, 6, 1, 0, 10078 },
+    { 59812, 6, 1, 0, 10078 },
+    { 59818, 8, 1, 0, 10078 },
+    { 59826, 9, 1, 0, 10078 },
+    { 59835, 12, 1, 0, 10078 },
+    { 59847, 8, 1, 0, 10078 },
+    { 59855, 6, 1, 0, 10078 },
+    { 59861, 3, 1, 0, 10078 },
+    { 59864, 6, 1, 0, 10078 },
+    { 59870, 5, 1, 0, 10078 },
+    { 59875, 8, 1, 0, 10078 },
+    { 59883, 6, 1, 0, 10078 },
+    { 59889, 8, 1, 0, 10078 },
+    { 59897, 5, 1, 0, 10078 },
+    { 59902, 5, 1, 0, 10078 },
+    { 59907, 8, 1, 0, 10078 },
+    { 59915, 7, 1, 0, 10078 },
+    { 59922, 7, 1, 0, 10078 },
+    { 59929, 7, 1, 0, 10078 },
+    { 59936, 8, 1, 0, 10078 },
+    { 59944, 8, 1, 0, 10078 },
+    { 59952, 6, 1, 0, 10078 },
+    { 59958, 7, 1, 0, 10078 },
+    { 59965, 7, 1, 0, 10078 },
+    { 59972, 10, 1, 0, 10078 },
+    { 59982, 3, 1, 0, 10078 },
+    { 59985, 6, 1, 0, 10078 },
+    { 59991, 5, 1, 0, 10078 },
+    { 59996, 4, 1, 0, 10078 },
+    { 60000, 9, 1, 0, 10078 },
+    { 60009, 4, 1, 0, 10078 },
+    { 60013, 4, 1, 0, 10078 },
+    { 60017, 4, 1, 0, 10078 },
+    { 60021, 11, 1, 0, 10078 },
+    { 60032, 7, 1, 0, 10078 },
+    { 60039, 5, 1, 0, 10078 },
+    { 60044, 8, 1, 0, 10078 },
+    { 60052, 6, 1, 0, 10078 },
+    { 60058, 8, 1, 0, 10078 },
+    { 60066, 6, 1, 0, 10078 },
+    { 60072, 5, 1, 0, 10078 },
+    { 60077, 5, 1, 0, 10078 },
+    { 60082, 6, 1, 0, 10078 },
+    { 60088, 8, 1, 0, 10078 },
+    { 60096, 8, 1, 0, 10078 },
+    { 60104, 6, 1, 0, 10078 },
+    { 60110, 15, 1, 0, 10078 },
+    { 60125, 16, 1, 0, 10078 },
+    { 60141, 5, 1, 0, 10078 },
+    { 60146, 3, 1, 0, 10078 },
+    { 60149, 5, 1, 0, 10078 },
+    { 60154, 8, 1, 0, 10078 },
+    { 60162, 9, 1, 0, 10078 },
+    { 60171, 8, 1, 0, 10078 },
+    { 60179, 8, 1, 0, 10078 },
+    { 60187, 8, 1, 0, 10078 },
+    { 60195, 7, 1, 0, 10078 },
+    { 60202, 9, 1, 0, 10078 },
+    { 60211, 8, 1, 0, 10078 },
+    { 60219, 4, 1, 0, 10078 },
+    { 60223, 8, 1, 0, 10078 },
+    { 60231, 9, 1, 0, 10078 },
+    { 60240, 7, 1, 0, 10078 },
+    { 60247, 4, 1, 0, 10078 },
+    { 60251, 8, 1, 0, 10078 },
+    { 60259, 10, 1, 0, 10078 },
+    { 60269, 6, 1, 0, 10078 },
+    { 60275, 6, 1, 0, 10078 },
+    { 60281, 9, 1, 0, 10078 },
+    { 60290, 7, 1, 0, 10078 },
+    { 60297, 8, 1, 0, 10078 },
+    { 60305, 8, 1, 0, 10078 },
+    { 60313, 8, 1, 0, 10078 },
+    { 60321, 5, 1, 0, 10078 },
+    { 60326, 5, 1, 0, 10078 },
+    { 60331, 5, 1, 0, 10078 },
+    { 60336, 5, 1, 0, 10078 },
+    { 60341, 7, 1, 0, 10078 },
+    { 60348, 5, 1, 0, 10078 },
+    { 60353, 5, 1, 0, 10078 },
+    { 60358, 6, 1, 0, 10078 },
+    { 60364, 7, 1, 0, 10078 },
+    { 60371, 7, 1, 0, 10078 },
+    { 60378, 6, 1, 0, 10078 },
+    { 60384, 5, 1, 0, 10078 },
+    { 60389, 6, 1, 0, 10078 },
+    { 60395, 5, 1, 0, 10078 },
+    { 60400, 8, 1, 0, 10078 },
+    { 60408, 4, 1, 0, 10078 },
+    { 60412, 6, 1, 0, 10078 },
+    { 60418, 4, 1, 0, 10078 },
+    { 60422, 8, 1, 0, 10078 },
+    { 60430, 10, 1, 0, 10078 },
+    { 60440, 12, 1, 0, 10078 },
+    { 60452, 5, 1, 0, 10078 },
+    { 60457, 6, 1, 0, 10078 },
+    { 60463, 6, 1, 0, 10078 },
+    { 60469, 6, 1, 0, 10078 },
+    { 60475, 4, 1, 0, 10078 },
+    { 60479, 5, 1, 0, 10078 },
+    { 60484, 7, 1, 0, 10078 },
+    { 60491, 9, 1, 0, 10078 },
+    { 60500, 7, 1, 0, 10078 },
+    { 60507, 4, 2, 0, 10078 },
+    { 60511, 4, 2, 0, 10078 },
+    { 60515, 5, 1, 0, 10078 },
+    { 60520, 4, 1, 0, 10078 },
+    { 60524, 10, 1, 0, 10078 },
+    { 60534, 6, 1, 0, 10078 },
+    { 60540, 4, 1, 0, 10078 },
+    { 60544, 5, 1, 0, 10078 },
+    { 60549, 5, 1, 0, 10078 },
+    { 60554, 4, 1, 0, 10078 },
+    { 60558, 7, 1, 0, 10078 },
+    { 60565, 7, 1, 0, 10078 },
+    { 60572, 8, 1, 0, 10078 },
+    { 60580, 8, 1, 0, 10078 },
+    { 60588, 9, 1, 0, 10078 },
+    { 60597, 8, 1, 0, 10078 },
+    { 60605, 11, 1, 0, 10078 },
+    { 60616, 4, 1, 0, 10078 },
+    { 60620, 5, 1, 0, 10078 },
+    { 60625, 5, 1, 0, 10078 },
+    { 60630, 9, 1, 0, 10078 },
+    { 60639, 9, 1, 0, 10078 },
+    { 60648, 8, 1, 0, 10078 },
+    { 60656, 8, 1, 0, 10078 },
+    { 60664, 4, 1, 0, 10078 },
+    { 60668, 5, 1, 0, 10078 },
+    { 60673, 3, 1, 0, 10078 },
+    { 60676, 5, 1, 0, 10078 },
+    { 60681, 6, 1, 0, 10078 },
+    { 60687, 12, 1, 0, 10078 },
+    { 60699, 6, 1, 0, 10078 },
+    { 60705, 6, 1, 0, 10078 },
+    { 60711, 5, 1, 0, 10078 },
+    { 60716, 8, 1, 0, 10078 },
+    { 60724, 6, 1, 0, 10078 },
+    { 60730, 6, 1, 0, 10078 },
+    { 60736, 6, 1, 0, 10078 },
+    { 60742, 12, 1, 0, 10078 },
+    { 60754, 4, 1, 0, 10078 },
+    { 60758, 10, 1, 0, 10078 },
+    { 60768, 8, 1, 0, 10078 },
+    { 60776, 7, 1, 0, 10078 },
+    { 60783, 6, 1, 0, 10078 },
+    { 60789, 7, 1, 0, 10078 },
+    { 60796, 5, 1, 0, 10078 },
+    { 60801, 6, 1, 0, 10078 },
+    { 60807, 6, 1, 0, 10078 },
+    { 60813, 7, 1, 0, 10078 },
+    { 60820, 4, 1, 0, 10078 },
+    { 60824, 5, 1, 0, 10078 },
+    { 60829, 4, 1, 0, 10078 },
+    { 60833, 7, 1, 0, 10078 },
+    { 60840, 8, 1, 0, 10078 },
+    { 60848, 10, 1, 0, 10078 },
+    { 60858, 7, 1, 0, 10078 },
+    { 60865, 7, 1, 0, 10078 },
+    { 60872, 7, 1, 0, 10078 },
+    { 60879, 9, 1, 0, 10078 },
+    { 60888, 10, 1, 0, 10078 },
+    { 60898, 3, 1, 0, 10078 },
+    { 60901, 5, 1, 0, 10078 },
+    { 60906, 3, 1, 0, 10078 },
+    { 60909, 9, 1, 0, 10078 },
+    { 60918, 8, 1, 0, 10078 },
+    { 60926, 7, 1, 0, 10078 },
+    { 60933, 9, 1, 0, 10078 },
+    { 60942, 6, 1, 0, 10078 },
+    { 60948, 8, 1, 0, 10078 },
+    { 60956, 5, 1, 0, 10078 },
+    { 60961, 10, 1, 0, 10078 },
+    { 60971, 9, 1, 0, 10078 },
+    { 60980, 9, 1, 0, 10078 },
+    { 60989, 7, 1, 0, 10078 },
+    { 60996, 9, 1, 0, 10078 },
+    { 61005, 8, 1, 0, 10078 },
+    { 61013, 6, 1, 0, 10078 },
+    { 61019, 8, 1, 0, 10078 },
+    { 61027, 7, 1, 0, 10078 },
+    { 61034, 7, 1, 0, 10078 },
+    { 61041, 7, 1, 0, 10078 },
+    { 61048, 8, 1, 0, 10078 },
+    { 61056, 6, 1, 0, 10078 },
+    { 61062, 5, 1, 0, 10078 },
+    { 61067, 7, 1, 0, 10078 },
+    { 61074, 8, 1, 0, 10078 },
+    { 61082, 4, 1, 0, 10078 },
+    { 61086, 4, 1, 0, 10078 },
+    { 61090, 7, 1, 0, 10078 },
+    { 61097, 7, 1, 0, 10078 },
+    { 61104, 10, 1, 0, 10078 },
+    { 61114, 6, 1, 0, 10078 },
+    { 61120, 10, 1, 0, 10078 },
+    { 61130, 7, 1, 0, 10078 },
+    { 61137, 7, 1, 0, 10078 },
+    { 61144, 4, 1, 0, 10078 },
+    { 61148, 4, 1, 0, 10078 },
+    { 61152, 6, 1, 0, 10078 },
+    { 61158, 4, 1, 0, 10078 },
+    { 61162, 12, 1, 0, 10078 },
+    { 61174, 5, 1, 0, 10078 },
+    { 61179, 9, 1, 0, 10078 },
+    { 61188, 4, 1, 0, 10078 },
+    { 61192, 5, 1, 0, 10078 },
+    { 61197, 8, 1, 0, 10078 },
+    { 61205, 5, 1, 0, 10078 },
+    { 61210, 6, 1, 0, 10078 },
+    { 61216, 4, 1, 0, 10078 },
+    { 61220, 10, 1, 0, 10078 },
+    { 61230, 6, 1, 0, 10078 },
+    { 61236, 10, 1, 0, 10078 },
+    { 61246, 7, 1, 0, 10078 },
+    { 61253, 5, 1, 0, 10078 },
+    { 61258, 5, 1, 0, 10078 },
+    { 61263, 10, 1, 0, 10078 },
+    { 61273, 5, 1, 0, 10078 },
+    { 61278, 6, 1, 0, 10078 },
+    { 61284, 4, 1, 0, 10078 },
+    { 61288, 6, 1, 0, 10078 },
+    { 61294, 5, 1, 0, 10078 },
+    { 61299, 6, 1, 0, 10078 },
+    { 61305, 12, 1, 0, 10078 },
+    { 61317, 10, 1, 0, 10078 },
+    { 61327, 4, 1, 0, 10078 },
+    { 61331, 6, 1, 0, 10078 },
+    { 61337, 7, 1, 0, 10078 },
+    { 61344, 4, 1, 0, 10078 },
+    { 61348, 8, 1, 0, 10078 },
+    { 61356, 6, 1, 0, 10078 },
+    { 61362, 9, 1, 0, 10078 },
+    { 61371, 9, 1, 0, 10078 },
+    { 61380, 9, 1, 0, 10078 },
+    { 61389, 6, 1, 0, 10078 },
+    { 61395, 6, 1, 0, 10078 },
+    { 61401, 7, 1, 0, 10078 },
+    { 61408, 8, 1, 0, 10078 },
+    { 61416, 9, 1, 0, 10078 },
+    { 61425, 7, 1, 0, 10078 },
+    { 61432, 6, 1, 0, 10078 },
+    { 61438, 7, 1, 0, 10078 },
+    { 61445, 5, 1, 0, 10078 },
+    { 61450, 4, 1, 0, 10078 },
+    { 61454, 7, 1, 0, 10078 },
+    { 61461, 5, 1, 0, 10078 },
+    { 61466, 5, 1, 0, 10078 },
+    { 61471, 7, 1, 0, 10078 },
+    { 61478, 8, 1, 0, 10078 },
+    { 61486, 6, 1, 0, 10078 },
+    { 61492, 13, 1, 0, 10078 },
+    { 61505, 15, 1, 0, 10078 },
+    { 61520, 13, 1, 0, 10078 },
+    { 61533, 4, 1, 0, 10078 },
+    { 61537, 6, 1, 0, 10078 },
+    { 61543, 8, 1, 0, 10078 },
+    { 61551, 5, 1, 0, 10078 },
+    { 61556, 8, 1, 0, 10078 },
+    { 61564, 10, 1, 0, 10078 },
+    { 61574, 4, 1, 0, 10078 },
+    { 61578, 6, 1, 0, 10078 },
+    { 61584, 7, 1, 0, 10078 },
+    { 61591, 7, 1, 0, 10078 },
+    { 61598, 9, 1, 0, 10078 },
+    { 61607, 5, 1, 0, 10078 },
+    { 61612, 4, 1, 0, 10078 },
+    { 61616, 10, 1, 0, 10078 },
+    { 61626, 9, 1, 0, 10078 },
+    { 61635, 7, 1, 0, 10078 },
+    { 61642, 6, 1, 0, 10078 },
+    { 61648, 6, 1, 0, 10078 },
+    { 61654, 6, 1, 0, 10078 },
+    { 61660, 6, 1, 0, 10078 },
+    { 61666, 15, 1, 0, 10078 },
+    { 61681, 9, 1, 0, 10078 },
+    { 61690, 6, 1, 0, 10078 },
+    { 61696, 6, 1, 0, 10078 },
+    { 61702, 9, 1, 0, 10078 },
+    { 61711, 7, 1, 0, 10078 },
+    { 61718, 3, 1, 0, 10078 },
+    { 61721, 6, 1, 0, 10078 },
+    { 61727, 3, 1, 0, 10078 },
+    { 61730, 8, 1, 0, 10078 },
+    { 61738, 7, 1, 0, 10078 },
+    { 61745, 9, 1, 0, 10078 },
+    { 61754, 8, 1, 0, 10078 },
+    { 61762, 8, 1, 0, 10078 },
+    { 61770, 6, 1, 0, 10078 },
+    { 61776, 9, 1, 0, 10078 },
+    { 61785, 5, 1, 0, 10078 },
+    { 61790, 4, 1, 0, 10078 },
+    { 61794, 7, 1, 0, 10078 },
+    { 61801, 5, 1, 0, 10078 },
+    { 61806, 4, 1, 0, 10078 },
+    { 61810, 8, 1, 0, 10078 },
+    { 61818, 4, 1, 0, 10078 },
+    { 61822, 7, 1, 0, 10078 },
+    { 61829, 6, 1, 0, 10078 },
+    { 61835, 5, 1, 0, 10078 },
+    { 61840, 8, 1, 0, 10078 },
+    { 61848, 11, 1, 0, 10078 },
+    { 61859, 7, 1, 0, 10078 },
+    { 61866, 6, 1, 0, 10078 },
+    { 61872, 4, 1, 0, 10078 },
+    { 61876, 6, 1, 0, 10078 },
+    { 61882, 5, 1, 0, 10078 },
+    { 61887, 5, 1, 0, 10078 },
+    { 61892, 9, 1, 0, 10078 },
+    { 61901, 9, 1, 0, 10078 },
+    { 61910, 4, 1, 0, 10078 },
+    { 61914, 5, 1, 0, 10078 },
+    { 61919, 5, 1, 0, 10078 },
+    { 61924, 6, 1, 0, 10078 },
+    { 61930, 8, 1, 0, 10078 },
+    { 61938, 6, 1, 0, 10078 },
+    { 61944, 11, 1, 0, 10078 },
+    { 61955, 10, 1, 0, 10078 },
+    { 61965, 5, 1, 0, 10078 },
+    { 61970, 6, 1, 0, 10078 },
+    { 61976, 5, 1, 0, 10078 },
+    { 61981, 5, 1, 0, 10078 },
+    { 61986, 7, 1, 0, 10078 },
+    { 61993, 8, 1, 0, 10078 },
+    { 62001, 4, 1, 0, 10078 },
+    { 62005, 6, 1, 0, 10078 },
+    { 62011, 6, 1, 0, 10078 },
+    { 62017, 7, 1, 0, 10078 },
+    { 62024, 4, 1, 0, 10078 },
+    { 62028, 6, 1, 0, 10078 },
+    { 62034, 5, 1, 0, 10078 },
+    { 62039, 9, 1, 0, 10078 },
+    { 62048, 4, 1, 0, 10078 },
+    { 62052, 9, 1, 0, 10078 },
+    { 62061, 6, 1, 0, 10078 },
+    { 62067, 8, 1, 0, 10078 },
+    { 62075, 5, 1, 0, 10078 },
+    { 62080, 5, 1, 0, 10078 },
+    { 62085, 6, 1, 0, 10078 },
+    { 62091, 9, 1, 0, 10078 },
+    { 62100, 9, 1, 0, 10078 },
+    { 62109, 6, 1, 0, 10078 },
+    { 62115, 8, 1, 0, 10078 },
+    { 62123, 8, 1, 0, 10078 },
+    { 62131, 4, 1, 0, 10078 },
+    { 62135, 4, 1, 0, 10078 },
+    { 62139, 8, 1, 0, 10078 },
+    { 62147, 8, 1, 0, 10078 },
+    { 62155, 9, 1, 0, 10078 },
+    { 62164, 6, 1, 0, 10078 },
+    { 62170, 6, 1, 0, 10078 },
+    { 62176, 13, 1, 0, 10078 },
+    { 62189, 6, 1, 0, 10078 },
+    { 62195, 9, 1, 0, 10078 },
+    { 62204, 5, 1, 0, 10078 },
+    { 62209, 6, 1, 0, 10078 },
+    { 62215, 8, 1, 0, 10078 },
+    { 62223, 5, 1, 0, 10078 },
+    { 62228, 4, 1, 0, 10078 },
+    { 62232, 5, 1, 0, 10078 },
+    { 62237, 8, 1, 0, 10078 },
+    { 62245, 9, 1, 0, 10078 },
+    { 62254, 4, 1, 0, 10078 },
+    { 62258, 6, 1, 0, 10078 },
+    { 62264, 10, 1, 0, 10078 },
+    { 62274, 8, 1, 0, 10078 },
+    { 62282, 9, 1, 0, 10078 },
+    { 62291, 10, 1, 0, 10078 },
+    { 62301, 6, 1, 0, 10078 },
+    { 62307, 8, 1, 0, 10078 },
+    { 62315, 5, 1, 0, 10078 },
+    { 62320, 8, 1, 0, 10078 },
+    { 62328, 5, 1, 0, 10078 },
+    { 62333, 9, 1, 0, 10078 },
+    { 62342, 9, 1, 0, 10078 },
+    { 62351, 2, 1, 0, 10078 },
+    { 62353, 5, 1, 0, 10078 },
+    { 62358, 6, 1, 0, 10078 },
+    { 62364, 7, 1, 0, 10078 },
+    { 62371, 5, 1, 0, 10078 },
+    { 62376, 6, 1, 0, 10078 },
+    { 62382, 8, 1, 0, 10078 },
+    { 62390, 6, 1, 0, 10078 },
+    { 62396, 9, 1, 0, 10078 },
+    { 62405, 6, 1, 0, 10078 },
+    { 62411, 8, 1, 0, 10078 },
+    { 62419, 5, 1, 0, 10078 },
+    { 62424, 6, 1, 0, 10078 },
+    { 62430, 8, 1, 0, 10078 },
+    { 62438, 8, 1, 0, 10078 },
+    { 62446, 8, 1, 0, 10078 },
+    { 62454, 8, 1, 0, 10078 },
+    { 62462, 4, 1, 0, 10078 },
+    { 62466, 3, 1, 0, 10078 },
+    { 62469, 4, 1, 0, 10078 },
+    { 62473, 6, 1, 0, 10078 },
+    { 62479, 4, 1, 0, 10078 },
+    { 62483, 7, 1, 0, 10078 },
+    { 62490, 9, 1, 0, 10078 },
+    { 62499, 5, 1, 0, 10078 },
+    { 62504, 6, 1, 0, 10078 },
+    { 62510, 6, 1, 0, 10078 },
+    { 62516, 11, 1, 0, 10078 },
+    { 62527, 6, 1, 0, 10078 },
+    { 62533, 6, 1, 0, 10078 },
+    { 62539, 8, 1, 0, 10078 },
+    { 62547, 6, 1, 0, 10078 },
+    { 62553, 3, 1, 0, 10078 },
+    { 62556, 3, 1, 0, 10078 },
+    { 62559, 4, 1, 0, 10078 },
+    { 62563, 5, 1, 0, 10078 },
+    { 62568, 7, 1, 0, 10078 },
+    { 62575, 8, 1, 0, 10078 },
+    { 62583, 15, 1, 0, 10078 },
+    { 62598, 11, 1, 0, 10078 },
+    { 62609, 8, 1, 0, 10078 },
+    { 62617, 6, 1, 0, 10078 },
+    { 62623, 14, 1, 0, 10078 },
+    { 62637, 3, 1, 0, 10078 },
+    { 62640, 4, 1, 0, 10078 },
+    { 62644, 5, 1, 0, 10078 },
+    { 62649, 6, 1, 0, 10078 },
+    { 62655, 11, 1, 0, 10078 },
+    { 62666, 6, 1, 0, 10078 },
+    { 62672, 9, 1, 0, 10078 },
+    { 62681, 5, 1, 0, 10078 },
+    { 62686, 8, 1, 0, 10078 },
+    { 62694, 8, 1, 0, 10078 },
+    { 62702, 12, 1, 0, 10078 },
+    { 62714, 6, 1, 0, 10078 },
+    { 62720, 6, 1, 0, 10078 },
+    { 62726, 5, 1, 0, 10078 },
+    { 62731, 8, 1, 0, 10078 },
+    { 62739, 5, 1, 0, 10078 },
+    { 62744, 8, 1, 0, 10078 },
+    { 62752, 10, 1, 0, 10078 },
+    { 62762, 9, 1, 0, 10078 },
+    { 62771, 4, 2, 0, 10078 },
+    { 62775, 8, 1, 0, 10078 },
+    { 62783, 5, 1, 0, 10078 },
+    { 62788, 3, 1, 0, 10078 },
+    { 62791, 5, 1, 0, 10078 },
+    { 62796, 9, 1, 0, 10078 },
+    { 62805, 4, 1, 0, 10078 },
+    { 62809, 8, 1, 0, 10078 },
+    { 62817, 6, 1, 0, 10078 },
+    { 62823, 6, 1, 0, 10078 },
+    { 62829, 4, 0, 1, 10078 },
+    { 62833, 1, 1, 0, 10079 },
+    { 62834, 1, 1, 0, 10079 },
+    { 62835, 9, 1, 0, 10079 },
+    { 62844, 8, 1, 0, 10079 },
+    { 62852, 7, 1, 0, 10079 },
+    { 62859, 10, 1, 0, 10079 },
+    { 62869, 7, 1, 0, 10079 },
+    { 62876, 1, 1, 0, 10079 },
+    { 62877, 1, 1, 0, 10079 },
+    { 62878, 7, 1, 0, 10079 },
+    { 62885, 8, 1, 0, 10079 },
+    { 62893, 8, 1, 0, 10079 },
+    { 62901, 8, 1, 0, 10079 },
+    { 62909, 8, 1, 0, 10079 },
+    { 62917, 7, 1, 0, 10079 },
+    { 62924, 3, 1, 0, 10079 },
+    { 62927, 4, 0, 2, 10079 },
+    { 62931, 3, 0, 3, 10081 },
+    { 62934, 3, 1, 0, 10084 },
+    { 62937, 4, 0, 6, 10084 },
+    { 62941, 7, 4, 0, 10090 },
+    { 62948, 7, 4, 0, 10090 },
+    { 62955, 8, 1, 0, 10090 },
+    { 62963, 12, 1, 0, 10090 },
+    { 62975, 1, 1, 0, 10090 },
+    { 62976, 3, 1, 0, 10090 },
+    { 62979, 4, 1, 0, 10090 },
+    { 62983, 4, 1, 0, 10090 },
+    { 62987, 5, 1, 0, 10090 },
+    { 62992, 8, 1, 0, 10090 },
+    { 63000, 8, 0, 3, 10090 },
+    { 63008, 7, 1, 0, 10093 },
+    { 63015, 7, 1, 0, 10093 },
+    { 63022, 8, 1, 0, 10093 },
+    { 63030, 2, 1, 0, 10093 },
+    { 63032, 2, 1, 0, 10093 },
+    { 63034, 3, 1, 0, 10093 },
+    { 63037, 2, 1, 0, 10093 },
+    { 63039, 3, 1, 0, 10093 },
+    { 63042, 2, 1, 0, 10093 },
+    { 63044, 2, 1, 0, 10093 },
+    { 63046, 5, 1, 0, 10093 },
+    { 63051, 6, 1, 0, 10093 },
+    { 63057, 12, 1, 0, 10093 },
+    { 63069, 2, 1, 0, 10093 },
+    { 63071, 2, 1, 0, 10093 },
+    { 63073, 2, 1, 0, 10093 },
+    { 63075, 2, 1, 0, 10093 },
+    { 63077, 5, 1, 0, 10093 },
+    { 63082, 5, 1, 0, 10093 },
+    { 63087, 2, 1, 0, 10093 },
+    { 63089, 6, 1, 0, 10093 },
+    { 63095, 5, 1, 0, 10093 },
+    { 63100, 2, 1, 0, 10093 },
+    { 63102, 2, 1, 0, 10093 },
+    { 63104, 3, 1, 0, 10093 },
+    { 63107, 5, 1, 0, 10093 },
+    { 63112, 6, 1, 0, 10093 },
+    { 63118, 9, 1, 0, 10093 },
+    { 63127, 12, 1, 0, 10093 },
+    { 63139, 2, 1, 0, 10093 },
+    { 63141, 2, 1, 0, 10093 },
+    { 63143, 2, 1, 0, 10093 },
+    { 63145, 2, 1, 0, 10093 },
+    { 63147, 5, 1, 0, 10093 },
+    { 63152, 2, 1, 0, 10093 },
+    { 63154, 2, 1, 0, 10093 },
+    { 63156, 2, 1, 0, 10093 },
+    { 63158, 2, 1, 0, 10093 },
+    { 63160, 2, 1, 0, 10093 },
+    { 63162, 3, 1, 0, 10093 },
+    { 63165, 9, 1, 0, 10093 },
+    { 63174, 2, 1, 0, 10093 },
+    { 63176, 2, 1, 0, 10093 },
+    { 63178, 2, 1, 0, 10093 },
+    { 63180, 5, 1, 0, 10093 },
+    { 63185, 2, 1, 0, 10093 },
+    { 63187, 5, 1, 0, 10093 },
+    { 63192, 12, 1, 0, 10093 },
+    { 63204, 12, 1, 0, 10093 },
+    { 63216, 6, 1, 0, 10093 },
+    { 63222, 8, 1, 0, 10093 },
+    { 63230, 7, 1, 0, 10093 },
+    { 63237, 4, 1, 0, 10093 },
+    { 63241, 1, 1, 0, 10093 },
+    { 63242, 3, 1, 0, 10093 },
+    { 63245, 6, 0, 1, 10093 },
+    { 63251, 2, 1, 0, 10094 },
+    { 63253, 4, 1, 0, 10094 },
+    { 63257, 2, 1, 0, 10094 },
+    { 63259, 4, 1, 0, 10094 },
+    { 63263, 2, 1, 0, 10094 },
+    { 63265, 2, 1, 0, 10094 },
+    { 63267, 2, 1, 0, 10094 },
+    { 63269, 2, 1, 0, 10094 },
+    { 63271, 2, 1, 0, 10094 },
+    { 63273, 2, 1, 0, 10094 },
+    { 63275, 2, 1, 0, 10094 },
+    { 63277, 2, 1, 0, 10094 },
+    { 63279, 2, 1, 0, 10094 },
+    { 63281, 2, 1, 0, 10094 },
+    { 63283, 2, 1, 0, 10094 },
+    { 63285, 2, 1, 0, 10094 },
+    { 63287, 3, 1, 0, 10094 },
+    { 63290, 2, 1, 0, 10094 },
+    { 63292, 2, 1, 0, 10094 },
+    { 63294, 2, 1, 0, 10094 },
+    { 63296, 2, 1, 0, 10094 },
+    { 63298, 2, 1, 0, 10094 },
+    { 63300, 2, 1, 0, 10094 },
+    { 63302, 2, 1, 0, 10094 },
+    { 63304, 2, 1, 0, 10094 },
+    { 63306, 2, 1, 0, 10094 },
+    { 63308, 2, 1, 0, 10094 },
+    { 63310, 3, 1, 0, 10094 },
+    { 63313, 2, 1, 0, 10094 },
+    { 63315, 2, 1, 0, 10094 },
+    { 63317, 2, 1, 0, 10094 },
+    { 63319, 2, 1, 0, 10094 },
+    { 63321, 2, 1, 0, 10094 },
+    { 63323, 2, 1, 0, 10094 },
+    { 63325, 2, 1, 0, 10094 },
+    { 63327, 2, 1, 0, 10094 },
+    { 63329, 2, 1, 0, 10094 },
+    { 63331, 2, 1, 0, 10094 },
+    { 63333, 2, 1, 0, 10094 },
+    { 63335, 2, 1, 0, 10094 },
+    { 63337, 3, 1, 0, 10094 },
+    { 63340, 2, 1, 0, 10094 },
+    { 63342, 2, 1, 0, 10094 },
+    { 63344, 2, 1, 0, 10094 },
+    { 63346, 2, 1, 0, 10094 },
+    { 63348, 5, 1, 0, 10094 },
+    { 63353, 2, 1, 0, 10094 },
+    { 63355, 2, 1, 0, 10094 },
+    { 63357, 3, 1, 0, 10094 },
+    { 63360, 2, 1, 0, 10094 },
+    { 63362, 2, 1, 0, 10094 },
+    { 63364, 2, 1, 0, 10094 },
+    { 63366, 2, 1, 0, 10094 },
+    { 63368, 2, 1, 0, 10094 },
+    { 63370, 2, 1, 0, 10094 },
+    { 63372, 2, 1, 0, 10094 },
+    { 63374, 2, 1, 0, 10094 },
+    { 63376, 5, 1, 0, 10094 },
+    { 63381, 2, 0, 1, 10094 },
+    { 63383, 3, 0, 1, 10095 },
+    { 63386, 2, 1, 0, 10096 },
+    { 63388, 2, 1, 0, 10096 },
+    { 63390, 4, 1, 0, 10096 },
+    { 63394, 2, 1, 0, 10096 },
+    { 63396, 2, 1, 0, 10096 },
+    { 63398, 5, 1, 0, 10096 },
+    { 63403, 8, 1, 0, 10096 },
+    { 63411, 5, 1, 0, 10096 },
+    { 63416, 3, 1, 0, 10096 },
+    { 63419, 5, 1, 0, 10096 },
+    { 63424, 3, 1, 0, 10096 },
+    { 63427, 2, 1, 0, 10096 },
+    { 63429, 4, 1, 0, 10096 },
+    { 63433, 3, 1, 0, 10096 },
+    { 63436, 2, 1, 0, 10096 },
+    { 63438, 4, 1, 0, 10096 },
+    { 63442, 3, 1, 0, 10096 },
+    { 63445, 2, 1, 0, 10096 },
+    { 63447, 3, 1, 0, 10096 },
+    { 63450, 4, 1, 0, 10096 },
+    { 63454, 3, 1, 0, 10096 },
+    { 63457, 4, 1, 0, 10096 },
+    { 63461, 2, 1, 0, 10096 },
+    { 63463, 3, 1, 0, 10096 },
+    { 63466, 3, 1, 0, 10096 },
+    { 63469, 2, 1, 0, 10096 },
+    { 63471, 2, 1, 0, 10096 },
+    { 63473, 9, 1, 0, 10096 },
+    { 63482, 2, 1, 0, 10096 },
+    { 63484, 4, 1, 0, 10096 },
+    { 63488, 2, 1, 0, 10096 },
+    { 63490, 4, 1, 0, 10096 },
+    { 63494, 4, 1, 0, 10096 },
+    { 63498, 4, 1, 0, 10096 },
+    { 63502, 2, 1, 0, 10096 },
+    { 63504, 2, 1, 0, 10096 },
+    { 63506, 3, 1, 0, 10096 },
+    { 63509, 3, 1, 0, 10096 },
+    { 63512, 4, 1, 0, 10096 },
+    { 63516, 4, 1, 0, 10096 },
+    { 63520, 4, 1, 0, 10096 },
+    { 63524, 4, 1, 0, 10096 },
+    { 63528, 3, 1, 0, 10096 },
+    { 63531, 3, 1, 0, 10096 },
+    { 63534, 4, 1, 0, 10096 },
+    { 63538, 4, 1, 0, 10096 },
+    { 63542, 6, 1, 0, 10096 },
+    { 63548, 2, 1, 0, 10096 },
+    { 63550, 3, 1, 0, 10096 },
+    { 63553, 4, 1, 0, 10096 },
+    { 63557, 2, 1, 0, 10096 },
+    { 63559, 3, 1, 0, 10096 },
+    { 63562, 7, 4, 0, 10096 },
+    { 63569, 7, 4, 0, 10096 },
+    { 63576, 8, 4, 0, 10096 },
+    { 63584, 3, 4, 0, 10096 },
+    { 63587, 8, 1, 0, 10096 },
+    { 63595, 7, 1, 0, 10096 },
+    { 63602, 2, 1, 0, 10096 },
+    { 63604, 2, 1, 0, 10096 },
+    { 63606, 3, 1, 0, 10096 },
+    { 63609, 2, 1, 0, 10096 },
+    { 63611, 2, 1, 0, 10096 },
+    { 63613, 6, 1, 0, 10096 },
+    { 63619, 8, 1, 0, 10096 },
+    { 63627, 3, 1, 0, 10096 },
+    { 63630, 8, 1, 0, 10096 },
+    { 63638, 5, 1, 0, 10096 },
+    { 63643, 5, 1, 0, 10096 },
+    { 63648, 11, 1, 0, 10096 },
+    { 63659, 8, 1, 0, 10096 },
+    { 63667, 8, 0, 2, 10096 },
+    { 63675, 10, 0, 1, 10098 },
+    { 63685, 12, 1, 0, 10099 },
+    { 63697, 7, 1, 0, 10099 },
+    { 63704, 5, 1, 0, 10099 },
+    { 63709, 9, 0, 1, 10099 },
+    { 63718, 13, 1, 0, 10100 },
+    { 63731, 3, 1, 0, 10100 },
+    { 63734, 8, 1, 0, 10100 },
+    { 63742, 10, 1, 0, 10100 },
+    { 63752, 7, 1, 0, 10100 },
+    { 63759, 15, 1, 0, 10100 },
+    { 63774, 4, 1, 0, 10100 },
+    { 63778, 3, 1, 0, 10100 },
+    { 63781, 4, 1, 0, 10100 },
+    { 63785, 11, 1, 0, 10100 },
+    { 63796, 13, 1, 0, 10100 },
+    { 63809, 2, 1, 0, 10100 },
+    { 63811, 3, 1, 0, 10100 },
+    { 63814, 3, 1, 0, 10100 },
+    { 63817, 2, 1, 0, 10100 },
+    { 63819, 3, 1, 0, 10100 },
+    { 63822, 3, 1, 0, 10100 },
+    { 63825, 2, 1, 0, 10100 },
+    { 63827, 3, 1, 0, 10100 },
+    { 63830, 3, 1, 0, 10100 },
+    { 63833, 2, 1, 0, 10100 },
+    { 63835, 3, 1, 0, 10100 },
+    { 63838, 3, 1, 0, 10100 },
+    { 63841, 2, 1, 0, 10100 },
+    { 63843, 3, 1, 0, 10100 },
+    { 63846, 3, 1, 0, 10100 },
+    { 63849, 2, 1, 0, 10100 },
+    { 63851, 3, 1, 0, 10100 },
+    { 63854, 3, 1, 0, 10100 },
+    { 63857, 2, 1, 0, 10100 },
+    { 63859, 3, 1, 0, 10100 },
+    { 63862, 3, 1, 0, 10100 },
+    { 63865, 2, 1, 0, 10100 },
+    { 63867, 3, 1, 0, 10100 },
+    { 63870, 3, 1, 0, 10100 },
+    { 63873, 2, 1, 0, 10100 },
+    { 63875, 3, 1, 0, 10100 },
+    { 63878, 3, 1, 0, 10100 },
+    { 63881, 2, 1, 0, 10100 },
+    { 63883, 3, 1, 0, 10100 },
+    { 63886, 3, 1, 0, 10100 },
+    { 63889, 3, 1, 0, 10100 },
+    { 63892, 2, 1, 0, 10100 },
+    { 63894, 3, 1, 0, 10100 },
+    { 63897, 3, 1, 0, 10100 },
+    { 63900, 2, 1, 0, 10100 },
+    { 63902, 3, 1, 0, 10100 },
+    { 63905, 3, 1, 0, 10100 },
+    { 63908, 2, 1, 0, 10100 },
+    { 63910, 3, 1, 0, 10100 },
+    { 63913, 3, 1, 0, 10100 },
+    { 63916, 2, 1, 0, 10100 },
+    { 63918, 3, 1, 0, 10100 },
+    { 63921, 2, 1, 0, 10100 },
+    { 63923, 3, 1, 0, 10100 },
+    { 63926, 3, 1, 0, 10100 },
+    { 63929, 2, 1, 0, 10100 },
+    { 63931, 3, 1, 0, 10100 },
+    { 63934, 3, 1, 0, 10100 },
+    { 63937, 2, 1, 0, 10100 },
+    { 63939, 3, 1, 0, 10100 },
+    { 63942, 3, 1, 0, 10100 },
+    { 63945, 2, 1, 0, 10100 },
+    { 63947, 3, 1, 0, 10100 },
+    { 63950, 3, 1, 0, 10100 },
+    { 63953, 2, 1, 0, 10100 },
+    { 63955, 3, 1, 0, 10100 },
+    { 63958, 3, 1, 0, 10100 },
+    { 63961, 2, 1, 0, 10100 },
+    { 63963, 3, 1, 0, 10100 },
+    { 63966, 3, 1, 0, 10100 },
+    { 63969, 2, 1, 0, 10100 },
+    { 63971, 3, 1, 0, 10100 },
+    { 63974, 3, 1, 0, 10100 },
+    { 63977, 2, 1, 0, 10100 },
+    { 63979, 3, 1, 3, 10100 },
+    { 63982, 3, 1, 0, 10103 },
+    { 63985, 2, 1, 0, 10103 },
+    { 63987, 3, 1, 0, 10103 },
+    { 63990, 3, 1, 0, 10103 },
+    { 63993, 2, 1, 0, 10103 },
+    { 63995, 3, 1, 0, 10103 },
+    { 63998, 3, 1, 0, 10103 },
+    { 64001, 9, 1, 0, 10103 },
+    { 64010, 2, 1, 0, 10103 },
+    { 64012, 3, 1, 0, 10103 },
+    { 64015, 3, 1, 0, 10103 },
+    { 64018, 5, 1, 0, 10103 },
+    { 64023, 3, 1, 0, 10103 },
+    { 64026, 3, 1, 0, 10103 },
+    { 64029, 3, 1, 0, 10103 },
+    { 64032, 3, 1, 0, 10103 },
+    { 64035, 3, 1, 0, 10103 },
+    { 64038, 9, 1, 0, 10103 },
+    { 64047, 2, 1, 0, 10103 },
+    { 64049, 3, 1, 0, 10103 },
+    { 64052, 3, 1, 0, 10103 },
+    { 64055, 2, 1, 0, 10103 },
+    { 64057, 3, 1, 0, 10103 },
+    { 64060, 3, 1, 0, 10103 },
+    { 64063, 2, 1, 0, 10103 },
+    { 64065, 3, 1, 0, 10103 },
+    { 64068, 3, 1, 0, 10103 },
+    { 64071, 2, 1, 0, 10103 },
+    { 64073, 3, 1, 0, 10103 },
+    { 64076, 3, 1, 0, 10103 },
+    { 64079, 2, 1, 0, 10103 },
+    { 64081, 3, 1, 0, 10103 },
+    { 64084, 3, 1, 0, 10103 },
+    { 64087, 2, 1, 0, 10103 },
+    { 64089, 3, 1, 0, 10103 },
+    { 64092, 2, 1, 0, 10103 },
+    { 64094, 3, 1, 0, 10103 },
+    { 64097, 3, 1, 0, 10103 },
+    { 64100, 2, 1, 0, 10103 },
+    { 64102, 3, 1, 0, 10103 },
+    { 64105, 3, 1, 0, 10103 },
+    { 64108, 2, 1, 0, 10103 },
+    { 64110, 3, 1, 0, 10103 },
+    { 64113, 3, 1, 0, 10103 },
+    { 64116, 2, 1, 0, 10103 },
+    { 64118, 3, 1, 0, 10103 },
+    { 64121, 3, 1, 0, 10103 },
+    { 64124, 2, 1, 0, 10103 },
+    { 64126, 3, 1, 0, 10103 },
+    { 64129, 3, 1, 0, 10103 },
+    { 64132, 2, 1, 0, 10103 },
+    { 64134, 3, 1, 0, 10103 },
+    { 64137, 3, 1, 0, 10103 },
+    { 64140, 2, 1, 0, 10103 },
+    { 64142, 3, 1, 0, 10103 },
+    { 64145, 3, 1, 0, 10103 },
+    { 64148, 2, 1, 0, 10103 },
+    { 64150, 3, 1, 0, 10103 },
+    { 64153, 3, 1, 0, 10103 },
+    { 64156, 2, 1, 0, 10103 },
+    { 64158, 3, 1, 0, 10103 },
+    { 64161, 3, 1, 0, 10103 },
+    { 64164, 2, 1, 0, 10103 },
+    { 64166, 3, 1, 0, 10103 },
+    { 64169, 3, 1, 0, 10103 },
+    { 64172, 2, 1, 0, 10103 },
+    { 64174, 3, 1, 0, 10103 },
+    { 64177, 3, 1, 0, 10103 },
+    { 64180, 2, 1, 0, 10103 },
+    { 64182, 3, 1, 0, 10103 },
+    { 64185, 2, 1, 0, 10103 },
+    { 64187, 3, 1, 0, 10103 },
+    { 64190, 3, 1, 0, 10103 },
+    { 64193, 2, 1, 0, 10103 },
+    { 64195, 3, 1, 0, 10103 },
+    { 64198, 2, 1, 0, 10103 },
+    { 64200, 3, 1, 0, 10103 },
+    { 64203, 3, 1, 0, 10103 },
+    { 64206, 2, 1, 0, 10103 },
+    { 64208, 3, 1, 0, 10103 },
+    { 64211, 3, 1, 0, 10103 },
+    { 64214, 2, 1, 0, 10103 },
+    { 64216, 3, 1, 0, 10103 },
+    { 64219, 3, 1, 0, 10103 },
+    { 64222, 2, 1, 0, 10103 },
+    { 64224, 3, 1, 0, 10103 },
+    { 64227, 3, 1, 0, 10103 },
+    { 64230, 2, 1, 0, 10103 },
+    { 64232, 3, 1, 0, 10103 },
+    { 64235, 3, 1, 0, 10103 },
+    { 64238, 2, 1, 0, 10103 },
+    { 64240, 3, 1, 0, 10103 },
+    { 64243, 3, 1, 0, 10103 },
+    { 64246, 2, 1, 0, 10103 },
+    { 64248, 3, 1, 0, 10103 },
+    { 64251, 3, 1, 0, 10103 },
+    { 64254, 2, 1, 0, 10103 },
+    { 64256, 3, 1, 0, 10103 },
+    { 64259, 3, 1, 0, 10103 },
+    { 64262, 2, 1, 0, 10103 },
+    { 64264, 2, 1, 0, 10103 },
+    { 64266, 3, 1, 0, 10103 },
+    { 64269, 3, 1, 0, 10103 },
+    { 64272, 8, 1, 0, 10103 },
+    { 64280, 1, 1, 0, 10103 },
+    { 64281, 8, 1, 0, 10103 },
+    { 64289, 3, 1, 0, 10103 },
+    { 64292, 7, 1, 0, 10103 },
+    { 64299, 5, 0, 1, 10103 },
+    { 64304, 4, 1, 0, 10104 },
+    { 64308, 3, 0, 1, 10104 },
+    { 64311, 8, 1, 0, 10105 },
+    { 64319, 8, 1, 0, 10105 },
+    { 64327, 8, 1, 0, 10105 },
+    { 64335, 3, 1, 1, 10105 },
+    { 64338, 3, 1, 1, 10106 },
+    { 64341, 2, 1, 0, 10107 },
+    { 64343, 10, 1, 0, 10107 },
+    { 64353, 3, 1, 0, 10107 },
+    { 64356, 4, 1, 0, 10107 },
+    { 64360, 3, 1, 0, 10107 },
+    { 64363, 3, 1, 1, 10107 },
+    { 64366, 2, 1, 0, 10108 },
+    { 64368, 10, 1, 0, 10108 },
+    { 64378, 3, 1, 0, 10108 },
+    { 64381, 3, 1, 1, 10108 },
+    { 64384, 2, 1, 0, 10109 },
+    { 64386, 10, 1, 0, 10109 },
+    { 64396, 10, 0, 1, 10109 },
+    { 64406, 7, 4, 0, 10110 },
+    { 64413, 2, 0, 2, 10110 },
+    { 64415, 3, 4, 0, 10112 },
+    { 64418, 6, 0, 2, 10112 },
+    { 64424, 6, 0, 2, 10114 },
+    { 64430, 6, 0, 2, 10116 },
+    { 64436, 9, 0, 1, 10118 },
+    { 64445, 6, 0, 2, 10119 },
+    { 64451, 9, 0, 1, 10121 },
+    { 64460, 2, 1, 0, 10122 },
+    { 64462, 10, 1, 0, 10122 },
+    { 64472, 6, 0, 2, 10122 },
+    { 64478, 6, 0, 2, 10124 },
+    { 64484, 9, 0, 1, 10126 },
+    { 64493, 2, 1, 0, 10127 },
+    { 64495, 10, 1, 0, 10127 },
+    { 64505, 6, 0, 2, 10127 },
+    { 64511, 9, 0, 1, 10129 },
+    { 64520, 6, 0, 2, 10130 },
+    { 64526, 9, 0, 1, 10132 },
+    { 64535, 6, 0, 2, 10133 },
+    { 64541, 9, 0, 1, 10135 },
+    { 64550, 2, 1, 0, 10136 },
+    { 64552, 10, 1, 0, 10136 },
+    { 64562, 6, 0, 2, 10136 },
+    { 64568, 9, 0, 1, 10138 },
+    { 64577, 2, 1, 0, 10139 },
+    { 64579, 10, 1, 0, 10139 },
+    { 64589, 6, 0, 2, 10139 },
+    { 64595, 6, 0, 2, 10141 },
+    { 64601, 6, 0, 2, 10143 },
+    { 64607, 9, 0, 1, 10145 },
+    { 64616, 6, 0, 2, 10146 },
+    { 64622, 9, 0, 1, 10148 },
+    { 64631, 2, 1, 0, 10149 },
+    { 64633, 10, 1, 0, 10149 },
+    { 64643, 6, 0, 2, 10149 },
+    { 64649, 9, 0, 1, 10151 },
+    { 64658, 2, 1, 0, 10152 },
+    { 64660, 10, 1, 0, 10152 },
+    { 64670, 6, 0, 2, 10152 },
+    { 64676, 6, 0, 2, 10154 },
+    { 64682, 9, 0, 1, 10156 },
+    { 64691, 6, 0, 2, 10157 },
+    { 64697, 9, 0, 1, 10159 },
+    { 64706, 6, 0, 2, 10160 },
+    { 64712, 9, 0, 1, 10162 },
+    { 64721, 2, 1, 0, 10163 },
+    { 64723, 10, 1, 0, 10163 },
+    { 64733, 6, 0, 2, 10163 },
+    { 64739, 6, 0, 2, 10165 },
+    { 64745, 1, 1, 0, 10167 },
+    { 64746, 3, 1, 0, 10167 },
+    { 64749, 3, 1, 0, 10167 },
+    { 64752, 5, 1, 0, 10167 },
+    { 64757, 4, 1, 0, 10167 },
+    { 64761, 7, 1, 0, 10167 },
+    { 64768, 4, 1, 0, 10167 },
+    { 64772, 7, 1, 0, 10167 },
+    { 64779, 4, 1, 0, 10167 },
+    { 64783, 4, 1, 0, 10167 },
+    { 64787, 7, 1, 0, 10167 },
+    { 64794, 8, 0, 1, 10167 },
+    { 64802, 4, 1, 0, 10168 },
+    { 64806, 3, 1, 0, 10168 },
+    { 64809, 1, 1, 0, 10168 },
+    { 64810, 6, 1, 0, 10168 },
+    { 64816, 1, 1, 0, 10168 },
+    { 64817, 1, 1, 0, 10168 },
+    { 64818, 6, 1, 0, 10168 },
+    { 64824, 4, 1, 0, 10168 },
+    { 64828, 5, 1, 0, 10168 },
+    { 64833, 5, 1, 0, 10168 },
+    { 64838, 4, 1, 0, 10168 },
+    { 64842, 4, 1, 0, 10168 },
+    { 64846, 4, 1, 0, 10168 },
+    { 64850, 3, 1, 0, 10168 },
+    { 64853, 3, 1, 0, 10168 },
+    { 64856, 3, 1, 0, 10168 },
+    { 64859, 3, 1, 0, 10168 },
+    { 64862, 3, 1, 0, 10168 },
+    { 64865, 2, 0, 1, 10168 },
+    { 64867, 2, 1, 0, 10169 },
+    { 64869, 2, 1, 0, 10169 },
+    { 64871, 1, 1, 0, 10169 },
+    { 64872, 4, 1, 0, 10169 },
+    { 64876, 4, 1, 0, 10169 },
+    { 64880, 6, 1, 0, 10169 },
+    { 64886, 3, 1, 0, 10169 },
+    { 64889, 5, 1, 0, 10169 },
+    { 64894, 3, 1, 0, 10169 },
+    { 64897, 9, 1, 0, 10169 },
+    { 64906, 5, 1, 0, 10169 },
+    { 64911, 5, 1, 0, 10169 },
+    { 64916, 5, 1, 0, 10169 },
+    { 64921, 2, 1, 0, 10169 },
+    { 64923, 10, 1, 0, 10169 },
+    { 64933, 14, 1, 0, 10169 },
+    { 64947, 3, 1, 0, 10169 },
+    { 64950, 14, 1, 0, 10169 },
+    { 64964, 3, 1, 0, 10169 },
+    { 64967, 14, 1, 0, 10169 },
+    { 64981, 3, 1, 0, 10169 },
+    { 64984, 14, 1, 0, 10169 },
+    { 64998, 2, 1, 0, 10169 },
+    { 65000, 3, 1, 0, 10169 },
+    { 65003, 14, 1, 0, 10169 },
+    { 65017, 2, 1, 0, 10169 },
+    { 65019, 3, 1, 0, 10169 },
+    { 65022, 14, 1, 0, 10169 },
+    { 65036, 3, 1, 0, 10169 },
+    { 65039, 14, 1, 0, 10169 },
+    { 65053, 2, 1, 0, 10169 },
+    { 65055, 3, 1, 0, 10169 },
+    { 65058, 14, 1, 0, 10169 },
+    { 65072, 2, 1, 0, 10169 },
+    { 65074, 3, 1, 0, 10169 },
+    { 65077, 14, 1, 0, 10169 },
+    { 65091, 2, 1, 0, 10169 },
+    { 65093, 3, 1, 0, 10169 },
+    { 65096, 14, 1, 0, 10169 },
+    { 65110, 2, 1, 0, 10169 },
+    { 65112, 3, 1, 0, 10169 },
+    { 65115, 14, 1, 0, 10169 },
+    { 65129, 2, 1, 0, 10169 },
+    { 65131, 3, 1, 0, 10169 },
+    { 65134, 14, 1, 0, 10169 },
+    { 65148, 3, 1, 0, 10169 },
+    { 65151, 14, 1, 0, 10169 },
+    { 65165, 3, 1, 0, 10169 },
+    { 65168, 14, 1, 0, 10169 },
+    { 65182, 2, 1, 0, 10169 },
+    { 65184, 3, 1, 0, 10169 },
+    { 65187, 14, 1, 0, 10169 },
+    { 65201, 2, 1, 0, 10169 },
+    { 65203, 3, 1, 0, 10169 },
+    { 65206, 14, 1, 0, 10169 },
+    { 65220, 2, 1, 0, 10169 },
+    { 65222, 3, 1, 0, 10169 },
+    { 65225, 14, 1, 0, 10169 },
+    { 65239, 3, 1, 0, 10169 },
+    { 65242, 14, 1, 0, 10169 },
+    { 65256, 2, 1, 0, 10169 },
+    { 65258, 3, 1, 0, 10169 },
+    { 65261, 14, 1, 0, 10169 },
+    { 65275, 2, 1, 0, 10169 },
+    { 65277, 3, 1, 0, 10169 },
+    { 65280, 14, 1, 0, 10169 },
+    { 65294, 2, 1, 0, 10169 },
+    { 65296, 3, 1, 0, 10169 },
+    { 65299, 14, 1, 0, 10169 },
+    { 65313, 3, 1, 0, 10169 },
+    { 65316, 14, 1, 0, 10169 },
+    { 65330, 5, 1, 0, 10169 },
+    { 65335, 3, 1, 0, 10169 },
+};
+
+// First eight label bytes of each node, big-endian and zero-padded, so a search can order
+// most labels with one integer compare
+static const uint64_t PREFIXES[] = {
+    0x0000000000000000ull, 0x6161610000000000ull, 0x6161727000000000ull, 0x6162617274680000ull,
+    0x6162620000000000ull, 0x6162626f74740000ull, 0x6162627669650000ull, 0x6162630000000000ull,
+    0x61626c6500000000ull, 0x61626f6761646f00ull, 0x6162756468616269ull, 0x6163000000000000ull,
+    0x61636164656d7900ull, 0x616363656e747572ull, 0x6163636f756e7461ull, 0x6163636f756e7461ull,
+    0x61636f0000000000ull, 0x6163746f72000000ull, 0x6164000000000000ull, 0x6164730000000000ull,
+    0x6164756c74000000ull, 0x6165000000000000ull, 0x6165670000000000ull, 0x6165726f00000000ull,
+    0x6165746e61000000ull, 0x6166000000000000ull, 0x61666c0000000000ull, 0x6166726963610000ull,
+    0x6167000000000000ull, 0x6167616b68616e00ull, 0x6167656e63790000ull, 0x6169000000000000ull,
+    0x6169670000000000ull, 0x6169726275730000ull, 0x616972666f726365ull, 0x61697274656c0000ull,
+    0x616b646e00000000ull, 0x616c000000000000ull, 0x616c6661726f6d65ull, 0x616c696261626100ull,
+    0x616c697061790000ull, 0x616c6c66696e616eull, 0x616c6c7374617465ull, 0x616c6c7900000000ull,
+    0x616c736163650000ull, 0x616c73746f6d0000ull, 0x616d000000000000ull, 0x616d617a6f6e0000ull,
+    0x616d65726963616eull, 0x616d65726963616eull, 0x616d657800000000ull, 0x616d66616d000000ull,
+    0x616d696361000000ull, 0x616d737465726461ull, 0x616e616c79746963ull, 0x616e64726f696400ull,
+    0x616e7175616e0000ull, 0x616e7a0000000000ull, 0x616f000000000000ull, 0x616f6c0000000000ull,
+    0x61706172746d656eull, 0x6170700000000000ull, 0x6170706c65000000ull, 0x6171000000000000ull,
+    0x6171756172656c6cull, 0x6172000000000000ull, 0x6172616200000000ull, 0x6172616d636f0000ull,
+    0x6172636869000000ull, 0x61726d7900000000ull, 0x6172706100000000ull, 0x6172740000000000ull,
+    0x6172746500000000ull, 0x6173000000000000ull, 0x6173646100000000ull, 0x6173696100000000ull,
+    0x6173736f63696174ull, 0x6174000000000000ull, 0x6174686c65746100ull, 0x6174746f726e6579ull,
+    0x6175000000000000ull, 0x61756374696f6e00ull, 0x6175646900000000ull, 0x61756469626c6500ull,
+    0x617564696f000000ull, 0x617573706f737400ull, 0x617574686f720000ull, 0x6175746f00000000ull,
+    0x6175746f73000000ull, 0x617669616e636100ull, 0x6177000000000000ull, 0x6177730000000000ull,
+    0x6178000000000000ull, 0x6178610000000000ull, 0x617a000000000000ull, 0x617a757265000000ull,
+    0x6261000000000000ull, 0x6261627900000000ull, 0x6261696475000000ull, 0x62616e616d657800ull,
+    0x62616e616e617265ull, 0x62616e6400000000ull, 0x62616e6b00000000ull, 0x6261720000000000ull,
+    0x62617263656c6f6eull, 0x626172636c617963ull, 0x626172636c617973ull, 0x62617265666f6f74ull,
+    0x6261726761696e73ull, 0x6261736562616c6cull, 0x6261736b65746261ull, 0x6261756861757300ull,
+    0x62617965726e0000ull, 0x6262000000000000ull, 0x6262630000000000ull, 0x6262740000000000ull,
+    0x6262766100000000ull, 0x6263670000000000ull, 0x62636e0000000000ull, 0x6264000000000000ull,
+    0x6265000000000000ull, 0x6265617473000000ull, 0x6265617574790000ull, 0x6265657200000000ull,
+    0x62656e746c657900ull, 0x6265726c696e0000ull, 0x6265737400000000ull, 0x6265737462757900ull,
+    0x6265740000000000ull, 0x6266000000000000ull, 0x6267000000000000ull, 0x6268000000000000ull,
+    0x6268617274690000ull, 0x6269000000000000ull, 0x6269626c65000000ull, 0x6269640000000000ull,
+    0x62696b6500000000ull, 0x62696e6700000000ull, 0x62696e676f000000ull, 0x62696f0000000000ull,
+    0x62697a0000000000ull, 0x626a000000000000ull, 0x626c61636b000000ull, 0x626c61636b667269ull,
+    0x626c6f636b627573ull, 0x626c6f6700000000ull, 0x626c6f6f6d626572ull, 0x626c756500000000ull,
+    0x626d000000000000ull, 0x626d730000000000ull, 0x626d770000000000ull, 0x626e000000000000ull,
+    0x626e707061726962ull, 0x626f000000000000ull, 0x626f617473000000ull, 0x626f656872696e67ull,
+    0x626f666100000000ull, 0x626f6d0000000000ull, 0x626f6e6400000000ull, 0x626f6f0000000000ull,
+    0x626f6f6b00000000ull, 0x626f6f6b696e6700ull, 0x626f736368000000ull, 0x626f7374696b0000ull,
+    0x626f73746f6e0000ull, 0x626f740000000000ull, 0x626f757469717565ull, 0x626f780000000000ull,
+    0x6272000000000000ull, 0x627261646573636full, 0x6272696467657374ull, 0x62726f6164776179ull,
+    0x62726f6b65720000ull, 0x62726f7468657200ull, 0x6272757373656c73ull, 0x6273000000000000ull,
+    0x6274000000000000ull, 0x6275696c64000000ull, 0x6275696c64657273ull, 0x627573696e657373ull,
+    0x6275790000000000ull, 0x62757a7a00000000ull, 0x6276000000000000ull, 0x6277000000000000ull,
+    0x6279000000000000ull, 0x627a000000000000ull, 0x627a680000000000ull, 0x6361000000000000ull,
+    0x6361620000000000ull, 0x6361666500000000ull, 0x63616c0000000000ull, 0x63616c6c00000000ull,
+    0x63616c76696e6b6cull, 0x63616d0000000000ull, 0x63616d6572610000ull, 0x63616d7000000000ull,
+    0x63616e6f6e000000ull, 0x63617065746f776eull, 0x6361706974616c00ull, 0x6361706974616c6full,
+    0x6361720000000000ull, 0x6361726176616e00ull, 0x6361726473000000ull, 0x6361726500000000ull,
+    0x6361726565720000ull, 0x6361726565727300ull, 0x6361727300000000ull, 0x6361736100000000ull,
+    0x6361736500000000ull, 0x6361736800000000ull, 0x636173696e6f0000ull, 0x6361740000000000ull,
+    0x6361746572696e67ull, 0x636174686f6c6963ull, 0x6362610000000000ull, 0x63626e0000000000ull,
+    0x6362726500000000ull, 0x6362730000000000ull, 0x6363000000000000ull, 0x6364000000000000ull,
+    0x63656e7465720000ull, 0x63656f0000000000ull, 0x6365726e00000000ull, 0x6366000000000000ull,
+    0x6366610000000000ull, 0x6366640000000000ull, 0x6367000000000000ull, 0x6368000000000000ull,
+    0x6368616e656c0000ull, 0x6368616e6e656c00ull, 0x6368617269747900ull, 0x6368617365000000ull,
+    0x6368617400000000ull, 0x6368656170000000ull, 0x6368696e74616900ull, 0x6368726973746d61ull,
+    0x6368726f6d650000ull, 0x6368757263680000ull, 0x6369000000000000ull, 0x6369707269616e69ull,
+    0x636972636c650000ull, 0x636973636f000000ull, 0x6369746164656c00ull, 0x6369746900000000ull,
+    0x6369746963000000ull, 0x6369747900000000ull, 0x6369747965617473ull, 0x636b000000000000ull,
+    0x636c000000000000ull, 0x636c61696d730000ull, 0x636c65616e696e67ull, 0x636c69636b000000ull,
+    0x636c696e69630000ull, 0x636c696e69717565ull, 0x636c6f7468696e67ull, 0x636c6f7564000000ull,
+    0x636c756200000000ull, 0x636c75626d656400ull, 0x636d000000000000ull, 0x636e000000000000ull,
+    0x636f000000000000ull, 0x636f616368000000ull, 0x636f646573000000ull, 0x636f666665650000ull,
+    0x636f6c6c65676500ull, 0x636f6c6f676e6500ull, 0x636f6d0000000000ull, 0x636f6d6361737400ull,
+    0x636f6d6d62616e6bull, 0x636f6d6d756e6974ull, 0x636f6d70616e7900ull, 0x636f6d7061726500ull,
+    0x636f6d7075746572ull, 0x636f6d7365630000ull, 0x636f6e646f730000ull, 0x636f6e7374727563ull,
+    0x636f6e73756c7469ull, 0x636f6e7461637400ull, 0x636f6e7472616374ull, 0x636f6f6b696e6700ull,
+    0x636f6f6b696e6763ull, 0x636f6f6c00000000ull, 0x636f6f7000000000ull, 0x636f727369636100ull,
+    0x636f756e74727900ull, 0x636f75706f6e0000ull, 0x636f75706f6e7300ull, 0x636f757273657300ull,
+    0x6370610000000000ull, 0x6372000000000000ull, 0x6372656469740000ull, 0x6372656469746361ull,
+    0x637265646974756eull, 0x637269636b657400ull, 0x63726f776e000000ull, 0x6372730000000000ull,
+    0x6372756973650000ull, 0x6372756973657300ull, 0x6375000000000000ull, 0x63756973696e656cull,
+    0x6376000000000000ull, 0x6377000000000000ull, 0x6378000000000000ull, 0x6379000000000000ull,
+    0x63796d7275000000ull, 0x63796f7500000000ull, 0x637a000000000000ull, 0x6461627572000000ull,
+    0x6461640000000000ull, 0x64616e6365000000ull, 0x6461746100000000ull, 0x6461746500000000ull,
+    0x646174696e670000ull, 0x64617473756e0000ull, 0x6461790000000000ull, 0x64636c6b00000000ull,
+    0x6464730000000000ull, 0x6465000000000000ull, 0x6465616c00000000ull, 0x6465616c65720000ull,
+    0x6465616c73000000ull, 0x6465677265650000ull, 0x64656c6976657279ull, 0x64656c6c00000000ull,
+    0x64656c6f69747465ull, 0x64656c7461000000ull, 0x64656d6f63726174ull, 0x64656e74616c0000ull,
+    0x64656e7469737400ull, 0x6465736900000000ull, 0x64657369676e0000ull, 0x6465760000000000ull,
+    0x64686c0000000000ull, 0x6469616d6f6e6473ull, 0x6469657400000000ull, 0x6469676974616c00ull,
+    0x6469726563740000ull, 0x6469726563746f72ull, 0x646973636f756e74ull, 0x646973636f766572ull,
+    0x6469736800000000ull, 0x6469790000000000ull, 0x646a000000000000ull, 0x646b000000000000ull,
+    0x646d000000000000ull, 0x646e700000000000ull, 0x646f000000000000ull, 0x646f637300000000ull,
+    0x646f63746f720000ull, 0x646f670000000000ull, 0x646f6d61696e7300ull, 0x646f740000000000ull,
+    0x646f776e6c6f6164ull, 0x6472697665000000ull, 0x6474760000000000ull, 0x6475626169000000ull,
+    0x64756e6c6f700000ull, 0x6475706f6e740000ull, 0x64757262616e0000ull, 0x6476616700000000ull,
+    0x6476720000000000ull, 0x647a000000000000ull, 0x6561727468000000ull, 0x6561740000000000ull,
+    0x6563000000000000ull, 0x65636f0000000000ull, 0x6564656b61000000ull, 0x6564750000000000ull,
+    0x656475636174696full, 0x6565000000000000ull, 0x6567000000000000ull, 0x656d61696c000000ull,
+    0x656d6572636b0000ull, 0x656e657267790000ull, 0x656e67696e656572ull, 0x656e67696e656572ull,
+    0x656e746572707269ull, 0x6570736f6e000000ull, 0x65717569706d656eull, 0x6572000000000000ull,
+    0x6572696373736f6eull, 0x65726e6900000000ull, 0x6573000000000000ull, 0x6573710000000000ull,
+    0x6573746174650000ull, 0x6574000000000000ull, 0x65746973616c6174ull, 0x6575000000000000ull,
+    0x6575726f76697369ull, 0x6575730000000000ull, 0x6576656e74730000ull, 0x65786368616e6765ull,
+    0x6578706572740000ull, 0x6578706f73656400ull, 0x6578707265737300ull, 0x6578747261737061ull,
+    0x6661676500000000ull, 0x6661696c00000000ull, 0x6661697277696e64ull, 0x6661697468000000ull,
+    0x66616d696c790000ull, 0x66616e0000000000ull, 0x66616e7300000000ull, 0x6661726d00000000ull,
+    0x6661726d65727300ull, 0x66617368696f6e00ull, 0x6661737400000000ull, 0x6665646578000000ull,
+    0x666565646261636bull, 0x6665727261726900ull, 0x6665727265726f00ull, 0x6669000000000000ull,
+    0x6669617400000000ull, 0x666964656c697479ull, 0x6669646f00000000ull, 0x66696c6d00000000ull,
+    0x66696e616c000000ull, 0x66696e616e636500ull, 0x66696e616e636961ull, 0x6669726500000000ull,
+    0x6669726573746f6eull, 0x6669726d64616c65ull, 0x6669736800000000ull, 0x66697368696e6700ull,
+    0x6669740000000000ull, 0x6669746e65737300ull, 0x666a000000000000ull, 0x666b000000000000ull,
+    0x666c69636b720000ull, 0x666c696768747300ull, 0x666c697200000000ull, 0x666c6f7269737400ull,
+    0x666c6f7765727300ull, 0x666c790000000000ull, 0x666d000000000000ull, 0x666f000000000000ull,
+    0x666f6f0000000000ull, 0x666f6f6400000000ull, 0x666f6f646e657477ull, 0x666f6f7462616c6cull,
+    0x666f726400000000ull, 0x666f726578000000ull, 0x666f7273616c6500ull, 0x666f72756d000000ull,
+    0x666f756e64617469ull, 0x666f780000000000ull, 0x6672000000000000ull, 0x6672656500000000ull,
+    0x66726573656e6975ull, 0x66726c0000000000ull, 0x66726f67616e7300ull, 0x66726f6e74646f6full,
+    0x66726f6e74696572ull, 0x6674720000000000ull, 0x66756a6974737500ull, 0x66756e0000000000ull,
+    0x66756e6400000000ull, 0x6675726e69747572ull, 0x667574626f6c0000ull, 0x6679690000000000ull,
+    0x6761000000000000ull, 0x67616c0000000000ull, 0x67616c6c65727900ull, 0x67616c6c6f000000ull,
+    0x67616c6c75700000ull, 0x67616d6500000000ull, 0x67616d6573000000ull, 0x6761700000000000ull,
+    0x67617264656e0000ull, 0x6761790000000000ull, 0x6762000000000000ull, 0x6762697a00000000ull,
+    0x6764000000000000ull, 0x67646e0000000000ull, 0x6765000000000000ull, 0x6765610000000000ull,
+    0x67656e7400000000ull, 0x67656e74696e6700ull, 0x67656f7267650000ull, 0x6766000000000000ull,
+    0x6767000000000000ull, 0x6767656500000000ull, 0x6768000000000000ull, 0x6769000000000000ull,
+    0x6769667400000000ull, 0x6769667473000000ull, 0x6769766573000000ull, 0x676976696e670000ull,
+    0x676c000000000000ull, 0x676c617373000000ull, 0x676c650000000000ull, 0x676c6f62616c0000ull,
+    0x676c6f626f000000ull, 0x676d000000000000ull, 0x676d61696c000000ull, 0x676d626800000000ull,
+    0x676d6f0000000000ull, 0x676d780000000000ull, 0x676e000000000000ull, 0x676f646164647900ull,
+    0x676f6c6400000000ull, 0x676f6c64706f696eull, 0x676f6c6600000000ull, 0x676f6f0000000000ull,
+    0x676f6f6479656172ull, 0x676f6f6700000000ull, 0x676f6f676c650000ull, 0x676f700000000000ull,
+    0x676f740000000000ull, 0x676f760000000000ull, 0x6770000000000000ull, 0x6771000000000000ull,
+    0x6772000000000000ull, 0x677261696e676572ull, 0x6772617068696373ull, 0x6772617469730000ull,
+    0x677265656e000000ull, 0x6772697065000000ull, 0x67726f6365727900ull, 0x67726f7570000000ull,
+    0x6773000000000000ull, 0x6774000000000000ull, 0x6775000000000000ull, 0x677561726469616eull,
+    0x6775636369000000ull, 0x6775676500000000ull, 0x6775696465000000ull, 0x6775697461727300ull,
+    0x6775727500000000ull, 0x6777000000000000ull, 0x6779000000000000ull, 0x6861697200000000ull,
+    0x68616d6275726700ull, 0x68616e676f757400ull, 0x6861757300000000ull, 0x68626f0000000000ull,
+    0x6864666300000000ull, 0x6864666362616e6bull, 0x6865616c74680000ull, 0x6865616c74686361ull,
+    0x68656c7000000000ull, 0x68656c73696e6b69ull, 0x6865726500000000ull, 0x6865726d65730000ull,
+    0x6867747600000000ull, 0x686970686f700000ull, 0x686973616d697473ull, 0x6869746163686900ull,
+    0x6869760000000000ull, 0x686b000000000000ull, 0x686b740000000000ull, 0x686d000000000000ull,
+    0x686e000000000000ull, 0x686f636b65790000ull, 0x686f6c64696e6773ull, 0x686f6c6964617900ull,
+    0x686f6d656465706full, 0x686f6d65676f6f64ull, 0x686f6d6573000000ull, 0x686f6d6573656e73ull,
+    0x686f6e6461000000ull, 0x686f727365000000ull, 0x686f73706974616cull, 0x686f737400000000ull,
+    0x686f7374696e6700ull, 0x686f740000000000ull, 0x686f74656c657300ull, 0x686f74656c730000ull,
+    0x686f746d61696c00ull, 0x686f757365000000ull, 0x686f770000000000ull, 0x6872000000000000ull,
+    0x6873626300000000ull, 0x6874000000000000ull, 0x6875000000000000ull, 0x6875676865730000ull,
+    0x6879617474000000ull, 0x6879756e64616900ull, 0x69626d0000000000ull, 0x6963626300000000ull,
+    0x6963650000000000ull, 0x6963750000000000ull, 0x6964000000000000ull, 0x6965000000000000ull,
+    0x6965656500000000ull, 0x69666d0000000000ull, 0x696b616e6f000000ull, 0x696c000000000000ull,
+    0x696d000000000000ull, 0x696d616d61740000ull, 0x696d646200000000ull, 0x696d6d6f00000000ull,
+    0x696d6d6f62696c69ull, 0x696e000000000000ull, 0x696e630000000000ull, 0x696e647573747269ull,
+    0x696e66696e697469ull, 0x696e666f00000000ull, 0x696e670000000000ull, 0x696e6b0000000000ull,
+    0x696e737469747574ull, 0x696e737572616e63ull, 0x696e737572650000ull, 0x696e740000000000ull,
+    0x696e7465726e6174ull, 0x696e747569740000ull, 0x696e766573746d65ull, 0x696f000000000000ull,
+    0x69706972616e6761ull, 0x6971000000000000ull, 0x6972000000000000ull, 0x6972697368000000ull,
+    0x6973000000000000ull, 0x69736d61696c6900ull, 0x6973740000000000ull, 0x697374616e62756cull,
+    0x6974000000000000ull, 0x6974617500000000ull, 0x6974760000000000ull, 0x6a61677561720000ull,
+    0x6a61766100000000ull, 0x6a63620000000000ull, 0x6a65000000000000ull, 0x6a65657000000000ull,
+    0x6a65747a74000000ull, 0x6a6577656c727900ull, 0x6a696f0000000000ull, 0x6a6c6c0000000000ull,
+    0x6a6d000000000000ull, 0x6a6d700000000000ull, 0x6a6e6a0000000000ull, 0x6a6f000000000000ull,
+    0x6a6f627300000000ull, 0x6a6f627572670000ull, 0x6a6f740000000000ull, 0x6a6f790000000000ull,
+    0x6a70000000000000ull, 0x6a706d6f7267616eull, 0x6a70727300000000ull, 0x6a7565676f730000ull,
+    0x6a756e6970657200ull, 0x6b617566656e0000ull, 0x6b64646900000000ull, 0x6b65000000000000ull,
+    0x6b65727279686f74ull, 0x6b657272796c6f67ull, 0x6b6572727970726full, 0x6b66680000000000ull,
+    0x6b67000000000000ull, 0x6b68000000000000ull, 0x6b69000000000000ull, 0x6b69610000000000ull,
+    0x6b69647300000000ull, 0x6b696d0000000000ull, 0x6b696e6465720000ull, 0x6b696e646c650000ull,
+    0x6b69746368656e00ull, 0x6b69776900000000ull, 0x6b6d000000000000ull, 0x6b6e000000000000ull,
+    0x6b6f656c6e000000ull, 0x6b6f6d6174737500ull, 0x6b6f736865720000ull, 0x6b70000000000000ull,
+    0x6b706d6700000000ull, 0x6b706e0000000000ull, 0x6b72000000000000ull, 0x6b72640000000000ull,
+    0x6b72656400000000ull, 0x6b756f6b67726f75ull, 0x6b77000000000000ull, 0x6b79000000000000ull,
+    0x6b796f746f000000ull, 0x6b7a000000000000ull, 0x6c61000000000000ull, 0x6c61636169786100ull,
+    0x6c616d626f726768ull, 0x6c616d6572000000ull, 0x6c616e6361737465ull, 0x6c616e6369610000ull,
+    0x6c616e6400000000ull, 0x6c616e64726f7665ull, 0x6c616e7865737300ull, 0x6c6173616c6c6500ull,
+    0x6c61740000000000ull, 0x6c6174696e6f0000ull, 0x6c6174726f626500ull, 0x6c61770000000000ull,
+    0x6c61777965720000ull, 0x6c62000000000000ull, 0x6c63000000000000ull, 0x6c64730000000000ull,
+    0x6c65617365000000ull, 0x6c65636c65726300ull, 0x6c656672616b0000ull, 0x6c6567616c000000ull,
+    0x6c65676f00000000ull, 0x6c65787573000000ull, 0x6c67627400000000ull, 0x6c69000000000000ull,
+    0x6c69646c00000000ull, 0x6c69666500000000ull, 0x6c696665696e7375ull, 0x6c6966657374796cull,
+    0x6c69676874696e67ull, 0x6c696b6500000000ull, 0x6c696c6c79000000ull, 0x6c696d6974656400ull,
+    0x6c696d6f00000000ull, 0x6c696e636f6c6e00ull, 0x6c696e6465000000ull, 0x6c696e6b00000000ull,
+    0x6c69707379000000ull, 0x6c69766500000000ull, 0x6c6976696e670000ull, 0x6c6b000000000000ull,
+    0x6c6c630000000000ull, 0x6c6c700000000000ull, 0x6c6f616e00000000ull, 0x6c6f616e73000000ull,
+    0x6c6f636b65720000ull, 0x6c6f637573000000ull, 0x6c6f6c0000000000ull, 0x6c6f6e646f6e0000ull,
+    0x6c6f747465000000ull, 0x6c6f74746f000000ull, 0x6c6f766500000000ull, 0x6c706c0000000000ull,
+    0x6c706c66696e616eull, 0x6c72000000000000ull, 0x6c73000000000000ull, 0x6c74000000000000ull,
+    0x6c74640000000000ull, 0x6c74646100000000ull, 0x6c75000000000000ull, 0x6c756e646265636bull,
+    0x6c75786500000000ull, 0x6c75787572790000ull, 0x6c76000000000000ull, 0x6c79000000000000ull,
+    0x6d61000000000000ull, 0x6d61637973000000ull, 0x6d61647269640000ull, 0x6d61696600000000ull,
+    0x6d6169736f6e0000ull, 0x6d616b6575700000ull, 0x6d616e0000000000ull, 0x6d616e6167656d65ull,
+    0x6d616e676f000000ull, 0x6d61700000000000ull, 0x6d61726b65740000ull, 0x6d61726b6574696eull,
+    0x6d61726b65747300ull, 0x6d617272696f7474ull, 0x6d61727368616c6cull, 0x6d61736572617469ull,
+    0x6d617474656c0000ull, 0x6d62610000000000ull, 0x6d63000000000000ull, 0x6d636b696e736579ull,
+    0x6d64000000000000ull, 0x6d65000000000000ull, 0x6d65640000000000ull, 0x6d65646961000000ull,
+    0x6d65657400000000ull, 0x6d656c626f75726eull, 0x6d656d6500000000ull, 0x6d656d6f7269616cull,
+    0x6d656e0000000000ull, 0x6d656e7500000000ull, 0x6d6572636b6d7364ull, 0x6d67000000000000ull,
+    0x6d68000000000000ull, 0x6d69616d69000000ull, 0x6d6963726f736f66ull, 0x6d696c0000000000ull,
+    0x6d696e6900000000ull, 0x6d696e7400000000ull, 0x6d69740000000000ull, 0x6d69747375626973ull,
+    0x6d6b000000000000ull, 0x6d6c000000000000ull, 0x6d6c620000000000ull, 0x6d6c730000000000ull,
+    0x6d6d000000000000ull, 0x6d6d610000000000ull, 0x6d6e000000000000ull, 0x6d6f000000000000ull,
+    0x6d6f626900000000ull, 0x6d6f62696c650000ull, 0x6d6f646100000000ull, 0x6d6f650000000000ull,
+    0x6d6f690000000000ull, 0x6d6f6d0000000000ull, 0x6d6f6e6173680000ull, 0x6d6f6e6579000000ull,
+    0x6d6f6e7374657200ull, 0x6d6f726d6f6e0000ull, 0x6d6f727467616765ull, 0x6d6f73636f770000ull,
+    0x6d6f746f00000000ull, 0x6d6f746f72637963ull, 0x6d6f760000000000ull, 0x6d6f766965000000ull,
+    0x6d70000000000000ull, 0x6d71000000000000ull, 0x6d72000000000000ull, 0x6d73000000000000ull,
+    0x6d73640000000000ull, 0x6d74000000000000ull, 0x6d746e0000000000ull, 0x6d74720000000000ull,
+    0x6d75000000000000ull, 0x6d757365756d0000ull, 0x6d75736963000000ull, 0x6d757475616c0000ull,
+    0x6d76000000000000ull, 0x6d77000000000000ull, 0x6d78000000000000ull, 0x6d79000000000000ull,
+    0x6d7a000000000000ull, 0x6e61000000000000ull, 0x6e61620000000000ull, 0x6e61676f79610000ull,
+    0x6e616d6500000000ull, 0x6e61747572610000ull, 0x6e61767900000000ull, 0x6e62610000000000ull,
+    0x6e63000000000000ull, 0x6e65000000000000ull, 0x6e65630000000000ull, 0x6e65740000000000ull,
+    0x6e657462616e6b00ull, 0x6e6574666c697800ull, 0x6e6574776f726b00ull, 0x6e65757374617200ull,
+    0x6e65770000000000ull, 0x6e65777300000000ull, 0x6e65787400000000ull, 0x6e65787464697265ull,
+    0x6e65787573000000ull, 0x6e66000000000000ull, 0x6e666c0000000000ull, 0x6e67000000000000ull,
+    0x6e676f0000000000ull, 0x6e686b0000000000ull, 0x6e69000000000000ull, 0x6e69636f00000000ull,
+    0x6e696b6500000000ull, 0x6e696b6f6e000000ull, 0x6e696e6a61000000ull, 0x6e697373616e0000ull,
+    0x6e69737361790000ull, 0x6e6c000000000000ull, 0x6e6f000000000000ull, 0x6e6f6b6961000000ull,
+    0x6e6f727468776573ull, 0x6e6f72746f6e0000ull, 0x6e6f770000000000ull, 0x6e6f7772757a0000ull,
+    0x6e6f777476000000ull, 0x6e70000000000000ull, 0x6e72000000000000ull, 0x6e72610000000000ull,
+    0x6e72770000000000ull, 0x6e74740000000000ull, 0x6e75000000000000ull, 0x6e79630000000000ull,
+    0x6e7a000000000000ull, 0x6f62690000000000ull, 0x6f62736572766572ull, 0x6f66666963650000ull,
+    0x6f6b696e61776100ull, 0x6f6c6179616e0000ull, 0x6f6c6179616e6772ull, 0x6f6c646e61767900ull,
+    0x6f6c6c6f00000000ull, 0x6f6d000000000000ull, 0x6f6d656761000000ull, 0x6f6e650000000000ull,
+    0x6f6e670000000000ull, 0x6f6e696f6e000000ull, 0x6f6e6c0000000000ull, 0x6f6e6c696e650000ull,
+    0x6f6f6f0000000000ull, 0x6f70656e00000000ull, 0x6f7261636c650000ull, 0x6f72616e67650000ull,
+    0x6f72670000000000ull, 0x6f7267616e696300ull, 0x6f726967696e7300ull, 0x6f73616b61000000ull,
+    0x6f7473756b610000ull, 0x6f74740000000000ull, 0x6f76680000000000ull, 0x7061000000000000ull,
+    0x7061676500000000ull, 0x70616e61736f6e69ull, 0x7061726973000000ull, 0x7061727300000000ull,
+    0x706172746e657273ull, 0x7061727473000000ull, 0x7061727479000000ull, 0x706173736167656eull,
+    0x7061790000000000ull, 0x7063637700000000ull, 0x7065000000000000ull, 0x7065740000000000ull,
+    0x7066000000000000ull, 0x7066697a65720000ull, 0x7067000000000000ull, 0x7068000000000000ull,
+    0x706861726d616379ull, 0x7068640000000000ull, 0x7068696c69707300ull, 0x70686f6e65000000ull,
+    0x70686f746f000000ull, 0x70686f746f677261ull, 0x70686f746f730000ull, 0x70687973696f0000ull,
+    0x7069637300000000ull, 0x7069637465740000ull, 0x7069637475726573ull, 0x7069640000000000ull,
+    0x70696e0000000000ull, 0x70696e6700000000ull, 0x70696e6b00000000ull, 0x70696f6e65657200ull,
+    0x70697a7a61000000ull, 0x706b000000000000ull, 0x706c000000000000ull, 0x706c616365000000ull,
+    0x706c617900000000ull, 0x706c617973746174ull, 0x706c756d62696e67ull, 0x706c757300000000ull,
+    0x706d000000000000ull, 0x706e000000000000ull, 0x706e630000000000ull, 0x706f686c00000000ull,
+    0x706f6b6572000000ull, 0x706f6c6974696500ull, 0x706f726e00000000ull, 0x706f737400000000ull,
+    0x7072000000000000ull, 0x7072616d65726963ull, 0x7072617869000000ull, 0x7072657373000000ull,
+    0x7072696d65000000ull, 0x70726f0000000000ull, 0x70726f6400000000ull, 0x70726f6475637469ull,
+    0x70726f6600000000ull, 0x70726f6772657373ull, 0x70726f6d6f000000ull, 0x70726f7065727469ull,
+    0x70726f7065727479ull, 0x70726f7465637469ull, 0x7072750000000000ull, 0x70727564656e7469ull,
+    0x7073000000000000ull, 0x7074000000000000ull, 0x7075620000000000ull, 0x7077000000000000ull,
+    0x7077630000000000ull, 0x7079000000000000ull, 0x7161000000000000ull, 0x71706f6e00000000ull,
+    0x7175656265630000ull, 0x7175657374000000ull, 0x726163696e670000ull, 0x726164696f000000ull,
+    0x7265000000000000ull, 0x7265616400000000ull, 0x7265616c65737461ull, 0x7265616c746f7200ull,
+    0x7265616c74790000ull, 0x7265636970657300ull, 0x7265640000000000ull, 0x72656473746f6e65ull,
+    0x726564756d627265ull, 0x7265686162000000ull, 0x7265697365000000ull, 0x72656973656e0000ull,
+    0x7265697400000000ull, 0x72656c69616e6365ull, 0x72656e0000000000ull, 0x72656e7400000000ull,
+    0x72656e74616c7300ull, 0x7265706169720000ull, 0x7265706f72740000ull, 0x72657075626c6963ull,
+    0x7265737400000000ull, 0x7265737461757261ull, 0x7265766965770000ull, 0x7265766965777300ull,
+    0x726578726f746800ull, 0x7269636800000000ull, 0x726963686172646cull, 0x7269636f68000000ull,
+    0x72696c0000000000ull, 0x72696f0000000000ull, 0x7269700000000000ull, 0x726f000000000000ull,
+    0x726f636865720000ull, 0x726f636b73000000ull, 0x726f64656f000000ull, 0x726f676572730000ull,
+    0x726f6f6d00000000ull, 0x7273000000000000ull, 0x7273767000000000ull, 0x7275000000000000ull,
+    0x7275676279000000ull, 0x7275687200000000ull, 0x72756e0000000000ull, 0x7277000000000000ull,
+    0x7277650000000000ull, 0x7279756b79750000ull, 0x7361000000000000ull, 0x736161726c616e64ull,
+    0x7361666500000000ull, 0x7361666574790000ull, 0x73616b7572610000ull, 0x73616c6500000000ull,
+    0x73616c6f6e000000ull, 0x73616d73636c7562ull, 0x73616d73756e6700ull, 0x73616e6476696b00ull,
+    0x73616e6476696b63ull, 0x73616e6f66690000ull, 0x7361700000000000ull, 0x7361726c00000000ull,
+    0x7361730000000000ull, 0x7361766500000000ull, 0x7361786f00000000ull, 0x7362000000000000ull,
+    0x7362690000000000ull, 0x7362730000000000ull, 0x7363000000000000ull, 0x7363610000000000ull,
+    0x7363620000000000ull, 0x736368616566666cull, 0x7363686d69647400ull, 0x7363686f6c617273ull,
+    0x7363686f6f6c0000ull, 0x736368756c650000ull, 0x7363687761727a00ull, 0x736369656e636500ull,
+    0x73636f7400000000ull, 0x7364000000000000ull, 0x7365000000000000ull, 0x7365617263680000ull,
+    0x7365617400000000ull, 0x7365637572650000ull, 0x7365637572697479ull, 0x7365656b00000000ull,
+    0x73656c6563740000ull, 0x73656e6572000000ull, 0x7365727669636573ull, 0x736576656e000000ull,
+    0x7365770000000000ull, 0x7365780000000000ull, 0x7365787900000000ull, 0x7366720000000000ull,
+    0x7367000000000000ull, 0x7368000000000000ull, 0x7368616e6772696cull, 0x7368617270000000ull,
+    0x7368617700000000ull, 0x7368656c6c000000ull, 0x7368696100000000ull, 0x7368696b73686100ull,
+    0x73686f6573000000ull, 0x73686f7000000000ull, 0x73686f7070696e67ull, 0x73686f756a690000ull,
+    0x73686f7700000000ull, 0x73686f7774696d65ull, 0x7369000000000000ull, 0x73696c6b00000000ull,
+    0x73696e6100000000ull, 0x73696e676c657300ull, 0x7369746500000000ull, 0x736a000000000000ull,
+    0x736b000000000000ull, 0x736b690000000000ull, 0x736b696e00000000ull, 0x736b790000000000ull,
+    0x736b797065000000ull, 0x736c000000000000ull, 0x736c696e67000000ull, 0x736d000000000000ull,
+    0x736d617274000000ull, 0x736d696c65000000ull, 0x736e000000000000ull, 0x736e636600000000ull,
+    0x736f000000000000ull, 0x736f636365720000ull, 0x736f6369616c0000ull, 0x736f667462616e6bull,
+    0x736f667477617265ull, 0x736f687500000000ull, 0x736f6c6172000000ull, 0x736f6c7574696f6eull,
+    0x736f6e6700000000ull, 0x736f6e7900000000ull, 0x736f790000000000ull, 0x7370610000000000ull,
+    0x7370616365000000ull, 0x73706f7274000000ull, 0x73706f7400000000ull, 0x7372000000000000ull,
+    0x73726c0000000000ull, 0x7373000000000000ull, 0x7374000000000000ull, 0x7374616461000000ull,
+    0x737461706c657300ull, 0x7374617200000000ull, 0x737461746562616eull, 0x7374617465666172ull,
+    0x7374630000000000ull, 0x73746367726f7570ull, 0x73746f636b686f6cull, 0x73746f7261676500ull,
+    0x73746f7265000000ull, 0x73747265616d0000ull, 0x73747564696f0000ull, 0x7374756479000000ull,
+    0x7374796c65000000ull, 0x7375000000000000ull, 0x7375636b73000000ull, 0x737570706c696573ull,
+    0x737570706c790000ull, 0x737570706f727400ull, 0x7375726600000000ull, 0x7375726765727900ull,
+    0x73757a756b690000ull, 0x7376000000000000ull, 0x7377617463680000ull, 0x7377697373000000ull,
+    0x7378000000000000ull, 0x7379000000000000ull, 0x7379646e65790000ull, 0x73797374656d7300ull,
+    0x737a000000000000ull, 0x7461620000000000ull, 0x7461697065690000ull, 0x74616c6b00000000ull,
+    0x74616f62616f0000ull, 0x7461726765740000ull, 0x746174616d6f746full, 0x7461746172000000ull,
+    0x746174746f6f0000ull, 0x7461780000000000ull, 0x7461786900000000ull, 0x7463000000000000ull,
+    0x7463690000000000ull, 0x7464000000000000ull, 0x74646b0000000000ull, 0x7465616d00000000ull,
+    0x7465636800000000ull, 0x746563686e6f6c6full, 0x74656c0000000000ull, 0x74656d6173656b00ull,
+    0x74656e6e69730000ull, 0x7465766100000000ull, 0x7466000000000000ull, 0x7467000000000000ull,
+    0x7468000000000000ull, 0x7468640000000000ull, 0x7468656174657200ull, 0x7468656174726500ull,
+    0x7469616100000000ull, 0x7469636b65747300ull, 0x7469656e64610000ull, 0x74696666616e7900ull,
+    0x7469707300000000ull, 0x7469726573000000ull, 0x7469726f6c000000ull, 0x746a000000000000ull,
+    0x746a6d6178780000ull, 0x746a780000000000ull, 0x746b000000000000ull, 0x746b6d6178780000ull,
+    0x746c000000000000ull, 0x746d000000000000ull, 0x746d616c6c000000ull, 0x746e000000000000ull,
+    0x746f000000000000ull, 0x746f646179000000ull, 0x746f6b796f000000ull, 0x746f6f6c73000000ull,
+    0x746f700000000000ull, 0x746f726179000000ull, 0x746f736869626100ull, 0x746f74616c000000ull,
+    0x746f757273000000ull, 0x746f776e00000000ull, 0x746f796f74610000ull, 0x746f797300000000ull,
+    0x7472000000000000ull, 0x7472616465000000ull, 0x74726164696e6700ull, 0x747261696e696e67ull,
+    0x74726176656c0000ull, 0x74726176656c6368ull, 0x74726176656c6572ull, 0x74726176656c6572ull,
+    0x7472757374000000ull, 0x7472760000000000ull, 0x7474000000000000ull, 0x7475626500000000ull,
+    0x7475690000000000ull, 0x74756e6573000000ull, 0x7475736875000000ull, 0x7476000000000000ull,
+    0x7476730000000000ull, 0x7477000000000000ull, 0x747a000000000000ull, 0x7561000000000000ull,
+    0x7562616e6b000000ull, 0x7562730000000000ull, 0x7567000000000000ull, 0x756b000000000000ull,
+    0x756e69636f6d0000ull, 0x756e697665727369ull, 0x756e6f0000000000ull, 0x756f6c0000000000ull,
+    0x7570730000000000ull, 0x7573000000000000ull, 0x7579000000000000ull, 0x757a000000000000ull,
+    0x7661000000000000ull, 0x7661636174696f6eull, 0x76616e6100000000ull, 0x76616e6775617264ull,
+    0x7663000000000000ull, 0x7665000000000000ull, 0x7665676173000000ull, 0x76656e7475726573ull,
+    0x766572697369676eull, 0x7665726dc3b66765ull, 0x7665726dc3b66765ull, 0x7665727369636865ull,
+    0x7665740000000000ull, 0x7667000000000000ull, 0x7669000000000000ull, 0x7669616a65730000ull,
+    0x766964656f000000ull, 0x7669670000000000ull, 0x76696b696e670000ull, 0x76696c6c61730000ull,
+    0x76696e0000000000ull, 0x7669700000000000ull, 0x76697267696e0000ull, 0x7669736100000000ull,
+    0x766973696f6e0000ull, 0x7669766100000000ull, 0x7669766f00000000ull, 0x766c61616e646572ull,
+    0x766e000000000000ull, 0x766f646b61000000ull, 0x766f6c6b73776167ull, 0x766f6c766f000000ull,
+    0x766f746500000000ull, 0x766f74696e670000ull, 0x766f746f00000000ull, 0x766f796167650000ull,
+    0x7675000000000000ull, 0x7675656c6f730000ull, 0x77616c6573000000ull, 0x77616c6d61727400ull,
+    0x77616c7465720000ull, 0x77616e6700000000ull, 0x77616e67676f7500ull, 0x7761746368000000ull,
+    0x7761746368657300ull, 0x7765617468657200ull, 0x7765617468657263ull, 0x77656263616d0000ull,
+    0x7765626572000000ull, 0x7765627369746500ull, 0x77656464696e6700ull, 0x776569626f000000ull,
+    0x7765697200000000ull, 0x7766000000000000ull, 0x77686f7377686f00ull, 0x7769656e00000000ull,
+    0x77696b6900000000ull, 0x77696c6c69616d68ull, 0x77696e0000000000ull, 0x77696e646f777300ull,
+    0x77696e6500000000ull, 0x77696e6e65727300ull, 0x776d650000000000ull, 0x776f6c746572736bull,
+    0x776f6f6473696465ull, 0x776f726b00000000ull, 0x776f726b73000000ull, 0x776f726c64000000ull,
+    0x776f770000000000ull, 0x7773000000000000ull, 0x7774630000000000ull, 0x7774660000000000ull,
+    0x78626f7800000000ull, 0x7865726f78000000ull, 0x7866696e69747900ull, 0x78696875616e0000ull,
+    0x78696e0000000000ull, 0x786e2d2d31316234ull, 0x786e2d2d31636b32ull, 0x786e2d2d31717177ull,
+    0x786e2d2d32736372ull, 0x786e2d2d33307272ull, 0x786e2d2d33627374ull, 0x786e2d2d33647334ull,
+    0x786e2d2d33653062ull, 0x786e2d2d33686372ull, 0x786e2d2d33707875ull, 0x786e2d2d34326332ull,
+    0x786e2d2d34356272ull, 0x786e2d2d34356272ull, 0x786e2d2d34357131ull, 0x786e2d2d34646272ull,
+    0x786e2d2d34676272ull, 0x786e2d2d35346237ull, 0x786e2d2d35357177ull, 0x786e2d2d35357178ull,
+    0x786e2d2d35737533ull, 0x786e2d2d35747a6dull, 0x786e2d2d3666727aull, 0x786e2d2d36717139ull,
+    0x786e2d2d38306164ull, 0x786e2d2d3830616full, 0x786e2d2d38306171ull, 0x786e2d2d38306173ull,
+    0x786e2d2d38306173ull, 0x786e2d2d38793061ull, 0x786e2d2d39306133ull, 0x786e2d2d39306165ull,
+    0x786e2d2d39306169ull, 0x786e2d2d39646271ull, 0x786e2d2d39657435ull, 0x786e2d2d396b7274ull,
+    0x786e2d2d62347736ull, 0x786e2d2d62636b31ull, 0x786e2d2d63316176ull, 0x786e2d2d63326272ull,
+    0x786e2d2d63636b32ull, 0x786e2d2d63636b77ull, 0x786e2d2d63673462ull, 0x786e2d2d636c6368ull,
+    0x786e2d2d637a7236ull, 0x786e2d2d637a7273ull, 0x786e2d2d637a7275ull, 0x786e2d2d64316163ull,
+    0x786e2d2d6431616cull, 0x786e2d2d65316134ull, 0x786e2d2d65636b76ull, 0x786e2d2d65667679ull,
+    0x786e2d2d66637434ull, 0x786e2d2d66686265ull, 0x786e2d2d66697132ull, 0x786e2d2d66697136ull,
+    0x786e2d2d66697173ull, 0x786e2d2d6669717aull, 0x786e2d2d666a7137ull, 0x786e2d2d666c7733ull,
+    0x786e2d2d66706372ull, 0x786e2d2d667a6332ull, 0x786e2d2d667a7973ull, 0x786e2d2d67327878ull,
+    0x786e2d2d67636b72ull, 0x786e2d2d67656372ull, 0x786e2d2d676b3361ull, 0x786e2d2d68326272ull,
+    0x786e2d2d68326272ull, 0x786e2d2d68326272ull, 0x786e2d2d68787438ull, 0x786e2d2d69316236ull,
+    0x786e2d2d696d7235ull, 0x786e2d2d696f3061ull, 0x786e2d2d6a316165ull, 0x786e2d2d6a31616dull,
+    0x786e2d2d6a367731ull, 0x786e2d2d6a6c7134ull, 0x786e2d2d6a767231ull, 0x786e2d2d6b637278ull,
+    0x786e2d2d6b707277ull, 0x786e2d2d6b707279ull, 0x786e2d2d6b707574ull, 0x786e2d2d6c316163ull,
+    0x786e2d2d6c676262ull, 0x786e2d2d6d676232ull, 0x786e2d2d6d676239ull, 0x786e2d2d6d676261ull,
+    0x786e2d2d6d676261ull, 0x786e2d2d6d676261ull, 0x786e2d2d6d676261ull, 0x786e2d2d6d676261ull,
+    0x786e2d2d6d676261ull, 0x786e2d2d6d676261ull, 0x786e2d2d6d676261ull, 0x786e2d2d6d676261ull,
+    0x786e2d2d6d676261ull, 0x786e2d2d6d676261ull, 0x786e2d2d6d676262ull, 0x786e2d2d6d676262ull,
+    0x786e2d2d6d676263ull, 0x786e2d2d6d676263ull, 0x786e2d2d6d676263ull, 0x786e2d2d6d676265ull,
+    0x786e2d2d6d676265ull, 0x786e2d2d6d676267ull, 0x786e2d2d6d676269ull, 0x786e2d2d6d676270ull,
+    0x786e2d2d6d676271ull, 0x786e2d2d6d676271ull, 0x786e2d2d6d676274ull, 0x786e2d2d6d676274ull,
+    0x786e2d2d6d676274ull, 0x786e2d2d6d676278ull, 0x786e2d2d6d697830ull, 0x786e2d2d6d697838ull,
+    0x786e2d2d6d6b3162ull, 0x786e2d2d6d787471ull, 0x786e2d2d6e676263ull, 0x786e2d2d6e676265ull,
+    0x786e2d2d6e676272ull, 0x786e2d2d6e6e7833ull, 0x786e2d2d6e6f6465ull, 0x786e2d2d6e717637ull,
+    0x786e2d2d6e717637ull, 0x786e2d2d6e797179ull, 0x786e2d2d6f336377ull, 0x786e2d2d6f676270ull,
+    0x786e2d2d6f747537ull, 0x786e2d2d70316163ull, 0x786e2d2d70316169ull, 0x786e2d2d70676273ull,
+    0x786e2d2d70737379ull, 0x786e2d2d71376365ull, 0x786e2d2d71396a79ull, 0x786e2d2d71636b61ull,
+    0x786e2d2d71786136ull, 0x786e2d2d7178616dull, 0x786e2d2d72687176ull, 0x786e2d2d726f7675ull,
+    0x786e2d2d72766331ull, 0x786e2d2d73396272ull, 0x786e2d2d73657335ull, 0x786e2d2d74363062ull,
+    0x786e2d2d74636b77ull, 0x786e2d2d74697134ull, 0x786e2d2d756e7570ull, 0x786e2d2d7665726dull,
+    0x786e2d2d7665726dull, 0x786e2d2d76687175ull, 0x786e2d2d76757138ull, 0x786e2d2d77347238ull,
+    0x786e2d2d77347273ull, 0x786e2d2d77676268ull, 0x786e2d2d7767626cull, 0x786e2d2d78687135ull,
+    0x786e2d2d786b6332ull, 0x786e2d2d786b6332ull, 0x786e2d2d79396133ull, 0x786e2d2d7966726full,
+    0x786e2d2d79676269ull, 0x786e2d2d7a667231ull, 0x7878780000000000ull, 0x78797a0000000000ull,
+    0x7961636874730000ull, 0x7961686f6f000000ull, 0x79616d6178756e00ull, 0x79616e6465780000ull,
+    0x7965000000000000ull, 0x796f646f62617368ull, 0x796f676100000000ull, 0x796f6b6f68616d61ull,
+    0x796f750000000000ull, 0x796f757475626500ull, 0x7974000000000000ull, 0x79756e0000000000ull,
+    0x7a61000000000000ull, 0x7a6170706f730000ull, 0x7a61726100000000ull, 0x7a65726f00000000ull,
+    0x7a69700000000000ull, 0x7a6d000000000000ull, 0x7a6f6e6500000000ull, 0x7a75657269636800ull,
+    0x7a77000000000000ull, 0xceb5cebb00000000ull, 0xceb5cf8500000000ull, 0xd0b1d0b300000000ull,
+    0xd0b1d0b5d0bb0000ull, 0xd0b4d0b5d182d0b8ull, 0xd0b5d18e00000000ull, 0xd0bad0b0d182d0beull,
+    0xd0bad0bed0bc0000ull, 0xd0bcd0bad0b40000ull, 0xd0bcd0bed0bd0000ull, 0xd0bcd0bed181d0baull,
+    0xd0bed0bdd0bbd0b0ull, 0xd0bed180d0b30000ull, 0xd180d183d1810000ull, 0xd180d18400000000ull,
+    0xd181d0b0d0b9d182ull, 0xd181d180d0b10000ull, 0xd183d0bad1800000ull, 0xd29bd0b0d0b70000ull,
+    0xd5b0d5a1d5b50000ull, 0xd799d7a9d7a8d790ull, 0xd7a7d795d79d0000ull, 0xd8a7d8a8d988d8b8ull,
+    0xd8a7d8aad8b5d8a7ull, 0xd8a7d8b1d8a7d985ull, 0xd8a7d984d8a7d8b1ull, 0xd8a7d984d8a8d8adull,
+    0xd8a7d984d8acd8b2ull, 0xd8a7d984d8b3d8b9ull, 0xd8a7d984d8b3d8b9ull, 0xd8a7d984d8b3d8b9ull,
+    0xd8a7d984d8b3d8b9ull, 0xd8a7d984d8b9d984ull, 0xd8a7d984d985d8baull, 0xd8a7d984d98ad985ull,
+    0xd8a7d985d8a7d8b1ull, 0xd8a7d98ad8b1d8a7ull, 0xd8a7db8cd8b1d8a7ull, 0xd8a8d8a7d8b1d8aaull,
+    0xd8a8d8a7d8b2d8a7ull, 0xd8a8d98ad8aad983ull, 0xd8a8dabed8a7d8b1ull, 0xd8aad988d986d8b3ull,
+    0xd8b3d988d8afd8a7ull, 0xd8b3d988d8b1d98aull, 0xd8b3d988d8b1d98aull, 0xd8b4d8a8d983d8a9ull,
+    0xd8b9d8b1d8a7d982ull, 0xd8b9d8b1d8a80000ull, 0xd8b9d985d8a7d986ull, 0xd981d984d8b3d8b7ull,
+    0xd982d8b7d8b10000ull, 0xd983d8a7d8abd988ull, 0xd983d988d9850000ull, 0xd985d8b5d8b10000ull,
+    0xd985d984d98ad8b3ull, 0xd985d988d8b1d98aull, 0xd985d988d982d8b9ull, 0xd987d985d8b1d8a7ull,
+    0xd9bed8a7d983d8b3ull, 0xd9bed8a7daa9d8b3ull, 0xda80d8a7d8b1d8aaull, 0xe0a495e0a589e0a4ull,
+    0xe0a4a8e0a587e0a4ull, 0xe0a4ade0a4bee0a4ull, 0xe0a4ade0a4bee0a4ull, 0xe0a4ade0a4bee0a4ull,
+    0xe0a4b8e0a482e0a4ull, 0xe0a6ace0a6bee0a6ull, 0xe0a6ade0a6bee0a6ull, 0xe0a6ade0a6bee0a7ull,
+    0xe0a8ade0a8bee0a8ull, 0xe0aaade0aabee0aaull, 0xe0acade0acbee0acull, 0xe0ae87e0aea8e0afull,
+    0xe0ae87e0aeb2e0aeull, 0xe0ae9ae0aebfe0aeull, 0xe0b0ade0b0bee0b0ull, 0xe0b2ade0b2bee0b2ull,
+    0xe0b4ade0b4bee0b4ull, 0xe0b6bde0b682e0b6ull, 0xe0b884e0b8ade0b8ull, 0xe0b984e0b897e0b8ull,
+    0xe0baa5e0bab2e0baull, 0xe18392e183940000ull, 0xe381bfe38293e381ull, 0xe382a2e3839ee382ull,
+    0xe382afe383a9e382ull, 0xe382b0e383bce382ull, 0xe382b3e383a00000ull, 0xe382b9e38388e382ull,
+    0xe382bbe383bce383ull, 0xe38395e382a1e383ull, 0xe3839de382a4e383ull, 0xe4b896e7958c0000ull,
+    0xe4b8ade4bfa10000ull, 0xe4b8ade59bbd0000ull, 0xe4b8ade59c8b0000ull, 0xe4b8ade69687e7bdull,
+    0xe4ba9ae9a9ace980ull, 0xe4bc81e4b89a0000ull, 0xe4bd9be5b1b10000ull, 0xe4bfa1e681af0000ull,
+    0xe581a5e5bab70000ull, 0xe585abe58da60000ull, 0xe585ace58fb80000ull, 0xe585ace79b8a0000ull,
+    0xe58fb0e6b9be0000ull, 0xe58fb0e781a30000ull, 0xe59586e59f8e0000ull, 0xe59586e5ba970000ull,
+    0xe59586e6a0870000ull, 0xe59889e9878c0000ull, 0xe59889e9878ce5a4ull, 0xe59ca8e7babf0000ull,
+    0xe5a4a7e68bbf0000ull, 0xe5a4a9e4b8bbe695ull, 0xe5a8b1e4b9900000ull, 0xe5aeb6e99bbb0000ull,
+    0xe5b9bfe4b89c0000ull, 0xe5beaee58d9a0000ull, 0xe68588e596840000ull, 0xe68891e788b1e4bdull,
+    0xe6898be69cba0000ull, 0xe68b9be881980000ull, 0xe694bfe58aa10000ull, 0xe694bfe5ba9c0000ull,
+    0xe696b0e58aa0e59dull, 0xe696b0e997bb0000ull, 0xe697b6e5b09a0000ull, 0xe69bb8e7b18d0000ull,
+    0xe69cbae69e840000ull, 0xe6b7a1e9a9ace994ull, 0xe6b8b8e6888f0000ull, 0xe6beb3e996800000ull,
+    0xe6beb3e997a80000ull, 0xe782b9e79c8b0000ull, 0xe7a7bbe58aa80000ull, 0xe7bb84e7bb87e69cull,
+    0xe7bd91e59d800000ull, 0xe7bd91e5ba970000ull, 0xe7bd91e7ab990000ull, 0xe7bd91e7bb9c0000ull,
+    0xe88194e9809a0000ull, 0xe887bae781a30000ull, 0xe8b0b7e6ad8c0000ull, 0xe8b4ade789a90000ull,
+    0xe9809ae8b2a90000ull, 0xe99b86e59ba20000ull, 0xe99bbbe8a88ae79bull, 0xe9a39ee588a9e6b5ull,
+    0xe9a39fe593810000ull, 0xe9a490e58e850000ull, 0xe9a699e6a0bce987ull, 0xe9a699e6b8af0000ull,
+    0xeb8bb7eb84b70000ull, 0xeb8bb7ecbbb40000ull, 0xec82bcec84b10000ull, 0xed959ceab5ad0000ull,
+    0x636f6d0000000000ull, 0x6472720000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x6f6666696369616cull,
+    0x6e6f6d0000000000ull, 0x6163000000000000ull, 0x626c6f6773706f74ull, 0x636f000000000000ull,
+    0x676f760000000000ull, 0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x7363680000000000ull, 0x6163636964656e74ull, 0x6163636964656e74ull, 0x6165726f62617469ull,
+    0x6165726f636c7562ull, 0x6165726f64726f6dull, 0x6167656e74730000ull, 0x6169722d73757276ull,
+    0x6169722d74726166ull, 0x6169726372616674ull, 0x6169726c696e6500ull, 0x616972706f727400ull,
+    0x6169727472616666ull, 0x616d62756c616e63ull, 0x616d7573656d656eull, 0x6173736f63696174ull,
+    0x617574686f720000ull, 0x62616c6c6f6f6e69ull, 0x62726f6b65720000ull, 0x6361610000000000ull,
+    0x636172676f000000ull, 0x6361746572696e67ull, 0x6365727469666963ull, 0x6368616d70696f6eull,
+    0x6368617274657200ull, 0x636976696c617669ull, 0x636c756200000000ull, 0x636f6e666572656eull,
+    0x636f6e73756c7461ull, 0x636f6e73756c7469ull, 0x636f6e74726f6c00ull, 0x636f756e63696c00ull,
+    0x6372657700000000ull, 0x64657369676e0000ull, 0x6467636100000000ull, 0x6564756361746f72ull,
+    0x656d657267656e63ull, 0x656e67696e650000ull, 0x656e67696e656572ull, 0x656e746572746169ull,
+    0x65717569706d656eull, 0x65786368616e6765ull, 0x6578707265737300ull, 0x6665646572617469ull,
+    0x666c696768740000ull, 0x6675656c00000000ull, 0x676c6964696e6700ull, 0x676f7665726e6d65ull,
+    0x67726f756e646861ull, 0x67726f7570000000ull, 0x68616e67676c6964ull, 0x686f6d656275696cull,
+    0x696e737572616e63ull, 0x6a6f75726e616c00ull, 0x6a6f75726e616c69ull, 0x6c656173696e6700ull,
+    0x6c6f676973746963ull, 0x6d6167617a696e65ull, 0x6d61696e74656e61ull, 0x6d65646961000000ull,
+    0x6d6963726f6c6967ull, 0x6d6f64656c6c696eull, 0x6e61766967617469ull, 0x7061726163687574ull,
+    0x70617261676c6964ull, 0x70617373656e6765ull, 0x70696c6f74000000ull, 0x7072657373000000ull,
+    0x70726f6475637469ull, 0x7265637265617469ull, 0x726570626f647900ull, 0x7265730000000000ull,
+    0x7265736561726368ull, 0x726f746f72637261ull, 0x7361666574790000ull, 0x736369656e746973ull,
+    0x7365727669636573ull, 0x73686f7700000000ull, 0x736b79646976696eull, 0x736f667477617265ull,
+    0x73747564656e7400ull, 0x7472616465720000ull, 0x74726164696e6700ull, 0x747261696e657200ull,
+    0x756e696f6e000000ull, 0x776f726b696e6767ull, 0x776f726b73000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x636f000000000000ull, 0x636f6d0000000000ull, 0x6e65740000000000ull, 0x6e6f6d0000000000ull,
+    0x6f72670000000000ull, 0x636f6d0000000000ull, 0x6e65740000000000ull, 0x6f66660000000000ull,
+    0x6f72670000000000ull, 0x7577750000000000ull, 0x626c6f6773706f74ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x6d696c0000000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x626c6f6773706f74ull, 0x636f000000000000ull, 0x636f6d0000000000ull,
+    0x636f6d6d756e6500ull, 0x6e656b6f00000000ull, 0x6e65740000000000ull, 0x6e79616100000000ull,
+    0x6f72670000000000ull, 0x726164696f000000ull, 0x636f000000000000ull, 0x6564000000000000ull,
+    0x6776000000000000ull, 0x6974000000000000ull, 0x6f67000000000000ull, 0x7062000000000000ull,
+    0x6265676574000000ull, 0x626f6f6b6f6e6c69ull, 0x636c65726b000000ull, 0x636c65726b737461ull,
+    0x6465746100000000ull, 0x646576656c6f7065ull, 0x6561737970616e65ull, 0x65646765636f6d70ull,
+    0x656e637200000000ull, 0x6669726577656200ull, 0x6672616d65720000ull, 0x6861737572610000ull,
+    0x6c6f67696e6c696eull, 0x6d65737365726c69ull, 0x6e65746c69667900ull, 0x6e6f6f7000000000ull,
+    0x6e6f727468666c61ull, 0x6f6e646967697461ull, 0x6f6e666c61736864ull, 0x706c6174666f726dull,
+    0x72756e0000000000ull, 0x736e6f77666c616bull, 0x73747265616d6c69ull, 0x74656c6562697400ull,
+    0x7479706564726561ull, 0x76657263656c0000ull, 0x7765620000000000ull, 0x776e657874000000ull,
+    0x6265740000000000ull, 0x636f6d0000000000ull, 0x636f6f7000000000ull, 0x6564750000000000ull,
+    0x676f620000000000ull, 0x676f760000000000ull, 0x696e740000000000ull, 0x6d696c0000000000ull,
+    0x6d75736963610000ull, 0x6d757475616c0000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x73656e6173610000ull, 0x7475720000000000ull, 0x6531363400000000ull, 0x696e2d6164647200ull,
+    0x6970360000000000ull, 0x6972697300000000ull, 0x7572690000000000ull, 0x75726e0000000000ull,
+    0x676f760000000000ull, 0x636c6f75646e7300ull, 0x3132337765627365ull, 0x3132687000000000ull,
+    0x3269780000000000ull, 0x346c696d61000000ull, 0x6163000000000000ull, 0x62697a0000000000ull,
+    0x636f000000000000ull, 0x66756e6b66657565ull, 0x667574757265636dull, 0x667574757265686full,
+    0x6675747572656d61ull, 0x6776000000000000ull, 0x696e666f00000000ull, 0x6c696d612d636974ull,
+    0x6d79737072656164ull, 0x6f72000000000000ull, 0x6f727473696e666full, 0x7072697600000000ull,
+    0x6163740000000000ull, 0x61736e0000000000ull, 0x636f6d0000000000ull, 0x636f6e6600000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x6964000000000000ull, 0x696e666f00000000ull,
+    0x6e65740000000000ull, 0x6e73770000000000ull, 0x6e74000000000000ull, 0x6f72670000000000ull,
+    0x6f7a000000000000ull, 0x716c640000000000ull, 0x7361000000000000ull, 0x7461730000000000ull,
+    0x7669630000000000ull, 0x7761000000000000ull, 0x636f6d0000000000ull, 0x6265000000000000ull,
+    0x6361740000000000ull, 0x6573000000000000ull, 0x6575000000000000ull, 0x6767000000000000ull,
+    0x6d63000000000000ull, 0x7573000000000000ull, 0x7879000000000000ull, 0x62697a0000000000ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x696e666f00000000ull,
+    0x696e740000000000ull, 0x6d696c0000000000ull, 0x6e616d6500000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x7070000000000000ull, 0x70726f0000000000ull, 0x626c6f6773706f74ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x6d696c0000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x7273000000000000ull, 0x6175730000000000ull,
+    0x6e7a000000000000ull, 0x62697a0000000000ull, 0x636f000000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x696e666f00000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x73746f7265000000ull, 0x7476000000000000ull, 0x3132337765627369ull,
+    0x6163000000000000ull, 0x626c6f6773706f74ull, 0x696e746572686f73ull, 0x6b756c657576656eull,
+    0x6d79737072656164ull, 0x7472616e7375726cull, 0x776562686f737469ull, 0x676f760000000000ull,
+    0x3000000000000000ull, 0x3100000000000000ull, 0x3200000000000000ull, 0x3300000000000000ull,
+    0x3400000000000000ull, 0x3500000000000000ull, 0x3600000000000000ull, 0x3700000000000000ull,
+    0x3800000000000000ull, 0x3900000000000000ull, 0x6100000000000000ull, 0x6200000000000000ull,
+    0x6261727379000000ull, 0x626c6f6773706f74ull, 0x6300000000000000ull, 0x6400000000000000ull,
+    0x6500000000000000ull, 0x6600000000000000ull, 0x6700000000000000ull, 0x6800000000000000ull,
+    0x6900000000000000ull, 0x6a00000000000000ull, 0x6b00000000000000ull, 0x6c00000000000000ull,
+    0x6d00000000000000ull, 0x6e00000000000000ull, 0x6f00000000000000ull, 0x7000000000000000ull,
+    0x7100000000000000ull, 0x7200000000000000ull, 0x7300000000000000ull, 0x7400000000000000ull,
+    0x7500000000000000ull, 0x7600000000000000ull, 0x7700000000000000ull, 0x7800000000000000ull,
+    0x7900000000000000ull, 0x7a00000000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x636f000000000000ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x6f72000000000000ull, 0x6f72670000000000ull,
+    0x6163746976657472ull, 0x636c6f75646e7300ull, 0x6473636c6f756400ull, 0x64796e646e730000ull,
+    0x666f722d62657474ull, 0x666f722d6d6f7265ull, 0x666f722d736f6d65ull, 0x666f722d74686500ull,
+    0x6a6f7a6900000000ull, 0x6d6d6166616e0000ull, 0x6d79667470000000ull, 0x6e6f2d6970000000ull,
+    0x6f72780000000000ull, 0x73656c6669700000ull, 0x776562686f700000ull, 0x6166726963610000ull,
+    0x6167726f00000000ull, 0x6172636869746563ull, 0x6173737572000000ull, 0x61766f6361747300ull,
+    0x626c6f6773706f74ull, 0x636f000000000000ull, 0x636f6d0000000000ull, 0x65636f0000000000ull,
+    0x65636f6e6f000000ull, 0x6564750000000000ull, 0x696e666f00000000ull, 0x6c6f697369727300ull,
+    0x6d6f6e6579000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x6f74650000000000ull,
+    0x7265737461757261ull, 0x726573746f000000ull, 0x746f757269736d00ull, 0x756e697600000000ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x636f000000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x61636164656d6961ull,
+    0x6167726f00000000ull, 0x6172746500000000ull, 0x626c6f6700000000ull, 0x626f6c6976696100ull,
+    0x6369656e63696100ull, 0x636f6d0000000000ull, 0x636f6f7065726174ull, 0x64656d6f63726163ull,
+    0x6465706f72746500ull, 0x65636f6c6f676961ull, 0x65636f6e6f6d6961ull, 0x6564750000000000ull,
+    0x656d707265736100ull, 0x676f620000000000ull, 0x696e646967656e61ull, 0x696e647573747269ull,
+    0x696e666f00000000ull, 0x696e740000000000ull, 0x6d65646963696e61ull, 0x6d696c0000000000ull,
+    0x6d6f76696d69656eull, 0x6d75736963610000ull, 0x6e61747572616c00ull, 0x6e65740000000000ull,
+    0x6e6f6d6272650000ull, 0x6e6f746963696173ull, 0x6f72670000000000ull, 0x7061747269610000ull,
+    0x706c7572696e6163ull, 0x706f6c6974696361ull, 0x70726f666573696full, 0x707565626c6f0000ull,
+    0x7265766973746100ull, 0x73616c7564000000ull, 0x7465636e6f6c6f67ull, 0x746b736174000000ull,
+    0x7472616e73706f72ull, 0x7476000000000000ull, 0x7765620000000000ull, 0x77696b6900000000ull,
+    0x3967756163750000ull, 0x6162630000000000ull, 0x61646d0000000000ull, 0x6164760000000000ull,
+    0x6167720000000000ull, 0x616a750000000000ull, 0x616d000000000000ull, 0x616e616e69000000ull,
+    0x6170617265636964ull, 0x6170700000000000ull, 0x6172710000000000ull, 0x6172740000000000ull,
+    0x61746f0000000000ull, 0x6200000000000000ull, 0x6261727565726900ull, 0x62656c656d000000ull,
+    0x62687a0000000000ull, 0x6269620000000000ull, 0x62696f0000000000ull, 0x626c6f6700000000ull,
+    0x626d640000000000ull, 0x626f617669737461ull, 0x6273620000000000ull, 0x63616d70696e6167ull,
+    0x63616d70696e6173ull, 0x6361786961730000ull, 0x63696d0000000000ull, 0x636e670000000000ull,
+    0x636e740000000000ull, 0x636f6d0000000000ull, 0x636f6e746167656dull, 0x636f6f7000000000ull,
+    0x636f7a0000000000ull, 0x6372690000000000ull, 0x6375696162610000ull, 0x6375726974696261ull,
+    0x6465660000000000ull, 0x6465730000000000ull, 0x6465740000000000ull, 0x6465760000000000ull,
+    0x65636e0000000000ull, 0x65636f0000000000ull, 0x6564750000000000ull, 0x656d700000000000ull,
+    0x656e660000000000ull, 0x656e670000000000ull, 0x6573700000000000ull, 0x6574630000000000ull,
+    0x6574690000000000ull, 0x6661720000000000ull, 0x6665697261000000ull, 0x666c6f6700000000ull,
+    0x666c6f7269706100ull, 0x666d000000000000ull, 0x666e640000000000ull, 0x666f7274616c0000ull,
+    0x666f740000000000ull, 0x666f7a0000000000ull, 0x6673740000000000ull, 0x6731320000000000ull,
+    0x67656f0000000000ull, 0x6767660000000000ull, 0x676f69616e696100ull, 0x676f760000000000ull,
+    0x6772750000000000ull, 0x696d620000000000ull, 0x696e640000000000ull, 0x696e660000000000ull,
+    0x6a61620000000000ull, 0x6a616d7061000000ull, 0x6a64660000000000ull, 0x6a6f696e76696c6cull,
+    0x6a6f720000000000ull, 0x6a75730000000000ull, 0x6c65670000000000ull, 0x6c656c0000000000ull,
+    0x6c6f670000000000ull, 0x6c6f6e6472696e61ull, 0x6d61636170610000ull, 0x6d616365696f0000ull,
+    0x6d616e6175730000ull, 0x6d6172696e676100ull, 0x6d61740000000000ull, 0x6d65640000000000ull,
+    0x6d696c0000000000ull, 0x6d6f72656e610000ull, 0x6d70000000000000ull, 0x6d75730000000000ull,
+    0x6e6174616c000000ull, 0x6e65740000000000ull, 0x6e697465726f6900ull, 0x6e6f6d0000000000ull,
+    0x6e6f740000000000ull, 0x6e74720000000000ull, 0x6f646f0000000000ull, 0x6f6e670000000000ull,
+    0x6f72670000000000ull, 0x6f736173636f0000ull, 0x70616c6d61730000ull, 0x706f610000000000ull,
+    0x7070670000000000ull, 0x70726f0000000000ull, 0x7073630000000000ull, 0x7073690000000000ull,
+    0x7076680000000000ull, 0x71736c0000000000ull, 0x726164696f000000ull, 0x7265630000000000ull,
+    0x7265636966650000ull, 0x7265700000000000ull, 0x726962656972616full, 0x72696f0000000000ull,
+    0x72696f6272616e63ull, 0x72696f707265746full, 0x73616c7661646f72ull, 0x73616d7061000000ull,
+    0x73616e74616d6172ull, 0x73616e746f616e64ull, 0x73616f6265726e61ull, 0x73616f676f6e6361ull,
+    0x7365670000000000ull, 0x736a630000000000ull, 0x736c670000000000ull, 0x736c7a0000000000ull,
+    0x736f726f63616261ull, 0x7372760000000000ull, 0x7461786900000000ull, 0x7463000000000000ull,
+    0x7465630000000000ull, 0x74656f0000000000ull, 0x7468650000000000ull, 0x746d700000000000ull,
+    0x7472640000000000ull, 0x7475720000000000ull, 0x7476000000000000ull, 0x7564690000000000ull,
+    0x7665740000000000ull, 0x7669780000000000ull, 0x766c6f6700000000ull, 0x77696b6900000000ull,
+    0x7a6c670000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x7765000000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x636c6f7564736974ull, 0x636f000000000000ull, 0x636f000000000000ull, 0x6f72670000000000ull,
+    0x636f6d0000000000ull, 0x676f760000000000ull, 0x6d65646961746563ull, 0x6d696c0000000000ull,
+    0x6d79636c6f756400ull, 0x6f66000000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x67736a0000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x7a61000000000000ull, 0x6162000000000000ull, 0x6177646576000000ull, 0x6261727379000000ull,
+    0x6263000000000000ull, 0x626c6f6773706f74ull, 0x636f000000000000ull, 0x6763000000000000ull,
+    0x6d62000000000000ull, 0x6d79737072656164ull, 0x6e62000000000000ull, 0x6e66000000000000ull,
+    0x6e6c000000000000ull, 0x6e6f2d6970000000ull, 0x6e73000000000000ull, 0x6e74000000000000ull,
+    0x6e75000000000000ull, 0x6f6e000000000000ull, 0x7065000000000000ull, 0x7163000000000000ull,
+    0x736b000000000000ull, 0x796b000000000000ull, 0x6e61627500000000ull, 0x636c6f75646e7300ull,
+    0x6373780000000000ull, 0x66616e746173796cull, 0x6674706163636573ull, 0x67616d652d736572ull,
+    0x6d7970686f746f73ull, 0x736372617070696eull, 0x737061776e000000ull, 0x74776d61696c0000ull,
+    0x676f760000000000ull, 0x626c6f6773706f74ull, 0x3132337765627369ull, 0x3132687000000000ull,
+    0x3269780000000000ull, 0x346c696d61000000ull, 0x626c6f6773706f74ull, 0x646e736b696e6700ull,
+    0x666972656e657400ull, 0x666c6f7700000000ull, 0x676f74646e730000ull, 0x6c696d612d636974ull,
+    0x6c696e6b79617264ull, 0x6d79737072656164ull, 0x7371756172653700ull, 0x6163000000000000ull,
+    0x6173736f00000000ull, 0x61c3a9726f706f72ull, 0x636f000000000000ull, 0x636f6d0000000000ull,
+    0x6564000000000000ull, 0x6564750000000000ull, 0x66696e0000000000ull, 0x676f000000000000ull,
+    0x676f757600000000ull, 0x696e740000000000ull, 0x6d64000000000000ull, 0x6e65740000000000ull,
+    0x6e6c000000000000ull, 0x6f72000000000000ull, 0x6f72670000000000ull, 0x7072657373650000ull,
+    0x786e2d2d61726f70ull, 0x7777770000000000ull, 0x626c6f6773706f74ull, 0x636f000000000000ull,
+    0x676f620000000000ull, 0x676f760000000000ull, 0x6d696c0000000000ull, 0x617861726e657400ull,
+    0x62616e7a61690000ull, 0x64696164656d0000ull, 0x656c656d656e746full, 0x656e636f77617900ull,
+    0x6a656c6173746963ull, 0x6a656c6500000000ull, 0x6a656e762d617275ull, 0x6a6f74656c756c75ull,
+    0x6b656c6977656200ull, 0x6b756c657576656eull, 0x6c696e6b79617264ull, 0x6d6167656e746f73ull,
+    0x6f6e2d72616e6368ull, 0x6f78610000000000ull, 0x7065727370656374ull, 0x7072696d6574656cull,
+    0x726176656e646200ull, 0x7265636c61696d00ull, 0x7363770000000000ull, 0x73656e73696f7369ull,
+    0x7374617469637300ull, 0x7472616666696370ull, 0x7472656e64686f73ull, 0x75726f776e000000ull,
+    0x7661706f72000000ull, 0x766f6f726c6f7065ull, 0x6261727379000000ull, 0x636c6f75646e7300ull,
+    0x6a656c6500000000ull, 0x636f000000000000ull, 0x636f6d0000000000ull, 0x676f760000000000ull,
+    0x6e65740000000000ull, 0x6163000000000000ull, 0x6168000000000000ull, 0x626a000000000000ull,
+    0x63616e76612d6170ull, 0x636f6d0000000000ull, 0x6371000000000000ull, 0x6564750000000000ull,
+    0x666a000000000000ull, 0x6764000000000000ull, 0x676f760000000000ull, 0x6773000000000000ull,
+    0x6778000000000000ull, 0x677a000000000000ull, 0x6861000000000000ull, 0x6862000000000000ull,
+    0x6865000000000000ull, 0x6869000000000000ull, 0x686b000000000000ull, 0x686c000000000000ull,
+    0x686e000000000000ull, 0x696e7374616e7463ull, 0x6a6c000000000000ull, 0x6a73000000000000ull,
+    0x6a78000000000000ull, 0x6c6e000000000000ull, 0x6d696c0000000000ull, 0x6d6f000000000000ull,
+    0x6e65740000000000ull, 0x6e6d000000000000ull, 0x6e78000000000000ull, 0x6f72670000000000ull,
+    0x7168000000000000ull, 0x717569636b636f6eull, 0x7363000000000000ull, 0x7364000000000000ull,
+    0x7368000000000000ull, 0x736e000000000000ull, 0x7378000000000000ull, 0x746a000000000000ull,
+    0x7477000000000000ull, 0x786a000000000000ull, 0x786e2d2d35357178ull, 0x786e2d2d696f3061ull,
+    0x786e2d2d6f643061ull, 0x787a000000000000ull, 0x796e000000000000ull, 0x7a6a000000000000ull,
+    0xe585ace58fb80000ull, 0xe7b6b2e7b5a10000ull, 0xe7bd91e7bb9c0000ull, 0x6172747300000000ull,
+    0x6361727264000000ull, 0x636f6d0000000000ull, 0x6372640000000000ull, 0x6564750000000000ull,
+    0x6669726577616c6cull, 0x6669726d00000000ull, 0x676f760000000000ull, 0x696e666f00000000ull,
+    0x696e740000000000ull, 0x6c65616470616765ull, 0x6c70616765730000ull, 0x6d696c0000000000ull,
+    0x6d79706900000000ull, 0x6e34740000000000ull, 0x6e65740000000000ull, 0x6e6f6d0000000000ull,
+    0x6f72670000000000ull, 0x6f74617000000000ull, 0x7265630000000000ull, 0x7265706c00000000ull,
+    0x7375706162617365ull, 0x7765620000000000ull, 0x6f776f0000000000ull, 0x3030317777770000ull,
+    0x30656d6d00000000ull, 0x316b617070000000ull, 0x337574696c697469ull, 0x3475000000000000ull,
+    0x61646f626561656dull, 0x6166726963610000ull, 0x6169726b69746170ull, 0x6169726b69746170ull,
+    0x616976656e636c6full, 0x616c7068612d6d79ull, 0x616d617a6f6e6177ull, 0x616d73636f6d7075ull,
+    0x6170706368697a69ull, 0x6170706c696e7a69ull, 0x6170707370616365ull, 0x6170707370616365ull,
+    0x61707073706f7400ull, 0x6172000000000000ull, 0x6175746867656172ull, 0x6175746867656172ull,
+    0x617773676c6f6261ull, 0x6177736d70706c00ull, 0x62616c656e612d64ull, 0x626172737963656eull,
+    0x62617273796f6e6cull, 0x62657461696e6162ull, 0x626c6f67646e7300ull, 0x626c6f6773706f74ull,
+    0x626c6f6773797465ull, 0x626c6f78636d7300ull, 0x626f756e74792d66ull, 0x626f757469720000ull,
+    0x62706c6163656400ull, 0x6272000000000000ull, 0x6275696c74776974ull, 0x6361666a73000000ull,
+    0x63616e76612d6170ull, 0x6365636869726500ull, 0x63662d6970667300ull, 0x636973636f667265ull,
+    0x636c69636b657463ull, 0x636c6f7564636f6eull, 0x636c6f7564636f6eull, 0x636c6f7564666c61ull,
+    0x636e000000000000ull, 0x636f000000000000ull, 0x636f646500000000ull, 0x636f646573706f74ull,
+    0x637573746f6d6572ull, 0x64616d6e73657276ull, 0x6461746164657465ull, 0x646174746f6c6f63ull,
+    0x646174746f72656cull, 0x646174746f776562ull, 0x64646e7335000000ull, 0x64646e7366726565ull,
+    0x64646e736765656bull, 0x64646e736b696e67ull, 0x64646e736c697665ull, 0x6465000000000000ull,
+    0x6465762d6d79716eull, 0x64657663646e6163ull, 0x6469676974616c6full, 0x646973636f726473ull,
+    0x646973636f726473ull, 0x6469746368796f75ull, 0x646e73616c696173ull, 0x646e73646f6a6f00ull,
+    0x646e7369736b696eull, 0x646f65736e746578ull, 0x646f6e7465786973ull, 0x646f6f6d646e7300ull,
+    0x646f706161730000ull, 0x6472617964646e73ull, 0x647265616d686f73ull, 0x64736d796e617300ull,
+    0x64796e2d6f2d7361ull, 0x64796e616c696173ull, 0x64796e646e732d61ull, 0x64796e646e732d61ull,
+    0x64796e646e732d62ull, 0x64796e646e732d66ull, 0x64796e646e732d68ull, 0x64796e646e732d69ull,
+    0x64796e646e732d6dull, 0x64796e646e732d6full, 0x64796e646e732d70ull, 0x64796e646e732d72ull,
+    0x64796e646e732d73ull, 0x64796e646e732d77ull, 0x64796e646e732d77ull, 0x64796e646e732d77ull,
+    0x64796e6e73000000ull, 0x656c617374696362ull, 0x656e636f72656170ull, 0x6573742d612d6c61ull,
+    0x6573742d612d6c61ull, 0x6573742d6c652d70ull, 0x6573742d6d6f6e2dull, 0x6575000000000000ull,
+    0x6576656e6e6f6465ull, 0x66616d696c796473ull, 0x666173746c792d65ull, 0x666173746c792d74ull,
+    0x666173747670732dull, 0x6662736278000000ull, 0x6669726562617365ull, 0x6669726577616c6cull,
+    0x666c647276000000ull, 0x666f726765626c6full, 0x6672616d65726361ull, 0x66726565626f782dull,
+    0x66726565626f786full, 0x667265656d796970ull, 0x66726f6d2d616b00ull, 0x66726f6d2d616c00ull,
+    0x66726f6d2d617200ull, 0x66726f6d2d636100ull, 0x66726f6d2d637400ull, 0x66726f6d2d646300ull,
+    0x66726f6d2d646500ull, 0x66726f6d2d666c00ull, 0x66726f6d2d676100ull, 0x66726f6d2d686900ull,
+    0x66726f6d2d696100ull, 0x66726f6d2d696400ull, 0x66726f6d2d696c00ull, 0x66726f6d2d696e00ull,
+    0x66726f6d2d6b7300ull, 0x66726f6d2d6b7900ull, 0x66726f6d2d6d6100ull, 0x66726f6d2d6d6400ull,
+    0x66726f6d2d6d6900ull, 0x66726f6d2d6d6e00ull, 0x66726f6d2d6d6f00ull, 0x66726f6d2d6d7300ull,
+    0x66726f6d2d6d7400ull, 0x66726f6d2d6e6300ull, 0x66726f6d2d6e6400ull, 0x66726f6d2d6e6500ull,
+    0x66726f6d2d6e6800ull, 0x66726f6d2d6e6a00ull, 0x66726f6d2d6e6d00ull, 0x66726f6d2d6e7600ull,
+    0x66726f6d2d6f6800ull, 0x66726f6d2d6f6b00ull, 0x66726f6d2d6f7200ull, 0x66726f6d2d706100ull,
+    0x66726f6d2d707200ull, 0x66726f6d2d726900ull, 0x66726f6d2d736300ull, 0x66726f6d2d736400ull,
+    0x66726f6d2d746e00ull, 0x66726f6d2d747800ull, 0x66726f6d2d757400ull, 0x66726f6d2d766100ull,
+    0x66726f6d2d767400ull, 0x66726f6d2d776100ull, 0x66726f6d2d776900ull, 0x66726f6d2d777600ull,
+    0x66726f6d2d777900ull, 0x6765656b67616c61ull, 0x67656e7461707073ull, 0x67656e746c656e74ull,
+    0x6765746d79697000ull, 0x6769697a65000000ull, 0x6769746875627573ull, 0x676c65657a650000ull,
+    0x676f6f676c656170ull, 0x676f6f676c65636full, 0x676f74646e730000ull, 0x676f7470616e7468ull,
+    0x6772000000000000ull, 0x6865616c74682d63ull, 0x6865726f6b756170ull, 0x6865726f6b757373ull,
+    0x6869646f72610000ull, 0x686b000000000000ull, 0x686f6262792d7369ull, 0x686f6d656c696e75ull,
+    0x686f6d6573656375ull, 0x686f6d6573656375ull, 0x686f6d65756e6978ull, 0x686f737465642d62ull,
+    0x686f737465647069ull, 0x686f737465757200ull, 0x686f74656c776974ull, 0x6875000000000000ull,
+    0x69616d616c6c616dull, 0x696b2d7365727665ull, 0x696d706572747269ull, 0x696d706572747269ull,
+    0x69732d612d616e61ull, 0x69732d612d626c6full, 0x69732d612d626f6full, 0x69732d612d62756cull,
+    0x69732d612d636174ull, 0x69732d612d636865ull, 0x69732d612d636f6eull, 0x69732d612d637061ull,
+    0x69732d612d637562ull, 0x69732d612d64656dull, 0x69732d612d646573ull, 0x69732d612d646f63ull,
+    0x69732d612d66696eull, 0x69732d612d676565ull, 0x69732d612d677265ull, 0x69732d612d677572ull,
+    0x69732d612d686172ull, 0x69732d612d68756eull, 0x69732d612d6c616eull, 0x69732d612d6c6177ull,
+    0x69732d612d6c6962ull, 0x69732d612d6c6962ull, 0x69732d612d6c6c61ull, 0x69732d612d6d7573ull,
+    0x69732d612d6e6173ull, 0x69732d612d6e7572ull, 0x69732d612d706169ull, 0x69732d612d706572ull,
+    0x69732d612d70686full, 0x69732d612d706c61ull, 0x69732d612d726570ull, 0x69732d612d726f63ull,
+    0x69732d612d736f63ull, 0x69732d612d737475ull, 0x69732d612d746561ull, 0x69732d612d746563ull,
+    0x69732d612d746865ull, 0x69732d616e2d6163ull, 0x69732d616e2d6163ull, 0x69732d616e2d6163ull,
+    0x69732d616e2d616eull, 0x69732d616e2d6172ull, 0x69732d616e2d656eull, 0x69732d616e2d656eull,
+    0x69732d6365727469ull, 0x69732d676f6e6500ull, 0x69732d696e746f2dull, 0x69732d696e746f2dull,
+    0x69732d696e746f2dull, 0x69732d696e746f2dull, 0x69732d6c65657400ull, 0x69732d6e6f742d63ull,
+    0x69732d736c69636bull, 0x69732d756265726cull, 0x69732d776974682dull, 0x6973612d6765656bull,
+    0x6973612d686f636bull, 0x6973736d61727465ull, 0x6974000000000000ull, 0x6a646576636c6f75ull,
+    0x6a656c6173746963ull, 0x6a6f79656e740000ull, 0x6a706e0000000000ull, 0x6b61737365727665ull,
+    0x6b696c617469726full, 0x6b6f7a6f77000000ull, 0x6b72000000000000ull, 0x6b746973746f7279ull,
+    0x6c696b65732d7069ull, 0x6c696b657363616eull, 0x6c696e6f64650000ull, 0x6c696e6f64656f62ull,
+    0x6c696e6f64657573ull, 0x6c6d706d00000000ull, 0x6c6f676f69700000ull, 0x6c6f7365796f7572ull,
+    0x6c7075736572636full, 0x6d61737369766567ull, 0x6d617a65706c6179ull, 0x6d65737377697468ull,
+    0x6d6574656f726170ull, 0x6d65780000000000ull, 0x6d696e6973657276ull, 0x6d79616374697665ull,
+    0x6d7961737573746full, 0x6d79646174746f00ull, 0x6d79646f62697373ull, 0x6d7964726f626f00ull,
+    0x6d796970686f7374ull, 0x6d79716e6170636cull, 0x6d79736563757269ull, 0x6d7973686f70626cull,
+    0x6d7973686f706966ull, 0x6d79737072656164ull, 0x6d79746162697400ull, 0x6d79746869632d62ull,
+    0x6d7974756c656170ull, 0x6d79766e63000000ull, 0x6e6561742d75726cull, 0x6e65742d66726561ull,
+    0x6e6673686f737400ull, 0x6e6f000000000000ull, 0x6e6f7370616d7072ull, 0x6f62736572766162ull,
+    0x6f6e2d6170746962ull, 0x6f6e666162726963ull, 0x6f6e72656e646572ull, 0x6f6e746865776966ull,
+    0x6f6f677579000000ull, 0x6f70657261756e69ull, 0x6f72736974657300ull, 0x6f75747379737465ull,
+    0x6f776e70726f7669ull, 0x7061676566726f6eull, 0x7061676573706565ull, 0x70616765786c0000ull,
+    0x706179776869726cull, 0x7067666f67000000ull, 0x7069786f6c696e6full, 0x706c61747465722dull,
+    0x706c617973746174ull, 0x706c65736b6e7300ull, 0x706f696e74327468ull, 0x706f73746d616e2dull,
+    0x7072676d72000000ull, 0x7075626c69736870ull, 0x707974686f6e616eull, 0x7161320000000000ull,
+    0x7162757365720000ull, 0x7163000000000000ull, 0x7175616c6966696full, 0x717569636b737974ull,
+    0x71756970656c656dull, 0x7261636b6d617a65ull, 0x72656d6f74657764ull, 0x72656e6465720000ull,
+    0x7265736572766400ull, 0x726573657276652dull, 0x7268636c6f756400ull, 0x7275000000000000ull,
+    0x7361000000000000ull, 0x73617665732d7468ull, 0x7363727973656300ull, 0x7365637572697479ull,
+    0x73656c6669700000ull, 0x73656c6c732d666full, 0x73656c6c732d666full, 0x7365727665626273ull,
+    0x7365727665626565ull, 0x7365727665636f75ull, 0x7365727665657863ull, 0x7365727665667470ull,
+    0x736572766567616dull, 0x736572766568616cull, 0x7365727665687474ull, 0x736572766568756dull,
+    0x7365727665697263ull, 0x73657276656d7033ull, 0x7365727665703270ull, 0x7365727665706963ull,
+    0x7365727665717561ull, 0x7365727665736172ull, 0x73686f7069747369ull, 0x7369696974657300ull,
+    0x73696d706c652d75ull, 0x73696d706c657369ull, 0x73696e6161707000ull, 0x736b796765617261ull,
+    0x736d75736863646eull, 0x73706163652d746full, 0x737461636b686572ull, 0x7374646c69620000ull,
+    0x73747265616d6c69ull, 0x7374756666746f72ull, 0x74622d686f737469ull, 0x746561636865732dull,
+    0x74656d702d646e73ull, 0x746865776f726b70ull, 0x7468696e67647573ull, 0x746f776e6e657773ull,
+    0x7472792d736e6f77ull, 0x747279636c6f7564ull, 0x74756c6561702d70ull, 0x74797065666f726dull,
+    0x756b000000000000ull, 0x756e757375616c70ull, 0x7573000000000000ull, 0x7579000000000000ull,
+    0x76697073696e6161ull, 0x76756c74726f626aull, 0x7761666169636c6full, 0x776166666c656365ull,
+    0x7769617264776562ull, 0x77697468676f6f67ull, 0x77697468796f7574ull, 0x7769787369746500ull,
+    0x776f6c746c61622dull, 0x776f726b6973626full, 0x7770646576636c6full, 0x7770656e67696e65ull,
+    0x7770686f73746564ull, 0x77706d7563646e00ull, 0x7772697465737468ull, 0x786e626179000000ull,
+    0x796f6c6173697465ull, 0x7a61000000000000ull, 0x6d79666f72756d00ull, 0x6e6f670000000000ull,
+    0x726176656e646200ull, 0x6465000000000000ull, 0x656c656d656e746full, 0x6163000000000000ull,
+    0x636f000000000000ull, 0x6564000000000000ull, 0x6669000000000000ull, 0x676f000000000000ull,
+    0x6f72000000000000ull, 0x7361000000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x696e660000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x626c6f6773706f74ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x696e740000000000ull,
+    0x6e6f6d6500000000ull, 0x6f72670000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x6174680000000000ull, 0x676f760000000000ull,
+    0x696e666f00000000ull, 0x6163000000000000ull, 0x62697a0000000000ull, 0x636f6d0000000000ull,
+    0x656b6c6f67657300ull, 0x676f760000000000ull, 0x6c74640000000000ull, 0x6d696c0000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x7072657373000000ull, 0x70726f0000000000ull,
+    0x746d000000000000ull, 0x626c6f6773706f74ull, 0x636f000000000000ull, 0x6534000000000000ull,
+    0x6d65746163656e74ull, 0x6d756e6900000000ull, 0x7265616c6d000000ull, 0x3132337765627365ull,
+    0x3132687000000000ull, 0x3269780000000000ull, 0x346c696d61000000ull, 0x6261727379000000ull,
+    0x626c6f6773706f74ull, 0x62706c6163656400ull, 0x636f6d0000000000ull, 0x636f6d6d756e6974ull,
+    0x636f7369646e7300ull, 0x64642d646e730000ull, 0x64646e7373000000ull, 0x6469736b75737369ull,
+    0x646e73686f6d6500ull, 0x646e737570646174ull, 0x647261792d646e73ull, 0x64726179646e7300ull,
+    0x64796e2d6265726cull, 0x64796e2d69703234ull, 0x64796e2d76706e00ull, 0x64796e616d697363ull,
+    0x64796e646e733100ull, 0x64796e76706e0000ull, 0x6669726577616c6cull, 0x667275736b790000ull,
+    0x6675657474657274ull, 0x6769742d7265706full, 0x676f697000000000ull, 0x67c3bc6e73746967ull,
+    0x67c3bc6e73746967ull, 0x686f6d652d776562ull, 0x68732d6865696c62ull, 0x696e2d6265726c69ull,
+    0x696e2d6272620000ull, 0x696e2d6275747465ull, 0x696e2d64736c0000ull, 0x696e2d76706e0000ull,
+    0x696e7465726e6574ull, 0x6973657276736368ull, 0x69737465696e6765ull, 0x6973746d65696e00ull,
+    0x6b65796d61636869ull, 0x6c2d6f2d672d692dull, 0x6c637562652d7365ull, 0x6c656274696d6e65ull,
+    0x6c656974756e6773ull, 0x6c696d612d636974ull, 0x6c6f676f69700000ull, 0x6d65696e2d697365ull,
+    0x6d65696e2d766967ull, 0x6d792d6761746577ull, 0x6d792d726f757465ull, 0x6d792d7669676f72ull,
+    0x6d792d77616e0000ull, 0x6d79686f6d652d73ull, 0x6d79737072656164ull, 0x736368756c706c61ull,
+    0x736368756c736572ull, 0x7370646e73000000ull, 0x7370656564706172ull, 0x7371756172653700ull,
+    0x73766e2d7265706full, 0x73796e6f2d647300ull, 0x73796e6f6c6f6779ull, 0x73796e6f6c6f6779ull,
+    0x74616966756e2d64ull, 0x746573742d697365ull, 0x74726165756d7467ull, 0x7562657273706163ull,
+    0x7669727475616c2dull, 0x7669727475616c75ull, 0x786e2d2d676e7374ull, 0x786e2d2d676e7374ull,
+    0x6273730000000000ull, 0x6175746f636f6465ull, 0x6375727600000000ull, 0x64656e6f00000000ull,
+    0x64656e6f2d737461ull, 0x6465746100000000ull, 0x666c790000000000ull, 0x6761746577617900ull,
+    0x6769746875627072ull, 0x6973657276000000ull, 0x6c636c0000000000ull, 0x6c636c7374616765ull,
+    0x6c6f63616c636572ull, 0x6c6f67696e6c696eull, 0x6d65646961746563ull, 0x7061676573000000ull,
+    0x706c61747465722dull, 0x7232000000000000ull, 0x7368696674637279ull, 0x7374670000000000ull,
+    0x7374677374616765ull, 0x76657263656c0000ull, 0x7765626861726500ull, 0x776f726b65727300ull,
+    0x636c6f7564617070ull, 0x313233686a656d6dull, 0x62697a0000000000ull, 0x626c6f6773706f74ull,
+    0x636f000000000000ull, 0x6669726d00000000ull, 0x6d79737072656164ull, 0x7265670000000000ull,
+    0x73746f7265000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x6172740000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f620000000000ull, 0x676f760000000000ull, 0x6d696c0000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x736c640000000000ull, 0x7765620000000000ull,
+    0x6172740000000000ull, 0x6173736f00000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x706f6c0000000000ull,
+    0x736f630000000000ull, 0x746d000000000000ull, 0x6461707073000000ull, 0x6261736500000000ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x66696e0000000000ull, 0x676f620000000000ull,
+    0x676f760000000000ull, 0x696e666f00000000ull, 0x6b31320000000000ull, 0x6d65640000000000ull,
+    0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6f6666696369616cull, 0x6f72670000000000ull,
+    0x70726f0000000000ull, 0x7269740000000000ull, 0x636f000000000000ull, 0x6169700000000000ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x6669650000000000ull, 0x676f760000000000ull,
+    0x6c69620000000000ull, 0x6d65640000000000ull, 0x6f72670000000000ull, 0x7072690000000000ull,
+    0x7269696b00000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x65756e0000000000ull,
+    0x676f760000000000ull, 0x6d696c0000000000ull, 0x6e616d6500000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x7363690000000000ull, 0x3132336d69776562ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f620000000000ull, 0x6d79737072656164ull, 0x6e6f6d0000000000ull,
+    0x6f72670000000000ull, 0x636f6d7075746500ull, 0x62697a0000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x696e666f00000000ull, 0x6e616d6500000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x6169726b69746170ull, 0x6261727379000000ull,
+    0x636c6f75646e7300ull, 0x6469736b73746174ull, 0x646f6761646f0000ull, 0x6d79636400000000ull,
+    0x7370646e73000000ull, 0x7472616e7375726cull, 0x77656c6c6265696eull, 0x7061727479000000ull,
+    0x636f000000000000ull, 0x6b6f6f62696e0000ull, 0x79626f0000000000ull, 0x73746f726a000000ull,
+    0x3132336b6f746973ull, 0x616c616e64000000ull, 0x626c6f6773706f74ull, 0x636c6f7564706c61ull,
+    0x6461746163656e74ull, 0x6479000000000000ull, 0x68c3a46b6b696e65ull, 0x696b690000000000ull,
+    0x6b61707369000000ull, 0x6d79737072656164ull, 0x786e2d2d686b6b69ull, 0x636f000000000000ull,
+    0x6163000000000000ull, 0x62697a0000000000ull, 0x636f6d0000000000ull, 0x676f760000000000ull,
+    0x696e666f00000000ull, 0x6d696c0000000000ull, 0x6e616d6500000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x70726f0000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x726164696f000000ull, 0x7573657200000000ull,
+    0x3132337369746577ull, 0x6165726f706f7274ull, 0x6173736f00000000ull, 0x61766f6361740000ull,
+    0x61766f7565730000ull, 0x626c6f6773706f74ull, 0x6363690000000000ull, 0x6368616d62616772ull,
+    0x6368697275726769ull, 0x6368697275726769ull, 0x636f6d0000000000ull, 0x64656469626f7800ull,
+    0x656e2d726f6f7400ull, 0x657870657274732dull, 0x6662782d6f730000ull, 0x6662786f73000000ull,
+    0x66726565626f782dull, 0x66726565626f786full, 0x67656f6d65747265ull, 0x676f7570696c6500ull,
+    0x676f757600000000ull, 0x6772657461000000ull, 0x6875697373696572ull, 0x6d65646563696e00ull,
+    0x6d79737072656164ull, 0x6e6f6d0000000000ull, 0x6e6f746169726573ull, 0x6f6e2d7765620000ull,
+    0x706861726d616369ull, 0x706f727400000000ull, 0x7072640000000000ull, 0x746d000000000000ull,
+    0x7665746572696e61ull, 0x796e680000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x636e707900000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x7076740000000000ull,
+    0x636f000000000000ull, 0x6379610000000000ull, 0x6b61617300000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x70616e656c000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x6d696c0000000000ull, 0x6f72670000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x6c74640000000000ull, 0x6d6f640000000000ull,
+    0x6f72670000000000ull, 0x62697a0000000000ull, 0x636f000000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x7878000000000000ull,
+    0x6163000000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x636c6f7564000000ull, 0x7472616e736c6174ull,
+    0x75736572636f6e74ull, 0x6170700000000000ull, 0x6173736f00000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x6d6f626900000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x626c6f6773706f74ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x73696d706c657369ull, 0x646973636f757273ull,
+    0x626c6f6700000000ull, 0x636f6d0000000000ull, 0x6465000000000000ull, 0x6564750000000000ull,
+    0x676f620000000000ull, 0x696e640000000000ull, 0x6d696c0000000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x746f000000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x6775616d00000000ull, 0x696e666f00000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x7765620000000000ull, 0x6265000000000000ull, 0x636f000000000000ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x6872610000000000ull, 0x626c6f6773706f74ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x6964760000000000ull, 0x696e630000000000ull,
+    0x6c74640000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x7365636161730000ull,
+    0x786e2d2d35357178ull, 0x786e2d2d63697170ull, 0x786e2d2d676d7130ull, 0x786e2d2d676d7177ull,
+    0x786e2d2d696f3061ull, 0x786e2d2d6c637672ull, 0x786e2d2d6d6b3061ull, 0x786e2d2d6d787471ull,
+    0x786e2d2d6f643061ull, 0x786e2d2d6f643061ull, 0x786e2d2d746e3061ull, 0x786e2d2d75633061ull,
+    0x786e2d2d75633061ull, 0x786e2d2d77637673ull, 0x786e2d2d7a663061ull, 0xe4b8aae4baba0000ull,
+    0xe5808be4baba0000ull, 0xe585ace58fb80000ull, 0xe694bfe5ba9c0000ull, 0xe6958ee882b20000ull,
+    0xe69599e882b20000ull, 0xe7ae87e4baba0000ull, 0xe7b584e7b9940000ull, 0xe7b584e7bb870000ull,
+    0xe7b6b2e7b5a10000ull, 0xe7b6b2e7bb9c0000ull, 0xe7bb84e7b9940000ull, 0xe7bb84e7bb870000ull,
+    0xe7bd91e7b5a10000ull, 0xe7bd91e7bb9c0000ull, 0x6363000000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f620000000000ull, 0x6d696c0000000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x636c6f7564616363ull, 0x6561737970616e65ull, 0x6661737476707300ull,
+    0x6672656573697465ull, 0x68616c6600000000ull, 0x6a656c6500000000ull, 0x6d6972636c6f7564ull,
+    0x6d79666173740000ull, 0x70636c6f75640000ull, 0x74656d7075726c00ull, 0x77706d7564657600ull,
+    0x6f70656e63726166ull, 0x626c6f6773706f74ull, 0x636f6d0000000000ull, 0x6672656500000000ull,
+    0x66726f6d00000000ull, 0x697a000000000000ull, 0x6e616d6500000000ull, 0x6164756c74000000ull,
+    0x6172740000000000ull, 0x6173736f00000000ull, 0x636f6d0000000000ull, 0x636f6f7000000000ull,
+    0x6564750000000000ull, 0x6669726d00000000ull, 0x676f757600000000ull, 0x696e666f00000000ull,
+    0x6d65640000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x706572736f000000ull,
+    0x706f6c0000000000ull, 0x70726f0000000000ull, 0x72656c0000000000ull, 0x73686f7000000000ull,
+    0x3230303000000000ull, 0x6167726172000000ull, 0x626c6f6773706f74ull, 0x626f6c7400000000ull,
+    0x636173696e6f0000ull, 0x6369747900000000ull, 0x636f000000000000ull, 0x65726f7469636100ull,
+    0x65726f74696b6100ull, 0x66696c6d00000000ull, 0x666f72756d000000ull, 0x67616d6573000000ull,
+    0x686f74656c000000ull, 0x696e666f00000000ull, 0x696e6761746c616eull, 0x6a6f6761737a0000ull,
+    0x6b6f6e7976656c6full, 0x6c616b6173000000ull, 0x6d65646961000000ull, 0x6e65777300000000ull,
+    0x6f72670000000000ull, 0x7072697600000000ull, 0x72656b6c616d0000ull, 0x7365780000000000ull,
+    0x73686f7000000000ull, 0x73706f7274000000ull, 0x73756c6900000000ull, 0x737a657800000000ull,
+    0x746d000000000000ull, 0x746f7a7364650000ull, 0x7574617a61730000ull, 0x766964656f000000ull,
+    0x6163000000000000ull, 0x62697a0000000000ull, 0x636f000000000000ull, 0x6465736100000000ull,
+    0x666c617000000000ull, 0x666f727465000000ull, 0x676f000000000000ull, 0x6d696c0000000000ull,
+    0x6d79000000000000ull, 0x6e65740000000000ull, 0x6f72000000000000ull, 0x706f6e7065730000ull,
+    0x7363680000000000ull, 0x7765620000000000ull, 0x626c6f6773706f74ull, 0x676f760000000000ull,
+    0x6d79737072656164ull, 0x6163000000000000ull, 0x636f000000000000ull, 0x676f760000000000ull,
+    0x6964660000000000ull, 0x6b31320000000000ull, 0x6d756e6900000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x6163000000000000ull, 0x636f000000000000ull, 0x636f6d0000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x726f000000000000ull, 0x7474000000000000ull,
+    0x7476000000000000ull, 0x3567000000000000ull, 0x3667000000000000ull, 0x6163000000000000ull,
+    0x6169000000000000ull, 0x616d000000000000ull, 0x6261727379000000ull, 0x6269686172000000ull,
+    0x62697a0000000000ull, 0x626c6f6773706f74ull, 0x627573696e657373ull, 0x6361000000000000ull,
+    0x636c6f75646e7300ull, 0x636e000000000000ull, 0x636f000000000000ull, 0x636f6d0000000000ull,
+    0x636f6f7000000000ull, 0x6373000000000000ull, 0x64656c6869000000ull, 0x6472000000000000ull,
+    0x6564750000000000ull, 0x6572000000000000ull, 0x6669726d00000000ull, 0x67656e0000000000ull,
+    0x676f760000000000ull, 0x67756a6172617400ull, 0x696e640000000000ull, 0x696e666f00000000ull,
+    0x696e740000000000ull, 0x696e7465726e6574ull, 0x696f000000000000ull, 0x6d65000000000000ull,
+    0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6e69630000000000ull, 0x6f72670000000000ull,
+    0x7067000000000000ull, 0x706f737400000000ull, 0x70726f0000000000ull, 0x7265730000000000ull,
+    0x7375706162617365ull, 0x74726176656c0000ull, 0x7476000000000000ull, 0x756b000000000000ull,
+    0x7570000000000000ull, 0x7573000000000000ull, 0x7765620000000000ull, 0x62617272656c2d6full,
+    0x62617272656c6c2dull, 0x6261727379000000ull, 0x636c6f75646e7300ull, 0x646e737570646174ull,
+    0x64767263616d0000ull, 0x64796e616d69632dull, 0x64796e646e730000ull, 0x666f722d6f757200ull,
+    0x666f72756d7a0000ull, 0x67726f6b732d7468ull, 0x67726f6b732d7468ull, 0x686572652d666f72ull,
+    0x696c6f7665636f6cull, 0x6b6e6f7773697461ull, 0x6d61796669727374ull, 0x6e6f2d6970000000ull,
+    0x6e73757064617465ull, 0x73656c6669700000ull, 0x762d696e666f0000ull, 0x776562686f700000ull,
+    0x6575000000000000ull, 0x3230333800000000ull, 0x6170696765650000ull, 0x617a757265636f6eull,
+    0x622d646174610000ull, 0x6261636b706c616eull, 0x62616e7a6169636cull, 0x6261727379000000ull,
+    0x6261736963736572ull, 0x626561676c65626full, 0x6265656279746500ull, 0x6265656279746561ull,
+    0x6269677600000000ull, 0x6269746275636b65ull, 0x626c756562697465ull, 0x626f786675736500ull,
+    0x62726f7773657273ull, 0x636c657665726170ull, 0x636f6d0000000000ull, 0x646170706e6f6465ull,
+    0x646564796e000000ull, 0x646566696e696d61ull, 0x6472756400000000ull, 0x64796e3533000000ull,
+    0x656469746f727800ull, 0x6564756769740000ull, 0x66682d6d75656e73ull, 0x666f726765726f63ull,
+    0x67686f7374000000ull, 0x6769746875620000ull, 0x6769746c61620000ull, 0x6861737572612d61ull,
+    0x686f737479686f73ull, 0x687a630000000000ull, 0x6a656c6500000000ull, 0x6c61697200000000ull,
+    0x6c6f67696e6c696eull, 0x6c6f6c69706f7000ull, 0x6d6f2d7369656d65ull, 0x6d6f6f6e7363616cull,
+    0x6d7573696369616eull, 0x6e67726f6b000000ull, 0x6e69640000000000ull, 0x6e6f646561727400ull,
+    0x6f6e2d61636f726eull, 0x6f6e2d6b33730000ull, 0x6f6e2d72696f0000ull, 0x70616e7468656f6eull,
+    0x70726f746f6e6574ull, 0x7073746d6e000000ull, 0x7163780000000000ull, 0x716f746f00000000ull,
+    0x7265616474686564ull, 0x726573696e646576ull, 0x726573696e737461ull, 0x7335790000000000ull,
+    0x73616e6463617473ull, 0x7368696674637279ull, 0x7368696674656469ull, 0x7368770000000000ull,
+    0x73706163656b6974ull, 0x73746f6c6f730000ull, 0x74656c6562697400ull, 0x7468696e67647573ull,
+    0x7469636b65747300ull, 0x756e697370616365ull, 0x75706c6900000000ull, 0x757477656e746500ull,
+    0x7661706f72636c6full, 0x766272706c736278ull, 0x7669727475616c73ull, 0x7765627468696e67ull,
+    0x77656465706c6f79ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x6163000000000000ull,
+    0x636f000000000000ull, 0x676f760000000000ull, 0x6964000000000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x7363680000000000ull, 0x786e2d2d6d676261ull, 0x786e2d2d6d676261ull,
+    0xd8a7d98ad8b1d8a7ull, 0xd8a7db8cd8b1d8a7ull, 0x626c6f6773706f74ull, 0x636f6d0000000000ull,
+    0x63757063616b6500ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x696e740000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x313233686f6d6570ull, 0x31362d6200000000ull,
+    0x33322d6200000000ull, 0x36342d6200000000ull, 0x6162720000000000ull, 0x616272757a7a6f00ull,
+    0x6167000000000000ull, 0x6167726967656e74ull, 0x616c000000000000ull, 0x616c657373616e64ull,
+    0x616c746f2d616469ull, 0x616c746f61646967ull, 0x616e000000000000ull, 0x616e636f6e610000ull,
+    0x616e647269612d62ull, 0x616e647269612d74ull, 0x616e647269616261ull, 0x616e647269617472ull,
+    0x616f000000000000ull, 0x616f737461000000ull, 0x616f7374612d7661ull, 0x616f73746176616cull,
+    0x616f737465000000ull, 0x6170000000000000ull, 0x6171000000000000ull, 0x617175696c610000ull,
+    0x6172000000000000ull, 0x6172657a7a6f0000ull, 0x6173636f6c692d70ull, 0x6173636f6c697069ull,
+    0x6173746900000000ull, 0x6174000000000000ull, 0x6176000000000000ull, 0x6176656c6c696e6full,
+    0x6261000000000000ull, 0x62616c73616e0000ull, 0x62616c73616e2d73ull, 0x62616c73616e2d73ull,
+    0x62616c73616e2d73ull, 0x6261726900000000ull, 0x6261726c65747461ull, 0x6261726c65747461ull,
+    0x6261730000000000ull, 0x626173696c696361ull, 0x62656c6c756e6f00ull, 0x62656e6576656e74ull,
+    0x62657267616d6f00ull, 0x6267000000000000ull, 0x6269000000000000ull, 0x6269656c6c610000ull,
+    0x626c000000000000ull, 0x626c6f6773706f74ull, 0x626e000000000000ull, 0x626f000000000000ull,
+    0x626f6c6f676e6100ull, 0x626f6c7a616e6f00ull, 0x626f6c7a616e6f2dull, 0x626f7a656e000000ull,
+    0x626f7a656e2d7375ull, 0x626f7a656e2d7375ull, 0x626f7a656e2d73c3ull, 0x6272000000000000ull,
+    0x6272657363696100ull, 0x6272696e64697369ull, 0x6273000000000000ull, 0x6274000000000000ull,
+    0x62756c73616e0000ull, 0x62756c73616e2d73ull, 0x62756c73616e2d73ull, 0x62756c73616e2d73ull,
+    0x627a000000000000ull, 0x6361000000000000ull, 0x6361676c69617269ull, 0x63616c0000000000ull,
+    0x63616c6162726961ull, 0x63616c74616e6973ull, 0x63616d0000000000ull, 0x63616d70616e6961ull,
+    0x63616d706964616eull, 0x63616d706964616eull, 0x63616d706f626173ull, 0x636172626f6e6961ull,
+    0x636172626f6e6961ull, 0x636172726172612dull, 0x636172726172616dull, 0x6361736572746100ull,
+    0x636174616e696100ull, 0x636174616e7a6172ull, 0x6362000000000000ull, 0x6365000000000000ull,
+    0x636573656e612d66ull, 0x636573656e612d66ull, 0x636573656e61666full, 0x636573656e61666full,
+    0x6368000000000000ull, 0x6368696574690000ull, 0x6369000000000000ull, 0x636c000000000000ull,
+    0x636e000000000000ull, 0x636f000000000000ull, 0x636f6d6f00000000ull, 0x636f73656e7a6100ull,
+    0x6372000000000000ull, 0x6372656d6f6e6100ull, 0x63726f746f6e6500ull, 0x6373000000000000ull,
+    0x6374000000000000ull, 0x63756e656f000000ull, 0x637a000000000000ull, 0x64656c6c2d6f676cull,
+    0x64656c6c6f676c69ull, 0x6564750000000000ull, 0x656d696c69612d72ull, 0x656d696c6961726full,
+    0x656d720000000000ull, 0x656e000000000000ull, 0x656e6e6100000000ull, 0x6663000000000000ull,
+    0x6665000000000000ull, 0x6665726d6f000000ull, 0x6665727261726100ull, 0x6667000000000000ull,
+    0x6669000000000000ull, 0x666972656e7a6500ull, 0x666c6f72656e6365ull, 0x666d000000000000ull,
+    0x666f676769610000ull, 0x666f726c692d6365ull, 0x666f726c69636573ull, 0x666f726cc3ac2d63ull,
+    0x666f726cc3ac6365ull, 0x6672000000000000ull, 0x667269756c692d76ull, 0x667269756c692d76ull,
+    0x667269756c692d76ull, 0x667269756c692d76ull, 0x667269756c692d76ull, 0x667269756c692d76ull,
+    0x667269756c69762dull, 0x667269756c697665ull, 0x667269756c697665ull, 0x667269756c697665ull,
+    0x667269756c697665ull, 0x667269756c697667ull, 0x66726f73696e6f6eull, 0x6676670000000000ull,
+    0x6765000000000000ull, 0x67656e6f61000000ull, 0x67656e6f76610000ull, 0x676f000000000000ull,
+    0x676f72697a696100ull, 0x676f760000000000ull, 0x6772000000000000ull, 0x67726f737365746full,
+    0x6962786f73000000ull, 0x69676c6573696173ull, 0x69676c6573696173ull, 0x696c696164626f78ull,
+    0x696d000000000000ull, 0x696d706572696100ull, 0x6973000000000000ull, 0x697365726e696100ull,
+    0x6b72000000000000ull, 0x6c612d7370657a69ull, 0x6c617175696c6100ull, 0x6c617370657a6961ull,
+    0x6c6174696e610000ull, 0x6c617a0000000000ull, 0x6c617a696f000000ull, 0x6c63000000000000ull,
+    0x6c65000000000000ull, 0x6c65636365000000ull, 0x6c6563636f000000ull, 0x6c69000000000000ull,
+    0x6c69670000000000ull, 0x6c69677572696100ull, 0x6c69766f726e6f00ull, 0x6c6f000000000000ull,
+    0x6c6f646900000000ull, 0x6c6f6d0000000000ull, 0x6c6f6d6261726469ull, 0x6c6f6d6261726479ull,
+    0x6c74000000000000ull, 0x6c75000000000000ull, 0x6c7563616e696100ull, 0x6c75636361000000ull,
+    0x6d61636572617461ull, 0x6d616e746f766100ull, 0x6d61720000000000ull, 0x6d61726368650000ull,
+    0x6d617373612d6361ull, 0x6d61737361636172ull, 0x6d61746572610000ull, 0x6d62000000000000ull,
+    0x6d63000000000000ull, 0x6d65000000000000ull, 0x6d6564696f2d6361ull, 0x6d6564696f63616dull,
+    0x6d657373696e6100ull, 0x6d69000000000000ull, 0x6d696c616e000000ull, 0x6d696c616e6f0000ull,
+    0x6d6e000000000000ull, 0x6d6f000000000000ull, 0x6d6f64656e610000ull, 0x6d6f6c0000000000ull,
+    0x6d6f6c6973650000ull, 0x6d6f6e7a61000000ull, 0x6d6f6e7a612d6272ull, 0x6d6f6e7a612d652dull,
+    0x6d6f6e7a61627269ull, 0x6d6f6e7a61656272ull, 0x6d6f6e7a61656465ull, 0x6d73000000000000ull,
+    0x6d74000000000000ull, 0x6d79737072656164ull, 0x6e61000000000000ull, 0x6e61706c65730000ull,
+    0x6e61706f6c690000ull, 0x6e65656e00000000ull, 0x6e6f000000000000ull, 0x6e6f766172610000ull,
+    0x6e75000000000000ull, 0x6e756f726f000000ull, 0x6f67000000000000ull, 0x6f676c6961737472ull,
+    0x6f6c6269612d7465ull, 0x6f6c62696174656dull, 0x6f72000000000000ull, 0x6f72697374616e6full,
+    0x6f74000000000000ull, 0x7061000000000000ull, 0x7061646f76610000ull, 0x7061647561000000ull,
+    0x70616c65726d6f00ull, 0x7061726d61000000ull, 0x7061766961000000ull, 0x7063000000000000ull,
+    0x7064000000000000ull, 0x7065000000000000ull, 0x7065727567696100ull, 0x70657361726f2d75ull,
+    0x70657361726f7572ull, 0x7065736361726100ull, 0x7067000000000000ull, 0x7069000000000000ull,
+    0x70696163656e7a61ull, 0x706965646d6f6e74ull, 0x7069656d6f6e7465ull, 0x7069736100000000ull,
+    0x706973746f696100ull, 0x706d6e0000000000ull, 0x706e000000000000ull, 0x706f000000000000ull,
+    0x706f7264656e6f6eull, 0x706f74656e7a6100ull, 0x7072000000000000ull, 0x707261746f000000ull,
+    0x7074000000000000ull, 0x7075000000000000ull, 0x7075670000000000ull, 0x7075676c69610000ull,
+    0x7076000000000000ull, 0x707a000000000000ull, 0x7261000000000000ull, 0x7261677573610000ull,
+    0x726176656e6e6100ull, 0x7263000000000000ull, 0x7265000000000000ull, 0x72656767696f2d63ull,
+    0x72656767696f2d65ull, 0x72656767696f6361ull, 0x72656767696f656dull, 0x7267000000000000ull,
+    0x7269000000000000ull, 0x7269657469000000ull, 0x72696d696e690000ull, 0x726d000000000000ull,
+    0x726e000000000000ull, 0x726f000000000000ull, 0x726f6d6100000000ull, 0x726f6d6500000000ull,
+    0x726f7669676f0000ull, 0x7361000000000000ull, 0x73616c65726e6f00ull, 0x7361720000000000ull,
+    0x7361726465676e61ull, 0x73617264696e6961ull, 0x7361737361726900ull, 0x7361766f6e610000ull,
+    0x7369000000000000ull, 0x7369630000000000ull, 0x736963696c696100ull, 0x736963696c790000ull,
+    0x7369656e61000000ull, 0x7369726163757361ull, 0x736f000000000000ull, 0x736f6e6472696f00ull,
+    0x7370000000000000ull, 0x7372000000000000ull, 0x7373000000000000ull, 0x737565647469726full,
+    0x7376000000000000ull, 0x73796e636c6f7564ull, 0x73c3bc647469726full, 0x7461000000000000ull,
+    0x7461610000000000ull, 0x746172616e746f00ull, 0x7465000000000000ull, 0x74656d70696f2d6full,
+    0x74656d70696f6f6cull, 0x746572616d6f0000ull, 0x7465726e69000000ull, 0x74696d0000000000ull,
+    0x746e000000000000ull, 0x746f000000000000ull, 0x746f72696e6f0000ull, 0x746f730000000000ull,
+    0x746f7363616e6100ull, 0x7470000000000000ull, 0x7472000000000000ull, 0x7472616e692d616eull,
+    0x7472616e692d6261ull, 0x7472616e69616e64ull, 0x7472616e69626172ull, 0x74726170616e6900ull,
+    0x7472656e74696e2dull, 0x7472656e74696e2dull, 0x7472656e74696e2dull, 0x7472656e74696e2dull,
+    0x7472656e74696e2dull, 0x7472656e74696e2dull, 0x7472656e74696e6full, 0x7472656e74696e6full,
+    0x7472656e74696e6full, 0x7472656e74696e6full, 0x7472656e74696e6full, 0x7472656e74696e6full,
+    0x7472656e74696e6full, 0x7472656e74696e6full, 0x7472656e74696e6full, 0x7472656e74696e6full,
+    0x7472656e74696e6full, 0x7472656e74696e6full, 0x7472656e74696e6full, 0x7472656e74696e6full,
+    0x7472656e74696e6full, 0x7472656e74696e6full, 0x7472656e74696e6full, 0x7472656e74696e6full,
+    0x7472656e74696e6full, 0x7472656e74696e6full, 0x7472656e74696e6full, 0x7472656e74696e6full,
+    0x7472656e74696e6full, 0x7472656e74696e6full, 0x7472656e74696e6full, 0x7472656e74696e73ull,
+    0x7472656e74696e73ull, 0x7472656e74696e73ull, 0x7472656e74696e73ull, 0x7472656e74696e73ull,
+    0x7472656e74696e73ull, 0x7472656e746f0000ull, 0x7472657669736f00ull, 0x7472696573746500ull,
+    0x7473000000000000ull, 0x747572696e000000ull, 0x74757363616e7900ull, 0x7476000000000000ull,
+    0x7564000000000000ull, 0x7564696e65000000ull, 0x756d620000000000ull, 0x756d627269610000ull,
+    0x757262696e6f2d70ull, 0x757262696e6f7065ull, 0x7661000000000000ull, 0x76616c2d642d616full,
+    0x76616c2d64616f73ull, 0x76616c642d616f73ull, 0x76616c64616f7374ull, 0x76616c6c652d616full,
+    0x76616c6c652d642dull, 0x76616c6c652d6461ull, 0x76616c6c65616f73ull, 0x76616c6c65642d61ull,
+    0x76616c6c6564616full, 0x76616c6c65652d61ull, 0x76616c6c65652d64ull, 0x76616c6c6565616full,
+    0x76616c6c65656461ull, 0x76616c6cc3a9652dull, 0x76616c6cc3a9652dull, 0x76616c6cc3a96561ull,
+    0x76616c6cc3a96564ull, 0x76616f0000000000ull, 0x7661726573650000ull, 0x7662000000000000ull,
+    0x7663000000000000ull, 0x7664610000000000ull, 0x7665000000000000ull, 0x76656e0000000000ull,
+    0x76656e65746f0000ull, 0x76656e657a696100ull, 0x76656e6963650000ull, 0x76657262616e6961ull,
+    0x76657263656c6c69ull, 0x7665726f6e610000ull, 0x7669000000000000ull, 0x7669626f2d76616cull,
+    0x7669626f76616c65ull, 0x766963656e7a6100ull, 0x7669746572626f00ull, 0x7672000000000000ull,
+    0x7673000000000000ull, 0x7674000000000000ull, 0x7676000000000000ull, 0x786e2d2d62616c73ull,
+    0x786e2d2d626f7a65ull, 0x786e2d2d62756c73ull, 0x786e2d2d63657365ull, 0x786e2d2d63657365ull,
+    0x786e2d2d666f726cull, 0x786e2d2d666f726cull, 0x786e2d2d73647469ull, 0x786e2d2d7472656eull,
+    0x786e2d2d7472656eull, 0x786e2d2d7472656eull, 0x786e2d2d7472656eull, 0x786e2d2d7472656eull,
+    0x786e2d2d7472656eull, 0x786e2d2d7472656eull, 0x786e2d2d7472656eull, 0x786e2d2d76616c6cull,
+    0x786e2d2d76616c6cull, 0x786e2d2d76616c6cull, 0x786e2d2d76616c6cull, 0x636f000000000000ull,
+    0x6e65740000000000ull, 0x6f66000000000000ull, 0x6f72670000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x6d696c0000000000ull, 0x6e616d6500000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x7363680000000000ull, 0x6163000000000000ull,
+    0x6164000000000000ull, 0x6169636869000000ull, 0x616b697461000000ull, 0x616e677279000000ull,
+    0x616f6d6f72690000ull, 0x62616279626c7565ull, 0x626162796d696c6bull, 0x6261636b64726f70ull,
+    0x62616d62696e6100ull, 0x6269747465720000ull, 0x626c6f6773706f74ull, 0x626c757368000000ull,
+    0x626f6f0000000000ull, 0x626f790000000000ull, 0x626f79667269656eull, 0x6275740000000000ull,
+    0x62757973686f7000ull, 0x63616e6479706f70ull, 0x6361706f6f000000ull, 0x636174666f6f6400ull,
+    0x6368656170000000ull, 0x6368696261000000ull, 0x6368696361707061ull, 0x6368696c6c6f7574ull,
+    0x6368697073000000ull, 0x63686f7764657200ull, 0x6368750000000000ull, 0x6369616f00000000ull,
+    0x636f000000000000ull, 0x636f636f74746500ull, 0x636f6f6c626c6f67ull, 0x6372616e6b790000ull,
+    0x637574656769726cull, 0x6461610000000000ull, 0x6465636100000000ull, 0x6465636900000000ull,
+    0x64696769636b0000ull, 0x6564000000000000ull, 0x65676f69736d0000ull, 0x6568696d65000000ull,
+    0x66616b6566757200ull, 0x66617368696f6e73ull, 0x66656d0000000000ull, 0x666c696572000000ull,
+    0x666c6f7070790000ull, 0x666f6f6c00000000ull, 0x6672656e63686b69ull, 0x66756b7569000000ull,
+    0x66756b756f6b6100ull, 0x66756b757368696dull, 0x6769667500000000ull, 0x6769726c66726965ull,
+    0x6769726c79000000ull, 0x676c6f6f6d790000ull, 0x676f000000000000ull, 0x676f6e6e61000000ull,
+    0x6772000000000000ull, 0x6772656174657200ull, 0x67756e6d61000000ull, 0x6861636361000000ull,
+    0x68616e6463726166ull, 0x6865617679000000ull, 0x6865720000000000ull, 0x6869686f00000000ull,
+    0x6869707079000000ull, 0x6869726f7368696dull, 0x686f6b6b6169646full, 0x686f6c7900000000ull,
+    0x68756e6772790000ull, 0x68796f676f000000ull, 0x69626172616b6900ull, 0x6963757275730000ull,
+    0x697368696b617761ull, 0x697469676f000000ull, 0x6977617465000000ull, 0x6a656c6c79626561ull,
+    0x6b61676177610000ull, 0x6b61676f7368696dull, 0x6b616e6167617761ull, 0x6b61776169697368ull,
+    0x6b61776173616b69ull, 0x6b696b6972617261ull, 0x6b696c6c00000000ull, 0x6b696c6f00000000ull,
+    0x6b6974616b797573ull, 0x6b6f626500000000ull, 0x6b6f636869000000ull, 0x6b756d616d6f746full,
+    0x6b75726f6e000000ull, 0x6b796f746f000000ull, 0x6c67000000000000ull, 0x6c6974746c657374ull,
+    0x6c6f6c69706f706dull, 0x6c6f6c6974617075ull, 0x6c6f6d6f00000000ull, 0x6c6f7665706f7000ull,
+    0x6c6f76657369636bull, 0x6d61696e00000000ull, 0x6d69650000000000ull, 0x6d69796167690000ull,
+    0x6d6979617a616b69ull, 0x6d6f647300000000ull, 0x6d6f6e6400000000ull, 0x6d6f6e676f6c6961ull,
+    0x6d6f6f0000000000ull, 0x6e6167616e6f0000ull, 0x6e61676173616b69ull, 0x6e61676f79610000ull,
+    0x6e616d6173746500ull, 0x6e61726100000000ull, 0x6e65000000000000ull, 0x6e69696761746100ull,
+    0x6e696b6974610000ull, 0x6e6f627573686900ull, 0x6e6f6f7200000000ull, 0x6f69746100000000ull,
+    0x6f6b6179616d6100ull, 0x6f6b696e61776100ull, 0x6f6f707300000000ull, 0x6f72000000000000ull,
+    0x6f73616b61000000ull, 0x706172616c6c656cull, 0x7061726173697465ull, 0x7065636f72690000ull,
+    0x7065657765650000ull, 0x70656e6e65000000ull, 0x7065707065720000ull, 0x7065726d61000000ull,
+    0x706967626f617400ull, 0x70696e6f6b6f0000ull, 0x70756e7975000000ull, 0x7075707500000000ull,
+    0x7075737379636174ull, 0x7079610000000000ull, 0x7261696e64726f70ull, 0x72656164796d6164ull,
+    0x7361646973740000ull, 0x7361676100000000ull, 0x73616974616d6100ull, 0x736170706f726f00ull,
+    0x7363686f6f6c6275ull, 0x7365637265740000ull, 0x73656e6461690000ull, 0x7368696761000000ull,
+    0x7368696d616e6500ull, 0x7368697a756f6b61ull, 0x7374616261000000ull, 0x7374726970706572ull,
+    0x7375620000000000ull, 0x73756e6e79646179ull, 0x737570657273616cull, 0x74686573686f7000ull,
+    0x746869636b000000ull, 0x746f636869676900ull, 0x746f6b757368696dull, 0x746f6b796f000000ull,
+    0x746f6e6b6f747375ull, 0x746f74746f726900ull, 0x746f79616d610000ull, 0x756e646572000000ull,
+    0x7570706572000000ull, 0x75736572636f6e74ull, 0x76656c7665740000ull, 0x7665727365000000ull,
+    0x7665727375730000ull, 0x76697669616e0000ull, 0x77616b6179616d61ull, 0x776174736f6e0000ull,
+    0x7765626c696b6500ull, 0x7768697465736e6full, 0x786e2d2d30747271ull, 0x786e2d2d31637477ull,
+    0x786e2d2d316c7173ull, 0x786e2d2d316c7173ull, 0x786e2d2d326d3461ull, 0x786e2d2d33327670ull,
+    0x786e2d2d34697431ull, 0x786e2d2d34697437ull, 0x786e2d2d34707678ull, 0x786e2d2d356a7330ull,
+    0x786e2d2d35727470ull, 0x786e2d2d35727471ull, 0x786e2d2d36627477ull, 0x786e2d2d366f7278ull,
+    0x786e2d2d37743061ull, 0x786e2d2d386c7472ull, 0x786e2d2d38707672ull, 0x786e2d2d63337331ull,
+    0x786e2d2d64357176ull, 0x786e2d2d646a7273ull, 0x786e2d2d646a7479ull, 0x786e2d2d6566766eull,
+    0x786e2d2d6568717aull, 0x786e2d2d656c7171ull, 0x786e2d2d66367178ull, 0x786e2d2d6b37796eull,
+    0x786e2d2d6b627271ull, 0x786e2d2d6b6c7437ull, 0x786e2d2d6b6c7470ull, 0x786e2d2d6b6c7478ull,
+    0x786e2d2d6b6c7479ull, 0x786e2d2d6d6b7275ull, 0x786e2d2d6e697432ull, 0x786e2d2d6e74736full,
+    0x786e2d2d6e747371ull, 0x786e2d2d70737375ull, 0x786e2d2d71717174ull, 0x786e2d2d72687432ull,
+    0x786e2d2d72687433ull, 0x786e2d2d72687436ull, 0x786e2d2d726e7933ull, 0x786e2d2d746f7231ull,
+    0x786e2d2d75697374ull, 0x786e2d2d7569737aull, 0x786e2d2d75757775ull, 0x786e2d2d76677534ull,
+    0x786e2d2d7a627830ull, 0x79616d6167617461ull, 0x79616d6167756368ull, 0x79616d616e617368ull,
+    0x796f6b6f68616d61ull, 0x7a6f6d6269650000ull, 0xe4b889e9878d0000ull, 0xe4baace983bd0000ull,
+    0xe4bd90e8b3800000ull, 0xe585b5e5baab0000ull, 0xe58c97e6b5b7e981ull, 0xe58d83e891890000ull,
+    0xe5928ce6ad8ce5b1ull, 0xe59fbce78e890000ull, 0xe5a4a7e588860000ull, 0xe5a4a7e998aa0000ull,
+    0xe5a588e889af0000ull, 0xe5aeaee59f8e0000ull, 0xe5aeaee5b48e0000ull, 0xe5af8ce5b1b10000ull,
+    0xe5b1b1e58fa30000ull, 0xe5b1b1e5bda20000ull, 0xe5b1b1e6a2a80000ull, 0xe5b290e9989c0000ull,
+    0xe5b2a1e5b1b10000ull, 0xe5b2a9e6898b0000ull, 0xe5b3b6e6a0b90000ull, 0xe5ba83e5b3b60000ull,
+    0xe5beb3e5b3b60000ull, 0xe6849be5aa9b0000ull, 0xe6849be79fa50000ull, 0xe696b0e6bd9f0000ull,
+    0xe69db1e4baac0000ull, 0xe6a083e69ca80000ull, 0xe6b296e7b8840000ull, 0xe6bb8be8b3800000ull,
+    0xe7868ae69cac0000ull, 0xe79fb3e5b79d0000ull, 0xe7a59ee5a588e5b7ull, 0xe7a68fe4ba950000ull,
+    0xe7a68fe5b2a10000ull, 0xe7a68fe5b3b60000ull, 0xe7a78be794b00000ull, 0xe7bea4e9a6ac0000ull,
+    0xe88ca8e59f8e0000ull, 0xe995b7e5b48e0000ull, 0xe995b7e9878e0000ull, 0xe99d92e6a3ae0000ull,
+    0xe99d99e5b2a10000ull, 0xe9a699e5b79d0000ull, 0xe9ab98e79fa50000ull, 0xe9b3a5e58f960000ull,
+    0xe9b9bfe58590e5b3ull, 0x6163000000000000ull, 0x636f000000000000ull, 0x676f000000000000ull,
+    0x696e666f00000000ull, 0x6d65000000000000ull, 0x6d6f626900000000ull, 0x6e65000000000000ull,
+    0x6f72000000000000ull, 0x7363000000000000ull, 0x626c6f6700000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x696f000000000000ull, 0x6a70000000000000ull,
+    0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x7476000000000000ull,
+    0x756b000000000000ull, 0x7573000000000000ull, 0x62697a0000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x696e666f00000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x6173730000000000ull, 0x6173736f00000000ull, 0x636f6d0000000000ull,
+    0x636f6f7000000000ull, 0x6564750000000000ull, 0x676f757600000000ull, 0x676f760000000000ull,
+    0x6d65646563696e00ull, 0x6d696c0000000000ull, 0x6e6f6d0000000000ull, 0x6e6f746169726573ull,
+    0x6f72670000000000ull, 0x706861726d616369ull, 0x7072640000000000ull, 0x7072657373650000ull,
+    0x746d000000000000ull, 0x7665746572696e61ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x6f72670000000000ull, 0x7265700000000000ull, 0x7472610000000000ull,
+    0x6163000000000000ull, 0x626c6f6773706f74ull, 0x627573616e000000ull, 0x6368756e6762756bull,
+    0x6368756e676e616dull, 0x636f000000000000ull, 0x6461656775000000ull, 0x6461656a656f6e00ull,
+    0x6573000000000000ull, 0x67616e67776f6e00ull, 0x676f000000000000ull, 0x6777616e676a7500ull,
+    0x6779656f6e676275ull, 0x6779656f6e676769ull, 0x6779656f6e676e61ull, 0x6873000000000000ull,
+    0x696e6368656f6e00ull, 0x6a656a7500000000ull, 0x6a656f6e62756b00ull, 0x6a656f6e6e616d00ull,
+    0x6b67000000000000ull, 0x6d696c0000000000ull, 0x6d73000000000000ull, 0x6e65000000000000ull,
+    0x6f72000000000000ull, 0x7065000000000000ull, 0x7265000000000000ull, 0x7363000000000000ull,
+    0x73656f756c000000ull, 0x756c73616e000000ull, 0x636f000000000000ull, 0x6564750000000000ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x656d620000000000ull, 0x676f760000000000ull,
+    0x696e640000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x6a636c6f75640000ull, 0x6b617a74656c6570ull,
+    0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x626e720000000000ull,
+    0x6300000000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x696e666f00000000ull, 0x696e740000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x7065720000000000ull, 0x7374617469630000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x636f000000000000ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x6f79000000000000ull, 0x626c6f6773706f74ull, 0x6361610000000000ull,
+    0x63796f6e00000000ull, 0x6477656200000000ull, 0x6d79706570000000ull, 0x686c780000000000ull,
+    0x6163000000000000ull, 0x6173736e00000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x6772700000000000ull, 0x686f74656c000000ull, 0x696e740000000000ull,
+    0x6c74640000000000ull, 0x6e65740000000000ull, 0x6e676f0000000000ull, 0x6f72670000000000ull,
+    0x7363680000000000ull, 0x736f630000000000ull, 0x7765620000000000ull, 0x6f6d670000000000ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x6163000000000000ull, 0x62697a0000000000ull, 0x636f000000000000ull,
+    0x6465000000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x696e666f00000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x7363000000000000ull, 0x626c6f6773706f74ull,
+    0x676f760000000000ull, 0x3132337765627369ull, 0x626c6f6773706f74ull, 0x61736e0000000000ull,
+    0x636f6d0000000000ull, 0x636f6e6600000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x6964000000000000ull, 0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x6964000000000000ull,
+    0x6d65640000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x706c630000000000ull,
+    0x7363680000000000ull, 0x6163000000000000ull, 0x636f000000000000ull, 0x676f760000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x7072657373000000ull, 0x726f757465720000ull,
+    0x6173736f00000000ull, 0x746d000000000000ull, 0x6174000000000000ull, 0x626c6f6773706f74ull,
+    0x6465000000000000ull, 0x6a70000000000000ull, 0x746f000000000000ull, 0x6163000000000000ull,
+    0x6261727379000000ull, 0x62726173696c6961ull, 0x6336360000000000ull, 0x636f000000000000ull,
+    0x6461706c69650000ull, 0x64646e7300000000ull, 0x6469736b73746174ull, 0x646e73666f720000ull,
+    0x6473636c6f756400ull, 0x6564676573746163ull, 0x6564750000000000ull, 0x66696c6567656172ull,
+    0x66696c6567656172ull, 0x66696c6567656172ull, 0x66696c6567656172ull, 0x66696c6567656172ull,
+    0x66696c6567656172ull, 0x66696c6567656172ull, 0x676c697463680000ull, 0x676f760000000000ull,
+    0x686f70746f000000ull, 0x6932333400000000ull, 0x6974730000000000ull, 0x6c6f67696e746f00ull,
+    0x6c6f686d75730000ull, 0x6d63646972000000ull, 0x6d63706500000000ull, 0x6d79647300000000ull,
+    0x6e65740000000000ull, 0x6e6f686f73740000ull, 0x6e6f697000000000ull, 0x6f72670000000000ull,
+    0x7072697600000000ull, 0x726176656e646200ull, 0x736f756e64636173ull, 0x73796e6f6c6f6779ull,
+    0x7463703400000000ull, 0x7472616e73697000ull, 0x7670340000000000ull, 0x776562686f700000ull,
+    0x77656465706c6f79ull, 0x796f6d626f000000ull, 0x6672616d65720000ull, 0x6261727379000000ull,
+    0x636f000000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x6d696c0000000000ull, 0x6e6f6d0000000000ull, 0x6f72670000000000ull, 0x7072640000000000ull,
+    0x746d000000000000ull, 0x626c6f6773706f74ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x696e660000000000ull, 0x6e616d6500000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f757600000000ull,
+    0x676f760000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x7072657373650000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x6e79630000000000ull, 0x6f72670000000000ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x6261727379000000ull, 0x6473636c6f756400ull, 0x6a75000000000000ull,
+    0x626c6f6773706f74ull, 0x676f760000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x6c61620000000000ull, 0x6d696e6973697465ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x6163000000000000ull, 0x636f000000000000ull, 0x636f6d0000000000ull,
+    0x676f760000000000ull, 0x6e65740000000000ull, 0x6f72000000000000ull, 0x6f72670000000000ull,
+    0x61636164656d7900ull, 0x6167726963756c74ull, 0x6169720000000000ull, 0x6169726775617264ull,
+    0x616c6162616d6100ull, 0x616c61736b610000ull, 0x616d626572000000ull, 0x616d62756c616e63ull,
+    0x616d65726963616eull, 0x616d65726963616eull, 0x616d65726963616eull, 0x616d65726963616eull,
+    0x616d737465726461ull, 0x616e640000000000ull, 0x616e6e656672616eull, 0x616e7468726f0000ull,
+    0x616e7468726f706full, 0x616e746971756573ull, 0x617175617269756dull, 0x6172626f72657475ull,
+    0x6172636861656f6cull, 0x6172636861656f6cull, 0x6172636869746563ull, 0x6172740000000000ull,
+    0x617274616e646465ull, 0x61727463656e7465ull, 0x6172746465636f00ull, 0x6172746564756361ull,
+    0x61727467616c6c65ull, 0x6172747300000000ull, 0x61727473616e6463ull, 0x61736d6174617274ull,
+    0x617373617373696eull, 0x6173736973690000ull, 0x6173736f63696174ull, 0x617374726f6e6f6dull,
+    0x61746c616e746100ull, 0x61757374696e0000ull, 0x6175737472616c69ull, 0x6175746f6d6f7469ull,
+    0x6176696174696f6eull, 0x6178697300000000ull, 0x626164616a6f7a00ull, 0x6261676864616400ull,
+    0x6261686e00000000ull, 0x62616c6500000000ull, 0x62616c74696d6f72ull, 0x62617263656c6f6eull,
+    0x6261736562616c6cull, 0x626173656c000000ull, 0x6261746873000000ull, 0x62617565726e0000ull,
+    0x6265617578617274ull, 0x6265656c64656e67ull, 0x62656c6c65767565ull, 0x6265726762617500ull,
+    0x6265726b656c6579ull, 0x6265726c696e0000ull, 0x6265726e00000000ull, 0x6269626c65000000ull,
+    0x62696c62616f0000ull, 0x62696c6c00000000ull, 0x6269726461727400ull, 0x6269727468706c61ull,
+    0x626f6e6e00000000ull, 0x626f73746f6e0000ull, 0x626f74616e696361ull, 0x626f74616e696361ull,
+    0x626f74616e696367ull, 0x626f74616e790000ull, 0x6272616e64797769ull, 0x62726173696c0000ull,
+    0x62726973746f6c00ull, 0x6272697469736800ull, 0x6272697469736863ull, 0x62726f6164636173ull,
+    0x6272756e656c0000ull, 0x6272757373656c00ull, 0x6272757373656c73ull, 0x62727578656c6c65ull,
+    0x6275696c64696e67ull, 0x62757267686f6600ull, 0x6275730000000000ull, 0x6275736865790000ull,
+    0x6361646171756573ull, 0x63616c69666f726eull, 0x63616d6272696467ull, 0x63616e0000000000ull,
+    0x63616e6164610000ull, 0x6361706562726574ull, 0x6361727269657200ull, 0x636172746f6f6e61ull,
+    0x6361736164656c61ull, 0x636173746c650000ull, 0x6361737472657300ull, 0x63656c7469630000ull,
+    0x63656e7465720000ull, 0x6368617474616e6full, 0x6368656c74656e68ull, 0x6368657361706561ull,
+    0x6368696361676f00ull, 0x6368696c6472656eull, 0x6368696c6472656eull, 0x6368696c6472656eull,
+    0x636869726f707261ull, 0x63686f636f6c6174ull, 0x6368726973746961ull, 0x63696e63696e6e61ull,
+    0x63696e656d610000ull, 0x6369726375730000ull, 0x636976696c697361ull, 0x636976696c697a61ull,
+    0x636976696c776172ull, 0x636c696e746f6e00ull, 0x636c6f636b000000ull, 0x636f616c00000000ull,
+    0x636f617374616c64ull, 0x636f647900000000ull, 0x636f6c6477617200ull, 0x636f6c6c65637469ull,
+    0x636f6c6f6e69616cull, 0x636f6c6f7261646full, 0x636f6c756d626961ull, 0x636f6c756d627573ull,
+    0x636f6d6d756e6963ull, 0x636f6d6d756e6963ull, 0x636f6d6d756e6974ull, 0x636f6d7075746572ull,
+    0x636f6d7075746572ull, 0x636f6d756e696361ull, 0x636f6e74656d706full, 0x636f6e74656d706full,
+    0x636f6e76656e7400ull, 0x636f70656e686167ull, 0x636f72706f726174ull, 0x636f727265696f73ull,
+    0x636f727665747465ull, 0x636f7374756d6500ull, 0x636f756e74727965ull, 0x636f756e74790000ull,
+    0x6372616674730000ull, 0x6372616e62726f6full, 0x6372656174696f6eull, 0x63756c747572616cull,
+    0x63756c747572616cull, 0x63756c7475726500ull, 0x6379626572000000ull, 0x63796d7275000000ull,
+    0x64616c6900000000ull, 0x64616c6c61730000ull, 0x6461746162617365ull, 0x6464720000000000ull,
+    0x6465636f72617469ull, 0x64656c6177617265ull, 0x64656c6d656e686full, 0x64656e6d61726b00ull,
+    0x6465706f74000000ull, 0x64657369676e0000ull, 0x646574726f697400ull, 0x64696e6f73617572ull,
+    0x646973636f766572ull, 0x646f6c6c73000000ull, 0x646f6e6f73746961ull, 0x64757268616d0000ull,
+    0x6561737461667269ull, 0x65617374636f6173ull, 0x656475636174696full, 0x656475636174696full,
+    0x656779707469616eull, 0x656973656e626168ull, 0x656c627572670000ull, 0x656c76656e647265ull,
+    0x656d62726f696465ull, 0x656e6379636c6f70ull, 0x656e676c616e6400ull, 0x656e746f6d6f6c6full,
+    0x656e7669726f6e6dull, 0x656e7669726f6e6dull, 0x6570696c65707379ull, 0x6573736578000000ull,
+    0x6573746174650000ull, 0x6574686e6f6c6f67ull, 0x6578657465720000ull, 0x6578686962697469ull,
+    0x66616d696c790000ull, 0x6661726d00000000ull, 0x6661726d65717569ull, 0x6661726d65727300ull,
+    0x6661726d73746561ull, 0x6669656c64000000ull, 0x6669677565726573ull, 0x66696c6174656c69ull,
+    0x66696c6d00000000ull, 0x66696e6561727400ull, 0x66696e6561727473ull, 0x66696e6c616e6400ull,
+    0x666c616e64657273ull, 0x666c6f7269646100ull, 0x666f726365000000ull, 0x666f72746d697373ull,
+    0x666f7274776f7274ull, 0x666f756e64617469ull, 0x6672616e63616973ull, 0x6672616e6b667572ull,
+    0x6672616e7a69736bull, 0x667265656d61736full, 0x6672656962757267ull, 0x667269626f757267ull,
+    0x66726f6700000000ull, 0x66756e646163696full, 0x6675726e69747572ull, 0x67616c6c65727900ull,
+    0x67617264656e0000ull, 0x6761746577617900ull, 0x6765656c76696e63ull, 0x67656d6f6c6f6769ull,
+    0x67656f6c6f677900ull, 0x67656f7267696100ull, 0x6769657373656e00ull, 0x676c617300000000ull,
+    0x676c617373000000ull, 0x676f726765000000ull, 0x6772616e64726170ull, 0x6772617a00000000ull,
+    0x677565726e736579ull, 0x68616c6c6f666661ull, 0x68616d6275726700ull, 0x68616e64736f6e00ull,
+    0x6861727665737463ull, 0x6861776169690000ull, 0x6865616c74680000ull, 0x6865696d6174756eull,
+    0x68656c6c61730000ull, 0x68656c73696e6b69ull, 0x68656d6279676473ull, 0x6865726974616765ull,
+    0x686973746f697265ull, 0x686973746f726963ull, 0x686973746f726963ull, 0x686973746f726963ull,
+    0x686973746f726973ull, 0x686973746f726973ull, 0x686973746f727900ull, 0x686973746f72796full,
+    0x686f726f6c6f6779ull, 0x686f757365000000ull, 0x68756d616e697469ull, 0x696c6c7573747261ull,
+    0x696d616765616e64ull, 0x696e6469616e0000ull, 0x696e6469616e6100ull, 0x696e6469616e6170ull,
+    0x696e6469616e6d61ull, 0x696e74656c6c6967ull, 0x696e746572616374ull, 0x6972617100000000ull,
+    0x69726f6e00000000ull, 0x69736c656f666d61ull, 0x6a616d69736f6e00ull, 0x6a6566666572736full,
+    0x6a65727573616c65ull, 0x6a6577656c727900ull, 0x6a65776973680000ull, 0x6a65776973686172ull,
+    0x6a666b0000000000ull, 0x6a6f75726e616c69ull, 0x6a75646169636100ull, 0x6a7564796761726cull,
+    0x6a75656469736368ull, 0x6a75696600000000ull, 0x6b61726174650000ull, 0x6b6172696b617475ull,
+    0x6b69647300000000ull, 0x6b6f6562656e6861ull, 0x6b6f656c6e000000ull, 0x6b756e7374000000ull,
+    0x6b756e737473616dull, 0x6b756e7374756e64ull, 0x6c61626f72000000ull, 0x6c61626f75720000ull,
+    0x6c616a6f6c6c6100ull, 0x6c616e6361736869ull, 0x6c616e6465730000ull, 0x6c616e7300000000ull,
+    0x6c617273736f6e00ull, 0x6c657769736d696cull, 0x6c696e636f6c6e00ull, 0x6c696e7a00000000ull,
+    0x6c6976696e670000ull, 0x6c6976696e676869ull, 0x6c6f63616c686973ull, 0x6c6f6e646f6e0000ull,
+    0x6c6f73616e67656cull, 0x6c6f757672650000ull, 0x6c6f79616c697374ull, 0x6c756365726e6500ull,
+    0x6c7578656d626f75ull, 0x6c757a65726e0000ull, 0x6cc3a46e73000000ull, 0x6d61640000000000ull,
+    0x6d61647269640000ull, 0x6d616c6c6f726361ull, 0x6d616e6368657374ull, 0x6d616e73696f6e00ull,
+    0x6d616e73696f6e73ull, 0x6d616e7800000000ull, 0x6d61726275726700ull, 0x6d61726974696d65ull,
+    0x6d61726974696d6full, 0x6d6172796c616e64ull, 0x6d6172796c687572ull, 0x6d65646961000000ull,
+    0x6d65646963616c00ull, 0x6d6564697a696e68ull, 0x6d65657265730000ull, 0x6d656d6f7269616cull,
+    0x6d65736176657264ull, 0x6d6963686967616eull, 0x6d696461746c616eull, 0x6d696c6974617279ull,
+    0x6d696c6c00000000ull, 0x6d696e6572730000ull, 0x6d696e696e670000ull, 0x6d696e6e65736f74ull,
+    0x6d697373696c6500ull, 0x6d6973736f756c61ull, 0x6d6f6465726e0000ull, 0x6d6f6d6100000000ull,
+    0x6d6f6e6579000000ull, 0x6d6f6e6d6f757468ull, 0x6d6f6e746963656cull, 0x6d6f6e747265616cull,
+    0x6d6f73636f770000ull, 0x6d6f746f72637963ull, 0x6d75656e6368656eull, 0x6d75656e73746572ull,
+    0x6d756c686f757365ull, 0x6d756e6369650000ull, 0x6d75736565740000ull, 0x6d757365756d6365ull,
+    0x6d757365756d7665ull, 0x6d75736963000000ull, 0x6e6174696f6e616cull, 0x6e6174696f6e616cull,
+    0x6e6174696f6e616cull, 0x6e6174697665616dull, 0x6e61747572616c68ull, 0x6e61747572616c68ull,
+    0x6e61747572616c73ull, 0x6e61747572650000ull, 0x6e61747572686973ull, 0x6e61747575727765ull,
+    0x6e61756d62757267ull, 0x6e6176616c000000ull, 0x6e65627261736b61ull, 0x6e65756573000000ull,
+    0x6e657768616d7073ull, 0x6e65776a65727365ull, 0x6e65776d65786963ull, 0x6e6577706f727400ull,
+    0x6e65777370617065ull, 0x6e6577796f726b00ull, 0x6e69657063650000ull, 0x6e6f72666f6c6b00ull,
+    0x6e6f727468000000ull, 0x6e72770000000000ull, 0x6e79630000000000ull, 0x6e796e7900000000ull,
+    0x6f6365616e6f6772ull, 0x6f6365616e6f6772ull, 0x6f6d616861000000ull, 0x6f6e6c696e650000ull,
+    0x6f6e746172696f00ull, 0x6f70656e61697200ull, 0x6f7265676f6e0000ull, 0x6f7265676f6e7472ull,
+    0x6f7461676f000000ull, 0x6f78666f72640000ull, 0x7061636966696300ull, 0x7061646572626f72ull,
+    0x70616c6163650000ull, 0x70616c656f000000ull, 0x70616c6d73707269ull, 0x70616e616d610000ull,
+    0x7061726973000000ull, 0x7061736164656e61ull, 0x706861726d616379ull, 0x7068696c6164656cull,
+    0x7068696c6164656cull, 0x7068696c6174656cull, 0x70686f656e697800ull, 0x70686f746f677261ull,
+    0x70696c6f74730000ull, 0x7069747473627572ull, 0x706c616e65746172ull, 0x706c616e74617469ull,
+    0x706c616e74730000ull, 0x706c617a61000000ull, 0x706f7274616c0000ull, 0x706f72746c616e64ull,
+    0x706f72746c6c6967ull, 0x706f7374732d616eull, 0x7072657365727661ull, 0x707265736964696full,
+    0x7072657373000000ull, 0x70726f6a65637400ull, 0x7075626c69630000ull, 0x7075626f6c000000ull,
+    0x7175656265630000ull, 0x7261696c726f6164ull, 0x7261696c77617900ull, 0x7265736561726368ull,
+    0x726573697374616eull, 0x72696f64656a616eull, 0x726f636865737465ull, 0x726f636b61727400ull,
+    0x726f6d6100000000ull, 0x7275737369610000ull, 0x7361696e746c6f75ull, 0x73616c656d000000ull,
+    0x73616c7661646f72ull, 0x73616c7a62757267ull, 0x73616e646965676full, 0x73616e6672616e63ull,
+    0x73616e7461626172ull, 0x73616e7461637275ull, 0x73616e7461666500ull, 0x7361736b61746368ull,
+    0x7361747800000000ull, 0x736176616e6e6168ull, 0x7363686c65736973ull, 0x7363686f656e6272ull,
+    0x7363686f6b6f6c61ull, 0x7363686f6f6c0000ull, 0x7363687765697a00ull, 0x736369656e636500ull,
+    0x736369656e63652dull, 0x736369656e636561ull, 0x736369656e636561ull, 0x736369656e636563ull,
+    0x736369656e636563ull, 0x736369656e636568ull, 0x736369656e636573ull, 0x736369656e636573ull,
+    0x73636f746c616e64ull, 0x736561706f727400ull, 0x736574746c656d65ull, 0x736574746c657273ull,
+    0x7368656c6c000000ull, 0x7368657262726f6full, 0x736962656e696b00ull, 0x73696c6b00000000ull,
+    0x736b690000000000ull, 0x736b6f6c65000000ull, 0x736f636965747900ull, 0x736f6c6f676e6500ull,
+    0x736f756e64616e64ull, 0x736f757468636172ull, 0x736f757468776573ull, 0x7370616365000000ull,
+    0x7370790000000000ull, 0x7371756172650000ull, 0x7374616474000000ull, 0x7374616c62616e73ull,
+    0x737461726e626572ull, 0x7374617465000000ull, 0x73746174656f6664ull, 0x73746174696f6e00ull,
+    0x737465616d000000ull, 0x7374656965726d61ull, 0x73746a6f686e0000ull, 0x73746f636b686f6cull,
+    0x7374706574657273ull, 0x7374757474676172ull, 0x7375697373650000ull, 0x73757267656f6e73ull,
+    0x7375727265790000ull, 0x7376697a7a657261ull, 0x73776564656e0000ull, 0x7379646e65790000ull,
+    0x74616e6b00000000ull, 0x74636d0000000000ull, 0x746563686e6f6c6full, 0x74656c656b6f6d6dull,
+    0x74656c6576697369ull, 0x7465786173000000ull, 0x74657874696c6500ull, 0x7468656174657200ull,
+    0x74696d6500000000ull, 0x74696d656b656570ull, 0x746f706f6c6f6779ull, 0x746f72696e6f0000ull,
+    0x746f756368000000ull, 0x746f776e00000000ull, 0x7472616e73706f72ull, 0x7472656500000000ull,
+    0x74726f6c6c657900ull, 0x7472757374000000ull, 0x7472757374656500ull, 0x756872656e000000ull,
+    0x756c6d0000000000ull, 0x756e646572736561ull, 0x756e697665727369ull, 0x7573610000000000ull,
+    0x7573616e74697175ull, 0x7573617274730000ull, 0x7573636f756e7472ull, 0x757363756c747572ull,
+    0x75736465636f7261ull, 0x757367617264656eull, 0x7573686973746f72ull, 0x7573687561696100ull,
+    0x75736c6976696e67ull, 0x7574616800000000ull, 0x7576696300000000ull, 0x76616c6c65790000ull,
+    0x76616e7461610000ull, 0x7665727361696c6cull, 0x76696b696e670000ull, 0x76696c6c61676500ull,
+    0x76697267696e6961ull, 0x7669727475616c00ull, 0x7669727475656c00ull, 0x766c61616e646572ull,
+    0x766f6c6b656e6b75ull, 0x77616c6573000000ull, 0x77616c6c6f6e6965ull, 0x7761720000000000ull,
+    0x77617368696e6774ull, 0x77617463682d616eull, 0x7761746368616e64ull, 0x7765737465726e00ull,
+    0x7765737466616c65ull, 0x7768616c696e6700ull, 0x77696c646c696665ull, 0x77696c6c69616d73ull,
+    0x77696e646d696c6cull, 0x776f726b73686f70ull, 0x786e2d2d39646268ull, 0x786e2d2d636f6d75ull,
+    0x786e2d2d636f7272ull, 0x786e2d2d68316165ull, 0x786e2d2d6c6e732dull, 0x796f726b00000000ull,
+    0x796f726b73686972ull, 0x796f73656d697465ull, 0x796f757468000000ull, 0x7a6f6f6c6f676963ull,
+    0x7a6f6f6c6f677900ull, 0xd0b8d0bad0bed0bcull, 0xd799d7a8d795d7a9ull, 0x6165726f00000000ull,
+    0x62697a0000000000ull, 0x636f6d0000000000ull, 0x636f6f7000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x696e666f00000000ull, 0x696e740000000000ull, 0x6d696c0000000000ull,
+    0x6d757365756d0000ull, 0x6e616d6500000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x70726f0000000000ull, 0x6163000000000000ull, 0x62697a0000000000ull, 0x636f000000000000ull,
+    0x636f6d0000000000ull, 0x636f6f7000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x696e740000000000ull, 0x6d757365756d0000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x626c6f6773706f74ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f620000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x62697a0000000000ull, 0x626c6f6773706f74ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x6d696c0000000000ull,
+    0x6e616d6500000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x6163000000000000ull,
+    0x6164760000000000ull, 0x636f000000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x6361000000000000ull,
+    0x6363000000000000ull, 0x636f000000000000ull, 0x636f6d0000000000ull, 0x6472000000000000ull,
+    0x696e000000000000ull, 0x696e666f00000000ull, 0x6d6f626900000000ull, 0x6d78000000000000ull,
+    0x6e616d6500000000ull, 0x6f72000000000000ull, 0x6f72670000000000ull, 0x70726f0000000000ull,
+    0x7363686f6f6c0000ull, 0x7476000000000000ull, 0x7573000000000000ull, 0x7773000000000000ull,
+    0x6865720000000000ull, 0x6869730000000000ull, 0x6173736f00000000ull, 0x6e6f6d0000000000ull,
+    0x61646f626561656dull, 0x61646f6265696f2dull, 0x61646f6265696f72ull, 0x616b61646e730000ull,
+    0x616b616d61690000ull, 0x616b616d61692d73ull, 0x616b616d61696564ull, 0x616b616d61696564ull,
+    0x616b616d61696864ull, 0x616b616d61696864ull, 0x616b616d61696f72ull, 0x616b616d61696f72ull,
+    0x616b616d61697a65ull, 0x616b616d61697a65ull, 0x616c776179736461ull, 0x61707075646f0000ull,
+    0x61742d62616e642dull, 0x61746c6173736961ull, 0x617a7572652d6d6full, 0x617a757265737461ull,
+    0x617a757265776562ull, 0x6261723000000000ull, 0x6261723100000000ull, 0x6261723200000000ull,
+    0x6261727379000000ull, 0x6269746272696467ull, 0x626c61636b626175ull, 0x626c6f67646e7300ull,
+    0x626f6f6d6c610000ull, 0x626f756e63656d65ull, 0x62706c6163656400ull, 0x62726f6b652d6974ull,
+    0x62757973686f7573ull, 0x6361736163616d00ull, 0x63646e2d65646765ull, 0x63646e3737000000ull,
+    0x63646e37372d7373ull, 0x6368616e6e656c73ull, 0x636c69636b726973ull, 0x636c6f7564616363ull,
+    0x636c6f7564617070ull, 0x636c6f756466726full, 0x636c6f756466756eull, 0x636c6f75646a6966ull,
+    0x636c6f756479636cull, 0x636f6d6d756e6974ull, 0x63727970746f6e6full, 0x646174746f6c6f63ull,
+    0x64646e7300000000ull, 0x64656269616e0000ull, 0x646566696e696d61ull, 0x646e73616c696173ull,
+    0x646e73646f6a6f00ull, 0x646e737570000000ull, 0x646f65732d697400ull, 0x646f6e7465786973ull,
+    0x64736d796e617300ull, 0x64796e616c696173ull, 0x64796e6174686f6dull, 0x64796e7500000000ull,
+    0x64796e7636000000ull, 0x656174696e672d6full, 0x6564676561707000ull, 0x656467656b657900ull,
+    0x656467656b65792dull, 0x6564676573756974ull, 0x6564676573756974ull, 0x656c617374780000ull,
+    0x656e646f66696e74ull, 0x66616d696c796473ull, 0x666173746c790000ull, 0x666173746c796c62ull,
+    0x6661737473746163ull, 0x66657374652d6970ull, 0x6669726577616c6cull, 0x666c796e6e686f73ull,
+    0x66726f6d2d617a00ull, 0x66726f6d2d636f00ull, 0x66726f6d2d6c6100ull, 0x66726f6d2d6e7900ull,
+    0x6762000000000000ull, 0x676574732d697400ull, 0x68616d2d72616469ull, 0x686574656d6c0000ull,
+    0x686963616d000000ull, 0x686f6d6566747000ull, 0x686f6d6569700000ull, 0x686f6d656c696e75ull,
+    0x686f6d65756e6978ull, 0x6875000000000000ull, 0x696e000000000000ull, 0x696e2d64736c0000ull,
+    0x696e2d7468652d62ull, 0x696e2d76706e0000ull, 0x696f626200000000ull, 0x697069666f6e7900ull,
+    0x69732d612d636865ull, 0x69732d612d676565ull, 0x6973612d6765656bull, 0x6a70000000000000ull,
+    0x6b69636b732d6173ull, 0x6b696e67686f7374ull, 0x6b6e782d73657276ull, 0x6b72656c6c69616eull,
+    0x6d61737369766567ull, 0x6d65696e666f7275ull, 0x6d656d7365740000ull, 0x6d6f6f6e7363616cull,
+    0x6d79616d617a6500ull, 0x6d79646174746f00ull, 0x6d7964697373656eull, 0x6d79656666656374ull,
+    0x6d79667269747a00ull, 0x6d796d6564696170ull, 0x6d79707378000000ull, 0x6d79736563757269ull,
+    0x6d79737072656164ull, 0x6e686c66616e0000ull, 0x6e6f2d6970000000ull, 0x6e6f772d646e7300ull,
+    0x6f66666963652d6full, 0x6f6e617673746163ull, 0x6f76680000000000ull, 0x6f776e6970000000ull,
+    0x70676166616e0000ull, 0x706f647a6f6e6500ull, 0x707269766174697aull, 0x7261636b6d617a65ull,
+    0x7265646972656374ull, 0x726573657276652dull, 0x7275000000000000ull, 0x73617665696e636cull,
+    0x7363616c65666f72ull, 0x7363686f6b6f6b65ull, 0x7363726170706572ull, 0x7365000000000000ull,
+    0x7365696461740000ull, 0x73656c6669700000ull, 0x73656c6c732d6974ull, 0x73656e7365657269ull,
+    0x7365727665626273ull, 0x7365727665626c6full, 0x7365727665667470ull, 0x73657276656d696eull,
+    0x73686f7073656c65ull, 0x736974656c656166ull, 0x7371756172653700ull, 0x7372636600000000ull,
+    0x7374617469632d61ull, 0x7375706162617365ull, 0x7379746573000000ull, 0x74336c3370307274ull,
+    0x7461696c7363616cull, 0x7468727568657265ull, 0x746f7270726f6a65ull, 0x7473000000000000ull,
+    0x7473756b61657275ull, 0x74776d61696c0000ull, 0x756b000000000000ull, 0x756e693500000000ull,
+    0x76706e646e730000ull, 0x7670732d686f7374ull, 0x776562686f700000ull, 0x79616e646578636cull,
+    0x7a61000000000000ull, 0x616c636573000000ull, 0x6172766f00000000ull, 0x617a696d75746800ull,
+    0x636f000000000000ull, 0x746c6f6e00000000ull, 0x6e6f746963656162ull, 0x6172747300000000ull,
+    0x636f6d0000000000ull, 0x6669726d00000000ull, 0x696e666f00000000ull, 0x6e65740000000000ull,
+    0x6f74686572000000ull, 0x7065720000000000ull, 0x7265630000000000ull, 0x73746f7265000000ull,
+    0x7765620000000000ull, 0x636f6c0000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x6669726d00000000ull, 0x67656e0000000000ull, 0x676f760000000000ull, 0x6900000000000000ull,
+    0x6c74640000000000ull, 0x6d696c0000000000ull, 0x6d6f626900000000ull, 0x6e616d6500000000ull,
+    0x6e65740000000000ull, 0x6e676f0000000000ull, 0x6f72670000000000ull, 0x7363680000000000ull,
+    0x6163000000000000ull, 0x62697a0000000000ull, 0x636f000000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f620000000000ull, 0x696e000000000000ull, 0x696e666f00000000ull,
+    0x696e740000000000ull, 0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6e6f6d0000000000ull,
+    0x6f72670000000000ull, 0x7765620000000000ull, 0x3132337765627369ull, 0x626c6f6773706f74ull,
+    0x63697374726f6e00ull, 0x636f000000000000ull, 0x64656d6f6e000000ull, 0x676f760000000000ull,
+    0x686f7374696e672dull, 0x6b68706c61790000ull, 0x6d79737072656164ull, 0x7472616e7375726cull,
+    0x313233686a656d6dull, 0x6161000000000000ull, 0x616172626f727465ull, 0x61656a7269650000ull,
+    0x61666a6f72640000ull, 0x616764656e657300ull, 0x6168000000000000ull, 0x616b657273687573ull,
+    0x616b6e6f6c756f6bull, 0x616b726568616d6eull, 0x616c000000000000ull, 0x616c61686561646aull,
+    0x616c6573756e6400ull, 0x616c676172640000ull, 0x616c737461686175ull, 0x616c746100000000ull,
+    0x616c7664616c0000ull, 0x616d6c6900000000ull, 0x616d6f7400000000ull, 0x616e646173756f6cull,
+    0x616e646562750000ull, 0x616e646f79000000ull, 0x616e64c3b8790000ull, 0x617264616c000000ull,
+    0x6172656d61726b00ull, 0x6172656e64616c00ull, 0x61726e6100000000ull, 0x61736572616c0000ull,
+    0x61736b6572000000ull, 0x61736b696d000000ull, 0x61736b6f79000000ull, 0x61736b766f6c6c00ull,
+    0x61736bc3b8790000ull, 0x61736e6573000000ull, 0x6175646e6564616cull, 0x61756b7261000000ull,
+    0x6175726500000000ull, 0x6175726c616e6400ull, 0x617572736b6f672dull, 0x617572736b6f672dull,
+    0x6175737465766f6cull, 0x6175737472686569ull, 0x617665726f790000ull, 0x61766572c3b87900ull,
+    0x6261646164646a61ull, 0x626168636176756full, 0x6261686363617675ull, 0x6261696461720000ull,
+    0x62616a6464617200ull, 0x62616c6174000000ull, 0x62616c6573747261ull, 0x62616c6c616e6765ull,
+    0x62616c73666a6f72ull, 0x62616d626c650000ull, 0x6261726475000000ull, 0x626172756d000000ull,
+    0x62617473666a6f72ull, 0x62656172616c7661ull, 0x62656172616c76c3ull, 0x6265617264750000ull,
+    0x62656961726e0000ull, 0x6265726700000000ull, 0x62657267656e0000ull, 0x6265726c65766167ull,
+    0x6265726c6576c3a5ull, 0x6269657661740000ull, 0x62696576c3a17400ull, 0x62696e64616c0000ull,
+    0x6269726b656e6573ull, 0x626a61726b6f7900ull, 0x626a61726bc3b879ull, 0x626a65726b726569ull,
+    0x626a75676e000000ull, 0x626c6f6773706f74ull, 0x626f646f00000000ull, 0x626f64c3b8000000ull,
+    0x626f6b6e00000000ull, 0x626f6d6c6f000000ull, 0x6272656d616e6765ull, 0x62726f6e6e6f7900ull,
+    0x62726f6e6e6f7973ull, 0x6272756d756e6464ull, 0x6272796e65000000ull, 0x6272c3b86e6ec3b8ull,
+    0x6272c3b86e6ec3b8ull, 0x6275000000000000ull, 0x627564656a6a7500ull, 0x6275736b65727564ull,
+    0x6279676c616e6400ull, 0x62796b6c65000000ull, 0x62c3a16863617675ull, 0x62c3a16863636176ull,
+    0x62c3a16964c3a172ull, 0x62c3a16a64646172ull, 0x62c3a16cc3a17400ull, 0x62c3a564c3a56464ull,
+    0x62c3a57473666a6full, 0x62c3a672756d0000ull, 0x62c3b86d6c6f0000ull, 0x636168636573756full,
+    0x636f000000000000ull, 0x64617676656e6a61ull, 0x64617676656e6ac3ull, 0x6461767665736969ull,
+    0x646561746e750000ull, 0x6465700000000000ull, 0x6469656c6464616eull, 0x6469767461737675ull,
+    0x6469767474617376ull, 0x646f6e6e61000000ull, 0x646f767265000000ull, 0x6472616d6d656e00ull,
+    0x6472616e67656461ull, 0x64726f62616b0000ull, 0x6472c3b862616b00ull, 0x6479726f79000000ull,
+    0x647972c3b8790000ull, 0x64c3b86e6e610000ull, 0x6567657273756e64ull, 0x6569640000000000ull,
+    0x656964666a6f7264ull, 0x6569647362657267ull, 0x656964736b6f6700ull, 0x65696473766f6c6cull,
+    0x656967657273756eull, 0x656c766572756d00ull, 0x656e6562616b6b00ull, 0x656e67657264616cull,
+    0x65746e6500000000ull, 0x65746e6564616c00ull, 0x6576656e61737369ull, 0x6576656e65730000ull,
+    0x6576656ec3a1c5a1ull, 0x65766a652d6f672dull, 0x66617273756e6400ull, 0x666175736b650000ull,
+    0x6665646a65000000ull, 0x6665740000000000ull, 0x66657473756e6400ull, 0x6668730000000000ull,
+    0x66696e6e6f790000ull, 0x66696e6ec3b87900ull, 0x6669746a61720000ull, 0x666a616c65720000ull,
+    0x666a656c6c000000ull, 0x666c610000000000ull, 0x666c616b73746164ull, 0x666c6174616e6765ull,
+    0x666c656b6b65666aull, 0x666c657362657267ull, 0x666c6f7261000000ull, 0x666c6f726f000000ull,
+    0x666c6f72c3b80000ull, 0x666cc3a500000000ull, 0x666d000000000000ull, 0x666f6c6b65626962ull,
+    0x666f6c6c64616c00ull, 0x666f726465000000ull, 0x666f7273616e6400ull, 0x666f736e65730000ull,
+    0x6672616e61000000ull, 0x6672656472696b73ull, 0x6672656900000000ull, 0x66726f676e000000ull,
+    0x66726f6c616e6400ull, 0x66726f7374610000ull, 0x66726f7961000000ull, 0x6672c3a66e610000ull,
+    0x6672c3b879610000ull, 0x66756f69736b7500ull, 0x66756f73736b6f00ull, 0x6675736100000000ull,
+    0x66796c6b65736269ull, 0x667972657364616cull, 0x66c3b87264650000ull, 0x67616976756f746eull,
+    0x67616c7361000000ull, 0x67616d76696b0000ull, 0x67616e6761766969ull, 0x6761756c61720000ull,
+    0x6761757364616c00ull, 0x6769656874617675ull, 0x67696c6465736b61ull, 0x67696c6465736bc3ull,
+    0x6769736b65000000ull, 0x676a656d6e657300ull, 0x676a65726472756dull, 0x676a657273746164ull,
+    0x676a657364616c00ull, 0x676a6f76696b0000ull, 0x676ac3b876696b00ull, 0x676c6f7070656e00ull,
+    0x676f6c0000000000ull, 0x6772616e00000000ull, 0x6772616e65000000ull, 0x6772616e76696e00ull,
+    0x67726174616e6765ull, 0x6772696d73746164ull, 0x67726f6e67000000ull, 0x6772756500000000ull,
+    0x67756c656e000000ull, 0x67756f7664616765ull, 0x67c3a16976756f74ull, 0x67c3a16c73c3a100ull,
+    0x67c3a1c58b676176ull, 0x6861000000000000ull, 0x6861626d65720000ull, 0x68616473656c0000ull,
+    0x68616765626f7374ull, 0x68616c64656e0000ull, 0x68616c7361000000ull, 0x68616d6172000000ull,
+    0x68616d61726f7900ull, 0x68616d6d61726665ull, 0x68616d6d65726665ull, 0x6861706d69720000ull,
+    0x686172616d000000ull, 0x6861726569640000ull, 0x6861727374616400ull, 0x68617376696b0000ull,
+    0x68617474666a656cull, 0x686175676573756eull, 0x6865646d61726b00ull, 0x68656d6e65000000ull,
+    0x68656d6e65730000ull, 0x68656d736564616cull, 0x6865726164000000ull, 0x6869747261000000ull,
+    0x686a61727464616cull, 0x686a656c6d656c61ull, 0x686c000000000000ull, 0x686d000000000000ull,
+    0x686f626f6c000000ull, 0x686f62c3b86c0000ull, 0x686f660000000000ull, 0x686f6b6b73756e64ull,
+    0x686f6c0000000000ull, 0x686f6c6500000000ull, 0x686f6c6d65737472ull, 0x686f6c74616c656eull,
+    0x686f6c74c3a56c65ull, 0x686f6e65666f7373ull, 0x686f7264616c616eull, 0x686f726e696e6461ull,
+    0x686f7274656e0000ull, 0x686f79616e676572ull, 0x686f796c616e6465ull, 0x68757264616c0000ull,
+    0x687572756d000000ull, 0x6876616c65720000ull, 0x68796c6c65737461ull, 0x68c3a1626d657200ull,
+    0x68c3a16d6dc3a172ull, 0x68c3a1706d697200ull, 0x68c3a50000000000ull, 0x68c3a66765626f73ull,
+    0x68c3b86e65666f73ull, 0x68c3b879616e6765ull, 0x68c3b8796c616e64ull, 0x6962657374616400ull,
+    0x6964726574740000ull, 0x696e6465726f7900ull, 0x696e646572c3b879ull, 0x6976656c616e6400ull,
+    0x6976677500000000ull, 0x6a616e2d6d617965ull, 0x6a6573736865696dull, 0x6a65766e616b6572ull,
+    0x6a6f6c7374657200ull, 0x6a6f6e64616c0000ull, 0x6a6f7270656c616eull, 0x6ac3b86c73746572ull,
+    0x6ac3b87270656c61ull, 0x6b61666a6f726400ull, 0x6b617261736a6f68ull, 0x6b617261736a6f6bull,
+    0x6b61726c736f7900ull, 0x6b61726d6f790000ull, 0x6b61726dc3b87900ull, 0x6b6175746f6b6569ull,
+    0x6b69726b656e6573ull, 0x6b6c616275000000ull, 0x6b6c657070000000ull, 0x6b6cc3a662750000ull,
+    0x6b6f6d6d756e6500ull, 0x6b6f6e6773626572ull, 0x6b6f6e677376696eull, 0x6b6f70657276696bull,
+    0x6b7261616e67686bull, 0x6b72616765726f00ull, 0x6b7261676572c3b8ull, 0x6b7269737469616eull,
+    0x6b7269737469616eull, 0x6b726f6473686572ull, 0x6b726f6b73746164ull, 0x6b72c3a5616e6768ull,
+    0x6b72c3b864736865ull, 0x6b7661666a6f7264ull, 0x6b76616c73756e64ull, 0x6b76616d00000000ull,
+    0x6b76616e616e6765ull, 0x6b76696e65736461ull, 0x6b76696e6e686572ull, 0x6b76697465736569ull,
+    0x6b766974736f7900ull, 0x6b76697473c3b879ull, 0x6b76c3a6666a6f72ull, 0x6b76c3a66e616e67ull,
+    0x6bc3a172c3a1c5a1ull, 0x6bc3a5666a6f7264ull, 0x6c61616b65737675ull, 0x6c61687070690000ull,
+    0x6c616e6765766167ull, 0x6c616e676576c3a5ull, 0x6c617264616c0000ull, 0x6c617276696b0000ull,
+    0x6c61766167697300ull, 0x6c6176616e67656eull, 0x6c65616e67617669ull, 0x6c6561c58b676176ull,
+    0x6c65626573627900ull, 0x6c65696b616e6765ull, 0x6c656972666a6f72ull, 0x6c65697276696b00ull,
+    0x6c656b6100000000ull, 0x6c656b7376696b00ull, 0x6c656e76696b0000ull, 0x6c657264616c0000ull,
+    0x6c65736a61000000ull, 0x6c6576616e676572ull, 0x6c69657200000000ull, 0x6c6965726e650000ull,
+    0x6c696c6c6568616dull, 0x6c696c6c6573616eull, 0x6c696e6461730000ull, 0x6c696e6465736e65ull,
+    0x6c696e64c3a57300ull, 0x6c6f616261740000ull, 0x6c6f6162c3a17400ull, 0x6c6f64696e67656eull,
+    0x6c6f6d0000000000ull, 0x6c6f707061000000ull, 0x6c6f72656e736b6full, 0x6c6f74656e000000ull,
+    0x6c756e6400000000ull, 0x6c756e6e65720000ull, 0x6c75726f79000000ull, 0x6c7572c3b8790000ull,
+    0x6c75737465720000ull, 0x6c796e6764616c00ull, 0x6c796e67656e0000ull, 0x6cc3a16870706900ull,
+    0x6cc3a67264616c00ull, 0x6cc3b864696e6765ull, 0x6cc3b872656e736bull, 0x6cc3b874656e0000ull,
+    0x6d616c617476756full, 0x6d616c73656c7600ull, 0x6d616c76696b0000ull, 0x6d616e64616c0000ull,
+    0x6d61726b65720000ull, 0x6d61726e61726461ull, 0x6d6173666a6f7264ull, 0x6d61736f79000000ull,
+    0x6d617474612d7661ull, 0x6d656c616e640000ull, 0x6d656c64616c0000ull, 0x6d656c6875730000ull,
+    0x6d656c6f79000000ull, 0x6d656cc3b8790000ull, 0x6d6572616b657200ull, 0x6d6572c3a56b6572ull,
+    0x6d696473756e6400ull, 0x6d69647472652d67ull, 0x6d696c0000000000ull, 0x6d6a6f6e64616c65ull,
+    0x6d6ac3b86e64616cull, 0x6d6f2d692d72616eull, 0x6d6f6172656b6500ull, 0x6d6f64616c656e00ull,
+    0x6d6f64756d000000ull, 0x6d6f6c6465000000ull, 0x6d6f72652d6f672dull, 0x6d6f736a6f656e00ull,
+    0x6d6f736ac3b8656eull, 0x6d6f736b656e6573ull, 0x6d6f737300000000ull, 0x6d6f7376696b0000ull,
+    0x6d6fc3a572656b65ull, 0x6d72000000000000ull, 0x6d756f7361740000ull, 0x6d756f73c3a17400ull,
+    0x6d757365756d0000ull, 0x6d79737072656164ull, 0x6dc3a16c61747675ull, 0x6dc3a17474612d76ull,
+    0x6dc3a56c73656c76ull, 0x6dc3a573c3b87900ull, 0x6dc3b872652d6f67ull, 0x6e61616d65736a65ull,
+    0x6e616d64616c7365ull, 0x6e616d736f730000ull, 0x6e616d73736b6f67ull, 0x6e616e6e65737461ull,
+    0x6e61726f79000000ull, 0x6e61727669696b61ull, 0x6e617276696b0000ull, 0x6e6175737464616cull,
+    0x6e6176756f746e61ull, 0x6e656472652d6569ull, 0x6e65736e61000000ull, 0x6e65736f6464656eull,
+    0x6e65736f64647461ull, 0x6e65737365627900ull, 0x6e65737365740000ull, 0x6e6973736564616cull,
+    0x6e6974746564616cull, 0x6e6c000000000000ull, 0x6e6f72642d617572ull, 0x6e6f72642d66726full,
+    0x6e6f72642d6f6461ull, 0x6e6f726464616c00ull, 0x6e6f72646b617070ull, 0x6e6f72646c616e64ull,
+    0x6e6f726472652d6cull, 0x6e6f726472656973ull, 0x6e6f72652d6f672dull, 0x6e6f746f6464656eull,
+    0x6e6f747465726f79ull, 0x6e74000000000000ull, 0x6ec3a176756f746eull, 0x6ec3a5c3a56d6573ull,
+    0x6ec3a672c3b87900ull, 0x6ec3b874746572c3ull, 0x6f64646100000000ull, 0x6f66000000000000ull,
+    0x6f6b736e65730000ull, 0x6f6c000000000000ull, 0x6f6d617376756f74ull, 0x6f707064616c0000ull,
+    0x6f70706567617264ull, 0x6f70706567c3a572ull, 0x6f726b616e676572ull, 0x6f726b64616c0000ull,
+    0x6f726c616e640000ull, 0x6f72736b6f670000ull, 0x6f72737461000000ull, 0x6f73656e00000000ull,
+    0x6f736c6f00000000ull, 0x6f736f79726f0000ull, 0x6f737465726f7900ull, 0x6f73746572c3b879ull,
+    0x6f7374666f6c6400ull, 0x6f737472652d746full, 0x6f73c3b879726f00ull, 0x6f76657268616c6cull,
+    0x6f7672652d65696bull, 0x6f79657200000000ull, 0x6f7967617264656eull, 0x6f79737472652d73ull,
+    0x706f7273616e6765ull, 0x706f7273616e6775ull, 0x706f72736772756eull, 0x706f7273c3a1c58bull,
+    0x7072697600000000ull, 0x7261646500000000ull, 0x7261646f79000000ull, 0x726164c3b8790000ull,
+    0x7261686b6b657261ull, 0x7261686f6c740000ull, 0x7261697361000000ull, 0x72616b6b65737461ull,
+    0x72616c696e67656eull, 0x72616e6100000000ull, 0x72616e6461626572ull, 0x7261756d61000000ull,
+    0x72656e64616c656eull, 0x72656e6e65627500ull, 0x72656e6e65736f79ull, 0x72656e6e6573c3b8ull,
+    0x72696e64616c0000ull, 0x72696e6765627500ull, 0x72696e676572696bull, 0x72696e6773616b65ull,
+    0x7269736f72000000ull, 0x7269737361000000ull, 0x726973c3b8720000ull, 0x726c000000000000ull,
+    0x726f616e00000000ull, 0x726f646f79000000ull, 0x726f6c6c61670000ull, 0x726f6d7361000000ull,
+    0x726f6d736b6f6700ull, 0x726f726f73000000ull, 0x726f737400000000ull, 0x726f796b656e0000ull,
+    0x726f797276696b00ull, 0x72756f7661740000ull, 0x7279676765000000ull, 0x72c3a1686b6b6572ull,
+    0x72c3a16973610000ull, 0x72c3a56465000000ull, 0x72c3a5686f6c7400ull, 0x72c3a66c696e6765ull,
+    0x72c3b864c3b87900ull, 0x72c3b86d736b6f67ull, 0x72c3b8726f730000ull, 0x72c3b87374000000ull,
+    0x72c3b8796b656e00ull, 0x72c3b8797276696bull, 0x73616c616e67656eull, 0x73616c6174000000ull,
+    0x73616c7464616c00ull, 0x73616d6e616e6765ull, 0x73616e6465666a6full, 0x73616e646e657300ull,
+    0x73616e646e657373ull, 0x73616e646e657373ull, 0x73616e646f790000ull, 0x73616e64c3b87900ull,
+    0x7361727073626f72ull, 0x7361756461000000ull, 0x7361756865726164ull, 0x73656c0000000000ull,
+    0x73656c6275000000ull, 0x73656c6a65000000ull, 0x73656c6a6f726400ull, 0x7366000000000000ull,
+    0x7369656c6c616b00ull, 0x73696764616c0000ull, 0x73696c6a616e0000ull, 0x73697264616c0000ull,
+    0x736b616e69740000ull, 0x736b616e6c616e64ull, 0x736b61756e000000ull, 0x736b6564736d6f00ull,
+    0x736b6564736d6f6bull, 0x736b690000000000ull, 0x736b69656e000000ull, 0x736b696572766100ull,
+    0x736b69657276c3a1ull, 0x736b697074766574ull, 0x736b6a616b000000ull, 0x736b6a6572766f79ull,
+    0x736b6a657276c3b8ull, 0x736b6ac3a56b0000ull, 0x736b6f646a650000ull, 0x736bc3a16e697400ull,
+    0x736bc3a56e6c616eull, 0x736c617474756d00ull, 0x736d6f6c61000000ull, 0x736dc3b86c610000ull,
+    0x736e616173650000ull, 0x736e617361000000ull, 0x736e696c6c666a6full, 0x736e6f6173610000ull,
+    0x736ec3a561736500ull, 0x736ec3a573610000ull, 0x736f676e64616c00ull, 0x736f676e65000000ull,
+    0x736f6b6e64616c00ull, 0x736f6c6100000000ull, 0x736f6c756e640000ull, 0x736f6d6e61000000ull,
+    0x736f6e6472652d6cull, 0x736f6e6764616c65ull, 0x736f722d61757264ull, 0x736f722d66726f6eull,
+    0x736f722d6f64616cull, 0x736f722d76617261ull, 0x736f72666f6c6400ull, 0x736f727265697361ull,
+    0x736f72746c616e64ull, 0x736f72756d000000ull, 0x73706a656c6b6176ull, 0x7370796465626572ull,
+    0x7374000000000000ull, 0x7374616e67650000ull, 0x7374617400000000ull, 0x7374617468656c6cull,
+    0x73746176616e6765ull, 0x7374617665726e00ull, 0x7374656967656e00ull, 0x737465696e6b6a65ull,
+    0x73746a6f7264616cull, 0x73746a6f7264616cull, 0x73746ac3b8726461ull, 0x73746ac3b8726461ull,
+    0x73746f6b6b650000ull, 0x73746f722d656c76ull, 0x73746f7264000000ull, 0x73746f7264616c00ull,
+    0x73746f72666a6f72ull, 0x737472616e640000ull, 0x737472616e646100ull, 0x737472796e000000ull,
+    0x73756c6100000000ull, 0x73756c64616c0000ull, 0x73756e6400000000ull, 0x73756e6e64616c00ull,
+    0x7375726e6164616cull, 0x7376616c62617264ull, 0x737665696f000000ull, 0x7376656c76696b00ull,
+    0x73796b6b796c7665ull, 0x73c3a16c61740000ull, 0x73c3a16cc3a17400ull, 0x73c3b8676e650000ull,
+    0x73c3b86d6e610000ull, 0x73c3b86e6472652dull, 0x73c3b8722d617572ull, 0x73c3b8722d66726full,
+    0x73c3b8722d6f6461ull, 0x73c3b8722d766172ull, 0x73c3b872666f6c64ull, 0x73c3b87272656973ull,
+    0x73c3b872756d0000ull, 0x74616e6100000000ull, 0x74616e616e676572ull, 0x74656c656d61726bull,
+    0x74696d6500000000ull, 0x74696e67766f6c6cull, 0x74696e6e00000000ull, 0x746a656c6473756eull,
+    0x746a6f6d65000000ull, 0x746ac3b86d650000ull, 0x746d000000000000ull, 0x746f6b6b65000000ull,
+    0x746f6c6761000000ull, 0x746f6e7362657267ull, 0x746f72736b656e00ull, 0x7472000000000000ull,
+    0x7472616e61000000ull, 0x7472616e62790000ull, 0x7472616e6f790000ull, 0x7472616ec3b87900ull,
+    0x74726f616e64696eull, 0x74726f6773746164ull, 0x74726f6d73610000ull, 0x74726f6d736f0000ull,
+    0x74726f6d73c3b800ull, 0x74726f6e64686569ull, 0x74727973696c0000ull, 0x7472c3a66e610000ull,
+    0x7472c3b867737461ull, 0x7476656465737472ull, 0x747964616c000000ull, 0x74796e7365740000ull,
+    0x747973666a6f7264ull, 0x7479736e65730000ull, 0x7479737661720000ull, 0x74797376c3a67200ull,
+    0x74c3b86e73626572ull, 0x756c6c656e73616bull, 0x756c6c656e737661ull, 0x756c76696b000000ull,
+    0x756e6a6172676100ull, 0x756e6ac3a1726761ull, 0x7574736972610000ull, 0x7661000000000000ull,
+    0x7661617073746500ull, 0x766164736f000000ull, 0x76616473c3b80000ull, 0x7661676100000000ull,
+    0x766167616e000000ull, 0x766167736f790000ull, 0x76616b7364616c00ull, 0x76616c6c65000000ull,
+    0x76616e6700000000ull, 0x76616e796c76656eull, 0x766172646f000000ull, 0x76617264c3b80000ull,
+    0x7661726767617400ull, 0x7661726f79000000ull, 0x766566736e000000ull, 0x7665676100000000ull,
+    0x7665676172736865ull, 0x766567c3a5727368ull, 0x76656e6e65736c61ull, 0x76657264616c0000ull,
+    0x76657272616e0000ull, 0x7665737462790000ull, 0x76657374666f6c64ull, 0x766573746e657300ull,
+    0x7665737472652d73ull, 0x7665737472652d74ull, 0x766573747661676full, 0x7665737476c3a567ull,
+    0x766576656c737461ull, 0x7666000000000000ull, 0x7667730000000000ull, 0x76696b0000000000ull,
+    0x76696b6e61000000ull, 0x76696e6461666a6full, 0x766f616761740000ull, 0x766f6c6461000000ull,
+    0x766f737300000000ull, 0x766f73736576616eull, 0x76c3a1726767c3a1ull, 0x76c3a567616e0000ull,
+    0x76c3a56773c3b879ull, 0x76c3a567c3a50000ull, 0x76c3a672c3b87900ull, 0x786e2d2d616e6479ull,
+    0x786e2d2d61736b79ull, 0x786e2d2d61757273ull, 0x786e2d2d61766572ull, 0x786e2d2d62646464ull,
+    0x786e2d2d62656172ull, 0x786e2d2d6265726cull, 0x786e2d2d62686361ull, 0x786e2d2d62686363ull,
+    0x786e2d2d62696472ull, 0x786e2d2d62696576ull, 0x786e2d2d626a6172ull, 0x786e2d2d626a6464ull,
+    0x786e2d2d626c742dull, 0x786e2d2d626d6c6full, 0x786e2d2d626f642dull, 0x786e2d2d62726e6eull,
+    0x786e2d2d62726e6eull, 0x786e2d2d6272756dull, 0x786e2d2d62747366ull, 0x786e2d2d64617676ull,
+    0x786e2d2d646e6e61ull, 0x786e2d2d64726261ull, 0x786e2d2d64797279ull, 0x786e2d2d6576656eull,
+    0x786e2d2d66696e6eull, 0x786e2d2d666a6f72ull, 0x786e2d2d666c2d7aull, 0x786e2d2d666c6f72ull,
+    0x786e2d2d66726465ull, 0x786e2d2d66726e61ull, 0x786e2d2d66727961ull, 0x786e2d2d67676176ull,
+    0x786e2d2d67696c64ull, 0x786e2d2d67697675ull, 0x786e2d2d676a7669ull, 0x786e2d2d676c732dull,
+    0x786e2d2d682d3266ull, 0x786e2d2d68626d65ull, 0x786e2d2d68636573ull, 0x786e2d2d68676562ull,
+    0x786e2d2d686d6d72ull, 0x786e2d2d686e6566ull, 0x786e2d2d686f626cull, 0x786e2d2d686f6c74ull,
+    0x786e2d2d68706d69ull, 0x786e2d2d6879616eull, 0x786e2d2d68796c61ull, 0x786e2d2d696e6465ull,
+    0x786e2d2d6a6c7374ull, 0x786e2d2d6a727065ull, 0x786e2d2d6b61726dull, 0x786e2d2d6b666a6full,
+    0x786e2d2d6b6c6275ull, 0x786e2d2d6b6f6c75ull, 0x786e2d2d6b726167ull, 0x786e2d2d6b72616eull,
+    0x786e2d2d6b726473ull, 0x786e2d2d6b726568ull, 0x786e2d2d6b726a6full, 0x786e2d2d6b736e65ull,
+    0x786e2d2d6b76666aull, 0x786e2d2d6b766974ull, 0x786e2d2d6b766e61ull, 0x786e2d2d6c2d3166ull,
+    0x786e2d2d6c616865ull, 0x786e2d2d6c616e67ull, 0x786e2d2d6c64696eull, 0x786e2d2d6c656167ull,
+    0x786e2d2d6c657375ull, 0x786e2d2d6c677264ull, 0x786e2d2d6c687070ull, 0x786e2d2d6c696e64ull,
+    0x786e2d2d6c6f6162ull, 0x786e2d2d6c726461ull, 0x786e2d2d6c72656eull, 0x786e2d2d6c742d6cull,
+    0x786e2d2d6c74656eull, 0x786e2d2d6c757279ull, 0x786e2d2d6d656c79ull, 0x786e2d2d6d65726bull,
+    0x786e2d2d6d6a6e64ull, 0x786e2d2d6d6c6174ull, 0x786e2d2d6d6c692dull, 0x786e2d2d6d6c7365ull,
+    0x786e2d2d6d6f7265ull, 0x786e2d2d6d6f736aull, 0x786e2d2d6d6f742dull, 0x786e2d2d6d72652dull,
+    0x786e2d2d6d73792dull, 0x786e2d2d6d747461ull, 0x786e2d2d6d756f73ull, 0x786e2d2d6e6d6573ull,
+    0x786e2d2d6e72792dull, 0x786e2d2d6e747465ull, 0x786e2d2d6e76756full, 0x786e2d2d6f707065ull,
+    0x786e2d2d6f737465ull, 0x786e2d2d6f737972ull, 0x786e2d2d706f7273ull, 0x786e2d2d72616479ull,
+    0x786e2d2d7264616cull, 0x786e2d2d7264652dull, 0x786e2d2d7264792dull, 0x786e2d2d72656e6eull,
+    0x786e2d2d72686b6bull, 0x786e2d2d72686f6cull, 0x786e2d2d72697361ull, 0x786e2d2d72697372ull,
+    0x786e2d2d726c616eull, 0x786e2d2d726c696eull, 0x786e2d2d726d736bull, 0x786e2d2d72726f73ull,
+    0x786e2d2d72736b6full, 0x786e2d2d7273742dull, 0x786e2d2d72737461ull, 0x786e2d2d72796b65ull,
+    0x786e2d2d72797276ull, 0x786e2d2d732d3166ull, 0x786e2d2d73616e64ull, 0x786e2d2d73616e64ull,
+    0x786e2d2d73657261ull, 0x786e2d2d73676e65ull, 0x786e2d2d736b6965ull, 0x786e2d2d736b6a65ull,
+    0x786e2d2d736b6a6bull, 0x786e2d2d736b6e69ull, 0x786e2d2d736b6e6cull, 0x786e2d2d736c6174ull,
+    0x786e2d2d736c742dull, 0x786e2d2d736d6c61ull, 0x786e2d2d736d6e61ull, 0x786e2d2d736e6173ull,
+    0x786e2d2d736e6472ull, 0x786e2d2d736e6573ull, 0x786e2d2d736e7361ull, 0x786e2d2d73722d61ull,
+    0x786e2d2d73722d66ull, 0x786e2d2d73722d6full, 0x786e2d2d73722d76ull, 0x786e2d2d7372666full,
+    0x786e2d2d73727265ull, 0x786e2d2d7372756dull, 0x786e2d2d7374666full, 0x786e2d2d73746a72ull,
+    0x786e2d2d73746a72ull, 0x786e2d2d73747265ull, 0x786e2d2d746a6d65ull, 0x786e2d2d746e7362ull,
+    0x786e2d2d7472616eull, 0x786e2d2d74726773ull, 0x786e2d2d74726e61ull, 0x786e2d2d74726f6dull,
+    0x786e2d2d74797376ull, 0x786e2d2d756e6a72ull, 0x786e2d2d76616473ull, 0x786e2d2d76617264ull,
+    0x786e2d2d76656772ull, 0x786e2d2d76657374ull, 0x786e2d2d76672d79ull, 0x786e2d2d7667616eull,
+    0x786e2d2d76677379ull, 0x786e2d2d7672652dull, 0x786e2d2d76726767ull, 0x786e2d2d7672792dull,
+    0x786e2d2d7965722dull, 0x786e2d2d79676172ull, 0x786e2d2d79737472ull, 0xc3a16bc58b6f6c75ull,
+    0xc3a16c6168656164ull, 0xc3a16c74c3a10000ull, 0xc3a5666a6f726400ull, 0xc3a56b726568616dull,
+    0xc3a56c0000000000ull, 0xc3a56c6573756e64ull, 0xc3a56c67c3a57264ull, 0xc3a56d6c69000000ull,
+    0xc3a56d6f74000000ull, 0xc3a57264616c0000ull, 0xc3a5730000000000ull, 0xc3a5736572616c00ull,
+    0xc3a5736e65730000ull, 0xc3b86b736e657300ull, 0xc3b8726c616e6400ull, 0xc3b872736b6f6700ull,
+    0xc3b8727374610000ull, 0xc3b87374666f6c64ull, 0xc3b8737472652d74ull, 0xc3b87672652d6569ull,
+    0xc3b8796572000000ull, 0xc3b8796761726465ull, 0xc3b879737472652dull, 0xc48dc3a168636573ull,
+    0x62697a0000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x696e666f00000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x656e746572707269ull,
+    0x6d65727365696e65ull, 0x6d696e6500000000ull, 0x736861636b6e6574ull, 0x6163000000000000ull,
+    0x636f000000000000ull, 0x6372690000000000ull, 0x6765656b00000000ull, 0x67656e0000000000ull,
+    0x676f767400000000ull, 0x6865616c74680000ull, 0x6977690000000000ull, 0x6b69776900000000ull,
+    0x6d616f7269000000ull, 0x6d696c0000000000ull, 0x6dc4816f72690000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x7061726c69616d65ull, 0x7363686f6f6c0000ull, 0x786e2d2d6d6f7269ull,
+    0x636f000000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x6d65640000000000ull, 0x6d757365756d0000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x70726f0000000000ull, 0x686f6d656c696e6bull, 0x6f6e726564000000ull, 0x7365727669636500ull,
+    0x6261727379000000ull, 0x6565726f00000000ull, 0x6565726f2d737461ull, 0x7465636800000000ull,
+    0x6163636573736361ull, 0x6165000000000000ull, 0x616c746572766973ull, 0x616d756e65000000ull,
+    0x6261727379000000ull, 0x626c6f67646e7300ull, 0x626c6f6773697465ull, 0x626d6f6174746163ull,
+    0x626f6c646c79676full, 0x6361626c652d6d6full, 0x63616d6476720000ull, 0x63646e3737000000ull,
+    0x63646e37372d7365ull, 0x636572746d677200ull, 0x636c6f75646e7300ull, 0x636f6c6c65676566ull,
+    0x636f756368706f74ull, 0x64646e7373000000ull, 0x6469736b73746174ull, 0x646e73616c696173ull,
+    0x646e73646f6a6f00ull, 0x646f65736e746578ull, 0x646f6e7465786973ull, 0x646f6f6d646e7300ull,
+    0x64736d796e617300ull, 0x6475636b646e7300ull, 0x647672646e730000ull, 0x64796e616c696173ull,
+    0x64796e646e730000ull, 0x64796e7365727600ull, 0x656e646f66696e74ull, 0x656e646f66746865ull,
+    0x6575000000000000ull, 0x66616d696c796473ull, 0x6665646f7261696eull, 0x6665646f72617065ull,
+    0x6665646f72617072ull, 0x6672656564646e73ull, 0x667265656465736bull, 0x66726f6d2d6d6500ull,
+    0x67616d652d686f73ull, 0x676f74646e730000ull, 0x686570666f726765ull, 0x686b000000000000ull,
+    0x686f6262792d7369ull, 0x686f6d65646e7300ull, 0x686f6d6566747000ull, 0x686f6d656c696e75ull,
+    0x686f6d65756e6978ull, 0x686f70746f000000ull, 0x6874747062696e00ull, 0x696e2d64736c0000ull,
+    0x696e2d76706e0000ull, 0x69732d612d627275ull, 0x69732d612d63616eull, 0x69732d612d63656cull,
+    0x69732d612d636865ull, 0x69732d612d676565ull, 0x69732d612d6b6e69ull, 0x69732d612d6c696eull,
+    0x69732d612d706174ull, 0x69732d612d736f78ull, 0x69732d666f756e64ull, 0x69732d6c6f737400ull,
+    0x69732d7361766564ull, 0x69732d766572792dull, 0x69732d766572792dull, 0x69732d766572792dull,
+    0x69732d766572792dull, 0x69732d766572792dull, 0x6973612d6765656bull, 0x6a73000000000000ull,
+    0x6b69636b732d6173ull, 0x6d61796669727374ull, 0x6d6973636f6e6675ull, 0x6d6c6266616e0000ull,
+    0x6d6f7a696c6c612dull, 0x6d792d6669726577ull, 0x6d79666972657761ull, 0x6d79667470000000ull,
+    0x6d79736563757269ull, 0x6d79776972650000ull, 0x6e666c66616e0000ull, 0x6e6f2d6970000000ull,
+    0x6e6f772d646e7300ull, 0x70696d69656e7461ull, 0x706f647a6f6e6500ull, 0x706f6976726f6e00ull,
+    0x706f746167657200ull, 0x707562746c730000ull, 0x726561642d626f6full, 0x726561646d79626cull,
+    0x73656c6669700000ull, 0x73656c6c73796f75ull, 0x7365727665626273ull, 0x7365727665667470ull,
+    0x736572766567616dull, 0x736d616c6c2d7765ull, 0x7370646e73000000ull, 0x73747566662d342dull,
+    0x7377656574706570ull, 0x7465636b69647300ull, 0x746f6f6c666f7267ull, 0x74756e6b00000000ull,
+    0x74757866616d696cull, 0x74776d61696c0000ull, 0x75666366616e0000ull, 0x7573000000000000ull,
+    0x776562686f700000ull, 0x7765627265646972ull, 0x776d636c6f756400ull, 0x776d666c61627300ull,
+    0x7a61000000000000ull, 0x7a6170746f000000ull, 0x6e657264706f6c00ull, 0x61626f0000000000ull,
+    0x6163000000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f620000000000ull,
+    0x696e670000000000ull, 0x6d65640000000000ull, 0x6e65740000000000ull, 0x6e6f6d0000000000ull,
+    0x6f72670000000000ull, 0x736c640000000000ull, 0x636f646562657267ull, 0x686c780000000000ull,
+    0x686c783300000000ull, 0x6d61676e65740000ull, 0x70646e7300000000ull, 0x706c65736b000000ull,
+    0x7072766379000000ull, 0x726f636b79000000ull, 0x7472616e736c6174ull, 0x79626f0000000000ull,
+    0x626c6f6773706f74ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f620000000000ull,
+    0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6e6f6d0000000000ull, 0x6f72670000000000ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x6f72670000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x6900000000000000ull, 0x6d696c0000000000ull,
+    0x6e65740000000000ull, 0x6e676f0000000000ull, 0x6f72670000000000ull, 0x6672616d65720000ull,
+    0x3133333700000000ull, 0x62697a0000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x66616d0000000000ull, 0x676f620000000000ull, 0x676f6b0000000000ull, 0x676f6e0000000000ull,
+    0x676f700000000000ull, 0x676f730000000000ull, 0x676f760000000000ull, 0x696e666f00000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x7765620000000000ull, 0x6167726f00000000ull,
+    0x6169640000000000ull, 0x6172740000000000ull, 0x61746d0000000000ull, 0x6175677573746f77ull,
+    0x6175746f00000000ull, 0x62616269612d676full, 0x6265647a696e0000ull, 0x6265657000000000ull,
+    0x6265736b69647900ull, 0x6269616c6f776965ull, 0x6269616c7973746full, 0x6269656c61776100ull,
+    0x626965737a637a61ull, 0x62697a0000000000ull, 0x626f6c65736c6177ull, 0x627964676f737a63ull,
+    0x6279746f6d000000ull, 0x636965737a796e00ull, 0x636f000000000000ull, 0x636f6d0000000000ull,
+    0x637a656c61647a00ull, 0x637a657374000000ull, 0x646c75676f6c656bull, 0x65636f6d6d657263ull,
+    0x6564750000000000ull, 0x656c626c61670000ull, 0x656c6b0000000000ull, 0x6764610000000000ull,
+    0x6764616e736b0000ull, 0x6764796e69610000ull, 0x676c697769636500ull, 0x676c6f676f770000ull,
+    0x676d696e61000000ull, 0x676e69657a6e6f00ull, 0x676f726c69636500ull, 0x676f760000000000ull,
+    0x6772616a65776f00ull, 0x67736d0000000000ull, 0x686f6d65736b6c65ull, 0x696c617761000000ull,
+    0x696e666f00000000ull, 0x6a61776f727a6e6full, 0x6a656c656e69612dull, 0x6a676f7261000000ull,
+    0x6b616c69737a0000ull, 0x6b61727061637a00ull, 0x6b617274757a7900ull, 0x6b61737a75627900ull,
+    0x6b61746f77696365ull, 0x6b617a696d696572ull, 0x6b65706e6f000000ull, 0x6b6574727a796e00ull,
+    0x6b6c6f647a6b6f00ull, 0x6b6f626965727a79ull, 0x6b6f6c6f62727a65ull, 0x6b6f6e696e000000ull,
+    0x6b6f6e736b6f776full, 0x6b72616b6f770000ull, 0x6b7261736e696b00ull, 0x6b75746e6f000000ull,
+    0x6c61707900000000ull, 0x6c65626f726b0000ull, 0x6c65637a6e610000ull, 0x6c65676e69636100ull,
+    0x6c657a616a736b00ull, 0x6c696d616e6f7761ull, 0x6c6f6d7a61000000ull, 0x6c6f7769637a0000ull,
+    0x6c75626172746f77ull, 0x6c7562696e000000ull, 0x6c75626c696e0000ull, 0x6c756b6f77000000ull,
+    0x6d61696c00000000ull, 0x6d616c626f726b00ull, 0x6d616c6f706f6c73ull, 0x6d617a6f77737a65ull,
+    0x6d617a7572790000ull, 0x6d65640000000000ull, 0x6d65646961000000ull, 0x6d69617374610000ull,
+    0x6d69656c65630000ull, 0x6d69656c6e6f0000ull, 0x6d696c0000000000ull, 0x6d7261676f776f00ull,
+    0x6d79737072656164ull, 0x6e616b6c6f000000ull, 0x6e65740000000000ull, 0x6e6965727563686full,
+    0x6e6f6d0000000000ull, 0x6e6f776172756461ull, 0x6e79736100000000ull, 0x6f6c617761000000ull,
+    0x6f6c65636b6f0000ull, 0x6f6c6b75737a0000ull, 0x6f6c737a74796e00ull, 0x6f706f637a6e6f00ull,
+    0x6f706f6c65000000ull, 0x6f72670000000000ull, 0x6f7374726f646100ull, 0x6f7374726f6c656bull,
+    0x6f7374726f776965ull, 0x6f7374726f77776cull, 0x7063000000000000ull, 0x70696c6100000000ull,
+    0x7069737a00000000ull, 0x706f6468616c6500ull, 0x706f646c61736965ull, 0x706f6c6b6f776963ull,
+    0x706f6d6f72736b69ull, 0x706f6d6f727a6500ull, 0x706f6e6961746f77ull, 0x706f776961740000ull,
+    0x706f7a6e616e0000ull, 0x7072697600000000ull, 0x70726f63686f7769ull, 0x707275737a6b6f77ull,
+    0x70727a65776f7273ull, 0x70756c6177790000ull, 0x7261646f6d000000ull, 0x726177612d6d617aull,
+    0x7265616c65737461ull, 0x72656c0000000000ull, 0x7279626e696b0000ull, 0x727a65737a6f7700ull,
+    0x73616e6f6b000000ull, 0x736473636c6f7564ull, 0x73656a6e79000000ull, 0x7365780000000000ull,
+    0x73686f7000000000ull, 0x73686f706172656eull, 0x73696d706c657369ull, 0x736b6c6570000000ull,
+    0x736b6f637a6f7700ull, 0x736c61736b000000ull, 0x736c7570736b0000ull, 0x736f706f74000000ull,
+    0x736f730000000000ull, 0x736f736e6f776965ull, 0x7374616c6f77612dull, 0x737461726163686full,
+    0x7374617267617264ull, 0x737577616c6b6900ull, 0x737769646e696361ull, 0x737769646e696b00ull,
+    0x73776965626f647aull, 0x7377696e6f756a73ull, 0x737a637a6563696eull, 0x737a637a79746e6full,
+    0x737a6b6f6c610000ull, 0x7461726769000000ull, 0x7461726e6f62727aull, 0x74676f7279000000ull,
+    0x746d000000000000ull, 0x746f757269736d00ull, 0x74726176656c0000ull, 0x747572656b000000ull,
+    0x747572797374796bull, 0x7479636879000000ull, 0x756e69636c6f7564ull, 0x7573746b61000000ull,
+    0x77616c62727a7963ull, 0x7761726d69610000ull, 0x776172737a617761ull, 0x7761770000000000ull,
+    0x776567726f770000ull, 0x7769656c756e0000ull, 0x776c6f636c000000ull, 0x776c6f636c617765ull,
+    0x776f647a69736c61ull, 0x776f6c6f6d696e00ull, 0x77726f6300000000ull, 0x77726f636c617700ull,
+    0x7a616368706f6d6full, 0x7a6167616e000000ull, 0x7a616b6f70616e65ull, 0x7a61726f77000000ull,
+    0x7a676f7261000000ull, 0x7a676f727a656c65ull, 0x636f000000000000ull, 0x6e616d6500000000ull,
+    0x6f776e0000000000ull, 0x636f000000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x696e646965000000ull, 0x6163000000000000ull,
+    0x62697a0000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x6573740000000000ull,
+    0x676f760000000000ull, 0x696e666f00000000ull, 0x69736c6100000000ull, 0x6e616d6500000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x70726f0000000000ull, 0x70726f6600000000ull,
+    0x6161610000000000ull, 0x6163610000000000ull, 0x6163637400000000ull, 0x61766f6361740000ull,
+    0x6261720000000000ull, 0x6261727379000000ull, 0x636c6f75646e7300ull, 0x6370610000000000ull,
+    0x646e737472616365ull, 0x656e670000000000ull, 0x6a75720000000000ull, 0x6c61770000000000ull,
+    0x6d65640000000000ull, 0x7265636874000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x706c6f0000000000ull,
+    0x7365630000000000ull, 0x313233706167696eull, 0x626c6f6773706f74ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x696e740000000000ull, 0x6e65740000000000ull,
+    0x6e6f6d6500000000ull, 0x6f72670000000000ull, 0x7075626c00000000ull, 0x6261727379000000ull,
+    0x62656c6175000000ull, 0x636c6f75646e7300ull, 0x636f000000000000ull, 0x6564000000000000ull,
+    0x676f000000000000ull, 0x6e65000000000000ull, 0x6f72000000000000ull, 0x7834343300000000ull,
+    0x636f6d0000000000ull, 0x636f6f7000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x626c6f6773706f74ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x6d696c0000000000ull,
+    0x6e616d6500000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x7363680000000000ull,
+    0x6173736f00000000ull, 0x626c6f6773706f74ull, 0x636f6d0000000000ull, 0x6e6f6d0000000000ull,
+    0x79626f0000000000ull, 0x636c616e00000000ull, 0x6172747300000000ull, 0x6261727379000000ull,
+    0x626c6f6773706f74ull, 0x636f000000000000ull, 0x636f6d0000000000ull, 0x6669726d00000000ull,
+    0x696e666f00000000ull, 0x6e6f6d0000000000ull, 0x6e74000000000000ull, 0x6f72670000000000ull,
+    0x7265630000000000ull, 0x73686f7000000000ull, 0x73746f7265000000ull, 0x746d000000000000ull,
+    0x7777770000000000ull, 0x6c696d612d636974ull, 0x6d7964646e730000ull, 0x7765627370616365ull,
+    0x6163000000000000ull, 0x626c6f6773706f74ull, 0x6272656e646c7900ull, 0x636f000000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x696e000000000000ull, 0x6f72670000000000ull,
+    0x6f78000000000000ull, 0x7561000000000000ull, 0x3132337361697400ull, 0x6163000000000000ull,
+    0x6164796765796100ull, 0x626173686b697269ull, 0x6269720000000000ull, 0x626c6f6773706f74ull,
+    0x6362670000000000ull, 0x636c646d61696c00ull, 0x636f6d0000000000ull, 0x646167657374616eull,
+    0x6564750000000000ull, 0x6575726f64697200ull, 0x676f760000000000ull, 0x67726f7a6e790000ull,
+    0x696e740000000000ull, 0x6b616c6d796b6961ull, 0x6b757374616e6169ull, 0x6c6b330000000000ull,
+    0x6d6172696e650000ull, 0x6d63646972000000ull, 0x6d63707265000000ull, 0x6d696c0000000000ull,
+    0x6d6972636c6f7564ull, 0x6d6f72646f766961ull, 0x6d736b0000000000ull, 0x6d796a696e6f0000ull,
+    0x6d79746973000000ull, 0x6e61347500000000ull, 0x6e616c6368696b00ull, 0x6e65740000000000ull,
+    0x6e6f760000000000ull, 0x6f72670000000000ull, 0x7070000000000000ull, 0x7079617469676f72ull,
+    0x7261730000000000ull, 0x7265677275686f73ull, 0x7370620000000000ull, 0x7465737400000000ull,
+    0x766c6164696b6176ull, 0x766c6164696d6972ull, 0x6275696c64000000ull, 0x636f646500000000ull,
+    0x6461746162617365ull, 0x646576656c6f706dull, 0x6873000000000000ull, 0x6d6967726174696full,
+    0x6f6e706f72746572ull, 0x726176656e646200ull, 0x7265706c00000000ull, 0x7365727665727300ull,
+    0x6163000000000000ull, 0x636f000000000000ull, 0x636f6f7000000000ull, 0x676f760000000000ull,
+    0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x6d65640000000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x7075620000000000ull, 0x7363680000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x79626f0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x696e666f00000000ull,
+    0x6d65640000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x7476000000000000ull,
+    0x3132336d696e7369ull, 0x6100000000000000ull, 0x6163000000000000ull, 0x6200000000000000ull,
+    0x6264000000000000ull, 0x626c6f6773706f74ull, 0x6272616e64000000ull, 0x6300000000000000ull,
+    0x636f6d0000000000ull, 0x636f6e6600000000ull, 0x6400000000000000ull, 0x6500000000000000ull,
+    0x6600000000000000ull, 0x6668000000000000ull, 0x6668736b00000000ull, 0x6668760000000000ull,
+    0x6700000000000000ull, 0x6800000000000000ull, 0x6900000000000000ull, 0x696f707379730000ull,
+    0x6974636f756c6462ull, 0x6b00000000000000ull, 0x6b6f6d666f726200ull, 0x6b6f6d6d756e616cull,
+    0x6b6f6d7675780000ull, 0x6c00000000000000ull, 0x6c616e6269620000ull, 0x6d00000000000000ull,
+    0x6d79737072656164ull, 0x6e00000000000000ull, 0x6e61747572627275ull, 0x6f00000000000000ull,
+    0x6f72670000000000ull, 0x7000000000000000ull, 0x7061626100000000ull, 0x7061727469000000ull,
+    0x7070000000000000ull, 0x7072657373000000ull, 0x7200000000000000ull, 0x7300000000000000ull,
+    0x7400000000000000ull, 0x746d000000000000ull, 0x7500000000000000ull, 0x7700000000000000ull,
+    0x7800000000000000ull, 0x7900000000000000ull, 0x7a00000000000000ull, 0x6c6f67696e6c696eull,
+    0x626c6f6773706f74ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x656e7363616c6564ull,
+    0x676f760000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x7065720000000000ull,
+    0x6269700000000000ull, 0x636f6d0000000000ull, 0x676f760000000000ull, 0x6861736862616e67ull,
+    0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6e6f770000000000ull, 0x6f72670000000000ull,
+    0x706c6174666f726dull, 0x76786c0000000000ull, 0x77656465706c6f79ull, 0x6261727379000000ull,
+    0x6261736500000000ull, 0x686f706c69780000ull, 0x626c6f6773706f74ull, 0x6769746170700000ull,
+    0x6769747061676500ull, 0x6261727379000000ull, 0x6279656e00000000ull, 0x636c6f7564657261ull,
+    0x63796f6e00000000ull, 0x6661737476707300ull, 0x666e776b00000000ull, 0x666f6c696f6e6574ull,
+    0x6a656c6500000000ull, 0x6c656c7578000000ull, 0x6c6f67696e6c696eull, 0x6d696e7465726500ull,
+    0x6e6f7665636f7265ull, 0x6f6d6e6977650000ull, 0x6f70656e736f6369ull, 0x706c6174666f726dull,
+    0x7372687400000000ull, 0x7473740000000000ull, 0x626c6f6773706f74ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x6172740000000000ull, 0x626c6f6773706f74ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f757600000000ull, 0x6f72670000000000ull, 0x706572736f000000ull, 0x756e697600000000ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x6d65000000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x7363680000000000ull, 0x6469686572000000ull,
+    0x6d79666173740000ull, 0x7562657200000000ull, 0x787334616c6c0000ull, 0x62697a0000000000ull,
+    0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x6d65000000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x7363680000000000ull, 0x636f000000000000ull,
+    0x636f6d0000000000ull, 0x636f6e73756c6164ull, 0x6564750000000000ull, 0x656d626169786164ull,
+    0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6e6f686f00000000ull, 0x6f72670000000000ull,
+    0x7072696e63697065ull, 0x73616f746f6d6500ull, 0x73746f7265000000ull, 0x73656c6c66790000ull,
+    0x73686f7077617265ull, 0x73746f7265626173ull, 0x61626b68617a6961ull, 0x6164796765796100ull,
+    0x616b74797562696eull, 0x61726b68616e6765ull, 0x61726d656e696100ull, 0x6173686761626164ull,
+    0x617a65726261696aull, 0x62616c6173686f76ull, 0x626173686b697269ull, 0x627279616e736b00ull,
+    0x62756b6861726100ull, 0x6368696d6b656e74ull, 0x646167657374616eull, 0x656173742d6b617aull,
+    0x65786e6574000000ull, 0x67656f7267696100ull, 0x67726f7a6e790000ull, 0x6976616e6f766f00ull,
+    0x6a616d62796c0000ull, 0x6b616c6d796b6961ull, 0x6b616c7567610000ull, 0x6b617261636f6c00ull,
+    0x6b61726167616e64ull, 0x6b6172656c696100ull, 0x6b68616b61737369ull, 0x6b7261736e6f6461ull,
+    0x6b757267616e0000ull, 0x6b757374616e6169ull, 0x6c656e7567000000ull, 0x6d616e677973686cull,
+    0x6d6f72646f766961ull, 0x6d736b0000000000ull, 0x6d75726d616e736bull, 0x6e616c6368696b00ull,
+    0x6e61766f69000000ull, 0x6e6f7274682d6b61ull, 0x6e6f760000000000ull, 0x6f626e696e736b00ull,
+    0x70656e7a61000000ull, 0x706f6b726f76736bull, 0x736f636869000000ull, 0x7370620000000000ull,
+    0x746173686b656e74ull, 0x7465726d657a0000ull, 0x746f676c69617474ull, 0x74726f6974736b00ull,
+    0x7473656c696e6f67ull, 0x74756c6100000000ull, 0x7475766100000000ull, 0x766c6164696b6176ull,
+    0x766c6164696d6972ull, 0x766f6c6f67646100ull, 0x6261727379000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f620000000000ull, 0x6f72670000000000ull, 0x7265640000000000ull,
+    0x676f760000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x6b6e69676874706full,
+    0x6163000000000000ull, 0x636f000000000000ull, 0x6f72670000000000ull, 0x6368000000000000ull,
+    0x6d65000000000000ull, 0x7765000000000000ull, 0x626c6f6773706f74ull, 0x646973636f757273ull,
+    0x6a656c6173746963ull, 0x636f000000000000ull, 0x7363680000000000ull, 0x6163000000000000ull,
+    0x636f000000000000ull, 0x676f000000000000ull, 0x696e000000000000ull, 0x6d69000000000000ull,
+    0x6e65740000000000ull, 0x6f6e6c696e650000ull, 0x6f72000000000000ull, 0x73686f7000000000ull,
+    0x6163000000000000ull, 0x62697a0000000000ull, 0x636f000000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f000000000000ull, 0x676f760000000000ull, 0x696e740000000000ull,
+    0x6d696c0000000000ull, 0x6e616d6500000000ull, 0x6e65740000000000ull, 0x6e69630000000000ull,
+    0x6f72670000000000ull, 0x7465737400000000ull, 0x7765620000000000ull, 0x676f760000000000ull,
+    0x636f000000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull, 0x676f760000000000ull,
+    0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6e6f6d0000000000ull, 0x6f72670000000000ull,
+    0x636f6d0000000000ull, 0x656e730000000000ull, 0x66696e0000000000ull, 0x676f760000000000ull,
+    0x696e640000000000ull, 0x696e666f00000000ull, 0x696e746c00000000ull, 0x6d696e636f6d0000ull,
+    0x6e61740000000000ull, 0x6e65740000000000ull, 0x6f72616e6765636cull, 0x6f72670000000000ull,
+    0x706572736f000000ull, 0x746f757269736d00ull, 0x3631310000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x6d696c0000000000ull, 0x6e65740000000000ull,
+    0x6e79616e00000000ull, 0x6f72670000000000ull, 0x6f79610000000000ull, 0x717569636b636f6eull,
+    0x7264760000000000ull, 0x76706e706c757300ull, 0x7072657175616c69ull, 0x6e6f772d646e7300ull,
+    0x6e74646c6c000000ull, 0x6176000000000000ull, 0x6262730000000000ull, 0x62656c0000000000ull,
+    0x62697a0000000000ull, 0x636f6d0000000000ull, 0x6472000000000000ull, 0x6564750000000000ull,
+    0x67656e0000000000ull, 0x676f760000000000ull, 0x696e666f00000000ull, 0x6b31320000000000ull,
+    0x6b65700000000000ull, 0x6d696c0000000000ull, 0x6e616d6500000000ull, 0x6e63000000000000ull,
+    0x6e65740000000000ull, 0x6f72670000000000ull, 0x706f6c0000000000ull, 0x74656c0000000000ull,
+    0x74736b0000000000ull, 0x7476000000000000ull, 0x7765620000000000ull, 0x79626f0000000000ull,
+    0x6165726f00000000ull, 0x62697a0000000000ull, 0x636f000000000000ull, 0x636f6d0000000000ull,
+    0x636f6f7000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x696e666f00000000ull,
+    0x696e740000000000ull, 0x6a6f627300000000ull, 0x6d6f626900000000ull, 0x6d757365756d0000ull,
+    0x6e616d6500000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x70726f0000000000ull,
+    0x74726176656c0000ull, 0x6265747465722d74ull, 0x64796e646e730000ull, 0x6f6e2d7468652d77ull,
+    0x776f7273652d7468ull, 0x626c6f6773706f74ull, 0x636c756200000000ull, 0x636f6d0000000000ull,
+    0x6562697a00000000ull, 0x6564750000000000ull, 0x67616d6500000000ull, 0x676f760000000000ull,
+    0x6964760000000000ull, 0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x75726c0000000000ull, 0x786e2d2d637a7277ull, 0x786e2d2d75633061ull, 0x786e2d2d7a663061ull,
+    0xe59586e6a5ad0000ull, 0xe7b584e7b9940000ull, 0xe7b6b2e8b7af0000ull, 0x6163000000000000ull,
+    0x636f000000000000ull, 0x676f000000000000ull, 0x686f74656c000000ull, 0x696e666f00000000ull,
+    0x6d65000000000000ull, 0x6d696c0000000000ull, 0x6d6f626900000000ull, 0x6e65000000000000ull,
+    0x6f72000000000000ull, 0x7363000000000000ull, 0x7476000000000000ull, 0x62697a0000000000ull,
+    0x6363000000000000ull, 0x636865726b617373ull, 0x636865726b617379ull, 0x636865726e69676full,
+    0x636865726e696869ull, 0x636865726e697674ull, 0x636865726e6f7674ull, 0x636b000000000000ull,
+    0x636e000000000000ull, 0x636f000000000000ull, 0x636f6d0000000000ull, 0x6372000000000000ull,
+    0x6372696d65610000ull, 0x6376000000000000ull, 0x6378000000000000ull, 0x646e000000000000ull,
+    0x646e6570726f7065ull, 0x646e6970726f7065ull, 0x646f6e6574736b00ull, 0x6470000000000000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x6966000000000000ull, 0x696e000000000000ull,
+    0x696e660000000000ull, 0x6976616e6f2d6672ull, 0x6b68000000000000ull, 0x6b6861726b697600ull,
+    0x6b6861726b6f7600ull, 0x6b686572736f6e00ull, 0x6b686d656c6e6974ull, 0x6b686d656c6e7974ull,
+    0x6b69657600000000ull, 0x6b69726f766f6772ull, 0x6b6d000000000000ull, 0x6b72000000000000ull,
+    0x6b72796d00000000ull, 0x6b73000000000000ull, 0x6b76000000000000ull, 0x6b79697600000000ull,
+    0x6c67000000000000ull, 0x6c74000000000000ull, 0x6c74640000000000ull, 0x6c7567616e736b00ull,
+    0x6c7574736b000000ull, 0x6c76000000000000ull, 0x6c76697600000000ull, 0x6d6b000000000000ull,
+    0x6d796b6f6c616976ull, 0x6e65740000000000ull, 0x6e696b6f6c616576ull, 0x6f64000000000000ull,
+    0x6f64657361000000ull, 0x6f64657373610000ull, 0x6f72670000000000ull, 0x706c000000000000ull,
+    0x706f6c7461766100ull, 0x7070000000000000ull, 0x7269766e65000000ull, 0x726f766e6f000000ull,
+    0x7276000000000000ull, 0x7362000000000000ull, 0x7365626173746f70ull, 0x7365766173746f70ull,
+    0x736d000000000000ull, 0x73756d7900000000ull, 0x7465000000000000ull, 0x7465726e6f70696cull,
+    0x757a000000000000ull, 0x757a68676f726f64ull, 0x7600000000000000ull, 0x76696e6e69636100ull,
+    0x76696e6e79747369ull, 0x766e000000000000ull, 0x766f6c796e000000ull, 0x79616c7461000000ull,
+    0x7a61706f72697a68ull, 0x7a61706f72697a68ull, 0x7a6869746f6d6972ull, 0x7a6879746f6d7972ull,
+    0x7a70000000000000ull, 0x7a74000000000000ull, 0x6163000000000000ull, 0x626c6f6773706f74ull,
+    0x636f000000000000ull, 0x636f6d0000000000ull, 0x676f000000000000ull, 0x6e65000000000000ull,
+    0x6f72000000000000ull, 0x6f72670000000000ull, 0x7363000000000000ull, 0x6163000000000000ull,
+    0x6261727379000000ull, 0x636f000000000000ull, 0x636f6e6e00000000ull, 0x636f70726f000000ull,
+    0x676f760000000000ull, 0x686f737000000000ull, 0x696e646570656e64ull, 0x696e646570656e64ull,
+    0x696e646570656e64ull, 0x696e646570656e64ull, 0x696e646570656e64ull, 0x6c74640000000000ull,
+    0x6d65000000000000ull, 0x6e65740000000000ull, 0x6e68730000000000ull, 0x6f72670000000000ull,
+    0x706c630000000000ull, 0x706f6c6963650000ull, 0x7075626c69632d69ull, 0x70796d6e74000000ull,
+    0x726f79616c2d636full, 0x7363680000000000ull, 0x616b000000000000ull, 0x616c000000000000ull,
+    0x6172000000000000ull, 0x6173000000000000ull, 0x617a000000000000ull, 0x6361000000000000ull,
+    0x636c6f75646e7300ull, 0x636f000000000000ull, 0x6374000000000000ull, 0x6463000000000000ull,
+    0x6465000000000000ull, 0x646e690000000000ull, 0x6472756400000000ull, 0x656e7363616c6564ull,
+    0x6665640000000000ull, 0x666c000000000000ull, 0x6672656564646e73ull, 0x6761000000000000ull,
+    0x676f6c6666616e00ull, 0x67726170686f7800ull, 0x6775000000000000ull, 0x6869000000000000ull,
+    0x6961000000000000ull, 0x6964000000000000ull, 0x696c000000000000ull, 0x696e000000000000ull,
+    0x69732d6279000000ull, 0x6973610000000000ull, 0x6b69647300000000ull, 0x6b73000000000000ull,
+    0x6b79000000000000ull, 0x6c61000000000000ull, 0x6c616e642d342d73ull, 0x6d61000000000000ull,
+    0x6d64000000000000ull, 0x6d65000000000000ull, 0x6d69000000000000ull, 0x6d6972636c6f7564ull,
+    0x6d6e000000000000ull, 0x6d6f000000000000ull, 0x6d73000000000000ull, 0x6d74000000000000ull,
+    0x6e63000000000000ull, 0x6e64000000000000ull, 0x6e65000000000000ull, 0x6e68000000000000ull,
+    0x6e6a000000000000ull, 0x6e6d000000000000ull, 0x6e6f697000000000ull, 0x6e736e0000000000ull,
+    0x6e76000000000000ull, 0x6e79000000000000ull, 0x6f68000000000000ull, 0x6f6b000000000000ull,
+    0x6f72000000000000ull, 0x7061000000000000ull, 0x706c617474657270ull, 0x706f696e74746f00ull,
+    0x7072000000000000ull, 0x7269000000000000ull, 0x7363000000000000ull, 0x7364000000000000ull,
+    0x73747566662d342dull, 0x746e000000000000ull, 0x7478000000000000ull, 0x7574000000000000ull,
+    0x7661000000000000ull, 0x7669000000000000ull, 0x7674000000000000ull, 0x7761000000000000ull,
+    0x7769000000000000ull, 0x7776000000000000ull, 0x7779000000000000ull, 0x636f6d0000000000ull,
+    0x6564750000000000ull, 0x6775620000000000ull, 0x6d696c0000000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x636f000000000000ull, 0x636f6d0000000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x3065000000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x6776000000000000ull, 0x6d696c0000000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x6172747300000000ull, 0x6269620000000000ull, 0x636f000000000000ull,
+    0x636f6d0000000000ull, 0x6531320000000000ull, 0x6564750000000000ull, 0x6669726d00000000ull,
+    0x676f620000000000ull, 0x676f760000000000ull, 0x696e666f00000000ull, 0x696e740000000000ull,
+    0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6e6f6d0000000000ull, 0x6f72670000000000ull,
+    0x7261720000000000ull, 0x7265630000000000ull, 0x73746f7265000000ull, 0x7465630000000000ull,
+    0x7765620000000000ull, 0x6174000000000000ull, 0x636f000000000000ull, 0x636f6d0000000000ull,
+    0x6b31320000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x6163000000000000ull,
+    0x62697a0000000000ull, 0x626c6f6773706f74ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x6865616c74680000ull, 0x696e666f00000000ull, 0x696e740000000000ull,
+    0x6e616d6500000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull, 0x70726f0000000000ull,
+    0x626c6f6700000000ull, 0x636e000000000000ull, 0x636f6d0000000000ull, 0x6465760000000000ull,
+    0x6564750000000000ull, 0x6d65000000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x6672616d65720000ull, 0x62697a0000000000ull, 0x7363680000000000ull, 0x6672616d65720000ull,
+    0x61647669736f7200ull, 0x636c6f7564363600ull, 0x636f6d0000000000ull, 0x64796e646e730000ull,
+    0x6564750000000000ull, 0x676f760000000000ull, 0x6d79706574730000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x786e2d2d34646267ull, 0x786e2d2d35646268ull, 0x786e2d2d38646271ull,
+    0x786e2d2d68656264ull, 0x786e2d2d38306175ull, 0x786e2d2d3930617aull, 0x786e2d2d63316176ull,
+    0x786e2d2d64316174ull, 0x786e2d2d6f316163ull, 0x786e2d2d6f316163ull, 0x786e2d2d35357178ull,
+    0x786e2d2d676d7177ull, 0x786e2d2d6d787471ull, 0x786e2d2d6f643061ull, 0x786e2d2d75633061ull,
+    0x786e2d2d77637673ull, 0x786e2d2d31326331ull, 0x786e2d2d31326366ull, 0x786e2d2d3132636full,
+    0x786e2d2d68336375ull, 0x786e2d2d6d336368ull, 0x786e2d2d6f336379ull, 0x786e2d2d34316100ull,
+    0x786e2d2d38306161ull, 0x786e2d2d39306131ull, 0x786e2d2d3930616dull, 0x786e2d2d63316176ull,
+    0x786e2d2d68316168ull, 0x786e2d2d6831616cull, 0x786e2d2d6a316164ull, 0x786e2d2d6a316165ull,
+    0x786e2d2d6a316165ull, 0x626c6f6773697465ull, 0x6372616674696e67ull, 0x6c6f63616c7a6f6eull,
+    0x74656c6562697400ull, 0x7a6170746f000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6f72670000000000ull,
+    0x6f72670000000000ull, 0x6163000000000000ull, 0x6167726963000000ull, 0x616c740000000000ull,
+    0x636f000000000000ull, 0x6564750000000000ull, 0x676f760000000000ull, 0x67726f6e64617200ull,
+    0x6c61770000000000ull, 0x6d696c0000000000ull, 0x6e65740000000000ull, 0x6e676f0000000000ull,
+    0x6e69630000000000ull, 0x6e69730000000000ull, 0x6e6f6d0000000000ull, 0x6f72670000000000ull,
+    0x7363686f6f6c0000ull, 0x746d000000000000ull, 0x7765620000000000ull, 0x6163000000000000ull,
+    0x62697a0000000000ull, 0x636f000000000000ull, 0x636f6d0000000000ull, 0x6564750000000000ull,
+    0x676f760000000000ull, 0x696e666f00000000ull, 0x6d696c0000000000ull, 0x6e65740000000000ull,
+    0x6f72670000000000ull, 0x7363680000000000ull, 0x636c6f7564363600ull, 0x6873000000000000ull,
+    0x6c696d6100000000ull, 0x747269746f6e0000ull, 0x6163000000000000ull, 0x636f000000000000ull,
+    0x676f760000000000ull, 0x6d696c0000000000ull, 0x6f72670000000000ull, 0xd0b1d0b8d0b70000ull,
+    0xd0bad0bed0bc0000ull, 0xd0bad180d18bd0bcull, 0xd0bcd0b8d1800000ull, 0xd0bcd181d0ba0000ull,
+    0xd0bed180d0b30000ull, 0xd181d0b0d0bcd0b0ull, 0xd181d0bed187d0b8ull, 0xd181d0bfd0b10000ull,
+    0xd18f000000000000ull, 0xd0b0d0ba00000000ull, 0xd0bed0b1d1800000ull, 0xd0bed0b400000000ull,
+    0xd0bed180d0b30000ull, 0xd0bfd18000000000ull, 0xd183d0bfd1800000ull, 0xd790d7a7d793d79eull,
+    0xd799d7a9d795d791ull, 0xd79ed79ed7a9d79cull, 0xd7a6d794d79c0000ull, 0xe0b897e0b8abe0b8ull,
+    0xe0b898e0b8b8e0b8ull, 0xe0b8a3e0b8b1e0b8ull, 0xe0b8a8e0b8b6e0b8ull, 0xe0b8ade0b887e0b8ull,
+    0xe0b980e0b899e0b9ull, 0xe5808be4baba0000ull, 0xe585ace58fb80000ull, 0xe694bfe5ba9c0000ull,
+    0xe69599e882b20000ull, 0xe7b584e7b9940000ull, 0xe7b6b2e7b5a10000ull, 0x6100000000000000ull,
+    0x707269766174656cull, 0x626c6f6773706f74ull, 0x7374680000000000ull, 0x626c6f6773706f74ull,
+    0x7769656e00000000ull, 0x6578000000000000ull, 0x696e000000000000ull, 0x6578000000000000ull,
+    0x6b756e64656e0000ull, 0x626c6f6773706f74ull, 0x636c6f75646c6574ull, 0x6d79737072656164ull,
+    0x6163740000000000ull, 0x636174686f6c6963ull, 0x6e73770000000000ull, 0x6e74000000000000ull,
+    0x716c640000000000ull, 0x7361000000000000ull, 0x7461730000000000ull, 0x7669630000000000ull,
+    0x7761000000000000ull, 0x716c640000000000ull, 0x7361000000000000ull, 0x7461730000000000ull,
+    0x7669630000000000ull, 0x7761000000000000ull, 0x636c6f7564000000ull, 0x657a70726f787900ull,
+    0x626c6f6773706f74ull, 0x73696d706c657369ull, 0x7669727475616c63ull, 0x6163000000000000ull,
+    0x616c000000000000ull, 0x616d000000000000ull, 0x6170000000000000ull, 0x6261000000000000ull,
+    0x6365000000000000ull, 0x6466000000000000ull, 0x6573000000000000ull, 0x676f000000000000ull,
+    0x6d61000000000000ull, 0x6d67000000000000ull, 0x6d73000000000000ull, 0x6d74000000000000ull,
+    0x7061000000000000ull, 0x7062000000000000ull, 0x7065000000000000ull, 0x7069000000000000ull,
+    0x7072000000000000ull, 0x726a000000000000ull, 0x726e000000000000ull, 0x726f000000000000ull,
+    0x7272000000000000ull, 0x7273000000000000ull, 0x7363000000000000ull, 0x7365000000000000ull,
+    0x7370000000000000ull, 0x746f000000000000ull, 0x6163000000000000ull, 0x616c000000000000ull,
+    0x616d000000000000ull, 0x6170000000000000ull, 0x6261000000000000ull, 0x6365000000000000ull,
+    0x6466000000000000ull, 0x6573000000000000ull, 0x676f000000000000ull, 0x6d61000000000000ull,
+    0x6d67000000000000ull, 0x6d73000000000000ull, 0x6d74000000000000ull, 0x7061000000000000ull,
+    0x7062000000000000ull, 0x7065000000000000ull, 0x7069000000000000ull, 0x7072000000000000ull,
+    0x726a000000000000ull, 0x726e000000000000ull, 0x726f000000000000ull, 0x7272000000000000ull,
+    0x7273000000000000ull, 0x7363000000000000ull, 0x7365000000000000ull, 0x7370000000000000ull,
+    0x746f000000000000ull, 0x626c6f6773706f74ull, 0x7569000000000000ull, 0x696e7374616e6365ull,
+    0x7376630000000000ull, 0x6165000000000000ull, 0x617070656e67696eull, 0x65732d3100000000ull,
+    0x6575000000000000ull, 0x7669700000000000ull, 0x6172756261000000ull, 0x6974310000000000ull,
+    0x6373000000000000ull, 0x746e000000000000ull, 0x756b000000000000ull, 0x756b000000000000ull,
+    0x6361000000000000ull, 0x756b000000000000ull, 0x7573000000000000ull, 0x626172656d657461ull,
+    0x66722d7061720000ull, 0x696e7374616e6365ull, 0x6b38730000000000ull, 0x6e6c2d616d730000ull,
+    0x706c2d7761770000ull, 0x7363616c65626f6full, 0x736d6172746c6162ull, 0x6368000000000000ull,
+    0x6465000000000000ull, 0x616d617a6f6e6177ull, 0x6469726563740000ull, 0x626c6f6773706f74ull,
+    0x6964000000000000ull, 0x6964000000000000ull, 0x6465760000000000ull, 0x61662d736f757468ull,
+    0x61702d656173742dull, 0x61702d6e6f727468ull, 0x61702d6e6f727468ull, 0x61702d6e6f727468ull,
+    0x61702d736f757468ull, 0x61702d736f757468ull, 0x61702d736f757468ull, 0x63612d63656e7472ull,
+    0x636f6d7075746500ull, 0x636f6d707574652dull, 0x656c620000000000ull, 0x65752d63656e7472ull,
+    0x65752d6e6f727468ull, 0x65752d736f757468ull, 0x65752d776573742dull, 0x65752d776573742dull,
+    0x65752d776573742dull, 0x6d652d736f757468ull, 0x7333000000000000ull, 0x73332d61702d6e6full,
+    0x73332d61702d6e6full, 0x73332d61702d736full, 0x73332d61702d736full, 0x73332d61702d736full,
+    0x73332d63612d6365ull, 0x73332d65752d6365ull, 0x73332d65752d7765ull, 0x73332d65752d7765ull,
+    0x73332d65752d7765ull, 0x73332d6578746572ull, 0x73332d666970732dull, 0x73332d73612d6561ull,
+    0x73332d75732d6561ull, 0x73332d75732d676full, 0x73332d75732d7765ull, 0x73332d75732d7765ull,
+    0x73332d7765627369ull, 0x73332d7765627369ull, 0x73332d7765627369ull, 0x73332d7765627369ull,
+    0x73332d7765627369ull, 0x73332d7765627369ull, 0x73332d7765627369ull, 0x73332d7765627369ull,
+    0x73612d656173742dull, 0x75732d656173742dull, 0x75732d656173742dull, 0x75732d776573742dull,
+    0x75732d776573742dull, 0x7200000000000000ull, 0x616c706861000000ull, 0x6265746100000000ull,
+    0x6275696c64657200ull, 0x6465762d6275696cull, 0x7374672d6275696cull, 0x6f63690000000000ull,
+    0x6f63700000000000ull, 0x6f63730000000000ull, 0x64656d6f00000000ull, 0x696e7374616e6365ull,
+    0x61702d6e6f727468ull, 0x61702d6e6f727468ull, 0x61702d6e6f727468ull, 0x61702d736f757468ull,
+    0x61702d736f757468ull, 0x61702d736f757468ull, 0x63612d63656e7472ull, 0x65752d63656e7472ull,
+    0x65752d776573742dull, 0x65752d776573742dull, 0x65752d776573742dull, 0x73612d656173742dull,
+    0x75732d656173742dull, 0x75732d656173742dull, 0x75732d676f762d77ull, 0x75732d776573742dull,
+    0x75732d776573742dull, 0x65752d3100000000ull, 0x65752d3200000000ull, 0x65752d3300000000ull,
+    0x65752d3400000000ull, 0x75732d3100000000ull, 0x75732d3200000000ull, 0x75732d3300000000ull,
+    0x75732d3400000000ull, 0x6170707300000000ull, 0x7061617300000000ull, 0x7261672d636c6f75ull,
+    0x7261672d636c6f75ull, 0x6a636c6f75640000ull, 0x6a636c6f75642d76ull, 0x64656d6f00000000ull,
+    0x636e730000000000ull, 0x6d656d6265727300ull, 0x6e6f646562616c61ull, 0x6970000000000000ull,
+    0x6170700000000000ull, 0x7061617300000000ull, 0x6575000000000000ull, 0x6361726163616c00ull,
+    0x637573746f6d6572ull, 0x66656e7469676572ull, 0x6c796e7800000000ull, 0x6f63656c6f740000ull,
+    0x6f6e63696c6c6100ull, 0x6f6e7a6100000000ull, 0x737068696e780000ull, 0x7673000000000000ull,
+    0x7800000000000000ull, 0x79616c6900000000ull, 0x636c6f7564000000ull, 0x7374617469630000ull,
+    0x78656e0000000000ull, 0x6575000000000000ull, 0x6170700000000000ull, 0x6170690000000000ull,
+    0x7369746500000000ull, 0x70726f0000000000ull, 0x6a65640000000000ull, 0x6c6f6e0000000000ull,
+    0x7279640000000000ull, 0x7061676573000000ull, 0x6a73000000000000ull, 0x7532000000000000ull,
+    0x75322d6c6f63616cull, 0x626c6f6773706f74ull, 0x7363616c65666f72ull, 0x636c6f7564000000ull,
+    0x637573746f6d0000ull, 0x636c6f7564000000ull, 0x64796e0000000000ull, 0x64796e0000000000ull,
+    0x64796e646e730000ull, 0x64796e0000000000ull, 0x6974000000000000ull, 0x637573746f6d6572ull,
+    0x7573657200000000ull, 0x6c6f6e646f6e0000ull, 0x627a7a0000000000ull, 0x6769742d70616765ull,
+    0x626c6f6773706f74ull, 0x626c6f6773706f74ull, 0x626c6f6773706f74ull, 0x6a656c6173746963ull,
+    0x7573657200000000ull, 0x6669000000000000ull, 0x64656d6f00000000ull, 0x7061617300000000ull,
+    0x6461656d6f6e0000ull, 0x626c6f6773706f74ull, 0x7273730000000000ull, 0x626c6f6773706f74ull,
+    0x6d79746162697400ull, 0x7261767061676500ull, 0x74616269746f7264ull, 0x6c74640000000000ull,
+    0x706c630000000000ull, 0x6170700000000000ull, 0x6261636b79617264ull, 0x7061617300000000ull,
+    0x73656b6431000000ull, 0x756b300000000000ull, 0x64796e646e730000ull, 0x6964000000000000ull,
+    0x6170707300000000ull, 0x7374616765000000ull, 0x6d6f636b00000000ull, 0x7379730000000000ull,
+    0x6465766963657300ull, 0x6465760000000000ull, 0x6469737265630000ull, 0x70726f6400000000ull,
+    0x74657374696e6700ull, 0x636c6f75642d6672ull, 0x6700000000000000ull, 0x6a63000000000000ull,
+    0x6f70656e00000000ull, 0x6169736169000000ull, 0x616d610000000000ull, 0x616e6a6f00000000ull,
+    0x6173756b65000000ull, 0x6368697279750000ull, 0x6368697461000000ull, 0x6675736f00000000ull,
+    0x67616d61676f7269ull, 0x68616e6461000000ull, 0x68617a7500000000ull, 0x68656b696e616e00ull,
+    0x6869676173686975ull, 0x696368696e6f6d69ull, 0x696e617a61776100ull, 0x696e7579616d6100ull,
+    0x69737368696b6900ull, 0x6977616b75726100ull, 0x6b616e6965000000ull, 0x6b61726979610000ull,
+    0x6b61737567616900ull, 0x6b69726100000000ull, 0x6b69796f73750000ull, 0x6b6f6d616b690000ull,
+    0x6b6f6e616e000000ull, 0x6b6f746100000000ull, 0x6d6968616d610000ull, 0x6d69796f73686900ull,
+    0x6e697368696f0000ull, 0x6e69737368696e00ull, 0x6f62750000000000ull, 0x6f67756368690000ull,
+    0x6f68617275000000ull, 0x6f6b617a616b6900ull, 0x6f77617269617361ull, 0x7365746f00000000ull,
+    0x7368696b61747375ull, 0x7368696e73686972ull, 0x7368697461726100ull, 0x7461686172610000ull,
+    0x74616b6168616d61ull, 0x746f62697368696dull, 0x746f656900000000ull, 0x746f676f00000000ull,
+    0x746f6b6169000000ull, 0x746f6b6f6e616d65ull, 0x746f796f616b6500ull, 0x746f796f68617368ull,
+    0x746f796f6b617761ull, 0x746f796f6e650000ull, 0x746f796f74610000ull, 0x7473757368696d61ull,
+    0x7961746f6d690000ull, 0x616b697461000000ull, 0x64616973656e0000ull, 0x66756a697361746full,
+    0x676f6a6f6d650000ull, 0x6861636869726f67ull, 0x686170706f750000ull, 0x686967617368696eull,
+    0x686f6e6a6f000000ull, 0x686f6e6a796f0000ull, 0x696b617761000000ull, 0x6b616d696b6f616eull,
+    0x6b616d696f6b6100ull, 0x6b61746167616d69ull, 0x6b617a756e6f0000ull, 0x6b697461616b6974ull,
+    0x6b6f73616b610000ull, 0x6b796f7761000000ull, 0x6d697361746f0000ull, 0x6d6974616e650000ull,
+    0x6d6f7269796f7368ull, 0x6e696b61686f0000ull, 0x6e6f736869726f00ull, 0x6f64617465000000ull,
+    0x6f67610000000000ull, 0x6f67617461000000ull, 0x73656d626f6b7500ull, 0x796f6b6f74650000ull,
+    0x79757269686f6e6aull, 0x616f6d6f72690000ull, 0x676f6e6f68650000ull, 0x68616368696e6f68ull,
+    0x68617368696b616dull, 0x686972616e616900ull, 0x6869726f73616b69ull, 0x69746179616e6167ull,
+    0x6b75726f69736869ull, 0x6d69736177610000ull, 0x6d75747375000000ull, 0x6e616b61646f6d61ull,
+    0x6e6f68656a690000ull, 0x6f69726173650000ull, 0x6f77616e69000000ull, 0x726f6b756e6f6865ull,
+    0x73616e6e6f686500ull, 0x7368696368696e6full, 0x7368696e676f0000ull, 0x74616b6b6f000000ull,
+    0x746f776164610000ull, 0x7473756761727500ull, 0x7473757275746100ull, 0x6162696b6f000000ull,
+    0x6173616869000000ull, 0x63686f6e616e0000ull, 0x63686f7365690000ull, 0x63686f7368690000ull,
+    0x6368756f00000000ull, 0x66756e6162617368ull, 0x6675747473750000ull, 0x68616e616d696761ull,
+    0x6963686968617261ull, 0x696368696b617761ull, 0x696368696e6f6d69ull, 0x696e7a6169000000ull,
+    0x6973756d69000000ull, 0x6b616d6167617961ull, 0x6b616d6f67617761ull, 0x6b61736869776100ull,
+    0x6b61746f72690000ull, 0x6b61747375757261ull, 0x6b696d6974737500ull, 0x6b69736172617a75ull,
+    0x6b6f7a616b690000ull, 0x6b756a756b757269ull, 0x6b796f6e616e0000ull, 0x6d61747375646f00ull,
+    0x6d69646f72690000ull, 0x6d6968616d610000ull, 0x6d696e616d69626full, 0x6d6f626172610000ull,
+    0x6d757473757a6177ull, 0x6e61676172610000ull, 0x6e61676172657961ull, 0x6e6172617368696eull,
+    0x6e61726974610000ull, 0x6e6f646100000000ull, 0x6f616d6973686972ull, 0x6f6d696761776100ull,
+    0x6f6e6a756b750000ull, 0x6f74616b69000000ull, 0x73616b6165000000ull, 0x73616b7572610000ull,
+    0x7368696d6f667573ull, 0x73686972616b6f00ull, 0x736869726f690000ull, 0x7368697375690000ull,
+    0x736f646567617572ull, 0x736f736100000000ull, 0x74616b6f00000000ull, 0x7461746579616d61ull,
+    0x746f67616e650000ull, 0x746f686e6f73686full, 0x746f6d697361746full, 0x7572617961737500ull,
+    0x79616368696d6174ull, 0x7961636869796f00ull, 0x796f6b6169636869ull, 0x796f6b6f73686962ull,
+    0x796f7473756b6169ull, 0x61696e616e000000ull, 0x686f6e6169000000ull, 0x696b617461000000ull,
+    0x696d616261726900ull, 0x69796f0000000000ull, 0x6b616d696a696d61ull, 0x6b69686f6b750000ull,
+    0x6b756d616b6f6765ull, 0x6d6173616b690000ull, 0x6d617473756e6f00ull, 0x6d6174737579616dull,
+    0x6e616d696b617461ull, 0x6e696968616d6100ull, 0x6f7a750000000000ull, 0x7361696a6f000000ull,
+    0x736569796f000000ull, 0x7368696b6f6b7563ull, 0x746f626500000000ull, 0x746f6f6e00000000ull,
+    0x756368696b6f0000ull, 0x7577616a696d6100ull, 0x7961776174616861ull, 0x656368697a656e00ull,
+    0x65696865696a6900ull, 0x66756b7569000000ull, 0x696b656461000000ull, 0x6b6174737579616dull,
+    0x6d6968616d610000ull, 0x6d696e616d696563ull, 0x6f62616d61000000ull, 0x6f68690000000000ull,
+    0x6f6e6f0000000000ull, 0x7361626165000000ull, 0x73616b6169000000ull, 0x74616b6168616d61ull,
+    0x7473757275676100ull, 0x77616b6173610000ull, 0x6173686979610000ull, 0x62757a656e000000ull,
+    0x6368696b75676f00ull, 0x6368696b75686f00ull, 0x6368696b756a6f00ull, 0x6368696b75736869ull,
+    0x6368696b757a656eull, 0x6368756f00000000ull, 0x64617a6169667500ull, 0x66756b7563686900ull,
+    0x68616b6174610000ull, 0x6869676173686900ull, 0x6869726f6b617761ull, 0x6869736179616d61ull,
+    0x69697a756b610000ull, 0x696e617473756b69ull, 0x6b61686f00000000ull, 0x6b61737567610000ull,
+    0x6b61737579610000ull, 0x6b61776172610000ull, 0x6b656973656e0000ull, 0x6b6f676100000000ull,
+    0x6b75726174650000ull, 0x6b75726f67690000ull, 0x6b7572756d650000ull, 0x6d696e616d690000ull,
+    0x6d6979616b6f0000ull, 0x6d6979616d610000ull, 0x6d69796177616b61ull, 0x6d697a756d616b69ull,
+    0x6d756e616b617461ull, 0x6e616b6167617761ull, 0x6e616b616d610000ull, 0x6e69736869000000ull,
+    0x6e6f676174610000ull, 0x6f676f7269000000ull, 0x6f6b6167616b6900ull, 0x6f6b617761000000ull,
+    0x6f6b690000000000ull, 0x6f6d757461000000ull, 0x6f6e676100000000ull, 0x6f6e6f6a6f000000ull,
+    0x6f746f0000000000ull, 0x7361696761776100ull, 0x7361736167757269ull, 0x7368696e67750000ull,
+    0x7368696e796f7368ull, 0x73686f6e61690000ull, 0x736f656461000000ull, 0x7375650000000000ull,
+    0x7461636869617261ull, 0x7461676177610000ull, 0x74616b6174610000ull, 0x746f686f00000000ull,
+    0x746f796f74737500ull, 0x747375696b690000ull, 0x756b696861000000ull, 0x756d690000000000ull,
+    0x7573756900000000ull, 0x79616d6164610000ull, 0x79616d6500000000ull, 0x79616e6167617761ull,
+    0x79756b7568617368ull, 0x61697a7562616e67ull, 0x61697a756d697361ull, 0x61697a7577616b61ull,
+    0x6173616b61776100ull, 0x62616e6461690000ull, 0x6461746500000000ull, 0x66756b757368696dull,
+    0x66757275646f6e6full, 0x6675746162610000ull, 0x68616e6177610000ull, 0x6869676173686900ull,
+    0x6869726174610000ull, 0x6869726f6e6f0000ull, 0x6969746174650000ull, 0x696e617761736869ull,
+    0x697368696b617761ull, 0x6977616b69000000ull, 0x697a756d697a616bull, 0x6b6167616d696973ull,
+    0x6b616e6579616d61ull, 0x6b6177616d617461ull, 0x6b6974616b617461ull, 0x6b6974617368696full,
+    0x6b6f6f7269000000ull, 0x6b6f726979616d61ull, 0x6b756e696d690000ull, 0x6d69686172750000ull,
+    0x6d697368696d6100ull, 0x6e616d6965000000ull, 0x6e616e676f000000ull, 0x6e6973686961697aull,
+    0x6e69736869676f00ull, 0x6f6b756d61000000ull, 0x6f6d6f7465676f00ull, 0x6f6e6f0000000000ull,
+    0x6f74616d61000000ull, 0x73616d6567617761ull, 0x7368696d6f676f00ull, 0x73686972616b6177ull,
+    0x73686f7761000000ull, 0x736f6d6100000000ull, 0x73756b6167617761ull, 0x7461697368696e00ull,
+    0x74616d616b617761ull, 0x74616e6167757261ull, 0x74656e6569000000ull, 0x796162756b690000ull,
+    0x79616d61746f0000ull, 0x79616d6174737572ull, 0x79616e61697a7500ull, 0x7975676177610000ull,
+    0x616e706163686900ull, 0x656e610000000000ull, 0x6769667500000000ull, 0x67696e616e000000ull,
+    0x676f646f00000000ull, 0x67756a6f00000000ull, 0x68617368696d6100ull, 0x6869636869736f00ull,
+    0x6869646100000000ull, 0x6869676173686973ull, 0x6962696761776100ull, 0x696b656461000000ull,
+    0x6b616b616d696761ull, 0x6b616e6900000000ull, 0x6b61736168617261ull, 0x6b6173616d617473ull,
+    0x6b61776175650000ull, 0x6b69746167617461ull, 0x6d696e6f00000000ull, 0x6d696e6f6b616d6full,
+    0x6d6974616b650000ull, 0x6d697a756e616d69ull, 0x6d6f746f73750000ull, 0x6e616b6174737567ull,
+    0x6f67616b69000000ull, 0x73616b61686f6769ull, 0x73656b6900000000ull, 0x73656b6967616861ull,
+    0x73686972616b6177ull, 0x74616a696d690000ull, 0x74616b6179616d61ull, 0x7461727569000000ull,
+    0x746f6b6900000000ull, 0x746f6d696b610000ull, 0x77616e6f75636869ull, 0x79616d6167617461ull,
+    0x79616f7473750000ull, 0x796f726f00000000ull, 0x616e6e616b610000ull, 0x636869796f646100ull,
+    0x66756a696f6b6100ull, 0x6869676173686961ull, 0x69736573616b6900ull, 0x6974616b75726100ull,
+    0x6b616e6e61000000ull, 0x6b616e7261000000ull, 0x6b6174617368696eull, 0x6b61776162610000ull,
+    0x6b69727975000000ull, 0x6b75736174737500ull, 0x6d61656261736869ull, 0x6d65697761000000ull,
+    0x6d69646f72690000ull, 0x6d696e616b616d69ull, 0x6e6167616e6f6861ull, 0x6e616b616e6f6a6full,
+    0x6e616e6d6f6b7500ull, 0x6e756d6174610000ull, 0x6f697a756d690000ull, 0x6f72610000000000ull,
+    0x6f74610000000000ull, 0x73686962756b6177ull, 0x7368696d6f6e6974ull, 0x7368696e746f0000ull,
+    0x73686f7761000000ull, 0x74616b6173616b69ull, 0x74616b6179616d61ull, 0x74616d616d757261ull,
+    0x7461746562617961ull, 0x746f6d696f6b6100ull, 0x7473756b69796f6eull, 0x7473756d61676f69ull,
+    0x75656e6f00000000ull, 0x796f7368696f6b61ull, 0x6173616d696e616dull, 0x6461697761000000ull,
+    0x6574616a696d6100ull, 0x6675636875000000ull, 0x66756b7579616d61ull, 0x68617473756b6169ull,
+    0x6869676173686968ull, 0x686f6e676f000000ull, 0x6a696e73656b696bull, 0x6b61697461000000ull,
+    0x6b75690000000000ull, 0x6b756d616e6f0000ull, 0x6b75726500000000ull, 0x6d69686172610000ull,
+    0x6d69796f73686900ull, 0x6e616b6100000000ull, 0x6f6e6f6d69636869ull, 0x6f73616b696b616dull,
+    0x6f74616b65000000ull, 0x73616b6100000000ull, 0x7365726100000000ull, 0x736572616e697368ull,
+    0x7368696e69636869ull, 0x73686f6261726100ull, 0x74616b6568617261ull, 0x6162617368697269ull,
+    0x6162697261000000ull, 0x6169626574737500ull, 0x616b616269726100ull, 0x616b6b6573686900ull,
+    0x61736168696b6177ull, 0x6173686962657473ull, 0x6173686f726f0000ull, 0x6173736162750000ull,
+    0x617473756d610000ull, 0x6269626169000000ull, 0x6269656900000000ull, 0x626966756b610000ull,
+    0x6269686f726f0000ull, 0x62697261746f7269ull, 0x6368697070756265ull, 0x636869746f736500ull,
+    0x6461746500000000ull, 0x6562657473750000ull, 0x656d626574737500ull, 0x656e697761000000ull,
+    0x6572696d6f000000ull, 0x6573616e00000000ull, 0x6573617368690000ull, 0x66756b6167617761ull,
+    0x66756b757368696dull, 0x667572616e6f0000ull, 0x6675727562697261ull, 0x6861626f726f0000ull,
+    0x68616b6f64617465ull, 0x68616d61746f6e62ull, 0x686964616b610000ull, 0x686967617368696bull,
+    0x686967617368696bull, 0x6869726f6f000000ull, 0x686f6b7572797500ull, 0x686f6b75746f0000ull,
+    0x686f6e6265747375ull, 0x686f726f6b616e61ull, 0x686f726f6e6f6265ull, 0x696b656461000000ull,
+    0x696d616b616e6500ull, 0x697368696b617269ull, 0x6977616d697a6177ull, 0x6977616e61690000ull,
+    0x6b616d6966757261ull, 0x6b616d696b617761ull, 0x6b616d6973686968ull, 0x6b616d6973756e61ull,
+    0x6b616d6f656e6169ull, 0x6b61796162650000ull, 0x6b656d6275636869ull, 0x6b696b6f6e616900ull,
+    0x6b696d6f62657473ull, 0x6b6974616869726full, 0x6b6974616d690000ull, 0x6b69796f7361746full,
+    0x6b6f7368696d697aull, 0x6b756e6e65707075ull, 0x6b75726979616d61ull, 0x6b75726f6d617473ull,
+    0x6b75736869726f00ull, 0x6b75746368616e00ull, 0x6b796f7761000000ull, 0x6d617368696b6500ull,
+    0x6d617473756d6165ull, 0x6d696b6173610000ull, 0x6d696e616d696675ull, 0x6d6f6d6265747375ull,
+    0x6d6f736575736869ull, 0x6d756b6177610000ull, 0x6d75726f72616e00ull, 0x6e61696500000000ull,
+    0x6e616b6167617761ull, 0x6e616b6173617473ull, 0x6e616b61746f6d62ull, 0x6e616e6165000000ull,
+    0x6e616e706f726f00ull, 0x6e61796f726f0000ull, 0x6e656d75726f0000ull, 0x6e69696b61707075ull,
+    0x6e696b6900000000ull, 0x6e697368696f6b6full, 0x6e6f626f72696265ull, 0x6e756d6174610000ull,
+    0x6f62696869726f00ull, 0x6f62697261000000ull, 0x6f6b65746f000000ull, 0x6f6b6f7070650000ull,
+    0x6f74617275000000ull, 0x6f746f6265000000ull, 0x6f746f66756b6500ull, 0x6f746f696e657070ull,
+    0x6f756d7500000000ull, 0x6f7a6f7261000000ull, 0x7069707075000000ull, 0x72616e6b6f736869ull,
+    0x726562756e000000ull, 0x72696b7562657473ull, 0x7269736869726900ull, 0x7269736869726966ull,
+    0x7361726f6d610000ull, 0x7361727566757473ull, 0x7368616b6f74616eull, 0x7368617269000000ull,
+    0x7368696265636861ull, 0x7368696265747375ull, 0x7368696b61626500ull, 0x7368696b616f6900ull,
+    0x7368696d616d616bull, 0x7368696d697a7500ull, 0x7368696d6f6b6177ull, 0x7368696e7368696eull,
+    0x7368696e746f6b75ull, 0x73686972616e756bull, 0x73686972616f6900ull, 0x7368697269756368ull,
+    0x736f626574737500ull, 0x73756e6167617761ull, 0x7461696b69000000ull, 0x74616b6173750000ull,
+    0x74616b696b617761ull, 0x74616b696e6f7565ull, 0x74657368696b6167ull, 0x746f626574737500ull,
+    0x746f686d61000000ull, 0x746f6d616b6f6d61ull, 0x746f6d6172690000ull, 0x746f796100000000ull,
+    0x746f79616b6f0000ull, 0x746f796f746f6d69ull, 0x746f796f75726100ull, 0x7473756265747375ull,
+    0x7473756b69676174ull, 0x7572616b61776100ull, 0x7572617573750000ull, 0x7572797500000000ull,
+    0x7574617368696e61ull, 0x77616b6b616e6169ull, 0x77617373616d7500ull, 0x79616b756d6f0000ull,
+    0x796f696368690000ull, 0x61696f6900000000ull, 0x616b617368690000ull, 0x616b6f0000000000ull,
+    0x616d61676173616bull, 0x616f67616b690000ull, 0x617361676f000000ull, 0x6173686979610000ull,
+    0x6177616a69000000ull, 0x66756b7573616b69ull, 0x676f7368696b6900ull, 0x686172696d610000ull,
+    0x68696d656a690000ull, 0x696368696b617761ull, 0x696e616761776100ull, 0x6974616d69000000ull,
+    0x6b616b6f67617761ull, 0x6b616d69676f7269ull, 0x6b616d696b617761ull, 0x6b61736169000000ull,
+    0x6b61737567610000ull, 0x6b6177616e697368ull, 0x6d696b6900000000ull, 0x6d696e616d696177ull,
+    0x6e697368696e6f6dull, 0x6e6973686977616bull, 0x6f6e6f0000000000ull, 0x73616e6461000000ull,
+    0x73616e6e616e0000ull, 0x7361736179616d61ull, 0x7361796f00000000ull, 0x7368696e67750000ull,
+    0x7368696e6f6e7365ull, 0x736869736f000000ull, 0x73756d6f746f0000ull, 0x7461697368690000ull,
+    0x74616b6100000000ull, 0x74616b6172617a75ull, 0x74616b617361676full, 0x74616b696e6f0000ull,
+    0x74616d6261000000ull, 0x74617473756e6f00ull, 0x746f796f6f6b6100ull, 0x7961627500000000ull,
+    0x7961736869726f00ull, 0x796f6b6100000000ull, 0x796f6b6177610000ull, 0x616d690000000000ull,
+    0x6173616869000000ull, 0x62616e646f000000ull, 0x6368696b75736569ull, 0x646169676f000000ull,
+    0x66756a6973686972ull, 0x6869746163686900ull, 0x686974616368696eull, 0x686974616368696full,
+    0x686974616368696full, 0x69626172616b6900ull, 0x696e610000000000ull, 0x696e617368696b69ull,
+    0x6974616b6f000000ull, 0x6977616d61000000ull, 0x6a6f736f00000000ull, 0x6b616d6973750000ull,
+    0x6b6173616d610000ull, 0x6b617368696d6100ull, 0x6b6173756d696761ull, 0x6b6f676100000000ull,
+    0x6d69686f00000000ull, 0x6d69746f00000000ull, 0x6d6f726979610000ull, 0x6e616b6100000000ull,
+    0x6e616d6567617461ull, 0x6f61726169000000ull, 0x6f67617761000000ull, 0x6f6d6974616d6100ull,
+    0x727975676173616bull, 0x73616b6169000000ull, 0x73616b7572616761ull, 0x7368696d6f646174ull,
+    0x7368696d6f747375ull, 0x736869726f736174ull, 0x736f776100000000ull, 0x7375696675000000ull,
+    0x74616b6168616769ull, 0x74616d617473756bull, 0x746f6b6169000000ull, 0x746f6d6f62650000ull,
+    0x746f6e6500000000ull, 0x746f726964650000ull, 0x7473756368697572ull, 0x7473756b75626100ull,
+    0x7563686968617261ull, 0x757368696b750000ull, 0x7961636869796f00ull, 0x79616d6167617461ull,
+    0x7961776172610000ull, 0x79756b6900000000ull, 0x616e616d697a7500ull, 0x68616b7569000000ull,
+    0x68616b7573616e00ull, 0x6b61676100000000ull, 0x6b61686f6b750000ull, 0x6b616e617a617761ull,
+    0x6b6177616b697461ull, 0x6b6f6d6174737500ull, 0x6e616b616e6f746full, 0x6e616e616f000000ull,
+    0x6e6f6d6900000000ull, 0x6e6f6e6f69636869ull, 0x6e6f746f00000000ull, 0x7368696b61000000ull,
+    0x73757a7500000000ull, 0x7473756261746100ull, 0x7473757275676900ull, 0x756368696e616461ull,
+    0x77616a696d610000ull, 0x6675646169000000ull, 0x66756a6973617761ull, 0x68616e616d616b69ull,
+    0x68697261697a756dull, 0x6869726f6e6f0000ull, 0x696368696e6f6865ull, 0x696368696e6f7365ull,
+    0x697761697a756d69ull, 0x6977617465000000ull, 0x6a6f626f6a690000ull, 0x6b616d6169736869ull,
+    0x6b616e6567617361ull, 0x6b6172756d616900ull, 0x6b61776169000000ull, 0x6b6974616b616d69ull,
+    0x6b756a6900000000ull, 0x6b756e6f68650000ull, 0x6b757a756d616b69ull, 0x6d6979616b6f0000ull,
+    0x6d697a7573617761ull, 0x6d6f72696f6b6100ull, 0x6e696e6f68650000ull, 0x6e6f646100000000ull,
+    0x6f66756e61746f00ull, 0x6f73687500000000ull, 0x6f74737563686900ull, 0x72696b757a656e74ull,
+    0x7368697761000000ull, 0x7368697a756b7569ull, 0x73756d6974610000ull, 0x74616e6f68617461ull,
+    0x746f6e6f00000000ull, 0x7961686162610000ull, 0x79616d6164610000ull, 0x6179616761776100ull,
+    0x686967617368696bull, 0x6b616e6f6e6a6900ull, 0x6b6f746f68697261ull, 0x6d616e6e6f000000ull,
+    0x6d61727567616d65ull, 0x6d69746f796f0000ull, 0x6e616f7368696d61ull, 0x73616e756b690000ull,
+    0x7461646f74737500ull, 0x74616b616d617473ull, 0x746f6e6f73686f00ull, 0x756368696e6f6d69ull,
+    0x7574617a75000000ull, 0x7a656e7473756a69ull, 0x616b756e65000000ull, 0x616d616d69000000ull,
+    0x68696f6b69000000ull, 0x6973610000000000ull, 0x6973656e00000000ull, 0x697a756d69000000ull,
+    0x6b61676f7368696dull, 0x6b616e6f79610000ull, 0x6b6177616e616265ull, 0x6b696e6b6f000000ull,
+    0x6b6f7579616d6100ull, 0x6d616b7572617a61ull, 0x6d617473756d6f74ull, 0x6d696e616d697461ull,
+    0x6e616b6174616e65ull, 0x6e697368696e6f6full, 0x73617473756d6173ull, 0x736f6f0000000000ull,
+    0x746172756d697a75ull, 0x7975737569000000ull, 0x61696b6177610000ull, 0x6174737567690000ull,
+    0x6179617365000000ull, 0x636869676173616bull, 0x6562696e61000000ull, 0x66756a6973617761ull,
+    0x686164616e6f0000ull, 0x68616b6f6e650000ull, 0x686972617473756bull, 0x6973656861726100ull,
+    0x6b61697365690000ull, 0x6b616d616b757261ull, 0x6b69796f6b617761ull, 0x6d61747375646100ull,
+    0x6d696e616d696173ull, 0x6d69757261000000ull, 0x6e616b6169000000ull, 0x6e696e6f6d697961ull,
+    0x6f64617761726100ull, 0x6f69000000000000ull, 0x6f69736f00000000ull, 0x736167616d696861ull,
+    0x73616d756b617761ull, 0x7473756b75690000ull, 0x79616d616b697461ull, 0x79616d61746f0000ull,
+    0x796f6b6f73756b61ull, 0x7975676177617261ull, 0x7a616d6100000000ull, 0x7a75736869000000ull,
+    0x6369747900000000ull, 0x6369747900000000ull, 0x6369747900000000ull, 0x616b690000000000ull,
+    0x6765697365690000ull, 0x686964616b610000ull, 0x6869676173686974ull, 0x696e6f0000000000ull,
+    0x6b6167616d690000ull, 0x6b616d6900000000ull, 0x6b69746167617761ull, 0x6b6f636869000000ull,
+    0x6d69686172610000ull, 0x6d6f746f79616d61ull, 0x6d75726f746f0000ull, 0x6e61686172690000ull,
+    0x6e616b616d757261ull, 0x6e616e6b6f6b7500ull, 0x6e69736869746f73ull, 0x6e69796f646f6761ull,
+    0x6f63686900000000ull, 0x6f6b617761000000ull, 0x6f746f796f000000ull, 0x6f7473756b690000ull,
+    0x73616b6177610000ull, 0x73756b756d6f0000ull, 0x737573616b690000ull, 0x746f736100000000ull,
+    0x746f73617368696dull, 0x746f796f00000000ull, 0x7473756e6f000000ull, 0x756d616a69000000ull,
+    0x7961737564610000ull, 0x7975737568617261ull, 0x616d616b75736100ull, 0x6172616f00000000ull,
+    0x61736f0000000000ull, 0x63686f796f000000ull, 0x67796f6b75746f00ull, 0x6b616d69616d616bull,
+    0x6b696b7563686900ull, 0x6b756d616d6f746full, 0x6d617368696b6900ull, 0x6d6966756e650000ull,
+    0x6d696e616d617461ull, 0x6d696e616d696f67ull, 0x6e61676173750000ull, 0x6e69736869686172ull,
+    0x6f67756e69000000ull, 0x6f7a750000000000ull, 0x73756d6f746f0000ull, 0x74616b616d6f7269ull,
+    0x756b690000000000ull, 0x75746f0000000000ull, 0x79616d6167610000ull, 0x79616d61746f0000ull,
+    0x7961747375736869ull, 0x6179616265000000ull, 0x66756b7563686979ull, 0x6869676173686979ull,
+    0x6964650000000000ull, 0x696e650000000000ull, 0x6a6f796f00000000ull, 0x6b616d656f6b6100ull,
+    0x6b616d6f00000000ull, 0x6b69746100000000ull, 0x6b697a7500000000ull, 0x6b756d6979616d61ull,
+    0x6b796f74616d6261ull, 0x6b796f74616e6162ull, 0x6b796f74616e676full, 0x6d61697a75727500ull,
+    0x6d696e616d690000ull, 0x6d696e616d697961ull, 0x6d6979617a750000ull, 0x6d756b6f00000000ull,
+    0x6e6167616f6b616bull, 0x6e616b6167796f00ull, 0x6e616e74616e0000ull, 0x6f79616d617a616bull,
+    0x73616b796f000000ull, 0x7365696b61000000ull, 0x74616e6162650000ull, 0x756a690000000000ull,
+    0x756a697461776172ull, 0x77617a756b610000ull, 0x79616d617368696eull, 0x7961776174610000ull,
+    0x6173616869000000ull, 0x696e616265000000ull, 0x6973650000000000ull, 0x6b616d6579616d61ull,
+    0x6b617761676f6500ull, 0x6b69686f00000000ull, 0x6b69736f73616b69ull, 0x6b69776100000000ull,
+    0x6b6f6d6f6e6f0000ull, 0x6b756d616e6f0000ull, 0x6b7577616e610000ull, 0x6d6174737573616bull,
+    0x6d65697761000000ull, 0x6d6968616d610000ull, 0x6d696e616d696973ull, 0x6d69737567690000ull,
+    0x6d6979616d610000ull, 0x6e61626172690000ull, 0x7368696d61000000ull, 0x73757a756b610000ull,
+    0x7461646f00000000ull, 0x7461696b69000000ull, 0x74616b6900000000ull, 0x74616d616b690000ull,
+    0x746f626100000000ull, 0x7473750000000000ull, 0x75646f6e6f000000ull, 0x7572657368696e6full,
+    0x7761746172616900ull, 0x796f6b6b61696368ull, 0x667572756b617761ull, 0x686967617368696dull,
+    0x697368696e6f6d61ull, 0x6977616e756d6100ull, 0x6b616b7564610000ull, 0x6b616d6900000000ull,
+    0x6b61776173616b69ull, 0x6d6172756d6f7269ull, 0x6d61747375736869ull, 0x6d696e616d697361ull,
+    0x6d697361746f0000ull, 0x6d75726174610000ull, 0x6e61746f72690000ull, 0x6f67617761726100ull,
+    0x6f68697261000000ull, 0x6f6e616761776100ull, 0x6f73616b69000000ull, 0x7269667500000000ull,
+    0x73656d696e650000ull, 0x7368696261746100ull, 0x7368696368696b61ull, 0x7368696b616d6100ull,
+    0x7368696f67616d61ull, 0x736869726f697368ull, 0x746167616a6f0000ull, 0x7461697761000000ull,
+    0x746f6d6500000000ull, 0x746f6d6979610000ull, 0x77616b7579610000ull, 0x7761746172690000ull,
+    0x79616d616d6f746full, 0x7a616f0000000000ull, 0x6179610000000000ull, 0x6562696e6f000000ull,
+    0x676f6b6173650000ull, 0x6879756761000000ull, 0x6b61646f67617761ull, 0x6b6177616d696e61ull,
+    0x6b696a6f00000000ull, 0x6b69746167617761ull, 0x6b6974616b617461ull, 0x6b69746175726100ull,
+    0x6b6f626179617368ull, 0x6b756e69746f6d69ull, 0x6b757368696d6100ull, 0x6d696d6174610000ull,
+    0x6d6979616b6f6e6full, 0x6d6979617a616b69ull, 0x6d6f726f7473756bull, 0x6e696368696e616eull,
+    0x6e697368696d6572ull, 0x6e6f62656f6b6100ull, 0x736169746f000000ull, 0x7368696962610000ull,
+    0x7368696e746f6d69ull, 0x74616b6168617275ull, 0x74616b616e616265ull, 0x74616b617a616b69ull,
+    0x7473756e6f000000ull, 0x6163686900000000ull, 0x6167656d61747375ull, 0x616e616e00000000ull,
+    0x616f6b6900000000ull, 0x6173616869000000ull, 0x617a756d696e6f00ull, 0x6368696b75686f6bull,
+    0x6368696b756d6100ull, 0x6368696e6f000000ull, 0x66756a696d690000ull, 0x68616b7562610000ull,
+    0x6861726100000000ull, 0x6869726179610000ull, 0x6969646100000000ull, 0x69696a696d610000ull,
+    0x696979616d610000ull, 0x69697a756e610000ull, 0x696b656461000000ull, 0x696b7573616b6100ull,
+    0x696e610000000000ull, 0x6b617275697a6177ull, 0x6b6177616b616d69ull, 0x6b69736f00000000ull,
+    0x6b69736f66756b75ull, 0x6b69746161696b69ull, 0x6b6f6d6167616e65ull, 0x6b6f6d6f726f0000ull,
+    0x6d617473756b6177ull, 0x6d617473756d6f74ull, 0x6d69617361000000ull, 0x6d696e616d696169ull,
+    0x6d696e616d696d61ull, 0x6d696e616d696d69ull, 0x6d696e6f77610000ull, 0x6d69796164610000ull,
+    0x6d69796f74610000ull, 0x6d6f6368697a756bull, 0x6e6167616e6f0000ull, 0x6e61676177610000ull,
+    0x6e616769736f0000ull, 0x6e616b6167617761ull, 0x6e616b616e6f0000ull, 0x6e6f7a6177616f6eull,
+    0x6f62757365000000ull, 0x6f67617761000000ull, 0x6f6b617961000000ull, 0x6f6d616368690000ull,
+    0x6f6d690000000000ull, 0x6f6f6b7577610000ull, 0x6f6f7368696b6100ull, 0x6f74616b69000000ull,
+    0x6f74617269000000ull, 0x73616b6165000000ull, 0x73616b616b690000ull, 0x73616b7500000000ull,
+    0x73616b75686f0000ull, 0x7368696d6f737577ull, 0x7368696e616e6f6dull, 0x7368696f6a697269ull,
+    0x7375776100000000ull, 0x73757a616b610000ull, 0x74616b6167690000ull, 0x74616b616d6f7269ull,
+    0x74616b6179616d61ull, 0x746174657368696eull, 0x74617473756e6f00ull, 0x746f67616b757368ull,
+    0x746f677572610000ull, 0x746f6d6900000000ull, 0x7565646100000000ull, 0x7761646100000000ull,
+    0x79616d6167617461ull, 0x79616d616e6f7563ull, 0x796173616b610000ull, 0x796173756f6b6100ull,
+    0x6368696a69776100ull, 0x6675747375000000ull, 0x676f746f00000000ull, 0x686173616d690000ull,
+    0x68697261646f0000ull, 0x696b690000000000ull, 0x6973616861796100ull, 0x6b61776174616e61ull,
+    0x6b756368696e6f74ull, 0x6d61747375757261ull, 0x6e61676173616b69ull, 0x6f62616d61000000ull,
+    0x6f6d757261000000ull, 0x6f7365746f000000ull, 0x7361696b61690000ull, 0x73617365626f0000ull,
+    0x7365696869000000ull, 0x7368696d61626172ull, 0x7368696e6b616d69ull, 0x746f676974737500ull,
+    0x7473757368696d61ull, 0x756e7a656e000000ull, 0x6369747900000000ull, 0x616e646f00000000ull,
+    0x676f736500000000ull, 0x6865677572690000ull, 0x6869676173686979ull, 0x696b617275676100ull,
+    0x696b6f6d61000000ull, 0x6b616d696b697461ull, 0x6b616e6d616b6900ull, 0x6b61736869626100ull,
+    0x6b61736869686172ull, 0x6b61747375726167ull, 0x6b61776169000000ull, 0x6b6177616b616d69ull,
+    0x6b6177616e697368ull, 0x6b6f72796f000000ull, 0x6b75726f74616b69ull, 0x6d69747375650000ull,
+    0x6d6979616b650000ull, 0x6e61726100000000ull, 0x6e6f736567617761ull, 0x6f6a690000000000ull,
+    0x6f75646100000000ull, 0x6f796f646f000000ull, 0x73616b7572616900ull, 0x73616e676f000000ull,
+    0x7368696d6f696368ull, 0x7368696d6f6b6974ull, 0x7368696e6a6f0000ull, 0x736f6e6900000000ull,
+    0x74616b61746f7269ull, 0x7461776172616d6full, 0x74656e6b61776100ull, 0x74656e7269000000ull,
+    0x7564610000000000ull, 0x79616d61746f6b6full, 0x79616d61746f7461ull, 0x79616d617a6f6500ull,
+    0x796f7368696e6f00ull, 0x617365696e657400ull, 0x67656869726e0000ull, 0x6167610000000000ull,
+    0x6167616e6f000000ull, 0x676f73656e000000ull, 0x69746f6967617761ull, 0x697a756d6f7a616bull,
+    0x6a6f657473750000ull, 0x6b616d6f00000000ull, 0x6b61726977610000ull, 0x6b6173686977617aull,
+    0x6d696e616d69756full, 0x6d697473756b6500ull, 0x6d75696b61000000ull, 0x6d7572616b616d69ull,
+    0x6d796f6b6f000000ull, 0x6e6167616f6b6100ull, 0x6e69696761746100ull, 0x6f6a697961000000ull,
+    0x6f6d690000000000ull, 0x7361646f00000000ull, 0x73616e6a6f000000ull, 0x736569726f000000ull,
+    0x736569726f750000ull, 0x73656b696b617761ull, 0x7368696261746100ull, 0x746167616d690000ull,
+    0x7461696e61690000ull, 0x746f6368696f0000ull, 0x746f6b616d616368ull, 0x74737562616d6500ull,
+    0x7473756e616e0000ull, 0x756f6e756d610000ull, 0x796168696b6f0000ull, 0x796f697461000000ull,
+    0x79757a6177610000ull, 0x6265707075000000ull, 0x62756e676f6f6e6full, 0x62756e676f74616bull,
+    0x686173616d610000ull, 0x68696a6900000000ull, 0x68696d657368696dull, 0x6869746100000000ull,
+    0x6b616d6974737565ull, 0x6b6f6b6f6e6f6500ull, 0x6b756a7500000000ull, 0x6b756e6973616b69ull,
+    0x6b75737500000000ull, 0x6f69746100000000ull, 0x7361696b69000000ull, 0x74616b6574610000ull,
+    0x7473756b756d6900ull, 0x7573610000000000ull, 0x7573756b69000000ull, 0x7975667500000000ull,
+    0x616b616977610000ull, 0x6173616b75636869ull, 0x62697a656e000000ull, 0x686179617368696dull,
+    0x6962617261000000ull, 0x6b6167616d696e6full, 0x6b6173616f6b6100ull, 0x6b6962696368756full,
+    0x6b756d656e616e00ull, 0x6b7572617368696bull, 0x6d616e6977610000ull, 0x6d6973616b690000ull,
+    0x6e61676900000000ull, 0x6e69696d69000000ull, 0x6e69736869617761ull, 0x6f6b6179616d6100ull,
+    0x7361746f73686f00ull, 0x7365746f75636869ull, 0x7368696e6a6f0000ull, 0x73686f6f00000000ull,
+    0x736f6a6100000000ull, 0x74616b6168617368ull, 0x74616d616e6f0000ull, 0x74737579616d6100ull,
+    0x77616b6500000000ull, 0x79616b6167650000ull, 0x6167756e69000000ull, 0x67696e6f77616e00ull,
+    0x67696e6f7a610000ull, 0x67757368696b616dull, 0x6861656261727500ull, 0x6869676173686900ull,
+    0x6869726172610000ull, 0x6968657961000000ull, 0x6973686967616b69ull, 0x697368696b617761ull,
+    0x69746f6d616e0000ull, 0x697a656e61000000ull, 0x6b6164656e610000ull, 0x6b696e0000000000ull,
+    0x6b69746164616974ull, 0x6b6974616e616b61ull, 0x6b756d656a696d61ull, 0x6b756e6967616d69ull,
+    0x6d696e616d696461ull, 0x6d6f746f62750000ull, 0x6e61676f00000000ull, 0x6e61686100000000ull,
+    0x6e616b6167757375ull, 0x6e616b696a696e00ull, 0x6e616e6a6f000000ull, 0x6e69736869686172ull,
+    0x6f67696d69000000ull, 0x6f6b696e61776100ull, 0x6f6e6e6100000000ull, 0x7368696d6f6a6900ull,
+    0x74616b65746f6d69ull, 0x746172616d610000ull, 0x746f6b617368696bull, 0x746f6d6967757375ull,
+    0x746f6e616b690000ull, 0x757261736f650000ull, 0x7572756d61000000ull, 0x7961657365000000ull,
+    0x796f6d6974616e00ull, 0x796f6e6162617275ull, 0x796f6e6167756e69ull, 0x7a616d616d690000ull,
+    0x6162656e6f000000ull, 0x6368696861796161ull, 0x6368756f00000000ull, 0x646169746f000000ull,
+    0x66756a6969646572ull, 0x686162696b696e6full, 0x68616e6e616e0000ull, 0x686967617368696full,
+    0x6869676173686973ull, 0x6869676173686979ull, 0x686972616b617461ull, 0x69626172616b6900ull,
+    0x696b656461000000ull, 0x697a756d69000000ull, 0x697a756d696f7473ull, 0x697a756d6973616eull,
+    0x6b61646f6d610000ull, 0x6b61697a756b6100ull, 0x6b616e616e000000ull, 0x6b61736869776172ull,
+    0x6b6174616e6f0000ull, 0x6b6177616368696eull, 0x6b69736869776164ull, 0x6b69746100000000ull,
+    0x6b756d61746f7269ull, 0x6d61747375626172ull, 0x6d696e61746f0000ull, 0x6d696e6f68000000ull,
+    0x6d6973616b690000ull, 0x6d6f726967756368ull, 0x6e65796167617761ull, 0x6e69736869000000ull,
+    0x6e6f736500000000ull, 0x6f73616b61736179ull, 0x73616b6169000000ull, 0x736179616d610000ull,
+    0x73656e6e616e0000ull, 0x7365747473750000ull, 0x7368696a6f6e6177ull, 0x7368696d616d6f74ull,
+    0x7375697461000000ull, 0x746164616f6b6100ull, 0x7461697368690000ull, 0x74616a6972690000ull,
+    0x74616b6169736869ull, 0x74616b617473756bull, 0x746f6e6461626179ull, 0x746f796f6e616b61ull,
+    0x746f796f6e6f0000ull, 0x79616f0000000000ull, 0x617269616b650000ull, 0x6172697461000000ull,
+    0x66756b75646f6d69ull, 0x67656e6b61690000ull, 0x68616d6174616d61ull, 0x68697a656e000000ull,
+    0x696d617269000000ull, 0x6b616d696d696e65ull, 0x6b616e7a616b6900ull, 0x6b61726174737500ull,
+    0x6b617368696d6100ull, 0x6b69746167617461ull, 0x6b69746168617461ull, 0x6b6979616d610000ull,
+    0x6b6f75686f6b7500ull, 0x6b79757261676900ull, 0x6e69736869617269ull, 0x6f67690000000000ull,
+    0x6f6d616368690000ull, 0x6f75636869000000ull, 0x7361676100000000ull, 0x736869726f697368ull,
+    0x74616b7500000000ull, 0x7461726100000000ull, 0x746f737500000000ull, 0x796f7368696e6f67ull,
+    0x6172616b61776100ull, 0x6173616b61000000ull, 0x6368696368696275ull, 0x66756a696d690000ull,
+    0x66756a696d696e6full, 0x66756b6179610000ull, 0x68616e6e6f000000ull, 0x68616e7975000000ull,
+    0x6861737564610000ull, 0x6861746f67617961ull, 0x6861746f79616d61ull, 0x686964616b610000ull,
+    0x6869676173686963ull, 0x686967617368696dull, 0x686f6e6a6f000000ull, 0x696e610000000000ull,
+    0x6972756d61000000ull, 0x6977617473756b69ull, 0x6b616d69697a756dull, 0x6b616d696b617761ull,
+    0x6b616d697361746full, 0x6b6173756b616265ull, 0x6b617761676f6500ull, 0x6b61776167756368ull,
+    0x6b6177616a696d61ull, 0x6b617a6f00000000ull, 0x6b6974616d6f746full, 0x6b6f736869676179ull,
+    0x6b6f756e6f737500ull, 0x6b756b6900000000ull, 0x6b756d6167617961ull, 0x6d61747375627573ull,
+    0x6d696e616e6f0000ull, 0x6d697361746f0000ull, 0x6d69796173686972ull, 0x6d69796f73686900ull,
+    0x6d6f726f79616d61ull, 0x6e616761746f726full, 0x6e616d6567617761ull, 0x6e69697a61000000ull,
+    0x6f67616e6f000000ull, 0x6f67617761000000ull, 0x6f676f7365000000ull, 0x6f6b656761776100ull,
+    0x6f6d697961000000ull, 0x6f74616b69000000ull, 0x72616e7a616e0000ull, 0x72796f6b616d6900ull,
+    0x73616974616d6100ull, 0x73616b61646f0000ull, 0x7361747465000000ull, 0x736179616d610000ull,
+    0x7368696b69000000ull, 0x73686972616f6b61ull, 0x736f6b6100000000ull, 0x73756769746f0000ull,
+    0x746f646100000000ull, 0x746f6b6967617761ull, 0x746f6b6f726f7a61ull, 0x7473757275676173ull,
+    0x7572617761000000ull, 0x7761726162690000ull, 0x79617368696f0000ull, 0x796f6b6f7a650000ull,
+    0x796f6e6f00000000ull, 0x796f726969000000ull, 0x796f736869646100ull, 0x796f7368696b6177ull,
+    0x796f7368696d6900ull, 0x6369747900000000ull, 0x6369747900000000ull, 0x616973686f000000ull,
+    0x67616d6f00000000ull, 0x686967617368696full, 0x68696b6f6e650000ull, 0x6b6f6b6100000000ull,
+    0x6b6f6e616e000000ull, 0x6b6f736569000000ull, 0x6b6f746f00000000ull, 0x6b75736174737500ull,
+    0x6d61696261726100ull, 0x6d6f726979616d61ull, 0x6e61676168616d61ull, 0x6e69736869617a61ull,
+    0x6e6f746f67617761ull, 0x6f6d696861636869ull, 0x6f74737500000000ull, 0x726974746f000000ull,
+    0x7279756f68000000ull, 0x74616b617368696dull, 0x74616b617473756bull, 0x746f726168696d65ull,
+    0x746f796f7361746full, 0x7961737500000000ull, 0x616b616769000000ull, 0x616d610000000000ull,
+    0x676f747375000000ull, 0x68616d6164610000ull, 0x6869676173686969ull, 0x68696b6177610000ull,
+    0x68696b696d690000ull, 0x697a756d6f000000ull, 0x6b616b696e6f6b69ull, 0x6d61737564610000ull,
+    0x6d61747375650000ull, 0x6d697361746f0000ull, 0x6e697368696e6f73ull, 0x6f68646100000000ull,
+    0x6f6b696e6f736869ull, 0x6f6b75697a756d6full, 0x7368696d616e6500ull, 0x74616d6179750000ull,
+    0x74737577616e6f00ull, 0x756e6e616e000000ull, 0x79616b756d6f0000ull, 0x7961737567690000ull,
+    0x79617473756b6100ull, 0x6172616900000000ull, 0x6174616d69000000ull, 0x66756a6900000000ull,
+    0x66756a6965646100ull, 0x66756a696b617761ull, 0x66756a696e6f6d69ull, 0x66756b75726f6900ull,
+    0x676f74656d626100ull, 0x6861696261726100ull, 0x68616d616d617473ull, 0x6869676173686969ull,
+    0x69746f0000000000ull, 0x6977617461000000ull, 0x697a750000000000ull, 0x697a756e6f6b756eull,
+    0x6b616b6567617761ull, 0x6b616e6e616d6900ull, 0x6b6177616e65686full, 0x6b6177617a750000ull,
+    0x6b696b7567617761ull, 0x6b6f736169000000ull, 0x6d616b696e6f6861ull, 0x6d617473757a616bull,
+    0x6d696e616d69697aull, 0x6d697368696d6100ull, 0x6d6f72696d616368ull, 0x6e69736869697a75ull,
+    0x6e756d617a750000ull, 0x6f6d61657a616b69ull, 0x7368696d61646100ull, 0x7368696d697a7500ull,
+    0x7368696d6f646100ull, 0x7368697a756f6b61ull, 0x7375736f6e6f0000ull, 0x7961697a75000000ull,
+    0x796f736869646100ull, 0x617368696b616761ull, 0x6261746f00000000ull, 0x6861676100000000ull,
+    0x696368696b616900ull, 0x69776166756e6500ull, 0x6b616d696e6f6b61ull, 0x6b616e756d610000ull,
+    0x6b61726173757961ull, 0x6b75726f69736f00ull, 0x6d617368696b6f00ull, 0x6d69627500000000ull,
+    0x6d6f6b6100000000ull, 0x6d6f746567690000ull, 0x6e61737500000000ull, 0x6e6173757368696full,
+    0x6e696b6b6f000000ull, 0x6e697368696b6174ull, 0x6e6f676900000000ull, 0x6f68697261000000ull,
+    0x6f68746177617261ull, 0x6f79616d61000000ull, 0x73616b7572610000ull, 0x73616e6f00000000ull,
+    0x7368696d6f747375ull, 0x7368696f79610000ull, 0x74616b616e657a61ull, 0x746f636869676900ull,
+    0x7473756761000000ull, 0x756a696965000000ull, 0x757473756e6f6d69ull, 0x7961697461000000ull,
+    0x61697a756d690000ull, 0x616e616e00000000ull, 0x6963686962610000ull, 0x6974616e6f000000ull,
+    0x6b61696e616e0000ull, 0x6b6f6d6174737573ull, 0x6d61747375736869ull, 0x6d696d6100000000ull,
+    0x6d696e616d690000ull, 0x6d69796f73686900ull, 0x6d75676900000000ull, 0x6e616b6167617761ull,
+    0x6e617275746f0000ull, 0x73616e61676f6368ull, 0x7368697368696b75ull, 0x746f6b757368696dull,
+    0x77616a696b690000ull, 0x6164616368690000ull, 0x616b6972756e6f00ull, 0x616b697368696d61ull,
+    0x616f67617368696dull, 0x6172616b61776100ull, 0x62756e6b796f0000ull, 0x636869796f646100ull,
+    0x63686f6675000000ull, 0x6368756f00000000ull, 0x65646f6761776100ull, 0x6675636875000000ull,
+    0x6675737361000000ull, 0x68616368696a6f00ull, 0x68616368696f6a69ull, 0x68616d7572610000ull,
+    0x686967617368696bull, 0x686967617368696dull, 0x6869676173686979ull, 0x68696e6f00000000ull,
+    0x68696e6f64650000ull, 0x68696e6f68617261ull, 0x696e616769000000ull, 0x6974616261736869ull,
+    0x6b61747375736869ull, 0x6b69746100000000ull, 0x6b69796f73650000ull, 0x6b6f646169726100ull,
+    0x6b6f67616e656900ull, 0x6b6f6b7562756e6aull, 0x6b6f6d6165000000ull, 0x6b6f746f00000000ull,
+    0x6b6f757a75736869ull, 0x6b756e6974616368ull, 0x6d61636869646100ull, 0x6d656775726f0000ull,
+    0x6d696e61746f0000ull, 0x6d6974616b610000ull, 0x6d697a75686f0000ull, 0x6d7573617368696dull,
+    0x6d7573617368696eull, 0x6e616b616e6f0000ull, 0x6e6572696d610000ull, 0x6f67617361776172ull,
+    0x6f6b7574616d6100ull, 0x6f6d650000000000ull, 0x6f7368696d610000ull, 0x6f74610000000000ull,
+    0x7365746167617961ull, 0x7368696275796100ull, 0x7368696e61676177ull, 0x7368696e6a756b75ull,
+    0x737567696e616d69ull, 0x73756d6964610000ull, 0x74616368696b6177ull, 0x746169746f000000ull,
+    0x74616d6100000000ull, 0x746f7368696d6100ull, 0x6368697a75000000ull, 0x68696e6f00000000ull,
+    0x6b61776168617261ull, 0x6b6f676500000000ull, 0x6b6f746f75726100ull, 0x6d69736173610000ull,
+    0x6e616e6275000000ull, 0x6e696368696e616eull, 0x73616b61696d696eull, 0x746f74746f726900ull,
+    0x77616b6173610000ull, 0x79617a7500000000ull, 0x796f6e61676f0000ull, 0x6173616869000000ull,
+    0x6675636875000000ull, 0x66756b756d697473ull, 0x66756e6168617368ull, 0x68696d6900000000ull,
+    0x696d697a75000000ull, 0x696e616d69000000ull, 0x6a6f68616e610000ull, 0x6b616d6969636869ull,
+    0x6b75726f62650000ull, 0x6e616b616e69696bull, 0x6e616d6572696b61ull, 0x6e616e746f000000ull,
+    0x6e79757a656e0000ull, 0x6f79616265000000ull, 0x7461697261000000ull, 0x74616b616f6b6100ull,
+    0x7461746579616d61ull, 0x746f676100000000ull, 0x746f6e616d690000ull, 0x746f79616d610000ull,
+    0x756e617a756b6900ull, 0x756f7a7500000000ull, 0x79616d6164610000ull, 0x6172696461000000ull,
+    0x6172696461676177ull, 0x676f626f00000000ull, 0x68617368696d6f74ull, 0x686964616b610000ull,
+    0x6869726f67617761ull, 0x696e616d69000000ull, 0x6977616465000000ull, 0x6b61696e616e0000ull,
+    0x6b616d69746f6e64ull, 0x6b61747375726167ull, 0x6b696d696e6f0000ull, 0x6b696e6f6b617761ull,
+    0x6b69746179616d61ull, 0x6b6f796100000000ull, 0x6b6f7a6100000000ull, 0x6b6f7a6167617761ull,
+    0x6b75646f79616d61ull, 0x6b757368696d6f74ull, 0x6d6968616d610000ull, 0x6d697361746f0000ull,
+    0x6e616368696b6174ull, 0x7368696e67750000ull, 0x736869726168616dull, 0x7461696a69000000ull,
+    0x74616e6162650000ull, 0x77616b6179616d61ull, 0x7975617361000000ull, 0x7975726100000000ull,
+    0x6173616869000000ull, 0x66756e6167617461ull, 0x686967617368696eull, 0x6969646500000000ull,
+    0x6b61686f6b750000ull, 0x6b616d696e6f7961ull, 0x6b616e6579616d61ull, 0x6b6177616e697368ull,
+    0x6d616d75726f6761ull, 0x6d696b6177610000ull, 0x6d75726179616d61ull, 0x6e61676169000000ull,
+    0x6e616b6179616d61ull, 0x6e616e796f000000ull, 0x6e697368696b6177ull, 0x6f62616e617a6177ull,
+    0x6f65000000000000ull, 0x6f67756e69000000ull, 0x6f686b7572610000ull, 0x6f69736869646100ull,
+    0x7361676165000000ull, 0x73616b6174610000ull, 0x73616b6567617761ull, 0x7368696e6a6f0000ull,
+    0x736869726174616bull, 0x73686f6e61690000ull, 0x74616b6168617461ull, 0x74656e646f000000ull,
+    0x746f7a6177610000ull, 0x74737572756f6b61ull, 0x79616d6167617461ull, 0x79616d616e6f6265ull,
+    0x796f6e657a617761ull, 0x79757a6100000000ull, 0x6162750000000000ull, 0x6861676900000000ull,
+    0x68696b6172690000ull, 0x686f667500000000ull, 0x6977616b756e6900ull, 0x6b7564616d617473ull,
+    0x6d69746f75000000ull, 0x6e616761746f0000ull, 0x6f7368696d610000ull, 0x7368696d6f6e6f73ull,
+    0x7368756e616e0000ull, 0x7461627573650000ull, 0x746f6b7579616d61ull, 0x746f796f74610000ull,
+    0x7562650000000000ull, 0x7975750000000000ull, 0x6368756f00000000ull, 0x646f736869000000ull,
+    0x66756566756b6900ull, 0x66756a696b617761ull, 0x66756a696b617761ull, 0x66756a69796f7368ull,
+    0x686179616b617761ull, 0x686f6b75746f0000ull, 0x696368696b617761ull, 0x6b61690000000000ull,
+    0x6b6f667500000000ull, 0x6b6f736875000000ull, 0x6b6f737567650000ull, 0x6d696e616d692d61ull,
+    0x6d696e6f62750000ull, 0x6e616b616d696368ull, 0x6e616e6275000000ull, 0x6e61727573617761ull,
+    0x6e69726173616b69ull, 0x6e697368696b6174ull, 0x6f7368696e6f0000ull, 0x6f7473756b690000ull,
+    0x73686f7761000000ull, 0x7461626179616d61ull, 0x7473757275000000ull, 0x75656e6f68617261ull,
+    0x79616d616e616b61ull, 0x79616d616e617368ull, 0x6369747900000000ull, 0x626c6f6773706f74ull,
+    0x7570616173000000ull, 0x6465760000000000ull, 0x7369746573000000ull, 0x6c6f63616c686f73ull,
+    0x7369746500000000ull, 0x626c6f6773706f74ull, 0x666f72676f740000ull, 0x666f72676f740000ull,
+    0x70726f6400000000ull, 0x3100000000000000ull, 0x3200000000000000ull, 0x63656e7472616c75ull,
+    0x6561737461736961ull, 0x6561737475733200ull, 0x776573746575726full, 0x7765737475733200ull,
+    0x7200000000000000ull, 0x7500000000000000ull, 0x667261312d646500ull, 0x77657374312d7573ull,
+    0x6a6c732d73746f31ull, 0x6a6c732d73746f32ull, 0x6a6c732d73746f33ull, 0x66726565746c7300ull,
+    0x6d61700000000000ull, 0x70726f6400000000ull, 0x73736c0000000000ull, 0x6d61700000000000ull,
+    0x7061617300000000ull, 0x686f7374696e6700ull, 0x7765627061617300ull, 0x6a656c6173746963ull,
+    0x6e6f726465737465ull, 0x6a00000000000000ull, 0x736f630000000000ull, 0x7573657200000000ull,
+    0x6265746100000000ull, 0x7061676573000000ull, 0x6a656c6173746963ull, 0x6a656c6173746963ull,
+    0x73746f7261676500ull, 0x7765627369746500ull, 0x626c6f6773706f74ull, 0x6773000000000000ull,
+    0x6773000000000000ull, 0x6e65730000000000ull, 0x6773000000000000ull, 0x6e65730000000000ull,
+    0x6773000000000000ull, 0x6f73000000000000ull, 0x76616c6572000000ull, 0x76c3a56c65720000ull,
+    0x786e2d2d766c6572ull, 0x6773000000000000ull, 0x6773000000000000ull, 0x6f73000000000000ull,
+    0x6773000000000000ull, 0x6865726f79000000ull, 0x73616e6465000000ull, 0x6773000000000000ull,
+    0x686572c3b8790000ull, 0x73616e6465000000ull, 0x6773000000000000ull, 0x626f000000000000ull,
+    0x62c3b80000000000ull, 0x6865726f79000000ull, 0x686572c3b8790000ull, 0x786e2d2d622d3567ull,
+    0x786e2d2d68657279ull, 0x6773000000000000ull, 0x6773000000000000ull, 0x6773000000000000ull,
+    0x6773000000000000ull, 0x76616c6572000000ull, 0x6773000000000000ull, 0x6773000000000000ull,
+    0x6773000000000000ull, 0x6773000000000000ull, 0x626f000000000000ull, 0x62c3b80000000000ull,
+    0x786e2d2d622d3567ull, 0x6773000000000000ull, 0x6773000000000000ull, 0x6773000000000000ull,
+    0x73616e6465000000ull, 0x6773000000000000ull, 0x73616e6465000000ull, 0x786e2d2d68657279ull,
+    0x786e2d2d766c6572ull, 0x76c3a56c65720000ull, 0x626c6f6773706f74ull, 0x73746167696e6700ull,
+    0x74656c6500000000ull, 0x6300000000000000ull, 0x7273630000000000ull, 0x6f726967696e0000ull,
+    0x676f000000000000ull, 0x686f6d6500000000ull, 0x616c000000000000ull, 0x6173736f00000000ull,
+    0x6174000000000000ull, 0x6175000000000000ull, 0x6265000000000000ull, 0x6267000000000000ull,
+    0x6361000000000000ull, 0x6364000000000000ull, 0x6368000000000000ull, 0x636e000000000000ull,
+    0x6379000000000000ull, 0x637a000000000000ull, 0x6465000000000000ull, 0x646b000000000000ull,
+    0x6564750000000000ull, 0x6565000000000000ull, 0x6573000000000000ull, 0x6669000000000000ull,
+    0x6672000000000000ull, 0x6772000000000000ull, 0x6872000000000000ull, 0x6875000000000000ull,
+    0x6965000000000000ull, 0x696c000000000000ull, 0x696e000000000000ull, 0x696e740000000000ull,
+    0x6973000000000000ull, 0x6974000000000000ull, 0x6a70000000000000ull, 0x6b72000000000000ull,
+    0x6c74000000000000ull, 0x6c75000000000000ull, 0x6c76000000000000ull, 0x6d63000000000000ull,
+    0x6d65000000000000ull, 0x6d6b000000000000ull, 0x6d74000000000000ull, 0x6d79000000000000ull,
+    0x6e65740000000000ull, 0x6e67000000000000ull, 0x6e6c000000000000ull, 0x6e6f000000000000ull,
+    0x6e7a000000000000ull, 0x7061726973000000ull, 0x706c000000000000ull, 0x7074000000000000ull,
+    0x712d610000000000ull, 0x726f000000000000ull, 0x7275000000000000ull, 0x7365000000000000ull,
+    0x7369000000000000ull, 0x736b000000000000ull, 0x7472000000000000ull, 0x756b000000000000ull,
+    0x7573000000000000ull, 0x636c6f7564000000ull, 0x6f73000000000000ull, 0x7374670000000000ull,
+    0x7333000000000000ull, 0x6170000000000000ull, 0x6772697700000000ull, 0x6963000000000000ull,
+    0x6973000000000000ull, 0x6b6d707370000000ull, 0x6b6f6e73756c6174ull, 0x6b70707370000000ull,
+    0x6b77700000000000ull, 0x6b77707370000000ull, 0x6d75700000000000ull, 0x6d77000000000000ull,
+    0x6f69726d00000000ull, 0x6f756d0000000000ull, 0x7061000000000000ull, 0x70696e6200000000ull,
+    0x7069770000000000ull, 0x706f000000000000ull, 0x7073700000000000ull, 0x7073736500000000ull,
+    0x7075700000000000ull, 0x727a677700000000ull, 0x7361000000000000ull, 0x73646e0000000000ull,
+    0x736b6f0000000000ull, 0x736f000000000000ull, 0x7372000000000000ull, 0x737461726f737477ull,
+    0x7567000000000000ull, 0x7567696d00000000ull, 0x756d000000000000ull, 0x756d696700000000ull,
+    0x75706f7700000000ull, 0x7570706f00000000ull, 0x7573000000000000ull, 0x7577000000000000ull,
+    0x757a730000000000ull, 0x7769660000000000ull, 0x7769696800000000ull, 0x77696e6200000000ull,
+    0x77696f7300000000ull, 0x7769746400000000ull, 0x7769770000000000ull, 0x7773610000000000ull,
+    0x77736b7200000000ull, 0x77756f7a00000000ull, 0x777a6d6975770000ull, 0x7a70000000000000ull,
+    0x6263690000000000ull, 0x73686f7000000000ull, 0x6862000000000000ull, 0x7670730000000000ull,
+    0x686f7374696e6700ull, 0x6c616e64696e6700ull, 0x737065637472756dull, 0x7670730000000000ull,
+    0x6a656c6173746963ull, 0x7365727669636500ull, 0x7375000000000000ull, 0x6263000000000000ull,
+    0x656e740000000000ull, 0x6575000000000000ull, 0x7573000000000000ull, 0x6469726563740000ull,
+    0x626c6f6773706f74ull, 0x676f760000000000ull, 0x6d796d61696c6572ull, 0x6164696d6f000000ull,
+    0x6261727379000000ull, 0x62617273796f6e6cull, 0x626c6f6773706f74ull, 0x627974656d61726bull,
+    0x6c61796572736869ull, 0x6d79737072656164ull, 0x6e682d7365727600ull, 0x6e6f2d6970000000ull,
+    0x726574726f736e75ull, 0x77656c6c6265696eull, 0x6170690000000000ull, 0x63616d706169676eull,
+    0x686f6d656f666669ull, 0x7365727669636500ull, 0x616666696e697479ull, 0x676c756700000000ull,
+    0x6c75670000000000ull, 0x6c75677300000000ull, 0x726166666c65656eull, 0x7765656b6c796c6full,
+    0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull,
+    0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull,
+    0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull,
+    0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull,
+    0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull,
+    0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull,
+    0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull,
+    0x6b31320000000000ull, 0x6c69620000000000ull, 0x7068780000000000ull, 0x6363000000000000ull,
+    0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull,
+    0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull,
+    0x6363000000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull,
+    0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull,
+    0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull,
+    0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull,
+    0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull,
+    0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull,
+    0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull,
+    0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull,
+    0x616e6e2d6172626full, 0x6363000000000000ull, 0x636f670000000000ull, 0x6473740000000000ull,
+    0x6561746f6e000000ull, 0x67656e0000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull,
+    0x6d75730000000000ull, 0x7465630000000000ull, 0x7761736874656e61ull, 0x6363000000000000ull,
+    0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull,
+    0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull,
+    0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull,
+    0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull, 0x6c69620000000000ull,
+    0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull,
+    0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull,
+    0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull,
+    0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull,
+    0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull,
+    0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull,
+    0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull,
+    0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull,
+    0x6c69620000000000ull, 0x6363000000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull,
+    0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull, 0x6c69620000000000ull,
+    0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull,
+    0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull,
+    0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull,
+    0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull,
+    0x6b31320000000000ull, 0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull,
+    0x6c69620000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull,
+    0x6363000000000000ull, 0x6363000000000000ull, 0x6b31320000000000ull, 0x6c69620000000000ull,
+    0x626c6f6773706f74ull, 0x6400000000000000ull, 0x626c6f6773706f74ull, 0x6d656c0000000000ull,
+    0x7363686f6f6c7300ull, 0x7363616c65000000ull, 0x616c703100000000ull, 0x6575720000000000ull,
+    0x66722d7061722d31ull, 0x66722d7061722d32ull, 0x6e6c2d616d732d31ull, 0x666e630000000000ull,
+    0x6b38730000000000ull, 0x7333000000000000ull, 0x73332d7765627369ull, 0x77686d0000000000ull,
+    0x7072697600000000ull, 0x7075620000000000ull, 0x6b38730000000000ull, 0x7333000000000000ull,
+    0x73332d7765627369ull, 0x77686d0000000000ull, 0x6b38730000000000ull, 0x7333000000000000ull,
+    0x73332d7765627369ull, 0x636e2d6e6f727468ull, 0x636f6d7075746500ull, 0x6562000000000000ull,
+    0x656c620000000000ull, 0x636c6f7564390000ull, 0x636c6f7564390000ull, 0x636c6f7564390000ull,
+    0x6475616c73746163ull, 0x636c6f7564390000ull, 0x6475616c73746163ull, 0x7333000000000000ull,
+    0x73332d7765627369ull, 0x636c6f7564390000ull, 0x636c6f7564390000ull, 0x6475616c73746163ull,
+    0x7333000000000000ull, 0x73332d7765627369ull, 0x636c6f7564390000ull, 0x6475616c73746163ull,
+    0x636c6f7564390000ull, 0x6475616c73746163ull, 0x636c6f7564390000ull, 0x6475616c73746163ull,
+    0x7333000000000000ull, 0x73332d7765627369ull, 0x636c6f7564390000ull, 0x6475616c73746163ull,
+    0x7333000000000000ull, 0x73332d7765627369ull, 0x636c6f7564390000ull, 0x636c6f7564390000ull,
+    0x636c6f7564390000ull, 0x6475616c73746163ull, 0x636c6f7564390000ull, 0x6475616c73746163ull,
+    0x7333000000000000ull, 0x73332d7765627369ull, 0x636c6f7564390000ull, 0x6475616c73746163ull,
+    0x7333000000000000ull, 0x73332d7765627369ull, 0x636c6f7564390000ull, 0x636c6f7564390000ull,
+    0x6475616c73746163ull, 0x636c6f7564390000ull, 0x6475616c73746163ull, 0x636c6f7564390000ull,
+    0x6475616c73746163ull, 0x7333000000000000ull, 0x73332d7765627369ull, 0x636c6f7564390000ull,
+    0x636c6f7564390000ull, 0x6a00000000000000ull, 0x666c740000000000ull, 0x7573720000000000ull,
+    0x7061676573000000ull, 0x6375737400000000ull, 0x7265736572766400ull, 0x6375737400000000ull,
+    0x7265736572766400ull, 0x6375737400000000ull, 0x6375737400000000ull, 0x7265736572766400ull,
+    0x6a656c6173746963ull, 0x7573657200000000ull, 0x63646e0000000000ull, 0x6100000000000000ull,
+    0x676c6f62616c0000ull, 0x6100000000000000ull, 0x6200000000000000ull, 0x676c6f62616c0000ull,
+    0x66722d3100000000ull, 0x6c6f6e2d31000000ull, 0x6c6f6e2d32000000ull, 0x6e792d3100000000ull,
+    0x6e792d3200000000ull, 0x73672d3100000000ull, 0x61746c0000000000ull, 0x6e6a730000000000ull,
+    0x7269630000000000ull, 0x73736c0000000000ull, 0x6170700000000000ull, 0x6f73000000000000ull,
+    0x6468000000000000ull, 0x766d000000000000ull, 0x6a00000000000000ull, 0x6375737400000000ull,
+    0x6368747200000000ull, 0x7061726f63680000ull, 0x7076740000000000ull, 0x7573657273000000ull,
+    0x6974310000000000ull, 0x66756e6374696f6eull, 0x6e6f646573000000ull, 0x6e6f646573000000ull,
+    0x6e6f646573000000ull, 0x7333000000000000ull, 0x636e2d6e6f727468ull, 0x636e2d6e6f727468ull,
+    0x7666730000000000ull, 0x776562766965772dull, 0x7666730000000000ull, 0x776562766965772dull,
+    0x7666730000000000ull, 0x776562766965772dull, 0x7333000000000000ull, 0x7666730000000000ull,
+    0x776562766965772dull, 0x7333000000000000ull, 0x7666730000000000ull, 0x776562766965772dull,
+    0x7666730000000000ull, 0x776562766965772dull, 0x7333000000000000ull, 0x7666730000000000ull,
+    0x776562766965772dull, 0x7333000000000000ull, 0x7666730000000000ull, 0x776562766965772dull,
+    0x7333000000000000ull, 0x7666730000000000ull, 0x776562766965772dull, 0x7333000000000000ull,
+    0x7666730000000000ull, 0x776562766965772dull, 0x7333000000000000ull, 0x7666730000000000ull,
+    0x776562766965772dull, 0x7666730000000000ull, 0x776562766965772dull, 0x7666730000000000ull,
+    0x776562766965772dull, 0x7333000000000000ull, 0x7666730000000000ull, 0x776562766965772dull,
+    0x7333000000000000ull, 0x7666730000000000ull, 0x776562766965772dull, 0x7333000000000000ull,
+    0x7666730000000000ull, 0x776562766965772dull, 0x7666730000000000ull, 0x776562766965772dull,
+    0x7333000000000000ull, 0x7666730000000000ull, 0x776562766965772dull, 0x7333000000000000ull,
+    0x7666730000000000ull, 0x776562766965772dull, 0x7333000000000000ull, 0x7666730000000000ull,
+    0x776562766965772dull, 0x7666730000000000ull, 0x776562766965772dull, 0x636c6f7564000000ull,
+    0x6170700000000000ull,
+};
+
+// Top-level labels whose first byte is b are NODES[ROOT_INDEX[b], ROOT_INDEX[b + 1])
+static const uint32_t ROOT_INDEX[257] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 96, 187, 307, 362, 396, 460, 531, 578, 619, 641, 674, 740, 821, 869,
+    895, 966, 970, 1018, 1145, 1219, 1232, 1270, 1304, 1472, 1484, 1493, 1493, 1493, 1493, 1493,
+    1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
+    1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
+    1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
+    1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493,
+    1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1495,
+    1495, 1506, 1511, 1512, 1512, 1512, 1513, 1513, 1515, 1543, 1554, 1555, 1555, 1555, 1555, 1555,
+    1555, 1577, 1578, 1578, 1587, 1596, 1614, 1629, 1636, 1640, 1648, 1648, 1650, 1651, 1652, 1652,
+    1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+    1652,
+};
+
+} // namespace psl
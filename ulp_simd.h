@@ -0,0 +1,344 @@
+// ulp_simd.h
+// Byte-scanning kernels for the ulp hot path with runtime CPU dispatch
+// Each kernel exists in scalar, SSE4.2, AVX2 and AVX-512BW variants; the best one the host supports
+// is picked once at startup via cpuid, so a single portable binary still gets wide vectors.
+// Set ULP_SIMD=scalar|sse4.2|avx2|avx512 to force a narrower variant (benchmarks, debugging).
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+  #define ULP_SIMD_X86 1
+  #include <immintrin.h>
+  // GCC does not realign the stack for 32/64-byte spills on Windows x64 (GCC bug 54412),
+  // so only the 16-byte variant is compiled there
+  #ifndef _WIN32
+    #define ULP_SIMD_WIDE 1
+  #endif
+#endif
+
+namespace simd {
+
+struct Kernels {
+    const char *name;
+    // First occurrence of c in [p, end), or end
+    const char *(*findByte)(const char *p, const char *end, char c);
+    // ASCII A-Z to a-z in place; other bytes untouched
+    void (*lowerAscii)(char *p, size_t n);
+    // Hit bitmaps for n/64 full windows: bit i of masks[w * count + k] is set when
+    // p[w * 64 + i] == needles[k]; n must be a multiple of 64 and count at most MAX_NEEDLES
+    void (*classify)(const char *p, size_t n, const char *needles, size_t count, uint64_t *masks);
+};
+
+constexpr size_t MAX_NEEDLES = 4;
+
+// ---- scalar ----
+
+inline const char *findByteScalar(const char *p, const char *end, char c) {
+    const void *hit = std::memchr(p, c, static_cast<size_t>(end - p));
+    return hit ? static_cast<const char *>(hit) : end;
+}
+
+inline void lowerAsciiScalar(char *p, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        unsigned char ch = static_cast<unsigned char>(p[i]);
+        if (static_cast<unsigned char>(ch - 'A') < 26) p[i] = static_cast<char>(ch | 0x20);
+    }
+}
+
+inline void classifyScalar(const char *p, size_t n, const char *needles, size_t count, uint64_t *masks) {
+    for (size_t w = 0; w < n / 64; ++w) {
+        for (size_t k = 0; k < count; ++k) {
+            uint64_t m = 0;
+            for (size_t i = 0; i < 64; ++i)
+                m |= static_cast<uint64_t>(p[w * 64 + i] == needles[k]) << i;
+            masks[w * count + k] = m;
+        }
+    }
+}
+
+#ifdef ULP_SIMD_X86
+
+// ---- SSE4.2 (16 bytes) ----
+
+__attribute__((target("sse4.2")))
+inline const char *findByteSse42(const char *p, const char *end, char c) {
+    const __m128i needle = _mm_set1_epi8(c);
+    for (; end - p >= 16; p += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, needle)));
+        if (mask) return p + __builtin_ctz(mask);
+    }
+    return findByteScalar(p, end, c);
+}
+
+__attribute__((target("sse4.2")))
+inline void lowerAsciiSse42(char *p, size_t n) {
+    const __m128i a = _mm_set1_epi8('A'), span = _mm_set1_epi8(25), bit = _mm_set1_epi8(0x20);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+        __m128i rel = _mm_sub_epi8(v, a);
+        __m128i upper = _mm_cmpeq_epi8(_mm_min_epu8(rel, span), rel);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(p + i), _mm_or_si128(v, _mm_and_si128(upper, bit)));
+    }
+    lowerAsciiScalar(p + i, n - i);
+}
+
+__attribute__((target("sse4.2")))
+inline void classifySse42(const char *p, size_t n, const char *needles, size_t count, uint64_t *masks) {
+    for (size_t w = 0; w < n / 64; ++w) {
+        const char *q = p + w * 64;
+        __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(q));
+        __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(q + 16));
+        __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(q + 32));
+        __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(q + 48));
+        for (size_t k = 0; k < count; ++k) {
+            __m128i needle = _mm_set1_epi8(needles[k]);
+            uint64_t m0 = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v0, needle)));
+            uint64_t m1 = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v1, needle)));
+            uint64_t m2 = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v2, needle)));
+            uint64_t m3 = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v3, needle)));
+            masks[w * count + k] = m0 | (m1 << 16) | (m2 << 32) | (m3 << 48);
+        }
+    }
+}
+
+#ifdef ULP_SIMD_WIDE
+
+// ---- AVX2 (32 bytes) ----
+
+__attribute__((target("avx2")))
+inline const char *findByteAvx2(const char *p, const char *end, char c) {
+    const __m256i needle = _mm256_set1_epi8(c);
+    for (; end - p >= 32; p += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, needle)));
+        if (mask) return p + __builtin_ctz(mask);
+    }
+    return findByteSse42(p, end, c);
+}
+
+__attribute__((target("avx2")))
+inline void lowerAsciiAvx2(char *p, size_t n) {
+    const __m256i a = _mm256_set1_epi8('A'), span = _mm256_set1_epi8(25), bit = _mm256_set1_epi8(0x20);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+        __m256i rel = _mm256_sub_epi8(v, a);
+        __m256i upper = _mm256_cmpeq_epi8(_mm256_min_epu8(rel, span), rel);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(p + i),
+                            _mm256_or_si256(v, _mm256_and_si256(upper, bit)));
+    }
+    lowerAsciiSse42(p + i, n - i);
+}
+
+__attribute__((target("avx2")))
+inline void classifyAvx2(const char *p, size_t n, const char *needles, size_t count, uint64_t *masks) {
+    for (size_t w = 0; w < n / 64; ++w) {
+        const char *q = p + w * 64;
+        __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(q));
+        __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(q + 32));
+        for (size_t k = 0; k < count; ++k) {
+            __m256i needle = _mm256_set1_epi8(needles[k]);
+            uint64_t mlo = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, needle)));
+            uint64_t mhi = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, needle)));
+            masks[w * count + k] = mlo | (mhi << 32);
+        }
+    }
+}
+
+// ---- AVX-512BW (64 bytes, masked tails) ----
+
+__attribute__((target("avx512f,avx512bw")))
+inline const char *findByteAvx512(const char *p, const char *end, char c) {
+    const __m512i needle = _mm512_set1_epi8(c);
+    while (p < end) {
+        size_t left = static_cast<size_t>(end - p);
+        __mmask64 live = left >= 64 ? ~0ull : ((1ull << left) - 1);
+        __m512i v = _mm512_maskz_loadu_epi8(live, p);
+        __mmask64 hits = _mm512_mask_cmpeq_epi8_mask(live, v, needle);
+        if (hits) return p + __builtin_ctzll(hits);
+        p += 64;
+    }
+    return end;
+}
+
+__attribute__((target("avx512f,avx512bw")))
+inline void lowerAsciiAvx512(char *p, size_t n) {
+    const __m512i a = _mm512_set1_epi8('A'), span = _mm512_set1_epi8(25), bit = _mm512_set1_epi8(0x20);
+    for (size_t i = 0; i < n; i += 64) {
+        size_t left = n - i;
+        __mmask64 live = left >= 64 ? ~0ull : ((1ull << left) - 1);
+        __m512i v = _mm512_maskz_loadu_epi8(live, p + i);
+        __mmask64 upper = _mm512_cmple_epu8_mask(_mm512_sub_epi8(v, a), span);
+        _mm512_mask_storeu_epi8(p + i, live, _mm512_mask_add_epi8(v, upper, v, bit));
+    }
+}
+
+__attribute__((target("avx512f,avx512bw")))
+inline void classifyAvx512(const char *p, size_t n, const char *needles, size_t count, uint64_t *masks) {
+    for (size_t w = 0; w < n / 64; ++w) {
+        __m512i v = _mm512_loadu_si512(p + w * 64);
+        for (size_t k = 0; k < count; ++k)
+            masks[w * count + k] = _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8(needles[k]));
+    }
+}
+
+#endif // ULP_SIMD_WIDE
+#endif // ULP_SIMD_X86
+
+// Variants this host can run, widest first
+inline size_t availableKernels(const Kernels **out, size_t max) {
+    size_t n = 0;
+    auto add = [&](const Kernels &k) { if (n < max) out[n++] = &k; };
+#ifdef ULP_SIMD_X86
+    __builtin_cpu_init();
+  #ifdef ULP_SIMD_WIDE
+    static const Kernels avx512 = { "avx512", findByteAvx512, lowerAsciiAvx512, classifyAvx512 };
+    static const Kernels avx2 = { "avx2", findByteAvx2, lowerAsciiAvx2, classifyAvx2 };
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+        add(avx512);
+    if (__builtin_cpu_supports("avx2")) add(avx2);
+  #endif
+    static const Kernels sse42 = { "sse4.2", findByteSse42, lowerAsciiSse42, classifySse42 };
+    if (__builtin_cpu_supports("sse4.2")) add(sse42);
+#endif
+    static const Kernels scalar = { "scalar", findByteScalar, lowerAsciiScalar, classifyScalar };
+    add(scalar);
+    return n;
+}
+
+// Widest supported variant, or the one named by ULP_SIMD if the host supports it
+inline const Kernels &select() {
+    const Kernels *all[4];
+    size_t n = availableKernels(all, 4);
+    if (const char *forced = std::getenv("ULP_SIMD")) {
+        for (size_t i = 0; i < n; ++i)
+            if (std::strcmp(all[i]->name, forced) == 0) return *all[i];
+    }
+    return *all[0];
+}
+
+// Kernels chosen for this process; resolved once on first use
+inline const Kernels &kernels() {
+    static const Kernels &chosen = select();
+    return chosen;
+}
+
+// Position of sep in s at or after start, or npos; single-byte separators use the byte kernel
+inline size_t findSeparator(const std::string &s, const std::string &sep, size_t start) {
+    if (sep.empty() || start > s.size()) return std::string::npos;
+    const char *begin = s.data(), *end = begin + s.size();
+    const char *p = begin + start;
+    const char first = sep[0];
+    const Kernels &k = kernels();
+    while (true) {
+        p = k.findByte(p, end, first);
+        if (static_cast<size_t>(end - p) < sep.size()) return std::string::npos;
+        if (sep.size() == 1 || std::memcmp(p + 1, sep.data() + 1, sep.size() - 1) == 0)
+            return static_cast<size_t>(p - begin);
+        ++p;
+    }
+}
+
+// Append base + index of every set bit of mask to out (simdjson-style flattening)
+inline void flattenMask(uint64_t mask, uint32_t base, std::vector<uint32_t> &out) {
+    while (mask) {
+#if defined(__GNUC__) || defined(__clang__)
+        out.push_back(base + static_cast<uint32_t>(__builtin_ctzll(mask)));
+#else
+        uint32_t bit = 0;
+        while (!((mask >> bit) & 1)) ++bit;
+        out.push_back(base + bit);
+#endif
+        mask &= mask - 1;
+    }
+}
+
+// Stage-1 structural index of a block: sorted offsets of every occurrence of each needle byte
+struct StructuralIndex {
+    std::vector<uint32_t> positions[MAX_NEEDLES];
+
+    void build(const char *p, size_t n, const char *needles, size_t count, const Kernels &kern = kernels()) {
+        for (size_t k = 0; k < count; ++k) positions[k].clear();
+        constexpr size_t WINDOWS = 64;                 // 4 KiB of input per classify call
+        uint64_t masks[WINDOWS * MAX_NEEDLES];
+        size_t full = n & ~static_cast<size_t>(63);
+        for (size_t off = 0; off < full; off += WINDOWS * 64) {
+            size_t len = std::min(full - off, WINDOWS * 64);
+            kern.classify(p + off, len, needles, count, masks);
+            for (size_t w = 0; w < len / 64; ++w)
+                for (size_t k = 0; k < count; ++k)
+                    flattenMask(masks[w * count + k], static_cast<uint32_t>(off + w * 64), positions[k]);
+        }
+        if (full < n) {
+            // Zero-padded copy of the tail; bits past n are masked off below
+            alignas(64) char tail[64] = {};
+            std::memcpy(tail, p + full, n - full);
+            kern.classify(tail, 64, needles, count, masks);
+            uint64_t live = (1ull << (n - full)) - 1;
+            for (size_t k = 0; k < count; ++k)
+                flattenMask(masks[k] & live, static_cast<uint32_t>(full), positions[k]);
+        }
+    }
+};
+
+// ASCII A-Z to a-z in eight bytes at once (SWAR); bytes >= 0x80 are left alone
+inline uint64_t foldAscii8(uint64_t x) {
+    constexpr uint64_t ones = 0x0101010101010101ull;
+    uint64_t low7 = x & (0x7F * ones);
+    uint64_t geA = low7 + (0x80 - 'A') * ones;       // high bit set where byte >= 'A'
+    uint64_t gtZ = low7 + (0x7F - 'Z') * ones;       // high bit set where byte > 'Z'
+    uint64_t upper = (geA ^ gtZ) & ~x & (0x80 * ones);
+    return x | (upper >> 2);
+}
+
+inline uint64_t load8(const char *p, size_t n) {
+    uint64_t w = 0;
+    std::memcpy(&w, p, n < 8 ? n : 8);
+    return w;
+}
+
+// Hint that p will be read soon, so independent table lookups can overlap their cache misses
+inline void prefetch(const void *p) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p);
+#else
+    (void)p;
+#endif
+}
+
+// ASCII case-insensitive equality, eight bytes per step, no lowercased copies
+inline bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) return false;
+    size_t i = 0, n = a.size();
+    for (; i + 8 <= n; i += 8)
+        if (foldAscii8(load8(a.data() + i, 8)) != foldAscii8(load8(b.data() + i, 8))) return false;
+    return i == n || foldAscii8(load8(a.data() + i, n - i)) == foldAscii8(load8(b.data() + i, n - i));
+}
+
+// ASCII case-insensitive 64-bit hash; equal under equalsIgnoreCase implies equal hashes
+inline uint64_t hashIgnoreCase(std::string_view s) {
+    auto mix = [](uint64_t h) {
+        h ^= h >> 32;
+        h *= 0xD6E8FEB86659FD93ull;
+        h ^= h >> 32;
+        return h;
+    };
+    uint64_t h = 0x9E3779B97F4A7C15ull ^ s.size();
+    size_t i = 0, n = s.size();
+    for (; i + 8 <= n; i += 8) h = mix(h ^ foldAscii8(load8(s.data() + i, 8))) + 0x632BE59BD9B4E019ull;
+    if (i < n) h = mix(h ^ foldAscii8(load8(s.data() + i, n - i)));
+    return mix(h);
+}
+
+} // namespace simd